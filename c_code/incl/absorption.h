@@ -154,6 +154,10 @@
  *	function mix_mixture_fugacity_coefficient:
  *		Returns mixture fugacity coefficient of cubic equation of state.
  *
+ *	long no_references:
+ *		Number of references to struct (i.e., number of working pairs sharing
+ *		struct).
+ *
  * Remarks:
  * --------
  *	Function returns NULL when function does not exist for a specific isotherm
@@ -163,6 +167,8 @@
  * --------
  *	02/13/2020, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Added number of references.
  *
  */
 typedef struct Absorption Absorption;
@@ -211,6 +217,8 @@ Absorption *newAbsorption(const char *isotherm_type, double isotherm_par[]);
  * --------------
  *
  * Destructor function to free allocated memory of a Absorption-struct.
+ * If struct is shared by several working pairs, function only decrements
+ * number of references and frees memory when last reference is deleted.
  *
  * Parameters:
  * -----------
@@ -221,6 +229,8 @@ Absorption *newAbsorption(const char *isotherm_type, double isotherm_par[]);
  * --------
  *	02/13/2020, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Added number of references.
  *
  */
 void delAbsorption(void *absorption);
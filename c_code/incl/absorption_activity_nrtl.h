@@ -195,4 +195,80 @@ double absorption_activity_nrtl_x_pTgpsat(double p_Pa, double T_K,
 	double (*func_gamma)(double, double, double[]), double p_sat_Pa,
 	double isotherm_par[]);
 
+
+/*
+ * absorption_activity_nrtl_fdg_dp_dpar_Txpsat:
+ * --------------------------------------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa of first component and its
+ * derivatives with respect to the coefficients of the NRTL equation depending
+ * on temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
+ * and saturation pressure of first component p_sat_Pa in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dp_dpar[]:
+ *		Array to be filled with derivatives of equilibrium pressure wrt.
+ *		coefficients (i.e., in order of coefficients).
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of NRTL equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double absorption_activity_nrtl_fdg_dp_dpar_Txpsat(double ret_dp_dpar[],
+	double T_K, double x_molmol, double p_sat_Pa, double isotherm_par[]);
+
+
+/*
+ * absorption_activity_nrtl_dgT_dp_dpar_Txpsat:
+ * --------------------------------------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa of first component and its
+ * derivatives with respect to the coefficients of the NRTL equation depending
+ * on temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
+ * and saturation pressure of first component p_sat_Pa in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dp_dpar[]:
+ *		Array to be filled with derivatives of equilibrium pressure wrt.
+ *		coefficients (i.e., in order of coefficients).
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of NRTL equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double absorption_activity_nrtl_dgT_dp_dpar_Txpsat(double ret_dp_dpar[],
+	double T_K, double x_molmol, double p_sat_Pa, double isotherm_par[]);
+
 #endif
@@ -245,4 +245,106 @@ double absorption_activity_wilson_x_pTv1v2psat(double p_Pa, double T_K,
 	double v1_m3mol, double v2_m3mol, double (*func_gamma)(double, double,
 	double, double, double[]), double p_sat_Pa, double isotherm_par[]);
 
+
+/*
+ * absorption_activity_wilson_fdl_dp_dpar_Txv1v2psat:
+ * --------------------------------------------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa of first component and its
+ * derivatives with respect to the coefficients of the Wilson equation depending
+ * on temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
+ * molar volumes of both components in m³/mol, and saturation pressure of first
+ * component p_sat_Pa in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dp_dpar[]:
+ *		Array to be filled with derivatives of equilibrium pressure wrt.
+ *		coefficients (i.e., in order of coefficients).
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Wilson equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *
+ * Remarks:
+ * --------
+ *	Uses molar volumes stored in JSON file when input v1_m3mol or v2_m3mol is
+ * 	-1. Otherwise, derivatives wrt. molar volumes stored in JSON file are
+ *	zero.
+ *	Derivatives wrt. A_12 and A_21 are zero if A_12 is zero and derivatives
+ *	wrt. remaining coefficients are zero otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double absorption_activity_wilson_fdl_dp_dpar_Txv1v2psat(double ret_dp_dpar[],
+	double T_K, double x_molmol, double v1_m3mol, double v2_m3mol,
+	double p_sat_Pa, double isotherm_par[]);
+
+
+/*
+ * absorption_activity_wilson_tdl_dp_dpar_Txv1v2psat:
+ * --------------------------------------------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa of first component and its
+ * derivatives with respect to the coefficients of the Wilson equation depending
+ * on temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
+ * molar volumes of both components in m³/mol, and saturation pressure of first
+ * component p_sat_Pa in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dp_dpar[]:
+ *		Array to be filled with derivatives of equilibrium pressure wrt.
+ *		coefficients (i.e., in order of coefficients).
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Wilson equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *
+ * Remarks:
+ * --------
+ *	Uses molar volumes stored in JSON file when input v1_m3mol or v2_m3mol is
+ * 	-1. Otherwise, derivatives wrt. molar volumes stored in JSON file are
+ *	zero.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double absorption_activity_wilson_tdl_dp_dpar_Txv1v2psat(double ret_dp_dpar[],
+	double T_K, double x_molmol, double v1_m3mol, double v2_m3mol,
+	double p_sat_Pa, double isotherm_par[]);
+
 #endif
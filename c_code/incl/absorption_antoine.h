@@ -277,4 +277,39 @@ double absorption_antoine_dp_dX_XT(double X_kgkg, double T_K,
 double absorption_antoine_dp_dT_XT(double X_kgkg, double T_K,
 	double isotherm_par[]);
 
+
+/*
+ * absorption_antoine_dp_dpar_XT:
+ * ------------------------------
+ *
+ * Calculates equilibrium pressure p in Pa and its derivatives with respect to
+ * the coefficients of the Antoine equation depending on equilibrium
+ * concentration X in kg/kg and equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dp_dpar[]:
+ *		Array to be filled with derivatives of equilibrium pressure wrt.
+ *		coefficients (i.e., in order of coefficients).
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Antoine equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p in Pa.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double absorption_antoine_dp_dpar_XT(double ret_dp_dpar[], double X_kgkg,
+	double T_K, double isotherm_par[]);
+
 #endif
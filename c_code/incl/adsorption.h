@@ -209,6 +209,10 @@
  *		equilibrium temperature T in K, saturation pressure p_Sat in Pa, density
  *		of adsorpt rho in kg/m³ and molar mass of refrigerant M in kg/mol.
  *
+ *	long no_references:
+ *		Number of references to struct (i.e., number of working pairs sharing
+ *		struct).
+ *
  * Remarks:
  * --------
  *	Function returns NULL when function does not exist for a specific isotherm
@@ -224,6 +228,8 @@
  *		Added function pointers to Refrigerant-struct for isotherm types based
  *		on both, the surface approach using saturated vapor pressure and the
  *		volumetric approach.
+ *	10/18/2026, by agent:
+ *		Added number of references.
  *
  */
 typedef struct Adsorption Adsorption;
@@ -268,6 +274,8 @@ Adsorption *newAdsorption(const char *isotherm_type);
  * --------------
  *
  * Destructor function to free allocated memory of an Adsorption-struct.
+ * If struct is shared by several working pairs, function only decrements
+ * number of references and frees memory when last reference is deleted.
  *
  * Parameters:
  * -----------
@@ -278,6 +286,8 @@ Adsorption *newAdsorption(const char *isotherm_type);
  * --------
  *	01/05/2020, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Added number of references.
  *
  */
 void delAdsorption(void *adsorption);
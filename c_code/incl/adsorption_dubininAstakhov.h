@@ -587,4 +587,50 @@ double adsorption_dubininAstakhov_piStar_pyxgTpsatRhoM(double p_total_Pa,
 	double y_molmol, double x_molmol, double gamma, double T_K,
 	double p_sat_Pa, double rho_l_kgm3, double M_kgmol, double isotherm_par[]);
 
+
+/*
+ * adsorption_dubininAstakhov_dw_dpar_pTpsatRho:
+ * ---------------------------------------------
+ *
+ * Calculates equilibrium loading w in kg/kg and its derivatives with respect to
+ * the coefficients of the Dubinin-Astakhov equation depending on equilibrium
+ * pressure p in Pa, equilibrium temperature T in K, saturation pressure p_Sat
+ * in Pa, and saturated liquid density of adsorpt rho_l in kg/m³.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dw_dpar[]:
+ *		Array to be filled with derivatives of equilibrium loading wrt.
+ *		coefficients (i.e., in order of coefficients).
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Dubinin-Astakhov
+ *		equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium loading in kg/kg.
+ *
+ * Remarks:
+ * --------
+ *	Derivative wrt. flag defining unit of volumetric loading is zero.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double adsorption_dubininAstakhov_dw_dpar_pTpsatRho(double ret_dw_dpar[],
+	double p_Pa, double T_K, double p_sat_Pa, double rho_l_kgm3,
+	double isotherm_par[]);
+
 #endif
@@ -356,4 +356,41 @@ double adsorption_freundlich_piStar_pyxgTpsatM(double p_total_Pa,
 	double y_molmol, double x_molmol, double gamma, double T_K,
 	double p_sat_Pa, double M_kgmol, double isotherm_par[]);
 
+
+/*
+ * adsorption_freundlich_dw_dpar_pTpsat:
+ * -------------------------------------
+ *
+ * Calculates equilibrium loading w in kg/kg and its derivatives with respect to
+ * the coefficients of the Freundlich equation depending on equilibrium pressure
+ * p in Pa, equilibrium temperature T in K, and saturation pressure p_Sat in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dw_dpar[]:
+ *		Array to be filled with derivatives of equilibrium loading wrt.
+ *		coefficients (i.e., in order of coefficients).
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Freundlich equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium loading in kg/kg.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double adsorption_freundlich_dw_dpar_pTpsat(double ret_dw_dpar[],
+	double p_Pa, double T_K, double p_sat_Pa, double isotherm_par[]);
+
 #endif
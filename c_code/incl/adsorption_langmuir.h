@@ -314,4 +314,39 @@ double adsorption_langmuir_piStar_pyxgTM(double p_total_Pa, double y_molmol,
 	double x_molmol, double gamma, double T_K, double M_kgmol,
 	double isotherm_par[]);
 
+
+/*
+ * adsorption_langmuir_dw_dpar_pT:
+ * -------------------------------
+ *
+ * Calculates equilibrium loading w in kg/kg and its derivatives with respect to
+ * the coefficients of the Langmuir equation depending on equilibrium pressure p
+ * in Pa and equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dw_dpar[]:
+ *		Array to be filled with derivatives of equilibrium loading wrt.
+ *		coefficients (i.e., in order of coefficients).
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Langmuir equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium loading in kg/kg.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double adsorption_langmuir_dw_dpar_pT(double ret_dw_dpar[], double p_Pa,
+	double T_K, double isotherm_par[]);
+
 #endif
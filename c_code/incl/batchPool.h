@@ -0,0 +1,375 @@
+/////////////////
+// batchPool.h //
+/////////////////
+#ifndef batchPool_h
+#define batchPool_h
+#include "threadSupport.h"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#ifdef DLL_EXPORTS
+	#define DLL_API __attribute__((visibility("default")))
+	#else
+	#define DLL_API
+	#endif
+#else
+	#ifdef DLL_EXPORTS
+	#define DLL_API __declspec(dllexport)
+	#else
+	#define DLL_API
+	#endif
+#endif
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+/*
+ * BatchRange:
+ * -----------
+ *
+ * Contains range of chunks that is owned by one thread of a BatchPool-struct.
+ * The owning thread takes chunks from the beginning of the range, while other
+ * threads steal the upper half of the range when their own range is empty.
+ *
+ * Attributes:
+ * -----------
+ *	long lock:
+ *		Spin lock that is 1 while a thread changes the range and 0 otherwise.
+ *	int begin:
+ *		First chunk of range.
+ *	int end:
+ *		Chunk after last chunk of range.
+ *	char padding[]:
+ *		Padding so that ranges of different threads do not share a cache
+ *		line.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct BatchRange BatchRange;
+
+
+/*
+ * BatchWorker:
+ * ------------
+ *
+ * Contains argument of a worker thread of a BatchPool-struct.
+ *
+ * Attributes:
+ * -----------
+ *	BatchPool *batchPool:
+ *		Pointer of BatchPool-struct owning worker thread.
+ *	int index:
+ *		Index of worker thread (i.e., index of its range of chunks).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct BatchWorker BatchWorker;
+
+
+/*
+ * BatchPool:
+ * ----------
+ *
+ * Contains long-lived worker threads that evaluate batches of items in
+ * parallel. Items are divided into chunks of a given grain size and chunks are
+ * distributed among threads by work stealing. Thus, threads whose chunks are
+ * evaluated fast (e.g., states that converge quickly) take over chunks of
+ * other threads.
+ *
+ * Attributes:
+ * -----------
+ *	int no_threads:
+ *		Number of threads including the thread calling the pool.
+ *	THREAD *threads:
+ *		Array containing worker threads (i.e., no_threads - 1 threads).
+ *	BatchWorker *workers:
+ *		Array containing arguments of worker threads.
+ *	BatchRange *ranges:
+ *		Cache-line aligned array containing ranges of chunks of all threads.
+ *
+ *	MUTEX mutex:
+ *		Mutex protecting generation, number of running threads, and shutdown
+ *		flag.
+ *	MUTEX mutex_run:
+ *		Mutex ensuring that only one batch is evaluated at a time.
+ *	CONDITION condition_start:
+ *		Condition variable signaling new batch or shutdown to worker threads.
+ *	CONDITION condition_finished:
+ *		Condition variable signaling that all worker threads are finished.
+ *	unsigned long generation:
+ *		Number of batches started.
+ *	int no_running:
+ *		Number of worker threads that still evaluate current batch.
+ *	int shutdown:
+ *		Flag indicating whether worker threads shall terminate.
+ *
+ *	function kernel:
+ *		Function evaluating items from first item to item after last item
+ *		with pointer to context of current batch.
+ *	void *context:
+ *		Pointer to context of current batch.
+ *	int no_items:
+ *		Number of items of current batch.
+ *	int grain_size:
+ *		Number of items per chunk of current batch.
+ *
+ * Remarks:
+ * --------
+ *	Each item is evaluated exactly once and by exactly one thread. Hence, if
+ *	results of each item are written to their own memory, results do not
+ *	depend on the number of threads or the order of evaluation.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct BatchPool BatchPool;
+
+
+///////////////////////////////////////
+// Definition of function prototypes //
+///////////////////////////////////////
+/*
+ * batchPool_worker:
+ * -----------------
+ *
+ * Thread function of worker threads. Worker threads wait for new batches,
+ * evaluate chunks of a batch, and signal when they are finished. Function
+ * returns if the pool is shut down.
+ *
+ * Parameters:
+ * -----------
+ *	void *worker:
+ *		Pointer of BatchWorker-struct.
+ *
+ * Returns:
+ * --------
+ *	THREAD_RETURN:
+ *		Returns THREAD_RETURN_VALUE.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+THREAD_RETURN batchPool_worker(void *worker);
+
+
+/*
+ * newBatchPool:
+ * -------------
+ *
+ * Initialization function to create a new BatchPool-struct. Therefore,
+ * function starts no_threads - 1 worker threads that wait for batches. The
+ * thread calling the pool also evaluates items. If threads cannot be started
+ * or memory allocation fails, functions returns NULL and prints a warning.
+ *
+ * Parameters:
+ * -----------
+ *	int no_threads:
+ *		Number of threads. If no_threads is smaller than 1, number of
+ *		processors is used.
+ *
+ * Returns:
+ * --------
+ *	struct *BatchPool:
+ *		Returns malloc-ed BatchPool-struct.
+ *
+ * Remarks:
+ * --------
+ *	Pool can be reused by several batches to avoid starting threads for each
+ *	batch. Pool must be released by delBatchPool.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API BatchPool *newBatchPool(int no_threads);
+
+
+/*
+ * delBatchPool:
+ * -------------
+ *
+ * Destructor function that terminates worker threads and frees allocated
+ * memory of a BatchPool-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *BatchPool:
+ *		Pointer of BatchPool-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void delBatchPool(void *batchPool);
+
+
+/*
+ * getBatchPoolNoThreads:
+ * ----------------------
+ *
+ * Returns number of threads of a BatchPool-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *BatchPool:
+ *		Pointer of BatchPool-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of threads including thread calling the pool or -1 if pool
+ *		does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getBatchPoolNoThreads(void *batchPool);
+
+
+/*
+ * batchPool_no_processors:
+ * ------------------------
+ *
+ * Auxiliary function returning number of processors.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of processors (i.e., at least 1).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int batchPool_no_processors(void);
+
+
+/*
+ * batchPool_grain_size:
+ * ---------------------
+ *
+ * Auxiliary function returning grain size of a batch. If no grain size is
+ * given, each thread gets BATCHPOOL_NO_CHUNKS chunks on average. Thus, work
+ * can be stolen without splitting batches into many small chunks.
+ *
+ * Parameters:
+ * -----------
+ *	int no_items:
+ *		Number of items.
+ *	int grain_size:
+ *		Number of items per chunk. If grain_size is smaller than 1, grain size
+ *		is chosen automatically.
+ *	int no_threads:
+ *		Number of threads.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of items per chunk (i.e., at least 1).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int batchPool_grain_size(int no_items, int grain_size, int no_threads);
+
+
+/*
+ * batchPool_work:
+ * ---------------
+ *
+ * Auxiliary function that evaluates chunks of the current batch by one thread.
+ * The thread takes chunks from the beginning of its own range. If its range is
+ * empty, the thread steals the upper half of the range of another thread. The
+ * function returns if no range contains chunks.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *BatchPool:
+ *		Pointer of BatchPool-struct.
+ *	int index:
+ *		Index of thread.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void batchPool_work(BatchPool *batchPool, int index);
+
+
+/*
+ * batchPool_run:
+ * --------------
+ *
+ * Evaluates items of a batch in parallel by threads of the BatchPool-struct.
+ * The kernel is called with a first item and the item after the last item of
+ * a chunk. The function returns after all items are evaluated. If the pool is
+ * NULL, has only one thread, or the batch has only one chunk, the calling
+ * thread evaluates all items. The calling thread also evaluates all items if
+ * the function is called by a kernel of a batch of the same pool.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *BatchPool:
+ *		Pointer of BatchPool-struct.
+ *	int no_items:
+ *		Number of items.
+ *	int grain_size:
+ *		Number of items per chunk. If grain_size is smaller than 1, grain size
+ *		is chosen automatically.
+ *	void (*kernel)(int, int, void*):
+ *		Function evaluating items from first item to item after last item
+ *		with pointer to context.
+ *	void *context:
+ *		Pointer to context that is passed to kernel.
+ *
+ * Remarks:
+ * --------
+ *	Kernels are called by several threads at the same time and must only
+ *	write memory of their items. Several threads can use the same pool, but
+ *	their batches are evaluated one after another. Kernels may call the same
+ *	pool again (e.g., by batch_evaluate). Nested batches are then evaluated
+ *	by the thread of the kernel instead of waiting for the pool, which would
+ *	never become free.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void batchPool_run(BatchPool *batchPool, int no_items, int grain_size,
+	void (*kernel)(int, int, void*), void *context);
+
+#endif
@@ -0,0 +1,35 @@
+/////////////////
+// benchmark.h //
+/////////////////
+#ifndef benchmark_h
+#define benchmark_h
+
+
+///////////////////////////////////////
+// Definition of function prototypes //
+///////////////////////////////////////
+/*
+ * benchmark_time_s:
+ * -----------------
+ *
+ * Auxiliary function to get current time of a monotonic clock. Function is used
+ * by benchmark programs to measure elapsed times.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns current time in s.
+ *
+ * Remarks:
+ * --------
+ *	Only differences of returned values are meaningful.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double benchmark_time_s(void);
+
+#endif
@@ -0,0 +1,303 @@
+////////////////
+// database.h //
+////////////////
+#ifndef database_h
+#define database_h
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#ifdef DLL_EXPORTS
+	#define DLL_API __attribute__((visibility("default")))
+	#else
+	#define DLL_API
+	#endif
+#else
+	#ifdef DLL_EXPORTS
+	#define DLL_API __declspec(dllexport)
+	#else
+	#define DLL_API
+	#endif
+#endif
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+/*
+ * Database:
+ * ---------
+ *
+ * Contains tree of JSON-structs representing content of the database. Thus,
+ * the database must only be read and parsed once when creating several working
+ * pairs or refrigerants.
+ *
+ * Attributes:
+ * -----------
+ * 	char *path_db:
+ *		Malloc-ed copy of path to database.
+ *	cJSON *json_file:
+ *		Tree of JSON-structs that represent content of database.
+ *
+ *	RefrigerantParameters **refrigerant_parameters:
+ *		Array containing refrigerants that are interned by database and shared
+ *		by working pairs and refrigerant handles.
+ *	int no_refrigerant_parameters:
+ *		Number of interned refrigerants.
+ *	long lock_refrigerant_parameters:
+ *		Spin lock that is 1 while a thread searches or changes interned
+ *		refrigerants and 0 otherwise.
+ *
+ * Remarks:
+ * --------
+ *	Tree of JSON-structs is only read after creation. Thus, several threads
+ *	can create working pairs and refrigerant handles from the same database
+ *	at the same time.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct Database Database;
+
+
+/*
+ * RefrigerantParameters:
+ * ----------------------
+ *
+ * Contains coefficients of refrigerant functions and Refrigerant-struct that
+ * are read once per database and shared read-only by all working pairs and
+ * refrigerant handles using the same refrigerant, calculation approaches, and
+ * IDs of equations.
+ *
+ * Attributes:
+ * -----------
+ * 	char *wp_rf:
+ *		Malloc-ed copy of name of refrigerant.
+ * 	char *rf_psat:
+ *		Malloc-ed copy of name of calculation approach for vapor pressure.
+ * 	char *rf_rhol:
+ *		Malloc-ed copy of name of calculation approach for liquid density.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation.
+ *	int no_rhol:
+ *		ID of liquid density equation.
+ *
+ * 	double *psat_par:
+ *		Array containing coefficients of vapor pressure equation.
+ * 	double *rhol_par:
+ *		Array containing coefficients of saturated liquid density equation.
+ *	int no_psat_par:
+ *		Number of coefficients of vapor pressure equation.
+ *	int no_rhol_par:
+ *		Number of coefficients of saturated liquid density equation.
+ *
+ *	double T_min_psat_K:
+ *		Lower limit of temperature of vapor pressure equation (i.e., -1 if
+ *		not given by database).
+ *	double T_max_psat_K:
+ *		Upper limit of temperature of vapor pressure equation (i.e., -1 if
+ *		not given by database).
+ *	double T_min_rhol_K:
+ *		Lower limit of temperature of saturated liquid density equation (i.e.,
+ *		-1 if not given by database).
+ *	double T_max_rhol_K:
+ *		Upper limit of temperature of saturated liquid density equation (i.e.,
+ *		-1 if not given by database).
+ *
+ *	Refrigerant *refrigerant:
+ *		Struct containing function pointers for refrigerant functions with
+ *		enabled per-thread cache of vapor pressure.
+ *
+ *	long no_references:
+ *		Number of references to struct (i.e., database and number of working
+ *		pairs and refrigerant handles sharing struct).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct RefrigerantParameters RefrigerantParameters;
+
+
+///////////////////////////////////////
+// Definition of function prototypes //
+///////////////////////////////////////
+/*
+ * newDatabase:
+ * ------------
+ *
+ * Initialization function to create a new Database-struct. Therefore, function
+ * reads content of database and parses it to a tree of JSON-structs. If reading
+ * or parsing fails, functions returns NULL and prints a warning.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path_db:
+ *		Path to database.
+ *
+ * Returns:
+ * --------
+ *	struct *Database:
+ *		Returns malloc-ed Database-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API Database *newDatabase(const char *path_db);
+
+
+/*
+ * delDatabase:
+ * ------------
+ *
+ * Destructor function to free allocated memory of a Database-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Database:
+ *		Pointer of Database-struct.
+ *
+ * Remarks:
+ * --------
+ *	Interned refrigerants are only freed when no working pair or refrigerant
+ *	handle uses them anymore. Thus, working pairs created by the database can
+ *	still be used after deleting the database.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void delDatabase(void *database);
+
+
+/*
+ * database_refrigerant_parameters:
+ * --------------------------------
+ *
+ * Auxiliary function to get coefficients of refrigerant functions and the
+ * Refrigerant-struct that are interned by the database. If the combination of
+ * refrigerant, calculation approaches, and IDs of equations is requested for
+ * the first time, the coefficients are read from the database and a new
+ * RefrigerantParameters-struct is interned. Otherwise, the interned struct is
+ * shared.
+ *
+ * Parameters:
+ * -----------
+ *	struct *Database:
+ *		Pointer of Database-struct.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	struct *RefrigerantParameters:
+ *		Returns interned RefrigerantParameters-struct whose number of references
+ *		is incremented. Returns NULL if refrigerant does not exist in database
+ *		or memory allocation fails.
+ *
+ * Remarks:
+ * --------
+ *	Returned struct must be released by delRefrigerantParameters. Array of
+ *	interned refrigerants is protected by spin lock of database. Thus,
+ *	function can be called by several threads for the same database at the
+ *	same time.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+RefrigerantParameters *database_refrigerant_parameters(Database *database,
+	const char *wp_rf, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol);
+
+
+/*
+ * newRefrigerantParameters:
+ * -------------------------
+ *
+ * Initialization function to create a new RefrigerantParameters-struct.
+ * Therefore, function reads coefficients of refrigerant functions from the
+ * entry of the refrigerant within the database (i.e. entry of type "refrig")
+ * and creates a Refrigerant-struct with enabled per-thread cache of vapor
+ * pressure. If refrigerant cannot be found or memory allocation fails,
+ * functions returns NULL and prints a warning.
+ *
+ * Parameters:
+ * -----------
+ *	struct *Database:
+ *		Pointer of Database-struct.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	struct *RefrigerantParameters:
+ *		Returns malloc-ed RefrigerantParameters-struct with one reference.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+RefrigerantParameters *newRefrigerantParameters(Database *database,
+	const char *wp_rf, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol);
+
+
+/*
+ * delRefrigerantParameters:
+ * -------------------------
+ *
+ * Destructor function to release a RefrigerantParameters-struct. Function
+ * decrements number of references and frees memory when last reference is
+ * released.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *RefrigerantParameters:
+ *		Pointer of RefrigerantParameters-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void delRefrigerantParameters(void *refrigerantParameters);
+
+#endif
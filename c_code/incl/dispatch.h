@@ -0,0 +1,46 @@
+////////////////
+// dispatch.h //
+////////////////
+#ifndef dispatch_h
+#define dispatch_h
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+/*
+ * DISPATCH_CLONES:
+ * ----------------
+ *
+ * Attribute of hot kernels that compiles a kernel once for each instruction
+ * set given below (i.e., AVX-512, AVX2 with FMA, and the default SSE2 of
+ * x86-64). The dynamic loader resolves the kernel to the clone that matches
+ * the CPU when loading the library. Thus, one binary uses the widest
+ * instruction set of each CPU.
+ *
+ * Remarks:
+ * --------
+ *	Clones are only compiled if SORP_DISPATCH is defined (e.g., by "make
+ *	DISPATCH=YES") and if GCC compiles for x86-64 Linux because the selection
+ *	requires indirect functions of the GNU C library. Otherwise, the macro
+ *	expands to nothing. Clones cannot be inlined. Hence, only kernels that are
+ *	called via function pointers or that contain loops are annotated. GCC
+ *	exports annotated kernels and their resolvers regardless of visibility.
+ *	Thus, annotated kernels must also be listed in sorpPropLib.map.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#if defined(SORP_DISPATCH) && defined(__unix) && defined(__x86_64__) && \
+	defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 6)
+	#define DISPATCH_CLONES \
+		__attribute__((target_clones("arch=skylake-avx512", "arch=haswell", \
+			"default")))
+#else
+	#define DISPATCH_CLONES
+#endif
+
+#endif
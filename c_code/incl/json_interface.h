@@ -9,6 +9,7 @@
 // Include libraries //
 ///////////////////////
 #include "cJSON.h"
+#include "spline.h"
 
 
 ///////////////////////////////////////
@@ -67,6 +68,8 @@ char *json_read_file(const char *path);
  * --------
  *	10/18/2019, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Position of error is returned by parser instead of global pointer.
  *
  */
 cJSON *json_parse_file(const char *content);
@@ -129,13 +132,109 @@ cJSON *json_search_equation(const char *wp_as, const char *wp_st,
  * --------
  *	double *equ_par:
  *		Malloc-ed array containing coefficients of selected working pair.
+ *	int *ret_no_par:
+ *		Number of coefficients contained in returned array.
  *
  * History:
  * --------
  *	10/18/2019, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Added number of coefficients as output.
  *
  */
-double *json_search_parameters(const char *equation, int no_equ, cJSON *json);
+double *json_search_parameters(int *ret_no_par, const char *equation,
+	int no_equ, cJSON *json);
+
+
+/*
+ * json_search_validity:
+ * ---------------------
+ *
+ * Searches tree of JSON-structs that contains equations of a specific working
+ * pair for a limit of the range of validity (i.e. entry of "_va_") of an
+ * equation that is defined by user input. In contrast to
+ * json_search_parameters, no warning is printed if limit does not exist
+ * because many equations have no or empty ranges of validity.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_value:
+ *		Value of limit.
+ * 	const char *equation:
+ *		Name of equation.
+ *	int no_equ:
+ *		ID of equation (i.e. when more than one equation is available)
+ * 	const char *limit:
+ *		Name of limit (e.g. "temperature-min").
+ *	cJSON *json:
+ *		Tree of JSON-structs that represent equations of a working pair.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if limit exists and is a number and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int json_search_validity(double *ret_value, const char *equation, int no_equ,
+	const char *limit, cJSON *json);
+
+
+/*
+ * json_create_spline:
+ * -------------------
+ *
+ * Auxiliary function to create a tree of JSON-structs representing a
+ * Spline2D-struct (e.g., when exporting spline tables of a working pair).
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Spline2D:
+ *		Pointer of Spline2D-struct.
+ *
+ * Returns:
+ * --------
+ *	cJSON *json:
+ *		Tree of JSON-structs or NULL if memory allocation fails.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+cJSON *json_create_spline(const Spline2D *spline);
+
+
+/*
+ * json_read_spline:
+ * -----------------
+ *
+ * Auxiliary function to create a Spline2D-struct from a tree of JSON-structs
+ * (e.g., when loading spline tables of a working pair). If tree of JSON-structs
+ * is invalid, function returns NULL.
+ *
+ * Parameters:
+ * -----------
+ *	cJSON *json:
+ *		Tree of JSON-structs representing Spline2D-struct.
+ *
+ * Returns:
+ * --------
+ *	struct *Spline2D:
+ *		Returns malloc-ed Spline2D-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+Spline2D *json_read_spline(const cJSON *json);
 
 #endif
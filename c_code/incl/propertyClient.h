@@ -0,0 +1,395 @@
+//////////////////////
+// propertyClient.h //
+//////////////////////
+#ifndef propertyClient_h
+#define propertyClient_h
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#ifdef DLL_EXPORTS
+	#define DLL_API __attribute__((visibility("default")))
+	#else
+	#define DLL_API
+	#endif
+#else
+	#ifdef DLL_EXPORTS
+	#define DLL_API __declspec(dllexport)
+	#else
+	#define DLL_API
+	#endif
+#endif
+
+
+/*
+ * CLIENT_NAME:
+ * ------------
+ *
+ * Name of function of client library. By default, functions of client library
+ * have the same names as the functions of workingPair.h and workingPairBatch.h
+ * so that programs switch to the property server by linking the client
+ * library instead of the library itself. If PROPERTY_CLIENT_PREFIX is defined,
+ * names are prefixed by "client_" so that client and library can be linked
+ * into the same program (e.g., to compare both).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#ifdef PROPERTY_CLIENT_PREFIX
+	#define CLIENT_NAME(name) client_##name
+#else
+	#define CLIENT_NAME(name) name
+#endif
+
+
+/*
+ * CLIENT_FUNCTIONS_*:
+ * -------------------
+ *
+ * Lists of functions of the WorkingPair-struct that are evaluated by the
+ * property server, sorted by number of inputs of type double (i.e., 1 to 7)
+ * and mixing rules returning mole fractions in vapor phase (i.e., VAPOR).
+ * Lists equal the functions that can be evaluated by batch_evaluate.
+ * CLIENT_MAX_INPUTS is the largest number of inputs of these functions.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#define CLIENT_MAX_INPUTS 7
+
+#define CLIENT_FUNCTIONS_1(F) \
+	F(ref_p_sat_T) \
+	F(ref_dp_sat_dT_T) \
+	F(ref_rho_l_T) \
+	F(ref_drho_l_dT_T) \
+	F(ref_T_sat_p)
+
+#define CLIENT_FUNCTIONS_2(F) \
+	F(ads_w_pT) \
+	F(ads_p_wT) \
+	F(ads_T_pw) \
+	F(ads_dw_dp_pT) \
+	F(ads_dw_dT_pT) \
+	F(ads_dp_dw_wT) \
+	F(ads_dp_dT_wT) \
+	F(ads_sur_w_pT) \
+	F(ads_sur_p_wT) \
+	F(ads_sur_T_pw) \
+	F(ads_sur_dw_dp_pT) \
+	F(ads_sur_dw_dT_pT) \
+	F(ads_sur_dp_dw_wT) \
+	F(ads_sur_dp_dT_wT) \
+	F(ads_vol_W_ARho) \
+	F(ads_vol_A_WRho) \
+	F(ads_vol_dW_dA_ARho) \
+	F(ads_vol_dA_dW_WRho) \
+	F(abs_con_X_pT) \
+	F(abs_con_p_XT) \
+	F(abs_con_T_pX) \
+	F(abs_con_dX_dp_pT) \
+	F(abs_con_dX_dT_pT) \
+	F(abs_con_dp_dX_XT) \
+	F(abs_con_dp_dT_XT) \
+	F(abs_mix_dp_dx_Tx) \
+	F(abs_mix_dp_dT_Tx) \
+	F(ref_p_sat_T_der) \
+	F(ref_T_sat_p_der) \
+	F(ref_rho_l_T_der) \
+	F(ref_dp_sat_dT_T_der) \
+	F(ref_drho_l_dT_T_der) \
+	F(tab_w_pT) \
+	F(tab_p_wT) \
+	F(tab_T_pw)
+
+#define CLIENT_FUNCTIONS_3(F) \
+	F(ads_sur_w_pTpsat) \
+	F(ads_sur_p_wTpsat) \
+	F(ads_sur_T_pwpsat) \
+	F(ads_sur_dw_dp_pTpsat) \
+	F(ads_sur_dp_dw_wTpsat)
+
+#define CLIENT_FUNCTIONS_4(F) \
+	F(ads_w_pT_der) \
+	F(ads_p_wT_der) \
+	F(ads_T_pw_der) \
+	F(ads_dw_dp_pT_der) \
+	F(ads_dw_dT_pT_der) \
+	F(ads_dp_dw_wT_der) \
+	F(ads_dp_dT_wT_der) \
+	F(ads_sur_dw_dT_pTpsat) \
+	F(ads_sur_dp_dT_wTpsat) \
+	F(ads_vol_w_pTpsatRho) \
+	F(ads_vol_p_wTpsatRho) \
+	F(ads_vol_T_pwpsatRho) \
+	F(ads_vol_dw_dp_pTpsatRho) \
+	F(ads_vol_dp_dw_wTpsatRho) \
+	F(abs_con_X_pT_der) \
+	F(abs_con_p_XT_der) \
+	F(abs_con_T_pX_der) \
+	F(abs_con_dX_dp_pT_der) \
+	F(abs_con_dX_dT_pT_der) \
+	F(abs_con_dp_dX_XT_der) \
+	F(abs_con_dp_dT_XT_der) \
+	F(abs_act_g_Txv1v2) \
+	F(abs_act_p_Txv1v2) \
+	F(abs_act_x_pTv1v2) \
+	F(abs_mix_dp_dx_Tx_der) \
+	F(abs_mix_dp_dT_Tx_der) \
+	F(tab_w_pT_der) \
+	F(tab_p_wT_der) \
+	F(tab_T_pw_der)
+
+#define CLIENT_FUNCTIONS_5(F) \
+	F(abs_act_p_Txv1v2psat) \
+	F(abs_act_x_pTv1v2psat)
+
+#define CLIENT_FUNCTIONS_6(F) \
+	F(ads_piStar_pyxgTM) \
+	F(ads_sur_piStar_pyxgTM) \
+	F(ads_vol_dw_dT_pTpsatRho) \
+	F(ads_vol_dp_dT_wTpsatRho)
+
+#define CLIENT_FUNCTIONS_7(F) \
+	F(ads_sur_piStar_pyxgTpsatM)
+
+#define CLIENT_FUNCTIONS_VAPOR(F) \
+	F(abs_mix_x_pT) \
+	F(abs_mix_p_Tx) \
+	F(abs_mix_T_px)
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+/*
+ * ServerWorkingPair:
+ * ------------------
+ *
+ * Contains handle of a working pair of property server used by clients. If
+ * names are not prefixed, it is also available as WorkingPair.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct ServerWorkingPair ServerWorkingPair;
+
+#ifndef PROPERTY_CLIENT_PREFIX
+typedef struct ServerWorkingPair WorkingPair;
+#endif
+
+
+///////////////////////////////////////
+// Definition of function prototypes //
+///////////////////////////////////////
+/*
+ * newWorkingPair:
+ * ---------------
+ *
+ * Requests working pair from property server: Server opens database once per
+ * path and keeps working pairs hot for all clients. Client connects to server
+ * when first called, using socket given by environment variable
+ * SORP_SERVER_SOCKET or SERVER_SOCKET.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path_db:
+ *		Path to database as seen by server.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	struct *ServerWorkingPair:
+ *		Returns malloc-ed handle of working pair or NULL if server is not
+ *		reachable or working pair cannot be created.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API ServerWorkingPair *CLIENT_NAME(newWorkingPair)(const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf,
+	const char *wp_iso, int no_iso, const char *rf_psat, int no_p_sat,
+	const char *rf_rhol, int no_rhol);
+
+
+/*
+ * delWorkingPair:
+ * ---------------
+ *
+ * Releases handle of working pair: Server keeps working pair hot.
+ *
+ * Parameters:
+ * -----------
+ *	struct *ServerWorkingPair:
+ *		Handle of working pair.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void CLIENT_NAME(delWorkingPair)(void *workingPair);
+
+
+/*
+ * batch_evaluate:
+ * ---------------
+ *
+ * Evaluates a function of the WorkingPair-struct for arrays of states by one
+ * request to the property server. Server evaluates states in parallel by its
+ * thread pool.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_values:
+ *		Array to be filled with values of function.
+ *	double *ret_y_1_molmol:
+ *		Array to be filled with mole fractions of first component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	double *ret_y_2_molmol:
+ *		Array to be filled with mole fractions of second component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	int *ret_status:
+ *		Array to be filled with status codes of states (i.e., may be NULL).
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT" or "abs_mix_x_pT").
+ *	const double **inputs:
+ *		Array containing arrays of inputs in order of inputs of function.
+ *	int no_points:
+ *		Number of states.
+ *	int grain_size:
+ *		Ignored (i.e., chosen by server).
+ *	void *batchPool:
+ *		Ignored (i.e., pool of server is used).
+ *	struct *ServerWorkingPair:
+ *		Handle of working pair.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all states are calculated and -1 otherwise. In case
+ *		of an error, all states of returned array are set to -1.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int CLIENT_NAME(batch_evaluate)(double *ret_values,
+	double *ret_y_1_molmol, double *ret_y_2_molmol, int *ret_status,
+	const char *function, const double **inputs, int no_points,
+	int grain_size, void *batchPool, void *workingPair);
+
+
+/*
+ * Functions of the WorkingPair-struct:
+ * ------------------------------------
+ *
+ * Each function of the lists CLIENT_FUNCTIONS_* has the signature of the
+ * function of workingPair.h with the same name (e.g., "double ads_w_pT(double
+ * p_Pa, double T_K, void *workingPair)") and evaluates one state by one
+ * request to the property server. Documentation of inputs and outputs is
+ * given in workingPair.h. Functions return -1 if server is not reachable.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#define CLIENT_DECLARE_1(name) DLL_API double CLIENT_NAME(name)(double, \
+	void *);
+#define CLIENT_DECLARE_2(name) DLL_API double CLIENT_NAME(name)(double, \
+	double, void *);
+#define CLIENT_DECLARE_3(name) DLL_API double CLIENT_NAME(name)(double, \
+	double, double, void *);
+#define CLIENT_DECLARE_4(name) DLL_API double CLIENT_NAME(name)(double, \
+	double, double, double, void *);
+#define CLIENT_DECLARE_5(name) DLL_API double CLIENT_NAME(name)(double, \
+	double, double, double, double, void *);
+#define CLIENT_DECLARE_6(name) DLL_API double CLIENT_NAME(name)(double, \
+	double, double, double, double, double, void *);
+#define CLIENT_DECLARE_7(name) DLL_API double CLIENT_NAME(name)(double, \
+	double, double, double, double, double, double, void *);
+#define CLIENT_DECLARE_VAPOR(name) DLL_API double CLIENT_NAME(name)( \
+	double *, double *, double, double, void *);
+
+CLIENT_FUNCTIONS_1(CLIENT_DECLARE_1)
+CLIENT_FUNCTIONS_2(CLIENT_DECLARE_2)
+CLIENT_FUNCTIONS_3(CLIENT_DECLARE_3)
+CLIENT_FUNCTIONS_4(CLIENT_DECLARE_4)
+CLIENT_FUNCTIONS_5(CLIENT_DECLARE_5)
+CLIENT_FUNCTIONS_6(CLIENT_DECLARE_6)
+CLIENT_FUNCTIONS_7(CLIENT_DECLARE_7)
+CLIENT_FUNCTIONS_VAPOR(CLIENT_DECLARE_VAPOR)
+
+
+/*
+ * client_shutdownServer:
+ * ----------------------
+ *
+ * Requests property server to stop and disconnects client.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if server confirmed request and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int client_shutdownServer(void);
+
+
+/*
+ * client_disconnect:
+ * ------------------
+ *
+ * Disconnects client from property server. Next request connects again.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void client_disconnect(void);
+
+#endif
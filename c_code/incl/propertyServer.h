@@ -0,0 +1,219 @@
+//////////////////////
+// propertyServer.h //
+//////////////////////
+#ifndef propertyServer_h
+#define propertyServer_h
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+/*
+ * SERVER_*:
+ * ---------
+ *
+ * Types of requests of binary protocol of property server, default path of
+ * Unix domain socket, and limits of requests. Each request consists of a
+ * ServerRequest-struct followed by its payload, and each response consists of
+ * a ServerResponse-struct followed by its payload. Integers and doubles are
+ * sent in native byte order because server and clients run on the same
+ * machine.
+ *
+ *	SERVER_NEW_WORKINGPAIR:
+ *		Payload of request contains names of working pair (i.e., path_db,
+ *		wp_as, wp_st, wp_rf, wp_iso, rf_psat, and rf_rhol), each given by
+ *		its length (i.e., -1 for NULL) and its characters without terminating
+ *		zero, followed by no_iso, no_p_sat, and no_rhol. Response contains
+ *		handle of working pair.
+ *	SERVER_DEL_WORKINGPAIR:
+ *		Releases handle of working pair. Working pair is kept hot for other
+ *		clients until server is stopped.
+ *	SERVER_EVALUATE:
+ *		Payload of request contains no_inputs arrays of no_points inputs.
+ *		Payload of response contains no_outputs arrays of no_points values
+ *		(i.e., values and, for mixing rules, mole fractions of both
+ *		components in vapor phase) followed by no_points status codes.
+ *	SERVER_SHUTDOWN:
+ *		Stops server after response has been sent.
+ *
+ *	SERVER_SOCKET:
+ *		Default path of socket (i.e., overwritten by environment variable
+ *		SORP_SERVER_SOCKET of clients).
+ *	SERVER_LENGTH_FUNCTION:
+ *		Length of name of function including terminating zero.
+ *	SERVER_MAX_CLIENTS:
+ *		Maximal number of clients connected at the same time.
+ *	SERVER_MAX_POINTS:
+ *		Maximal number of states per request.
+ *	SERVER_MAX_NAME:
+ *		Maximal length of names of working pair.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#define SERVER_NEW_WORKINGPAIR 1
+#define SERVER_DEL_WORKINGPAIR 2
+#define SERVER_EVALUATE 3
+#define SERVER_SHUTDOWN 4
+
+#define SERVER_SOCKET "/tmp/sorpPropLib.sock"
+#define SERVER_LENGTH_FUNCTION 40
+#define SERVER_MAX_CLIENTS 64
+#define SERVER_MAX_POINTS (1 << 22)
+#define SERVER_MAX_NAME 4096
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+/*
+ * ServerRequest:
+ * --------------
+ *
+ * Contains header of request sent by client to property server.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct ServerRequest ServerRequest;
+
+
+/*
+ * ServerResponse:
+ * ---------------
+ *
+ * Contains header of response sent by property server to client.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct ServerResponse ServerResponse;
+
+
+/*
+ * ServerEntry:
+ * ------------
+ *
+ * Contains a hot working pair of property server and the arguments
+ * identifying it.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct ServerEntry ServerEntry;
+
+
+/*
+ * PropertyServer:
+ * ---------------
+ *
+ * Contains socket, clients, databases, hot working pairs, and thread pool of
+ * property server.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct PropertyServer PropertyServer;
+
+
+///////////////////////////////////////
+// Definition of function prototypes //
+///////////////////////////////////////
+/*
+ * newPropertyServer:
+ * ------------------
+ *
+ * Initiates property server: Creates Unix domain socket that is only
+ * accessible by current user and thread pool evaluating batched requests.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path_socket:
+ *		Path of Unix domain socket (i.e., SERVER_SOCKET if NULL). An existing
+ *		socket file is replaced.
+ *	int no_threads:
+ *		Number of threads of pool. If no_threads is smaller than 1, one thread
+ *		per processor is started.
+ *
+ * Returns:
+ * --------
+ *	struct *PropertyServer:
+ *		Returns malloc-ed PropertyServer-struct or NULL if server cannot be
+ *		created.
+ *
+ * Remarks:
+ * --------
+ *	Server is only available on Unix systems.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+PropertyServer *newPropertyServer(const char *path_socket, int no_threads);
+
+
+/*
+ * delPropertyServer:
+ * ------------------
+ *
+ * Closes sockets, removes socket file, and frees memory of property server
+ * including its databases and hot working pairs.
+ *
+ * Parameters:
+ * -----------
+ *	struct *PropertyServer:
+ *		Pointer of PropertyServer-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void delPropertyServer(PropertyServer *propertyServer);
+
+
+/*
+ * propertyServer_run:
+ * -------------------
+ *
+ * Serves requests of clients until a client sends SERVER_SHUTDOWN or until
+ * SIGINT or SIGTERM is received. Requests are served one after another, and
+ * each batch is evaluated in parallel by the thread pool of the server.
+ *
+ * Parameters:
+ * -----------
+ *	struct *PropertyServer:
+ *		Pointer of PropertyServer-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if server was stopped regularly and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int propertyServer_run(PropertyServer *propertyServer);
+
+#endif
@@ -0,0 +1,38 @@
+////////////////////////
+// referenceCounter.h //
+////////////////////////
+#ifndef referenceCounter_h
+#define referenceCounter_h
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+/*
+ * REFERENCES_INCREMENT / REFERENCES_DECREMENT:
+ * --------------------------------------------
+ *
+ * Atomically increment or decrement a reference counter of type long and
+ * return the new value. Thus, structs shared by several working pairs can be
+ * freed from different threads.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#if defined(__GNUC__)
+	#define REFERENCES_INCREMENT(counter) \
+		__atomic_add_fetch((counter), 1, __ATOMIC_ACQ_REL)
+	#define REFERENCES_DECREMENT(counter) \
+		__atomic_sub_fetch((counter), 1, __ATOMIC_ACQ_REL)
+#else
+	#include <intrin.h>
+	#define REFERENCES_INCREMENT(counter) \
+		_InterlockedIncrement((long volatile *) (counter))
+	#define REFERENCES_DECREMENT(counter) \
+		_InterlockedDecrement((long volatile *) (counter))
+#endif
+
+#endif
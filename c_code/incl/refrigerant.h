@@ -55,6 +55,19 @@
  * 	function cubic_fug_coefficient:
  *		Calculates fugacity coefficient of cubic equation of state.
  *
+ *	long no_references:
+ *		Number of references to struct (i.e., number of working pairs sharing
+ *		struct).
+ *
+ * 	function uncached_p_sat_T:
+ *		Returns vapor pressure in Pa if p_sat_T is replaced by cached function.
+ * 	function uncached_dp_sat_dT:
+ *		Returns derivative of vapor pressure wrt. temperature in Pa/K if
+ *		dp_sat_dT is replaced by cached function.
+ *	long cache_id:
+ *		Unique ID identifying results of struct within per-thread cache (i.e.,
+ *		0 if cache is disabled).
+ *
  * Remarks:
  * --------
  *	Function pointer is NULL-pointer if refrigerant function does not exist.
@@ -65,6 +78,9 @@
  *		First implementation.
  *	04/07/2020, by Mirko Engelpracht:
  *		Added function pointers for cubic equations of state.
+ *	10/18/2026, by agent:
+ *		Added number of references.
+ *		Added per-thread cache of vapor pressure.
  *
  */
 typedef struct Refrigerant Refrigerant;
@@ -116,6 +132,8 @@ Refrigerant *newRefrigerant(const char *vaporPressure_approach,
  * ---------------
  *
  * Destructor function to free allocated memory of a Refrigerant-struct.
+ * If struct is shared by several working pairs, function only decrements
+ * number of references and frees memory when last reference is deleted.
  *
  * Parameters:
  * -----------
@@ -126,6 +144,8 @@ Refrigerant *newRefrigerant(const char *vaporPressure_approach,
  * --------
  *	01/05/2020, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Added number of references.
  *
  */
 void delRefrigerant(void *refrigerant);
@@ -361,4 +381,111 @@ double refrigerant_cubic_T_sat(double p_Pa, double refrigerant_par[],
 double refrigerant_cubic_dp_sat_dT(double T_K, double refrigerant_par[],
 	void *refrigerant);
 
+
+/*
+ * refrigerant_enable_cache:
+ * -------------------------
+ *
+ * Auxiliary function to enable the per-thread cache of the vapor pressure and
+ * its derivative wrt. temperature. Therefore, function pointers p_sat_T and
+ * dp_sat_dT are replaced by cached functions and struct gets a unique ID.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Refrigerant
+ *		Pointer of Refrigerant-struct.
+ *
+ * Remarks:
+ * --------
+ *	Cache should only be enabled for structs that are shared by several working
+ *	pairs (e.g., refrigerants interned by Database-struct). Then, evaluating
+ *	all working pairs at the same temperature calculates the vapor pressure
+ *	only once per thread. Cache must be enabled before struct is shared.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void refrigerant_enable_cache(Refrigerant *refrigerant);
+
+
+/*
+ * refrigerant_cached_p_sat:
+ * -------------------------
+ *
+ * Calculates vapor pressure in Pa depending on saturation temperature T in K
+ * if cache is enabled. If the same thread has calculated the vapor pressure of
+ * the same Refrigerant-struct at the same temperature before, the cached
+ * result is returned.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Saturation temperature in K.
+ *	double refrigerant_par[]:
+ *		Array of doubles that contains coefficients for refrigerant function.
+ * 	struct *Refrigerant
+ *		Pointer of Refrigerant-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Vapor pressure in Pa.
+ *
+ * Remarks:
+ * --------
+ *	Due to initialization procedure of Refrigerant-struct, this function is only
+ *	callable when Refrigerant-struct and sub-functions exist. Thus, no further
+ *	checks are necessary.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double refrigerant_cached_p_sat(double T_K, double refrigerant_par[],
+	void *refrigerant);
+
+
+/*
+ * refrigerant_cached_dp_sat_dT:
+ * -----------------------------
+ *
+ * Calculates derivative of vapor pressure wrt. temperature in Pa/K depending
+ * on saturation temperature T in K if cache is enabled. If the same thread has
+ * calculated the derivative of the same Refrigerant-struct at the same
+ * temperature before, the cached result is returned.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Saturation temperature in K.
+ *	double refrigerant_par[]:
+ *		Array of doubles that contains coefficients for refrigerant function.
+ * 	struct *Refrigerant
+ *		Pointer of Refrigerant-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of vapor pressure wrt. temperature in Pa/K.
+ *
+ * Remarks:
+ * --------
+ *	Due to initialization procedure of Refrigerant-struct, this function is only
+ *	callable when Refrigerant-struct and sub-functions exist. Thus, no further
+ *	checks are necessary.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double refrigerant_cached_dp_sat_dT(double T_K, double refrigerant_par[],
+	void *refrigerant);
+
 #endif
@@ -0,0 +1,669 @@
+/////////////////////////
+// refrigerantHandle.h //
+/////////////////////////
+#ifndef refrigerantHandle_h
+#define refrigerantHandle_h
+#include "database.h"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#ifdef DLL_EXPORTS
+	#define DLL_API __attribute__((visibility("default")))
+	#else
+	#define DLL_API
+	#endif
+#else
+	#ifdef DLL_EXPORTS
+	#define DLL_API __declspec(dllexport)
+	#else
+	#define DLL_API
+	#endif
+#endif
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+/*
+ * RefrigerantHandle:
+ * ------------------
+ *
+ * Contains strings defining refrigerant and calculation approaches,
+ * coefficients for calculation approaches, and structure that contains
+ * function pointers for the refrigerant functions. In contrast to the
+ * WorkingPair-struct, no isotherm is required.
+ *
+ * Attributes:
+ * -----------
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * 	double *psat_par:
+ *		Array containing coefficients of vapor pressure equation.
+ * 	double *rhol_par:
+ *		Array containing coefficients of saturated liquid density equation.
+ *	int no_psat_par:
+ *		Number of coefficients of vapor pressure equation.
+ *	int no_rhol_par:
+ *		Number of coefficients of saturated liquid density equation.
+ *
+ *	Refrigerant *refrigerant:
+ *		Struct containing function pointers for refrigerant functions.
+ *	RefrigerantParameters *refrigerant_parameters:
+ *		Struct interned by database that owns coefficients of refrigerant
+ *		functions and Refrigerant-struct.
+ *
+ *	Surrogate *surrogate_p_sat:
+ *		Surrogate of vapor pressure depending on temperature (i.e., NULL if
+ *		surrogates are disabled).
+ *	Surrogate *surrogate_dp_sat_dT:
+ *		Surrogate of derivative of vapor pressure wrt. temperature depending on
+ *		temperature.
+ *	Surrogate *surrogate_rho_l:
+ *		Surrogate of saturated liquid density depending on temperature.
+ *	Surrogate *surrogate_T_sat:
+ *		Surrogate of saturation temperature depending on logarithm of pressure.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct RefrigerantHandle RefrigerantHandle;
+
+
+///////////////////////////////////////
+// Definition of function prototypes //
+///////////////////////////////////////
+/*
+ * newRefrigerantHandle:
+ * ---------------------
+ *
+ * Initialization function to create a new RefrigerantHandle-struct. Therefore,
+ * function reads coefficients of refrigerant functions from the entry of the
+ * refrigerant within the database (i.e. entry of type "refrig"). Coefficients
+ * and Refrigerant-struct are interned by the database and shared with working
+ * pairs using the same refrigerant. In contrast to newWorkingPair, no isotherm
+ * is searched. If refrigerant cannot be found or memory allocation fails,
+ * functions returns NULL and prints a warning.
+ *
+ * Parameters:
+ * -----------
+ *	struct *Database:
+ *		Pointer of Database-struct.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	struct *RefrigerantHandle:
+ *		Returns malloc-ed RefrigerantHandle-struct containing all information
+ *		required to calculate the saturation properties of the refrigerant.
+ *
+ * Remarks:
+ * --------
+ *	Strings are not copied and must stay valid as long as the
+ *	RefrigerantHandle-struct is used.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API RefrigerantHandle *newRefrigerantHandle(Database *database,
+	const char *wp_rf, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol);
+
+
+/*
+ * delRefrigerantHandle:
+ * ---------------------
+ *
+ * Destructor function to free allocated memory of a RefrigerantHandle-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void delRefrigerantHandle(void *refrigerantHandle);
+
+
+/*
+ * refh_enable_surrogate:
+ * ----------------------
+ *
+ * Creates surrogates of vapor pressure, its derivative wrt. temperature,
+ * saturated liquid density, and saturation temperature. Afterwards, all
+ * functions of the RefrigerantHandle-struct are evaluated by piecewise
+ * Chebyshev polynomials instead of the original equations. The surrogates
+ * meet the maximal relative error given as input. Saturation temperature is
+ * approximated depending on the logarithm of the pressure.
+ *
+ * Parameters:
+ * -----------
+ *	double T_min_K:
+ *		Lower limit of temperature in K.
+ *	double T_max_K:
+ *		Upper limit of temperature in K.
+ *	double max_rel_error:
+ *		Maximal relative error of surrogates.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if surrogates are created for all existing functions and -1
+ *		otherwise. In case of an error, surrogates are disabled.
+ *
+ * Remarks:
+ * --------
+ *	If T_min_K is not smaller than T_max_K, ranges of validity of equations
+ *	given by the database are used. Outside of limits and within intervals
+ *	whose approximation is not accurate enough (e.g., close to the critical
+ *	point), original equations are evaluated. Derivative of saturated liquid
+ *	density is always evaluated by the original equation.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int refh_enable_surrogate(double T_min_K, double T_max_K,
+	double max_rel_error, void *refrigerantHandle);
+
+
+/*
+ * refh_disable_surrogate:
+ * -----------------------
+ *
+ * Frees surrogates of RefrigerantHandle-struct. Afterwards, all functions of
+ * the RefrigerantHandle-struct are evaluated by the original equations.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void refh_disable_surrogate(void *refrigerantHandle);
+
+
+/*
+ * refh_exact_p_sat_T:
+ * -------------------
+ *
+ * Auxiliary function to calculate saturation pressure in Pa depending on
+ * equilibrium temperature T in K by the original equation. Function is
+ * approximated by surrogate.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Saturation pressure in Pa.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double refh_exact_p_sat_T(double T_K, void *refrigerantHandle);
+
+
+/*
+ * refh_exact_dp_sat_dT_T:
+ * -----------------------
+ *
+ * Auxiliary function to calculate derivative of saturation pressure in Pa/K
+ * wrt to temperature depending on equilibrium temperature T in K by the
+ * original equation. Function is approximated by surrogate.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double refh_exact_dp_sat_dT_T(double T_K, void *refrigerantHandle);
+
+
+/*
+ * refh_exact_rho_l_T:
+ * -------------------
+ *
+ * Auxiliary function to calculate saturated liquid density in kg/m3 depending
+ * on equilibrium temperature T in K by the original equation. Function is
+ * approximated by surrogate.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Saturated liquid density in kg/m3.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double refh_exact_rho_l_T(double T_K, void *refrigerantHandle);
+
+
+/*
+ * refh_exact_T_sat_lnp:
+ * ---------------------
+ *
+ * Auxiliary function to calculate saturation temperature in K depending on
+ * logarithm of pressure ln(p) in ln(Pa) by the original equation. Function is
+ * approximated by surrogate.
+ *
+ * Parameters:
+ * -----------
+ *	double ln_p_Pa:
+ *		Logarithm of pressure in ln(Pa).
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Saturation temperature in K.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double refh_exact_T_sat_lnp(double ln_p_Pa, void *refrigerantHandle);
+
+
+/////////////////////////////////////////////////////////
+// Definition of function prototypes for single states //
+/////////////////////////////////////////////////////////
+/*
+ * refh_p_sat_T:
+ * -------------
+ *
+ * Calculates saturation pressure in Pa depending on equilibrium temperature T
+ * in K.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Saturation pressure in Pa.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double refh_p_sat_T(double T_K, void *refrigerantHandle);
+
+
+/*
+ * refh_dp_sat_dT_T:
+ * -----------------
+ *
+ * Calculates derivative of saturation pressure in Pa/K wrt to temperature
+ * depending on equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double refh_dp_sat_dT_T(double T_K, void *refrigerantHandle);
+
+
+/*
+ * refh_rho_l_T:
+ * -------------
+ *
+ * Calculates saturated liquid density in kg/m3 depending on equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Saturated liquid density in kg/m3.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double refh_rho_l_T(double T_K, void *refrigerantHandle);
+
+
+/*
+ * refh_drho_l_dT_T:
+ * -----------------
+ *
+ * Calculates derivative of saturated liquid density in kg/m3/K wrt to
+ * temperature depending on equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of saturated liquid density wrt. temperature in kg/m3/K.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double refh_drho_l_dT_T(double T_K, void *refrigerantHandle);
+
+
+/*
+ * refh_T_sat_p:
+ * -------------
+ *
+ * Calculates saturation temperature in K depending on equilibrium pressure p
+ * in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Saturation pressure in Pa.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium temperature in K.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double refh_T_sat_p(double p_Pa, void *refrigerantHandle);
+
+
+////////////////////////////////////////////////////////////
+// Definition of function prototypes for arrays of states //
+////////////////////////////////////////////////////////////
+/*
+ * refh_p_sat_T_batch:
+ * -------------------
+ *
+ * Calculates saturation pressure in Pa depending on equilibrium temperature T
+ * in K. Function evaluates an array of states and checks existence of function
+ * and coefficients only once.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_p_sat_Pa:
+ *		Array to be filled with saturation pressure in Pa.
+ *	const double *T_K:
+ *		Array of equilibrium temperature in K.
+ *	int no_points:
+ *		Number of states.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all states are calculated and -1 otherwise. In case
+ *		of an error, all states of returned array are set to -1.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int refh_p_sat_T_batch(double *ret_p_sat_Pa, const double *T_K,
+	int no_points, void *refrigerantHandle);
+
+
+/*
+ * refh_dp_sat_dT_T_batch:
+ * -----------------------
+ *
+ * Calculates derivative of saturation pressure in Pa/K wrt to temperature
+ * depending on equilibrium temperature T in K. Function evaluates an array of
+ * states and checks existence of function and coefficients only once.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_dp_sat_dT_PaK:
+ *		Array to be filled with derivative of saturation pressure wrt.
+ *		temperature in Pa/K.
+ *	const double *T_K:
+ *		Array of equilibrium temperature in K.
+ *	int no_points:
+ *		Number of states.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all states are calculated and -1 otherwise. In case
+ *		of an error, all states of returned array are set to -1.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int refh_dp_sat_dT_T_batch(double *ret_dp_sat_dT_PaK, const double *T_K,
+	int no_points, void *refrigerantHandle);
+
+
+/*
+ * refh_rho_l_T_batch:
+ * -------------------
+ *
+ * Calculates saturated liquid density in kg/m3 depending on equilibrium
+ * temperature T in K. Function evaluates an array of states and checks
+ * existence of function and coefficients only once.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_rho_l_kgm3:
+ *		Array to be filled with saturated liquid density in kg/m3.
+ *	const double *T_K:
+ *		Array of equilibrium temperature in K.
+ *	int no_points:
+ *		Number of states.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all states are calculated and -1 otherwise. In case
+ *		of an error, all states of returned array are set to -1.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int refh_rho_l_T_batch(double *ret_rho_l_kgm3, const double *T_K,
+	int no_points, void *refrigerantHandle);
+
+
+/*
+ * refh_drho_l_dT_T_batch:
+ * -----------------------
+ *
+ * Calculates derivative of saturated liquid density in kg/m3/K wrt to
+ * temperature depending on equilibrium temperature T in K. Function evaluates
+ * an array of states and checks existence of function and coefficients only
+ * once.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_drho_l_dT_kgm3K:
+ *		Array to be filled with derivative of saturated liquid density wrt.
+ *		temperature in kg/m3/K.
+ *	const double *T_K:
+ *		Array of equilibrium temperature in K.
+ *	int no_points:
+ *		Number of states.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all states are calculated and -1 otherwise. In case
+ *		of an error, all states of returned array are set to -1.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int refh_drho_l_dT_T_batch(double *ret_drho_l_dT_kgm3K,
+	const double *T_K, int no_points, void *refrigerantHandle);
+
+
+/*
+ * refh_T_sat_p_batch:
+ * -------------------
+ *
+ * Calculates saturation temperature in K depending on equilibrium pressure p in
+ * Pa. Function evaluates an array of states and checks existence of function
+ * and coefficients only once.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_T_sat_K:
+ *		Array to be filled with equilibrium temperature in K.
+ *	const double *p_Pa:
+ *		Array of saturation pressure in Pa.
+ *	int no_points:
+ *		Number of states.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all states are calculated and -1 otherwise. In case
+ *		of an error, all states of returned array are set to -1.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int refh_T_sat_p_batch(double *ret_T_sat_K, const double *p_Pa,
+	int no_points, void *refrigerantHandle);
+
+#endif
@@ -0,0 +1,56 @@
+////////////////
+// spinLock.h //
+////////////////
+#ifndef spinLock_h
+#define spinLock_h
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+/*
+ * SPINLOCK_ACQUIRE / SPINLOCK_RELEASE:
+ * ------------------------------------
+ *
+ * Acquire or release a lock of type long that is 0 if unlocked and 1 if
+ * locked. Thus, short sections changing shared structs (e.g., interned
+ * refrigerants of a database) can be executed by one thread at a time without
+ * depending on a thread library.
+ *
+ * Remarks:
+ * --------
+ *	Threads waiting for the lock only read the lock until it is released to
+ *	avoid contention of the cache line. Locks must not be acquired
+ *	recursively.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#if defined(__GNUC__)
+	#define SPINLOCK_ACQUIRE(lock) \
+		do { \
+			while (__atomic_exchange_n((lock), 1, __ATOMIC_ACQUIRE)) { \
+				while (__atomic_load_n((lock), __ATOMIC_RELAXED)) { \
+				} \
+			} \
+		} while (0)
+	#define SPINLOCK_RELEASE(lock) \
+		__atomic_store_n((lock), 0, __ATOMIC_RELEASE)
+#else
+	#include <intrin.h>
+	#define SPINLOCK_ACQUIRE(lock) \
+		do { \
+			while (_InterlockedExchange((long volatile *) (lock), 1)) { \
+				while (*((long volatile *) (lock))) { \
+					_mm_pause(); \
+				} \
+			} \
+		} while (0)
+	#define SPINLOCK_RELEASE(lock) \
+		_InterlockedExchange((long volatile *) (lock), 0)
+#endif
+
+#endif
@@ -0,0 +1,191 @@
+//////////////
+// spline.h //
+//////////////
+#ifndef spline_h
+#define spline_h
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+/*
+ * Spline2D:
+ * ---------
+ *
+ * Contains bicubic Hermite spline of a function of two variables on an
+ * equidistant grid. For each node, the spline stores the value, both partial
+ * derivatives, and the mixed partial derivative of the function. Thus, the
+ * spline and its first partial derivatives are continuous and interpolate the
+ * given values and derivatives at all nodes. Cells with at least one invalid
+ * node (e.g., the original function fails) cannot be evaluated.
+ *
+ * Attributes:
+ * -----------
+ *	double x_min:
+ *		Lower limit of first variable.
+ *	double x_max:
+ *		Upper limit of first variable.
+ *	double y_min:
+ *		Lower limit of second variable.
+ *	double y_max:
+ *		Upper limit of second variable.
+ *	double h_x:
+ *		Distance between nodes regarding first variable.
+ *	double h_y:
+ *		Distance between nodes regarding second variable.
+ *	int no_nodes_x:
+ *		Number of nodes regarding first variable.
+ *	int no_nodes_y:
+ *		Number of nodes regarding second variable.
+ *
+ *	double *f:
+ *		Array containing values at nodes.
+ *	double *f_x:
+ *		Array containing partial derivatives wrt. first variable at nodes.
+ *	double *f_y:
+ *		Array containing partial derivatives wrt. second variable at nodes.
+ *	double *f_xy:
+ *		Array containing mixed partial derivatives at nodes.
+ *	char *valid:
+ *		Array indicating whether node is valid.
+ *
+ * Remarks:
+ * --------
+ *	Node (i_x, i_y) is stored at index i_x * no_nodes_y + i_y.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct Spline2D Spline2D;
+
+
+///////////////////////////////////////
+// Definition of function prototypes //
+///////////////////////////////////////
+/*
+ * newSpline2D:
+ * ------------
+ *
+ * Initialization function to create a new Spline2D-struct. Therefore,
+ * function allocates memory for values and derivatives at all nodes of the
+ * grid and marks all nodes as invalid. Values and derivatives must be set
+ * afterwards. If limits or numbers of nodes are invalid or memory allocation
+ * fails, functions returns NULL and prints a warning.
+ *
+ * Parameters:
+ * -----------
+ *	int no_nodes_x:
+ *		Number of nodes regarding first variable.
+ *	int no_nodes_y:
+ *		Number of nodes regarding second variable.
+ *	double x_min:
+ *		Lower limit of first variable.
+ *	double x_max:
+ *		Upper limit of first variable.
+ *	double y_min:
+ *		Lower limit of second variable.
+ *	double y_max:
+ *		Upper limit of second variable.
+ *
+ * Returns:
+ * --------
+ *	struct *Spline2D:
+ *		Returns malloc-ed Spline2D-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+Spline2D *newSpline2D(int no_nodes_x, int no_nodes_y, double x_min,
+	double x_max, double y_min, double y_max);
+
+
+/*
+ * delSpline2D:
+ * ------------
+ *
+ * Destructor function to free allocated memory of a Spline2D-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Spline2D:
+ *		Pointer of Spline2D-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void delSpline2D(void *spline);
+
+
+/*
+ * spline2D_mixed_derivatives:
+ * ---------------------------
+ *
+ * Auxiliary function to calculate mixed partial derivatives at all valid nodes
+ * by central differences of the partial derivatives wrt. first variable
+ * regarding second variable. At the limits or next to invalid nodes, one-sided
+ * differences are used. As the spline interpolates the mixed partial
+ * derivatives given at the nodes, the approximated mixed partial derivatives
+ * do not affect continuity of spline and its first partial derivatives.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Spline2D:
+ *		Pointer of Spline2D-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void spline2D_mixed_derivatives(Spline2D *spline);
+
+
+/*
+ * spline2D_evaluate:
+ * ------------------
+ *
+ * Evaluates spline and its partial derivatives at variables x and y if x and y
+ * are within limits of spline and all nodes of the cell are valid. Thus,
+ * callers can evaluate the original function with their own inputs
+ * otherwise.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_value:
+ *		Value of spline.
+ *	double *ret_df_dx:
+ *		Partial derivative of spline wrt. first variable.
+ *	double *ret_df_dy:
+ *		Partial derivative of spline wrt. second variable.
+ *	double x:
+ *		First variable.
+ *	double y:
+ *		Second variable.
+ * 	struct *Spline2D:
+ *		Pointer of Spline2D-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if state is evaluated by spline and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int spline2D_evaluate(double *ret_value, double *ret_df_dx, double *ret_df_dy,
+	double x, double y, const Spline2D *spline);
+
+#endif
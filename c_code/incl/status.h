@@ -0,0 +1,404 @@
+//////////////
+// status.h //
+//////////////
+#ifndef status_h
+#define status_h
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#ifdef DLL_EXPORTS
+	#define DLL_API __attribute__((visibility("default")))
+	#else
+	#define DLL_API
+	#endif
+#else
+	#ifdef DLL_EXPORTS
+	#define DLL_API __declspec(dllexport)
+	#else
+	#define DLL_API
+	#endif
+#endif
+
+
+/////////////////////////////
+// Definition of constants //
+/////////////////////////////
+/*
+ * STATUS_*:
+ * ---------
+ *
+ * Codes of status record. Functions only set the status record when they
+ * fail or when their result is uncertain (e.g., interpolated after failed
+ * iterations). Thus, the code is STATUS_OK until a function fails or the
+ * status record is reset.
+ *
+ *	STATUS_OK:
+ *		No failure occurred.
+ *	STATUS_INVALID_STRUCT:
+ *		Struct given as input does not exist.
+ *	STATUS_NOT_IMPLEMENTED:
+ *		Function or its coefficients are not implemented.
+ *	STATUS_NO_CONVERGENCE:
+ *		Iterative method did not converge.
+ *	STATUS_OUT_OF_RANGE:
+ *		State is outside range of function (e.g., vapor pressure above
+ *		critical temperature).
+ *	STATUS_INVALID_INPUT:
+ *		Inputs are invalid.
+ *	STATUS_NO_MEMORY:
+ *		Memory cannot be allocated.
+ *	STATUS_DATABASE:
+ *		Database cannot be read or does not contain entry.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#ifndef STATUS_OK
+#define STATUS_OK 0
+#endif
+
+#ifndef STATUS_INVALID_STRUCT
+#define STATUS_INVALID_STRUCT 1
+#endif
+
+#ifndef STATUS_NOT_IMPLEMENTED
+#define STATUS_NOT_IMPLEMENTED 2
+#endif
+
+#ifndef STATUS_NO_CONVERGENCE
+#define STATUS_NO_CONVERGENCE 3
+#endif
+
+#ifndef STATUS_OUT_OF_RANGE
+#define STATUS_OUT_OF_RANGE 4
+#endif
+
+#ifndef STATUS_INVALID_INPUT
+#define STATUS_INVALID_INPUT 5
+#endif
+
+#ifndef STATUS_NO_MEMORY
+#define STATUS_NO_MEMORY 6
+#endif
+
+#ifndef STATUS_DATABASE
+#define STATUS_DATABASE 7
+#endif
+
+#ifndef STATUS_NO_CODES
+#define STATUS_NO_CODES 8
+#endif
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+/*
+ * Status:
+ * -------
+ *
+ * Contains last failure of a thread. Each thread owns one status record and,
+ * thus, the record can be read after a function call without locks.
+ *
+ * Attributes:
+ * -----------
+ *	int code:
+ *		Code of last failure (i.e., STATUS_OK if no failure occurred).
+ *	const char *function:
+ *		Name of function that failed (i.e., NULL if no failure occurred).
+ *	int iterations:
+ *		Number of iterations of failed iterative method (i.e., 0 for
+ *		non-iterative functions).
+ *	double residual:
+ *		Last residual of failed iterative method (e.g., difference between
+ *		calculated and given pressure) or value that is out of range.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct Status Status;
+
+
+///////////////////////////////////////
+// Definition of function prototypes //
+///////////////////////////////////////
+/*
+ * status_report:
+ * --------------
+ *
+ * Auxiliary function recording a failure in the status record of the calling
+ * thread. Function is called instead of printing a warning directly: Warnings
+ * are only printed if the function returns 1.
+ *
+ * Parameters:
+ * -----------
+ *	int code:
+ *		Code of failure.
+ *	const char *function:
+ *		Name of function that failed.
+ *	int iterations:
+ *		Number of iterations of iterative method.
+ *	double residual:
+ *		Last residual of iterative method or value that is out of range.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 1 if warning shall be printed and 0 if quiet mode is enabled
+ *		globally or for the calling thread.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int status_report(int code, const char *function, int iterations,
+	double residual);
+
+
+/*
+ * status_quiet_thread:
+ * --------------------
+ *
+ * Auxiliary function enabling or disabling quiet mode for the calling thread
+ * only (e.g., while batch functions fill arrays of status codes).
+ *
+ * Parameters:
+ * -----------
+ *	int quiet:
+ *		Flag indicating whether warnings of calling thread are suppressed.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Previous flag of calling thread.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int status_quiet_thread(int quiet);
+
+
+/*
+ * status_code:
+ * ------------
+ *
+ * Auxiliary function returning code of status record of calling thread and
+ * resetting it afterwards. Function is used by batch functions after each
+ * state.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Code of last failure.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int status_code(void);
+
+
+/*
+ * status_record:
+ * --------------
+ *
+ * Auxiliary function returning a copy of status record of calling thread
+ * without resetting it. Function is used by caches to store failures together
+ * with cached results.
+ *
+ * Returns:
+ * --------
+ *	Status:
+ *		Copy of status record.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+Status status_record(void);
+
+
+/*
+ * setStatusQuiet:
+ * ---------------
+ *
+ * Enables or disables quiet mode of all threads. In quiet mode, no warnings are
+ * printed, but failures are still recorded in the status records.
+ *
+ * Parameters:
+ * -----------
+ *	int quiet:
+ *		Flag indicating whether warnings are suppressed.
+ *
+ * Remarks:
+ * --------
+ *	Quiet mode should be set before threads call functions of the library.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void setStatusQuiet(int quiet);
+
+
+/*
+ * getStatusQuiet:
+ * ---------------
+ *
+ * Returns flag indicating whether quiet mode of all threads is enabled.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Flag indicating whether warnings are suppressed.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getStatusQuiet(void);
+
+
+/*
+ * resetStatus:
+ * ------------
+ *
+ * Resets status record of calling thread to STATUS_OK.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void resetStatus(void);
+
+
+/*
+ * getStatusCode:
+ * --------------
+ *
+ * Returns code of last failure of calling thread.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Code of last failure (i.e., STATUS_OK if no failure occurred since
+ *		last reset).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getStatusCode(void);
+
+
+/*
+ * getStatusFunction:
+ * ------------------
+ *
+ * Returns name of function of last failure of calling thread.
+ *
+ * Returns:
+ * --------
+ *	const char *:
+ *		Name of function (i.e., "" if no failure occurred since last reset).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API const char *getStatusFunction(void);
+
+
+/*
+ * getStatusIterations:
+ * --------------------
+ *
+ * Returns number of iterations of last failure of calling thread.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of iterations (i.e., 0 for non-iterative functions).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getStatusIterations(void);
+
+
+/*
+ * getStatusResidual:
+ * ------------------
+ *
+ * Returns residual of last failure of calling thread.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Last residual of iterative method or value that is out of range.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double getStatusResidual(void);
+
+
+/*
+ * getStatusMessage:
+ * -----------------
+ *
+ * Returns description of a status code.
+ *
+ * Parameters:
+ * -----------
+ *	int code:
+ *		Status code.
+ *
+ * Returns:
+ * --------
+ *	const char *:
+ *		Description of status code.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API const char *getStatusMessage(int code);
+
+#endif
@@ -0,0 +1,110 @@
+////////////////////////
+// streamEvaluation.h //
+////////////////////////
+#ifndef streamEvaluation_h
+#define streamEvaluation_h
+#include <stdio.h>
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+/*
+ * STREAM_*:
+ * ---------
+ *
+ * Defaults and limits of streaming evaluation.
+ *
+ *	STREAM_BLOCK_SIZE:
+ *		Default number of rows evaluated by one batch.
+ *	STREAM_MAX_LINE:
+ *		Maximal length of a line of a CSV file including line break.
+ *	STREAM_MAX_COLUMN:
+ *		Maximal column of a CSV file or maximal field of a binary record that
+ *		can be selected as input (i.e., counted from 0).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#define STREAM_BLOCK_SIZE 65536
+#define STREAM_MAX_LINE 4096
+#define STREAM_MAX_COLUMN 255
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+/*
+ * StreamEvaluation:
+ * -----------------
+ *
+ * Contains options of streaming evaluation of a function of the
+ * WorkingPair-struct for rows of a CSV file or records of a binary file.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct StreamEvaluation StreamEvaluation;
+
+
+///////////////////////////////////////
+// Definition of function prototypes //
+///////////////////////////////////////
+/*
+ * streamEvaluation_run:
+ * ---------------------
+ *
+ * Reads rows of inputs block by block, evaluates each block by
+ * batch_evaluate, and writes one row of outputs per row of inputs. Memory is
+ * independent of number of rows because only one block is kept.
+ *
+ * CSV rows are written as value, mole fractions of both components in vapor
+ * phase (i.e., only for mixing rules), and status code (i.e., only if
+ * requested), separated by the delimiter. Binary records contain the same
+ * fields as doubles in native byte order.
+ *
+ * Parameters:
+ * -----------
+ *	long long *ret_no_rows:
+ *		Number of rows that were evaluated.
+ *	FILE *input:
+ *		Stream of inputs (i.e., opened in binary mode for binary records).
+ *	FILE *output:
+ *		Stream of outputs (i.e., opened in binary mode for binary records).
+ *	const struct *StreamEvaluation:
+ *		Options of streaming evaluation.
+ *	void *batchPool:
+ *		Pointer of BatchPool-struct evaluating blocks.
+ *	void *workingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all rows were evaluated and -1 if stream was stopped by
+ *		an error (e.g., invalid options, truncated binary record, or too
+ *		long line).
+ *
+ * Remarks:
+ * --------
+ *	CSV fields that are no numbers do not stop the stream: Their rows are
+ *	returned with value -1 and status STATUS_INVALID_INPUT. Empty lines are
+ *	skipped. Warnings are written to stderr because stdout usually holds the
+ *	outputs.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int streamEvaluation_run(long long *ret_no_rows, FILE *input, FILE *output,
+	const StreamEvaluation *stream, void *batchPool, void *workingPair);
+
+#endif
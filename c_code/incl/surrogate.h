@@ -0,0 +1,506 @@
+/////////////////
+// surrogate.h //
+/////////////////
+#ifndef surrogate_h
+#define surrogate_h
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+/*
+ * Surrogate:
+ * ----------
+ *
+ * Contains piecewise Chebyshev polynomials approximating a function of one
+ * variable on equidistant intervals. Intervals whose approximation does not
+ * meet the required accuracy are marked and evaluated by the original
+ * function.
+ *
+ * Attributes:
+ * -----------
+ * 	function function:
+ *		Original function that is approximated depending on variable x and
+ *		pointer to data.
+ *	void *data:
+ *		Pointer to data that is passed to original function.
+ *
+ *	double x_min:
+ *		Lower limit of variable.
+ *	double x_max:
+ *		Upper limit of variable.
+ *	double inv_h:
+ *		Inverse of width of intervals.
+ *	int no_intervals:
+ *		Number of intervals.
+ *
+ *	double *coefficients:
+ *		Array containing Chebyshev coefficients of all intervals.
+ *	char *exact:
+ *		Array indicating whether interval is evaluated by original function.
+ *	double max_error:
+ *		Maximal relative error of approximation at check points.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct Surrogate Surrogate;
+
+
+/*
+ * Surrogate2D:
+ * ------------
+ *
+ * Contains piecewise tensor-product Chebyshev polynomials approximating a
+ * function of two variables on equidistant cells. Cells whose approximation
+ * does not meet the required accuracy are marked and evaluated by the original
+ * function.
+ *
+ * Attributes:
+ * -----------
+ * 	function function:
+ *		Original function that is approximated depending on variables x and y
+ *		and pointer to data.
+ *	void *data:
+ *		Pointer to data that is passed to original function.
+ *	int log_output:
+ *		Flag indicating whether logarithm of function is approximated.
+ *
+ *	double x_min:
+ *		Lower limit of first variable.
+ *	double x_max:
+ *		Upper limit of first variable.
+ *	double y_min:
+ *		Lower limit of second variable.
+ *	double y_max:
+ *		Upper limit of second variable.
+ *	double inv_h_x:
+ *		Inverse of width of cells regarding first variable.
+ *	double inv_h_y:
+ *		Inverse of width of cells regarding second variable.
+ *	int no_intervals:
+ *		Number of intervals per variable.
+ *
+ *	double *coefficients:
+ *		Array containing Chebyshev coefficients of all cells.
+ *	char *exact:
+ *		Array indicating whether cell is evaluated by original function.
+ *	double max_error:
+ *		Maximal relative error of approximation at check points.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct Surrogate2D Surrogate2D;
+
+
+///////////////////////////////////////
+// Definition of function prototypes //
+///////////////////////////////////////
+/*
+ * newSurrogate:
+ * -------------
+ *
+ * Initialization function to create a new Surrogate-struct. Therefore,
+ * function approximates the original function by Chebyshev polynomials of
+ * degree SURROGATE_DEGREE on equidistant intervals. The number of intervals is
+ * doubled until the relative error at SURROGATE_NO_CHECKS + 1 check points per
+ * interval is smaller than the required error or SURROGATE_NO_INTERVALS_MAX is
+ * reached. Refinement also stops if the fraction of inaccurate intervals does
+ * not decrease for two refinements (e.g., for functions with numerical noise).
+ * Then, intervals that still do not meet the required error (e.g., close to
+ * singularities at the critical point) are evaluated by the original function.
+ * If limits are invalid or memory allocation fails, functions returns NULL and
+ * prints a warning.
+ *
+ * Parameters:
+ * -----------
+ *	function function:
+ *		Original function depending on variable x and pointer to data.
+ *	void *data:
+ *		Pointer to data that is passed to original function.
+ *	double x_min:
+ *		Lower limit of variable.
+ *	double x_max:
+ *		Upper limit of variable.
+ *	double max_rel_error:
+ *		Maximal relative error of approximation.
+ *
+ * Returns:
+ * --------
+ *	struct *Surrogate:
+ *		Returns malloc-ed Surrogate-struct.
+ *
+ * Remarks:
+ * --------
+ *	Accuracy is checked at the Chebyshev nodes and at equidistant check points
+ *	of each interval. Data must stay valid as long as the surrogate is used.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+Surrogate *newSurrogate(double (*function)(double, void*), void *data,
+	double x_min, double x_max, double max_rel_error);
+
+
+/*
+ * delSurrogate:
+ * -------------
+ *
+ * Destructor function to free allocated memory of a Surrogate-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Surrogate:
+ *		Pointer of Surrogate-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void delSurrogate(void *surrogate);
+
+
+/*
+ * surrogate_fit:
+ * --------------
+ *
+ * Auxiliary function to calculate Chebyshev coefficients of all intervals of a
+ * Surrogate-struct whose number of intervals is set before. Intervals that do
+ * not meet required accuracy or that contain non-finite values are marked to
+ * be evaluated by the original function. As functions of SorpPropLib return -1
+ * in case of an error (e.g., if the Newton-Raphson method does not converge),
+ * intervals containing -1 are also evaluated by the original function.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Surrogate:
+ *		Pointer of Surrogate-struct.
+ *	double max_rel_error:
+ *		Maximal relative error of approximation.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns number of intervals that are evaluated by original function.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int surrogate_fit(Surrogate *surrogate, double max_rel_error);
+
+
+/*
+ * surrogate_chebyshev:
+ * --------------------
+ *
+ * Auxiliary function to evaluate a Chebyshev series of degree SURROGATE_DEGREE
+ * by Clenshaw's recurrence.
+ *
+ * Parameters:
+ * -----------
+ *	double u:
+ *		Variable scaled to interval [-1, 1].
+ *	const double *c:
+ *		Array containing Chebyshev coefficients.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Value of Chebyshev series.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double surrogate_chebyshev(double u, const double *c);
+
+
+/*
+ * surrogate_approximate:
+ * ----------------------
+ *
+ * Evaluates Chebyshev polynomial of surrogate at variable x if x is within
+ * limits of surrogate and within an interval that is accurate enough. Thus,
+ * callers can evaluate the original function with their own inputs
+ * otherwise.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_value:
+ *		Value of surrogate.
+ *	double x:
+ *		Variable.
+ * 	struct *Surrogate:
+ *		Pointer of Surrogate-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if state is approximated by surrogate and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int surrogate_approximate(double *ret_value, double x,
+	const Surrogate *surrogate);
+
+
+/*
+ * surrogate_evaluate:
+ * -------------------
+ *
+ * Evaluates surrogate at variable x. If x is outside of limits of surrogate or
+ * within an interval that is not accurate enough, the original function is
+ * evaluated.
+ *
+ * Parameters:
+ * -----------
+ *	double x:
+ *		Variable.
+ * 	struct *Surrogate:
+ *		Pointer of Surrogate-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Value of surrogate.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double surrogate_evaluate(double x, const Surrogate *surrogate);
+
+
+/*
+ * surrogate_finite:
+ * -----------------
+ *
+ * Auxiliary function to check if a value is finite. Checks exponent bits of
+ * value directly because release builds use -Ofast, which assumes finite values
+ * and may remove checks like isfinite().
+ *
+ * Parameters:
+ * -----------
+ *	double x:
+ *		Value.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 1 if value is finite and 0 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int surrogate_finite(double x);
+
+/*
+ * newSurrogate2D:
+ * ---------------
+ *
+ * Initialization function to create a new Surrogate2D-struct. Therefore,
+ * function approximates the original function by tensor-product Chebyshev
+ * polynomials of degree SURROGATE_2D_DEGREE on equidistant cells. The number of
+ * intervals per variable is doubled until the relative error at
+ * (SURROGATE_2D_NO_CHECKS + 1)^2 check points per cell is smaller than the
+ * required error or SURROGATE_2D_NO_INTERVALS_MAX is reached. Like for
+ * newSurrogate, refinement stops if the fraction of inaccurate cells does not
+ * decrease by a quarter for two refinements (e.g., if the original function
+ * fails in parts of the domain), and inaccurate cells are evaluated by the
+ * original function. If limits are invalid or memory allocation fails,
+ * functions returns NULL and prints a warning.
+ *
+ * Parameters:
+ * -----------
+ *	function function:
+ *		Original function depending on variables x and y and pointer to data.
+ *	void *data:
+ *		Pointer to data that is passed to original function.
+ *	int log_output:
+ *		Flag indicating whether logarithm of function is approximated (e.g.,
+ *		for pressures that span several orders of magnitude).
+ *	double x_min:
+ *		Lower limit of first variable.
+ *	double x_max:
+ *		Upper limit of first variable.
+ *	double y_min:
+ *		Lower limit of second variable.
+ *	double y_max:
+ *		Upper limit of second variable.
+ *	double max_rel_error:
+ *		Maximal relative error of approximation.
+ *
+ * Returns:
+ * --------
+ *	struct *Surrogate2D:
+ *		Returns malloc-ed Surrogate2D-struct.
+ *
+ * Remarks:
+ * --------
+ *	Accuracy is checked at the Chebyshev nodes and at equidistant check points
+ *	of each cell. Data must stay valid as long as the surrogate is used.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+Surrogate2D *newSurrogate2D(double (*function)(double, double, void*),
+	void *data, int log_output, double x_min, double x_max, double y_min,
+	double y_max, double max_rel_error);
+
+/*
+ * delSurrogate2D:
+ * ---------------
+ *
+ * Destructor function to free allocated memory of a Surrogate2D-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Surrogate2D:
+ *		Pointer of Surrogate2D-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void delSurrogate2D(void *surrogate);
+
+/*
+ * surrogate2D_fit:
+ * ----------------
+ *
+ * Auxiliary function to calculate Chebyshev coefficients of all cells of a
+ * Surrogate2D-struct whose number of intervals is set before. Like for
+ * surrogate_fit, cells that do not meet required accuracy or that contain
+ * non-finite values or -1 are marked to be evaluated by the original function.
+ * If logarithm of function is approximated, cells containing non-positive
+ * values are marked as well. Cells whose parent cell of the previous
+ * refinement is accurate are calculated from the polynomial of the parent
+ * without evaluating the original function. Thus, only inaccurate regions are
+ * refined adaptively.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Surrogate2D:
+ *		Pointer of Surrogate2D-struct.
+ *	const double *coefficients_parent:
+ *		Array containing Chebyshev coefficients of previous refinement with
+ *		half the number of intervals (i.e., NULL for first refinement).
+ *	const char *exact_parent:
+ *		Array indicating whether cell of previous refinement is evaluated by
+ *		original function (i.e., NULL for first refinement).
+ *	double max_rel_error:
+ *		Maximal relative error of approximation.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns number of cells that are evaluated by original function.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int surrogate2D_fit(Surrogate2D *surrogate, const double *coefficients_parent,
+	const char *exact_parent, double max_rel_error);
+
+/*
+ * surrogate2D_chebyshev:
+ * ----------------------
+ *
+ * Auxiliary function to evaluate a tensor-product Chebyshev series of degree
+ * SURROGATE_2D_DEGREE. Therefore, Chebyshev polynomials of both variables are
+ * calculated by their recurrence first. Afterwards, the sums of all rows are
+ * independent of each other and are not limited by the latency of a
+ * recurrence like Clenshaw's recurrence.
+ *
+ * Parameters:
+ * -----------
+ *	double u:
+ *		First variable scaled to interval [-1, 1].
+ *	double v:
+ *		Second variable scaled to interval [-1, 1].
+ *	const double *c:
+ *		Array containing Chebyshev coefficients (i.e., row-major with first
+ *		variable as row).
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Value of Chebyshev series.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double surrogate2D_chebyshev(double u, double v, const double *c);
+
+/*
+ * surrogate2D_approximate:
+ * ------------------------
+ *
+ * Evaluates Chebyshev polynomial of surrogate at variables x and y if both are
+ * within limits of surrogate and within a cell that is accurate enough. Thus,
+ * callers can evaluate the original function with their own inputs
+ * otherwise.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_value:
+ *		Value of surrogate.
+ *	double x:
+ *		First variable.
+ *	double y:
+ *		Second variable.
+ * 	struct *Surrogate2D:
+ *		Pointer of Surrogate2D-struct (i.e., may be NULL).
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if state is approximated by surrogate and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int surrogate2D_approximate(double *ret_value, double x, double y,
+	const Surrogate2D *surrogate);
+
+#endif
@@ -0,0 +1,31 @@
+///////////////////
+// threadLocal.h //
+///////////////////
+#ifndef threadLocal_h
+#define threadLocal_h
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+/*
+ * THREAD_LOCAL:
+ * -------------
+ *
+ * Storage class specifier for variables that exist once per thread. Thus,
+ * caches stored in such variables can be used by several threads without
+ * locks.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#if defined(__GNUC__)
+	#define THREAD_LOCAL __thread
+#else
+	#define THREAD_LOCAL __declspec(thread)
+#endif
+
+#endif
@@ -0,0 +1,88 @@
+/////////////////////
+// threadSupport.h //
+/////////////////////
+#ifndef threadSupport_h
+#define threadSupport_h
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+/*
+ * THREAD / MUTEX / CONDITION:
+ * ---------------------------
+ *
+ * Types and functions of threads, mutexes, and condition variables. POSIX
+ * threads are used for GCC (i.e., also MinGW linking winpthreads) and the
+ * Windows API is used for MSVC. Thread functions are defined by
+ * "THREAD_RETURN function(void *argument)" and return THREAD_RETURN_VALUE.
+ *
+ * Remarks:
+ * --------
+ *	THREAD_CREATE returns 0 on success and a non-zero value otherwise. Mutexes
+ *	and condition variables must be destroyed after use.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#if defined(_MSC_VER)
+	#ifndef WIN32_LEAN_AND_MEAN
+	#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+	#define NOMINMAX
+	#endif
+	#include <windows.h>
+
+	#define THREAD HANDLE
+	#define THREAD_RETURN DWORD WINAPI
+	#define THREAD_RETURN_VALUE 0
+	#define THREAD_CREATE(thread, function, argument) \
+		((*(thread) = CreateThread(NULL, 0, (function), (argument), 0, \
+		NULL)) == NULL)
+	#define THREAD_JOIN(thread) \
+		do { \
+			WaitForSingleObject((thread), INFINITE); \
+			CloseHandle(thread); \
+		} while (0)
+
+	#define MUTEX SRWLOCK
+	#define MUTEX_INIT(mutex) InitializeSRWLock(mutex)
+	#define MUTEX_DESTROY(mutex) ((void) (mutex))
+	#define MUTEX_LOCK(mutex) AcquireSRWLockExclusive(mutex)
+	#define MUTEX_UNLOCK(mutex) ReleaseSRWLockExclusive(mutex)
+
+	#define CONDITION CONDITION_VARIABLE
+	#define CONDITION_INIT(condition) InitializeConditionVariable(condition)
+	#define CONDITION_DESTROY(condition) ((void) (condition))
+	#define CONDITION_WAIT(condition, mutex) \
+		SleepConditionVariableSRW((condition), (mutex), INFINITE, 0)
+	#define CONDITION_BROADCAST(condition) WakeAllConditionVariable(condition)
+#else
+	#include <pthread.h>
+
+	#define THREAD pthread_t
+	#define THREAD_RETURN void *
+	#define THREAD_RETURN_VALUE NULL
+	#define THREAD_CREATE(thread, function, argument) \
+		pthread_create((thread), NULL, (function), (argument))
+	#define THREAD_JOIN(thread) pthread_join((thread), NULL)
+
+	#define MUTEX pthread_mutex_t
+	#define MUTEX_INIT(mutex) pthread_mutex_init((mutex), NULL)
+	#define MUTEX_DESTROY(mutex) pthread_mutex_destroy(mutex)
+	#define MUTEX_LOCK(mutex) pthread_mutex_lock(mutex)
+	#define MUTEX_UNLOCK(mutex) pthread_mutex_unlock(mutex)
+
+	#define CONDITION pthread_cond_t
+	#define CONDITION_INIT(condition) pthread_cond_init((condition), NULL)
+	#define CONDITION_DESTROY(condition) pthread_cond_destroy(condition)
+	#define CONDITION_WAIT(condition, mutex) \
+		pthread_cond_wait((condition), (mutex))
+	#define CONDITION_BROADCAST(condition) pthread_cond_broadcast(condition)
+#endif
+
+#endif
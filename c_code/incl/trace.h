@@ -0,0 +1,564 @@
+/////////////
+// trace.h //
+/////////////
+#ifndef trace_h
+#define trace_h
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#ifdef DLL_EXPORTS
+	#define DLL_API __attribute__((visibility("default")))
+	#else
+	#define DLL_API
+	#endif
+#else
+	#ifdef DLL_EXPORTS
+	#define DLL_API __declspec(dllexport)
+	#else
+	#define DLL_API
+	#endif
+#endif
+
+
+/*
+ * TRACE_BEGIN / TRACE_RETURN / TRACE_SOLVER / TRACE_DELETE:
+ * ---------------------------------------------------------
+ *
+ * Macros recording calls of functions of the WorkingPair-struct. TRACE_BEGIN(
+ * name, workingPair, ...) stores the inputs at the beginning of a function,
+ * TRACE_RETURN(value) writes the call and its result into the trace and
+ * evaluates to value, TRACE_SOLVER(iterations) adds the iterations of a
+ * solver to the call of the calling thread, and TRACE_DELETE(workingPair)
+ * forgets the pointer of a working pair that is deleted.
+ *
+ * Remarks:
+ * --------
+ *	Recording is only compiled if SORP_TRACE is defined (e.g., by "make
+ *	TRACE=YES"). Otherwise, macros expand to their value or to nothing and do
+ *	not cost any time. TRACE_RETURN and TRACE_SOLVER are called by the macros
+ *	STATISTICS_RETURN and STATISTICS_SOLVER.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#ifdef SORP_TRACE
+	#define TRACE_BEGIN(name, workingPair, ...) \
+		TraceCall trace_call; \
+		trace_begin(&trace_call, STATISTICS_FUNCTION_##name, (workingPair), \
+			(const double []) {__VA_ARGS__}, \
+			(int) (sizeof((const double []) {__VA_ARGS__}) / sizeof(double)))
+	#define TRACE_RETURN(value) \
+		trace_end(&trace_call, (value))
+	#define TRACE_SOLVER(iterations) \
+		trace_solver(iterations)
+	#define TRACE_DELETE(workingPair) \
+		trace_delete(workingPair)
+#else
+	#define TRACE_BEGIN(name, workingPair, ...) \
+		((void) 0)
+	#define TRACE_RETURN(value) \
+		(value)
+	#define TRACE_SOLVER(iterations) \
+		((void) 0)
+	#define TRACE_DELETE(workingPair) \
+		((void) 0)
+#endif
+
+
+/////////////////////////////
+// Definition of constants //
+/////////////////////////////
+/*
+ * TRACE_NO_ARGUMENTS:
+ * -------------------
+ *
+ * Maximal number of inputs of type double of a recorded function (i.e.,
+ * ads_vol_piStar_pyxgTpsatRhoM has eight inputs).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#define TRACE_NO_ARGUMENTS 8
+
+
+/*
+ * TRACE_LENGTH_NAME:
+ * ------------------
+ *
+ * Length of strings stored in trace files (i.e., names of functions and of
+ * working pairs) including the terminating null character.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#define TRACE_LENGTH_NAME 64
+
+
+/*
+ * TRACE_NO_PAIRS:
+ * ---------------
+ *
+ * Maximal number of different working pairs of a trace. Calls of further
+ * working pairs are not recorded.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#ifndef TRACE_NO_PAIRS
+#define TRACE_NO_PAIRS 64
+#endif
+
+
+/*
+ * TRACE_CAPACITY:
+ * ---------------
+ *
+ * Default number of calls stored by the ring buffer if recording is started
+ * by the environment variable SORP_TRACE_FILE. The environment variable
+ * SORP_TRACE_CAPACITY overrides this value.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#ifndef TRACE_CAPACITY
+#define TRACE_CAPACITY 65536
+#endif
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+/*
+ * TraceCall:
+ * ----------
+ *
+ * Contains inputs of a call that is in progress. Struct is a local variable of
+ * each recorded function and, thus, calls of several threads do not interfere.
+ *
+ * Attributes:
+ * -----------
+ *	int function:
+ *		Index of function (i.e., STATISTICS_FUNCTION_*) or -1 if call is not
+ *		recorded.
+ *	int pair:
+ *		Index of working pair in trace.
+ *	int no_arguments:
+ *		Number of inputs.
+ *	int iterations:
+ *		Iterations of calling thread at beginning of call.
+ *	unsigned long long start_ns:
+ *		Time at beginning of call in ns.
+ *	double arguments[]:
+ *		Inputs of call.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct TraceCall TraceCall;
+
+
+/*
+ * TracePair:
+ * ----------
+ *
+ * Contains names and numbers of equations identifying a working pair of a
+ * trace. Thus, the working pair can be created again when replaying a trace.
+ *
+ * Attributes:
+ * -----------
+ *	char wp_as[]:
+ *		Name of sorbent.
+ *	char wp_st[]:
+ *		Name of sub-type of sorbent.
+ *	char wp_rf[]:
+ *		Name of refrigerant.
+ *	char wp_iso[]:
+ *		Name of isotherm.
+ *	char rf_psat[]:
+ *		Name of calculation approach for vapor pressure.
+ *	char rf_rhol[]:
+ *		Name of calculation approach for liquid density.
+ *	int no_iso:
+ *		ID of isotherm.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation.
+ *	int no_rhol:
+ *		ID of liquid density equation.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct TracePair TracePair;
+
+
+/*
+ * TraceRecord:
+ * ------------
+ *
+ * Contains a recorded call. Records have a fixed size of 88 bytes and are
+ * written to trace files without conversion (i.e., in native byte order).
+ *
+ * Attributes:
+ * -----------
+ *	unsigned short function:
+ *		Index of function in table of function names of trace.
+ *	unsigned short pair:
+ *		Index of working pair in table of working pairs of trace.
+ *	unsigned short no_arguments:
+ *		Number of inputs.
+ *	unsigned short iterations:
+ *		Number of iterations of solvers required by call (i.e., limited to
+ *		65535).
+ *	unsigned int thread:
+ *		Identifier of thread that executed call.
+ *	unsigned int time_ns:
+ *		Duration of call in ns (i.e., limited to about 4.3 s).
+ *	double arguments[]:
+ *		Inputs of call.
+ *	double result:
+ *		Result of call.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct TraceRecord TraceRecord;
+
+
+/*
+ * TraceFile:
+ * ----------
+ *
+ * Contains content of a trace file.
+ *
+ * Attributes:
+ * -----------
+ *	int no_functions:
+ *		Number of function names.
+ *	int no_pairs:
+ *		Number of working pairs.
+ *	unsigned long long no_records:
+ *		Number of recorded calls.
+ *	unsigned long long no_calls:
+ *		Number of calls during recording (i.e., greater than no_records if
+ *		ring buffer overflowed).
+ *	char (*functions)[]:
+ *		Malloc-ed array containing names of functions.
+ *	TracePair *pairs:
+ *		Malloc-ed array containing working pairs.
+ *	TraceRecord *records:
+ *		Malloc-ed array containing recorded calls in chronological order.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct TraceFile TraceFile;
+
+
+///////////////////////////////////////
+// Definition of function prototypes //
+///////////////////////////////////////
+/*
+ * trace_begin:
+ * ------------
+ *
+ * Auxiliary function storing inputs of a call if recording is active. Function
+ * is called by macro TRACE_BEGIN.
+ *
+ * Parameters:
+ * -----------
+ *	TraceCall *call:
+ *		Pointer of TraceCall-struct of calling function.
+ *	int function:
+ *		Index of function (i.e., STATISTICS_FUNCTION_*).
+ *	void *workingPair:
+ *		Pointer of WorkingPair-struct.
+ *	const double *arguments:
+ *		Array containing inputs of call.
+ *	int no_arguments:
+ *		Number of inputs.
+ *
+ * Remarks:
+ * --------
+ *	Recording is started when the first call is traced if the environment
+ *	variable SORP_TRACE_FILE is set. Then, the trace is saved to this file when
+ *	the program exits.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void trace_begin(TraceCall *call, int function, void *workingPair,
+	const double *arguments, int no_arguments);
+
+
+/*
+ * trace_end:
+ * ----------
+ *
+ * Auxiliary function writing a call and its result into the ring buffer.
+ * Function is called by macro TRACE_RETURN.
+ *
+ * Parameters:
+ * -----------
+ *	TraceCall *call:
+ *		Pointer of TraceCall-struct of calling function.
+ *	double value:
+ *		Value returned by function.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns value given as input.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double trace_end(TraceCall *call, double value);
+
+
+/*
+ * trace_solver:
+ * -------------
+ *
+ * Auxiliary function adding iterations of a solver to the iterations of the
+ * calling thread. Function is called by macro TRACE_SOLVER.
+ *
+ * Parameters:
+ * -----------
+ *	int iterations:
+ *		Number of iterations.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void trace_solver(int iterations);
+
+
+/*
+ * trace_delete:
+ * -------------
+ *
+ * Auxiliary function forgetting pointer of a working pair that is deleted.
+ * Thus, a new working pair allocated at the same address is identified by its
+ * names again. Function is called by macro TRACE_DELETE.
+ *
+ * Parameters:
+ * -----------
+ *	void *workingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void trace_delete(void *workingPair);
+
+
+/*
+ * sorp_trace_enabled:
+ * -------------------
+ *
+ * Returns flag indicating whether recording of calls is compiled.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 1 if library is compiled with SORP_TRACE and 0 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int sorp_trace_enabled(void);
+
+
+/*
+ * sorp_trace_start:
+ * -----------------
+ *
+ * Starts recording of calls into a new ring buffer. If the ring buffer is full,
+ * the oldest calls are overwritten.
+ *
+ * Parameters:
+ * -----------
+ *	int capacity:
+ *		Number of calls stored by ring buffer.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if recording is started and -1 otherwise.
+ *
+ * Remarks:
+ * --------
+ *	Function must not be called while other threads call functions of the
+ *	library.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int sorp_trace_start(int capacity);
+
+
+/*
+ * sorp_trace_stop:
+ * ----------------
+ *
+ * Stops recording of calls. Recorded calls are kept until recording is started
+ * again.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void sorp_trace_stop(void);
+
+
+/*
+ * sorp_trace_no_records:
+ * ----------------------
+ *
+ * Returns number of calls stored by ring buffer.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Number of stored calls.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double sorp_trace_no_records(void);
+
+
+/*
+ * sorp_trace_save:
+ * ----------------
+ *
+ * Writes recorded calls in chronological order to binary trace file. File
+ * contains header, table of function names, table of working pairs, and
+ * records (see TraceRecord).
+ *
+ * Parameters:
+ * -----------
+ *	const char *path:
+ *		Path of trace file.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if trace is written and -1 otherwise.
+ *
+ * Remarks:
+ * --------
+ *	Function should not be called while other threads call functions of the
+ *	library. Otherwise, calls in progress may be written incompletely.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int sorp_trace_save(const char *path);
+
+
+/*
+ * newTraceFile:
+ * -------------
+ *
+ * Reads binary trace file written by sorp_trace_save.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path:
+ *		Path of trace file.
+ *
+ * Returns:
+ * --------
+ *	struct *TraceFile:
+ *		Returns pointer of TraceFile-struct or NULL if file cannot be read.
+ *
+ * Remarks:
+ * --------
+ *	Trace file must be deleted by delTraceFile.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API TraceFile *newTraceFile(const char *path);
+
+
+/*
+ * delTraceFile:
+ * -------------
+ *
+ * Frees memory of TraceFile-struct.
+ *
+ * Parameters:
+ * -----------
+ *	void *traceFile:
+ *		Pointer of TraceFile-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void delTraceFile(void *traceFile);
+
+#endif
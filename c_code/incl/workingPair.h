@@ -3,6 +3,8 @@
 ///////////////////
 #ifndef workingPair_h
 #define workingPair_h
+#include <stddef.h>
+#include "database.h"
 
 
 //////////////////////////
@@ -10,7 +12,7 @@
 //////////////////////////
 #ifdef __unix
 	#ifdef DLL_EXPORTS
-	#define DLL_API
+	#define DLL_API __attribute__((visibility("default")))
 	#else
 	#define DLL_API
 	#endif
@@ -22,6 +24,14 @@
 	#endif
 #endif
 
+#ifndef WORKINGPAIR_LAYOUT_STANDARD
+#define WORKINGPAIR_LAYOUT_STANDARD 0
+#endif
+
+#ifndef WORKINGPAIR_LAYOUT_COMPACT
+#define WORKINGPAIR_LAYOUT_COMPACT 1
+#endif
+
 
 ////////////////////////////
 // Definition of typedefs //
@@ -71,13 +81,166 @@
  *	Refrigerant *refrigerant:
  *		Struct containing function pointers for refrigerant functions.
  *
+ *	int no_iso_par:
+ *		Number of coefficients of isotherm.
+ *	int no_psat_par:
+ *		Number of coefficients of vapor pressure equation.
+ *	int no_rhol_par:
+ *		Number of coefficients of saturated liquid density equation.
+ *	int layout:
+ *		Memory layout of WorkingPair-struct (i.e., WORKINGPAIR_LAYOUT_STANDARD
+ *		or WORKINGPAIR_LAYOUT_COMPACT).
+ *
+ *	RefrigerantParameters *refrigerant_parameters:
+ *		Struct interned by database that owns coefficients of refrigerant
+ *		functions and Refrigerant-struct. NULL if working pair owns them.
+ *
+ *	WorkingPairSurrogate *surrogates:
+ *		Struct containing surrogates of equilibrium functions. NULL if
+ *		surrogates are disabled.
+ *	WorkingPairTable *tables:
+ *		Struct containing spline tables of equilibrium functions. NULL if
+ *		tables are disabled.
+ *
+ * Remarks:
+ * --------
+ *	All ads_*-, abs_*-, ref_*-, and tab_*-functions only read the struct.
+ *	Hence, several threads can evaluate the same WorkingPair-struct at the
+ *	same time. Functions enabling or disabling surrogates or tables change
+ *	the struct and must not be called while other threads use it.
+ *
  * History:
  * --------
  *	01/06/2020, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Added numbers of coefficients and memory layout.
+ *		Added interned refrigerant.
+ *		Added surrogates.
+ *		Added spline tables.
+ *		Added remarks on thread safety.
+ *
+ */
+typedef struct WorkingPair WorkingPair;
+
+
+/*
+ * WorkingPairSurrogate:
+ * ---------------------
+ *
+ * Contains surrogates of equilibrium functions of a working pair. Loading w
+ * denotes equilibrium loading for adsorption, concentration for conventional
+ * absorption, and mole fraction in liquid phase for absorption based on
+ * mixing rules. Pressure is approximated by its logarithm, and surrogates
+ * depending on pressure use logarithm of pressure as variable.
+ *
+ * Attributes:
+ * -----------
+ *	double p_min_Pa:
+ *		Lower limit of pressure in Pa.
+ *	double p_max_Pa:
+ *		Upper limit of pressure in Pa.
+ *	double T_min_K:
+ *		Lower limit of temperature in K.
+ *	double T_max_K:
+ *		Upper limit of temperature in K.
+ *	double w_min:
+ *		Lower limit of loading.
+ *	double w_max:
+ *		Upper limit of loading.
+ *
+ *	Surrogate2D *w_pT:
+ *		Surrogate of loading depending on pressure and temperature.
+ *	Surrogate2D *p_wT:
+ *		Surrogate of pressure depending on loading and temperature.
+ *	Surrogate2D *T_pw:
+ *		Surrogate of temperature depending on pressure and loading.
+ *	Surrogate2D *y_1_pT:
+ *		Surrogate of mole fraction of first component in vapor phase depending
+ *		on pressure and temperature (i.e., only for mixing rules).
+ *	Surrogate2D *y_1_wT:
+ *		Surrogate of mole fraction of first component in vapor phase depending
+ *		on loading and temperature (i.e., only for mixing rules).
+ *	Surrogate2D *y_1_pw:
+ *		Surrogate of mole fraction of first component in vapor phase depending
+ *		on pressure and loading (i.e., only for mixing rules).
+ *	Surrogate2D *y_2_pT:
+ *		Surrogate of mole fraction of second component in vapor phase depending
+ *		on pressure and temperature (i.e., only for mixing rules).
+ *	Surrogate2D *y_2_wT:
+ *		Surrogate of mole fraction of second component in vapor phase depending
+ *		on loading and temperature (i.e., only for mixing rules).
+ *	Surrogate2D *y_2_pw:
+ *		Surrogate of mole fraction of second component in vapor phase depending
+ *		on pressure and loading (i.e., only for mixing rules).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct WorkingPairSurrogate WorkingPairSurrogate;
+
+
+/*
+ * WorkingPairTable:
+ * -----------------
+ *
+ * Contains spline tables of equilibrium functions of a working pair whose
+ * values and partial derivatives at the nodes are calculated by the original
+ * equations and their analytical derivatives. Loading w denotes equilibrium
+ * loading for adsorption, concentration for conventional absorption, and mole
+ * fraction in liquid phase for absorption based on mixing rules. Pressure and
+ * loading span several orders of magnitude. Thus, both are tabulated and used
+ * as variables by their logarithms, and the lower limit of loading must be
+ * positive.
+ *
+ * Attributes:
+ * -----------
+ *	double p_min_Pa:
+ *		Lower limit of pressure in Pa.
+ *	double p_max_Pa:
+ *		Upper limit of pressure in Pa.
+ *	double T_min_K:
+ *		Lower limit of temperature in K.
+ *	double T_max_K:
+ *		Upper limit of temperature in K.
+ *	double w_min:
+ *		Lower limit of loading.
+ *	double w_max:
+ *		Upper limit of loading.
+ *
+ *	Spline2D *w_pT:
+ *		Spline of loading depending on pressure and temperature.
+ *	Spline2D *p_wT:
+ *		Spline of pressure depending on loading and temperature.
+ *	Spline2D *T_pw:
+ *		Spline of temperature depending on pressure and loading.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct WorkingPairTable WorkingPairTable;
+
+
+/*
+ * DirectWorkingPair:
+ * ------------------
+ *
+ * Contains a working pair cached for functions working without WorkingPair-
+ * struct (i.e., direct_*-functions) and the arguments identifying it.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
  *
  */
-DLL_API typedef struct WorkingPair WorkingPair;
+typedef struct DirectWorkingPair DirectWorkingPair;
 
 
 ///////////////////////////////////////
@@ -128,6 +291,8 @@ DLL_API typedef struct WorkingPair WorkingPair;
  * --------
  *	01/06/2020, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Moved reading of coefficients to newWorkingPairDatabase.
  *
  */
 DLL_API WorkingPair *newWorkingPair(const char *path_db, const char *wp_as,
@@ -135,6 +300,70 @@ DLL_API WorkingPair *newWorkingPair(const char *path_db, const char *wp_as,
 	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) ;
 
 
+/*
+ * newWorkingPairDatabase:
+ * -----------------------
+ *
+ * Initialization function to create a new WorkingPair-struct from a database
+ * that is already read and parsed. Therefore, function checks first if enough
+ * memory available to allocate WorkingPair-struct and then reads coefficients
+ * of isotherm from database. Coefficients of refrigerant functions and the
+ * Refrigerant-struct are interned by the database and shared read-only by all
+ * working pairs using the same refrigerant, calculation approaches, and IDs of
+ * equations. If memory allocation fails, functions returns NULL and prints a
+ * warning.
+ *
+ * Parameters:
+ * -----------
+ *	struct *Database:
+ *		Pointer of Database-struct.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	struct *WorkingPair:
+ *		Returns malloc-ed WorkingPair-struct containing all information required
+ *		to calculate the resorption equilibrium of the working working.
+ *
+ * Remarks:
+ * --------
+ *	Working pair can be used after deleting the database. Because the vapor
+ *	pressure of interned refrigerants is cached per thread, evaluating many
+ *	working pairs with the same refrigerant at the same temperature calculates
+ *	the vapor pressure only once. Function can be called by several threads
+ *	for the same database at the same time.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API WorkingPair *newWorkingPairDatabase(Database *database,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol);
+
+
 /*
  * delWorkingPair:
  * ---------------
@@ -150,1549 +379,1457 @@ DLL_API WorkingPair *newWorkingPair(const char *path_db, const char *wp_as,
  * --------
  *	01/06/2020, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Added compact memory layout.
+ *		Added interned refrigerant.
+ *		Added surrogates.
  *
  */
 DLL_API void delWorkingPair(void *workingPair);
 
 
 /*
- * warning_struct:
- * ---------------
+ * cloneWorkingPair:
+ * -----------------
  *
- * Auxiliary function to throw warning if some struct (e.g. workingPair or
- * Adsorption) does not exist.
+ * Function to create a copy of an existing WorkingPair-struct without reading
+ * the database again. Therefore, coefficients of functions are copied and
+ * structs containing function pointers are shared with the original WorkingPair-
+ * struct. Coefficients of a refrigerant interned by a database are shared as
+ * well. Thus, each thread can work with its own WorkingPair-struct. If memory
+ * allocation fails, functions returns NULL and prints a warning.
  *
  * Parameters:
  * -----------
- * 	const char *name_struct:
- *		Name of struct that does not exist.
- * 	const char *name_function:
- *		Name of function that does not exist.
+ * 	const struct *WorkingPair:
+ *		Pointer of WorkingPair-struct that shall be cloned.
  *
  * Returns:
  * --------
- *	double:
- *		Returns -1 to indicate error.
+ *	struct *WorkingPair:
+ *		Returns copy of WorkingPair-struct with same memory layout.
+ *
+ * Remarks:
+ * --------
+ *	Clone must be freed by delWorkingPair. Original and clones can be freed in
+ *	any order and from different threads as shared structs are counted
+ *	atomically. Strings defining a working pair with standard memory layout are
+ *	not copied and must stay valid as long as the clone is used.
  *
  * History:
  * --------
- *	27/03/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-double warning_struct(const char *name_struct, const char *name_function);
+DLL_API WorkingPair *cloneWorkingPair(const WorkingPair *workingPair);
 
 
 /*
- * warning_function:
- * -----------------
+ * serializeWorkingPair:
+ * ---------------------
  *
- * Auxiliary function to throw warning if some parameter is missing.
+ * Function to write a WorkingPair-struct into a byte array. The byte array
+ * contains strings defining the working pair and coefficients of functions.
+ * Thus, the working pair can be created by deserializeWorkingPair in another
+ * process that cannot access the database.
  *
  * Parameters:
  * -----------
- * 	const char *name_parameter:
- *		Name of parameter that is missing.
- * 	const char *name_wpair_function:
- *		Name of working pair function that does not exist.
+ *	unsigned char *ret_blob:
+ *		Byte array to be filled. If NULL, only the required size is returned.
+ *	size_t size_blob:
+ *		Size of byte array in bytes.
+ * 	const struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- *	double:
- *		Returns -1 to indicate error.
+ *	size_t:
+ *		Returns number of bytes required for serialized WorkingPair-struct.
+ *		Returns 0 if WorkingPair-struct does not exist or byte array is too
+ *		small.
+ *
+ * Remarks:
+ * --------
+ *	Byte array uses native byte order and sizes of types. Thus, byte array can
+ *	only be exchanged between processes running on same architecture.
  *
  * History:
  * --------
- *	27/03/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-double warning_parameter(const char *name_parameter,
-	const char *name_wpair_function);
+DLL_API size_t serializeWorkingPair(unsigned char *ret_blob, size_t size_blob,
+	const WorkingPair *workingPair);
 
 
 /*
- * warning_function:
- * -----------------
+ * deserializeWorkingPair:
+ * -----------------------
  *
- * Auxiliary function to throw warning if some function does not exist.
+ * Function to create a WorkingPair-struct from a byte array written by
+ * serializeWorkingPair. Created WorkingPair-struct has a compact memory layout
+ * and contains copies of all strings. If byte array is invalid or memory
+ * allocation fails, functions returns NULL and prints a warning.
  *
  * Parameters:
  * -----------
- * 	const char *name_iso_function:
- *		Name of isotherm function that does not exist.
- * 	const char *name_wpair_function:
- *		Name of working pair function that does not exist.
+ *	const unsigned char *blob:
+ *		Byte array containing serialized WorkingPair-struct.
+ *	size_t size_blob:
+ *		Size of byte array in bytes.
  *
  * Returns:
  * --------
- *	double:
- *		Returns -1 to indicate error.
+ *	struct *WorkingPair:
+ *		Returns WorkingPair-struct with compact memory layout.
+ *
+ * Remarks:
+ * --------
+ *	WorkingPair-struct must be freed by delWorkingPair.
  *
  * History:
  * --------
- *	27/03/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-double warning_function(const char *name_function,
-	const char *name_wpair_function);
+DLL_API WorkingPair *deserializeWorkingPair(const unsigned char *blob,
+	size_t size_blob);
 
 
-////////////////////////////////////////////////////////////////////////////
-// Definition of function prototypes regarding adsorption working w struct//
-////////////////////////////////////////////////////////////////////////////
 /*
- * ads_w_pT:
- * ---------
+ * workingPair_no_coefficients:
+ * ----------------------------
  *
- * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
- * p in Pa and equilibrium temperature T in K.
+ * Auxiliary function returning number of coefficients of an isotherm or
+ * refrigerant equation that are indexed by its functions.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	const char *equation:
+ *		Name of isotherm equation (e.g., "Toth") or calculation approach of
+ *		refrigerant (e.g., "VaporPressure_EoS1").
  *
  * Returns:
  * --------
- *	double:
- *		Equilibrium loading in kg/kg.
+ *	int:
+ *		Number of coefficients or -1 if equation does not exist.
  *
  * History:
  * --------
- *	01/06/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_w_pT(double p_Pa, double T_K, void *workingPair);
+int workingPair_no_coefficients(const char *equation);
 
 
 /*
- * ads_p_wT:
- * ---------
+ * init_workingPair_structs:
+ * -------------------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
- * in kg/kg and equilibrium temperature T in K.
+ * Auxiliary function to create structs containing function pointers of
+ * isotherm and refrigerant functions of a WorkingPair-struct. Therefore,
+ * general information and coefficients of the WorkingPair-struct must be set
+ * before.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
+ *	int wp_tp:
+ *		Type of working pair (i.e., 1 for adsorption and 2 for absorption).
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium pressure in Pa.
+ *	int:
+ *		Returns 0 if structs are created and -1 otherwise.
  *
  * History:
  * --------
- *	01/06/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_p_wT(double w_kgkg, double T_K, void *workingPair);
+int init_workingPair_structs(WorkingPair *retWorkingPair, int wp_tp);
 
 
 /*
- * ads_T_pw:
- * ---------
+ * newWorkingPairCompact:
+ * ----------------------
  *
- * Calculates equilibrium temperature in K depending on equilibrium pressure p
- * in Pa and equilibrium loading w in kg/kg.
+ * Initialization function to create a new WorkingPair-struct with a compact
+ * memory layout. Therefore, function creates first a WorkingPair-struct with
+ * the standard memory layout and copies it afterwards into one single memory
+ * block aligned to a cache line. The memory block contains the WorkingPair-
+ * struct, all coefficients of functions, and the structs containing function
+ * pointers at fixed offsets. Thus, evaluating many working pairs one after
+ * another touches fewer cache lines. If memory allocation fails, functions
+ * returns NULL and prints a warning.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium temperature in K.
+ *	struct *WorkingPair:
+ *		Returns WorkingPair-struct with compact memory layout containing all
+ *		information required to calculate the resorption equilibrium of the
+ *		working pair.
  *
  * Remarks:
  * --------
- *	Function uses equation of states implemented for calculation of vapor
- *	pressure, saturated liquid density, derivative of vapor pressure wrt.
- *	temperature, and derivative of saturated liquid density wrt. temperature
- *	when isotherm of working pair is based on volumetric approach (e.g.
- *	Dubinin theory).
+ *	WorkingPair-struct must be freed by delWorkingPair.
  *
  * History:
  * --------
- *	01/06/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_T_pw(double p_Pa, double w_kgkg, void *workingPair);
+DLL_API WorkingPair *newWorkingPairCompact(const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol);
 
 
 /*
- * ads_dw_dp_pT:
- * -------------
+ * copy_workingPair_compact:
+ * -------------------------
  *
- * Calculates derivative of equilibrium loading w with respect to pressure
- * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Auxiliary function to copy a WorkingPair-struct into one single memory block
+ * that is aligned to a cache line. The memory block is ordered as follows:
+ * WorkingPair-struct, coefficients of isotherm, coefficients of vapor pressure
+ * equation, coefficients of saturated liquid density equation, Refrigerant-
+ * struct, Adsorption- or Absorption-struct, and strings defining the working
+ * pair. Thus, the copy does not depend on memory of the original.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
  * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *		Pointer of WorkingPair-struct that shall be copied.
  *
  * Returns:
  * --------
- *	double:
- *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *	struct *WorkingPair:
+ *		Returns WorkingPair-struct with compact memory layout. Returns NULL if
+ *		memory allocation fails.
  *
  * History:
  * --------
- *	01/06/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_dw_dp_pT(double p_Pa, double T_K, void *workingPair);
+WorkingPair *copy_workingPair_compact(const WorkingPair *workingPair);
 
 
 /*
- * ads_dw_dT_pT:
- * -------------
+ * malloc_aligned:
+ * ---------------
  *
- * Calculates derivative of equilibrium loading w with respect to temperature
- * T in kg/kg/K depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Auxiliary function to allocate memory that is aligned to a cache line.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ * 	size_t size:
+ *		Number of bytes that shall be allocated.
  *
  * Returns:
  * --------
- *	double:
- *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *	void *:
+ *		Returns pointer to allocated memory. Returns NULL if memory allocation
+ *		fails.
+ *
+ * Remarks:
+ * --------
+ *	Memory must be freed by free_aligned.
  *
  * History:
  * --------
- *	01/06/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_dw_dT_pT(double p_Pa, double T_K, void *workingPair);
+void *malloc_aligned(size_t size);
 
 
 /*
- * ads_dp_dw_wT:
+ * free_aligned:
  * -------------
  *
- * Calculates derivative of equilibrium pressure p with respect to loading
- * w in kgPa/kg depending on equilibrium loading w in kg/kg and equilibrium
- * temperature T in K.
+ * Auxiliary function to free memory that was allocated by malloc_aligned.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
+ * 	void *ptr:
+ *		Pointer to memory that shall be freed.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void free_aligned(void *ptr);
+
+/*
+ * enableWorkingPairSurrogate:
+ * ---------------------------
+ *
+ * Creates surrogates of the equilibrium functions of a working pair with two
+ * inputs (i.e., w_pT, p_wT, and T_pw for adsorption, X_pT, p_XT, and T_pX for
+ * conventional absorption, and x_pT, p_Tx, and T_px including vapor mole
+ * fractions for absorption based on mixing rules). Afterwards, these functions
+ * use the surrogates for states within the limits and evaluate the original
+ * equations otherwise. Limits whose minimum is not smaller than its maximum
+ * are read from the range of validity of the isotherm given by the database.
+ * If limits are not available or surrogates cannot be created, surrogates are
+ * disabled, function returns -1, and prints a warning.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Database:
+ *		Pointer of Database-struct (i.e., may be NULL if all limits are given).
+ *	double p_min_Pa:
+ *		Lower limit of pressure in Pa.
+ *	double p_max_Pa:
+ *		Upper limit of pressure in Pa.
+ *	double T_min_K:
+ *		Lower limit of temperature in K.
+ *	double T_max_K:
+ *		Upper limit of temperature in K.
+ *	double w_min:
+ *		Lower limit of loading in kg/kg, concentration in kg/kg, or liquid
+ *		mole fraction in mol/mol.
+ *	double w_max:
+ *		Upper limit of loading in kg/kg, concentration in kg/kg, or liquid
+ *		mole fraction in mol/mol.
+ *	double max_rel_error:
+ *		Maximal relative error of surrogates.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- *	double:
- *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *	int:
+ *		Returns 0 if surrogates are created and -1 otherwise.
+ *
+ * Remarks:
+ * --------
+ *	Surrogates are owned by the working pair and are neither shared with clones
+ *	nor serialized. They must not be enabled or disabled while other threads
+ *	use the working pair. Ranges of validity of absorption working pairs only
+ *	contain temperatures, thus pressure and composition limits must be given.
  *
  * History:
  * --------
- *	01/13/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_dp_dw_wT(double w_kgkg, double T_K, void *workingPair);
-
+DLL_API int enableWorkingPairSurrogate(Database *database, double p_min_Pa,
+	double p_max_Pa, double T_min_K, double T_max_K, double w_min,
+	double w_max, double max_rel_error, void *workingPair);
 
 /*
- * ads_dp_dT_wT:
- * -------------
+ * disableWorkingPairSurrogate:
+ * ----------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium loading w in kg/kg and equilibrium
- * temperature T in K.
+ * Deletes surrogates of the equilibrium functions of a working pair. Thus,
+ * equilibrium functions evaluate the original equations afterwards.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
- * Returns:
- * --------
- *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
- *
  * History:
  * --------
- *	01/13/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_dp_dT_wT(double w_kgkg, double T_K, void *workingPair);
-
+DLL_API void disableWorkingPairSurrogate(void *workingPair);
 
 /*
- * ads_piStar_pyxgTM:
+ * workingPair_exact:
  * ------------------
  *
- * Calculates reduced spreading pressure piStar in kg/mol depending on
- * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
- * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
- * activity coefficient of refrigerant in adsorbed phase, equilibrium
- * temperature T in K and molar mass of refrigerant M in kg/mol. The reduced
- * spreading pressure is defined as follows:
- *
- * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
- *		Integral_0^p0{w(p,T) / p * dp}
- *
- *	where p0 = p_total*y / (gamma*x)
+ * Auxiliary function to evaluate an original equilibrium function of a
+ * working pair with two inputs when creating surrogates. Depending on the type
+ * of the working pair, the function of adsorption, conventional absorption, or
+ * absorption based on mixing rules is evaluated.
  *
  * Parameters:
  * -----------
- *	double p_total_Pa:
- *		Total pressure of vapor phase in Pa.
- *	double y_molmol:
- *		Molar fraction of refrigerant in vapor phase in mol/mol.
- *	double x_molmol:
- *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
- *	double gamma:
- *		Activity coefficient of refrigerant in adsorbed phase.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double M_kgmol:
- *		Molar mass of refrigerant M in kg/mol.
+ *	double *ret_y_1_molmol:
+ *		Equilibrium mole fraction of first component (i.e., only for mixing
+ *		rules).
+ *	double *ret_y_2_molmol:
+ *		Equilibrium mole fraction of second component (i.e., only for mixing
+ *		rules).
+ *	int function:
+ *		Function (i.e., 0 for w_pT, 1 for p_wT, and 2 for T_pw).
+ *	double x:
+ *		First input (i.e., logarithm of pressure in Pa or loading).
+ *	double y:
+ *		Second input (i.e., temperature in K or loading).
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Reduced spreading pressure in kg/mol.
+ *		Value of original function.
  *
  * History:
  * --------
- *	01/13/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_piStar_pyxgTM(double p_total_Pa, double y_molmol,
-	double x_molmol, double gamma, double T_K, double M_kgmol,
-	void *workingPair);
+double workingPair_exact(double *ret_y_1_molmol, double *ret_y_2_molmol,
+	int function, double x, double y, const WorkingPair *workingPair);
 
 
 /*
- * ads_sur_w_pT:
- * -------------
+ * workingPair_surrogate_w_lnpT:
+ * -----------------------------
  *
- * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
- * p in Pa and equilibrium temperature T in K.
+ * Auxiliary function to calculate equilibrium loading, concentration, or
+ * liquid mole fraction depending on logarithm of pressure in Pa and
+ * temperature in K by the original equation when creating surrogates.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ *	double ln_p:
+ *		Logarithm of pressure in Pa.
  *	double T_K:
- *		Equilibrium temperature in K.
+ *		Temperature in K.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium loading in kg/kg.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach.
+ *		Equilibrium loading, concentration, or liquid mole fraction.
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_w_pT(double p_Pa, double T_K, void *workingPair);
+double workingPair_surrogate_w_lnpT(double ln_p, double T_K,
+	void *workingPair);
 
 
 /*
- * ads_sur_p_wT:
- * -------------
+ * workingPair_surrogate_p_wT:
+ * ---------------------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
- * in kg/kg and equilibrium temperature T in K.
+ * Auxiliary function to calculate equilibrium pressure in Pa depending on
+ * loading, concentration, or liquid mole fraction and temperature in K by the
+ * original equation when creating surrogates.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double w:
+ *		Loading, concentration, or liquid mole fraction.
  *	double T_K:
- *		Equilibrium temperature in K.
+ *		Temperature in K.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- * 	double:
+ *	double:
  *		Equilibrium pressure in Pa.
  *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach.
- *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_p_wT(double w_kgkg, double T_K, void *workingPair);
+double workingPair_surrogate_p_wT(double w, double T_K, void *workingPair);
 
 
 /*
- * ads_sur_T_pw:
- * -------------
+ * workingPair_surrogate_T_lnpw:
+ * -----------------------------
  *
- * Calculates equilibrium temperature in K depending on equilibrium pressure p
- * in Pa and equilibrium loading w in kg/kg.
+ * Auxiliary function to calculate equilibrium temperature in K depending on
+ * logarithm of pressure in Pa and loading, concentration, or liquid mole
+ * fraction by the original equation when creating surrogates.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double ln_p:
+ *		Logarithm of pressure in Pa.
+ *	double w:
+ *		Loading, concentration, or liquid mole fraction.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- * 	double:
+ *	double:
  *		Equilibrium temperature in K.
  *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach.
- *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_T_pw(double p_Pa, double w_kgkg, void *workingPair);
+double workingPair_surrogate_T_lnpw(double ln_p, double w, void *workingPair);
 
 
 /*
- * ads_sur_dw_dp_pT:
- * -----------------
+ * workingPair_surrogate_y_1_lnpT:
+ * -------------------------------
  *
- * Calculates derivative of equilibrium loading w with respect to pressure
- * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Auxiliary function to calculate vapor mole fraction of first component
+ * depending on logarithm of pressure in Pa and temperature in K by the
+ * original equation when creating surrogates.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ *	double ln_p:
+ *		Logarithm of pressure in Pa.
  *	double T_K:
- *		Equilibrium temperature in K.
+ *		Temperature in K.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach.
+ *		Vapor mole fraction of first component (i.e., -1 if original equation
+ *		fails).
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_dw_dp_pT(double p_Pa, double T_K, void *workingPair);
+double workingPair_surrogate_y_1_lnpT(double ln_p, double T_K,
+	void *workingPair);
 
 
 /*
- * ads_sur_dw_dT_pT:
- * -----------------
+ * workingPair_surrogate_y_1_wT:
+ * -----------------------------
  *
- * Calculates derivative of equilibrium loading w with respect to temperature
- * T in kg/kg/K depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Auxiliary function to calculate vapor mole fraction of first component
+ * depending on liquid mole fraction and temperature in K by the original
+ * equation when creating surrogates.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ *	double w:
+ *		Liquid mole fraction.
  *	double T_K:
- *		Equilibrium temperature in K.
+ *		Temperature in K.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach.
+ *		Vapor mole fraction of first component (i.e., -1 if original equation
+ *		fails).
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_dw_dT_pT(double p_Pa, double T_K, void *workingPair);
+double workingPair_surrogate_y_1_wT(double w, double T_K, void *workingPair);
 
 
 /*
- * ads_sur_dp_dw_wT:
- * -----------------
+ * workingPair_surrogate_y_1_lnpw:
+ * -------------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to loading
- * w in kgPa/kg depending on equilibrium loading w in kg/kg and equilibrium
- * temperature T in K.
+ * Auxiliary function to calculate vapor mole fraction of first component
+ * depending on logarithm of pressure in Pa and liquid mole fraction by the
+ * original equation when creating surrogates.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
+ *	double ln_p:
+ *		Logarithm of pressure in Pa.
+ *	double w:
+ *		Liquid mole fraction.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach.
+ *		Vapor mole fraction of first component (i.e., -1 if original equation
+ *		fails).
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_dp_dw_wT(double w_kgkg, double T_K, void *workingPair);
+double workingPair_surrogate_y_1_lnpw(double ln_p, double w,
+	void *workingPair);
 
 
 /*
- * ads_sur_dp_dT_wT:
- * -----------------
+ * workingPair_surrogate_y_2_lnpT:
+ * -------------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium loading w in kg/kg and equilibrium
- * temperature T in K.
+ * Auxiliary function to calculate vapor mole fraction of second component
+ * depending on logarithm of pressure in Pa and temperature in K by the
+ * original equation when creating surrogates.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double ln_p:
+ *		Logarithm of pressure in Pa.
  *	double T_K:
- *		Equilibrium temperature in K.
+ *		Temperature in K.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach.
+ *		Vapor mole fraction of second component (i.e., -1 if original equation
+ *		fails).
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_dp_dT_wT(double w_kgkg, double T_K, void *workingPair);
+double workingPair_surrogate_y_2_lnpT(double ln_p, double T_K,
+	void *workingPair);
 
 
 /*
- * ads_sur_piStar_pyxgTM:
- * ----------------------
- *
- * Calculates reduced spreading pressure piStar in kg/mol depending on
- * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
- * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
- * activity coefficient of refrigerant in adsorbed phase, equilibrium
- * temperature T in K and molar mass of refrigerant M in kg/mol. The reduced
- * spreading pressure is defined as follows:
- *
- * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
- *		Integral_0^p0{w(p,T) / p * dp}
+ * workingPair_surrogate_y_2_wT:
+ * -----------------------------
  *
- *	where p0 = p_total*y / (gamma*x)
+ * Auxiliary function to calculate vapor mole fraction of second component
+ * depending on liquid mole fraction and temperature in K by the original
+ * equation when creating surrogates.
  *
  * Parameters:
  * -----------
- *	double p_total_Pa:
- *		Total pressure of vapor phase in Pa.
- *	double y_molmol:
- *		Molar fraction of refrigerant in vapor phase in mol/mol.
- *	double x_molmol:
- *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
- *	double gamma:
- *		Activity coefficient of refrigerant in adsorbed phase.
+ *	double w:
+ *		Liquid mole fraction.
  *	double T_K:
- *		Equilibrium temperature in K.
- *	double M_kgmol:
- *		Molar mass of refrigerant M in kg/mol.
+ *		Temperature in K.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Reduced spreading pressure in kg/mol.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach.
+ *		Vapor mole fraction of second component (i.e., -1 if original equation
+ *		fails).
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_piStar_pyxgTM(double p_total_Pa, double y_molmol,
-	double x_molmol, double gamma, double T_K, double M_kgmol,
-	void *workingPair);
+double workingPair_surrogate_y_2_wT(double w, double T_K, void *workingPair);
 
 
 /*
- * ads_sur_w_pTpsat:
- * -----------------
+ * workingPair_surrogate_y_2_lnpw:
+ * -------------------------------
  *
- * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
- * p in Pa, equilibrium temperature T in K, and saturation pressure p_sat in Pa.
+ * Auxiliary function to calculate vapor mole fraction of second component
+ * depending on logarithm of pressure in Pa and liquid mole fraction by the
+ * original equation when creating surrogates.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ *	double ln_p:
+ *		Logarithm of pressure in Pa.
+ *	double w:
+ *		Liquid mole fraction.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium loading in kg/kg.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *		Vapor mole fraction of second component (i.e., -1 if original equation
+ *		fails).
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_w_pTpsat(double p_Pa, double T_K, double p_sat_Pa,
+double workingPair_surrogate_y_2_lnpw(double ln_p, double w,
 	void *workingPair);
 
 
 /*
- * ads_sur_p_wTpsat:
- * -----------------
+ * workingPair_limits:
+ * -------------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
- * in kg/kg, equilibrium temperature T in K, and saturation pressure p_sat in
- * Pa.
+ * Auxiliary function to check which equilibrium functions of a working pair
+ * with two inputs exist and to read missing limits of pressure, temperature,
+ * and loading from the range of validity of the isotherm given by the
+ * database. Limits whose minimum is not smaller than its maximum are missing.
+ * If no equilibrium function exists or limits are not available, function
+ * returns -1 and prints a warning.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ *	double *ret_limits:
+ *		Array containing minimum and maximum of pressure in Pa, temperature in
+ *		K, and loading. Missing limits are replaced.
+ *	int *ret_exists:
+ *		Array indicating whether functions w_pT, p_wT, and T_pw exist.
+ *	struct *Database:
+ *		Pointer of Database-struct (i.e., may be NULL if all limits are given).
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium pressure in Pa.
+ *	int:
+ *		Returns 0 if limits are valid and -1 otherwise.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	Functions based on activity coefficients have more than two inputs and do
+ *	not exist in this sense.
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_p_wTpsat(double w_kgkg, double T_K, double p_sat_Pa,
-	void *workingPair);
+int workingPair_limits(double *ret_limits, int *ret_exists,
+	Database *database, const WorkingPair *workingPair);
 
 
 /*
- * ads_sur_T_pwpsat:
- * -----------------
+ * enableWorkingPairTable:
+ * -----------------------
  *
- * Calculates equilibrium temperature in K depending on equilibrium pressure p
- * in Pa, equilibrium loading w in kg/kg, and saturation pressure p_sat in Pa.
+ * Creates spline tables of the equilibrium functions of a working pair with
+ * two inputs (i.e., w_pT, p_wT, and T_pw for adsorption, X_pT, p_XT, and T_pX
+ * for conventional absorption, and x_pT, p_Tx, and T_px for absorption based
+ * on mixing rules). Values and partial derivatives at the nodes are calculated
+ * by the original equations and their analytical derivatives. Thus, the
+ * functions tab_* are continuously differentiable and consistent with their
+ * derivatives afterwards. Limits whose minimum is not smaller than its maximum
+ * are read from the range of validity of the isotherm given by the database.
+ * If limits are not available, the lower limit of loading is not positive, or
+ * tables cannot be created, tables are disabled, function returns -1, and
+ * prints a warning.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ * 	struct *Database:
+ *		Pointer of Database-struct (i.e., may be NULL if all limits are given).
+ *	double p_min_Pa:
+ *		Lower limit of pressure in Pa.
+ *	double p_max_Pa:
+ *		Upper limit of pressure in Pa.
+ *	double T_min_K:
+ *		Lower limit of temperature in K.
+ *	double T_max_K:
+ *		Upper limit of temperature in K.
+ *	double w_min:
+ *		Lower limit of loading in kg/kg, concentration in kg/kg, or liquid
+ *		mole fraction in mol/mol.
+ *	double w_max:
+ *		Upper limit of loading in kg/kg, concentration in kg/kg, or liquid
+ *		mole fraction in mol/mol.
+ *	int no_nodes:
+ *		Number of nodes per variable.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium temperature in K.
+ *	int:
+ *		Returns 0 if tables are created and -1 otherwise.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
- *	Uses internal equation of states to calculate vapor pressure and derivative
- *	of vapor pressure wrt. temperature. If equation of state is not implemented
- *	for refrigerant, function returns -1 and throws warning. If user want to use
- *	his own equation of state, this function cannot be used and determination of
- *	root to calculate T must be implemented by user.
+ *	Tables are owned by the working pair and are neither shared with clones
+ *	nor serialized. They must not be enabled or disabled while other threads
+ *	use the working pair. Nodes where the original equations or their
+ *	derivatives fail or are inconsistent with the inverse functions are
+ *	invalid, and cells containing invalid nodes are evaluated by the original
+ *	equations.
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_T_pwpsat(double p_Pa, double w_kgkg, double p_sat_Pa,
-	void *workingPair);
+DLL_API int enableWorkingPairTable(Database *database, double p_min_Pa,
+	double p_max_Pa, double T_min_K, double T_max_K, double w_min,
+	double w_max, int no_nodes, void *workingPair);
 
 
 /*
- * ads_sur_dw_dp_pTpsat:
- * ---------------------
+ * disableWorkingPairTable:
+ * ------------------------
  *
- * Calculates derivative of equilibrium loading w with respect to pressure
- * p in kg/kg/Pa depending on equilibrium pressure p in Pa, equilibrium
- * temperature T in K, and saturation pressure p_sat in Pa.
+ * Deletes spline tables of the equilibrium functions of a working pair. Thus,
+ * the functions tab_* evaluate the original equations afterwards.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
- * Returns:
+ * History:
  * --------
- *	double:
- *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *	10/18/2026, by agent:
+ *		First implementation.
  *
- * Remarks:
+ */
+DLL_API void disableWorkingPairTable(void *workingPair);
+
+
+/*
+ * exportWorkingPairTable:
+ * -----------------------
+ *
+ * Writes spline tables of a working pair to a JSON-file. Besides the names
+ * defining the working pair and the limits of the tables, the file contains
+ * for each table the grid and the values, partial derivatives, mixed partial
+ * derivatives, and validity of all nodes. Thus, tables can be loaded by
+ * loadWorkingPairTable without evaluating the original equations again. If
+ * tables are not enabled or file cannot be written, function returns -1 and
+ * prints a warning.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path_table:
+ *		Path to JSON-file that shall be written.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	int:
+ *		Returns 0 if file is written and -1 otherwise.
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_dw_dp_pTpsat(double p_Pa, double T_K, double p_sat_Pa,
+DLL_API int exportWorkingPairTable(const char *path_table,
 	void *workingPair);
 
 
 /*
- * ads_sur_dw_dT_pTpsat:
+ * loadWorkingPairTable:
  * ---------------------
  *
- * Calculates derivative of equilibrium loading w with respect to temperature
- * T in kg/kg/K depending on equilibrium pressure p in Pa, equilibrium
- * temperature T in K, saturation pressure p_sat in Pa, and derivative of
- * saturation pressure wrt. temperature dp_sat_dT in Pa/K.
+ * Reads spline tables of a working pair from a JSON-file that is written by
+ * exportWorkingPairTable. Afterwards, the functions tab_* use these tables.
+ * If file cannot be read, belongs to another working pair, or contains invalid
+ * tables, tables are disabled, function returns -1, and prints a warning.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
- * 	double dp_sat_dT_PaK:
- *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ *	const char *path_table:
+ *		Path to JSON-file that shall be read.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- *	double:
- *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	int:
+ *		Returns 0 if tables are loaded and -1 otherwise.
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_dw_dT_pTpsat(double p_Pa, double T_K, double p_sat_Pa,
-	double dp_sat_dT_PaK, void *workingPair);
+DLL_API int loadWorkingPairTable(const char *path_table, void *workingPair);
 
 
 /*
- * ads_sur_dp_dw_wTpsat:
- * ---------------------
+ * newWorkingPairWithTable:
+ * ------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to loading
- * w in kgPa/kg depending on equilibrium loading w in kg/kg, equilibrium
- * temperature T in K, and saturation pressure p_sat in Pa.
+ * Initialization function to create a new WorkingPair-struct like
+ * newWorkingPair and to load spline tables of the working pair from a
+ * JSON-file written by exportWorkingPairTable afterwards. Thus, simulation
+ * tools that can only call a constructor (e.g., external objects of Modelica)
+ * can use the functions tab_* with tables. If path to tables is empty, no
+ * tables are loaded. If tables cannot be loaded, function prints a warning
+ * and the functions tab_* evaluate the original equations.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *	const char *path_table:
+ *		Path to JSON-file containing tables (i.e., may be empty).
  *
  * Returns:
  * --------
- *	double:
- *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	struct *WorkingPair:
+ *		Returns malloc-ed WorkingPair-struct containing all information required
+ *		to calculate the resorption equilibrium of the working working.
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_dp_dw_wTpsat(double w_kgkg, double T_K, double p_sat_Pa,
-	void *workingPair);
+DLL_API WorkingPair *newWorkingPairWithTable(const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol, const char *path_table);
 
 
 /*
- * ads_sur_dp_dT_wTpsat:
+ * workingPair_partials:
  * ---------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium loading w in kg/kg, equilibrium
- * temperature T in K, saturation pressure p_sat in Pa, and derivative of
- * saturation pressure wrt. temperature dp_sat_dT in Pa/K.
+ * Auxiliary function to calculate partial derivatives of an equilibrium
+ * function of a working pair with two inputs by the analytical derivatives of
+ * the original equations. Derivatives of inverse functions (e.g., T_pw of
+ * adsorption) are calculated by the implicit function theorem. If required
+ * derivatives do not exist or are not finite, function returns -1.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double *ret_df_dx:
+ *		Partial derivative wrt. first input.
+ *	double *ret_df_dy:
+ *		Partial derivative wrt. second input.
+ *	int function:
+ *		Function (i.e., 0 for w_pT, 1 for p_wT, and 2 for T_pw).
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
- * 	double dp_sat_dT_PaK:
- *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ * 	double w:
+ *		Equilibrium loading, concentration, or liquid mole fraction.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *	int:
+ *		Returns 0 if derivatives are calculated and -1 otherwise.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	Loading is only required for mixing rules and temperature is only required
+ *	for T_pw. Thus, other inputs can be arbitrary.
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_dp_dT_wTpsat(double w_kgkg, double T_K, double p_sat_Pa,
-	double dp_sat_dT_PaK, void *workingPair);
+int workingPair_partials(double *ret_df_dx, double *ret_df_dy, int function,
+	double p_Pa, double T_K, double w, const WorkingPair *workingPair);
 
 
 /*
- * ads_sur_piStar_pyxgTpsatM:
- * --------------------------
- *
- * Calculates reduced spreading pressure piStar in kg/mol depending on
- * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
- * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
- * activity coefficient of refrigerant in adsorbed phase, equilibrium
- * temperature T in K, saturation pressure p_sat in Pa, and molar mass of
- * refrigerant M in kg/mol. The reduced spreading pressure is defined as
- * follows:
- *
- * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
- *		Integral_0^p0{w(p,T) / p * dp}
+ * workingPair_derivatives:
+ * ------------------------
  *
- *	where p0 = p_total*y / (gamma*x)
+ * Auxiliary function to calculate partial derivatives of an equilibrium
+ * function of a working pair with two inputs by the analytical derivatives of
+ * the original equations. Variables and value are given in the space of the
+ * tables (i.e., logarithms of pressure and loading). If required derivatives
+ * do not exist or are not finite, function returns -1.
  *
  * Parameters:
  * -----------
- *	double p_total_Pa:
- *		Total pressure of vapor phase in Pa.
- *	double y_molmol:
- *		Molar fraction of refrigerant in vapor phase in mol/mol.
- *	double x_molmol:
- *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
- *	double gamma:
- *		Activity coefficient of refrigerant in adsorbed phase.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
- *	double M_kgmol:
- *		Molar mass of refrigerant M in kg/mol.
+ *	double *ret_df_dx:
+ *		Partial derivative wrt. first input.
+ *	double *ret_df_dy:
+ *		Partial derivative wrt. second input.
+ *	int function:
+ *		Function (i.e., 0 for w_pT, 1 for p_wT, and 2 for T_pw).
+ *	double x:
+ *		First input (i.e., logarithm of pressure in Pa or of loading).
+ *	double y:
+ *		Second input (i.e., temperature in K or logarithm of loading).
+ *	double value:
+ *		Value of function (i.e., logarithm of loading, logarithm of pressure
+ *		in Pa, or temperature in K).
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- *	double:
- *		Reduced spreading pressure in kg/mol.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	int:
+ *		Returns 0 if derivatives are calculated and -1 otherwise.
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_piStar_pyxgTpsatM(double p_total_Pa, double y_molmol,
-	double x_molmol, double gamma, double T_K, double p_sat_Pa, double M_kgmol,
-	void *workingPair);
+int workingPair_derivatives(double *ret_df_dx, double *ret_df_dy,
+	int function, double x, double y, double value,
+	const WorkingPair *workingPair);
 
 
 /*
- * ads_vol_W_ARho:
- * ---------------
+ * workingPair_table:
+ * ------------------
  *
- * Calculates equilibrium volumetric loading W in m³/kg depending on equilibrium
- * adsorption potential A in J/mol and saturated liquid density of adsorpt rho_l
- * in kg/m3.
+ * Auxiliary function to evaluate an equilibrium function of a working pair
+ * and its partial derivatives by the spline tables. If tables are disabled or
+ * state is outside of the tables or within a cell containing invalid nodes,
+ * the original equations and their analytical derivatives are evaluated.
  *
  * Parameters:
  * -----------
- * 	double A_Jmol:
- *		Equilibrium adsorption potential A in J/mol.
- * 	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ *	double *ret_df_dx:
+ *		Partial derivative wrt. first input.
+ *	double *ret_df_dy:
+ *		Partial derivative wrt. second input.
+ *	int function:
+ *		Function (i.e., 0 for w_pT, 1 for p_wT, and 2 for T_pw).
+ *	double x:
+ *		First input (i.e., pressure in Pa or loading).
+ *	double y:
+ *		Second input (i.e., temperature in K or loading).
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium volumetric loading W in m³/kg.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
- *	Saturated liquid density of adsorpt is required to calculate volumetric
- *	loading from characteristic curve in m3/kg when coefficients would directly
- *	return loading w in kg/kg. Therefore, function checks unit of coefficients
- *	by checking isotherm coefficients.
+ *		Value of function or -1 if function or its derivatives fail.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_W_ARho(double A_Jmol, double rho_l_kgm3,
-	void *workingPair);
+double workingPair_table(double *ret_df_dx, double *ret_df_dy, int function,
+	double x, double y, const WorkingPair *workingPair);
 
 
 /*
- * ads_vol_A_WRho:
- * ---------------
+ * workingPair_total_derivative:
+ * -----------------------------
  *
- * Calculates equilibrium adsorption potential A in J/mol depending on
- * equilibrium volumetric loading W in m³/kg and saturated liquid density of
- * adsorpt rho_l in kg/m3.
+ * Auxiliary function to calculate total derivative of an equilibrium function
+ * of a working pair with two inputs depending on both inputs and their
+ * derivatives by the analytical partial derivatives of the original equations.
+ * The original equation is only evaluated if the partial derivatives depend on
+ * its value (i.e., T_pw or w_pT of mixing rules).
  *
  * Parameters:
  * -----------
- * 	double W_m3kg:
- *		Equilibrium volumetric loading W in m³/kg.
- * 	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ *	int function:
+ *		Function (i.e., 0 for w_pT, 1 for p_wT, and 2 for T_pw).
+ *	double x:
+ *		First input (i.e., pressure in Pa or loading).
+ *	double y:
+ *		Second input (i.e., temperature in K or loading).
+ *	double x_der:
+ *		Derivative of first input.
+ *	double y_der:
+ *		Derivative of second input.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium adsorption potential A in J/mol.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
- *	Saturated liquid density of adsorpt is required to calculate volumetric
- *	loading from characteristic curve in m3/kg when coefficients would directly
- *	return loading w in kg/kg.
+ *		Total derivative of function or -1 if function or its derivatives
+ *		fail.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_A_WRho(double W_m3kg, double rho_l_kgm3,
-	void *workingPair);
+double workingPair_total_derivative(int function, double x, double y,
+	double x_der, double y_der, const WorkingPair *workingPair);
 
 
 /*
- * ads_vol_w_pTpsatRho:
- * --------------------
+ * workingPair_derivative_kernel:
+ * ------------------------------
  *
- * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
- * p in Pa, equilibrium temperature T in K, saturation pressure p_Sat in Pa and
- * saturated liquid density of adsorpt rho in kg/m³.
+ * Auxiliary function to evaluate analytical derivative of an equilibrium
+ * function of a working pair. For mixing rules, only derivatives of pressure
+ * exist. Function does not check if derivative exists.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt in kg/m³.
+ *	int derivative:
+ *		Derivative (i.e., 0 for dw_dp_pT, 1 for dw_dT_pT, 2 for dp_dw_wT, and
+ *		3 for dp_dT_wT).
+ *	double x:
+ *		First input (i.e., pressure in Pa or loading).
+ *	double y:
+ *		Second input (i.e., temperature in K).
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium loading in kg/kg.
+ *		Derivative.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_w_pTpsatRho(double p_Pa, double T_K, double p_sat_Pa,
-	double rho_kgm3, void *workingPair);
+double workingPair_derivative_kernel(int derivative, double x, double y,
+	const WorkingPair *workingPair);
 
 
 /*
- * ads_vol_p_wTpsatRho:
- * --------------------
+ * workingPair_second_derivative:
+ * ------------------------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium loading w in
- * kg/kg, equilibrium temperature T in K, saturation pressure p_Sat in Pa and
- * density of adsorpt rho in kg/m³.
+ * Auxiliary function to calculate total derivative of an analytical
+ * derivative of an equilibrium function of a working pair depending on both
+ * inputs and their derivatives. Partial derivatives of analytical derivative
+ * are calculated by the symmetric derivative using a relative change of
+ * WORKINGPAIR_DERIVATIVE_STEP or, for mixing rules whose derivatives are
+ * already numerical, of WORKINGPAIR_DERIVATIVE_STEP_MIX. Inputs whose
+ * derivatives are zero are not changed.
  *
  * Parameters:
  * -----------
- * 	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
+ *	int derivative:
+ *		Derivative (i.e., 0 for dw_dp_pT, 1 for dw_dT_pT, 2 for dp_dw_wT, and
+ *		3 for dp_dT_wT).
+ *	double x:
+ *		First input (i.e., pressure in Pa or loading).
+ *	double y:
+ *		Second input (i.e., temperature in K).
+ *	double x_der:
+ *		Derivative of first input.
+ *	double y_der:
+ *		Derivative of second input.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure in Pa.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *		Total derivative of analytical derivative or -1 if derivative is not
+ *		finite.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_p_wTpsatRho(double w_kgkg, double T_K, double p_sat_Pa,
-	double rho_kgm3, void *workingPair);
+double workingPair_second_derivative(int derivative, double x, double y,
+	double x_der, double y_der, const WorkingPair *workingPair);
 
 
 /*
- * ads_vol_T_pwpsatRho:
- * --------------------
+ * direct_workingPair:
+ * -------------------
  *
- * Calculates equilibrium temperature T in K depending on equilibrium pressure
- * in Pa, equilibrium loading w in kg/kg, saturation pressure p_Sat in Pa and
- * density of adsorpt rho in kg/m³.
+ * Auxiliary function returning working pair for functions working without
+ * WorkingPair-struct (i.e., direct_*-functions). If caching is enabled, the
+ * working pair is searched in the cache by its arguments and only created if
+ * it is not cached yet. Thus, the database is only read and parsed once per
+ * working pair instead of once per call. Otherwise, a new working pair is
+ * created.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure in Pa.
- * 	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
- *	double:
- *		Equilibrium temperature in K.
+ *	struct *WorkingPair:
+ *		Working pair or NULL if working pair cannot be created. Working pair
+ *		must be released by direct_release.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
- *	Uses internal equations of states to calculate vapor pressure, saturated
- *	liquid density of adsorpt, derivative of vapor pressure wrt. temperature
- *	and derivative of saturated liquid density of adsorpt wrt. temperature. If
- *	equation of states are not implemented for refrigerant, function returns -1
- *  and throws warning. If user want to use his own equation of states, this
- *  function cannot be used and determination of root to calculate T must
- *  be implemented by user.
+ *	Working pairs that cannot be created are not cached. Thus, warnings are
+ *	still printed for each call. Working pairs are created outside of the
+ *	spin lock. If two threads create the same working pair at the same time,
+ *	the working pair of the second thread is deleted.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_T_pwpsatRho(double p_Pa, double w_kgkg, double p_sat_Pa,
-	double rho_kgm3, void *workingPair);
+WorkingPair *direct_workingPair(const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * ads_vol_dW_dA_ARho:
- * -------------------
+ * direct_release:
+ * ---------------
  *
- * Calculates derivative of equilibrium volumetric loading dW_dA in m³mol/kg/J
- * depending on equilibrium adsorption potential A in J/mol and saturated liquid
- * density of adsorpt rho_l in kg/m3.
+ * Auxiliary function releasing working pair returned by direct_workingPair to
+ * current thread: Working pair is only deleted if it is not cached.
  *
  * Parameters:
  * -----------
- * 	double A_Jmol:
- *		Equilibrium adsorption potential A in mol/J.
- * 	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt rho_l in kg/m3.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
- *
- * Returns:
- * --------
- *	double:
- *		Derivative of volumetric loading wrt. adsorption potential in
- *		m³mol/kg/J.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
- *	Saturated liquid density of adsorpt is required to calculate volumetric
- *	loading from characteristic curve in m3/kg when coefficients would directly
- *	return loading w in kg/kg.
+ *	struct *WorkingPair:
+ *		Working pair returned by direct_workingPair.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_dW_dA_ARho(double A_Jmol, double rho_l_kgm3,
-	void *workingPair);
+void direct_release(WorkingPair *workingPair);
 
 
 /*
- * ads_vol_dA_dW_WRho:
- * -------------------
+ * setDirectWorkingPairCache:
+ * --------------------------
  *
- * Calculates derivative of equilibrium adsorption potential dA_dW in kgJ/mol/m³
- * depending on equilibrium volumetric loading W in m³/kg and saturated liquid
- * density of adsorpt rho_l in kg/m3.
+ * Enables or disables caching of working pairs of functions working without
+ * WorkingPair-struct (i.e., direct_*-functions). Caching is enabled by
+ * default. If disabled, each call reads and parses the database again (e.g.,
+ * to benchmark direct function calls of Modelica with and without cache).
  *
  * Parameters:
  * -----------
- * 	double W_m3kg:
- *		Equilibrium volumetric loading W in m³/kg.
- * 	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt rho_l in kg/m3.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
- *
- * Returns:
- * --------
- *	double:
- *		Derivative of adsorption potential wrt. volumetric loading in
- *		kgJ/mol/m³.
+ *	int cache:
+ *		Flag indicating if working pairs are cached (i.e., 1) or not (i.e., 0).
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
- *	Saturated liquid density of adsorpt is required to calculate volumetric
- *	loading from characteristic curve in m3/kg when coefficients would directly
- *	return loading w in kg/kg.
+ *	Working pairs that are already cached are kept. Call
+ *	clearDirectWorkingPairs to delete them.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_dA_dW_WRho(double W_m3kg, double rho_l_kgm3,
-	void *workingPair);
+DLL_API void setDirectWorkingPairCache(int cache);
 
 
 /*
- * ads_vol_dw_dp_pTpsatRho:
+ * clearDirectWorkingPairs:
  * ------------------------
  *
- * Calculates derivative of equilibrium loading dw_dp with respect to pressure
- * in kg/kg/Pa depending on equilibrium pressure p in Pa, equilibrium
- * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
- * rho in kg/m³.
- *
- * Parameters:
- * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
- *
- * Returns:
- * --------
- *	double:
- *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ * Deletes all working pairs cached for functions working without
+ * WorkingPair-struct (e.g., after database has been changed).
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *	Function must not be called while other threads execute direct_*-
+ *	functions.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_dw_dp_pTpsatRho(double p_Pa, double T_K, double p_sat_Pa,
-	double rho_kgm3, void *workingPair);
+DLL_API void clearDirectWorkingPairs(void);
 
 
 /*
- * ads_vol_dw_dT_pTpsatRho:
- * ------------------------
+ * warning_struct:
+ * ---------------
  *
- * Calculates derivative of equilibrium loading dw_dp with respect to
- * temperature in kg/kg/K depending on equilibrium pressure p in Pa, equilibrium
- * temperature T in K, saturation pressure p_Sat in Pa, density of adsorpt
- * rho in kg/m³, derivative of saturation pressure with respect to temperature
- * dp_sat_dT in Pa/K and derivative of density of adsorpt with respect to
- * temperature drho_dT in kg/m³/K.
+ * Auxiliary function to throw warning if some struct (e.g. workingPair or
+ * Adsorption) does not exist.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
- * 	double dp_sat_dT_PaK:
- *		Derivative of saturation pressure wrt. temperature in Pa/K.
- *	double drho_dT_kgm3K:
- *		Derivative of density of adsorpt wrt. temperature in kg/m³/K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ * 	const char *name_struct:
+ *		Name of struct that does not exist.
+ * 	const char *name_function:
+ *		Name of function that does not exist.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *		Returns -1 to indicate error.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	27/03/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_dw_dT_pTpsatRho(double p_Pa, double T_K, double p_sat_Pa,
-	double rho_kgm3, double dp_sat_dT_PaK, double drho_dT_kgm3K,
-	void *workingPair);
+double warning_struct(const char *name_struct, const char *name_function);
 
 
 /*
- * ads_vol_dp_dw_wTpsatRho:
- * ------------------------
+ * warning_function:
+ * -----------------
  *
- * Calculates derivative of equilibrium pressure p with respect to loading
- * w in kgPa/kg depending on equilibrium loading w in kg/kg, equilibrium
- * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
- * rho in kg/m³.
+ * Auxiliary function to throw warning if some parameter is missing.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ * 	const char *name_parameter:
+ *		Name of parameter that is missing.
+ * 	const char *name_wpair_function:
+ *		Name of working pair function that does not exist.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *		Returns -1 to indicate error.
  *
  * History:
  * --------
- *	01/13/2020, by Mirko Engelpracht:
+ *	27/03/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_dp_dw_wTpsatRho(double w_kgkg, double T_K,
-	double p_sat_Pa, double rho_kgm3, void *workingPair);
-
-
-/*
- * ads_vol_dp_dT_wTpsatRho:
- * ------------------------
- *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium loading w in kg/kg, equilibrium
- * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
- * rho in kg/m³, derivative of saturation pressure with respect to temperature
- * dp_sat_dT in Pa/K and derivative of density of adsorpt with respect to
- * temperature drho_dT in kg/m³/K.
- *
- * Parameters:
- * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
- * 	double dp_sat_dT_PaK:
- *		Derivative of saturation pressure wrt. temperature in Pa/K.
- *	double drho_dT_kgm3K:
- *		Derivative of density of adsorpt wrt. temperature in kg/m³/K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
- *
- * Returns:
- * --------
- *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
- *
- * History:
- * --------
- *	01/13/2020, by Mirko Engelpracht:
- *		First implementation.
- *
- */
-DLL_API double ads_vol_dp_dT_wTpsatRho(double w_kgkg, double T_K,
-	double p_sat_Pa, double rho_kgm3, double dp_sat_dT_PaK,
-	double drho_dT_kgm3K, void *workingPair);
+double warning_parameter(const char *name_parameter,
+	const char *name_wpair_function);
 
 
 /*
- * ads_vol_piStar_pyxgTpsatRhoM:
- * -----------------------------
- *
- * Calculates reduced spreading pressure in kg/mol depending on equilibrium
- * pressure p in Pa, molar fraction of refrigerant in vapor phase in mol/mol,
- * molar fraction of refrigerant in adsorbed phase in mol/mol, activity
- * coefficient of refrigerant in adsorbed phase, equilibrium temperature T in K,
- * saturation pressure p_Sat in Pa and density of adsorpt rho in kg/m³ and molar
- * mass of refrigerant M in kg/mol. The reduced spreading pressure is defined as
- * follows:
- *
- * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
- *		Integral_0^p0{w(p,T) / p * dp}
+ * warning_function:
+ * -----------------
  *
- *	where p0 = p_total*y / (gamma*x)
+ * Auxiliary function to throw warning if some function does not exist.
  *
  * Parameters:
  * -----------
- *	double p_total_Pa:
- *		Total pressure of vapor phase in Pa.
- *	double y_molmol:
- *		Molar fraction of refrigerant in vapor phase in mol/mol.
- *	double x_molmol:
- *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
- *	double gamma:
- *		Activity coefficient of refrigerant in adsorbed phase.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
- *	double M_kgmol:
- *		Molar mass of refrigerant M in kg/mol.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ * 	const char *name_iso_function:
+ *		Name of isotherm function that does not exist.
+ * 	const char *name_wpair_function:
+ *		Name of working pair function that does not exist.
  *
  * Returns:
  * --------
  *	double:
- *		Reduced spreading pressure in kg/mol.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *		Returns -1 to indicate error.
  *
  * History:
  * --------
- *	01/13/2020, by Mirko Engelpracht:
+ *	27/03/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_piStar_pyxgTpsatRhoM(double p_total_Pa, double y_molmol,
-	double x_molmol, double gamma, double T_K, double p_sat_Pa,
-	double rho_kgm3, double M_kgmol, void *workingPair);
+double warning_function(const char *name_function,
+	const char *name_wpair_function);
 
 
 ////////////////////////////////////////////////////////////////////////////
-// Definition of function prototypes regarding absorption working w struct//
+// Definition of function prototypes regarding adsorption working w struct//
 ////////////////////////////////////////////////////////////////////////////
 /*
- * abs_con_X_pT:
- * -------------
+ * ads_w_pT:
+ * ---------
  *
- * Calculates equilibrium concentration X in kg/kg depending on equilibrium
- * pressure p in Pa and equilibrium temperature T in K.
+ * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
+ * p in Pa and equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
@@ -1706,33 +1843,28 @@ DLL_API double ads_vol_piStar_pyxgTpsatRhoM(double p_total_Pa, double y_molmol,
  * Returns:
  * --------
  *	double:
- *		Equilibrium concentration in kg/kg.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *		Equilibrium loading in kg/kg.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	01/06/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double abs_con_X_pT(double p_Pa, double T_K, void *workingPair);
+DLL_API double ads_w_pT(double p_Pa, double T_K, void *workingPair);
 
 
 /*
- * abs_con_p_XT:
- * -------------
+ * ads_p_wT:
+ * ---------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium
- * concentration X in kg/kg and equilibrium temperature T in K.
+ * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
+ * in kg/kg and equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
- *	double X_kgkg:
- *		Equilibrium concentration in kg/kg.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
  * 	struct *WorkingPair:
@@ -1743,33 +1875,28 @@ DLL_API double abs_con_X_pT(double p_Pa, double T_K, void *workingPair);
  * 	double:
  *		Equilibrium pressure in Pa.
  *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
- *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	01/06/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double abs_con_p_XT(double X_kgkg, double T_K, void *workingPair);
+DLL_API double ads_p_wT(double w_kgkg, double T_K, void *workingPair);
 
 
 /*
- * abs_con_T_pX:
- * -------------
+ * ads_T_pw:
+ * ---------
  *
  * Calculates equilibrium temperature in K depending on equilibrium pressure p
- * in Pa and equilibrium concentration X in kg/kg.
+ * in Pa and equilibrium loading w in kg/kg.
  *
  * Parameters:
  * -----------
  *	double p_Pa:
  *		Equilibrium pressure in Pa.
- *	double X_kgkg:
- *		Equilibrium concentration in kg/kg.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
@@ -1780,23 +1907,26 @@ DLL_API double abs_con_p_XT(double X_kgkg, double T_K, void *workingPair);
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	Function uses equation of states implemented for calculation of vapor
+ *	pressure, saturated liquid density, derivative of vapor pressure wrt.
+ *	temperature, and derivative of saturated liquid density wrt. temperature
+ *	when isotherm of working pair is based on volumetric approach (e.g.
+ *	Dubinin theory).
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	01/06/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double abs_con_T_pX(double p_Pa, double X_kgkg, void *workingPair);
+DLL_API double ads_T_pw(double p_Pa, double w_kgkg, void *workingPair);
 
 
 /*
- * abs_con_dX_dp_pT:
- * -----------------
+ * ads_dw_dp_pT:
+ * -------------
  *
- * Calculates derivative of equilibrium concentration X with respect to pressure
+ * Calculates derivative of equilibrium loading w with respect to pressure
  * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
  * temperature T in K.
  *
@@ -1812,29 +1942,24 @@ DLL_API double abs_con_T_pX(double p_Pa, double X_kgkg, void *workingPair);
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium concentration wrt. pressure in kg/kg/Pa.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	01/06/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double abs_con_dX_dp_pT(double p_Pa, double T_K, void *workingPair);
+DLL_API double ads_dw_dp_pT(double p_Pa, double T_K, void *workingPair);
 
 
 /*
- * abs_con_dX_dT_pT:
- * -----------------
+ * ads_dw_dT_pT:
+ * -------------
  *
- * Calculates derivative of equilibrium concentration X with respect to
- * temperature T in kg/kg/K depending on equilibrium pressure p in Pa and
- * equilibrium temperature T in K.
+ * Calculates derivative of equilibrium loading w with respect to temperature
+ * T in kg/kg/K depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
@@ -1848,34 +1973,29 @@ DLL_API double abs_con_dX_dp_pT(double p_Pa, double T_K, void *workingPair);
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium concentration wrt. temperature in kg/kg/K.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	01/06/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double abs_con_dX_dT_pT(double p_Pa, double T_K, void *workingPair);
+DLL_API double ads_dw_dT_pT(double p_Pa, double T_K, void *workingPair);
 
 
 /*
- * abs_con_dp_dX_XT:
- * -----------------
+ * ads_dp_dw_wT:
+ * -------------
  *
- * Calculates derivative of equilibrium pressure p with respect to concentration
- * w in kgPa/kg depending on equilibrium concentration X in kg/kg and
- * equilibrium temperature T in K.
+ * Calculates derivative of equilibrium pressure p with respect to loading
+ * w in kgPa/kg depending on equilibrium loading w in kg/kg and equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
- *	double X_kgkg:
- *		Equilibrium concentration in kg/kg.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
  * 	struct *WorkingPair:
@@ -1884,34 +2004,29 @@ DLL_API double abs_con_dX_dT_pT(double p_Pa, double T_K, void *workingPair);
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. concentration in Pakg/kg.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	01/13/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double abs_con_dp_dX_XT(double X_kgkg, double T_K, void *workingPair);
+DLL_API double ads_dp_dw_wT(double w_kgkg, double T_K, void *workingPair);
 
 
 /*
- * abs_con_dp_dT_XT:
- * -----------------
+ * ads_dp_dT_wT:
+ * -------------
  *
  * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium concentration X in kg/kg and
- * equilibrium temperature T in K.
+ * T in kg/kg/K depending on equilibrium loading w in kg/kg and equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
- *	double X_kgkg:
- *		Equilibrium concentration in kg/kg.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
  * 	struct *WorkingPair:
@@ -1922,462 +2037,513 @@ DLL_API double abs_con_dp_dX_XT(double X_kgkg, double T_K, void *workingPair);
  *	double:
  *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
  *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
- *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	01/13/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double abs_con_dp_dT_XT(double X_kgkg, double T_K, void *workingPair);
+DLL_API double ads_dp_dT_wT(double w_kgkg, double T_K, void *workingPair);
 
 
 /*
- * abs_act_g_Txv1v2:
- * -----------------
+ * ads_w_pT_der:
+ * -------------
  *
- * Calculates activity coefficient of first component depending on temperature
- * T_K in K, mole fraction in liquid phase x_molmol in mol/mol, molar volume of
- * first component in m³/mol, and molar volume of second component in m³/mol.
+ * Calculates total derivative of equilibrium loading w in kg/kg/s depending on
+ * equilibrium pressure p in Pa, equilibrium temperature T in K, and their
+ * derivatives by the analytical partial derivatives of the isotherm. Thus, the
+ * derivative can be used for derivative annotations of Modelica.
  *
  * Parameters:
  * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Activity coefficient of first component.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
+ *		Derivative of equilibrium loading in kg/kg/s.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double abs_act_g_Txv1v2(double T_K, double x_molmol, double v1_m3mol,
-	double v2_m3mol, void *workingPair);
+DLL_API double ads_w_pT_der(double p_Pa, double T_K, double p_der_Pas,
+	double T_der_Ks, void *workingPair);
 
 
 /*
- * abs_act_p_Txv1v2psat:
- * ---------------------
+ * ads_p_wT_der:
+ * -------------
  *
- * Calculates equilibrium pressure p_Pa in Pa of first component depending on
- * temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
- * molar volume of first component in m³/mol, molar volume of second component
- * in m³/mol,and saturation pressure of first component p_sat_Pa in Pa.
+ * Calculates total derivative of equilibrium pressure p in Pa/s depending on
+ * equilibrium loading w in kg/kg, equilibrium temperature T in K, and their
+ * derivatives by the analytical partial derivatives of the isotherm. Thus, the
+ * derivative can be used for derivative annotations of Modelica.
  *
  * Parameters:
  * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
- *	double p_sat_Pa:
- *		Saturation pressure of first component in Pa.
+ *	double w_der_kgkgs:
+ *		Derivative of equilibrium loading in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure p_Pa in Pa.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
+ *		Derivative of equilibrium pressure in Pa/s.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double abs_act_p_Txv1v2psat(double T_K, double x_molmol,
-	double v1_m3mol, double v2_m3mol, double p_sat_Pa, void *workingPair);
+DLL_API double ads_p_wT_der(double w_kgkg, double T_K, double w_der_kgkgs,
+	double T_der_Ks, void *workingPair);
 
 
 /*
- * abs_act_x_pTv1v2psat:
- * ---------------------
+ * ads_T_pw_der:
+ * -------------
  *
- * Calculates mole fraction of first component in liquid phase x_molmol in
- * mol/mol depending on equilibrium pressure p_Pa in Pa of first component,
- * temperature T_K in K, molar volume of first component in m³/mol, molar volume
- * of second component in m³/mol and saturation pressure of first component
- * p_sat_Pa in Pa
+ * Calculates total derivative of equilibrium temperature T in K/s depending on
+ * equilibrium pressure p in Pa, equilibrium loading w in kg/kg, and their
+ * derivatives by the analytical partial derivatives of the isotherm and the
+ * implicit function theorem. Thus, the derivative can be used for derivative
+ * annotations of Modelica.
  *
  * Parameters:
  * -----------
  *	double p_Pa:
- *		Equilibrium pressure p_Pa in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
- *	double p_sat_Pa:
- *		Saturation pressure of first component in Pa.
+ *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double w_der_kgkgs:
+ *		Derivative of equilibrium loading in kg/kg/s.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
+ *		Derivative of equilibrium temperature in K/s.
  *
  * History:
  * --------
- *	30/03/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double abs_act_x_pTv1v2psat(double p_Pa, double T_K, double v1_m3mol,
-	double v2_m3mol, double p_sat_Pa, void *workingPair);
+DLL_API double ads_T_pw_der(double p_Pa, double w_kgkg, double p_der_Pas,
+	double w_der_kgkgs, void *workingPair);
 
 
 /*
- * abs_act_p_Txv1v2:
+ * ads_dw_dp_pT_der:
  * -----------------
  *
- * Calculates equilibrium pressure p_Pa in Pa of first component depending on
- * temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
- * molar volume of first component in m³/mol, and molar volume of second
- * component in m³/mol.
+ * Calculates total derivative of derivative of equilibrium loading w with
+ * respect to pressure p in kg/kg/Pa/s depending on equilibrium pressure p in
+ * Pa, equilibrium temperature T in K, and their derivatives.
  *
  * Parameters:
  * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure p_Pa in Pa.
+ *		Derivative of derivative of equilibrium loading wrt. pressure in
+ *		kg/kg/Pa/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
- *	This function uses internal model for vapor pressure of refrigerant.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double abs_act_p_Txv1v2(double T_K, double x_molmol,
-	double v1_m3mol, double v2_m3mol, void *workingPair);
+DLL_API double ads_dw_dp_pT_der(double p_Pa, double T_K, double p_der_Pas,
+	double T_der_Ks, void *workingPair);
 
 
 /*
- * abs_act_x_pTv1v2:
+ * ads_dw_dT_pT_der:
  * -----------------
  *
- * Calculates mole fraction of first component in liquid phase x_molmol in
- * mol/mol depending on equilibrium pressure p_Pa in Pa of first component,
- * temperature T_K in K, molar volume of first component in m³/mol, and molar
- * volume of second component in m³/mol.
+ * Calculates total derivative of derivative of equilibrium loading w with
+ * respect to temperature T in kg/kg/K/s depending on equilibrium pressure p in
+ * Pa, equilibrium temperature T in K, and their derivatives.
  *
  * Parameters:
  * -----------
  *	double p_Pa:
- *		Equilibrium pressure p_Pa in Pa.
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *		Derivative of derivative of equilibrium loading wrt. temperature in
+ *		kg/kg/K/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
- *	This function uses internal model for vapor pressure of refrigerant.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	30/03/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double abs_act_x_pTv1v2(double p_Pa, double T_K, double v1_m3mol,
-	double v2_m3mol, void *workingPair);
+DLL_API double ads_dw_dT_pT_der(double p_Pa, double T_K, double p_der_Pas,
+	double T_der_Ks, void *workingPair);
 
 
 /*
- * abs_mix_x_pT:
- * -------------
+ * ads_dp_dw_wT_der:
+ * -----------------
  *
- * Calculates equilibrium liquid mole fraction of first component in mol/mol
- * depending on pressure in Pa and temperature T_K in K.
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to loading w in Pa/(kg/kg)/s depending on equilibrium loading w in
+ * kg/kg, equilibrium temperature T in K, and their derivatives.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure p_Pa in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double w_der_kgkgs:
+ *		Derivative of equilibrium loading in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium mole fraction in of first component liquid phase in mol/mol.
- *	double *ret_y_1_molmol:
- *		Equilibrium mole fraction of first component.
- *	double *ret_y_2_molmol:
- *		Equilibrium mole fraction of second component.
+ *		Derivative of derivative of equilibrium pressure wrt. loading in
+ *		Pa/(kg/kg)/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on mixing rules.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double abs_mix_x_pT(double *ret_y_1_molmol, double *ret_y_2_molmol,
-	double p_Pa, double T_K, void *workingPair);
+DLL_API double ads_dp_dw_wT_der(double w_kgkg, double T_K, double w_der_kgkgs,
+	double T_der_Ks, void *workingPair);
 
 
 /*
- * abs_mix_p_Tx:
- * -------------
+ * ads_dp_dT_wT_der:
+ * -----------------
  *
- * Calculates equilibrium pressure p_Pa in Pa depending on temperature T_K in K
- * and mole fraction in liquid phase x_molmol in mol/mol.
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to temperature T in Pa/K/s depending on equilibrium loading w in
+ * kg/kg, equilibrium temperature T in K, and their derivatives.
  *
  * Parameters:
  * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_1_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double w_der_kgkgs:
+ *		Derivative of equilibrium loading in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure p_Pa in Pa.
- *	double *ret_y_1_molmol:
- *		Equilibrium mole fraction of first component.
- *	double *ret_y_2_molmol:
- *		Equilibrium mole fraction of second component.
+ *		Derivative of derivative of equilibrium pressure wrt. temperature in
+ *		Pa/K/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on mixing rules.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double abs_mix_p_Tx(double *ret_y_1_molmol, double *ret_y_2_molmol,
-	double T_K, double x_1_molmol, void *workingPair);
+DLL_API double ads_dp_dT_wT_der(double w_kgkg, double T_K, double w_der_kgkgs,
+	double T_der_Ks, void *workingPair);
 
 
 /*
- * abs_mix_T_px:
- * -------------
+ * ads_piStar_pyxgTM:
+ * ------------------
  *
- * Calculates equilibrium temperature T_K in K depending on pressure p_Pa in Pa
- * and mole fraction in liquid phase x_molmol in mol/mol.
+ * Calculates reduced spreading pressure piStar in kg/mol depending on
+ * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
+ * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
+ * activity coefficient of refrigerant in adsorbed phase, equilibrium
+ * temperature T in K and molar mass of refrigerant M in kg/mol. The reduced
+ * spreading pressure is defined as follows:
+ *
+ * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
+ *		Integral_0^p0{w(p,T) / p * dp}
+ *
+ *	where p0 = p_total*y / (gamma*x)
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure p_Pa in Pa.
- *	double x_1_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double p_total_Pa:
+ *		Total pressure of vapor phase in Pa.
+ *	double y_molmol:
+ *		Molar fraction of refrigerant in vapor phase in mol/mol.
+ *	double x_molmol:
+ *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
+ *	double gamma:
+ *		Activity coefficient of refrigerant in adsorbed phase.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double M_kgmol:
+ *		Molar mass of refrigerant M in kg/mol.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
- *	double *ret_y_1_molmol:
- *		Equilibrium mole fraction of first component.
- *	double *ret_y_2_molmol:
- *		Equilibrium mole fraction of second component.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on mixing rules.
- *	Uses Newton-Raphson method for calculating equilibrium temperature.
+ *		Reduced spreading pressure in kg/mol.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	01/13/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double abs_mix_T_px(double *ret_y_1_molmol, double *ret_y_2_molmol,
-	double p_Pa, double x_1_molmol, void *workingPair);
+DLL_API double ads_piStar_pyxgTM(double p_total_Pa, double y_molmol,
+	double x_molmol, double gamma, double T_K, double M_kgmol,
+	void *workingPair);
 
 
 /*
- * abs_mix_dp_dx_Tx:
- * -----------------
+ * ads_sur_w_pT:
+ * -------------
  *
- * Calculates derivative of equilibrium pressure with respect to liquid mole
- * fraction in Pa depending on temperature T_K in K and mole fraction in liquid
- * phase x_molmol in mol/mol.
+ * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
+ * p in Pa and equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_1_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt liquid mole fraction in Pa.
+ *		Equilibrium loading in kg/kg.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on mixing rules.
- *	Derivative is calculated numerically by the symmetric derivative using
- *  h = 0.00000001 mol/mol as small change.
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	03/27/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double abs_mix_dp_dx_Tx(double T_K, double x_1_molmol,
-	void *workingPair);
+DLL_API double ads_sur_w_pT(double p_Pa, double T_K, void *workingPair);
 
 
 /*
- * abs_mix_dp_dT_Tx:
- * -----------------
+ * ads_sur_p_wT:
+ * -------------
  *
- * Calculates derivative of equilibrium pressure with respect to temperature in
- * Pa/K depending on temperature T_K in K and mole fraction in liquid phase
- * x_molmol in mol/mol.
+ * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
+ * in kg/kg and equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ * 	double:
+ *		Equilibrium pressure in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_p_wT(double w_kgkg, double T_K, void *workingPair);
+
+
+/*
+ * ads_sur_T_pw:
+ * -------------
+ *
+ * Calculates equilibrium temperature in K depending on equilibrium pressure p
+ * in Pa and equilibrium loading w in kg/kg.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ * 	double:
+ *		Equilibrium temperature in K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_T_pw(double p_Pa, double w_kgkg, void *workingPair);
+
+
+/*
+ * ads_sur_dw_dp_pT:
+ * -----------------
+ *
+ * Calculates derivative of equilibrium loading w with respect to pressure
+ * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_1_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt temperature in Pa/K.
+ *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on mixing rules.
- *	Derivative is calculated numerically by the symmetric derivative using
- *  h = 0.0001 K as small change.
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	03/27/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double abs_mix_dp_dT_Tx(double T_K, double x_1_molmol,
-	void *workingPair);
+DLL_API double ads_sur_dw_dp_pT(double p_Pa, double T_K, void *workingPair);
 
 
-/////////////////////////////////////////////////////////////////////////////
-// Definition of function prototypes regarding refrigerant working w struct//
-/////////////////////////////////////////////////////////////////////////////
 /*
- * ref_p_sat_T:
- * ------------
+ * ads_sur_dw_dT_pT:
+ * -----------------
  *
- * Calculates saturation pressure in Pa depending on equilibrium temperature T
- * in K.
+ * Calculates derivative of equilibrium loading w with respect to temperature
+ * T in kg/kg/K depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
  * 	struct *WorkingPair:
@@ -2386,26 +2552,34 @@ DLL_API double abs_mix_dp_dT_Tx(double T_K, double x_1_molmol,
  * Returns:
  * --------
  *	double:
- *		Saturation pressure in Pa.
+ *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/27/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double ref_p_sat_T(double T_K, void *workingPair);
+DLL_API double ads_sur_dw_dT_pT(double p_Pa, double T_K, void *workingPair);
 
 
 /*
- * ref_dp_sat_dT_T:
- * ----------------
+ * ads_sur_dp_dw_wT:
+ * -----------------
  *
- * Calculates derivative of saturation pressure in Pa/K wrt to temperature
- * depending on equilibrium temperature T in K.
+ * Calculates derivative of equilibrium pressure p with respect to loading
+ * w in kgPa/kg depending on equilibrium loading w in kg/kg and equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
  * 	struct *WorkingPair:
@@ -2414,26 +2588,34 @@ DLL_API double ref_p_sat_T(double T_K, void *workingPair);
  * Returns:
  * --------
  *	double:
- *		Derivative of saturation pressure wrt temperature in Pa/K.
+ *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/27/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double ref_dp_sat_dT_T(double T_K, void *workingPair);
+DLL_API double ads_sur_dp_dw_wT(double w_kgkg, double T_K, void *workingPair);
 
 
 /*
- * ref_rho_l_T:
- * ------------
+ * ads_sur_dp_dT_wT:
+ * -----------------
  *
- * Calculates saturated liquid density in kg/m³ depending on equilibrium
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium loading w in kg/kg and equilibrium
  * temperature T in K.
  *
  * Parameters:
  * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
  * 	struct *WorkingPair:
@@ -2442,87 +2624,3859 @@ DLL_API double ref_dp_sat_dT_T(double T_K, void *workingPair);
  * Returns:
  * --------
  *	double:
- *		Saturated liquid density in kg/m³.
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/27/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double ref_rho_l_T(double T_K, void *workingPair);
+DLL_API double ads_sur_dp_dT_wT(double w_kgkg, double T_K, void *workingPair);
+
+
+/*
+ * ads_sur_piStar_pyxgTM:
+ * ----------------------
+ *
+ * Calculates reduced spreading pressure piStar in kg/mol depending on
+ * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
+ * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
+ * activity coefficient of refrigerant in adsorbed phase, equilibrium
+ * temperature T in K and molar mass of refrigerant M in kg/mol. The reduced
+ * spreading pressure is defined as follows:
+ *
+ * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
+ *		Integral_0^p0{w(p,T) / p * dp}
+ *
+ *	where p0 = p_total*y / (gamma*x)
+ *
+ * Parameters:
+ * -----------
+ *	double p_total_Pa:
+ *		Total pressure of vapor phase in Pa.
+ *	double y_molmol:
+ *		Molar fraction of refrigerant in vapor phase in mol/mol.
+ *	double x_molmol:
+ *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
+ *	double gamma:
+ *		Activity coefficient of refrigerant in adsorbed phase.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double M_kgmol:
+ *		Molar mass of refrigerant M in kg/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Reduced spreading pressure in kg/mol.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_piStar_pyxgTM(double p_total_Pa, double y_molmol,
+	double x_molmol, double gamma, double T_K, double M_kgmol,
+	void *workingPair);
+
+
+/*
+ * ads_sur_w_pTpsat:
+ * -----------------
+ *
+ * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
+ * p in Pa, equilibrium temperature T in K, and saturation pressure p_sat in Pa.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium loading in kg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_w_pTpsat(double p_Pa, double T_K, double p_sat_Pa,
+	void *workingPair);
+
+
+/*
+ * ads_sur_p_wTpsat:
+ * -----------------
+ *
+ * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
+ * in kg/kg, equilibrium temperature T in K, and saturation pressure p_sat in
+ * Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ * 	double:
+ *		Equilibrium pressure in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_p_wTpsat(double w_kgkg, double T_K, double p_sat_Pa,
+	void *workingPair);
+
+
+/*
+ * ads_sur_T_pwpsat:
+ * -----------------
+ *
+ * Calculates equilibrium temperature in K depending on equilibrium pressure p
+ * in Pa, equilibrium loading w in kg/kg, and saturation pressure p_sat in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ * 	double:
+ *		Equilibrium temperature in K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *	Uses internal equation of states to calculate vapor pressure and derivative
+ *	of vapor pressure wrt. temperature. If equation of state is not implemented
+ *	for refrigerant, function returns -1 and throws warning. If user want to use
+ *	his own equation of state, this function cannot be used and determination of
+ *	root to calculate T must be implemented by user.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_T_pwpsat(double p_Pa, double w_kgkg, double p_sat_Pa,
+	void *workingPair);
+
+
+/*
+ * ads_sur_dw_dp_pTpsat:
+ * ---------------------
+ *
+ * Calculates derivative of equilibrium loading w with respect to pressure
+ * p in kg/kg/Pa depending on equilibrium pressure p in Pa, equilibrium
+ * temperature T in K, and saturation pressure p_sat in Pa.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_dw_dp_pTpsat(double p_Pa, double T_K, double p_sat_Pa,
+	void *workingPair);
+
+
+/*
+ * ads_sur_dw_dT_pTpsat:
+ * ---------------------
+ *
+ * Calculates derivative of equilibrium loading w with respect to temperature
+ * T in kg/kg/K depending on equilibrium pressure p in Pa, equilibrium
+ * temperature T in K, saturation pressure p_sat in Pa, and derivative of
+ * saturation pressure wrt. temperature dp_sat_dT in Pa/K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	double dp_sat_dT_PaK:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_dw_dT_pTpsat(double p_Pa, double T_K, double p_sat_Pa,
+	double dp_sat_dT_PaK, void *workingPair);
+
+
+/*
+ * ads_sur_dp_dw_wTpsat:
+ * ---------------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to loading
+ * w in kgPa/kg depending on equilibrium loading w in kg/kg, equilibrium
+ * temperature T in K, and saturation pressure p_sat in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_dp_dw_wTpsat(double w_kgkg, double T_K, double p_sat_Pa,
+	void *workingPair);
+
+
+/*
+ * ads_sur_dp_dT_wTpsat:
+ * ---------------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium loading w in kg/kg, equilibrium
+ * temperature T in K, saturation pressure p_sat in Pa, and derivative of
+ * saturation pressure wrt. temperature dp_sat_dT in Pa/K.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	double dp_sat_dT_PaK:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_dp_dT_wTpsat(double w_kgkg, double T_K, double p_sat_Pa,
+	double dp_sat_dT_PaK, void *workingPair);
+
+
+/*
+ * ads_sur_piStar_pyxgTpsatM:
+ * --------------------------
+ *
+ * Calculates reduced spreading pressure piStar in kg/mol depending on
+ * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
+ * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
+ * activity coefficient of refrigerant in adsorbed phase, equilibrium
+ * temperature T in K, saturation pressure p_sat in Pa, and molar mass of
+ * refrigerant M in kg/mol. The reduced spreading pressure is defined as
+ * follows:
+ *
+ * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
+ *		Integral_0^p0{w(p,T) / p * dp}
+ *
+ *	where p0 = p_total*y / (gamma*x)
+ *
+ * Parameters:
+ * -----------
+ *	double p_total_Pa:
+ *		Total pressure of vapor phase in Pa.
+ *	double y_molmol:
+ *		Molar fraction of refrigerant in vapor phase in mol/mol.
+ *	double x_molmol:
+ *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
+ *	double gamma:
+ *		Activity coefficient of refrigerant in adsorbed phase.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ *	double M_kgmol:
+ *		Molar mass of refrigerant M in kg/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Reduced spreading pressure in kg/mol.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_piStar_pyxgTpsatM(double p_total_Pa, double y_molmol,
+	double x_molmol, double gamma, double T_K, double p_sat_Pa, double M_kgmol,
+	void *workingPair);
+
+
+/*
+ * ads_vol_W_ARho:
+ * ---------------
+ *
+ * Calculates equilibrium volumetric loading W in m³/kg depending on equilibrium
+ * adsorption potential A in J/mol and saturated liquid density of adsorpt rho_l
+ * in kg/m3.
+ *
+ * Parameters:
+ * -----------
+ * 	double A_Jmol:
+ *		Equilibrium adsorption potential A in J/mol.
+ * 	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium volumetric loading W in m³/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *	Saturated liquid density of adsorpt is required to calculate volumetric
+ *	loading from characteristic curve in m3/kg when coefficients would directly
+ *	return loading w in kg/kg. Therefore, function checks unit of coefficients
+ *	by checking isotherm coefficients.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_W_ARho(double A_Jmol, double rho_l_kgm3,
+	void *workingPair);
+
+
+/*
+ * ads_vol_A_WRho:
+ * ---------------
+ *
+ * Calculates equilibrium adsorption potential A in J/mol depending on
+ * equilibrium volumetric loading W in m³/kg and saturated liquid density of
+ * adsorpt rho_l in kg/m3.
+ *
+ * Parameters:
+ * -----------
+ * 	double W_m3kg:
+ *		Equilibrium volumetric loading W in m³/kg.
+ * 	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium adsorption potential A in J/mol.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *	Saturated liquid density of adsorpt is required to calculate volumetric
+ *	loading from characteristic curve in m3/kg when coefficients would directly
+ *	return loading w in kg/kg.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_A_WRho(double W_m3kg, double rho_l_kgm3,
+	void *workingPair);
+
+
+/*
+ * ads_vol_w_pTpsatRho:
+ * --------------------
+ *
+ * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
+ * p in Pa, equilibrium temperature T in K, saturation pressure p_Sat in Pa and
+ * saturated liquid density of adsorpt rho in kg/m³.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt in kg/m³.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium loading in kg/kg.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_w_pTpsatRho(double p_Pa, double T_K, double p_sat_Pa,
+	double rho_kgm3, void *workingPair);
+
+
+/*
+ * ads_vol_p_wTpsatRho:
+ * --------------------
+ *
+ * Calculates equilibrium pressure p in Pa depending on equilibrium loading w in
+ * kg/kg, equilibrium temperature T in K, saturation pressure p_Sat in Pa and
+ * density of adsorpt rho in kg/m³.
+ *
+ * Parameters:
+ * -----------
+ * 	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_p_wTpsatRho(double w_kgkg, double T_K, double p_sat_Pa,
+	double rho_kgm3, void *workingPair);
+
+
+/*
+ * ads_vol_T_pwpsatRho:
+ * --------------------
+ *
+ * Calculates equilibrium temperature T in K depending on equilibrium pressure
+ * in Pa, equilibrium loading w in kg/kg, saturation pressure p_Sat in Pa and
+ * density of adsorpt rho in kg/m³.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ * 	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium temperature in K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *	Uses internal equations of states to calculate vapor pressure, saturated
+ *	liquid density of adsorpt, derivative of vapor pressure wrt. temperature
+ *	and derivative of saturated liquid density of adsorpt wrt. temperature. If
+ *	equation of states are not implemented for refrigerant, function returns -1
+ *  and throws warning. If user want to use his own equation of states, this
+ *  function cannot be used and determination of root to calculate T must
+ *  be implemented by user.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_T_pwpsatRho(double p_Pa, double w_kgkg, double p_sat_Pa,
+	double rho_kgm3, void *workingPair);
+
+
+/*
+ * ads_vol_dW_dA_ARho:
+ * -------------------
+ *
+ * Calculates derivative of equilibrium volumetric loading dW_dA in m³mol/kg/J
+ * depending on equilibrium adsorption potential A in J/mol and saturated liquid
+ * density of adsorpt rho_l in kg/m3.
+ *
+ * Parameters:
+ * -----------
+ * 	double A_Jmol:
+ *		Equilibrium adsorption potential A in mol/J.
+ * 	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of volumetric loading wrt. adsorption potential in
+ *		m³mol/kg/J.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *	Saturated liquid density of adsorpt is required to calculate volumetric
+ *	loading from characteristic curve in m3/kg when coefficients would directly
+ *	return loading w in kg/kg.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_dW_dA_ARho(double A_Jmol, double rho_l_kgm3,
+	void *workingPair);
+
+
+/*
+ * ads_vol_dA_dW_WRho:
+ * -------------------
+ *
+ * Calculates derivative of equilibrium adsorption potential dA_dW in kgJ/mol/m³
+ * depending on equilibrium volumetric loading W in m³/kg and saturated liquid
+ * density of adsorpt rho_l in kg/m3.
+ *
+ * Parameters:
+ * -----------
+ * 	double W_m3kg:
+ *		Equilibrium volumetric loading W in m³/kg.
+ * 	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of adsorption potential wrt. volumetric loading in
+ *		kgJ/mol/m³.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *	Saturated liquid density of adsorpt is required to calculate volumetric
+ *	loading from characteristic curve in m3/kg when coefficients would directly
+ *	return loading w in kg/kg.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_dA_dW_WRho(double W_m3kg, double rho_l_kgm3,
+	void *workingPair);
+
+
+/*
+ * ads_vol_dw_dp_pTpsatRho:
+ * ------------------------
+ *
+ * Calculates derivative of equilibrium loading dw_dp with respect to pressure
+ * in kg/kg/Pa depending on equilibrium pressure p in Pa, equilibrium
+ * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
+ * rho in kg/m³.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_dw_dp_pTpsatRho(double p_Pa, double T_K, double p_sat_Pa,
+	double rho_kgm3, void *workingPair);
+
+
+/*
+ * ads_vol_dw_dT_pTpsatRho:
+ * ------------------------
+ *
+ * Calculates derivative of equilibrium loading dw_dp with respect to
+ * temperature in kg/kg/K depending on equilibrium pressure p in Pa, equilibrium
+ * temperature T in K, saturation pressure p_Sat in Pa, density of adsorpt
+ * rho in kg/m³, derivative of saturation pressure with respect to temperature
+ * dp_sat_dT in Pa/K and derivative of density of adsorpt with respect to
+ * temperature drho_dT in kg/m³/K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ * 	double dp_sat_dT_PaK:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ *	double drho_dT_kgm3K:
+ *		Derivative of density of adsorpt wrt. temperature in kg/m³/K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_dw_dT_pTpsatRho(double p_Pa, double T_K, double p_sat_Pa,
+	double rho_kgm3, double dp_sat_dT_PaK, double drho_dT_kgm3K,
+	void *workingPair);
+
+
+/*
+ * ads_vol_dp_dw_wTpsatRho:
+ * ------------------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to loading
+ * w in kgPa/kg depending on equilibrium loading w in kg/kg, equilibrium
+ * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
+ * rho in kg/m³.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *
+ * History:
+ * --------
+ *	01/13/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_dp_dw_wTpsatRho(double w_kgkg, double T_K,
+	double p_sat_Pa, double rho_kgm3, void *workingPair);
+
+
+/*
+ * ads_vol_dp_dT_wTpsatRho:
+ * ------------------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium loading w in kg/kg, equilibrium
+ * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
+ * rho in kg/m³, derivative of saturation pressure with respect to temperature
+ * dp_sat_dT in Pa/K and derivative of density of adsorpt with respect to
+ * temperature drho_dT in kg/m³/K.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ * 	double dp_sat_dT_PaK:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ *	double drho_dT_kgm3K:
+ *		Derivative of density of adsorpt wrt. temperature in kg/m³/K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *
+ * History:
+ * --------
+ *	01/13/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_dp_dT_wTpsatRho(double w_kgkg, double T_K,
+	double p_sat_Pa, double rho_kgm3, double dp_sat_dT_PaK,
+	double drho_dT_kgm3K, void *workingPair);
+
+
+/*
+ * ads_vol_piStar_pyxgTpsatRhoM:
+ * -----------------------------
+ *
+ * Calculates reduced spreading pressure in kg/mol depending on equilibrium
+ * pressure p in Pa, molar fraction of refrigerant in vapor phase in mol/mol,
+ * molar fraction of refrigerant in adsorbed phase in mol/mol, activity
+ * coefficient of refrigerant in adsorbed phase, equilibrium temperature T in K,
+ * saturation pressure p_Sat in Pa and density of adsorpt rho in kg/m³ and molar
+ * mass of refrigerant M in kg/mol. The reduced spreading pressure is defined as
+ * follows:
+ *
+ * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
+ *		Integral_0^p0{w(p,T) / p * dp}
+ *
+ *	where p0 = p_total*y / (gamma*x)
+ *
+ * Parameters:
+ * -----------
+ *	double p_total_Pa:
+ *		Total pressure of vapor phase in Pa.
+ *	double y_molmol:
+ *		Molar fraction of refrigerant in vapor phase in mol/mol.
+ *	double x_molmol:
+ *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
+ *	double gamma:
+ *		Activity coefficient of refrigerant in adsorbed phase.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ *	double M_kgmol:
+ *		Molar mass of refrigerant M in kg/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Reduced spreading pressure in kg/mol.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *
+ * History:
+ * --------
+ *	01/13/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_piStar_pyxgTpsatRhoM(double p_total_Pa, double y_molmol,
+	double x_molmol, double gamma, double T_K, double p_sat_Pa,
+	double rho_kgm3, double M_kgmol, void *workingPair);
+
+
+////////////////////////////////////////////////////////////////////////////
+// Definition of function prototypes regarding absorption working w struct//
+////////////////////////////////////////////////////////////////////////////
+/*
+ * abs_con_X_pT:
+ * -------------
+ *
+ * Calculates equilibrium concentration X in kg/kg depending on equilibrium
+ * pressure p in Pa and equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium concentration in kg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_X_pT(double p_Pa, double T_K, void *workingPair);
+
+
+/*
+ * abs_con_p_XT:
+ * -------------
+ *
+ * Calculates equilibrium pressure p in Pa depending on equilibrium
+ * concentration X in kg/kg and equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ * 	double:
+ *		Equilibrium pressure in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_p_XT(double X_kgkg, double T_K, void *workingPair);
+
+
+/*
+ * abs_con_T_pX:
+ * -------------
+ *
+ * Calculates equilibrium temperature in K depending on equilibrium pressure p
+ * in Pa and equilibrium concentration X in kg/kg.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ * 	double:
+ *		Equilibrium temperature in K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_T_pX(double p_Pa, double X_kgkg, void *workingPair);
+
+
+/*
+ * abs_con_dX_dp_pT:
+ * -----------------
+ *
+ * Calculates derivative of equilibrium concentration X with respect to pressure
+ * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium concentration wrt. pressure in kg/kg/Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_dX_dp_pT(double p_Pa, double T_K, void *workingPair);
+
+
+/*
+ * abs_con_dX_dT_pT:
+ * -----------------
+ *
+ * Calculates derivative of equilibrium concentration X with respect to
+ * temperature T in kg/kg/K depending on equilibrium pressure p in Pa and
+ * equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium concentration wrt. temperature in kg/kg/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_dX_dT_pT(double p_Pa, double T_K, void *workingPair);
+
+
+/*
+ * abs_con_dp_dX_XT:
+ * -----------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to concentration
+ * w in kgPa/kg depending on equilibrium concentration X in kg/kg and
+ * equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. concentration in Pakg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_dp_dX_XT(double X_kgkg, double T_K, void *workingPair);
+
+
+/*
+ * abs_con_dp_dT_XT:
+ * -----------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium concentration X in kg/kg and
+ * equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_dp_dT_XT(double X_kgkg, double T_K, void *workingPair);
+
+
+/*
+ * abs_con_X_pT_der:
+ * -----------------
+ *
+ * Calculates total derivative of equilibrium concentration X in kg/kg/s
+ * depending on equilibrium pressure p in Pa, equilibrium temperature T in K,
+ * and their derivatives by the analytical partial derivatives of the isotherm.
+ * Thus, the derivative can be used for derivative annotations of Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium concentration in kg/kg/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_X_pT_der(double p_Pa, double T_K, double p_der_Pas,
+	double T_der_Ks, void *workingPair);
+
+
+/*
+ * abs_con_p_XT_der:
+ * -----------------
+ *
+ * Calculates total derivative of equilibrium pressure p in Pa/s depending on
+ * equilibrium concentration X in kg/kg, equilibrium temperature T in K, and
+ * their derivatives by the analytical partial derivatives of the isotherm.
+ * Thus, the derivative can be used for derivative annotations of Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double X_der_kgkgs:
+ *		Derivative of equilibrium concentration in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_p_XT_der(double X_kgkg, double T_K, double X_der_kgkgs,
+	double T_der_Ks, void *workingPair);
+
+
+/*
+ * abs_con_T_pX_der:
+ * -----------------
+ *
+ * Calculates total derivative of equilibrium temperature T in K/s depending on
+ * equilibrium pressure p in Pa, equilibrium concentration X in kg/kg, and their
+ * derivatives by the analytical partial derivatives of the isotherm and the
+ * implicit function theorem. Thus, the derivative can be used for derivative
+ * annotations of Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double X_der_kgkgs:
+ *		Derivative of equilibrium concentration in kg/kg/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_T_pX_der(double p_Pa, double X_kgkg, double p_der_Pas,
+	double X_der_kgkgs, void *workingPair);
+
+
+/*
+ * abs_con_dX_dp_pT_der:
+ * ---------------------
+ *
+ * Calculates total derivative of derivative of equilibrium concentration X with
+ * respect to pressure p in kg/kg/Pa/s depending on equilibrium pressure p in
+ * Pa, equilibrium temperature T in K, and their derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium concentration wrt. pressure in
+ *		kg/kg/Pa/s.
+ *
+ * Remarks:
+ * --------
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_dX_dp_pT_der(double p_Pa, double T_K, double p_der_Pas,
+	double T_der_Ks, void *workingPair);
+
+
+/*
+ * abs_con_dX_dT_pT_der:
+ * ---------------------
+ *
+ * Calculates total derivative of derivative of equilibrium concentration X with
+ * respect to temperature T in kg/kg/K/s depending on equilibrium pressure p in
+ * Pa, equilibrium temperature T in K, and their derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium concentration wrt. temperature
+ *		in kg/kg/K/s.
+ *
+ * Remarks:
+ * --------
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_dX_dT_pT_der(double p_Pa, double T_K, double p_der_Pas,
+	double T_der_Ks, void *workingPair);
+
+
+/*
+ * abs_con_dp_dX_XT_der:
+ * ---------------------
+ *
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to concentration X in Pa/(kg/kg)/s depending on equilibrium
+ * concentration X in kg/kg, equilibrium temperature T in K, and their
+ * derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double X_der_kgkgs:
+ *		Derivative of equilibrium concentration in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium pressure wrt. concentration in
+ *		Pa/(kg/kg)/s.
+ *
+ * Remarks:
+ * --------
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_dp_dX_XT_der(double X_kgkg, double T_K,
+	double X_der_kgkgs, double T_der_Ks, void *workingPair);
+
+
+/*
+ * abs_con_dp_dT_XT_der:
+ * ---------------------
+ *
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to temperature T in Pa/K/s depending on equilibrium concentration X
+ * in kg/kg, equilibrium temperature T in K, and their derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double X_der_kgkgs:
+ *		Derivative of equilibrium concentration in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium pressure wrt. temperature in
+ *		Pa/K/s.
+ *
+ * Remarks:
+ * --------
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_dp_dT_XT_der(double X_kgkg, double T_K,
+	double X_der_kgkgs, double T_der_Ks, void *workingPair);
+
+
+/*
+ * abs_act_g_Txv1v2:
+ * -----------------
+ *
+ * Calculates activity coefficient of first component depending on temperature
+ * T_K in K, mole fraction in liquid phase x_molmol in mol/mol, molar volume of
+ * first component in m³/mol, and molar volume of second component in m³/mol.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Activity coefficient of first component.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_act_g_Txv1v2(double T_K, double x_molmol, double v1_m3mol,
+	double v2_m3mol, void *workingPair);
+
+
+/*
+ * abs_act_p_Txv1v2psat:
+ * ---------------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa of first component depending on
+ * temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
+ * molar volume of first component in m³/mol, molar volume of second component
+ * in m³/mol,and saturation pressure of first component p_sat_Pa in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_act_p_Txv1v2psat(double T_K, double x_molmol,
+	double v1_m3mol, double v2_m3mol, double p_sat_Pa, void *workingPair);
+
+
+/*
+ * abs_act_x_pTv1v2psat:
+ * ---------------------
+ *
+ * Calculates mole fraction of first component in liquid phase x_molmol in
+ * mol/mol depending on equilibrium pressure p_Pa in Pa of first component,
+ * temperature T_K in K, molar volume of first component in m³/mol, molar volume
+ * of second component in m³/mol and saturation pressure of first component
+ * p_sat_Pa in Pa
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure p_Pa in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
+ *
+ * History:
+ * --------
+ *	30/03/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_act_x_pTv1v2psat(double p_Pa, double T_K, double v1_m3mol,
+	double v2_m3mol, double p_sat_Pa, void *workingPair);
+
+
+/*
+ * abs_act_p_Txv1v2:
+ * -----------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa of first component depending on
+ * temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
+ * molar volume of first component in m³/mol, and molar volume of second
+ * component in m³/mol.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
+ *	This function uses internal model for vapor pressure of refrigerant.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_act_p_Txv1v2(double T_K, double x_molmol,
+	double v1_m3mol, double v2_m3mol, void *workingPair);
+
+
+/*
+ * abs_act_x_pTv1v2:
+ * -----------------
+ *
+ * Calculates mole fraction of first component in liquid phase x_molmol in
+ * mol/mol depending on equilibrium pressure p_Pa in Pa of first component,
+ * temperature T_K in K, molar volume of first component in m³/mol, and molar
+ * volume of second component in m³/mol.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure p_Pa in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
+ *	This function uses internal model for vapor pressure of refrigerant.
+ *
+ * History:
+ * --------
+ *	30/03/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_act_x_pTv1v2(double p_Pa, double T_K, double v1_m3mol,
+	double v2_m3mol, void *workingPair);
+
+
+/*
+ * abs_mix_x_pT:
+ * -------------
+ *
+ * Calculates equilibrium liquid mole fraction of first component in mol/mol
+ * depending on pressure in Pa and temperature T_K in K.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure p_Pa in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium mole fraction in of first component liquid phase in mol/mol.
+ *	double *ret_y_1_molmol:
+ *		Equilibrium mole fraction of first component.
+ *	double *ret_y_2_molmol:
+ *		Equilibrium mole fraction of second component.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on mixing rules.
+ *
+ * History:
+ * --------
+ *	04/09/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_mix_x_pT(double *ret_y_1_molmol, double *ret_y_2_molmol,
+	double p_Pa, double T_K, void *workingPair);
+
+
+/*
+ * abs_mix_p_Tx:
+ * -------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa depending on temperature T_K in K
+ * and mole fraction in liquid phase x_molmol in mol/mol.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *	double *ret_y_1_molmol:
+ *		Equilibrium mole fraction of first component.
+ *	double *ret_y_2_molmol:
+ *		Equilibrium mole fraction of second component.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on mixing rules.
+ *
+ * History:
+ * --------
+ *	04/09/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_mix_p_Tx(double *ret_y_1_molmol, double *ret_y_2_molmol,
+	double T_K, double x_1_molmol, void *workingPair);
+
+
+/*
+ * abs_mix_T_px:
+ * -------------
+ *
+ * Calculates equilibrium temperature T_K in K depending on pressure p_Pa in Pa
+ * and mole fraction in liquid phase x_molmol in mol/mol.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure p_Pa in Pa.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double *ret_y_1_molmol:
+ *		Equilibrium mole fraction of first component.
+ *	double *ret_y_2_molmol:
+ *		Equilibrium mole fraction of second component.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Uses Newton-Raphson method for calculating equilibrium temperature.
+ *
+ * History:
+ * --------
+ *	04/09/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_mix_T_px(double *ret_y_1_molmol, double *ret_y_2_molmol,
+	double p_Pa, double x_1_molmol, void *workingPair);
+
+
+/*
+ * abs_mix_dp_dx_Tx:
+ * -----------------
+ *
+ * Calculates derivative of equilibrium pressure with respect to liquid mole
+ * fraction in Pa depending on temperature T_K in K and mole fraction in liquid
+ * phase x_molmol in mol/mol.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt liquid mole fraction in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Derivative is calculated numerically by the symmetric derivative using
+ *  h = 0.00000001 mol/mol as small change.
+ *
+ * History:
+ * --------
+ *	04/09/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_mix_dp_dx_Tx(double T_K, double x_1_molmol,
+	void *workingPair);
+
+
+/*
+ * abs_mix_dp_dT_Tx:
+ * -----------------
+ *
+ * Calculates derivative of equilibrium pressure with respect to temperature in
+ * Pa/K depending on temperature T_K in K and mole fraction in liquid phase
+ * x_molmol in mol/mol.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt temperature in Pa/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Derivative is calculated numerically by the symmetric derivative using
+ *  h = 0.0001 K as small change.
+ *
+ * History:
+ * --------
+ *	04/09/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_mix_dp_dT_Tx(double T_K, double x_1_molmol,
+	void *workingPair);
+
+
+/*
+ * abs_mix_dp_dx_Tx_der:
+ * ---------------------
+ *
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to liquid mole fraction x in Pa/(mol/mol)/s depending on equilibrium
+ * temperature T in K, equilibrium mole fraction in liquid phase x in mol/mol,
+ * and their derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *	double x_der_molmols:
+ *		Derivative of equilibrium mole fraction in liquid phase in mol/mol/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium pressure wrt. liquid mole
+ *		fraction in Pa/(mol/mol)/s.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-3
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP_MIX) of inputs whose derivatives are
+ *	not zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_mix_dp_dx_Tx_der(double T_K, double x_1_molmol,
+	double T_der_Ks, double x_der_molmols, void *workingPair);
+
+
+/*
+ * abs_mix_dp_dT_Tx_der:
+ * ---------------------
+ *
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to temperature T in Pa/K/s depending on equilibrium temperature T in
+ * K, equilibrium mole fraction in liquid phase x in mol/mol, and their
+ * derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *	double x_der_molmols:
+ *		Derivative of equilibrium mole fraction in liquid phase in mol/mol/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium pressure wrt. temperature in
+ *		Pa/K/s.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-3
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP_MIX) of inputs whose derivatives are
+ *	not zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_mix_dp_dT_Tx_der(double T_K, double x_1_molmol,
+	double T_der_Ks, double x_der_molmols, void *workingPair);
+
+
+/////////////////////////////////////////////////////////////////////////////
+// Definition of function prototypes regarding refrigerant working w struct//
+/////////////////////////////////////////////////////////////////////////////
+/*
+ * ref_p_sat_T:
+ * ------------
+ *
+ * Calculates saturation pressure in Pa depending on equilibrium temperature T
+ * in K.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Saturation pressure in Pa.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_p_sat_T(double T_K, void *workingPair);
+
+
+/*
+ * ref_dp_sat_dT_T:
+ * ----------------
+ *
+ * Calculates derivative of saturation pressure in Pa/K wrt to temperature
+ * depending on equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of saturation pressure wrt temperature in Pa/K.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_dp_sat_dT_T(double T_K, void *workingPair);
+
+
+/*
+ * ref_rho_l_T:
+ * ------------
+ *
+ * Calculates saturated liquid density in kg/m³ depending on equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Saturated liquid density in kg/m³.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_rho_l_T(double T_K, void *workingPair);
+
+
+/*
+ * ref_drho_l_dT_T:
+ * ----------------
+ *
+ * Calculates derivative of saturated liquid density wrt temperature in kg/m³/K
+ * depending on equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of saturated liquid density wrt temperature in kg/m³/K.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_drho_l_dT_T(double T_K, void *workingPair);
+
+
+/*
+ * ref_T_sat_p:
+ * ------------
+ *
+ * Calculates saturation temperature in K depending on equilibrium pressure p
+ * in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Saturation pressure in Pa.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium temperature in K.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_T_sat_p(double p_Pa, void *workingPair);
+
+
+/*
+ * ref_p_sat_T_der:
+ * ----------------
+ *
+ * Calculates total derivative of saturation pressure in Pa/s depending on
+ * saturation temperature T in K and its derivative. Thus, the derivative can be
+ * used for derivative annotations of Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Saturation temperature in K.
+ *	double T_der_Ks:
+ *		Derivative of saturation temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of saturation pressure in Pa/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_p_sat_T_der(double T_K, double T_der_Ks, void *workingPair);
+
+
+/*
+ * ref_T_sat_p_der:
+ * ----------------
+ *
+ * Calculates total derivative of saturation temperature in K/s depending on
+ * saturation pressure p in Pa and its derivative. Thus, the derivative can be
+ * used for derivative annotations of Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Saturation pressure in Pa.
+ *	double p_der_Pas:
+ *		Derivative of saturation pressure in Pa/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of saturation temperature in K/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_T_sat_p_der(double p_Pa, double p_der_Pas,
+	void *workingPair);
+
+
+/*
+ * ref_rho_l_T_der:
+ * ----------------
+ *
+ * Calculates total derivative of saturated liquid density in kg/m³/s depending
+ * on saturation temperature T in K and its derivative. Thus, the derivative can
+ * be used for derivative annotations of Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Saturation temperature in K.
+ *	double T_der_Ks:
+ *		Derivative of saturation temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of saturated liquid density in kg/m³/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_rho_l_T_der(double T_K, double T_der_Ks, void *workingPair);
+
+
+/*
+ * ref_dp_sat_dT_T_der:
+ * --------------------
+ *
+ * Calculates total derivative of derivative of saturation pressure wrt.
+ * temperature in Pa/K/s depending on saturation temperature T in K and its
+ * derivative.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Saturation temperature in K.
+ *	double T_der_Ks:
+ *		Derivative of saturation temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of saturation pressure wrt. temperature in
+ *		Pa/K/s.
+ *
+ * Remarks:
+ * --------
+ *	Derivative of the analytical derivative is calculated numerically by the
+ *	symmetric derivative using a relative change of 1e-4 (i.e.,
+ *	WORKINGPAIR_DERIVATIVE_STEP) of temperature.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_dp_sat_dT_T_der(double T_K, double T_der_Ks,
+	void *workingPair);
+
+
+/*
+ * ref_drho_l_dT_T_der:
+ * --------------------
+ *
+ * Calculates total derivative of derivative of saturated liquid density wrt.
+ * temperature in kg/m³/K/s depending on saturation temperature T in K and its
+ * derivative.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Saturation temperature in K.
+ *	double T_der_Ks:
+ *		Derivative of saturation temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of saturated liquid density wrt. temperature
+ *		in kg/m³/K/s.
+ *
+ * Remarks:
+ * --------
+ *	Derivative of the analytical derivative is calculated numerically by the
+ *	symmetric derivative using a relative change of 1e-4 (i.e.,
+ *	WORKINGPAIR_DERIVATIVE_STEP) of temperature.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_drho_l_dT_T_der(double T_K, double T_der_Ks,
+	void *workingPair);
+
+
+/////////////////////////////////////////////////////////////////////////
+// Definition of function prototypes regarding tables working w struct //
+/////////////////////////////////////////////////////////////////////////
+/*
+ * tab_w_pT:
+ * ---------
+ *
+ * Calculates equilibrium loading w in kg/kg, concentration X in kg/kg, or
+ * mole fraction in liquid phase x in mol/mol depending on equilibrium pressure
+ * p in Pa and equilibrium temperature T in K by the spline tables of the
+ * working pair. If tables are disabled or state is outside of tables, the
+ * original equation is evaluated.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	struct *workingPair:
+ *		Pointer to WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium loading, concentration, or liquid mole fraction.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double tab_w_pT(double p_Pa, double T_K, void *workingPair);
+
+
+/*
+ * tab_p_wT:
+ * ---------
+ *
+ * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
+ * in kg/kg, concentration X in kg/kg, or mole fraction in liquid phase x in
+ * mol/mol and equilibrium temperature T in K by the spline tables of the
+ * working pair. If tables are disabled or state is outside of tables, the
+ * original equation is evaluated.
+ *
+ * Parameters:
+ * -----------
+ * 	double w:
+ *		Equilibrium loading, concentration, or liquid mole fraction.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	struct *workingPair:
+ *		Pointer to WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure in Pa.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double tab_p_wT(double w, double T_K, void *workingPair);
+
+
+/*
+ * tab_T_pw:
+ * ---------
+ *
+ * Calculates equilibrium temperature T in K depending on equilibrium pressure
+ * p in Pa and equilibrium loading w in kg/kg, concentration X in kg/kg, or
+ * mole fraction in liquid phase x in mol/mol by the spline tables of the
+ * working pair. If tables are disabled or state is outside of tables, the
+ * original equation is evaluated.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ * 	double w:
+ *		Equilibrium loading, concentration, or liquid mole fraction.
+ *	struct *workingPair:
+ *		Pointer to WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium temperature in K.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double tab_T_pw(double p_Pa, double w, void *workingPair);
+
+
+/*
+ * tab_w_pT_der:
+ * -------------
+ *
+ * Calculates total derivative of equilibrium loading w in kg/kg/s,
+ * concentration X in kg/kg/s, or mole fraction in liquid phase x in mol/mol/s
+ * depending on equilibrium pressure p in Pa, equilibrium temperature T in K,
+ * and their derivatives by the partial derivatives of the spline tables of the
+ * working pair. Thus, the derivative is consistent with tab_w_pT (e.g., for
+ * derivative annotations of Modelica).
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *	struct *workingPair:
+ *		Pointer to WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading, concentration, or liquid mole
+ *		fraction.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double tab_w_pT_der(double p_Pa, double T_K, double p_der_Pas,
+	double T_der_Ks, void *workingPair);
+
+
+/*
+ * tab_p_wT_der:
+ * -------------
+ *
+ * Calculates total derivative of equilibrium pressure p in Pa/s depending on
+ * equilibrium loading w in kg/kg, concentration X in kg/kg, or mole fraction
+ * in liquid phase x in mol/mol, equilibrium temperature T in K, and their
+ * derivatives by the partial derivatives of the spline tables of the working
+ * pair. Thus, the derivative is consistent with tab_p_wT (e.g., for
+ * derivative annotations of Modelica).
+ *
+ * Parameters:
+ * -----------
+ * 	double w:
+ *		Equilibrium loading, concentration, or liquid mole fraction.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double w_der:
+ *		Derivative of equilibrium loading, concentration, or liquid mole
+ *		fraction.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *	struct *workingPair:
+ *		Pointer to WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double tab_p_wT_der(double w, double T_K, double w_der,
+	double T_der_Ks, void *workingPair);
+
+
+/*
+ * tab_T_pw_der:
+ * -------------
+ *
+ * Calculates total derivative of equilibrium temperature T in K/s depending on
+ * equilibrium pressure p in Pa, equilibrium loading w in kg/kg, concentration
+ * X in kg/kg, or mole fraction in liquid phase x in mol/mol, and their
+ * derivatives by the partial derivatives of the spline tables of the working
+ * pair. Thus, the derivative is consistent with tab_T_pw (e.g., for
+ * derivative annotations of Modelica).
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ * 	double w:
+ *		Equilibrium loading, concentration, or liquid mole fraction.
+ * 	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ * 	double w_der:
+ *		Derivative of equilibrium loading, concentration, or liquid mole
+ *		fraction.
+ *	struct *workingPair:
+ *		Pointer to WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double tab_T_pw_der(double p_Pa, double w, double p_der_Pas,
+	double w_der, void *workingPair);
+
+
+/////////////////////////////////////////////////////////////////////////////
+// Definition of function prototypes regarding adsorption working wo struct//
+/////////////////////////////////////////////////////////////////////////////
+/*
+ * direct_ads_w_pT:
+ * ----------------
+ *
+ * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
+ * p in Pa, equilibrium temperature T in K, and specified working pair.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium loading in kg/kg.
+ *
+ * History:
+ * --------
+ *	02/11/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_w_pT(double p_Pa, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_p_wT:
+ * ----------------
+ *
+ * Calculates equilibrium pressure p in Pa depending on equilibrium temperature
+ * T in K, equilibrium loading w in kg/kg, equilibrium temperature T in K, and
+ * specified working pair.
+ *
+ * Parameters:
+ * -----------
+ * 	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *		Name of calculation approach for liquid density.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure in Pa.
+ *
+ * History:
+ * --------
+ *	02/11/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_p_wT(double w_kgkg, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_T_pw:
+ * ----------------
+ *
+ * Calculates equilibrium temperature in K depending on equilibrium pressure p
+ * in Pa, equilibrium loading w in kg/kg, and specified working pair.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *		Name of calculation approach for liquid density.
+ *
+ * Returns:
+ * --------
+ * 	double:
+ *		Equilibrium temperature in K.
+ *
+ * Remarks:
+ * --------
+ *	Function uses equation of states implemented for calculation of vapor
+ *	pressure, saturated liquid density, derivative of vapor pressure wrt.
+ *	temperature, and derivative of saturated liquid density wrt. temperature
+ *	when isotherm of working pair is based on volumetric approach (e.g.
+ *	Dubinin theory).
+ *
+ * History:
+ * --------
+ *	02/11/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_T_pw(double p_Pa, double w_kgkg,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_dw_dp_pT:
+ * --------------------
+ *
+ * Calculates derivative of equilibrium loading w with respect to pressure
+ * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_dw_dp_pT(double p_Pa, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_dw_dT_pT:
+ * --------------------
+ *
+ * Calculates derivative of equilibrium loading w with respect to temperature
+ * T in kg/kg/K depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_dw_dT_pT(double p_Pa, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_dp_dw_wT:
+ * --------------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to loading
+ * w in kgPa/kg depending on equilibrium loading w in kg/kg and equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_dp_dw_wT(double w_kgkg, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_dp_dT_wT:
+ * --------------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium loading w in kg/kg and equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_dp_dT_wT(double w_kgkg, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_w_pT_der:
+ * --------------------
+ *
+ * Calculates total derivative of equilibrium loading w in kg/kg/s depending on
+ * equilibrium pressure p in Pa, equilibrium temperature T in K, and their
+ * derivatives by the analytical partial derivatives of the isotherm. Thus, the
+ * derivative can be used for derivative annotations of DirectFunctionCalls of
+ * Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading in kg/kg/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_w_pT_der(double p_Pa, double T_K, double p_der_Pas,
+	double T_der_Ks, const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_p_wT_der:
+ * --------------------
+ *
+ * Calculates total derivative of equilibrium pressure p in Pa/s depending on
+ * equilibrium loading w in kg/kg, equilibrium temperature T in K, and their
+ * derivatives by the analytical partial derivatives of the isotherm. Thus, the
+ * derivative can be used for derivative annotations of DirectFunctionCalls of
+ * Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double w_der_kgkgs:
+ *		Derivative of equilibrium loading in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_p_wT_der(double w_kgkg, double T_K,
+	double w_der_kgkgs, double T_der_Ks, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_T_pw_der:
+ * --------------------
+ *
+ * Calculates total derivative of equilibrium temperature T in K/s depending on
+ * equilibrium pressure p in Pa, equilibrium loading w in kg/kg, and their
+ * derivatives by the analytical partial derivatives of the isotherm and the
+ * implicit function theorem. Thus, the derivative can be used for derivative
+ * annotations of DirectFunctionCalls of Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double w_der_kgkgs:
+ *		Derivative of equilibrium loading in kg/kg/s.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_T_pw_der(double p_Pa, double w_kgkg, double p_der_Pas,
+	double w_der_kgkgs, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_dw_dp_pT_der:
+ * ------------------------
+ *
+ * Calculates total derivative of derivative of equilibrium loading w with
+ * respect to pressure p in kg/kg/Pa/s depending on equilibrium pressure p in
+ * Pa, equilibrium temperature T in K, and their derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium loading wrt. pressure in
+ *		kg/kg/Pa/s.
+ *
+ * Remarks:
+ * --------
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_dw_dp_pT_der(double p_Pa, double T_K,
+	double p_der_Pas, double T_der_Ks, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_dw_dT_pT_der:
+ * ------------------------
+ *
+ * Calculates total derivative of derivative of equilibrium loading w with
+ * respect to temperature T in kg/kg/K/s depending on equilibrium pressure p in
+ * Pa, equilibrium temperature T in K, and their derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium loading wrt. temperature in
+ *		kg/kg/K/s.
+ *
+ * Remarks:
+ * --------
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_dw_dT_pT_der(double p_Pa, double T_K,
+	double p_der_Pas, double T_der_Ks, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_dp_dw_wT_der:
+ * ------------------------
+ *
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to loading w in Pa/(kg/kg)/s depending on equilibrium loading w in
+ * kg/kg, equilibrium temperature T in K, and their derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double w_der_kgkgs:
+ *		Derivative of equilibrium loading in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium pressure wrt. loading in
+ *		Pa/(kg/kg)/s.
+ *
+ * Remarks:
+ * --------
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_dp_dw_wT_der(double w_kgkg, double T_K,
+	double w_der_kgkgs, double T_der_Ks, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_dp_dT_wT_der:
+ * ------------------------
+ *
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to temperature T in Pa/K/s depending on equilibrium loading w in
+ * kg/kg, equilibrium temperature T in K, and their derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double w_der_kgkgs:
+ *		Derivative of equilibrium loading in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium pressure wrt. temperature in
+ *		Pa/K/s.
+ *
+ * Remarks:
+ * --------
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_dp_dT_wT_der(double w_kgkg, double T_K,
+	double w_der_kgkgs, double T_der_Ks, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_piStar_pyxgTM:
+ * -------------------------
+ *
+ * Calculates reduced spreading pressure piStar in kg/mol depending on
+ * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
+ * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
+ * activity coefficient of refrigerant in adsorbed phase, equilibrium
+ * temperature T in K and molar mass of refrigerant M in kg/mol. The reduced
+ * spreading pressure is defined as follows:
+ *
+ * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
+ *		Integral_0^p0{w(p,T) / p * dp}
+ *
+ *	where p0 = p_total*y / (gamma*x)
+ *
+ * Parameters:
+ * -----------
+ *	double p_total_Pa:
+ *		Total pressure of vapor phase in Pa.
+ *	double y_molmol:
+ *		Molar fraction of refrigerant in vapor phase in mol/mol.
+ *	double x_molmol:
+ *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
+ *	double gamma:
+ *		Activity coefficient of refrigerant in adsorbed phase.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double M_kgmol:
+ *		Molar mass of refrigerant M in kg/mol.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Reduced spreading pressure in kg/mol.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_piStar_pyxgTM(double p_total_Pa,
+	double y_molmol, double x_molmol, double gamma, double T_K, double M_kgmol,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_sur_w_pT:
+ * --------------------
+ *
+ * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
+ * p in Pa, equilibrium temperature T in K, and specified working pair.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium loading in kg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
+ *
+ * History:
+ * --------
+ *	03/30/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_sur_w_pT(double p_Pa, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_sur_p_wT:
+ * --------------------
+ *
+ * Calculates equilibrium pressure p in Pa depending on equilibrium temperature
+ * T in K, equilibrium loading w in kg/kg, equilibrium temperature T in K, and
+ * specified working pair.
+ *
+ * Parameters:
+ * -----------
+ * 	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *		Name of calculation approach for liquid density.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
+ *
+ * History:
+ * --------
+ *	03/30/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_sur_p_wT(double w_kgkg, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_sur_T_pw:
+ * --------------------
+ *
+ * Calculates equilibrium temperature in K depending on equilibrium pressure p
+ * in Pa, equilibrium loading w in kg/kg, and specified working pair.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *		Name of calculation approach for liquid density.
+ *
+ * Returns:
+ * --------
+ * 	double:
+ *		Equilibrium temperature in K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
+ *
+ * History:
+ * --------
+ *	03/30/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_sur_T_pw(double p_Pa, double w_kgkg,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * direct_ads_sur_dw_dp_pT:
+ * ------------------------
+ *
+ * Calculates derivative of equilibrium loading w with respect to pressure
+ * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
+ *
+ * History:
+ * --------
+ *	03/30/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double direct_ads_sur_dw_dp_pT(double p_Pa, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * ref_drho_l_dT_T:
- * ----------------
+ * direct_ads_sur_dw_dT_pT:
+ * ------------------------
  *
- * Calculates derivative of saturated liquid density wrt temperature in kg/m³/K
- * depending on equilibrium temperature T in K.
+ * Calculates derivative of equilibrium loading w with respect to temperature
+ * T in kg/kg/K depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of saturated liquid density wrt temperature in kg/m³/K.
+ *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double ref_drho_l_dT_T(double T_K, void *workingPair);
+DLL_API double direct_ads_sur_dw_dT_pT(double p_Pa, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * ref_T_sat_p:
- * ------------
+ * direct_ads_sur_dp_dw_wT:
+ * ------------------------
  *
- * Calculates saturation temperature in K depending on equilibrium pressure p
- * in Pa.
+ * Calculates derivative of equilibrium pressure p with respect to loading
+ * w in kgPa/kg depending on equilibrium loading w in kg/kg and equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Saturation pressure in Pa.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium temperature in K.
+ *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double ref_T_sat_p(double p_Pa, void *workingPair);
+DLL_API double direct_ads_sur_dp_dw_wT(double w_kgkg, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
-/////////////////////////////////////////////////////////////////////////////
-// Definition of function prototypes regarding adsorption working wo struct//
-/////////////////////////////////////////////////////////////////////////////
 /*
- * direct_ads_w_pT:
- * ----------------
+ * direct_ads_sur_dp_dT_wT:
+ * ------------------------
  *
- * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
- * p in Pa, equilibrium temperature T in K, and specified working pair.
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium loading w in kg/kg and equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
  *
@@ -2552,34 +6506,55 @@ DLL_API double ref_T_sat_p(double p_Pa, void *workingPair);
  * Returns:
  * --------
  *	double:
- *		Equilibrium loading in kg/kg.
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
  *
  * History:
  * --------
- *	02/11/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_w_pT(double p_Pa, double T_K,
+DLL_API double direct_ads_sur_dp_dT_wT(double w_kgkg, double T_K,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_p_wT:
- * ----------------
+ * direct_ads_sur_piStar_pyxgTM:
+ * -----------------------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium temperature
- * T in K, equilibrium loading w in kg/kg, equilibrium temperature T in K, and
- * specified working pair.
+ * Calculates reduced spreading pressure piStar in kg/mol depending on
+ * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
+ * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
+ * activity coefficient of refrigerant in adsorbed phase, equilibrium
+ * temperature T in K and molar mass of refrigerant M in kg/mol. The reduced
+ * spreading pressure is defined as follows:
+ *
+ * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
+ *		Integral_0^p0{w(p,T) / p * dp}
+ *
+ *	where p0 = p_total*y / (gamma*x)
  *
  * Parameters:
  * -----------
- * 	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double p_total_Pa:
+ *		Total pressure of vapor phase in Pa.
+ *	double y_molmol:
+ *		Molar fraction of refrigerant in vapor phase in mol/mol.
+ *	double x_molmol:
+ *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
+ *	double gamma:
+ *		Activity coefficient of refrigerant in adsorbed phase.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double M_kgmol:
+ *		Molar mass of refrigerant M in kg/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -2603,38 +6578,45 @@ DLL_API double direct_ads_w_pT(double p_Pa, double T_K,
  *	int no_rhol:
  *		ID of liquid density equation (i.e. when more than one equation is
  *		available)
- *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure in Pa.
+ *		Reduced spreading pressure in kg/mol.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
  *
  * History:
  * --------
- *	02/11/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_p_wT(double w_kgkg, double T_K,
+DLL_API double direct_ads_sur_piStar_pyxgTM(double p_total_Pa,
+	double y_molmol, double x_molmol, double gamma, double T_K, double M_kgmol,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_T_pw:
- * ----------------
+ * direct_ads_sur_w_pTpsat:
+ * ------------------------
  *
- * Calculates equilibrium temperature in K depending on equilibrium pressure p
- * in Pa, equilibrium loading w in kg/kg, and specified working pair.
+ * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
+ * p in Pa, equilibrium temperature T in K, and saturation pressure p_sat in Pa.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
+ * 	double p_Pa:
  *		Equilibrium pressure in Pa.
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -2658,47 +6640,45 @@ DLL_API double direct_ads_p_wT(double w_kgkg, double T_K,
  *	int no_rhol:
  *		ID of liquid density equation (i.e. when more than one equation is
  *		available)
- *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium temperature in K.
+ *	double:
+ *		Equilibrium loading in kg/kg.
  *
  * Remarks:
  * --------
- *	Function uses equation of states implemented for calculation of vapor
- *	pressure, saturated liquid density, derivative of vapor pressure wrt.
- *	temperature, and derivative of saturated liquid density wrt. temperature
- *	when isotherm of working pair is based on volumetric approach (e.g.
- *	Dubinin theory).
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
  *
  * History:
  * --------
- *	02/11/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_T_pw(double p_Pa, double w_kgkg,
-	const char *path_db, const char *wp_as, const char *wp_st,
+DLL_API double direct_ads_sur_w_pTpsat(double p_Pa, double T_K,
+	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_dw_dp_pT:
- * --------------------
+ * direct_ads_sur_p_wTpsat:
+ * ------------------------
  *
- * Calculates derivative of equilibrium loading w with respect to pressure
- * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
+ * in kg/kg, equilibrium temperature T in K, and saturation pressure p_sat in
+ * Pa.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ * 	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -2722,38 +6702,45 @@ DLL_API double direct_ads_T_pw(double p_Pa, double w_kgkg,
  *	int no_rhol:
  *		ID of liquid density equation (i.e. when more than one equation is
  *		available)
+ *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *		Equilibrium pressure in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_dw_dp_pT(double p_Pa, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
+DLL_API double direct_ads_sur_p_wTpsat(double w_kgkg, double T_K,
+	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_dw_dT_pT:
- * --------------------
+ * direct_ads_sur_T_pwpsat:
+ * ------------------------
  *
- * Calculates derivative of equilibrium loading w with respect to temperature
- * T in kg/kg/K depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Calculates equilibrium temperature in K depending on equilibrium pressure p
+ * in Pa, equilibrium loading w in kg/kg, and saturation pressure p_sat in Pa.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
+ *	double p_Pa:
  *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -2777,38 +6764,51 @@ DLL_API double direct_ads_dw_dp_pT(double p_Pa, double T_K,
  *	int no_rhol:
  *		ID of liquid density equation (i.e. when more than one equation is
  *		available)
+ *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
- *	double:
- *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ * 	double:
+ *		Equilibrium temperature in K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *	Uses internal equation of states to calculate vapor pressure and derivative
+ *	of vapor pressure wrt. temperature. If equation of state is not implemented
+ *	for refrigerant, function returns -1 and throws warning. If user want to use
+ *	his own equation of state, this function cannot be used and determination of
+ *	root to calculate T must be implemented by user.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_dw_dT_pT(double p_Pa, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
+DLL_API double direct_ads_sur_T_pwpsat(double p_Pa, double w_kgkg,
+	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_dp_dw_wT:
- * --------------------
+ * direct_ads_sur_dw_dp_pTpsat:
+ * ----------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to loading
- * w in kgPa/kg depending on equilibrium loading w in kg/kg and equilibrium
- * temperature T in K.
+ * Calculates derivative of equilibrium loading w with respect to pressure
+ * p in kg/kg/Pa depending on equilibrium pressure p in Pa, equilibrium
+ * temperature T in K, and saturation pressure p_sat in Pa.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -2836,34 +6836,45 @@ DLL_API double direct_ads_dw_dT_pT(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_dp_dw_wT(double w_kgkg, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
+DLL_API double direct_ads_sur_dw_dp_pTpsat(double p_Pa, double T_K,
+	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_dp_dT_wT:
- * --------------------
+ * direct_ads_sur_dw_dT_pTpsat:
+ * ----------------------------
+ *
+ * Calculates derivative of equilibrium loading w with respect to temperature
+ * T in kg/kg/K depending on equilibrium pressure p in Pa, equilibrium
+ * temperature T in K, saturation pressure p_sat in Pa, and derivative of
+ * saturation pressure wrt. temperature dp_sat_dT in Pa/K.
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium loading w in kg/kg and equilibrium
- * temperature T in K.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	double dp_sat_dT_PaK:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
  *
  *	const char *path_db:
  *		Path to database.
@@ -2891,50 +6902,42 @@ DLL_API double direct_ads_dp_dw_wT(double w_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_dp_dT_wT(double w_kgkg, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_ads_sur_dw_dT_pTpsat(double p_Pa, double T_K,
+	double p_sat_Pa, double dp_sat_dT_PaK, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol);
 
 
 /*
- * direct_ads_piStar_pyxgTM:
- * -------------------------
- *
- * Calculates reduced spreading pressure piStar in kg/mol depending on
- * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
- * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
- * activity coefficient of refrigerant in adsorbed phase, equilibrium
- * temperature T in K and molar mass of refrigerant M in kg/mol. The reduced
- * spreading pressure is defined as follows:
- *
- * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
- *		Integral_0^p0{w(p,T) / p * dp}
+ * direct_ads_sur_dp_dw_wTpsat:
+ * ----------------------------
  *
- *	where p0 = p_total*y / (gamma*x)
+ * Calculates derivative of equilibrium pressure p with respect to loading
+ * w in kgPa/kg depending on equilibrium loading w in kg/kg, equilibrium
+ * temperature T in K, and saturation pressure p_sat in Pa.
  *
  * Parameters:
  * -----------
- *	double p_total_Pa:
- *		Total pressure of vapor phase in Pa.
- *	double y_molmol:
- *		Molar fraction of refrigerant in vapor phase in mol/mol.
- *	double x_molmol:
- *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
- *	double gamma:
- *		Activity coefficient of refrigerant in adsorbed phase.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double M_kgmol:
- *		Molar mass of refrigerant M in kg/mol.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -2962,34 +6965,44 @@ DLL_API double direct_ads_dp_dT_wT(double w_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Reduced spreading pressure in kg/mol.
+ *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_piStar_pyxgTM(double p_total_Pa,
-	double y_molmol, double x_molmol, double gamma, double T_K, double M_kgmol,
-	const char *path_db, const char *wp_as, const char *wp_st,
+DLL_API double direct_ads_sur_dp_dw_wTpsat(double w_kgkg, double T_K,
+	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_sur_w_pT:
- * --------------------
+ * direct_ads_sur_dp_dT_wTpsat:
+ * ----------------------------
  *
- * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
- * p in Pa, equilibrium temperature T in K, and specified working pair.
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium loading w in kg/kg, equilibrium
+ * temperature T in K, saturation pressure p_sat in Pa, and derivative of
+ * saturation pressure wrt. temperature dp_sat_dT in Pa/K.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	double dp_sat_dT_PaK:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
  *
  *	const char *path_db:
  *		Path to database.
@@ -3017,12 +7030,12 @@ DLL_API double direct_ads_piStar_pyxgTM(double p_total_Pa,
  * Returns:
  * --------
  *	double:
- *		Equilibrium loading in kg/kg.
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
  *
  * Remarks:
  * --------
  *	This function is only valid for isotherm models based on the surface
- *	approach.
+ *	approach using the saturated vapor pressure as additional argument.
  *
  * History:
  * --------
@@ -3030,26 +7043,46 @@ DLL_API double direct_ads_piStar_pyxgTM(double p_total_Pa,
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_w_pT(double p_Pa, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_ads_sur_dp_dT_wTpsat(double w_kgkg, double T_K,
+	double p_sat_Pa, double dp_sat_dT_PaK, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol);
 
 
 /*
- * direct_ads_sur_p_wT:
- * --------------------
+ * direct_ads_sur_piStar_pyxgTpsatM:
+ * ---------------------------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium temperature
- * T in K, equilibrium loading w in kg/kg, equilibrium temperature T in K, and
- * specified working pair.
+ * Calculates reduced spreading pressure piStar in kg/mol depending on
+ * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
+ * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
+ * activity coefficient of refrigerant in adsorbed phase, equilibrium
+ * temperature T in K, saturation pressure p_sat in Pa, and molar mass of
+ * refrigerant M in kg/mol. The reduced spreading pressure is defined as
+ * follows:
+ *
+ * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
+ *		Integral_0^p0{w(p,T) / p * dp}
+ *
+ *	where p0 = p_total*y / (gamma*x)
  *
  * Parameters:
  * -----------
- * 	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double p_total_Pa:
+ *		Total pressure of vapor phase in Pa.
+ *	double y_molmol:
+ *		Molar fraction of refrigerant in vapor phase in mol/mol.
+ *	double x_molmol:
+ *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
+ *	double gamma:
+ *		Activity coefficient of refrigerant in adsorbed phase.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ *	double M_kgmol:
+ *		Molar mass of refrigerant M in kg/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -3073,17 +7106,16 @@ DLL_API double direct_ads_sur_w_pT(double p_Pa, double T_K,
  *	int no_rhol:
  *		ID of liquid density equation (i.e. when more than one equation is
  *		available)
- *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure in Pa.
+ *		Reduced spreading pressure in kg/mol.
  *
  * Remarks:
  * --------
  *	This function is only valid for isotherm models based on the surface
- *	approach.
+ *	approach using the saturated vapor pressure as additional argument.
  *
  * History:
  * --------
@@ -3091,25 +7123,27 @@ DLL_API double direct_ads_sur_w_pT(double p_Pa, double T_K,
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_p_wT(double w_kgkg, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
+DLL_API double direct_ads_sur_piStar_pyxgTpsatM(double p_total_Pa,
+	double y_molmol, double x_molmol, double gamma, double T_K, double p_sat_Pa,
+	double M_kgmol, const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_sur_T_pw:
- * --------------------
+ * direct_ads_vol_W_ARho:
+ * ----------------------
  *
- * Calculates equilibrium temperature in K depending on equilibrium pressure p
- * in Pa, equilibrium loading w in kg/kg, and specified working pair.
+ * Calculates equilibrium volumetric loading W in m³/kg depending on equilibrium
+ * adsorption potential A in J/mol and saturated liquid density of adsorpt rho_l
+ * in kg/m3.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ * 	double A_Jmol:
+ *		Equilibrium adsorption potential A in J/mol.
+ * 	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
  *
  *	const char *path_db:
  *		Path to database.
@@ -3133,44 +7167,47 @@ DLL_API double direct_ads_sur_p_wT(double w_kgkg, double T_K,
  *	int no_rhol:
  *		ID of liquid density equation (i.e. when more than one equation is
  *		available)
- *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium temperature in K.
+ *	double:
+ *		Equilibrium volumetric loading W in m³/kg.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
+ *	This function is only valid for isotherm models based on the volumetric
  *	approach.
+ *	Saturated liquid density of adsorpt is required to calculate volumetric
+ *	loading from characteristic curve in m3/kg when coefficients would directly
+ *	return loading w in kg/kg. Therefore, function checks unit of coefficients
+ *	by checking isotherm coefficients.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_T_pw(double p_Pa, double w_kgkg,
+DLL_API double direct_ads_vol_W_ARho(double A_Jmol, double rho_l_kgm3,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_sur_dw_dp_pT:
- * ------------------------
- *
- * Calculates derivative of equilibrium loading w with respect to pressure
- * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * direct_ads_vol_A_WRho:
+ * ----------------------
  *
- * Parameters:
- * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
+ * Calculates equilibrium adsorption potential A in J/mol depending on
+ * equilibrium volumetric loading W in m³/kg and saturated liquid density of
+ * adsorpt rho_l in kg/m3.
+ *
+ * Parameters:
+ * -----------
+ * 	double W_m3kg:
+ *		Equilibrium volumetric loading W in m³/kg.
+ * 	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
  *
  *	const char *path_db:
  *		Path to database.
@@ -3198,32 +7235,35 @@ DLL_API double direct_ads_sur_T_pw(double p_Pa, double w_kgkg,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *		Equilibrium adsorption potential A in J/mol.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
+ *	This function is only valid for isotherm models based on the volumetric
  *	approach.
+ *	Saturated liquid density of adsorpt is required to calculate volumetric
+ *	loading from characteristic curve in m3/kg when coefficients would directly
+ *	return loading w in kg/kg.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_dw_dp_pT(double p_Pa, double T_K,
+DLL_API double direct_ads_vol_A_WRho(double W_m3kg, double rho_l_kgm3,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_sur_dw_dT_pT:
- * ------------------------
+ * direct_ads_vol_w_pTpsatRho:
+ * ---------------------------
  *
- * Calculates derivative of equilibrium loading w with respect to temperature
- * T in kg/kg/K depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
+ * p in Pa, equilibrium temperature T in K, saturation pressure p_Sat in Pa and
+ * saturated liquid density of adsorpt rho in kg/m³.
  *
  * Parameters:
  * -----------
@@ -3231,6 +7271,10 @@ DLL_API double direct_ads_sur_dw_dp_pT(double p_Pa, double T_K,
  *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt in kg/m³.
  *
  *	const char *path_db:
  *		Path to database.
@@ -3258,39 +7302,43 @@ DLL_API double direct_ads_sur_dw_dp_pT(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *		Equilibrium loading in kg/kg.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
+ *	This function is only valid for isotherm models based on the volumetric
  *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_dw_dT_pT(double p_Pa, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_ads_vol_w_pTpsatRho(double p_Pa, double T_K,
+	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_sur_dp_dw_wT:
- * ------------------------
+ * direct_ads_vol_p_wTpsatRho:
+ * ---------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to loading
- * w in kgPa/kg depending on equilibrium loading w in kg/kg and equilibrium
- * temperature T in K.
+ * Calculates equilibrium pressure p in Pa depending on equilibrium loading w in
+ * kg/kg, equilibrium temperature T in K, saturation pressure p_Sat in Pa and
+ * density of adsorpt rho in kg/m³.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
+ * 	double w_kgkg:
  *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
  *
  *	const char *path_db:
  *		Path to database.
@@ -3318,39 +7366,43 @@ DLL_API double direct_ads_sur_dw_dT_pT(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *		Equilibrium pressure in Pa.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
+ *	This function is only valid for isotherm models based on the volumetric
  *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_dp_dw_wT(double w_kgkg, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_ads_vol_p_wTpsatRho(double w_kgkg, double T_K,
+	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_sur_dp_dT_wT:
- * ------------------------
+ * direct_ads_vol_T_pwpsatRho:
+ * ---------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium loading w in kg/kg and equilibrium
- * temperature T in K.
+ * Calculates equilibrium temperature T in K depending on equilibrium pressure
+ * in Pa, equilibrium loading w in kg/kg, saturation pressure p_Sat in Pa and
+ * density of adsorpt rho in kg/m³.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ * 	double w_kgkg:
  *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
  *
  *	const char *path_db:
  *		Path to database.
@@ -3378,55 +7430,46 @@ DLL_API double direct_ads_sur_dp_dw_wT(double w_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *		Equilibrium temperature in K.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
+ *	This function is only valid for isotherm models based on the volumetric
  *	approach.
+ *	Uses internal equation of states to calculate vapor pressure, saturated
+ *	liquid density of adsorpt, derivative of vapor pressure wrt. temperature
+ *	and derivative of saturated liquid density of adsorpt wrt. temperature. If
+ *	equation of states are not implemented for refrigerant, function returns -1
+ *  and throws warning. If user want to use his own equation of states, this
+ *  function cannot be used and determination of root to calculate T must
+ *  be implemented by user.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_dp_dT_wT(double w_kgkg, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_ads_vol_T_pwpsatRho(double p_Pa, double w_kgkg,
+	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_sur_piStar_pyxgTM:
- * -----------------------------
- *
- * Calculates reduced spreading pressure piStar in kg/mol depending on
- * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
- * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
- * activity coefficient of refrigerant in adsorbed phase, equilibrium
- * temperature T in K and molar mass of refrigerant M in kg/mol. The reduced
- * spreading pressure is defined as follows:
- *
- * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
- *		Integral_0^p0{w(p,T) / p * dp}
+ * direct_ads_vol_dW_dA_ARho:
+ * --------------------------
  *
- *	where p0 = p_total*y / (gamma*x)
+ * Calculates derivative of equilibrium volumetric loading dW_dA in m³mol/kg/J
+ * depending on equilibrium adsorption potential A in J/mol and saturated liquid
+ * density of adsorpt rho_l in kg/m3.
  *
  * Parameters:
  * -----------
- *	double p_total_Pa:
- *		Total pressure of vapor phase in Pa.
- *	double y_molmol:
- *		Molar fraction of refrigerant in vapor phase in mol/mol.
- *	double x_molmol:
- *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
- *	double gamma:
- *		Activity coefficient of refrigerant in adsorbed phase.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double M_kgmol:
- *		Molar mass of refrigerant M in kg/mol.
+ * 	double A_Jmol:
+ *		Equilibrium adsorption potential A in J/mol.
+ * 	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
  *
  *	const char *path_db:
  *		Path to database.
@@ -3454,41 +7497,43 @@ DLL_API double direct_ads_sur_dp_dT_wT(double w_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Reduced spreading pressure in kg/mol.
+ *		Derivative of volumetric loading wrt. adsorption potential in
+ *		m³mol/kg/J.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
+ *	This function is only valid for isotherm models based on the volumetric
  *	approach.
+ *	Saturated liquid density of adsorpt is required to calculate volumetric
+ *	loading from characteristic curve in m3/kg when coefficients would directly
+ *	return loading w in kg/kg.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_piStar_pyxgTM(double p_total_Pa,
-	double y_molmol, double x_molmol, double gamma, double T_K, double M_kgmol,
+DLL_API double direct_ads_vol_dW_dA_ARho(double A_Jmol, double rho_l_kgm3,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_sur_w_pTpsat:
- * ------------------------
+ * direct_ads_vol_dA_dW_WRho:
+ * --------------------------
  *
- * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
- * p in Pa, equilibrium temperature T in K, and saturation pressure p_sat in Pa.
+ * Calculates derivative of equilibrium adsorption potential dA_dW in kgJ/mol/m³
+ * depending on equilibrium volumetric loading W in m³/kg and saturated liquid
+ * density of adsorpt rho_l in kg/m3.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ * 	double W_m3kg:
+ *		Equilibrium volumetric loading W in m³/kg.
+ * 	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
  *
  *	const char *path_db:
  *		Path to database.
@@ -3516,41 +7561,48 @@ DLL_API double direct_ads_sur_piStar_pyxgTM(double p_total_Pa,
  * Returns:
  * --------
  *	double:
- *		Equilibrium loading in kg/kg.
+ *		Derivative of adsorption potential wrt. volumetric loading in
+ *		kgJ/mol/m³.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *	Saturated liquid density of adsorpt is required to calculate volumetric
+ *	loading from characteristic curve in m3/kg when coefficients would directly
+ *	return loading w in kg/kg.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_w_pTpsat(double p_Pa, double T_K,
-	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
+DLL_API double direct_ads_vol_dA_dW_WRho(double W_m3kg, double rho_l_kgm3,
+	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_sur_p_wTpsat:
- * ------------------------
+ * direct_ads_vol_dw_dp_pTpsatRho:
+ * -------------------------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
- * in kg/kg, equilibrium temperature T in K, and saturation pressure p_sat in
- * Pa.
+ * Calculates derivative of equilibrium loading dw_dp with respect to pressure
+ * in kg/kg/Pa depending on equilibrium pressure p in Pa, equilibrium
+ * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
+ * rho in kg/m³.
  *
  * Parameters:
  * -----------
- * 	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
  *
  *	const char *path_db:
  *		Path to database.
@@ -3574,45 +7626,54 @@ DLL_API double direct_ads_sur_w_pTpsat(double p_Pa, double T_K,
  *	int no_rhol:
  *		ID of liquid density equation (i.e. when more than one equation is
  *		available)
- *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure in Pa.
+ *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_p_wTpsat(double w_kgkg, double T_K,
-	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_ads_vol_dw_dp_pTpsatRho(double p_Pa, double T_K,
+	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_sur_T_pwpsat:
- * ------------------------
+ * direct_ads_vol_dw_dT_pTpsatRho:
+ * -------------------------------
  *
- * Calculates equilibrium temperature in K depending on equilibrium pressure p
- * in Pa, equilibrium loading w in kg/kg, and saturation pressure p_sat in Pa.
+ * Calculates derivative of equilibrium loading dw_dp with respect to
+ * temperature in kg/kg/K depending on equilibrium pressure p in Pa, equilibrium
+ * temperature T in K, saturation pressure p_Sat in Pa, density of adsorpt
+ * rho in kg/m³, derivative of saturation pressure with respect to temperature
+ * dp_sat_dT in Pa/K and derivative of density of adsorpt with respect to
+ * temperature drho_dT in kg/m³/K.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ * 	double dp_sat_dT_PaK:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ *	double drho_dT_kgm3K:
+ *		Derivative of density of adsorpt wrt. temperature in kg/m³/K.
  *
  *	const char *path_db:
  *		Path to database.
@@ -3636,51 +7697,49 @@ DLL_API double direct_ads_sur_p_wTpsat(double w_kgkg, double T_K,
  *	int no_rhol:
  *		ID of liquid density equation (i.e. when more than one equation is
  *		available)
- *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium temperature in K.
+ *	double:
+ *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
- *	Uses internal equation of states to calculate vapor pressure and derivative
- *	of vapor pressure wrt. temperature. If equation of state is not implemented
- *	for refrigerant, function returns -1 and throws warning. If user want to use
- *	his own equation of state, this function cannot be used and determination of
- *	root to calculate T must be implemented by user.
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_T_pwpsat(double p_Pa, double w_kgkg,
-	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_ads_vol_dw_dT_pTpsatRho(double p_Pa, double T_K,
+	double p_sat_Pa, double rho_kgm3, double dp_sat_dT_PaK,
+	double drho_dT_kgm3K, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_sur_dw_dp_pTpsat:
- * ----------------------------
+ * direct_ads_vol_dp_dw_wTpsatRho:
+ * -------------------------------
  *
- * Calculates derivative of equilibrium loading w with respect to pressure
- * p in kg/kg/Pa depending on equilibrium pressure p in Pa, equilibrium
- * temperature T in K, and saturation pressure p_sat in Pa.
+ * Calculates derivative of equilibrium pressure p with respect to loading
+ * w in kgPa/kg depending on equilibrium loading w in kg/kg, equilibrium
+ * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
+ * rho in kg/m³.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
  *
  *	const char *path_db:
  *		Path to database.
@@ -3708,45 +7767,50 @@ DLL_API double direct_ads_sur_T_pwpsat(double p_Pa, double w_kgkg,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_dw_dp_pTpsat(double p_Pa, double T_K,
-	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_ads_vol_dp_dw_wTpsatRho(double w_kgkg, double T_K,
+	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_sur_dw_dT_pTpsat:
- * ----------------------------
- *
- * Calculates derivative of equilibrium loading w with respect to temperature
- * T in kg/kg/K depending on equilibrium pressure p in Pa, equilibrium
- * temperature T in K, saturation pressure p_sat in Pa, and derivative of
- * saturation pressure wrt. temperature dp_sat_dT in Pa/K.
+ * direct_ads_vol_dp_dT_wTpsatRho:
+ * -------------------------------
  *
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium loading w in kg/kg, equilibrium
+ * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
+ * rho in kg/m³, derivative of saturation pressure with respect to temperature
+ * dp_sat_dT in Pa/K and derivative of density of adsorpt with respect to
+ * temperature drho_dT in kg/m³/K.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
  * 	double dp_sat_dT_PaK:
  *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ *	double drho_dT_kgm3K:
+ *		Derivative of density of adsorpt wrt. temperature in kg/m³/K.
  *
  *	const char *path_db:
  *		Path to database.
@@ -3774,42 +7838,61 @@ DLL_API double direct_ads_sur_dw_dp_pTpsat(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_dw_dT_pTpsat(double p_Pa, double T_K,
-	double p_sat_Pa, double dp_sat_dT_PaK, const char *path_db,
-	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
-	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
-	int no_rhol);
+DLL_API double direct_ads_vol_dp_dT_wTpsatRho(double w_kgkg, double T_K,
+	double p_sat_Pa, double rho_kgm3, double dp_sat_dT_PaK,
+	double drho_dT_kgm3K, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_sur_dp_dw_wTpsat:
- * ----------------------------
+ * direct_ads_vol_piStar_pyxgTpsatRhoM:
+ * ------------------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to loading
- * w in kgPa/kg depending on equilibrium loading w in kg/kg, equilibrium
- * temperature T in K, and saturation pressure p_sat in Pa.
+ * Calculates reduced spreading pressure in kg/mol depending on equilibrium
+ * pressure p in Pa, molar fraction of refrigerant in vapor phase in mol/mol,
+ * molar fraction of refrigerant in adsorbed phase in mol/mol, activity
+ * coefficient of refrigerant in adsorbed phase, equilibrium temperature T in K,
+ * saturation pressure p_Sat in Pa and density of adsorpt rho in kg/m³ and molar
+ * mass of refrigerant M in kg/mol. The reduced spreading pressure is defined as
+ * follows:
+ *
+ * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
+ *		Integral_0^p0{w(p,T) / p * dp}
+ *
+ *	where p0 = p_total*y / (gamma*x)
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double p_total_Pa:
+ *		Total pressure of vapor phase in Pa.
+ *	double y_molmol:
+ *		Molar fraction of refrigerant in vapor phase in mol/mol.
+ *	double x_molmol:
+ *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
+ *	double gamma:
+ *		Activity coefficient of refrigerant in adsorbed phase.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ *	double M_kgmol:
+ *		Molar mass of refrigerant M in kg/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -3837,44 +7920,42 @@ DLL_API double direct_ads_sur_dw_dT_pTpsat(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *		Reduced spreading pressure in kg/mol.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_dp_dw_wTpsat(double w_kgkg, double T_K,
-	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_ads_vol_piStar_pyxgTpsatRhoM(double p_total_Pa,
+	double y_molmol, double x_molmol, double gamma, double T_K, double p_sat_Pa,
+	double rho_kgm3, double M_kgmol, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
+/////////////////////////////////////////////////////////////////////////////
+// Definition of function prototypes regarding absorption working wo struct//
+/////////////////////////////////////////////////////////////////////////////
 /*
- * direct_ads_sur_dp_dT_wTpsat:
- * ----------------------------
+ * direct_abs_con_X_pT:
+ * --------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium loading w in kg/kg, equilibrium
- * temperature T in K, saturation pressure p_sat in Pa, and derivative of
- * saturation pressure wrt. temperature dp_sat_dT in Pa/K.
+ * Calculates equilibrium concentration X in kg/kg depending on equilibrium
+ * pressure p in Pa and equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
- * 	double dp_sat_dT_PaK:
- *		Derivative of saturation pressure wrt. temperature in Pa/K.
  *
  *	const char *path_db:
  *		Path to database.
@@ -3902,59 +7983,38 @@ DLL_API double direct_ads_sur_dp_dw_wTpsat(double w_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *		Equilibrium concentration in kg/kg.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_dp_dT_wTpsat(double w_kgkg, double T_K,
-	double p_sat_Pa, double dp_sat_dT_PaK, const char *path_db,
-	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
-	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
-	int no_rhol);
+DLL_API double direct_abs_con_X_pT(double p_Pa, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_sur_piStar_pyxgTpsatM:
- * ---------------------------------
- *
- * Calculates reduced spreading pressure piStar in kg/mol depending on
- * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
- * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
- * activity coefficient of refrigerant in adsorbed phase, equilibrium
- * temperature T in K, saturation pressure p_sat in Pa, and molar mass of
- * refrigerant M in kg/mol. The reduced spreading pressure is defined as
- * follows:
- *
- * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
- *		Integral_0^p0{w(p,T) / p * dp}
+ * direct_abs_con_p_XT:
+ * --------------------
  *
- *	where p0 = p_total*y / (gamma*x)
+ * Calculates equilibrium pressure p in Pa depending on equilibrium
+ * concentration X in kg/kg and equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
- *	double p_total_Pa:
- *		Total pressure of vapor phase in Pa.
- *	double y_molmol:
- *		Molar fraction of refrigerant in vapor phase in mol/mol.
- *	double x_molmol:
- *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
- *	double gamma:
- *		Activity coefficient of refrigerant in adsorbed phase.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
- *	double M_kgmol:
- *		Molar mass of refrigerant M in kg/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -3981,41 +8041,39 @@ DLL_API double direct_ads_sur_dp_dT_wTpsat(double w_kgkg, double T_K,
  *
  * Returns:
  * --------
- *	double:
- *		Reduced spreading pressure in kg/mol.
+ * 	double:
+ *		Equilibrium pressure in Pa.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_piStar_pyxgTpsatM(double p_total_Pa,
-	double y_molmol, double x_molmol, double gamma, double T_K, double p_sat_Pa,
-	double M_kgmol, const char *path_db, const char *wp_as, const char *wp_st,
+DLL_API double direct_abs_con_p_XT(double X_kgkg, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_vol_W_ARho:
- * ----------------------
+ * direct_abs_con_T_pX:
+ * --------------------
  *
- * Calculates equilibrium volumetric loading W in m³/kg depending on equilibrium
- * adsorption potential A in J/mol and saturated liquid density of adsorpt rho_l
- * in kg/m3.
+ * Calculates equilibrium temperature in K depending on equilibrium pressure p
+ * in Pa and equilibrium concentration X in kg/kg.
  *
  * Parameters:
  * -----------
- * 	double A_Jmol:
- *		Equilibrium adsorption potential A in J/mol.
- * 	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4042,17 +8100,13 @@ DLL_API double direct_ads_sur_piStar_pyxgTpsatM(double p_total_Pa,
  *
  * Returns:
  * --------
- *	double:
- *		Equilibrium volumetric loading W in m³/kg.
+ * 	double:
+ *		Equilibrium temperature in K.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
+ *	This function is only valid for isotherm models based on the conventional
  *	approach.
- *	Saturated liquid density of adsorpt is required to calculate volumetric
- *	loading from characteristic curve in m3/kg when coefficients would directly
- *	return loading w in kg/kg. Therefore, function checks unit of coefficients
- *	by checking isotherm coefficients.
  *
  * History:
  * --------
@@ -4060,26 +8114,26 @@ DLL_API double direct_ads_sur_piStar_pyxgTpsatM(double p_total_Pa,
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_W_ARho(double A_Jmol, double rho_l_kgm3,
+DLL_API double direct_abs_con_T_pX(double p_Pa, double X_kgkg,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_vol_A_WRho:
- * ----------------------
+ * direct_abs_con_dX_dp_pT:
+ * ------------------------
  *
- * Calculates equilibrium adsorption potential A in J/mol depending on
- * equilibrium volumetric loading W in m³/kg and saturated liquid density of
- * adsorpt rho_l in kg/m3.
+ * Calculates derivative of equilibrium concentration X with respect to pressure
+ * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
- * 	double W_m3kg:
- *		Equilibrium volumetric loading W in m³/kg.
- * 	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4107,15 +8161,12 @@ DLL_API double direct_ads_vol_W_ARho(double A_Jmol, double rho_l_kgm3,
  * Returns:
  * --------
  *	double:
- *		Equilibrium adsorption potential A in J/mol.
+ *		Derivative of equilibrium concentration wrt. pressure in kg/kg/Pa.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
+ *	This function is only valid for isotherm models based on the conventional
  *	approach.
- *	Saturated liquid density of adsorpt is required to calculate volumetric
- *	loading from characteristic curve in m3/kg when coefficients would directly
- *	return loading w in kg/kg.
  *
  * History:
  * --------
@@ -4123,19 +8174,19 @@ DLL_API double direct_ads_vol_W_ARho(double A_Jmol, double rho_l_kgm3,
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_A_WRho(double W_m3kg, double rho_l_kgm3,
+DLL_API double direct_abs_con_dX_dp_pT(double p_Pa, double T_K,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_vol_w_pTpsatRho:
- * ---------------------------
+ * direct_abs_con_dX_dT_pT:
+ * ------------------------
  *
- * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
- * p in Pa, equilibrium temperature T in K, saturation pressure p_Sat in Pa and
- * saturated liquid density of adsorpt rho in kg/m³.
+ * Calculates derivative of equilibrium concentration X with respect to
+ * temperature T in kg/kg/K depending on equilibrium pressure p in Pa and
+ * equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
@@ -4143,10 +8194,6 @@ DLL_API double direct_ads_vol_A_WRho(double W_m3kg, double rho_l_kgm3,
  *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt in kg/m³.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4174,11 +8221,11 @@ DLL_API double direct_ads_vol_A_WRho(double W_m3kg, double rho_l_kgm3,
  * Returns:
  * --------
  *	double:
- *		Equilibrium loading in kg/kg.
+ *		Derivative of equilibrium concentration wrt. temperature in kg/kg/K.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
+ *	This function is only valid for isotherm models based on the conventional
  *	approach.
  *
  * History:
@@ -4187,30 +8234,26 @@ DLL_API double direct_ads_vol_A_WRho(double W_m3kg, double rho_l_kgm3,
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_w_pTpsatRho(double p_Pa, double T_K,
-	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
-	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
-	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_abs_con_dX_dT_pT(double p_Pa, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_vol_p_wTpsatRho:
- * ---------------------------
+ * direct_abs_con_dp_dX_XT:
+ * ------------------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium loading w in
- * kg/kg, equilibrium temperature T in K, saturation pressure p_Sat in Pa and
- * density of adsorpt rho in kg/m³.
+ * Calculates derivative of equilibrium pressure p with respect to concentration
+ * w in kgPa/kg depending on equilibrium concentration X in kg/kg and
+ * equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
- * 	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4238,11 +8281,11 @@ DLL_API double direct_ads_vol_w_pTpsatRho(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure in Pa.
+ *		Derivative of equilibrium pressure wrt. concentration in Pakg/kg.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
+ *	This function is only valid for isotherm models based on the conventional
  *	approach.
  *
  * History:
@@ -4251,30 +8294,26 @@ DLL_API double direct_ads_vol_w_pTpsatRho(double p_Pa, double T_K,
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_p_wTpsatRho(double w_kgkg, double T_K,
-	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
-	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
-	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_abs_con_dp_dX_XT(double X_kgkg, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_vol_T_pwpsatRho:
- * ---------------------------
+ * direct_abs_con_dp_dT_XT:
+ * ------------------------
  *
- * Calculates equilibrium temperature T in K depending on equilibrium pressure
- * in Pa, equilibrium loading w in kg/kg, saturation pressure p_Sat in Pa and
- * density of adsorpt rho in kg/m³.
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium concentration X in kg/kg and
+ * equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure in Pa.
- * 	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4302,19 +8341,12 @@ DLL_API double direct_ads_vol_p_wTpsatRho(double w_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Equilibrium temperature in K.
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
+ *	This function is only valid for isotherm models based on the conventional
  *	approach.
- *	Uses internal equation of states to calculate vapor pressure, saturated
- *	liquid density of adsorpt, derivative of vapor pressure wrt. temperature
- *	and derivative of saturated liquid density of adsorpt wrt. temperature. If
- *	equation of states are not implemented for refrigerant, function returns -1
- *  and throws warning. If user want to use his own equation of states, this
- *  function cannot be used and determination of root to calculate T must
- *  be implemented by user.
  *
  * History:
  * --------
@@ -4322,26 +8354,32 @@ DLL_API double direct_ads_vol_p_wTpsatRho(double w_kgkg, double T_K,
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_T_pwpsatRho(double p_Pa, double w_kgkg,
-	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
-	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
-	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_abs_con_dp_dT_XT(double X_kgkg, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_vol_dW_dA_ARho:
- * --------------------------
+ * direct_abs_con_X_pT_der:
+ * ------------------------
  *
- * Calculates derivative of equilibrium volumetric loading dW_dA in m³mol/kg/J
- * depending on equilibrium adsorption potential A in J/mol and saturated liquid
- * density of adsorpt rho_l in kg/m3.
+ * Calculates total derivative of equilibrium concentration X in kg/kg/s
+ * depending on equilibrium pressure p in Pa, equilibrium temperature T in K,
+ * and their derivatives by the analytical partial derivatives of the isotherm.
+ * Thus, the derivative can be used for derivative annotations of
+ * DirectFunctionCalls of Modelica.
  *
  * Parameters:
  * -----------
- * 	double A_Jmol:
- *		Equilibrium adsorption potential A in J/mol.
- * 	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4369,43 +8407,40 @@ DLL_API double direct_ads_vol_T_pwpsatRho(double p_Pa, double w_kgkg,
  * Returns:
  * --------
  *	double:
- *		Derivative of volumetric loading wrt. adsorption potential in
- *		m³mol/kg/J.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
- *	Saturated liquid density of adsorpt is required to calculate volumetric
- *	loading from characteristic curve in m3/kg when coefficients would directly
- *	return loading w in kg/kg.
+ *		Derivative of equilibrium concentration in kg/kg/s.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_dW_dA_ARho(double A_Jmol, double rho_l_kgm3,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_abs_con_X_pT_der(double p_Pa, double T_K,
+	double p_der_Pas, double T_der_Ks, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_vol_dA_dW_WRho:
- * --------------------------
+ * direct_abs_con_p_XT_der:
+ * ------------------------
  *
- * Calculates derivative of equilibrium adsorption potential dA_dW in kgJ/mol/m³
- * depending on equilibrium volumetric loading W in m³/kg and saturated liquid
- * density of adsorpt rho_l in kg/m3.
+ * Calculates total derivative of equilibrium pressure p in Pa/s depending on
+ * equilibrium concentration X in kg/kg, equilibrium temperature T in K, and
+ * their derivatives by the analytical partial derivatives of the isotherm.
+ * Thus, the derivative can be used for derivative annotations of
+ * DirectFunctionCalls of Modelica.
  *
  * Parameters:
  * -----------
- * 	double W_m3kg:
- *		Equilibrium volumetric loading W in m³/kg.
- * 	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double X_der_kgkgs:
+ *		Derivative of equilibrium concentration in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4433,48 +8468,40 @@ DLL_API double direct_ads_vol_dW_dA_ARho(double A_Jmol, double rho_l_kgm3,
  * Returns:
  * --------
  *	double:
- *		Derivative of adsorption potential wrt. volumetric loading in
- *		kgJ/mol/m³.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
- *	Saturated liquid density of adsorpt is required to calculate volumetric
- *	loading from characteristic curve in m3/kg when coefficients would directly
- *	return loading w in kg/kg.
+ *		Derivative of equilibrium pressure in Pa/s.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_dA_dW_WRho(double W_m3kg, double rho_l_kgm3,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_abs_con_p_XT_der(double X_kgkg, double T_K,
+	double X_der_kgkgs, double T_der_Ks, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_vol_dw_dp_pTpsatRho:
- * -------------------------------
+ * direct_abs_con_T_pX_der:
+ * ------------------------
  *
- * Calculates derivative of equilibrium loading dw_dp with respect to pressure
- * in kg/kg/Pa depending on equilibrium pressure p in Pa, equilibrium
- * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
- * rho in kg/m³.
+ * Calculates total derivative of equilibrium temperature T in K/s depending on
+ * equilibrium pressure p in Pa, equilibrium concentration X in kg/kg, and their
+ * derivatives by the analytical partial derivatives of the isotherm and the
+ * implicit function theorem. Thus, the derivative can be used for derivative
+ * annotations of DirectFunctionCalls of Modelica.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
+ *	double p_Pa:
  *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double X_der_kgkgs:
+ *		Derivative of equilibrium concentration in kg/kg/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4502,50 +8529,39 @@ DLL_API double direct_ads_vol_dA_dW_WRho(double W_m3kg, double rho_l_kgm3,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *		Derivative of equilibrium temperature in K/s.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_dw_dp_pTpsatRho(double p_Pa, double T_K,
-	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
-	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
-	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_abs_con_T_pX_der(double p_Pa, double X_kgkg,
+	double p_der_Pas, double X_der_kgkgs, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol);
 
 
 /*
- * direct_ads_vol_dw_dT_pTpsatRho:
- * -------------------------------
- *
- * Calculates derivative of equilibrium loading dw_dp with respect to
- * temperature in kg/kg/K depending on equilibrium pressure p in Pa, equilibrium
- * temperature T in K, saturation pressure p_Sat in Pa, density of adsorpt
- * rho in kg/m³, derivative of saturation pressure with respect to temperature
- * dp_sat_dT in Pa/K and derivative of density of adsorpt with respect to
- * temperature drho_dT in kg/m³/K.
+ * direct_abs_con_dX_dp_pT_der:
+ * ----------------------------
+ *
+ * Calculates total derivative of derivative of equilibrium concentration X with
+ * respect to pressure p in kg/kg/Pa/s depending on equilibrium pressure p in
+ * Pa, equilibrium temperature T in K, and their derivatives.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
+ *	double p_Pa:
  *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
- * 	double dp_sat_dT_PaK:
- *		Derivative of saturation pressure wrt. temperature in Pa/K.
- *	double drho_dT_kgm3K:
- *		Derivative of density of adsorpt wrt. temperature in kg/m³/K.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4573,45 +8589,48 @@ DLL_API double direct_ads_vol_dw_dp_pTpsatRho(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *		Derivative of derivative of equilibrium concentration wrt. pressure in
+ *		kg/kg/Pa/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_dw_dT_pTpsatRho(double p_Pa, double T_K,
-	double p_sat_Pa, double rho_kgm3, double dp_sat_dT_PaK,
-	double drho_dT_kgm3K, const char *path_db, const char *wp_as,
+DLL_API double direct_abs_con_dX_dp_pT_der(double p_Pa, double T_K,
+	double p_der_Pas, double T_der_Ks, const char *path_db, const char *wp_as,
 	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
 	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_vol_dp_dw_wTpsatRho:
- * -------------------------------
+ * direct_abs_con_dX_dT_pT_der:
+ * ----------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to loading
- * w in kgPa/kg depending on equilibrium loading w in kg/kg, equilibrium
- * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
- * rho in kg/m³.
+ * Calculates total derivative of derivative of equilibrium concentration X with
+ * respect to temperature T in kg/kg/K/s depending on equilibrium pressure p in
+ * Pa, equilibrium temperature T in K, and their derivatives.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4639,50 +8658,49 @@ DLL_API double direct_ads_vol_dw_dT_pTpsatRho(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *		Derivative of derivative of equilibrium concentration wrt. temperature
+ *		in kg/kg/K/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_dp_dw_wTpsatRho(double w_kgkg, double T_K,
-	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
+DLL_API double direct_abs_con_dX_dT_pT_der(double p_Pa, double T_K,
+	double p_der_Pas, double T_der_Ks, const char *path_db, const char *wp_as,
 	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
 	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_vol_dp_dT_wTpsatRho:
- * -------------------------------
+ * direct_abs_con_dp_dX_XT_der:
+ * ----------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium loading w in kg/kg, equilibrium
- * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
- * rho in kg/m³, derivative of saturation pressure with respect to temperature
- * dp_sat_dT in Pa/K and derivative of density of adsorpt with respect to
- * temperature drho_dT in kg/m³/K.
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to concentration X in Pa/(kg/kg)/s depending on equilibrium
+ * concentration X in kg/kg, equilibrium temperature T in K, and their
+ * derivatives.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
- * 	double dp_sat_dT_PaK:
- *		Derivative of saturation pressure wrt. temperature in Pa/K.
- *	double drho_dT_kgm3K:
- *		Derivative of density of adsorpt wrt. temperature in kg/m³/K.
+ *	double X_der_kgkgs:
+ *		Derivative of equilibrium concentration in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4710,61 +8728,48 @@ DLL_API double direct_ads_vol_dp_dw_wTpsatRho(double w_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *		Derivative of derivative of equilibrium pressure wrt. concentration in
+ *		Pa/(kg/kg)/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_dp_dT_wTpsatRho(double w_kgkg, double T_K,
-	double p_sat_Pa, double rho_kgm3, double dp_sat_dT_PaK,
-	double drho_dT_kgm3K, const char *path_db, const char *wp_as,
+DLL_API double direct_abs_con_dp_dX_XT_der(double X_kgkg, double T_K,
+	double X_der_kgkgs, double T_der_Ks, const char *path_db, const char *wp_as,
 	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
 	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ads_vol_piStar_pyxgTpsatRhoM:
- * ------------------------------------
- *
- * Calculates reduced spreading pressure in kg/mol depending on equilibrium
- * pressure p in Pa, molar fraction of refrigerant in vapor phase in mol/mol,
- * molar fraction of refrigerant in adsorbed phase in mol/mol, activity
- * coefficient of refrigerant in adsorbed phase, equilibrium temperature T in K,
- * saturation pressure p_Sat in Pa and density of adsorpt rho in kg/m³ and molar
- * mass of refrigerant M in kg/mol. The reduced spreading pressure is defined as
- * follows:
- *
- * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
- *		Integral_0^p0{w(p,T) / p * dp}
+ * direct_abs_con_dp_dT_XT_der:
+ * ----------------------------
  *
- *	where p0 = p_total*y / (gamma*x)
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to temperature T in Pa/K/s depending on equilibrium concentration X
+ * in kg/kg, equilibrium temperature T in K, and their derivatives.
  *
  * Parameters:
  * -----------
- *	double p_total_Pa:
- *		Total pressure of vapor phase in Pa.
- *	double y_molmol:
- *		Molar fraction of refrigerant in vapor phase in mol/mol.
- *	double x_molmol:
- *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
- *	double gamma:
- *		Activity coefficient of refrigerant in adsorbed phase.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
- *	double M_kgmol:
- *		Molar mass of refrigerant M in kg/mol.
+ *	double X_der_kgkgs:
+ *		Derivative of equilibrium concentration in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4792,42 +8797,48 @@ DLL_API double direct_ads_vol_dp_dT_wTpsatRho(double w_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Reduced spreading pressure in kg/mol.
+ *		Derivative of derivative of equilibrium pressure wrt. temperature in
+ *		Pa/K/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_piStar_pyxgTpsatRhoM(double p_total_Pa,
-	double y_molmol, double x_molmol, double gamma, double T_K, double p_sat_Pa,
-	double rho_kgm3, double M_kgmol, const char *path_db, const char *wp_as,
+DLL_API double direct_abs_con_dp_dT_XT_der(double X_kgkg, double T_K,
+	double X_der_kgkgs, double T_der_Ks, const char *path_db, const char *wp_as,
 	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
 	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
-/////////////////////////////////////////////////////////////////////////////
-// Definition of function prototypes regarding absorption working wo struct//
-/////////////////////////////////////////////////////////////////////////////
 /*
- * direct_abs_con_X_pT:
- * --------------------
+ * direct_abs_act_g_Txv1v2:
+ * ------------------------
  *
- * Calculates equilibrium concentration X in kg/kg depending on equilibrium
- * pressure p in Pa and equilibrium temperature T in K.
+ * Calculates activity coefficient of first component depending on temperature
+ * T_K in K, mole fraction in liquid phase x_molmol in mol/mol, molar volume of
+ * first component in m³/mol, and molar volume of second component in m³/mol.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4855,12 +8866,16 @@ DLL_API double direct_ads_vol_piStar_pyxgTpsatRhoM(double p_total_Pa,
  * Returns:
  * --------
  *	double:
- *		Equilibrium concentration in kg/kg.
+ *		Activity coefficient of first component.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
  *
  * History:
  * --------
@@ -4868,25 +8883,33 @@ DLL_API double direct_ads_vol_piStar_pyxgTpsatRhoM(double p_total_Pa,
  *		First implementation.
  *
  */
-DLL_API double direct_abs_con_X_pT(double p_Pa, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_abs_act_g_Txv1v2(double T_K, double x_molmol,
+	double v1_m3mol, double v2_m3mol, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_abs_con_p_XT:
- * --------------------
+ * direct_abs_act_p_Txv1v2psat:
+ * ----------------------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium
- * concentration X in kg/kg and equilibrium temperature T in K.
+ * Calculates equilibrium pressure p_Pa in Pa of first component depending on
+ * temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
+ * molar volume of first component in m³/mol, molar volume of second component
+ * in m³/mol,and saturation pressure of first component p_sat_Pa in Pa.
  *
  * Parameters:
  * -----------
- *	double X_kgkg:
- *		Equilibrium concentration in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4913,13 +8936,17 @@ DLL_API double direct_abs_con_X_pT(double p_Pa, double T_K,
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium pressure in Pa.
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
  *
  * History:
  * --------
@@ -4927,25 +8954,35 @@ DLL_API double direct_abs_con_X_pT(double p_Pa, double T_K,
  *		First implementation.
  *
  */
-DLL_API double direct_abs_con_p_XT(double X_kgkg, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_abs_act_p_Txv1v2psat(double T_K, double x_molmol,
+	double v1_m3mol, double v2_m3mol, double p_sat_Pa, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol);
 
 
 /*
- * direct_abs_con_T_pX:
- * --------------------
+ * direct_abs_act_x_pTv1v2psat:
+ * ----------------------------
  *
- * Calculates equilibrium temperature in K depending on equilibrium pressure p
- * in Pa and equilibrium concentration X in kg/kg.
+ * Calculates mole fraction of first component in liquid phase x_molmol in
+ * mol/mol depending on equilibrium pressure p_Pa in Pa of first component,
+ * temperature T_K in K, molar volume of first component in m³/mol, molar volume
+ * of second component in m³/mol and saturation pressure of first component
+ * p_sat_Pa in Pa
  *
  * Parameters:
  * -----------
  *	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double X_kgkg:
- *		Equilibrium concentration in kg/kg.
+ *		Equilibrium pressure p_Pa in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4972,40 +9009,50 @@ DLL_API double direct_abs_con_p_XT(double X_kgkg, double T_K,
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium temperature in K.
+ *	double:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	30/03/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_con_T_pX(double p_Pa, double X_kgkg,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_abs_act_x_pTv1v2psat(double p_Pa, double T_K,
+	double v1_m3mol, double v2_m3mol, double p_sat_Pa, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol);
 
 
 /*
- * direct_abs_con_dX_dp_pT:
+ * direct_abs_act_p_Txv1v2:
  * ------------------------
  *
- * Calculates derivative of equilibrium concentration X with respect to pressure
- * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Calculates equilibrium pressure p_Pa in Pa of first component depending on
+ * temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
+ * molar volume of first component in m³/mol and molar volume of second
+ * component in m³/mol.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5033,12 +9080,16 @@ DLL_API double direct_abs_con_T_pX(double p_Pa, double X_kgkg,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium concentration wrt. pressure in kg/kg/Pa.
+ *		Equilibrium pressure p_Pa in Pa.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
  *
  * History:
  * --------
@@ -5046,26 +9097,31 @@ DLL_API double direct_abs_con_T_pX(double p_Pa, double X_kgkg,
  *		First implementation.
  *
  */
-DLL_API double direct_abs_con_dX_dp_pT(double p_Pa, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_abs_act_p_Txv1v2(double T_K, double x_molmol,
+	double v1_m3mol, double v2_m3mol, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_abs_con_dX_dT_pT:
+ * direct_abs_act_x_pTv1v2:
  * ------------------------
  *
- * Calculates derivative of equilibrium concentration X with respect to
- * temperature T in kg/kg/K depending on equilibrium pressure p in Pa and
- * equilibrium temperature T in K.
+ * Calculates mole fraction of first component in liquid phase x_molmol in
+ * mol/mol depending on equilibrium pressure p_Pa in Pa of first component,
+ * temperature T_K in K, molar volume of first component in m³/mol and molar
+ * volume of second component in m³/mol.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ *	double p_Pa:
+ *		Equilibrium pressure p_Pa in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5093,37 +9149,40 @@ DLL_API double direct_abs_con_dX_dp_pT(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium concentration wrt. temperature in kg/kg/K.
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	30/03/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_con_dX_dT_pT(double p_Pa, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_abs_act_x_pTv1v2(double p_Pa, double T_K,
+	double v1_m3mol, double v2_m3mol, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_abs_con_dp_dX_XT:
- * ------------------------
+ * direct_abs_mix_x_pT:
+ * --------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to concentration
- * w in kgPa/kg depending on equilibrium concentration X in kg/kg and
- * equilibrium temperature T in K.
+ * Calculates equilibrium liquid mole fraction of first component in mol/mol
+ * depending on pressure in Pa and temperature T_K in K.
  *
  * Parameters:
  * -----------
- *	double X_kgkg:
- *		Equilibrium concentration in kg/kg.
+ *	double p_Pa:
+ *		Equilibrium pressure p_Pa in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
  *
@@ -5153,39 +9212,42 @@ DLL_API double direct_abs_con_dX_dT_pT(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. concentration in Pakg/kg.
+ *		Equilibrium mole fraction in of first component liquid phase in mol/mol.
+ *	double *ret_y_1_molmol:
+ *		Equilibrium mole fraction of first component.
+ *	double *ret_y_2_molmol:
+ *		Equilibrium mole fraction of second component.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	This function is only valid for isotherm models based on mixing rules.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	04/09/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_con_dp_dX_XT(double X_kgkg, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_abs_mix_x_pT(double *ret_y_1_molmol,
+	double *ret_y_2_molmol, double p_Pa, double T_K, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol);
 
 
 /*
- * direct_abs_con_dp_dT_XT:
- * ------------------------
+ * direct_abs_mix_p_Tx:
+ * --------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium concentration X in kg/kg and
- * equilibrium temperature T in K.
+ * Calculates equilibrium pressure p_Pa in Pa depending on temperature T_K in K
+ * and mole fraction in liquid phase x_molmol in mol/mol.
  *
  * Parameters:
  * -----------
- *	double X_kgkg:
- *		Equilibrium concentration in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5213,43 +9275,42 @@ DLL_API double direct_abs_con_dp_dX_XT(double X_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *		Equilibrium pressure p_Pa in Pa.
+ *	double *ret_y_1_molmol:
+ *		Equilibrium mole fraction of first component.
+ *	double *ret_y_2_molmol:
+ *		Equilibrium mole fraction of second component.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	This function is only valid for isotherm models based on mixing rules.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	04/09/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_con_dp_dT_XT(double X_kgkg, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_abs_mix_p_Tx(double *ret_y_1_molmol,
+	double *ret_y_2_molmol, double T_K, double x_1_molmol, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol);
 
 
 /*
- * direct_abs_act_g_Txv1v2:
- * ------------------------
+ * direct_abs_mix_T_px:
+ * --------------------
  *
- * Calculates activity coefficient of first component depending on temperature
- * T_K in K, mole fraction in liquid phase x_molmol in mol/mol, molar volume of
- * first component in m³/mol, and molar volume of second component in m³/mol.
+ * Calculates equilibrium temperature T_K in K depending on pressure p_Pa in Pa
+ * and mole fraction in liquid phase x_molmol in mol/mol.
  *
  * Parameters:
  * -----------
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double x_molmol:
+ *	double p_Pa:
+ *		Equilibrium pressure p_Pa in Pa.
+ *	double x_1_molmol:
  *		Equilibrium mole fraction in liquid phase in mol/mol.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5277,50 +9338,44 @@ DLL_API double direct_abs_con_dp_dT_XT(double X_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Activity coefficient of first component.
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double *ret_y_1_molmol:
+ *		Equilibrium mole fraction of first component.
+ *	double *ret_y_2_molmol:
+ *		Equilibrium mole fraction of second component.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Uses Newton-Raphson method for calculating equilibrium temperature.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	04/09/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_act_g_Txv1v2(double T_K, double x_molmol,
-	double v1_m3mol, double v2_m3mol, const char *path_db, const char *wp_as,
-	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
-	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_abs_mix_T_px(double *ret_y_1_molmol,
+	double *ret_y_2_molmol, double p_Pa, double x_1_molmol, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol);
 
 
 /*
- * direct_abs_act_p_Txv1v2psat:
- * ----------------------------
+ * direct_abs_mix_dp_dx_Tx:
+ * ------------------------
  *
- * Calculates equilibrium pressure p_Pa in Pa of first component depending on
- * temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
- * molar volume of first component in m³/mol, molar volume of second component
- * in m³/mol,and saturation pressure of first component p_sat_Pa in Pa.
+ * Calculates derivative of equilibrium pressure with respect to liquid mole
+ * fraction in Pa depending on temperature T_K in K and mole fraction in liquid
+ * phase x_molmol in mol/mol.
  *
  * Parameters:
  * -----------
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_molmol:
+ *	double x_1_molmol:
  *		Equilibrium mole fraction in liquid phase in mol/mol.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
- *	double p_sat_Pa:
- *		Saturation pressure of first component in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5348,52 +9403,40 @@ DLL_API double direct_abs_act_g_Txv1v2(double T_K, double x_molmol,
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure p_Pa in Pa.
+ *		Derivative of equilibrium pressure wrt liquid mole fraction in Pa.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Derivative is calculated numerically by the symmetric derivative using
+ *  h = 0.00000001 mol/mol as small change.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	04/09/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_act_p_Txv1v2psat(double T_K, double x_molmol,
-	double v1_m3mol, double v2_m3mol, double p_sat_Pa, const char *path_db,
-	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
-	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
-	int no_rhol);
+DLL_API double direct_abs_mix_dp_dx_Tx(double T_K, double x_1_molmol,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_abs_act_x_pTv1v2psat:
- * ----------------------------
+ * direct_abs_mix_dp_dT_Tx:
+ * ------------------------
  *
- * Calculates mole fraction of first component in liquid phase x_molmol in
- * mol/mol depending on equilibrium pressure p_Pa in Pa of first component,
- * temperature T_K in K, molar volume of first component in m³/mol, molar volume
- * of second component in m³/mol and saturation pressure of first component
- * p_sat_Pa in Pa
+ * Calculates derivative of equilibrium pressure with respect to temperature in
+ * Pa/K depending on temperature T_K in K and mole fraction in liquid phase
+ * x_molmol in mol/mol.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure p_Pa in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
- *	double p_sat_Pa:
- *		Saturation pressure of first component in Pa.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5421,49 +9464,45 @@ DLL_API double direct_abs_act_p_Txv1v2psat(double T_K, double x_molmol,
  * Returns:
  * --------
  *	double:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *		Derivative of equilibrium pressure wrt temperature in Pa/K.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Derivative is calculated numerically by the symmetric derivative using
+ *  h = 0.0001 K as small change.
  *
  * History:
  * --------
- *	30/03/2020, by Mirko Engelpracht:
+ *	04/09/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_act_x_pTv1v2psat(double p_Pa, double T_K,
-	double v1_m3mol, double v2_m3mol, double p_sat_Pa, const char *path_db,
-	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
-	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
-	int no_rhol);
+DLL_API double direct_abs_mix_dp_dT_Tx(double T_K, double x_1_molmol,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_abs_act_p_Txv1v2:
- * ------------------------
+ * direct_abs_mix_dp_dx_Tx_der:
+ * ----------------------------
  *
- * Calculates equilibrium pressure p_Pa in Pa of first component depending on
- * temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
- * molar volume of first component in m³/mol and molar volume of second
- * component in m³/mol.
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to liquid mole fraction x in Pa/(mol/mol)/s depending on equilibrium
+ * temperature T in K, equilibrium mole fraction in liquid phase x in mol/mol,
+ * and their derivatives.
  *
  * Parameters:
  * -----------
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *	double x_der_molmols:
+ *		Derivative of equilibrium mole fraction in liquid phase in mol/mol/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5491,48 +9530,51 @@ DLL_API double direct_abs_act_x_pTv1v2psat(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure p_Pa in Pa.
+ *		Derivative of derivative of equilibrium pressure wrt. liquid mole
+ *		fraction in Pa/(mol/mol)/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-3
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP_MIX) of inputs whose derivatives are
+ *	not zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_act_p_Txv1v2(double T_K, double x_molmol,
-	double v1_m3mol, double v2_m3mol, const char *path_db, const char *wp_as,
-	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
-	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_abs_mix_dp_dx_Tx_der(double T_K, double x_1_molmol,
+	double T_der_Ks, double x_der_molmols, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol);
 
 
 /*
- * direct_abs_act_x_pTv1v2:
- * ------------------------
+ * direct_abs_mix_dp_dT_Tx_der:
+ * ----------------------------
  *
- * Calculates mole fraction of first component in liquid phase x_molmol in
- * mol/mol depending on equilibrium pressure p_Pa in Pa of first component,
- * temperature T_K in K, molar volume of first component in m³/mol and molar
- * volume of second component in m³/mol.
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to temperature T in Pa/K/s depending on equilibrium temperature T in
+ * K, equilibrium mole fraction in liquid phase x in mol/mol, and their
+ * derivatives.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure p_Pa in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *	double x_der_molmols:
+ *		Derivative of equilibrium mole fraction in liquid phase in mol/mol/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5560,40 +9602,44 @@ DLL_API double direct_abs_act_p_Txv1v2(double T_K, double x_molmol,
  * Returns:
  * --------
  *	double:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *		Derivative of derivative of equilibrium pressure wrt. temperature in
+ *		Pa/K/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-3
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP_MIX) of inputs whose derivatives are
+ *	not zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	30/03/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_act_x_pTv1v2(double p_Pa, double T_K,
-	double v1_m3mol, double v2_m3mol, const char *path_db, const char *wp_as,
-	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
-	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
+DLL_API double direct_abs_mix_dp_dT_Tx_der(double T_K, double x_1_molmol,
+	double T_der_Ks, double x_der_molmols, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol);
 
 
+/////////////////////////////////////////////////////////////////////////////
+// Definition of function prototypes regarding refrigerant working w struct//
+/////////////////////////////////////////////////////////////////////////////
 /*
- * direct_abs_mix_x_pT:
- * --------------------
+ * direct_ref_p_sat_T:
+ * -------------------
  *
- * Calculates equilibrium liquid mole fraction of first component in mol/mol
- * depending on pressure in Pa and temperature T_K in K.
+ * Calculates saturation pressure in Pa depending on equilibrium temperature T
+ * in K.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure p_Pa in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
  *
@@ -5623,42 +9669,31 @@ DLL_API double direct_abs_act_x_pTv1v2(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Equilibrium mole fraction in of first component liquid phase in mol/mol.
- *	double *ret_y_1_molmol:
- *		Equilibrium mole fraction of first component.
- *	double *ret_y_2_molmol:
- *		Equilibrium mole fraction of second component.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on mixing rules.
+ *		Saturation pressure in Pa.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_mix_x_pT(double *ret_y_1_molmol,
-	double *ret_y_2_molmol, double p_Pa, double T_K, const char *path_db,
-	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
-	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
-	int no_rhol);
+DLL_API double direct_ref_p_sat_T(double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_abs_mix_p_Tx:
- * --------------------
+ * direct_ref_dp_sat_dT_T:
+ * -----------------------
  *
- * Calculates equilibrium pressure p_Pa in Pa depending on temperature T_K in K
- * and mole fraction in liquid phase x_molmol in mol/mol.
+ * Calculates derivative of saturation pressure in Pa/K wrt to temperature
+ * depending on equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_1_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5686,42 +9721,31 @@ DLL_API double direct_abs_mix_x_pT(double *ret_y_1_molmol,
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure p_Pa in Pa.
- *	double *ret_y_1_molmol:
- *		Equilibrium mole fraction of first component.
- *	double *ret_y_2_molmol:
- *		Equilibrium mole fraction of second component.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on mixing rules.
+ *		Derivative of saturation pressure wrt temperature in Pa/K.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_mix_p_Tx(double *ret_y_1_molmol,
-	double *ret_y_2_molmol, double T_K, double x_1_molmol, const char *path_db,
-	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
-	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
-	int no_rhol);
+DLL_API double direct_ref_dp_sat_dT_T(double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_abs_mix_T_px:
- * --------------------
+ * direct_ref_rho_l_T:
+ * -------------------
  *
- * Calculates equilibrium temperature T_K in K depending on pressure p_Pa in Pa
- * and mole fraction in liquid phase x_molmol in mol/mol.
+ * Calculates saturated liquid density in kg/m³ depending on equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure p_Pa in Pa.
- *	double x_1_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double T_K:
+ *		Equilibrium temperature in K.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5749,44 +9773,31 @@ DLL_API double direct_abs_mix_p_Tx(double *ret_y_1_molmol,
  * Returns:
  * --------
  *	double:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
- *	double *ret_y_1_molmol:
- *		Equilibrium mole fraction of first component.
- *	double *ret_y_2_molmol:
- *		Equilibrium mole fraction of second component.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on mixing rules.
- *	Uses Newton-Raphson method for calculating equilibrium temperature.
+ *		Saturated liquid density in kg/m³.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_mix_T_px(double *ret_y_1_molmol,
-	double *ret_y_2_molmol, double p_Pa, double x_1_molmol, const char *path_db,
-	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
-	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
-	int no_rhol);
+DLL_API double direct_ref_rho_l_T(double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_abs_mix_dp_dx_Tx:
- * ------------------------
+ * direct_ref_drho_l_dT_T:
+ * -----------------------
  *
- * Calculates derivative of equilibrium pressure with respect to liquid mole
- * fraction in Pa depending on temperature T_K in K and mole fraction in liquid
- * phase x_molmol in mol/mol.
+ * Calculates derivative of saturated liquid density wrt temperature in kg/m³/K
+ * depending on equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_1_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5814,40 +9825,31 @@ DLL_API double direct_abs_mix_T_px(double *ret_y_1_molmol,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt liquid mole fraction in Pa.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on mixing rules.
- *	Derivative is calculated numerically by the symmetric derivative using
- *  h = 0.00000001 mol/mol as small change.
+ *		Derivative of saturated liquid density wrt temperature in kg/m³/K.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_mix_dp_dx_Tx(double T_K, double x_1_molmol,
+DLL_API double direct_ref_drho_l_dT_T(double T_K,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_abs_mix_dp_dT_Tx:
- * ------------------------
+ * direct_ref_T_sat_p:
+ * -------------------
  *
- * Calculates derivative of equilibrium pressure with respect to temperature in
- * Pa/K depending on temperature T_K in K and mole fraction in liquid phase
- * x_molmol in mol/mol.
+ * Calculates saturation temperature in K depending on equilibrium pressure p
+ * in Pa.
  *
  * Parameters:
  * -----------
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double x_1_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double p_Pa:
+ *		Saturation pressure in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5875,40 +9877,34 @@ DLL_API double direct_abs_mix_dp_dx_Tx(double T_K, double x_1_molmol,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt temperature in Pa/K.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on mixing rules.
- *	Derivative is calculated numerically by the symmetric derivative using
- *  h = 0.0001 K as small change.
+ *		Equilibrium temperature in K.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	30/03/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_mix_dp_dT_Tx(double T_K, double x_1_molmol,
+DLL_API double direct_ref_T_sat_p(double p_Pa,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
-/////////////////////////////////////////////////////////////////////////////
-// Definition of function prototypes regarding refrigerant working w struct//
-/////////////////////////////////////////////////////////////////////////////
 /*
- * direct_ref_p_sat_T:
- * -------------------
+ * direct_ref_p_sat_T_der:
+ * -----------------------
  *
- * Calculates saturation pressure in Pa depending on equilibrium temperature T
- * in K.
+ * Calculates total derivative of saturation pressure in Pa/s depending on
+ * saturation temperature T in K and its derivative. Thus, the derivative can be
+ * used for derivative annotations of DirectFunctionCalls of Modelica.
  *
  * Parameters:
  * -----------
  *	double T_K:
- *		Equilibrium temperature in K.
+ *		Saturation temperature in K.
+ *	double T_der_Ks:
+ *		Derivative of saturation temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5936,31 +9932,34 @@ DLL_API double direct_abs_mix_dp_dT_Tx(double T_K, double x_1_molmol,
  * Returns:
  * --------
  *	double:
- *		Saturation pressure in Pa.
+ *		Derivative of saturation pressure in Pa/s.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ref_p_sat_T(double T_K,
+DLL_API double direct_ref_p_sat_T_der(double T_K, double T_der_Ks,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ref_dp_sat_dT_T:
+ * direct_ref_T_sat_p_der:
  * -----------------------
  *
- * Calculates derivative of saturation pressure in Pa/K wrt to temperature
- * depending on equilibrium temperature T in K.
+ * Calculates total derivative of saturation temperature in K/s depending on
+ * saturation pressure p in Pa and its derivative. Thus, the derivative can be
+ * used for derivative annotations of DirectFunctionCalls of Modelica.
  *
  * Parameters:
  * -----------
- *	double T_K:
- *		Equilibrium temperature in K.
+ *	double p_Pa:
+ *		Saturation pressure in Pa.
+ *	double p_der_Pas:
+ *		Derivative of saturation pressure in Pa/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5988,31 +9987,34 @@ DLL_API double direct_ref_p_sat_T(double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of saturation pressure wrt temperature in Pa/K.
+ *		Derivative of saturation temperature in K/s.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ref_dp_sat_dT_T(double T_K,
+DLL_API double direct_ref_T_sat_p_der(double p_Pa, double p_der_Pas,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ref_rho_l_T:
- * -------------------
+ * direct_ref_rho_l_T_der:
+ * -----------------------
  *
- * Calculates saturated liquid density in kg/m³ depending on equilibrium
- * temperature T in K.
+ * Calculates total derivative of saturated liquid density in kg/m³/s depending
+ * on saturation temperature T in K and its derivative. Thus, the derivative can
+ * be used for derivative annotations of DirectFunctionCalls of Modelica.
  *
  * Parameters:
  * -----------
  *	double T_K:
- *		Equilibrium temperature in K.
+ *		Saturation temperature in K.
+ *	double T_der_Ks:
+ *		Derivative of saturation temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -6040,31 +10042,34 @@ DLL_API double direct_ref_dp_sat_dT_T(double T_K,
  * Returns:
  * --------
  *	double:
- *		Saturated liquid density in kg/m³.
+ *		Derivative of saturated liquid density in kg/m³/s.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ref_rho_l_T(double T_K,
+DLL_API double direct_ref_rho_l_T_der(double T_K, double T_der_Ks,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ref_drho_l_dT_T:
- * -----------------------
+ * direct_ref_dp_sat_dT_T_der:
+ * ---------------------------
  *
- * Calculates derivative of saturated liquid density wrt temperature in kg/m³/K
- * depending on equilibrium temperature T in K.
+ * Calculates total derivative of derivative of saturation pressure wrt.
+ * temperature in Pa/K/s depending on saturation temperature T in K and its
+ * derivative.
  *
  * Parameters:
  * -----------
  *	double T_K:
- *		Equilibrium temperature in K.
+ *		Saturation temperature in K.
+ *	double T_der_Ks:
+ *		Derivative of saturation temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -6092,31 +10097,43 @@ DLL_API double direct_ref_rho_l_T(double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of saturated liquid density wrt temperature in kg/m³/K.
+ *		Derivative of derivative of saturation pressure wrt. temperature in
+ *		Pa/K/s.
+ *
+ * Remarks:
+ * --------
+ *	Derivative of the analytical derivative is calculated numerically by the
+ *	symmetric derivative using a relative change of 1e-4 (i.e.,
+ *	WORKINGPAIR_DERIVATIVE_STEP) of temperature.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ref_drho_l_dT_T(double T_K,
+DLL_API double direct_ref_dp_sat_dT_T_der(double T_K, double T_der_Ks,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
 
 
 /*
- * direct_ref_T_sat_p:
- * -------------------
+ * direct_ref_drho_l_dT_T_der:
+ * ---------------------------
  *
- * Calculates saturation temperature in K depending on equilibrium pressure p
- * in Pa.
+ * Calculates total derivative of derivative of saturated liquid density wrt.
+ * temperature in kg/m³/K/s depending on saturation temperature T in K and its
+ * derivative.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Saturation pressure in Pa.
+ *	double T_K:
+ *		Saturation temperature in K.
+ *	double T_der_Ks:
+ *		Derivative of saturation temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -6144,15 +10161,24 @@ DLL_API double direct_ref_drho_l_dT_T(double T_K,
  * Returns:
  * --------
  *	double:
- *		Equilibrium temperature in K.
+ *		Derivative of derivative of saturated liquid density wrt. temperature
+ *		in kg/m³/K/s.
+ *
+ * Remarks:
+ * --------
+ *	Derivative of the analytical derivative is calculated numerically by the
+ *	symmetric derivative using a relative change of 1e-4 (i.e.,
+ *	WORKINGPAIR_DERIVATIVE_STEP) of temperature.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	30/03/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ref_T_sat_p(double p_Pa,
+DLL_API double direct_ref_drho_l_dT_T_der(double T_K, double T_der_Ks,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol);
@@ -0,0 +1,414 @@
+////////////////////////
+// workingPairBatch.h //
+////////////////////////
+#ifndef workingPairBatch_h
+#define workingPairBatch_h
+#include "batchPool.h"
+#include "workingPair.h"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#ifdef DLL_EXPORTS
+	#define DLL_API __attribute__((visibility("default")))
+	#else
+	#define DLL_API
+	#endif
+#else
+	#ifdef DLL_EXPORTS
+	#define DLL_API __declspec(dllexport)
+	#else
+	#define DLL_API
+	#endif
+#endif
+
+/*
+ * BATCH_MAX_INPUTS:
+ * -----------------
+ *
+ * Maximal number of inputs of a function that can be evaluated for arrays of
+ * states.
+ *
+ * LABVIEW_ERROR_CODE:
+ * -------------------
+ *
+ * Offset added to status codes of error clusters of LabVIEW (i.e., first code
+ * of range of codes defined by users).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#define BATCH_MAX_INPUTS 8
+#define LABVIEW_ERROR_CODE 5000
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+/*
+ * BatchFunction:
+ * --------------
+ *
+ * Contains name and function pointer of a function of the WorkingPair-struct
+ * that can be evaluated for arrays of states.
+ *
+ * Attributes:
+ * -----------
+ *	const char *name:
+ *		Name of function (e.g., "ads_w_pT").
+ *	function function:
+ *		Pointer to function that is cast to its actual type before call.
+ *	int no_inputs:
+ *		Number of inputs of type double.
+ *	int vapor:
+ *		Flag indicating whether function returns mole fractions of both
+ *		components in vapor phase by its first two inputs (i.e., mixing
+ *		rules).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct BatchFunction BatchFunction;
+
+
+/*
+ * BatchEvaluation:
+ * ----------------
+ *
+ * Contains inputs and outputs of an evaluation of a function of the
+ * WorkingPair-struct for arrays of states.
+ *
+ * Attributes:
+ * -----------
+ *	const BatchFunction *function:
+ *		Function that is evaluated.
+ *	double *ret_values:
+ *		Array to be filled with values of function.
+ *	double *ret_y_1_molmol:
+ *		Array to be filled with mole fractions of first component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	double *ret_y_2_molmol:
+ *		Array to be filled with mole fractions of second component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	int *ret_status:
+ *		Array to be filled with status codes of states (i.e., may be NULL).
+ *	const double **inputs:
+ *		Array containing arrays of inputs in order of inputs of function.
+ *	void *workingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct BatchEvaluation BatchEvaluation;
+
+
+///////////////////////////////////////
+// Definition of function prototypes //
+///////////////////////////////////////
+/*
+ * batch_function:
+ * ---------------
+ *
+ * Auxiliary function searching functions of the WorkingPair-struct that can be
+ * evaluated for arrays of states. All functions ads_*, abs_*, ref_*, and tab_*
+ * with inputs of type double and a pointer to the WorkingPair-struct are
+ * available, including their derivatives *_der.
+ *
+ * Parameters:
+ * -----------
+ *	const char *name:
+ *		Name of function (e.g., "ads_w_pT").
+ *
+ * Returns:
+ * --------
+ *	const struct *BatchFunction:
+ *		Returns pointer to function or NULL if function does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+const BatchFunction *batch_function(const char *name);
+
+
+/*
+ * batch_kernel_values:
+ * --------------------
+ *
+ * Auxiliary function evaluating a function of the WorkingPair-struct from a
+ * first state to the state after the last state without recording status
+ * codes.
+ *
+ * Parameters:
+ * -----------
+ *	int begin:
+ *		First state.
+ *	int end:
+ *		State after last state.
+ *	void *evaluation:
+ *		Pointer of BatchEvaluation-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void batch_kernel_values(int begin, int end, void *evaluation);
+
+
+/*
+ * batch_kernel:
+ * -------------
+ *
+ * Auxiliary function evaluating a function of the WorkingPair-struct from a
+ * first state to the state after the last state. Function is called by
+ * threads of a BatchPool-struct. If an array of status codes is given, each
+ * state is evaluated separately in quiet mode and the status record of the
+ * calling thread is stored for each state.
+ *
+ * Parameters:
+ * -----------
+ *	int begin:
+ *		First state.
+ *	int end:
+ *		State after last state.
+ *	void *evaluation:
+ *		Pointer of BatchEvaluation-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void batch_kernel(int begin, int end, void *evaluation);
+
+
+/*
+ * batch_no_inputs:
+ * ----------------
+ *
+ * Returns number of inputs of type double of a function of the
+ * WorkingPair-struct that can be evaluated by batch_evaluate.
+ *
+ * Parameters:
+ * -----------
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT").
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of inputs or -1 if function does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int batch_no_inputs(const char *function);
+
+
+/*
+ * batch_evaluate:
+ * ---------------
+ *
+ * Evaluates a function of the WorkingPair-struct for arrays of states in
+ * parallel. States are divided into chunks of grain_size states that are
+ * distributed among the threads of a BatchPool-struct by work stealing. Thus,
+ * states requiring many iterations (e.g., mixing rules close to the critical
+ * point) do not leave threads idle. Each state is written to its own index
+ * and, thus, results are identical for any number of threads and grain size.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_values:
+ *		Array to be filled with values of function.
+ *	double *ret_y_1_molmol:
+ *		Array to be filled with mole fractions of first component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	double *ret_y_2_molmol:
+ *		Array to be filled with mole fractions of second component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	int *ret_status:
+ *		Array to be filled with status codes of states (e.g., STATUS_OK or
+ *		STATUS_NO_CONVERGENCE). If pointer is not NULL, no warnings are
+ *		printed for single states. Pointer may be NULL.
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT" or "abs_mix_x_pT").
+ *	const double **inputs:
+ *		Array containing arrays of inputs in order of inputs of function
+ *		(e.g., pressures and temperatures for "ads_w_pT").
+ *	int no_points:
+ *		Number of states.
+ *	int grain_size:
+ *		Number of states per chunk. If grain_size is smaller than 1, grain
+ *		size is chosen automatically.
+ *	struct *BatchPool:
+ *		Pointer of BatchPool-struct. If pointer is NULL, states are evaluated
+ *		by calling thread.
+ *	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all states are calculated and -1 otherwise. In case
+ *		of an error, all states of returned array are set to -1.
+ *
+ * Remarks:
+ * --------
+ *	States whose calculation fails are set to -1 by the function itself. A
+ *	long-lived pool should be reused for several calls to avoid starting
+ *	threads for each call.
+ *
+ *	Status codes of all states are set to the code of the error if states
+ *	cannot be evaluated at all.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int batch_evaluate(double *ret_values, double *ret_y_1_molmol,
+	double *ret_y_2_molmol, int *ret_status, const char *function,
+	const double **inputs, int no_points, int grain_size, void *batchPool,
+	void *workingPair);
+
+
+/*
+ * batch_evaluate_columns:
+ * -----------------------
+ *
+ * Evaluates a function of the WorkingPair-struct for arrays of states whose
+ * inputs are given as columns of one matrix stored column by column (e.g., a
+ * two-dimensional array of VBA or Fortran, or a range of a worksheet). Thus,
+ * wrappers that cannot build arrays of pointers (e.g., Excel) evaluate a whole
+ * column of states by one call.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_values:
+ *		Array to be filled with values of function.
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT").
+ *	const double *inputs:
+ *		Matrix with no_points rows and one column per input stored column by
+ *		column, i.e. i-th state of j-th input is inputs[j * no_points + i].
+ *	int no_points:
+ *		Number of states.
+ *	struct *BatchPool:
+ *		Pointer of BatchPool-struct. If pointer is NULL, states are evaluated
+ *		by calling thread.
+ *	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all states are calculated and -1 otherwise. In case
+ *		of an error, all states of returned array are set to -1.
+ *
+ * Remarks:
+ * --------
+ *	Mole fractions in vapor phase of mixing rules are not returned. Grain
+ *	size is chosen automatically.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int batch_evaluate_columns(double *ret_values, const char *function,
+	const double *inputs, int no_points, void *batchPool, void *workingPair);
+
+
+/*
+ * batch_evaluate_labview:
+ * -----------------------
+ *
+ * Evaluates a function of the WorkingPair-struct for arrays of states with a
+ * signature that fits the Call Library Function node of LabVIEW: Arrays are
+ * passed as array data pointers with their lengths, and the error cluster is
+ * returned by its elements (i.e., status, code, and source). Inputs are given
+ * by one two-dimensional array whose rows are the inputs (e.g., built by
+ * "Build Array" of a buffer of pressures and a buffer of temperatures). Thus,
+ * a whole buffer of states is evaluated by one call.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_values:
+ *		Array to be filled with values of function.
+ *	int *ret_status:
+ *		Array to be filled with status codes of states (e.g., STATUS_OK or
+ *		STATUS_NO_CONVERGENCE).
+ *	unsigned char *ret_error:
+ *		Status of error cluster: 1 if a state or the whole call failed and 0
+ *		otherwise.
+ *	int *ret_code:
+ *		Code of error cluster: 0 if no state failed and LABVIEW_ERROR_CODE
+ *		plus status code of first failed state otherwise.
+ *	char *ret_source:
+ *		Buffer to be filled with source of error cluster (i.e., may be NULL).
+ *	int length_source:
+ *		Length of buffer including terminating zero.
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT").
+ *	const double *inputs:
+ *		Two-dimensional array with one row per input and one column per state
+ *		stored row by row, i.e. i-th state of j-th input is
+ *		inputs[j * no_points + i].
+ *	int no_inputs:
+ *		Number of rows of inputs (i.e., must equal number of inputs of
+ *		function).
+ *	int no_points:
+ *		Number of states (i.e., number of columns of inputs and length of
+ *		arrays of values and status codes).
+ *	struct *BatchPool:
+ *		Pointer of BatchPool-struct. If pointer is NULL, states are evaluated
+ *		by calling thread.
+ *	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns number of failed states or -1 if function cannot be
+ *		evaluated at all. In the latter case, all values are set to -1.
+ *
+ * Remarks:
+ * --------
+ *	Function does neither allocate memory nor print warnings. If no pool is
+ *	given, no threads are started. Thus, latency of a call only depends on
+ *	number of states and is bounded for real-time loops.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int batch_evaluate_labview(double *ret_values, int *ret_status,
+	unsigned char *ret_error, int *ret_code, char *ret_source,
+	int length_source, const char *function, const double *inputs,
+	int no_inputs, int no_points, void *batchPool, void *workingPair);
+
+#endif
@@ -0,0 +1,205 @@
+////////////////////////
+// workingPairChart.h //
+////////////////////////
+#ifndef workingPairChart_h
+#define workingPairChart_h
+#include "batchPool.h"
+#include "workingPair.h"
+#include "workingPairBatch.h"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#ifdef DLL_EXPORTS
+	#define DLL_API __attribute__((visibility("default")))
+	#else
+	#define DLL_API
+	#endif
+#else
+	#ifdef DLL_EXPORTS
+	#define DLL_API __declspec(dllexport)
+	#else
+	#define DLL_API
+	#endif
+#endif
+
+/*
+ * CHART_*:
+ * --------
+ *
+ * Types of charts that can be generated by chart_evaluate. Curves and points
+ * of each chart type are:
+ *
+ *	CHART_ISOTHERMS:
+ *		Curves are temperatures and points are pressures (e.g., "ads_w_pT").
+ *	CHART_ISOSTERES:
+ *		Curves are loadings / molar fractions / concentrations and points are
+ *		temperatures (e.g., "ads_p_wT").
+ *	CHART_ISOBARS:
+ *		Curves are pressures and points are temperatures (e.g., "ads_w_pT").
+ *	CHART_DUEHRING:
+ *		Curves are loadings / molar fractions / concentrations and points are
+ *		temperatures (e.g., "ads_p_wT"). Additionally, vapor temperatures of
+ *		equilibrium pressures are calculated.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#define CHART_ISOTHERMS 1
+#define CHART_ISOSTERES 2
+#define CHART_ISOBARS 3
+#define CHART_DUEHRING 4
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+/*
+ * ChartEvaluation:
+ * ----------------
+ *
+ * Contains inputs and outputs of the generation of a chart of a working pair.
+ * Results are stored as dense matrices with one row per curve and one column
+ * per point.
+ *
+ * Attributes:
+ * -----------
+ *	int chart:
+ *		Type of chart (e.g., CHART_ISOTHERMS).
+ *	const BatchFunction *function:
+ *		Function that is evaluated.
+ *	double *ret_values:
+ *		Matrix to be filled with values of function.
+ *	double *ret_T_sat_K:
+ *		Matrix to be filled with vapor temperatures of equilibrium pressures
+ *		(i.e., only for CHART_DUEHRING and may be NULL otherwise).
+ *	unsigned char *ret_valid:
+ *		Matrix to be filled with flags indicating valid entries.
+ *	const double *p_sat_Pa:
+ *		Array containing vapor pressures of curves (i.e., for CHART_ISOTHERMS)
+ *		or of points (i.e., otherwise).
+ *	double p_limit_Pa:
+ *		Highest finite vapor pressure that limits pressures if vapor pressure
+ *		is not defined (e.g., above critical temperature).
+ *	const double *curves:
+ *		Array containing inputs that are constant along each curve.
+ *	const double *points:
+ *		Array containing inputs that vary along each curve.
+ *	int no_points:
+ *		Number of points per curve (i.e., number of columns).
+ *	void *workingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct ChartEvaluation ChartEvaluation;
+
+
+///////////////////////////////////////
+// Definition of function prototypes //
+///////////////////////////////////////
+/*
+ * chart_kernel:
+ * -------------
+ *
+ * Auxiliary function evaluating curves of a chart from a first curve to the
+ * curve after the last curve. Each state is evaluated in quiet mode, and
+ * entries are flagged valid if value is finite, no failure occurred, and
+ * pressure does not exceed vapor pressure. Function is called by threads of a
+ * BatchPool-struct.
+ *
+ * Parameters:
+ * -----------
+ *	int begin:
+ *		First curve.
+ *	int end:
+ *		Curve after last curve.
+ *	void *evaluation:
+ *		Pointer of ChartEvaluation-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void chart_kernel(int begin, int end, void *evaluation);
+
+
+/*
+ * chart_evaluate:
+ * ---------------
+ *
+ * Generates all curves of a chart of a working pair (i.e., isotherms,
+ * isosteres, isobars, or Dühring chart) in parallel. Results are stored as
+ * dense matrices with one row per curve and one column per point (i.e., value
+ * of curve i at point j is stored at index i * no_points + j). Curves are
+ * distributed among the threads of a BatchPool-struct.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_values:
+ *		Matrix to be filled with values of function (e.g., loadings for
+ *		isotherms and isobars or pressures for isosteres).
+ *	double *ret_T_sat_K:
+ *		Matrix to be filled with vapor temperatures of equilibrium pressures.
+ *		Pointer is required for CHART_DUEHRING and may be NULL otherwise.
+ *	unsigned char *ret_valid:
+ *		Matrix to be filled with 1 for valid entries and 0 for entries that
+ *		are clipped or failed.
+ *	double *ret_p_sat_Pa:
+ *		Array to be filled with vapor pressures of curves (i.e., of
+ *		temperatures for CHART_ISOTHERMS) or of points (i.e., otherwise).
+ *		Pointer may be NULL.
+ *	int chart:
+ *		Type of chart (e.g., CHART_ISOTHERMS).
+ *	const char *function:
+ *		Name of function with two inputs (e.g., "ads_w_pT" or "abs_con_p_XT").
+ *	const double *curves:
+ *		Array containing inputs that are constant along each curve.
+ *	int no_curves:
+ *		Number of curves.
+ *	const double *points:
+ *		Array containing inputs that vary along each curve.
+ *	int no_points:
+ *		Number of points per curve.
+ *	struct *BatchPool:
+ *		Pointer of BatchPool-struct. If pointer is NULL, curves are evaluated
+ *		by calling thread.
+ *	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if chart is generated and -1 otherwise. In case of an
+ *		error, all values are set to -1 and all entries are invalid.
+ *
+ * Remarks:
+ * --------
+ *	Pressures are clipped at vapor pressure of the temperature of the entry.
+ *	If vapor pressure is not defined (e.g., above critical temperature),
+ *	pressures are clipped at highest finite vapor pressure of the chart.
+ *	Results are identical for any number of threads.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int chart_evaluate(double *ret_values, double *ret_T_sat_K,
+	unsigned char *ret_valid, double *ret_p_sat_Pa, int chart,
+	const char *function, const double *curves, int no_curves,
+	const double *points, int no_points, void *batchPool, void *workingPair);
+
+#endif
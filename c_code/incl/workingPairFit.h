@@ -0,0 +1,658 @@
+//////////////////////
+// workingPairFit.h //
+//////////////////////
+#ifndef workingPairFit_h
+#define workingPairFit_h
+#include "batchPool.h"
+#include "cJSON.h"
+#include "database.h"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#ifdef DLL_EXPORTS
+	#define DLL_API __attribute__((visibility("default")))
+	#else
+	#define DLL_API
+	#endif
+#else
+	#ifdef DLL_EXPORTS
+	#define DLL_API __declspec(dllexport)
+	#else
+	#define DLL_API
+	#endif
+#endif
+
+/*
+ * FIT_MAX_NO_COEFFICIENTS:
+ * ------------------------
+ *
+ * Maximal number of coefficients of isotherm equations that can be fitted
+ * (i.e., number of coefficients of Duehring equation).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#define FIT_MAX_NO_COEFFICIENTS 15
+
+/*
+ * FIT_NO_INPUTS:
+ * --------------
+ *
+ * Number of inputs of each point used to fit coefficients (i.e., pressure,
+ * temperature, loading, saturation pressure, and saturated liquid density).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#define FIT_NO_INPUTS 5
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+/*
+ * FitModel:
+ * ---------
+ *
+ * Describes an isotherm equation whose coefficients can be fitted: Names of
+ * coefficients in order of the database, measured value calculated by the
+ * isotherm equation, and function calculating this value and its derivatives
+ * with respect to the coefficients.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_iso:
+ *		Name of isotherm equation (e.g., "Toth").
+ *	const char *wp_tp:
+ *		Type of working pair (i.e., "ads" or "abs").
+ *	const char *measured:
+ *		Name of data set compared with values of function (i.e., "loadings"
+ *		or "pressures").
+ *	int refrigerant:
+ *		Number of refrigerant functions required by function (i.e., 0: none,
+ *		1: saturation pressure, 2: saturation pressure and saturated liquid
+ *		density).
+ *	int no_par:
+ *		Number of coefficients.
+ *	const char *names[FIT_MAX_NO_COEFFICIENTS]:
+ *		Names of coefficients in order of coefficients (i.e., keys of "_p_" in
+ *		the database).
+ *	double (*function)(double[], double, double, double, double, double,
+ *	double[]):
+ *		Function calculating measured value and its derivatives wrt.
+ *		coefficients depending on pressure in Pa, temperature in K, loading
+ *		(i.e., in kg/kg or mol/mol), saturation pressure in Pa, saturated
+ *		liquid density in kg/m3, and coefficients.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct FitModel FitModel;
+
+
+/*
+ * Fit:
+ * ----
+ *
+ * Contains points of experimental data and coefficients of an isotherm
+ * equation fitted to these points by a Levenberg-Marquardt algorithm with
+ * bounds. Points are stored in flat arrays, so residuals and derivatives of
+ * all points are evaluated by one call of a BatchPool-struct.
+ *
+ * Attributes:
+ * -----------
+ *	const FitModel *model:
+ *		Isotherm equation whose coefficients are fitted.
+ *	int no_points:
+ *		Number of points.
+ *	double *inputs[FIT_NO_INPUTS]:
+ *		Arrays containing pressure in Pa, temperature in K, loading,
+ *		saturation pressure in Pa, and saturated liquid density in kg/m3 of all
+ *		points.
+ *	double *measured:
+ *		Array containing measured values of all points (i.e., pointer of
+ *		array of inputs).
+ *	double *weights:
+ *		Array containing weights of residuals of all points.
+ *	int *valid:
+ *		Array containing flags indicating if points are valid.
+ *	double *values:
+ *		Array containing calculated values of all points.
+ *	double *jacobian:
+ *		Array containing derivatives of weighted residuals wrt. coefficients
+ *		of all points (i.e., row-major with one row per point).
+ *	double *trial_values:
+ *		Array containing calculated values of trial coefficients.
+ *	double *trial_jacobian:
+ *		Array containing derivatives of trial coefficients.
+ *	double trial_par[FIT_MAX_NO_COEFFICIENTS]:
+ *		Trial coefficients evaluated by threads.
+ *	double par[FIT_MAX_NO_COEFFICIENTS]:
+ *		Fitted coefficients.
+ *	double covariance[FIT_MAX_NO_COEFFICIENTS * FIT_MAX_NO_COEFFICIENTS]:
+ *		Covariance matrix of fitted coefficients (i.e., row-major).
+ *	int status:
+ *		Status code of fit (e.g., STATUS_NO_CONVERGENCE if maximal number of
+ *		iterations is reached).
+ *	int no_iterations:
+ *		Number of iterations (i.e., evaluations of trial coefficients).
+ *	int no_valid:
+ *		Number of valid points.
+ *	double rmse:
+ *		Root-mean-square error of valid points.
+ *	double are:
+ *		Average absolute relative deviation of valid points.
+ *	double max_error:
+ *		Maximal absolute error of valid points.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct Fit Fit;
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * newFit:
+ * -------
+ *
+ * Initialization function to create a new Fit-struct. Therefore, function
+ * reads all points of experimental data given in the format of the database
+ * (i.e., "_ed_") and calculates saturation pressure and saturated liquid
+ * density of the refrigerant at all points if required by the isotherm
+ * equation.
+ *
+ * Parameters:
+ * -----------
+ *	struct *Database:
+ *		Pointer of Database-struct containing refrigerant (i.e., NULL if
+ *		isotherm equation does not require refrigerant functions).
+ *	const char *wp_iso:
+ *		Name of isotherm equation (e.g., "Toth").
+ *	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure (i.e., NULL to choose
+ *		first approach existing in the database).
+ *	int no_p_sat:
+ *		ID of vapor pressure equation.
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density (i.e., NULL to choose
+ *		first approach existing in the database).
+ *	int no_rhol:
+ *		ID of liquid density equation.
+ *	const char *json_ed:
+ *		JSON text containing an array of blocks of experimental data or one
+ *		block of experimental data (i.e., objects containing "_d_" with
+ *		arrays "pressures", "temperatures", and "loadings").
+ *
+ * Returns:
+ * --------
+ *	struct *Fit:
+ *		Returns malloc-ed Fit-struct or NULL if isotherm equation cannot be
+ *		fitted, data do not contain points, refrigerant cannot be found, or
+ *		memory allocation fails.
+ *
+ * Remarks:
+ * --------
+ *	Loadings are concentrations in kg/kg for conventional absorption equations
+ *	and mole fractions in mol/mol for activity coefficient equations. Molar
+ *	volumes of activity coefficient equations are taken from coefficients.
+ *	Points containing values that are not numbers are skipped.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API Fit *newFit(Database *database, const char *wp_iso, const char *wp_rf,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol,
+	const char *json_ed);
+
+
+/*
+ * delFit:
+ * -------
+ *
+ * Destructor function to free allocated memory of a Fit-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void delFit(void *fit);
+
+
+/*
+ * fit_optimize:
+ * -------------
+ *
+ * Fits coefficients of isotherm equation to all points of a Fit-struct by a
+ * Levenberg-Marquardt algorithm with bounds: Sum of squared weighted residuals
+ * is minimized by steps solving the scaled normal equations. Steps are
+ * projected onto bounds, and coefficients at a bound are kept if gradient
+ * points out of bounds. Residuals and analytic derivatives wrt. coefficients
+ * are evaluated in parallel by the threads of a BatchPool-struct. Afterwards,
+ * covariance matrix and statistics are calculated.
+ *
+ * Parameters:
+ * -----------
+ *	const double *par_start:
+ *		Array containing start values of coefficients.
+ *	const double *par_lower:
+ *		Array containing lower bounds of coefficients (i.e., NULL for no
+ *		lower bounds).
+ *	const double *par_upper:
+ *		Array containing upper bounds of coefficients (i.e., NULL for no
+ *		upper bounds).
+ *	int relative:
+ *		Flag indicating if residuals are relative to measured values (i.e.,
+ *		1) or absolute (i.e., 0).
+ *	int max_iterations:
+ *		Maximal number of iterations. If max_iterations is smaller than 1,
+ *		100 iterations per coefficient are used.
+ *	int grain_size:
+ *		Number of points per chunk. If grain_size is smaller than 1, grain
+ *		size is chosen automatically.
+ *	struct *BatchPool:
+ *		Pointer of BatchPool-struct. If pointer is NULL, points are evaluated
+ *		by calling thread.
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if algorithm converged and -1 otherwise.
+ *
+ * Remarks:
+ * --------
+ *	Coefficients whose lower bound equals upper bound are fixed. Points that
+ *	cannot be evaluated with start values or whose squared residuals or
+ *	derivatives overflow with start values (e.g., outliers far outside range
+ *	of validity) are not valid and are excluded. Relative residuals are
+ *	calculated with a measured value of at least 1e-12. If algorithm does not
+ *	converge, coefficients with smallest sum of squared residuals are kept.
+ *	Results are identical for any number of threads and grain size.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int fit_optimize(const double *par_start, const double *par_lower,
+	const double *par_upper, int relative, int max_iterations, int grain_size,
+	void *batchPool, void *fit);
+
+
+/*
+ * fit_report:
+ * -----------
+ *
+ * Writes fitted coefficients of a Fit-struct as JSON object in the format of
+ * isotherm equations of the database: Literature ("_c_"), name of equation
+ * ("_e_"), range of points ("_va_"), average relative error in percent and
+ * root-mean-square error ("_er_"), and coefficients ("_p_"). Covariance
+ * matrix is added as object of objects ("_cv_") whose keys are the names of
+ * coefficients.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path:
+ *		Path of JSON file. If path is NULL, JSON is printed to standard output.
+ *	const char *literature:
+ *		Literature of isotherm equation (i.e., NULL for empty literature).
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if JSON is written and -1 otherwise.
+ *
+ * Remarks:
+ * --------
+ *	Statistics and covariances that are not finite are written as null.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int fit_report(const char *path, const char *literature, void *fit);
+
+
+/*
+ * getFitNoCoefficients:
+ * ---------------------
+ *
+ * Returns number of coefficients of isotherm equation of a Fit-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of coefficients or -1 if Fit-struct does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getFitNoCoefficients(void *fit);
+
+
+/*
+ * getFitNoPoints:
+ * ---------------
+ *
+ * Returns number of points of a Fit-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of points or -1 if Fit-struct does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getFitNoPoints(void *fit);
+
+
+/*
+ * getFitCoefficientName:
+ * ----------------------
+ *
+ * Returns name of a coefficient of isotherm equation of a Fit-struct as used
+ * by the database.
+ *
+ * Parameters:
+ * -----------
+ *	int index:
+ *		Index of coefficient.
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * Returns:
+ * --------
+ *	const char *:
+ *		Name of coefficient or NULL if index or Fit-struct is invalid.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API const char *getFitCoefficientName(int index, void *fit);
+
+
+/*
+ * getFitCoefficients:
+ * -------------------
+ *
+ * Copies fitted coefficients and their covariance matrix of a Fit-struct.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_par:
+ *		Array to be filled with coefficients (i.e., NULL if not required).
+ *	double *ret_covariance:
+ *		Array to be filled with covariance matrix in row-major order (i.e.,
+ *		NULL if not required).
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if coefficients are copied and -1 otherwise.
+ *
+ * Remarks:
+ * --------
+ *	Covariances of fixed coefficients are zero. Covariances are not finite if
+ *	normal equations are singular or number of valid points does not exceed
+ *	number of fitted coefficients.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getFitCoefficients(double *ret_par, double *ret_covariance,
+	void *fit);
+
+
+/*
+ * getFitStatistics:
+ * -----------------
+ *
+ * Returns statistics of fitted coefficients of a Fit-struct.
+ *
+ * Parameters:
+ * -----------
+ *	int *ret_no_valid:
+ *		Pointer to be set to number of valid points.
+ *	int *ret_no_iterations:
+ *		Pointer to be set to number of iterations.
+ *	double *ret_rmse:
+ *		Pointer to be set to root-mean-square error.
+ *	double *ret_are:
+ *		Pointer to be set to average absolute relative deviation (i.e., not
+ *		in percent).
+ *	double *ret_max_error:
+ *		Pointer to be set to maximal absolute error.
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns status code of fit (i.e., STATUS_OK if algorithm converged)
+ *		or -1 if Fit-struct does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getFitStatistics(int *ret_no_valid, int *ret_no_iterations,
+	double *ret_rmse, double *ret_are, double *ret_max_error, void *fit);
+
+
+/*
+ * fit_model:
+ * ----------
+ *
+ * Auxiliary function searching isotherm equation whose coefficients can be
+ * fitted.
+ *
+ * Parameters:
+ * -----------
+ *	const char *wp_iso:
+ *		Name of isotherm equation (e.g., "Toth").
+ *
+ * Returns:
+ * --------
+ *	const FitModel *:
+ *		Returns pointer of isotherm equation or NULL if coefficients of
+ *		isotherm equation cannot be fitted.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+const FitModel *fit_model(const char *wp_iso);
+
+
+/*
+ * fit_points:
+ * -----------
+ *
+ * Auxiliary function reading pressure, temperature, and loading of all points
+ * of experimental data.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_inputs[FIT_NO_INPUTS]:
+ *		Arrays to be filled with pressure, temperature, and loading (i.e., NULL
+ *		to count points only).
+ *	struct *cJSON:
+ *		Pointer of cJSON-struct containing an array of blocks of experimental
+ *		data or one block of experimental data.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of points.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int fit_points(double *ret_inputs[FIT_NO_INPUTS], cJSON *json);
+
+
+/*
+ * fit_kernel:
+ * -----------
+ *
+ * Auxiliary function evaluating values and derivatives wrt. coefficients of
+ * trial coefficients from a first point to the point after the last point.
+ * Function is called by threads of a BatchPool-struct.
+ *
+ * Parameters:
+ * -----------
+ *	int begin:
+ *		First point.
+ *	int end:
+ *		Point after last point.
+ *	void *fit:
+ *		Pointer of Fit-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void fit_kernel(int begin, int end, void *fit);
+
+
+/*
+ * fit_normal:
+ * -----------
+ *
+ * Auxiliary function calculating half sum of squared weighted residuals and,
+ * optionally, normal equations of values and derivatives. Points are summed
+ * in order, so results do not depend on number of threads.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_A:
+ *		Array to be filled with product of transposed Jacobian and Jacobian in
+ *		row-major order (i.e., NULL if not required).
+ *	double *ret_g:
+ *		Array to be filled with product of transposed Jacobian and weighted
+ *		residuals (i.e., NULL if not required).
+ *	const double *values:
+ *		Array containing calculated values of all points.
+ *	const double *jacobian:
+ *		Array containing weighted derivatives of all points.
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Half sum of squared weighted residuals of valid points or -1 if a
+ *		value or derivative of a valid point is not finite.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double fit_normal(double *ret_A, double *ret_g, const double *values,
+	const double *jacobian, Fit *fit);
+
+
+/*
+ * fit_cholesky:
+ * -------------
+ *
+ * Auxiliary function factorizing a symmetric positive definite matrix by
+ * Cholesky decomposition in place and, optionally, solving a linear system.
+ *
+ * Parameters:
+ * -----------
+ *	double *A:
+ *		Matrix in row-major order that is overwritten by lower triangular
+ *		factor.
+ *	double *b:
+ *		Right-hand side that is overwritten by solution (i.e., NULL if not
+ *		required).
+ *	int n:
+ *		Number of rows of matrix.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if matrix is positive definite and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int fit_cholesky(double *A, double *b, int n);
+
+#endif
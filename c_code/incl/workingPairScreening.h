@@ -0,0 +1,461 @@
+////////////////////////////
+// workingPairScreening.h //
+////////////////////////////
+#ifndef workingPairScreening_h
+#define workingPairScreening_h
+#include "batchPool.h"
+#include "cJSON.h"
+#include "database.h"
+#include "workingPair.h"
+#include "workingPairBatch.h"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#ifdef DLL_EXPORTS
+	#define DLL_API __attribute__((visibility("default")))
+	#else
+	#define DLL_API
+	#endif
+#else
+	#ifdef DLL_EXPORTS
+	#define DLL_API __declspec(dllexport)
+	#else
+	#define DLL_API
+	#endif
+#endif
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+/*
+ * ScreeningCandidate:
+ * -------------------
+ *
+ * Contains names and ID of an isotherm equation of a working pair found in the
+ * database. Candidates are sorted by isotherm type before working pairs are
+ * created.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_as:
+ *		Name of sorbent.
+ *	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ *	const char *wp_rf:
+ *		Name of refrigerant.
+ *	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm.
+ *	int index:
+ *		Position of candidate in database (i.e., keeps order of database within
+ *		one isotherm type).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct ScreeningCandidate ScreeningCandidate;
+
+
+/*
+ * Screening:
+ * ----------
+ *
+ * Contains all working pairs of a database that use a given refrigerant. Each
+ * isotherm equation and each ID of a working pair is a separate
+ * WorkingPair-struct. Working pairs are grouped by isotherm type, so threads
+ * evaluating neighboring working pairs call the same isotherm functions.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_rf:
+ *		Name of refrigerant used as filter (i.e., NULL or "" for all
+ *		refrigerants).
+ *	int no_workingPairs:
+ *		Number of working pairs.
+ *	WorkingPair **workingPairs:
+ *		Array containing pointers of WorkingPair-structs grouped by isotherm
+ *		type.
+ *
+ * Remarks:
+ * --------
+ *	Working pairs share interned refrigerants and names with the database.
+ *	Thus, the database must not be deleted before the Screening-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct Screening Screening;
+
+
+/*
+ * ScreeningEvaluation:
+ * --------------------
+ *
+ * Contains inputs and outputs of an evaluation of a function for all working
+ * pairs of a Screening-struct. Results are stored as dense matrix with one row
+ * per working pair and one column per state.
+ *
+ * Attributes:
+ * -----------
+ *	const BatchFunction *function:
+ *		Function that is evaluated.
+ *	double *ret_values:
+ *		Matrix to be filled with values of function.
+ *	double *ret_y_1_molmol:
+ *		Matrix to be filled with mole fractions of first component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	double *ret_y_2_molmol:
+ *		Matrix to be filled with mole fractions of second component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	int *ret_status:
+ *		Matrix to be filled with status codes (i.e., may be NULL).
+ *	const double **inputs:
+ *		Array containing arrays of inputs in order of inputs of function.
+ *	int no_points:
+ *		Number of states (i.e., number of columns).
+ *	const int *supported:
+ *		Array containing flags indicating whether working pairs support
+ *		function.
+ *	WorkingPair **workingPairs:
+ *		Array containing pointers of WorkingPair-structs.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct ScreeningEvaluation ScreeningEvaluation;
+
+
+///////////////////////////////////////
+// Definition of function prototypes //
+///////////////////////////////////////
+/*
+ * newScreening:
+ * -------------
+ *
+ * Initialization function to create a new Screening-struct. Therefore, function
+ * searches the database for all adsorption and absorption working pairs using
+ * the refrigerant wp_rf and creates one WorkingPair-struct per isotherm
+ * equation and ID. All working pairs use the same calculation approaches of the
+ * refrigerant. Working pairs that cannot be created are skipped.
+ *
+ * Parameters:
+ * -----------
+ *	struct *Database:
+ *		Pointer of Database-struct.
+ *	const char *wp_rf:
+ *		Name of refrigerant (i.e., NULL or "" to screen all refrigerants).
+ *	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation.
+ *	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation.
+ *
+ * Returns:
+ * --------
+ *	struct *Screening:
+ *		Returns malloc-ed Screening-struct or NULL if no working pair exists or
+ *		memory allocation fails.
+ *
+ * Remarks:
+ * --------
+ *	Names are not copied and must remain valid as long as the
+ *	Screening-struct exists.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API Screening *newScreening(Database *database, const char *wp_rf,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol);
+
+
+/*
+ * delScreening:
+ * -------------
+ *
+ * Destructor function to free allocated memory of a Screening-struct and its
+ * working pairs.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Screening:
+ *		Pointer of Screening-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void delScreening(void *screening);
+
+
+/*
+ * getScreeningNoWorkingPairs:
+ * ---------------------------
+ *
+ * Returns number of working pairs of a Screening-struct (i.e., number of rows
+ * of result matrix).
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Screening:
+ *		Pointer of Screening-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of working pairs or -1 if Screening-struct does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getScreeningNoWorkingPairs(void *screening);
+
+
+/*
+ * getScreeningWorkingPair:
+ * ------------------------
+ *
+ * Returns names and ID of isotherm of a working pair of a Screening-struct
+ * (i.e., of one row of result matrix).
+ *
+ * Parameters:
+ * -----------
+ *	const char **ret_wp_as:
+ *		Pointer to be set to name of sorbent.
+ *	const char **ret_wp_st:
+ *		Pointer to be set to name of sub-type of sorbent.
+ *	const char **ret_wp_rf:
+ *		Pointer to be set to name of refrigerant.
+ *	const char **ret_wp_iso:
+ *		Pointer to be set to name of isotherm.
+ *	int *ret_no_iso:
+ *		Pointer to be set to ID of isotherm.
+ *	int index:
+ *		Index of working pair.
+ * 	struct *Screening:
+ *		Pointer of Screening-struct.
+ *
+ * Returns:
+ * --------
+ *	struct *WorkingPair:
+ *		Returns pointer of WorkingPair-struct owned by Screening-struct or NULL
+ *		if working pair does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API WorkingPair *getScreeningWorkingPair(const char **ret_wp_as,
+	const char **ret_wp_st, const char **ret_wp_rf, const char **ret_wp_iso,
+	int *ret_no_iso, int index, void *screening);
+
+
+/*
+ * screening_candidates:
+ * ---------------------
+ *
+ * Auxiliary function searching the database for all isotherm equations and IDs
+ * of adsorption and absorption working pairs using a refrigerant. Entries of
+ * refrigerants are skipped.
+ *
+ * Parameters:
+ * -----------
+ *	ScreeningCandidate *ret_candidates:
+ *		Array to be filled with candidates (i.e., NULL to count candidates
+ *		only).
+ *	const char *wp_rf:
+ *		Name of refrigerant (i.e., NULL or "" for all refrigerants).
+ *	struct *cJSON:
+ *		Pointer of cJSON-struct containing content of database.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of candidates.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int screening_candidates(ScreeningCandidate *ret_candidates,
+	const char *wp_rf, cJSON *json);
+
+
+/*
+ * screening_compare:
+ * ------------------
+ *
+ * Auxiliary function comparing two ScreeningCandidate-structs by name of
+ * isotherm and position in database.
+ *
+ * Parameters:
+ * -----------
+ *	const void *a:
+ *		Pointer of first ScreeningCandidate-struct.
+ *	const void *b:
+ *		Pointer of second ScreeningCandidate-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Negative, zero, or positive value if first candidate is sorted before,
+ *		equal to, or after second candidate.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int screening_compare(const void *a, const void *b);
+
+
+/*
+ * screening_supported:
+ * --------------------
+ *
+ * Auxiliary function checking whether a working pair implements the type of a
+ * function (e.g., adsorption, conventional absorption, activity coefficients,
+ * mixing rules, or tables). Thus, functions that are not implemented are not
+ * called and do not print a warning for each state.
+ *
+ * Parameters:
+ * -----------
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT").
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 1 if function can be evaluated and 0 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int screening_supported(const char *function, WorkingPair *workingPair);
+
+
+/*
+ * screening_kernel:
+ * -----------------
+ *
+ * Auxiliary function evaluating entries of the result matrix from a first
+ * entry to the entry after the last entry. Entries are numbered row by row and,
+ * thus, each chunk is split into parts of rows that are evaluated by
+ * batch_kernel. Function is called by threads of a BatchPool-struct.
+ *
+ * Parameters:
+ * -----------
+ *	int begin:
+ *		First entry.
+ *	int end:
+ *		Entry after last entry.
+ *	void *evaluation:
+ *		Pointer of ScreeningEvaluation-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void screening_kernel(int begin, int end, void *evaluation);
+
+
+/*
+ * screening_evaluate:
+ * -------------------
+ *
+ * Evaluates a function for all working pairs of a Screening-struct and all
+ * states in parallel. Results are stored as dense matrix with one row per
+ * working pair and one column per state (i.e., value of working pair i at state
+ * j is stored at index i * no_points + j). All entries of the matrix are
+ * distributed among the threads of a BatchPool-struct by work stealing.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_values:
+ *		Matrix to be filled with values of function.
+ *	double *ret_y_1_molmol:
+ *		Matrix to be filled with mole fractions of first component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	double *ret_y_2_molmol:
+ *		Matrix to be filled with mole fractions of second component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	int *ret_status:
+ *		Matrix to be filled with status codes (e.g., STATUS_OK or
+ *		STATUS_NOT_IMPLEMENTED for working pairs not implementing function).
+ *		If pointer is not NULL, no warnings are printed for single entries.
+ *		Pointer may be NULL.
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT").
+ *	const double **inputs:
+ *		Array containing arrays of inputs in order of inputs of function.
+ *	int no_points:
+ *		Number of states.
+ *	int grain_size:
+ *		Number of entries per chunk. If grain_size is smaller than 1, grain
+ *		size is chosen automatically.
+ *	struct *BatchPool:
+ *		Pointer of BatchPool-struct. If pointer is NULL, entries are evaluated
+ *		by calling thread.
+ * 	struct *Screening:
+ *		Pointer of Screening-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if function is evaluated and -1 otherwise. In case of an
+ *		error, all entries of returned matrix are set to -1.
+ *
+ * Remarks:
+ * --------
+ *	Rows of working pairs that do not implement function (e.g., absorption
+ *	working pairs for "ads_w_pT") are set to -1. Results are identical for any
+ *	number of threads and grain size.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int screening_evaluate(double *ret_values, double *ret_y_1_molmol,
+	double *ret_y_2_molmol, int *ret_status, const char *function,
+	const double **inputs, int no_points, int grain_size, void *batchPool,
+	void *screening);
+
+#endif
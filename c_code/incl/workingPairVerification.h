@@ -0,0 +1,514 @@
+///////////////////////////////
+// workingPairVerification.h //
+///////////////////////////////
+#ifndef workingPairVerification_h
+#define workingPairVerification_h
+#include "batchPool.h"
+#include "cJSON.h"
+#include "database.h"
+#include "workingPair.h"
+#include "workingPairBatch.h"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#ifdef DLL_EXPORTS
+	#define DLL_API __attribute__((visibility("default")))
+	#else
+	#define DLL_API
+	#endif
+#else
+	#ifdef DLL_EXPORTS
+	#define DLL_API __declspec(dllexport)
+	#else
+	#define DLL_API
+	#endif
+#endif
+
+/*
+ * VERIFICATION_NO_INPUTS:
+ * -----------------------
+ *
+ * Maximal number of inputs of functions used to verify working pairs against
+ * experimental data (e.g., "abs_act_x_pTv1v2").
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#define VERIFICATION_NO_INPUTS 4
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+/*
+ * VerificationRule:
+ * -----------------
+ *
+ * Describes how one type of experimental data is compared with a working pair:
+ * Function is evaluated with inputs taken from data sets or constant inputs,
+ * and result is compared with measured data set.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_tp:
+ *		Type of working pair (i.e., "ads" or "abs").
+ *	const char *type:
+ *		Type of experimental data (e.g., "isotherms").
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT").
+ *	const char *measured:
+ *		Name of data set compared with values of function (e.g., "loadings").
+ *	const char *inputs[VERIFICATION_NO_INPUTS]:
+ *		Names of data sets used as inputs in order of inputs of function. If
+ *		name is NULL, constant input is used.
+ *	double constants[VERIFICATION_NO_INPUTS]:
+ *		Constant inputs (e.g., -1 to use molar volumes of database).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct VerificationRule VerificationRule;
+
+
+/*
+ * VerificationEntry:
+ * ------------------
+ *
+ * Contains one block of experimental data of the database, the isotherm
+ * equation and ID it is compared with, and the statistics of the comparison.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_as:
+ *		Name of sorbent.
+ *	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ *	const char *wp_rf:
+ *		Name of refrigerant.
+ *	const char *wp_tp:
+ *		Type of working pair (i.e., "ads" or "abs").
+ *	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm.
+ *	const char *literature:
+ *		Literature of isotherm equation and experimental data.
+ *	const char *type:
+ *		Type of experimental data (e.g., "isotherms").
+ *	cJSON *data:
+ *		Pointer of cJSON-struct containing data sets.
+ *	const VerificationRule *rule:
+ *		Rule used for comparison (i.e., NULL if data cannot be compared).
+ *	WorkingPair *workingPair:
+ *		Pointer of WorkingPair-struct (i.e., NULL if working pair cannot be
+ *		created).
+ *	int first_point:
+ *		Index of first point of entry.
+ *	int no_points:
+ *		Number of points of entry.
+ *	int status:
+ *		Status code of entry (e.g., STATUS_NOT_IMPLEMENTED if data cannot be
+ *		compared).
+ *	int no_valid:
+ *		Number of points that are evaluated without failure.
+ *	double rmse:
+ *		Root-mean-square error of valid points.
+ *	double aard:
+ *		Average absolute relative deviation of valid points.
+ *	double max_error:
+ *		Maximal absolute error of valid points.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct VerificationEntry VerificationEntry;
+
+
+/*
+ * Verification:
+ * -------------
+ *
+ * Contains all blocks of experimental data of a database that can be assigned
+ * to an isotherm equation and the points of all blocks. Points are stored in
+ * flat arrays, so all points of all entries are evaluated by one call of a
+ * BatchPool-struct.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_rf:
+ *		Name of refrigerant used as filter (i.e., NULL or "" for all
+ *		refrigerants).
+ *	int no_entries:
+ *		Number of entries.
+ *	VerificationEntry *entries:
+ *		Array containing entries.
+ *	int no_points:
+ *		Number of points of all entries.
+ *	double *inputs[VERIFICATION_NO_INPUTS]:
+ *		Arrays containing inputs of all points.
+ *	double *measured:
+ *		Array containing measured values of all points.
+ *	double *values:
+ *		Array containing calculated values of all points.
+ *	int *status:
+ *		Array containing status codes of all points.
+ *	int *point_entries:
+ *		Array containing index of entry of each point.
+ *
+ * Remarks:
+ * --------
+ *	Entries share names and data with the database. Thus, the database must
+ *	not be deleted before the Verification-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct Verification Verification;
+
+
+///////////////////////////////////////
+// Definition of function prototypes //
+///////////////////////////////////////
+/*
+ * newVerification:
+ * ----------------
+ *
+ * Initialization function to create a new Verification-struct. Therefore,
+ * function searches the database for all blocks of experimental data of
+ * adsorption and absorption working pairs using the refrigerant wp_rf. Each
+ * block is assigned to each isotherm equation and ID with the same literature.
+ * Calculation approaches of the refrigerant are chosen as first approach
+ * existing in the database (i.e., "VaporPressure_EoS1", "VaporPressure_EoS2",
+ * "VaporPressure_EoS3", "VaporPressure_EoSCubic", or "VaporPressure_Antoine"
+ * and "SaturatedLiquidDensity_EoS1").
+ *
+ * Parameters:
+ * -----------
+ *	struct *Database:
+ *		Pointer of Database-struct.
+ *	const char *wp_rf:
+ *		Name of refrigerant (i.e., NULL or "" to verify all refrigerants).
+ *
+ * Returns:
+ * --------
+ *	struct *Verification:
+ *		Returns malloc-ed Verification-struct or NULL if no experimental data
+ *		exists or memory allocation fails.
+ *
+ * Remarks:
+ * --------
+ *	Entries whose working pair cannot be created or whose type of data cannot
+ *	be compared are kept with a status code that is not STATUS_OK. Names are
+ *	not copied and must remain valid as long as the Verification-struct
+ *	exists.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API Verification *newVerification(Database *database, const char *wp_rf);
+
+
+/*
+ * delVerification:
+ * ----------------
+ *
+ * Destructor function to free allocated memory of a Verification-struct and
+ * its working pairs.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Verification:
+ *		Pointer of Verification-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void delVerification(void *verification);
+
+
+/*
+ * verification_entries:
+ * ---------------------
+ *
+ * Auxiliary function searching the database for all blocks of experimental
+ * data that have the same literature as an isotherm equation of an adsorption
+ * or absorption working pair using a refrigerant.
+ *
+ * Parameters:
+ * -----------
+ *	VerificationEntry *ret_entries:
+ *		Array to be filled with entries (i.e., NULL to count entries only).
+ *	const char *wp_rf:
+ *		Name of refrigerant (i.e., NULL or "" for all refrigerants).
+ *	struct *cJSON:
+ *		Pointer of cJSON-struct containing content of database.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of entries.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int verification_entries(VerificationEntry *ret_entries, const char *wp_rf,
+	cJSON *json);
+
+
+/*
+ * verification_refrigerant:
+ * -------------------------
+ *
+ * Auxiliary function choosing calculation approaches of vapor pressure and
+ * liquid density of a refrigerant as first approaches existing in the
+ * database.
+ *
+ * Parameters:
+ * -----------
+ *	const char **ret_rf_psat:
+ *		Pointer to be set to name of calculation approach for vapor pressure.
+ *	const char **ret_rf_rhol:
+ *		Pointer to be set to name of calculation approach for liquid density.
+ *	const char *wp_rf:
+ *		Name of refrigerant.
+ *	struct *cJSON:
+ *		Pointer of cJSON-struct containing content of database.
+ *
+ * Remarks:
+ * --------
+ *	Names are set to "NoVaporPressure" or "NoSaturatedLiquidDensity" if no
+ *	approach exists.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void verification_refrigerant(const char **ret_rf_psat,
+	const char **ret_rf_rhol, const char *wp_rf, cJSON *json);
+
+
+/*
+ * verification_rule:
+ * ------------------
+ *
+ * Auxiliary function choosing rule used to compare a type of experimental data
+ * with a working pair: First rule matching type of data and being implemented
+ * by working pair is chosen (e.g., conventional absorption before mixing rules
+ * before activity coefficients).
+ *
+ * Parameters:
+ * -----------
+ *	const char *wp_tp:
+ *		Type of working pair (i.e., "ads" or "abs").
+ *	const char *type:
+ *		Type of experimental data (e.g., "isotherms").
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	const VerificationRule *:
+ *		Returns pointer of rule or NULL if no rule exists.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+const VerificationRule *verification_rule(const char *wp_tp, const char *type,
+	WorkingPair *workingPair);
+
+
+/*
+ * verification_kernel:
+ * --------------------
+ *
+ * Auxiliary function evaluating points from a first point to the point after
+ * the last point. Each chunk is split into parts of entries that are evaluated
+ * by batch_kernel. Function is called by threads of a BatchPool-struct.
+ *
+ * Parameters:
+ * -----------
+ *	int begin:
+ *		First point.
+ *	int end:
+ *		Point after last point.
+ *	void *verification:
+ *		Pointer of Verification-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void verification_kernel(int begin, int end, void *verification);
+
+
+/*
+ * verification_evaluate:
+ * ----------------------
+ *
+ * Evaluates all points of all entries of a Verification-struct in parallel and
+ * calculates statistics of each entry: Root-mean-square error, average
+ * absolute relative deviation, and maximal absolute error. Points are
+ * distributed among the threads of a BatchPool-struct by work stealing.
+ *
+ * Parameters:
+ * -----------
+ *	int grain_size:
+ *		Number of points per chunk. If grain_size is smaller than 1, grain
+ *		size is chosen automatically.
+ *	struct *BatchPool:
+ *		Pointer of BatchPool-struct. If pointer is NULL, points are evaluated
+ *		by calling thread.
+ * 	struct *Verification:
+ *		Pointer of Verification-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if points are evaluated and -1 otherwise.
+ *
+ * Remarks:
+ * --------
+ *	Points whose evaluation fails or whose value is not finite are not valid
+ *	and are excluded from statistics. Relative deviations are calculated with
+ *	a measured value of at least 1e-12. Results are identical for any number
+ *	of threads and grain size.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int verification_evaluate(int grain_size, void *batchPool,
+	void *verification);
+
+
+/*
+ * verification_report:
+ * --------------------
+ *
+ * Writes statistics of all entries of a Verification-struct as JSON file.
+ * Statistics of entries without valid points and statistics that are not
+ * finite are written as null.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path:
+ *		Path of JSON file. If path is NULL, JSON is printed to standard output.
+ * 	struct *Verification:
+ *		Pointer of Verification-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if report is written and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int verification_report(const char *path, void *verification);
+
+
+/*
+ * getVerificationNoEntries:
+ * -------------------------
+ *
+ * Returns number of entries of a Verification-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Verification:
+ *		Pointer of Verification-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of entries or -1 if Verification-struct does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getVerificationNoEntries(void *verification);
+
+
+/*
+ * getVerificationStatistics:
+ * --------------------------
+ *
+ * Returns statistics of an entry of a Verification-struct.
+ *
+ * Parameters:
+ * -----------
+ *	int *ret_no_points:
+ *		Pointer to be set to number of points.
+ *	int *ret_no_valid:
+ *		Pointer to be set to number of valid points.
+ *	double *ret_rmse:
+ *		Pointer to be set to root-mean-square error.
+ *	double *ret_aard:
+ *		Pointer to be set to average absolute relative deviation.
+ *	double *ret_max_error:
+ *		Pointer to be set to maximal absolute error.
+ *	int index:
+ *		Index of entry.
+ * 	struct *Verification:
+ *		Pointer of Verification-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns status code of entry or -1 if entry does not exist.
+ *
+ * Remarks:
+ * --------
+ *	Statistics are -1 if entry has no valid points or if points are not
+ *	evaluated yet.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getVerificationStatistics(int *ret_no_points, int *ret_no_valid,
+	double *ret_rmse, double *ret_aard, double *ret_max_error, int index,
+	void *verification);
+
+#endif
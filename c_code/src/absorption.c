@@ -15,7 +15,9 @@
 #include "absorption_activity_uniquac.h"
 #include "absorption_activity_floryhuggins.h"
 #include "absorption_mixing.h"
+#include "referenceCounter.h"
 #include "refrigerant_cubicEoS.h"
+#include "status.h"
 #include "structDefinitions.c"
 
 
@@ -62,14 +64,18 @@ Absorption *newAbsorption(const char *isotherm_type, double isotherm_par[]) {
     if (retAbsorption == NULL) {
 		// Not enough memory available for Absorption-structure
 		//
-		printf("\n\n###########\n# Warning #\n###########");
-		printf("\nCannot allocate memory for Absorption-structure.");
+		if (status_report(STATUS_NO_MEMORY, "newAbsorption", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for Absorption-structure.");
+		}
         return NULL;
 	}
 
-	// Save general information of isotherm
+	// Save general information of isotherm and initialize number of
+	// references
 	//
 	retAbsorption->isotherm_type = isotherm_type;
+	retAbsorption->no_references = 1;
 
 	// Initialize all function pointers with NULL because NULL is used by
 	// functions of WorkingPair-struct to check if isotherm function is
@@ -406,10 +412,13 @@ Absorption *newAbsorption(const char *isotherm_type, double isotherm_par[]) {
 		if (isotherm_par == NULL) {
 			// Parameters are not given
 			//
-			printf("\n\n###########\n# Warning #\n###########");
-			printf("\nParameters for saturated vapor pressure are not given. "
-				"Therefore, cannot select and execute cubic equation of "
-				"state with mixing rule!");
+			if (status_report(STATUS_INVALID_INPUT, "newAbsorption", 0, 0)) {
+				printf("\n\n###########\n# Warning #\n###########");
+				printf("\nParameters for saturated vapor pressure are not "
+					"given. "
+					"Therefore, cannot select and execute cubic equation of "
+					"state with mixing rule!");
+			}
 			free(retAbsorption);
 			return NULL;
 		}
@@ -610,10 +619,12 @@ Absorption *newAbsorption(const char *isotherm_type, double isotherm_par[]) {
 	} else {
 		// Isotherm does not exist. Therefore, throw warning and free memory.
 		//
-		printf("\n\n###########\n# Warning #\n###########");
-		printf("\nChosen isotherm type \"%s\" does not exist.",
-			isotherm_type);
-		printf("\nCannot create Absorption-structure.");
+		if (status_report(STATUS_NOT_IMPLEMENTED, "newAbsorption", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nChosen isotherm type \"%s\" does not exist.",
+				isotherm_type);
+			printf("\nCannot create Absorption-structure.");
+		}
 
 		free(retAbsorption);
 		return NULL;
@@ -626,6 +637,8 @@ Absorption *newAbsorption(const char *isotherm_type, double isotherm_par[]) {
  * --------------
  *
  * Destructor function to free allocated memory of a Absorption-struct.
+ * If struct is shared by several working pairs, function only decrements
+ * number of references and frees memory when last reference is deleted.
  *
  * Parameters:
  * -----------
@@ -636,6 +649,8 @@ Absorption *newAbsorption(const char *isotherm_type, double isotherm_par[]) {
  * --------
  *	02/13/2020, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Added number of references.
  *
  */
 void delAbsorption(void *absorption) {
@@ -646,7 +661,8 @@ void delAbsorption(void *absorption) {
     // Because of initialization function, Absorption-struct is NULL or fully
 	// built
 	//
-    if (retAbsorption != NULL) {
+    if (retAbsorption != NULL &&
+		REFERENCES_DECREMENT(&retAbsorption->no_references) == 0) {
 		free(retAbsorption);
     }
 }
@@ -680,10 +696,12 @@ double warning_par_func(const char *name_function,
 	const char *name_abs_function) {
 	// Print warning
 	//
-	printf("\n\n###########\n# Warning #\n###########");
-	printf("\nChosen absorption function \"%s\" is not implemented or its "
-		"parameter do not exist.", name_function);
-	printf("\nReturn -1 for function call \"%s\".", name_abs_function);
+	if (status_report(STATUS_NOT_IMPLEMENTED, name_abs_function, 0, 0)) {
+		printf("\n\n###########\n# Warning #\n###########");
+		printf("\nChosen absorption function \"%s\" is not implemented or its "
+			"parameter do not exist.", name_function);
+		printf("\nReturn -1 for function call \"%s\".", name_abs_function);
+	}
 
 	// Return error indicator
 	//
@@ -3,6 +3,8 @@
 ////////////////////////////////////////
 #include <math.h>
 #include "absorption_activity_floryhuggins.h"
+#include "statistics.h"
+#include "status.h"
 
 
 /////////////////////////////
@@ -207,7 +209,88 @@ double absorption_activity_floryhuggins_x_pTgpsat(double p_Pa, double T_K,
 		}
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(absorption_activity_floryhuggins_x_pTgpsat, counter_NRM,
+		counter_NRM != 50);
+
+	// Record failure when number of iterations exceeds 50
+	//
+	if (counter_NRM == 50) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"absorption_activity_floryhuggins_x_pTgpsat", counter_NRM,
+			p_guess_Pa - p_Pa);
+	}
+
 	// Return -1 when number of iterations exceeds 50
 	//
 	return (counter_NRM == 50 ? -1 : x_guess_molmol);
 }
+
+
+/*
+ * absorption_activity_floryhuggins_dp_dpar_Txpsat:
+ * ------------------------------------------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa of first component and its
+ * derivatives with respect to the coefficients of the Flory-Huggins equation
+ * depending on temperature T_K in K, mole fraction in liquid phase x_molmol in
+ * mol/mol, and saturation pressure of first component p_sat_Pa in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dp_dpar[]:
+ *		Array to be filled with derivatives of equilibrium pressure wrt.
+ *		coefficients (i.e., in order of coefficients).
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Flory-Huggins equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double absorption_activity_floryhuggins_dp_dpar_Txpsat(double ret_dp_dpar[],
+	double T_K, double x_molmol, double p_sat_Pa, double isotherm_par[]) {
+	// Calculate mole fractions
+	//
+	double x_1 = x_molmol;
+	double x_2 = 1 - x_1;
+
+	// Calculate temperature-dependent coefficients:
+	// Boltzmann constant is already included in coefficient w_0.
+	//
+	double c = 1 - 1 / isotherm_par[0];
+	double sum_r = x_1 + isotherm_par[0] * x_2;
+	double Phi_2 = isotherm_par[0] * x_2 / sum_r;
+	double Chi = isotherm_par[1] / T_K * (1 + isotherm_par[2] / T_K);
+
+	// Calculate pressure and derivatives of logarithm of activity coefficient
+	// wrt. c and Phi_2
+	//
+	double p_Pa = exp(log(1 - c * Phi_2) + c * Phi_2 + Chi * pow(Phi_2, 2)) *
+		x_molmol * p_sat_Pa;
+	double dlng_dc = Phi_2 - Phi_2 / (1 - c * Phi_2);
+	double dlng_dPhi_2 = c - c / (1 - c * Phi_2) + 2 * Chi * Phi_2;
+
+	// Calculate derivatives of pressure wrt. coefficients
+	//
+	ret_dp_dpar[0] = p_Pa * (dlng_dc / pow(isotherm_par[0], 2) +
+		dlng_dPhi_2 * x_1 * x_2 / pow(sum_r, 2));
+	ret_dp_dpar[1] = p_Pa * pow(Phi_2, 2) * (1 + isotherm_par[2] / T_K) / T_K;
+	ret_dp_dpar[2] = p_Pa * pow(Phi_2, 2) * isotherm_par[1] / pow(T_K, 2);
+
+	return p_Pa;
+}
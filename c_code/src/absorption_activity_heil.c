@@ -3,6 +3,8 @@
 ////////////////////////////////
 #include <math.h>
 #include "absorption_activity_heil.h"
+#include "statistics.h"
+#include "status.h"
 
 
 /////////////////////////////
@@ -272,7 +274,125 @@ double absorption_activity_heil_x_pTv1v2psat(double p_Pa, double T_K,
 		}
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(absorption_activity_heil_x_pTv1v2psat, counter_NRM,
+		counter_NRM != 50);
+
+	// Record failure when number of iterations exceeds 50
+	//
+	if (counter_NRM == 50) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"absorption_activity_heil_x_pTv1v2psat", counter_NRM,
+			p_guess_Pa - p_Pa);
+	}
+
 	// Return -1 when number of iterations exceeds 50
 	//
 	return (counter_NRM == 50 ? -1 : x_guess_molmol);
 }
+
+
+/*
+ * absorption_activity_heil_dp_dpar_Txv1v2psat:
+ * --------------------------------------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa of first component and its
+ * derivatives with respect to the coefficients of the Heil equation depending
+ * on temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
+ * molar volumes of both components in m³/mol, and saturation pressure of first
+ * component p_sat_Pa in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dp_dpar[]:
+ *		Array to be filled with derivatives of equilibrium pressure wrt.
+ *		coefficients (i.e., in order of coefficients).
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Heil equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *
+ * Remarks:
+ * --------
+ *	Uses molar volumes stored in JSON file when input v1_m3mol or v2_m3mol is
+ * 	-1. Otherwise, derivatives wrt. molar volumes stored in JSON file are
+ *	zero.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double absorption_activity_heil_dp_dpar_Txv1v2psat(double ret_dp_dpar[],
+	double T_K, double x_molmol, double v1_m3mol, double v2_m3mol,
+	double p_sat_Pa, double isotherm_par[]) {
+	// Calculate mole fractions
+	//
+	double x_1 = x_molmol;
+	double x_2 = 1 - x_1;
+
+	// Calculate temperature-dependent coefficients
+	//
+	double tau_12 = isotherm_par[0] / (IDEAL_GAS_CONSTANT * T_K);
+	double tau_21 = isotherm_par[1] / (IDEAL_GAS_CONSTANT * T_K);
+
+	// Check, if molar volumes given by inputs need to be used
+	//
+	int volumes_json = (v1_m3mol < 0 || v2_m3mol < 0);
+	double rho_21 = volumes_json ? isotherm_par[3] / isotherm_par[2] :
+		v2_m3mol / v1_m3mol;
+	double rho_12 = volumes_json ? isotherm_par[2] / isotherm_par[3] :
+		v1_m3mol / v2_m3mol;
+
+	double Lambda_12 = rho_21 * exp(-tau_12);
+	double Lambda_21 = rho_12 * exp(-tau_21);
+
+	// Calculate pressure
+	//
+	double aux1 = x_1 + x_2 * Lambda_21;
+	double aux2 = x_2 + x_1 * Lambda_12;
+	double aux3 = Lambda_21 / aux1;
+	double aux4 = Lambda_12 / aux2;
+	double p_Pa = exp(-log(aux1) + x_2 * (aux3 - aux4) + tau_12 * pow(x_2, 2) *
+		(pow(aux3, 2) + aux4 / aux2)) * x_molmol * p_sat_Pa;
+
+	// Calculate derivatives of logarithm of activity coefficient wrt. Lambdas
+	// and tau_12
+	//
+	double dlng_dLambda_12 = pow(x_2, 2) * (-1 / pow(aux2, 2) + tau_12 *
+		(aux2 - 2 * Lambda_12 * x_1) / pow(aux2, 3));
+	double dlng_dLambda_21 = pow(x_2, 2) * (-Lambda_21 / pow(aux1, 2) +
+		tau_12 * 2 * Lambda_21 * x_1 / pow(aux1, 3));
+	double dlng_dtau_12 = pow(x_2, 2) * (pow(aux3, 2) + aux4 / aux2);
+
+	// Calculate derivatives of pressure wrt. coefficients: Lambdas only depend
+	// on ratio of molar volumes
+	//
+	double dlng_dv_1 = (-dlng_dLambda_12 * Lambda_12 + dlng_dLambda_21 *
+		Lambda_21) / isotherm_par[2];
+
+	ret_dp_dpar[0] = p_Pa * (dlng_dtau_12 - dlng_dLambda_12 * Lambda_12) /
+		(IDEAL_GAS_CONSTANT * T_K);
+	ret_dp_dpar[1] = -p_Pa * dlng_dLambda_21 * Lambda_21 /
+		(IDEAL_GAS_CONSTANT * T_K);
+	ret_dp_dpar[2] = volumes_json ? p_Pa * dlng_dv_1 : 0;
+	ret_dp_dpar[3] = volumes_json ? -p_Pa * dlng_dv_1 * isotherm_par[2] /
+		isotherm_par[3] : 0;
+
+	return p_Pa;
+}
@@ -3,6 +3,8 @@
 ////////////////////////////////
 #include <math.h>
 #include "absorption_activity_nrtl.h"
+#include "statistics.h"
+#include "status.h"
 
 
 /////////////////////////////
@@ -295,7 +297,159 @@ double absorption_activity_nrtl_x_pTgpsat(double p_Pa, double T_K,
 		}
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(absorption_activity_nrtl_x_pTgpsat, counter_NRM,
+		counter_NRM != 50);
+
+	// Record failure when number of iterations exceeds 50
+	//
+	if (counter_NRM == 50) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"absorption_activity_nrtl_x_pTgpsat", counter_NRM,
+			p_guess_Pa - p_Pa);
+	}
+
 	// Return -1 when number of iterations exceeds 50
 	//
 	return (counter_NRM == 50 ? -1 : x_guess_molmol);
 }
+
+
+/*
+ * absorption_activity_nrtl_fdg_dp_dpar_Txpsat:
+ * --------------------------------------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa of first component and its
+ * derivatives with respect to the coefficients of the NRTL equation depending
+ * on temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
+ * and saturation pressure of first component p_sat_Pa in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dp_dpar[]:
+ *		Array to be filled with derivatives of equilibrium pressure wrt.
+ *		coefficients (i.e., in order of coefficients).
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of NRTL equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double absorption_activity_nrtl_fdg_dp_dpar_Txpsat(double ret_dp_dpar[],
+	double T_K, double x_molmol, double p_sat_Pa, double isotherm_par[]) {
+	// Calculate mole fractions
+	//
+	double x_1 = x_molmol;
+	double x_2 = 1 - x_1;
+
+	// Calculate taus
+	//
+	double tau_12 = isotherm_par[0] / (IDEAL_GAS_CONSTANT * T_K);
+	double tau_21 = isotherm_par[1] / (IDEAL_GAS_CONSTANT * T_K);
+
+	// Calculate Gibbs free energies
+	//
+	double G_12 = exp(-isotherm_par[2] * tau_12);
+	double G_21 = exp(-isotherm_par[2] * tau_21);
+
+	// Calculate pressure
+	//
+	double aux1 = x_1 + x_2 * G_21;
+	double aux2 = x_2 + x_1 * G_12;
+	double p_Pa = exp(pow(x_2, 2) * (tau_21 * pow(G_21 / aux1, 2) +
+		tau_12 * G_12 / pow(aux2, 2))) * x_molmol * p_sat_Pa;
+
+	// Calculate derivatives of logarithm of activity coefficient wrt. Gibbs
+	// free energies
+	//
+	double dlng_dG_12 = pow(x_2, 2) * tau_12 * (aux2 - 2 * G_12 * x_1) /
+		pow(aux2, 3);
+	double dlng_dG_21 = pow(x_2, 2) * tau_21 * 2 * G_21 * x_1 / pow(aux1, 3);
+
+	// Calculate derivatives of pressure wrt. coefficients
+	//
+	double dlng_dtau_12 = pow(x_2, 2) * G_12 / pow(aux2, 2) -
+		dlng_dG_12 * isotherm_par[2] * G_12;
+	double dlng_dtau_21 = pow(x_2 * G_21 / aux1, 2) -
+		dlng_dG_21 * isotherm_par[2] * G_21;
+
+	ret_dp_dpar[0] = p_Pa * dlng_dtau_12 / (IDEAL_GAS_CONSTANT * T_K);
+	ret_dp_dpar[1] = p_Pa * dlng_dtau_21 / (IDEAL_GAS_CONSTANT * T_K);
+	ret_dp_dpar[2] = -p_Pa * (dlng_dG_12 * tau_12 * G_12 + dlng_dG_21 *
+		tau_21 * G_21);
+
+	return p_Pa;
+}
+
+
+/*
+ * absorption_activity_nrtl_dgT_dp_dpar_Txpsat:
+ * --------------------------------------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa of first component and its
+ * derivatives with respect to the coefficients of the NRTL equation depending
+ * on temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
+ * and saturation pressure of first component p_sat_Pa in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dp_dpar[]:
+ *		Array to be filled with derivatives of equilibrium pressure wrt.
+ *		coefficients (i.e., in order of coefficients).
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of NRTL equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double absorption_activity_nrtl_dgT_dp_dpar_Txpsat(double ret_dp_dpar[],
+	double T_K, double x_molmol, double p_sat_Pa, double isotherm_par[]) {
+	// Calculate temperature-dependent dg_12 and dg_21
+	//
+	double par_fdg[3] = {isotherm_par[0] + isotherm_par[2] * T_K,
+		isotherm_par[1] + isotherm_par[3] * T_K, isotherm_par[4]};
+
+	// Calculate derivatives wrt. dg_12 and dg_21 of NRTL equation with fixed
+	// dgs and apply chain rule
+	//
+	double dp_dpar_fdg[3];
+	double p_Pa = absorption_activity_nrtl_fdg_dp_dpar_Txpsat(dp_dpar_fdg,
+		T_K, x_molmol, p_sat_Pa, par_fdg);
+
+	ret_dp_dpar[0] = dp_dpar_fdg[0];
+	ret_dp_dpar[1] = dp_dpar_fdg[1];
+	ret_dp_dpar[2] = dp_dpar_fdg[0] * T_K;
+	ret_dp_dpar[3] = dp_dpar_fdg[1] * T_K;
+	ret_dp_dpar[4] = dp_dpar_fdg[2];
+
+	return p_Pa;
+}
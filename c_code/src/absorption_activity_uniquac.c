@@ -3,6 +3,8 @@
 ///////////////////////////////////
 #include <math.h>
 #include "absorption_activity_uniquac.h"
+#include "statistics.h"
+#include "status.h"
 
 
 /////////////////////////////
@@ -332,7 +334,184 @@ double absorption_activity_uniquac_x_pTgpsat(double p_Pa, double T_K,
 		}
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(absorption_activity_uniquac_x_pTgpsat, counter_NRM,
+		counter_NRM != 50);
+
+	// Record failure when number of iterations exceeds 50
+	//
+	if (counter_NRM == 50) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"absorption_activity_uniquac_x_pTgpsat", counter_NRM,
+			p_guess_Pa - p_Pa);
+	}
+
 	// Return -1 when number of iterations exceeds 50
 	//
 	return (counter_NRM == 50 ? -1 : x_guess_molmol);
 }
+
+
+/*
+ * absorption_activity_uniquac_fdu_dp_dpar_Txpsat:
+ * -----------------------------------------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa of first component and its
+ * derivatives with respect to the coefficients of the UNIQUAC equation
+ * depending on temperature T_K in K, mole fraction in liquid phase x_molmol in
+ * mol/mol, and saturation pressure of first component p_sat_Pa in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dp_dpar[]:
+ *		Array to be filled with derivatives of equilibrium pressure wrt.
+ *		coefficients (i.e., in order of coefficients).
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of UNIQUAC equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double absorption_activity_uniquac_fdu_dp_dpar_Txpsat(double ret_dp_dpar[],
+	double T_K, double x_molmol, double p_sat_Pa, double isotherm_par[]) {
+	// Calculate mole fractions
+	//
+	double x_1 = x_molmol;
+	double x_2 = 1 - x_1;
+
+	// Calculate segment fractions and area fractions
+	//
+	double q_1 = isotherm_par[2];
+	double q_2 = isotherm_par[3];
+	double sum_r = isotherm_par[4] * x_1 + isotherm_par[5] * x_2;
+	double sum_q = q_1 * x_1 + q_2 * x_2;
+	double V_1 = isotherm_par[4] / sum_r;
+	double F_1 = q_1 / sum_q;
+
+	// Calculate UNIQUAC binary interaction parameters
+	//
+	double tau_12 = exp(-isotherm_par[0] / (IDEAL_GAS_CONSTANT * T_K));
+	double tau_21 = exp(-isotherm_par[1] / (IDEAL_GAS_CONSTANT * T_K));
+
+	// Calculate pressure
+	//
+	double aux_V_F = 1 - V_1 / F_1 + log(V_1 / F_1);
+	double aux_S = q_1 * x_1 + q_2 * x_2 * tau_21;
+	double aux_P = q_1 * x_1 * tau_12 + q_2 * x_2;
+	double aux_B = 1 - log(aux_S / sum_q) - (q_1 * x_1 / aux_S + q_2 * x_2 *
+		tau_12 / aux_P);
+
+	double combCont = (1 - V_1 + log(V_1)) - (isotherm_par[6] / 2) * q_1 *
+		aux_V_F;
+	double resiCont = q_1 * aux_B;
+	double p_Pa = exp(combCont + resiCont) * x_molmol * p_sat_Pa;
+
+	// Calculate derivatives of combinatorial contribution wrt. segment and
+	// area fraction and of residual contribution wrt. coefficients
+	//
+	double dcomb_dV_1 = -1 + 1 / V_1 - (isotherm_par[6] / 2) * q_1 *
+		(1 / V_1 - 1 / F_1);
+	double dcomb_dF_1 = -(isotherm_par[6] / 2) * q_1 * (V_1 / pow(F_1, 2) -
+		1 / F_1);
+	double dB_dtau_12 = -pow(q_2 * x_2 / aux_P, 2);
+	double dB_dtau_21 = -pow(q_2 * x_2 / aux_S, 2) * tau_21;
+	double dB_dq_1 = -2 * x_1 / aux_S + x_1 / sum_q + q_1 * pow(x_1 / aux_S,
+		2) + q_2 * x_2 * x_1 * pow(tau_12 / aux_P, 2);
+	double dB_dq_2 = -x_2 * tau_21 / aux_S + x_2 / sum_q + q_1 * x_1 * x_2 *
+		tau_21 / pow(aux_S, 2) - x_2 * tau_12 / aux_P + q_2 * pow(x_2, 2) *
+		tau_12 / pow(aux_P, 2);
+
+	// Calculate derivatives of pressure wrt. coefficients
+	//
+	ret_dp_dpar[0] = -p_Pa * q_1 * dB_dtau_12 * tau_12 /
+		(IDEAL_GAS_CONSTANT * T_K);
+	ret_dp_dpar[1] = -p_Pa * q_1 * dB_dtau_21 * tau_21 /
+		(IDEAL_GAS_CONSTANT * T_K);
+	ret_dp_dpar[2] = p_Pa * (-(isotherm_par[6] / 2) * aux_V_F + dcomb_dF_1 *
+		q_2 * x_2 / pow(sum_q, 2) + aux_B + q_1 * dB_dq_1);
+	ret_dp_dpar[3] = p_Pa * (-dcomb_dF_1 * q_1 * x_2 / pow(sum_q, 2) +
+		q_1 * dB_dq_2);
+	ret_dp_dpar[4] = p_Pa * dcomb_dV_1 * isotherm_par[5] * x_2 /
+		pow(sum_r, 2);
+	ret_dp_dpar[5] = -p_Pa * dcomb_dV_1 * isotherm_par[4] * x_2 /
+		pow(sum_r, 2);
+	ret_dp_dpar[6] = -p_Pa * q_1 / 2 * aux_V_F;
+
+	return p_Pa;
+}
+
+
+/*
+ * absorption_activity_uniquac_duT_dp_dpar_Txpsat:
+ * -----------------------------------------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa of first component and its
+ * derivatives with respect to the coefficients of the UNIQUAC equation
+ * depending on temperature T_K in K, mole fraction in liquid phase x_molmol in
+ * mol/mol, and saturation pressure of first component p_sat_Pa in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dp_dpar[]:
+ *		Array to be filled with derivatives of equilibrium pressure wrt.
+ *		coefficients (i.e., in order of coefficients).
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of UNIQUAC equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double absorption_activity_uniquac_duT_dp_dpar_Txpsat(double ret_dp_dpar[],
+	double T_K, double x_molmol, double p_sat_Pa, double isotherm_par[]) {
+	// Calculate temperature-dependent du_12 and du_21
+	//
+	double par_fdu[7] = {isotherm_par[0] + isotherm_par[2] * T_K,
+		isotherm_par[1] + isotherm_par[3] * T_K, isotherm_par[4],
+		isotherm_par[5], isotherm_par[6], isotherm_par[7], isotherm_par[8]};
+
+	// Calculate derivatives wrt. du_12 and du_21 of UNIQUAC equation with
+	// fixed dus and apply chain rule
+	//
+	double dp_dpar_fdu[7];
+	double p_Pa = absorption_activity_uniquac_fdu_dp_dpar_Txpsat(dp_dpar_fdu,
+		T_K, x_molmol, p_sat_Pa, par_fdu);
+
+	ret_dp_dpar[0] = dp_dpar_fdu[0];
+	ret_dp_dpar[1] = dp_dpar_fdu[1];
+	ret_dp_dpar[2] = dp_dpar_fdu[0] * T_K;
+	ret_dp_dpar[3] = dp_dpar_fdu[1] * T_K;
+
+	for (int i = 2; i < 7; i++) {
+		ret_dp_dpar[i + 2] = dp_dpar_fdu[i];
+	}
+	return p_Pa;
+}
@@ -3,6 +3,8 @@
 ////////////////////////////////////
 #include <math.h>
 #include "absorption_activity_wangchao.h"
+#include "statistics.h"
+#include "status.h"
 
 
 /////////////////////////////
@@ -282,7 +284,132 @@ double absorption_activity_wangchao_x_pTv1v2psat(double p_Pa, double T_K,
 		}
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(absorption_activity_wangchao_x_pTv1v2psat, counter_NRM,
+		counter_NRM != 50);
+
+	// Record failure when number of iterations exceeds 50
+	//
+	if (counter_NRM == 50) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"absorption_activity_wangchao_x_pTv1v2psat", counter_NRM,
+			p_guess_Pa - p_Pa);
+	}
+
 	// Return -1 when number of iterations exceeds 50
 	//
 	return (counter_NRM == 50 ? -1 : x_guess_molmol);
 }
+
+
+/*
+ * absorption_activity_wangchao_dp_dpar_Txv1v2psat:
+ * ------------------------------------------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa of first component and its
+ * derivatives with respect to the coefficients of the Wang-Chao equation
+ * depending on temperature T_K in K, mole fraction in liquid phase x_molmol in
+ * mol/mol, molar volumes of both components in m³/mol, and saturation pressure
+ * of first component p_sat_Pa in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dp_dpar[]:
+ *		Array to be filled with derivatives of equilibrium pressure wrt.
+ *		coefficients (i.e., in order of coefficients).
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Wang-Chao equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *
+ * Remarks:
+ * --------
+ *	Uses molar volumes stored in JSON file when input v1_m3mol or v2_m3mol is
+ * 	-1. Otherwise, derivatives wrt. molar volumes stored in JSON file are
+ *	zero.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double absorption_activity_wangchao_dp_dpar_Txv1v2psat(double ret_dp_dpar[],
+	double T_K, double x_molmol, double v1_m3mol, double v2_m3mol,
+	double p_sat_Pa, double isotherm_par[]) {
+	// Calculate mole fractions
+	//
+	double x_1 = x_molmol;
+	double x_2 = 1 - x_1;
+
+	// Check, if molar volumes given by inputs need to be used
+	//
+	int volumes_json = (v1_m3mol < 0 || v2_m3mol < 0);
+	double rho_21 = volumes_json ? isotherm_par[4] / isotherm_par[3] :
+		v2_m3mol / v1_m3mol;
+	double rho_12 = volumes_json ? isotherm_par[3] / isotherm_par[4] :
+		v1_m3mol / v2_m3mol;
+
+	// Calculate temperature-dependent coefficients
+	//
+	double RT = IDEAL_GAS_CONSTANT * T_K;
+	double Lambda_12 = rho_21 * exp(-isotherm_par[0] / RT);
+	double Lambda_21 = rho_12 * exp(-isotherm_par[1] / RT);
+
+	double f1 = x_1/x_2 * exp(-isotherm_par[0] / RT);
+	double f2 = x_2/x_1 * exp(-isotherm_par[1] / RT);
+	double x_22 = 1 / (1 + f1);
+	double x_12 = 1 - x_22;
+	double x_11 = 1 / (1 + f2);
+	double x_21 = 1 - x_11;
+
+	// Calculate pressure
+	//
+	double aux1 = x_1 + x_2 * Lambda_21;
+	double aux2 = x_2 + x_1 * Lambda_12;
+	double C = pow(x_21, 2) * isotherm_par[1] + x_2 * x_22 * x_12 / x_1 *
+		isotherm_par[0];
+	double p_Pa = exp(-log(aux1) + x_2 * (Lambda_21 / aux1 - Lambda_12 / aux2) +
+		1 / RT * (isotherm_par[2] / 2) * C) * x_molmol * p_sat_Pa;
+
+	// Calculate derivatives of logarithm of activity coefficient wrt. Lambdas
+	// and of second term wrt. d_lambdas
+	//
+	double dlng_dLambda_12 = -pow(x_2 / aux2, 2);
+	double dlng_dLambda_21 = -Lambda_21 * pow(x_2 / aux1, 2);
+	double dC_dlambda_12 = x_2 / x_1 * (x_22 * x_12 - isotherm_par[0] *
+		(1 - f1) / pow(1 + f1, 3) * f1 / RT);
+	double dC_dlambda_21 = pow(x_21, 2) - isotherm_par[1] * 2 * x_21 /
+		pow(1 + f2, 2) * f2 / RT;
+
+	// Calculate derivatives of pressure wrt. coefficients: Lambdas only depend
+	// on ratio of molar volumes
+	//
+	double dlng_dv_1 = (-dlng_dLambda_12 * Lambda_12 + dlng_dLambda_21 *
+		Lambda_21) / isotherm_par[3];
+
+	ret_dp_dpar[0] = p_Pa * (-dlng_dLambda_12 * Lambda_12 + isotherm_par[2] /
+		2 * dC_dlambda_12) / RT;
+	ret_dp_dpar[1] = p_Pa * (-dlng_dLambda_21 * Lambda_21 + isotherm_par[2] /
+		2 * dC_dlambda_21) / RT;
+	ret_dp_dpar[2] = p_Pa * C / (2 * RT);
+	ret_dp_dpar[3] = volumes_json ? p_Pa * dlng_dv_1 : 0;
+	ret_dp_dpar[4] = volumes_json ? -p_Pa * dlng_dv_1 * isotherm_par[3] /
+		isotherm_par[4] : 0;
+
+	return p_Pa;
+}
@@ -3,6 +3,8 @@
 //////////////////////////////////
 #include <math.h>
 #include "absorption_activity_wilson.h"
+#include "statistics.h"
+#include "status.h"
 
 
 /////////////////////////////
@@ -393,7 +395,214 @@ double absorption_activity_wilson_x_pTv1v2psat(double p_Pa, double T_K,
 		}
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(absorption_activity_wilson_x_pTv1v2psat, counter_NRM,
+		counter_NRM != 50);
+
+	// Record failure when number of iterations exceeds 50
+	//
+	if (counter_NRM == 50) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"absorption_activity_wilson_x_pTv1v2psat", counter_NRM,
+			p_guess_Pa - p_Pa);
+	}
+
 	// Return -1 when number of iterations exceeds 50
 	//
 	return (counter_NRM == 50 ? -1 : x_guess_molmol);
 }
+
+
+/*
+ * absorption_activity_wilson_fdl_dp_dpar_Txv1v2psat:
+ * --------------------------------------------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa of first component and its
+ * derivatives with respect to the coefficients of the Wilson equation depending
+ * on temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
+ * molar volumes of both components in m³/mol, and saturation pressure of first
+ * component p_sat_Pa in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dp_dpar[]:
+ *		Array to be filled with derivatives of equilibrium pressure wrt.
+ *		coefficients (i.e., in order of coefficients).
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Wilson equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *
+ * Remarks:
+ * --------
+ *	Uses molar volumes stored in JSON file when input v1_m3mol or v2_m3mol is
+ * 	-1. Otherwise, derivatives wrt. molar volumes stored in JSON file are
+ *	zero.
+ *	Derivatives wrt. A_12 and A_21 are zero if A_12 is zero and derivatives
+ *	wrt. remaining coefficients are zero otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double absorption_activity_wilson_fdl_dp_dpar_Txv1v2psat(double ret_dp_dpar[],
+	double T_K, double x_molmol, double v1_m3mol, double v2_m3mol,
+	double p_sat_Pa, double isotherm_par[]) {
+	// Calculate mole fractions
+	//
+	double x_1 = x_molmol;
+	double x_2 = 1 - x_1;
+
+	// Calculate Lambdas and their derivatives wrt. coefficients
+	//
+	double A_12;
+	double A_21;
+	double dA_12_dpar[6] = {0, 0, 0, 0, 0, 0};
+	double dA_21_dpar[6] = {0, 0, 0, 0, 0, 0};
+
+	if (isotherm_par[0] * isotherm_par[0] == 0) {
+		// Check, if molar volumes given by inputs need to be used
+		//
+		int volumes_json = (v1_m3mol < 0 || v2_m3mol < 0);
+		double rho_21 = volumes_json ? isotherm_par[5] / isotherm_par[4] :
+			v2_m3mol / v1_m3mol;
+		double rho_12 = volumes_json ? isotherm_par[4] / isotherm_par[5] :
+			v1_m3mol / v2_m3mol;
+
+		//
+		// Lambdas depend on temperature
+		//
+		A_12 = rho_21 * exp(-isotherm_par[2] / (IDEAL_GAS_CONSTANT * T_K));
+		A_21 = rho_12 * exp(-isotherm_par[3] / (IDEAL_GAS_CONSTANT * T_K));
+
+		dA_12_dpar[2] = -A_12 / (IDEAL_GAS_CONSTANT * T_K);
+		dA_21_dpar[3] = -A_21 / (IDEAL_GAS_CONSTANT * T_K);
+
+		if (volumes_json) {
+			dA_12_dpar[4] = -A_12 / isotherm_par[4];
+			dA_21_dpar[4] = A_21 / isotherm_par[4];
+			dA_12_dpar[5] = A_12 / isotherm_par[5];
+			dA_21_dpar[5] = -A_21 / isotherm_par[5];
+		}
+
+	} else {
+		// Lambdas do not depend on temperature
+		//
+		A_12 = isotherm_par[0];
+		A_21 = isotherm_par[1];
+
+		dA_12_dpar[0] = 1;
+		dA_21_dpar[1] = 1;
+
+	}
+
+	// Calculate pressure and derivatives of logarithm of activity coefficient
+	// wrt. Lambdas
+	//
+	double sum_12 = x_1 + A_12 * x_2;
+	double sum_21 = x_2 + A_21 * x_1;
+	double p_Pa = exp(-log(sum_12) + x_2 * (A_12 / sum_12 - A_21 / sum_21)) *
+		x_molmol * p_sat_Pa;
+	double dlng_dA_12 = -A_12 * pow(x_2 / sum_12, 2);
+	double dlng_dA_21 = -pow(x_2 / sum_21, 2);
+
+	// Calculate derivatives of pressure wrt. coefficients
+	//
+	for (int i = 0; i < 6; i++) {
+		ret_dp_dpar[i] = p_Pa * (dlng_dA_12 * dA_12_dpar[i] + dlng_dA_21 *
+			dA_21_dpar[i]);
+	}
+	return p_Pa;
+}
+
+
+/*
+ * absorption_activity_wilson_tdl_dp_dpar_Txv1v2psat:
+ * --------------------------------------------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa of first component and its
+ * derivatives with respect to the coefficients of the Wilson equation depending
+ * on temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
+ * molar volumes of both components in m³/mol, and saturation pressure of first
+ * component p_sat_Pa in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dp_dpar[]:
+ *		Array to be filled with derivatives of equilibrium pressure wrt.
+ *		coefficients (i.e., in order of coefficients).
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Wilson equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *
+ * Remarks:
+ * --------
+ *	Uses molar volumes stored in JSON file when input v1_m3mol or v2_m3mol is
+ * 	-1. Otherwise, derivatives wrt. molar volumes stored in JSON file are
+ *	zero.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double absorption_activity_wilson_tdl_dp_dpar_Txv1v2psat(double ret_dp_dpar[],
+	double T_K, double x_molmol, double v1_m3mol, double v2_m3mol,
+	double p_sat_Pa, double isotherm_par[]) {
+	// Calculate temperature-dependent parameters
+	//
+	double dT_K = T_K - isotherm_par[4];
+	double par_fdl[6] = {0, 0,
+		(isotherm_par[0] + isotherm_par[1] * dT_K) * IDEAL_GAS_CONSTANT,
+		(isotherm_par[2] + isotherm_par[3] * dT_K) * IDEAL_GAS_CONSTANT,
+		isotherm_par[5], isotherm_par[6]};
+
+	// Calculate derivatives wrt. d_lambda_12 and d_lambda_21 of Wilson
+	// equation with fixed d_lambdas and apply chain rule
+	//
+	double dp_dpar_fdl[6];
+	double p_Pa = absorption_activity_wilson_fdl_dp_dpar_Txv1v2psat(
+		dp_dpar_fdl, T_K, x_molmol, v1_m3mol, v2_m3mol, p_sat_Pa, par_fdl);
+
+	ret_dp_dpar[0] = dp_dpar_fdl[2] * IDEAL_GAS_CONSTANT;
+	ret_dp_dpar[1] = dp_dpar_fdl[2] * IDEAL_GAS_CONSTANT * dT_K;
+	ret_dp_dpar[2] = dp_dpar_fdl[3] * IDEAL_GAS_CONSTANT;
+	ret_dp_dpar[3] = dp_dpar_fdl[3] * IDEAL_GAS_CONSTANT * dT_K;
+	ret_dp_dpar[4] = -(dp_dpar_fdl[2] * isotherm_par[1] + dp_dpar_fdl[3] *
+		isotherm_par[3]) * IDEAL_GAS_CONSTANT;
+	ret_dp_dpar[5] = dp_dpar_fdl[4];
+	ret_dp_dpar[6] = dp_dpar_fdl[5];
+
+	return p_Pa;
+}
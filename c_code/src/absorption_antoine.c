@@ -3,6 +3,8 @@
 //////////////////////////
 #include <math.h>
 #include "absorption_antoine.h"
+#include "statistics.h"
+#include "status.h"
 
 
 /////////////////////////////
@@ -108,6 +110,17 @@ double absorption_antoine_X_pT(double p_Pa, double T_K,
 		}
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(absorption_antoine_X_pT, counter_NRM, counter_NRM != 50);
+
+	// Record failure when number of iterations exceeds 50
+	//
+	if (counter_NRM == 50) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"absorption_antoine_X_pT", counter_NRM, p_guess_Pa - p_Pa);
+	}
+
 	// Return -1 when number of iterations exceeds 50
 	//
 	return (counter_NRM == 50 ? -1 : X_guess_kgkg);
@@ -223,6 +236,17 @@ double absorption_antoine_T_pX(double p_Pa, double X_kgkg,
 		T_guess_K = T_guess_K < 0 ? 253.15 : T_guess_K;
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(absorption_antoine_T_pX, counter_NRM, counter_NRM != 50);
+
+	// Record failure when number of iterations exceeds 50
+	//
+	if (counter_NRM == 50) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"absorption_antoine_T_pX", counter_NRM, p_guess_Pa - p_Pa);
+	}
+
 	// Return -1 when number of iterations exceeds 50
 	//
 	return (counter_NRM == 50 ? -1 : T_guess_K);
@@ -425,3 +449,63 @@ double absorption_antoine_dp_dT_XT(double X_kgkg, double T_K,
 	//
 	return log(10) * p_Pa * factor;
 }
+
+
+/*
+ * absorption_antoine_dp_dpar_XT:
+ * ------------------------------
+ *
+ * Calculates equilibrium pressure p in Pa and its derivatives with respect to
+ * the coefficients of the Antoine equation depending on equilibrium
+ * concentration X in kg/kg and equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dp_dpar[]:
+ *		Array to be filled with derivatives of equilibrium pressure wrt.
+ *		coefficients (i.e., in order of coefficients).
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Antoine equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p in Pa.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double absorption_antoine_dp_dpar_XT(double ret_dp_dpar[], double X_kgkg,
+	double T_K, double isotherm_par[]) {
+	// Calculate summands of Antoine equation
+	//
+	double summand = 0;
+	double dsummand_dc = 0;
+
+	for (int i=0; i<5; i++) {
+		summand += (isotherm_par[i] + 1000 * isotherm_par[i+5] / (T_K -
+			isotherm_par[10])) * pow(100 * X_kgkg, i);
+		dsummand_dc += 1000 * isotherm_par[i+5] * pow(100 * X_kgkg, i) /
+			pow(T_K - isotherm_par[10], 2);
+	}
+
+	// Calculate derivatives of pressure wrt. coefficients
+	//
+	double p_Pa = isotherm_par[11] * pow(10, summand);
+
+	for (int i=0; i<5; i++) {
+		ret_dp_dpar[i] = log(10) * p_Pa * pow(100 * X_kgkg, i);
+		ret_dp_dpar[i+5] = ret_dp_dpar[i] * 1000 / (T_K - isotherm_par[10]);
+	}
+	ret_dp_dpar[10] = log(10) * p_Pa * dsummand_dc;
+	ret_dp_dpar[11] = pow(10, summand);
+
+	return p_Pa;
+}
@@ -3,6 +3,8 @@
 ///////////////////////////
 #include <math.h>
 #include "absorption_duehring.h"
+#include "statistics.h"
+#include "status.h"
 
 
 /////////////////////////////
@@ -119,6 +121,17 @@ double absorption_duehring_X_pT(double p_Pa, double T_K,
 		}
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(absorption_duehring_X_pT, counter_NRM, counter_NRM != 50);
+
+	// Record failure when number of iterations exceeds 50
+	//
+	if (counter_NRM == 50) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"absorption_duehring_X_pT", counter_NRM, p_guess_Pa - p_Pa);
+	}
+
 	// Return -1 when number of iterations exceeds 50
 	//
 	return (counter_NRM == 50 ? -1 : X_guess_kgkg);
@@ -462,3 +475,79 @@ double absorption_duehring_dp_dT_XT(double X_kgkg, double T_K,
 	//
 	return dp_dT_ref * dT_ref_dT_cor * dT_cor_dT;
 }
+
+
+/*
+ * absorption_duehring_dp_dpar_XT:
+ * -------------------------------
+ *
+ * Calculates equilibrium pressure p in Pa and its derivatives with respect to
+ * the coefficients of the Duehring equation depending on equilibrium
+ * concentration X in kg/kg and equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dp_dpar[]:
+ *		Array to be filled with derivatives of equilibrium pressure wrt.
+ *		coefficients (i.e., in order of coefficients).
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Duehring equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p in Pa.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double absorption_duehring_dp_dpar_XT(double ret_dp_dpar[], double X_kgkg,
+	double T_K, double isotherm_par[]) {
+	// Calculate concentration-dependent coefficients
+	//
+	double X_cor = X_kgkg * 100;
+	double A = isotherm_par[0] + isotherm_par[1] * X_cor +
+		isotherm_par[2] * pow(X_cor, 2) + isotherm_par[3] * pow(X_cor, 3);
+	double B = isotherm_par[4] + isotherm_par[5] * X_cor +
+		isotherm_par[6] * pow(X_cor, 2) + isotherm_par[7] * pow(X_cor, 3);
+
+	// Calculate temperature-dependent coefficients
+	//
+	double T_cor = T_K - isotherm_par[13];
+	double T_ref = (isotherm_par[12] * T_cor + isotherm_par[11] - B) / A +
+		isotherm_par[13];
+
+	// Calculate pressure and its derivative wrt. reference temperature
+	//
+	double p_Pa = 1 / isotherm_par[14] * pow(10, isotherm_par[8] +
+		isotherm_par[9] / T_ref + isotherm_par[10] / pow(T_ref, 2));
+	double dp_dexp = log(10) * p_Pa;
+	double dp_dT_ref = dp_dexp * (-isotherm_par[9] / pow(T_ref, 2) -
+		2 * isotherm_par[10] / pow(T_ref, 3));
+
+	// Calculate derivatives of pressure wrt. coefficients
+	//
+	double dT_ref_dA = -(T_ref - isotherm_par[13]) / A;
+	double dT_ref_dB = -1 / A;
+
+	for (int i = 0; i < 4; i++) {
+		ret_dp_dpar[i] = dp_dT_ref * dT_ref_dA * pow(X_cor, i);
+		ret_dp_dpar[i + 4] = dp_dT_ref * dT_ref_dB * pow(X_cor, i);
+	}
+	ret_dp_dpar[8] = dp_dexp;
+	ret_dp_dpar[9] = dp_dexp / T_ref;
+	ret_dp_dpar[10] = dp_dexp / pow(T_ref, 2);
+	ret_dp_dpar[11] = dp_dT_ref / A;
+	ret_dp_dpar[12] = dp_dT_ref * T_cor / A;
+	ret_dp_dpar[13] = dp_dT_ref * (1 - isotherm_par[12] / A);
+	ret_dp_dpar[14] = -p_Pa / isotherm_par[14];
+
+	return p_Pa;
+}
@@ -6,6 +6,8 @@
 #include <math.h>
 #include "absorption_mixing.h"
 #include "refrigerant_cubicEoS.h"
+#include "statistics.h"
+#include "status.h"
 
 
 /////////////////////////////
@@ -544,6 +546,8 @@ double absorption_mixing_p_Tx_internal(double *ret_y_1_molmol,
 	// achieved
     //
 	*ret_counter_outer = counter_outer;
+	STATISTICS_SOLVER(absorption_mixing_p_Tx_internal, counter_outer,
+		counter_outer != 100);
 
     if (check_conv > 0) {
         // Use linear interpolation to interpolate pressure between nearest
@@ -552,8 +556,12 @@ double absorption_mixing_p_Tx_internal(double *ret_y_1_molmol,
         if (counter_outer == 100) {
             // Convergence is not achieved: Interpolation is necessary
             //
-			printf("\n\n###########\n# Warning #\n###########");
-			printf("\nNO CONVERGENCE -> USE INTERPOLATION TO FIND SOLUTION.");
+			if (status_report(STATUS_NO_CONVERGENCE,
+				"absorption_mixing_p_Tx_internal", counter_outer, 0)) {
+				printf("\n\n###########\n# Warning #\n###########");
+				printf("\nNO CONVERGENCE -> USE INTERPOLATION TO FIND "
+					"SOLUTION.");
+			}
 
             // Use bisection method to find nearest lower and higher liquid
 			// compositions that have solution that converged
@@ -608,8 +616,11 @@ double absorption_mixing_p_Tx_internal(double *ret_y_1_molmol,
 			// Calculate final solution
 			//
             if (ret_counter_bsm == 100) {
-				printf("\n\n###########\n# Warning #\n###########");
-				printf("\nCOULD NOT FIND SOLUTION -> RETURN OLD SOLTION.");
+				if (status_report(STATUS_NO_CONVERGENCE,
+					"absorption_mixing_p_Tx_internal", ret_counter_bsm, 0)) {
+					printf("\n\n###########\n# Warning #\n###########");
+					printf("\nCOULD NOT FIND SOLUTION -> RETURN OLD SOLTION.");
+				}
                 return p_Pa;
 
             } else {
@@ -678,8 +689,11 @@ double absorption_mixing_p_Tx_internal(double *ret_y_1_molmol,
 			// Calculate final solution
 			//
             if (ret_counter_bsm == 100) {
-				printf("\n\n###########\n# Warning #\n###########");
-				printf("\nCOULD NOT FIND SOLUTION -> RETURN OLD SOLTION.");
+				if (status_report(STATUS_NO_CONVERGENCE,
+					"absorption_mixing_p_Tx_internal", ret_counter_bsm, 0)) {
+					printf("\n\n###########\n# Warning #\n###########");
+					printf("\nCOULD NOT FIND SOLUTION -> RETURN OLD SOLTION.");
+				}
                 return p_Pa;
 
             } else {
@@ -1048,6 +1062,18 @@ double absorption_mixing_T_px(double *ret_y_1_molmol, double *ret_y_2_molmol,
 			T_guess_K = T_guess_K < 0 ? 1 : T_guess_K;
 		}
 
+		// Record number of iterations of solver
+		//
+		STATISTICS_SOLVER(absorption_mixing_T_px, counter_NRM,
+			counter_NRM != 50);
+
+		// Record failure when number of iterations exceeds 50
+		//
+		if (counter_NRM == 50) {
+			status_report(STATUS_NO_CONVERGENCE,
+				"absorption_mixing_T_px", counter_NRM, p_guess_Pa - p_Pa);
+		}
+
 		// Return -1 when number of iterations exceeds 50
 		//
 		return (counter_NRM == 50 ? -1 : T_guess_K);
@@ -1275,5 +1301,9 @@ double absorption_mixing_x_pT(double *ret_y_1_molmol, double *ret_y_2_molmol,
 		}
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(absorption_mixing_x_pT, counter, finished == 1);
+
 	return x_1_molmol;
 }
@@ -11,7 +11,9 @@
 #include "adsorption_langmuir.h"
 #include "adsorption_toth.h"
 #include "adsorption_freundlich.h"
+#include "referenceCounter.h"
 #include "refrigerant.h"
+#include "status.h"
 #include "structDefinitions.c"
 
 
@@ -54,14 +56,18 @@ Adsorption *newAdsorption(const char *isotherm_type) {
     if (retAdsorption == NULL) {
 		// Not enough memory available for Adsorption-structure
 		//
-		printf("\n\n###########\n# Warning #\n###########");
-		printf("\nCannot allocate memory for Adsorption-structure.");
+		if (status_report(STATUS_NO_MEMORY, "newAdsorption", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for Adsorption-structure.");
+		}
         return NULL;
 	}
 
-	// Save general information of isotherm
+	// Save general information of isotherm and initialize number of
+	// references
 	//
 	retAdsorption->isotherm_type = isotherm_type;
+	retAdsorption->no_references = 1;
 
 	// Initialize all function pointers with NULL because NULL is used by
 	// functions of WorkingPair-struct to check if isotherm function is
@@ -271,10 +277,12 @@ Adsorption *newAdsorption(const char *isotherm_type) {
 	} else {
 		// Isotherm does not exist. Therefore, throw warning and free memory.
 		//
-		printf("\n\n###########\n# Warning #\n###########");
-		printf("\nChosen isotherm type \"%s\" does not exist.",
-			isotherm_type);
-		printf("\nCannot create Adsorption-structure.");
+		if (status_report(STATUS_NOT_IMPLEMENTED, "newAdsorption", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nChosen isotherm type \"%s\" does not exist.",
+				isotherm_type);
+			printf("\nCannot create Adsorption-structure.");
+		}
 
 		free(retAdsorption);
 		return NULL;
@@ -287,6 +295,8 @@ Adsorption *newAdsorption(const char *isotherm_type) {
  * --------------
  *
  * Destructor function to free allocated memory of an Adsorption-struct.
+ * If struct is shared by several working pairs, function only decrements
+ * number of references and frees memory when last reference is deleted.
  *
  * Parameters:
  * -----------
@@ -297,6 +307,8 @@ Adsorption *newAdsorption(const char *isotherm_type) {
  * --------
  *	01/05/2020, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Added number of references.
  *
  */
 void delAdsorption(void *adsorption) {
@@ -307,7 +319,8 @@ void delAdsorption(void *adsorption) {
     // Because of initialization function, Adsorption-struct is NULL or fully
 	// built
 	//
-    if (retAdsorption != NULL) {
+    if (retAdsorption != NULL &&
+		REFERENCES_DECREMENT(&retAdsorption->no_references) == 0) {
 		free(retAdsorption);
     }
 }
@@ -474,10 +487,12 @@ double warning_func_par(const char *name_function,
 	const char *name_ads_function) {
 	// Print warning
 	//
-	printf("\n\n###########\n# Warning #\n###########");
-	printf("\nChosen adsorption function \"%s\" is not implemented or its "
-		"parameter do not exist.", name_function);
-	printf("\nReturn -1 for function call \"%s\".", name_ads_function);
+	if (status_report(STATUS_NOT_IMPLEMENTED, name_ads_function, 0, 0)) {
+		printf("\n\n###########\n# Warning #\n###########");
+		printf("\nChosen adsorption function \"%s\" is not implemented or its "
+			"parameter do not exist.", name_function);
+		printf("\nReturn -1 for function call \"%s\".", name_ads_function);
+	}
 
 	// Return error indicator
 	//
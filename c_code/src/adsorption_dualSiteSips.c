@@ -3,6 +3,8 @@
 ///////////////////////////////
 #include <math.h>
 #include "adsorption_dualSiteSips.h"
+#include "statistics.h"
+#include "status.h"
 
 
 /////////////////////////////
@@ -160,6 +162,18 @@ double adsorption_dualSiteSips_p_wT(double w_kgkg, double T_K,
 		p_guess_Pa = p_guess_Pa < 0 ? 1000 : p_guess_Pa;
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(adsorption_dualSiteSips_p_wT, counter_NRM,
+		counter_NRM != 50);
+
+	// Record failure when number of iterations exceeds 50
+	//
+	if (counter_NRM == 50) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"adsorption_dualSiteSips_p_wT", counter_NRM, w_guess_kgkg - w_kgkg);
+	}
+
 	// Return -1 when number of iterations exceeds 50
 	//
 	return (counter_NRM == 50 ? -1 : p_guess_Pa);
@@ -233,6 +247,18 @@ double adsorption_dualSiteSips_T_pw(double p_Pa, double w_kgkg,
 		T_guess_K = T_guess_K < 0 ? 323.15 : T_guess_K;
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(adsorption_dualSiteSips_T_pw, counter_NRM,
+		counter_NRM != 50);
+
+	// Record failure when number of iterations exceeds 50
+	//
+	if (counter_NRM == 50) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"adsorption_dualSiteSips_T_pw", counter_NRM, w_guess_kgkg - w_kgkg);
+	}
+
 	// Returns -1 when number of iterations exceeds 50
 	//
 	return (counter_NRM == 50 ? -1 : T_guess_K);
@@ -511,3 +537,78 @@ double adsorption_dualSiteSips_piStar_pyxgTM(double p_total_Pa, double y_molmol,
 		pow(b_A * p0_Pa, 1 / isotherm_par[4])) + isotherm_par[5] *
 		isotherm_par[7] * log(1 + pow(b_B * p0_Pa, 1 / isotherm_par[5]))));
 }
+
+
+/*
+ * adsorption_dualSiteSips_dw_dpar_pT:
+ * -----------------------------------
+ *
+ * Calculates equilibrium loading w in kg/kg and its derivatives with respect to
+ * the coefficients of the Dual-Site-Sips equation depending on equilibrium
+ * pressure p in Pa and equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dw_dpar[]:
+ *		Array to be filled with derivatives of equilibrium loading wrt.
+ *		coefficients (i.e., in order of coefficients).
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Dual-Site-Sips
+ *		equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium loading in kg/kg.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double adsorption_dualSiteSips_dw_dpar_pT(double ret_dw_dpar[], double p_Pa,
+	double T_K, double isotherm_par[]) {
+	// Calculate temperature-dependent coefficients
+	//
+	double T_red = 1 - T_K / isotherm_par[8];
+	double b_A = isotherm_par[0] * exp(isotherm_par[2] / (IDEAL_GAS_CONSTANT *
+		T_K) * T_red);
+	double b_B = isotherm_par[1] * exp(isotherm_par[3] / (IDEAL_GAS_CONSTANT *
+		T_K) * T_red);
+
+	// Calculate loading of both sites
+	//
+	double y_A = pow((b_A * p_Pa), 1/isotherm_par[4]);
+	double y_B = pow((b_B * p_Pa), 1/isotherm_par[5]);
+	double w_A = isotherm_par[6] * y_A / (1 + y_A);
+	double w_B = isotherm_par[7] * y_B / (1 + y_B);
+
+	// Calculate derivatives of loadings of both sites wrt. logarithm of b
+	//
+	double dw_A_dy_A = isotherm_par[6] / pow(1 + y_A, 2);
+	double dw_B_dy_B = isotherm_par[7] / pow(1 + y_B, 2);
+	double dw_A_dlnb_A = dw_A_dy_A * y_A / isotherm_par[4];
+	double dw_B_dlnb_B = dw_B_dy_B * y_B / isotherm_par[5];
+
+	// Calculate derivatives of loading wrt. coefficients
+	//
+	ret_dw_dpar[0] = dw_A_dlnb_A / isotherm_par[0];
+	ret_dw_dpar[1] = dw_B_dlnb_B / isotherm_par[1];
+	ret_dw_dpar[2] = dw_A_dlnb_A * T_red / (IDEAL_GAS_CONSTANT * T_K);
+	ret_dw_dpar[3] = dw_B_dlnb_B * T_red / (IDEAL_GAS_CONSTANT * T_K);
+	ret_dw_dpar[4] = -dw_A_dy_A * y_A * log(b_A * p_Pa) /
+		pow(isotherm_par[4], 2);
+	ret_dw_dpar[5] = -dw_B_dy_B * y_B * log(b_B * p_Pa) /
+		pow(isotherm_par[5], 2);
+	ret_dw_dpar[6] = y_A / (1 + y_A);
+	ret_dw_dpar[7] = y_B / (1 + y_B);
+	ret_dw_dpar[8] = (dw_A_dlnb_A * isotherm_par[2] + dw_B_dlnb_B *
+		isotherm_par[3]) / (IDEAL_GAS_CONSTANT * pow(isotherm_par[8], 2));
+
+	return (w_A + w_B);
+}
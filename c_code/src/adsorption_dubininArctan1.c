@@ -3,6 +3,8 @@
 /////////////////////////////////
 #include <math.h>
 #include "adsorption_dubininArctan1.h"
+#include "statistics.h"
+#include "status.h"
 
 
 /////////////////////////////
@@ -336,6 +338,19 @@ double adsorption_dubininArctan1_T_pwpsatRho(double p_Pa, double w_kgkg,
 
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(adsorption_dubininArctan1_T_pwpsatRho, counter_NRM,
+		counter_NRM != 50);
+
+	// Record failure when number of iterations exceeds 50
+	//
+	if (counter_NRM == 50) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"adsorption_dubininArctan1_T_pwpsatRho", counter_NRM,
+			w_guess_kgkg - w_kgkg);
+	}
+
 	return (counter_NRM == 50 ? -1 : T_guess_K);
 }
 
@@ -755,3 +770,63 @@ double adsorption_dubininArctan1_piStar_pyxgTpsatRhoM(double p_total_Pa,
 
 	return (piStar_molkg_num);
 }
+
+
+/*
+ * adsorption_dubininArctan1_dw_dpar_pTpsatRho:
+ * --------------------------------------------
+ *
+ * Calculates equilibrium loading w in kg/kg and its derivatives with respect to
+ * the coefficients of the Dubinin-Arctan1 equation depending on equilibrium
+ * pressure p in Pa, equilibrium temperature T in K, saturation pressure p_Sat
+ * in Pa, and saturated liquid density of adsorpt rho_l in kg/m³.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dw_dpar[]:
+ *		Array to be filled with derivatives of equilibrium loading wrt.
+ *		coefficients (i.e., in order of coefficients).
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Dubinin-Arctan1
+ *		equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium loading in kg/kg.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double adsorption_dubininArctan1_dw_dpar_pTpsatRho(double ret_dw_dpar[],
+	double p_Pa, double T_K, double p_sat_Pa, double rho_l_kgm3,
+	double isotherm_par[]) {
+	// Calculate adsorption potential and argument of arc tangent
+	//
+	double A_Jmol = IDEAL_GAS_CONSTANT * T_K * log(p_sat_Pa / p_Pa);
+	double s = (A_Jmol - isotherm_par[1]) / isotherm_par[2];
+	double datan_ds = 1 / (1 + pow(s, 2));
+
+	// Calculate derivatives of loading wrt. coefficients
+	//
+	ret_dw_dpar[0] = (atan(s) + PI/2) / PI * rho_l_kgm3;
+	ret_dw_dpar[1] = -isotherm_par[0] / PI * datan_ds / isotherm_par[2] *
+		rho_l_kgm3;
+	ret_dw_dpar[2] = ret_dw_dpar[1] * s;
+	ret_dw_dpar[3] = rho_l_kgm3;
+
+	// Calculate loading
+	//
+	return (isotherm_par[0] * ret_dw_dpar[0] + isotherm_par[3] * rho_l_kgm3);
+}
@@ -3,6 +3,8 @@
 /////////////////////////////
 #include <math.h>
 #include "adsorption_freundlich.h"
+#include "statistics.h"
+#include "status.h"
 
 
 /////////////////////////////
@@ -212,6 +214,19 @@ double adsorption_freundlich_T_pwpsat(double p_Pa, double w_kgkg,
 		T_guess_K = T_guess_K < 0 ? 323.15 : T_guess_K;
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(adsorption_freundlich_T_pwpsat, counter_NRM,
+		counter_NRM != 50);
+
+	// Record failure when number of iterations exceeds 50
+	//
+	if (counter_NRM == 50) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"adsorption_freundlich_T_pwpsat", counter_NRM,
+			w_guess_kgkg - w_kgkg);
+	}
+
 	// Return -1 when number of iterations exceeds 50
 	//
 	return (counter_NRM == 50 ? -1 : T_guess_K);
@@ -502,3 +517,61 @@ double adsorption_freundlich_piStar_pyxgTpsatM(double p_total_Pa,
 
 	return (piStar_molkg_num);
 }
+
+
+/*
+ * adsorption_freundlich_dw_dpar_pTpsat:
+ * -------------------------------------
+ *
+ * Calculates equilibrium loading w in kg/kg and its derivatives with respect to
+ * the coefficients of the Freundlich equation depending on equilibrium pressure
+ * p in Pa, equilibrium temperature T in K, and saturation pressure p_Sat in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dw_dpar[]:
+ *		Array to be filled with derivatives of equilibrium loading wrt.
+ *		coefficients (i.e., in order of coefficients).
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Freundlich equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium loading in kg/kg.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double adsorption_freundlich_dw_dpar_pTpsat(double ret_dw_dpar[],
+	double p_Pa, double T_K, double p_sat_Pa, double isotherm_par[]) {
+	// Calculate temperature-dependent coefficients
+	//
+	double A = isotherm_par[0] + isotherm_par[1] * T_K + isotherm_par[2] *
+		pow(T_K, 2) + isotherm_par[3] * pow(T_K, 3);
+	double B = isotherm_par[4] + isotherm_par[5] * T_K + isotherm_par[6] *
+		pow(T_K, 2) + isotherm_par[7] * pow(T_K, 3);
+
+	// Calculate derivatives of loading wrt. coefficients
+	//
+	double p_rel = pow(p_Pa / p_sat_Pa, B);
+	double dw_dB = A * p_rel * log(p_Pa / p_sat_Pa);
+
+	for (int i = 0; i < 4; i++) {
+		ret_dw_dpar[i] = pow(T_K, i) * p_rel;
+		ret_dw_dpar[i + 4] = pow(T_K, i) * dw_dB;
+	}
+
+	// Calculate loading
+	//
+	return (A * p_rel);
+}
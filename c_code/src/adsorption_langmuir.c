@@ -398,3 +398,55 @@ double adsorption_langmuir_piStar_pyxgTM(double p_total_Pa, double y_molmol,
 	return (isotherm_par[2] / M_kgmol * log(1 + K * p_total_Pa * y_molmol /
 		x_molmol / gamma));
 }
+
+
+/*
+ * adsorption_langmuir_dw_dpar_pT:
+ * -------------------------------
+ *
+ * Calculates equilibrium loading w in kg/kg and its derivatives with respect to
+ * the coefficients of the Langmuir equation depending on equilibrium pressure p
+ * in Pa and equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dw_dpar[]:
+ *		Array to be filled with derivatives of equilibrium loading wrt.
+ *		coefficients (i.e., in order of coefficients).
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Langmuir equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium loading in kg/kg.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double adsorption_langmuir_dw_dpar_pT(double ret_dw_dpar[], double p_Pa,
+	double T_K, double isotherm_par[]) {
+	// Calculate temperature-dependent coefficients
+	//
+	double K_exp = exp(isotherm_par[0] / (IDEAL_GAS_CONSTANT * T_K));
+	double K = isotherm_par[1] * K_exp;
+
+	// Calculate derivatives of loading wrt. coefficients
+	//
+	double dw_dK = isotherm_par[2] * p_Pa / pow(1 + K * p_Pa, 2);
+
+	ret_dw_dpar[0] = dw_dK * K / (IDEAL_GAS_CONSTANT * T_K);
+	ret_dw_dpar[1] = dw_dK * K_exp;
+	ret_dw_dpar[2] = K * p_Pa / (1 + K * p_Pa);
+
+	// Calculate loading
+	//
+	return (isotherm_par[2] * ret_dw_dpar[2]);
+}
@@ -3,6 +3,8 @@
 ///////////////////////
 #include <math.h>
 #include "adsorption_toth.h"
+#include "statistics.h"
+#include "status.h"
 
 
 /////////////////////////////
@@ -190,6 +192,17 @@ double adsorption_toth_T_pw(double p_Pa, double w_kgkg, double isotherm_par[]) {
 		T_guess_K = T_guess_K < 0 ? 323.15 : T_guess_K;
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(adsorption_toth_T_pw, counter_NRM, counter_NRM != 50);
+
+	// Record failure when number of iterations exceeds 50
+	//
+	if (counter_NRM == 50) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"adsorption_toth_T_pw", counter_NRM, w_guess_kgkg - w_kgkg);
+	}
+
 	// Return -1 when number of iterations exceeds 50
 	//
 	return (counter_NRM == 50 ? -1 : T_guess_K);
@@ -502,3 +515,78 @@ double adsorption_toth_piStar_pyxgTM(double p_total_Pa, double y_molmol,
 
 	return (piStar_molkg_num);
 }
+
+
+/*
+ * adsorption_toth_dw_dpar_pT:
+ * ---------------------------
+ *
+ * Calculates equilibrium loading w in kg/kg and its derivatives with respect to
+ * the coefficients of the Toth equation depending on equilibrium pressure p in
+ * Pa and equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double ret_dw_dpar[]:
+ *		Array to be filled with derivatives of equilibrium loading wrt.
+ *		coefficients (i.e., in order of coefficients).
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double isotherm_par[]:
+ *		Array of doubles that contains coefficients of Toth equation.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium loading in kg/kg.
+ *
+ * Remarks:
+ * --------
+ *	Derivative wrt. coefficient r is zero if r is negative (i.e., if r is
+ *	replaced by n).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double adsorption_toth_dw_dpar_pT(double ret_dw_dpar[], double p_Pa,
+	double T_K, double isotherm_par[]) {
+	// Calculate temperature-dependent coefficients
+	//
+	double b = isotherm_par[0] * exp(isotherm_par[4] / T_K);
+	double n = isotherm_par[3] + isotherm_par[1] / T_K;
+	double r = isotherm_par[5]<0 ? n : isotherm_par[5];
+
+	// Calculate loading
+	//
+	double b_r_p_n = pow(b, r) * pow(p_Pa, n);
+	double denominator = 1 + b_r_p_n;
+	double w_w_s = pow(b, isotherm_par[2]) * p_Pa / pow(denominator, 1/n);
+	double w_kgkg = isotherm_par[6] * w_w_s;
+
+	// Calculate derivatives of logarithm of loading wrt. logarithm of b and
+	// wrt. n: If r is negative, r is equal to n
+	//
+	double dlnw_dlnb = isotherm_par[2] - r / n * b_r_p_n / denominator;
+	double dlnw_dn = log(denominator) / pow(n, 2) - b_r_p_n * log(p_Pa) /
+		(n * denominator);
+	double dlnw_dr = -b_r_p_n * log(b) / (n * denominator);
+
+	dlnw_dn += (isotherm_par[5] < 0) ? dlnw_dr : 0;
+
+	// Calculate derivatives of loading wrt. coefficients
+	//
+	ret_dw_dpar[0] = w_kgkg * dlnw_dlnb / isotherm_par[0];
+	ret_dw_dpar[1] = w_kgkg * dlnw_dn / T_K;
+	ret_dw_dpar[2] = w_kgkg * log(b);
+	ret_dw_dpar[3] = w_kgkg * dlnw_dn;
+	ret_dw_dpar[4] = w_kgkg * dlnw_dlnb / T_K;
+	ret_dw_dpar[5] = (isotherm_par[5] < 0) ? 0 : w_kgkg * dlnw_dr;
+	ret_dw_dpar[6] = w_w_s;
+
+	return w_kgkg;
+}
@@ -0,0 +1,676 @@
+/////////////////
+// batchPool.c //
+/////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef __unix
+#include <unistd.h>
+#endif
+#include "batchPool.h"
+#include "spinLock.h"
+#include "threadLocal.h"
+#include "threadSupport.h"
+#include "workingPair.h"
+#include "status.h"
+#include "structDefinitions.c"
+
+
+/////////////////////////////
+// Definition of constants //
+/////////////////////////////
+#ifndef BATCHPOOL_NO_CHUNKS
+#define BATCHPOOL_NO_CHUNKS 16
+#endif
+
+
+/////////////////////////////
+// Definition of variables //
+/////////////////////////////
+/*
+ * Per-thread pointer of BatchPool-struct whose batch is currently evaluated by
+ * the thread: Worker threads always point to their pool, and the thread calling
+ * a pool points to it while the batch is evaluated. Thus, kernels calling the
+ * same pool again are detected.
+ *
+ */
+THREAD_LOCAL BatchPool *batchPool_current = NULL;
+
+
+///////////////////////////
+// Definition of structs //
+///////////////////////////
+/*
+ * BatchRange:
+ * -----------
+ *
+ * Contains range of chunks that is owned by one thread of a BatchPool-struct.
+ * The owning thread takes chunks from the beginning of the range, while other
+ * threads steal the upper half of the range when their own range is empty.
+ *
+ * Attributes:
+ * -----------
+ *	long lock:
+ *		Spin lock that is 1 while a thread changes the range and 0 otherwise.
+ *	int begin:
+ *		First chunk of range.
+ *	int end:
+ *		Chunk after last chunk of range.
+ *	char padding[]:
+ *		Padding so that ranges of different threads do not share a cache
+ *		line.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/*
+ * BatchWorker:
+ * ------------
+ *
+ * Contains argument of a worker thread of a BatchPool-struct.
+ *
+ * Attributes:
+ * -----------
+ *	BatchPool *batchPool:
+ *		Pointer of BatchPool-struct owning worker thread.
+ *	int index:
+ *		Index of worker thread (i.e., index of its range of chunks).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/*
+ * BatchPool:
+ * ----------
+ *
+ * Contains long-lived worker threads that evaluate batches of items in
+ * parallel. Items are divided into chunks of a given grain size and chunks are
+ * distributed among threads by work stealing. Thus, threads whose chunks are
+ * evaluated fast (e.g., states that converge quickly) take over chunks of
+ * other threads.
+ *
+ * Attributes:
+ * -----------
+ *	int no_threads:
+ *		Number of threads including the thread calling the pool.
+ *	THREAD *threads:
+ *		Array containing worker threads (i.e., no_threads - 1 threads).
+ *	BatchWorker *workers:
+ *		Array containing arguments of worker threads.
+ *	BatchRange *ranges:
+ *		Cache-line aligned array containing ranges of chunks of all threads.
+ *
+ *	MUTEX mutex:
+ *		Mutex protecting generation, number of running threads, and shutdown
+ *		flag.
+ *	MUTEX mutex_run:
+ *		Mutex ensuring that only one batch is evaluated at a time.
+ *	CONDITION condition_start:
+ *		Condition variable signaling new batch or shutdown to worker threads.
+ *	CONDITION condition_finished:
+ *		Condition variable signaling that all worker threads are finished.
+ *	unsigned long generation:
+ *		Number of batches started.
+ *	int no_running:
+ *		Number of worker threads that still evaluate current batch.
+ *	int shutdown:
+ *		Flag indicating whether worker threads shall terminate.
+ *
+ *	function kernel:
+ *		Function evaluating items from first item to item after last item
+ *		with pointer to context of current batch.
+ *	void *context:
+ *		Pointer to context of current batch.
+ *	int no_items:
+ *		Number of items of current batch.
+ *	int grain_size:
+ *		Number of items per chunk of current batch.
+ *
+ * Remarks:
+ * --------
+ *	Each item is evaluated exactly once and by exactly one thread. Hence, if
+ *	results of each item are written to their own memory, results do not
+ *	depend on the number of threads or the order of evaluation.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * batchPool_worker:
+ * -----------------
+ *
+ * Thread function of worker threads. Worker threads wait for new batches,
+ * evaluate chunks of a batch, and signal when they are finished. Function
+ * returns if the pool is shut down.
+ *
+ * Parameters:
+ * -----------
+ *	void *worker:
+ *		Pointer of BatchWorker-struct.
+ *
+ * Returns:
+ * --------
+ *	THREAD_RETURN:
+ *		Returns THREAD_RETURN_VALUE.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+THREAD_RETURN batchPool_worker(void *worker) {
+	// Typecast void pointer given as input to pointer of BatchWorker-struct
+	//
+	BatchWorker *retWorker = (BatchWorker *) worker;
+	BatchPool *retBatchPool = retWorker->batchPool;
+	unsigned long generation = 0;
+
+	batchPool_current = retBatchPool;
+
+	while (1) {
+		// Wait for new batch or shutdown
+		//
+		MUTEX_LOCK(&retBatchPool->mutex);
+		while (retBatchPool->generation == generation &&
+			!retBatchPool->shutdown) {
+			CONDITION_WAIT(&retBatchPool->condition_start,
+				&retBatchPool->mutex);
+		}
+
+		if (retBatchPool->shutdown) {
+			MUTEX_UNLOCK(&retBatchPool->mutex);
+			break;
+		}
+		generation = retBatchPool->generation;
+		MUTEX_UNLOCK(&retBatchPool->mutex);
+
+		// Evaluate chunks and signal when last worker is finished
+		//
+		batchPool_work(retBatchPool, retWorker->index);
+
+		MUTEX_LOCK(&retBatchPool->mutex);
+		retBatchPool->no_running--;
+
+		if (retBatchPool->no_running == 0) {
+			CONDITION_BROADCAST(&retBatchPool->condition_finished);
+		}
+		MUTEX_UNLOCK(&retBatchPool->mutex);
+	}
+
+	return THREAD_RETURN_VALUE;
+}
+
+
+/*
+ * newBatchPool:
+ * -------------
+ *
+ * Initialization function to create a new BatchPool-struct. Therefore,
+ * function starts no_threads - 1 worker threads that wait for batches. The
+ * thread calling the pool also evaluates items. If threads cannot be started
+ * or memory allocation fails, functions returns NULL and prints a warning.
+ *
+ * Parameters:
+ * -----------
+ *	int no_threads:
+ *		Number of threads. If no_threads is smaller than 1, number of
+ *		processors is used.
+ *
+ * Returns:
+ * --------
+ *	struct *BatchPool:
+ *		Returns malloc-ed BatchPool-struct.
+ *
+ * Remarks:
+ * --------
+ *	Pool can be reused by several batches to avoid starting threads for each
+ *	batch. Pool must be released by delBatchPool.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API BatchPool *newBatchPool(int no_threads) {
+	// Try to allocate memory for BatchPool-struct and its arrays
+	//
+	no_threads = (no_threads < 1) ? batchPool_no_processors() : no_threads;
+
+	BatchPool *retBatchPool = (BatchPool *) malloc(sizeof(BatchPool));
+
+	if (retBatchPool == NULL) {
+		if (status_report(STATUS_NO_MEMORY, "newBatchPool", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for BatchPool-struct.");
+		}
+		return NULL;
+	}
+
+	retBatchPool->threads = (THREAD *) malloc(no_threads * sizeof(THREAD));
+	retBatchPool->workers = (BatchWorker *) malloc(no_threads *
+		sizeof(BatchWorker));
+	retBatchPool->ranges = (BatchRange *) malloc_aligned(no_threads *
+		sizeof(BatchRange));
+
+	if (retBatchPool->threads == NULL || retBatchPool->workers == NULL ||
+		retBatchPool->ranges == NULL) {
+		if (status_report(STATUS_NO_MEMORY, "newBatchPool", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for threads of BatchPool-struct.");
+		}
+
+		free(retBatchPool->threads);
+		free(retBatchPool->workers);
+		free_aligned(retBatchPool->ranges);
+		free(retBatchPool);
+		return NULL;
+	}
+
+	// Initialize synchronization of threads
+	//
+	MUTEX_INIT(&retBatchPool->mutex);
+	MUTEX_INIT(&retBatchPool->mutex_run);
+	CONDITION_INIT(&retBatchPool->condition_start);
+	CONDITION_INIT(&retBatchPool->condition_finished);
+	retBatchPool->generation = 0;
+	retBatchPool->no_running = 0;
+	retBatchPool->shutdown = 0;
+
+	retBatchPool->kernel = NULL;
+	retBatchPool->context = NULL;
+	retBatchPool->no_items = 0;
+	retBatchPool->grain_size = 1;
+
+	for (int i = 0; i < no_threads; i++) {
+		retBatchPool->workers[i].batchPool = retBatchPool;
+		retBatchPool->workers[i].index = i;
+		retBatchPool->ranges[i].lock = 0;
+		retBatchPool->ranges[i].begin = 0;
+		retBatchPool->ranges[i].end = 0;
+	}
+
+	// Start worker threads: Thread calling the pool has index 0. If a thread
+	// cannot be started, started threads are terminated by destructor
+	//
+	retBatchPool->no_threads = 1;
+
+	for (int i = 1; i < no_threads; i++) {
+		if (THREAD_CREATE(&retBatchPool->threads[i], &batchPool_worker,
+			&retBatchPool->workers[i]) != 0) {
+			if (status_report(STATUS_INVALID_INPUT, "newBatchPool", 0, 0)) {
+				printf("\n\n###########\n# Warning #\n###########");
+				printf("\nCannot start thread %i of BatchPool-struct.", i);
+			}
+
+			delBatchPool(retBatchPool);
+			return NULL;
+		}
+		retBatchPool->no_threads++;
+	}
+
+	// Return structure
+	//
+	return retBatchPool;
+}
+
+
+/*
+ * delBatchPool:
+ * -------------
+ *
+ * Destructor function that terminates worker threads and frees allocated
+ * memory of a BatchPool-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *BatchPool:
+ *		Pointer of BatchPool-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void delBatchPool(void *batchPool) {
+	// Typecast void pointer given as input to pointer of BatchPool-struct
+	//
+	BatchPool *retBatchPool = (BatchPool *) batchPool;
+
+	if (retBatchPool == NULL) {
+		return;
+	}
+
+	// Terminate worker threads
+	//
+	MUTEX_LOCK(&retBatchPool->mutex);
+	retBatchPool->shutdown = 1;
+	CONDITION_BROADCAST(&retBatchPool->condition_start);
+	MUTEX_UNLOCK(&retBatchPool->mutex);
+
+	for (int i = 1; i < retBatchPool->no_threads; i++) {
+		THREAD_JOIN(retBatchPool->threads[i]);
+	}
+
+	// Free memory
+	//
+	MUTEX_DESTROY(&retBatchPool->mutex);
+	MUTEX_DESTROY(&retBatchPool->mutex_run);
+	CONDITION_DESTROY(&retBatchPool->condition_start);
+	CONDITION_DESTROY(&retBatchPool->condition_finished);
+
+	free(retBatchPool->threads);
+	free(retBatchPool->workers);
+	free_aligned(retBatchPool->ranges);
+	free(retBatchPool);
+}
+
+
+/*
+ * getBatchPoolNoThreads:
+ * ----------------------
+ *
+ * Returns number of threads of a BatchPool-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *BatchPool:
+ *		Pointer of BatchPool-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of threads including thread calling the pool or -1 if pool
+ *		does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getBatchPoolNoThreads(void *batchPool) {
+	// Typecast void pointer given as input to pointer of BatchPool-struct
+	//
+	BatchPool *retBatchPool = (BatchPool *) batchPool;
+
+	return (retBatchPool == NULL) ? -1 : retBatchPool->no_threads;
+}
+
+
+/*
+ * batchPool_no_processors:
+ * ------------------------
+ *
+ * Auxiliary function returning number of processors.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of processors (i.e., at least 1).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int batchPool_no_processors(void) {
+#ifdef __unix
+	long no_processors = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return (no_processors < 1) ? 1 : (int) no_processors;
+#elif defined(_MSC_VER)
+	SYSTEM_INFO system_info;
+	GetSystemInfo(&system_info);
+
+	return (system_info.dwNumberOfProcessors < 1) ? 1 :
+		(int) system_info.dwNumberOfProcessors;
+#else
+	const char *no_processors = getenv("NUMBER_OF_PROCESSORS");
+
+	return (no_processors == NULL || atoi(no_processors) < 1) ? 1 :
+		atoi(no_processors);
+#endif
+}
+
+
+/*
+ * batchPool_grain_size:
+ * ---------------------
+ *
+ * Auxiliary function returning grain size of a batch. If no grain size is
+ * given, each thread gets BATCHPOOL_NO_CHUNKS chunks on average. Thus, work
+ * can be stolen without splitting batches into many small chunks.
+ *
+ * Parameters:
+ * -----------
+ *	int no_items:
+ *		Number of items.
+ *	int grain_size:
+ *		Number of items per chunk. If grain_size is smaller than 1, grain size
+ *		is chosen automatically.
+ *	int no_threads:
+ *		Number of threads.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of items per chunk (i.e., at least 1).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int batchPool_grain_size(int no_items, int grain_size, int no_threads) {
+	if (grain_size >= 1) {
+		return grain_size;
+	}
+
+	long long no_chunks = (long long) BATCHPOOL_NO_CHUNKS * no_threads;
+	long long automatic = (no_items + no_chunks - 1) / no_chunks;
+
+	return (automatic < 1) ? 1 : (int) automatic;
+}
+
+
+/*
+ * batchPool_work:
+ * ---------------
+ *
+ * Auxiliary function that evaluates chunks of the current batch by one thread.
+ * The thread takes chunks from the beginning of its own range. If its range is
+ * empty, the thread steals the upper half of the range of another thread. The
+ * function returns if no range contains chunks.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *BatchPool:
+ *		Pointer of BatchPool-struct.
+ *	int index:
+ *		Index of thread.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void batchPool_work(BatchPool *batchPool, int index) {
+	BatchRange *own = &batchPool->ranges[index];
+	int no_threads = batchPool->no_threads;
+	long long grain_size = batchPool->grain_size;
+
+	while (1) {
+		// Take first chunk of own range
+		//
+		int chunk = -1;
+
+		SPINLOCK_ACQUIRE(&own->lock);
+		if (own->begin < own->end) {
+			chunk = own->begin;
+			own->begin++;
+		}
+		SPINLOCK_RELEASE(&own->lock);
+
+		// Own range is empty: Steal upper half of range of other threads,
+		// starting with next thread. Stolen range except for its first chunk
+		// becomes own range and can be stolen again
+		//
+		for (int i = 1; i < no_threads && chunk < 0; i++) {
+			BatchRange *victim = &batchPool->ranges[(index + i) % no_threads];
+
+			SPINLOCK_ACQUIRE(&victim->lock);
+			int end = victim->end;
+			int begin = end - (end - victim->begin + 1) / 2;
+
+			if (begin < end) {
+				victim->end = begin;
+			}
+			SPINLOCK_RELEASE(&victim->lock);
+
+			if (begin < end) {
+				chunk = begin;
+
+				SPINLOCK_ACQUIRE(&own->lock);
+				own->begin = begin + 1;
+				own->end = end;
+				SPINLOCK_RELEASE(&own->lock);
+			}
+		}
+
+		if (chunk < 0) {
+			return;
+		}
+
+		// Evaluate items of chunk
+		//
+		long long item_begin = chunk * grain_size;
+		long long item_end = item_begin + grain_size;
+		item_end = (item_end < batchPool->no_items) ? item_end :
+			batchPool->no_items;
+
+		batchPool->kernel((int) item_begin, (int) item_end,
+			batchPool->context);
+	}
+}
+
+
+/*
+ * batchPool_run:
+ * --------------
+ *
+ * Evaluates items of a batch in parallel by threads of the BatchPool-struct.
+ * The kernel is called with a first item and the item after the last item of
+ * a chunk. The function returns after all items are evaluated. If the pool is
+ * NULL, has only one thread, or the batch has only one chunk, the calling
+ * thread evaluates all items. The calling thread also evaluates all items if
+ * the function is called by a kernel of a batch of the same pool.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *BatchPool:
+ *		Pointer of BatchPool-struct.
+ *	int no_items:
+ *		Number of items.
+ *	int grain_size:
+ *		Number of items per chunk. If grain_size is smaller than 1, grain size
+ *		is chosen automatically.
+ *	void (*kernel)(int, int, void*):
+ *		Function evaluating items from first item to item after last item
+ *		with pointer to context.
+ *	void *context:
+ *		Pointer to context that is passed to kernel.
+ *
+ * Remarks:
+ * --------
+ *	Kernels are called by several threads at the same time and must only
+ *	write memory of their items. Several threads can use the same pool, but
+ *	their batches are evaluated one after another. Kernels may call the same
+ *	pool again (e.g., by batch_evaluate). Nested batches are then evaluated
+ *	by the thread of the kernel instead of waiting for the pool, which would
+ *	never become free.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void batchPool_run(BatchPool *batchPool, int no_items, int grain_size,
+	void (*kernel)(int, int, void*), void *context) {
+	// Evaluate small batches and nested batches of kernels of the same pool
+	// by calling thread
+	//
+	if (no_items <= 0) {
+		return;
+	}
+
+	int no_threads = (batchPool == NULL) ? 1 : batchPool->no_threads;
+	grain_size = batchPool_grain_size(no_items, grain_size, no_threads);
+	long long no_chunks = ((long long) no_items + grain_size - 1) /
+		grain_size;
+
+	if (no_threads == 1 || no_chunks == 1 || batchPool == batchPool_current) {
+		kernel(0, no_items, context);
+		return;
+	}
+
+	// Set batch and distribute chunks equally among threads
+	//
+	MUTEX_LOCK(&batchPool->mutex_run);
+
+	BatchPool *batchPool_previous = batchPool_current;
+	batchPool_current = batchPool;
+
+	batchPool->kernel = kernel;
+	batchPool->context = context;
+	batchPool->no_items = no_items;
+	batchPool->grain_size = grain_size;
+
+	for (int i = 0; i < no_threads; i++) {
+		batchPool->ranges[i].begin = (int) (no_chunks * i / no_threads);
+		batchPool->ranges[i].end = (int) (no_chunks * (i + 1) / no_threads);
+	}
+
+	// Start worker threads, evaluate chunks by calling thread, and wait for
+	// worker threads
+	//
+	MUTEX_LOCK(&batchPool->mutex);
+	batchPool->no_running = no_threads - 1;
+	batchPool->generation++;
+	CONDITION_BROADCAST(&batchPool->condition_start);
+	MUTEX_UNLOCK(&batchPool->mutex);
+
+	batchPool_work(batchPool, 0);
+
+	MUTEX_LOCK(&batchPool->mutex);
+	while (batchPool->no_running > 0) {
+		CONDITION_WAIT(&batchPool->condition_finished, &batchPool->mutex);
+	}
+	MUTEX_UNLOCK(&batchPool->mutex);
+
+	batchPool_current = batchPool_previous;
+	MUTEX_UNLOCK(&batchPool->mutex_run);
+}
@@ -0,0 +1,971 @@
+/////////////////////
+// bench_kernels.c //
+/////////////////////
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "benchmark.h"
+#include "database.h"
+#include "json_interface.h"
+#include "refrigerantHandle.h"
+#include "status.h"
+#include "workingPair.h"
+#include "workingPairBatch.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//sorpproplib.json"
+#else
+	#define PATH ".\\data\\sorpproplib.json"
+#endif
+
+#ifndef NO_POINTS
+#define NO_POINTS 64
+#endif
+
+#ifndef NO_REPETITIONS
+#define NO_REPETITIONS 5
+#endif
+
+#ifndef MIN_TIME_S
+#define MIN_TIME_S 2e-3
+#endif
+
+#ifndef BENCH_TOLERANCE
+#define BENCH_TOLERANCE 0.2
+#endif
+
+#define BENCH_STRIDE 37
+#define BENCH_STATES "pTwovM"
+#define BENCH_NO_STATES 6
+
+
+/////////////////////////////
+// Definition of variables //
+/////////////////////////////
+/*
+ * Functions benchmarked for each isotherm equation and inputs of functions
+ * given by characters of BENCH_STATES: Pressure 'p', temperature 'T', loading
+ * (i.e., concentration or mole fraction) 'w', one 'o', molar volume of database
+ * 'v', and molar mass 'M'. The first function of each family calculates the
+ * loadings of the states.
+ *
+ */
+static const char *bench_functions[][2] = {
+	{"ads_w_pT", "pT"},
+	{"ads_p_wT", "wT"},
+	{"ads_T_pw", "pw"},
+	{"ads_dw_dp_pT", "pT"},
+	{"ads_dw_dT_pT", "pT"},
+	{"ads_dp_dw_wT", "wT"},
+	{"ads_dp_dT_wT", "wT"},
+	{"ads_piStar_pyxgTM", "poooTM"},
+	{"abs_con_X_pT", "pT"},
+	{"abs_con_p_XT", "wT"},
+	{"abs_con_T_pX", "pw"},
+	{"abs_con_dX_dp_pT", "pT"},
+	{"abs_con_dX_dT_pT", "pT"},
+	{"abs_con_dp_dX_XT", "wT"},
+	{"abs_con_dp_dT_XT", "wT"},
+	{"abs_act_x_pTv1v2", "pTvv"},
+	{"abs_act_p_Txv1v2", "Twvv"},
+	{"abs_act_g_Txv1v2", "Twvv"},
+	{"abs_mix_x_pT", "pT"},
+	{"abs_mix_p_Tx", "Tw"},
+	{"abs_mix_T_px", "pw"},
+	{"abs_mix_dp_dx_Tx", "Tw"},
+	{"abs_mix_dp_dT_Tx", "Tw"}
+};
+
+
+/*
+ * Functions of RefrigerantHandle-structs benchmarked for each vapor pressure
+ * equation (i.e., first three functions) or each saturated liquid density
+ * equation (i.e., last two functions). Inputs are given as for
+ * bench_functions.
+ *
+ */
+static const BatchFunction bench_refrigerant_functions[] = {
+	{"refh_p_sat_T", (genFunc) &refh_p_sat_T, 1, 0},
+	{"refh_dp_sat_dT_T", (genFunc) &refh_dp_sat_dT_T, 1, 0},
+	{"refh_T_sat_p", (genFunc) &refh_T_sat_p, 1, 0},
+	{"refh_rho_l_T", (genFunc) &refh_rho_l_T, 1, 0},
+	{"refh_drho_l_dT_T", (genFunc) &refh_drho_l_dT_T, 1, 0}
+};
+
+static const char *bench_refrigerant_inputs[] = {"T", "T", "p", "T", "T"};
+
+
+/*
+ * Calculation approaches of vapor pressure tried in this order when working
+ * pairs are created.
+ *
+ */
+static const char *bench_approaches[] = {"VaporPressure_EoS1",
+	"VaporPressure_Antoine", "VaporPressure_EoSCubic", "VaporPressure_EoS2",
+	"VaporPressure_EoS3"};
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * bench_limits:
+ * -------------
+ *
+ * Reads range of validity (i.e., entry "_va_") of an equation of the database.
+ * Limits that do not exist are set to -1.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_limits:
+ *		Array to be filled with minimal and maximal pressure, temperature, and
+ *		loading.
+ *	cJSON *json_equation:
+ *		Tree of JSON-structs representing one ID of an equation.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void bench_limits(double *ret_limits, cJSON *json_equation) {
+	const char *names[] = {"pressure-min", "pressure-max", "temperature-min",
+		"temperature-max", "loading-min", "loading-max"};
+	cJSON *json_validity = cJSON_GetObjectItemCaseSensitive(json_equation,
+		"_va_");
+
+	for (int i = 0; i < 6; i++) {
+		cJSON *json_limit = cJSON_GetObjectItemCaseSensitive(json_validity,
+			names[i]);
+		ret_limits[i] = cJSON_IsNumber(json_limit) ?
+			json_limit->valuedouble : -1;
+	}
+}
+
+
+/*
+ * bench_inputs:
+ * -------------
+ *
+ * Sets pointers of inputs of a function to rows of array of states.
+ *
+ * Parameters:
+ * -----------
+ *	const double **ret_inputs:
+ *		Array to be filled with pointers of inputs.
+ *	const char *inputs:
+ *		Characters of BENCH_STATES describing inputs of function.
+ *	double states[][NO_POINTS]:
+ *		Array containing states.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void bench_inputs(const double **ret_inputs, const char *inputs,
+	double states[][NO_POINTS]) {
+	for (int i = 0; inputs[i] != '\0'; i++) {
+		ret_inputs[i] = states[strchr(BENCH_STATES, inputs[i]) -
+			BENCH_STATES];
+	}
+}
+
+
+/*
+ * bench_states:
+ * -------------
+ *
+ * Creates states within the range of validity of an equation. Temperatures are
+ * distributed uniformly and pressures logarithmically, while pressures and
+ * temperatures are permuted against each other. Pressures are derived from
+ * the vapor pressure if the range of validity contains no pressures, and
+ * loadings are calculated by a function if it is given.
+ *
+ * Parameters:
+ * -----------
+ *	double states[][NO_POINTS]:
+ *		Array to be filled with states in order of BENCH_STATES.
+ *	const double *limits:
+ *		Array containing minimal and maximal pressure, temperature, and
+ *		loading (i.e., -1 if not given).
+ *	int saturated:
+ *		Flag indicating whether pressure is vapor pressure.
+ *	const struct *BatchFunction:
+ *		Function calculating loadings (i.e., may be NULL).
+ *	const char *inputs:
+ *		Inputs of function calculating loadings.
+ *	void *object:
+ *		Pointer of WorkingPair-struct or RefrigerantHandle-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void bench_states(double states[][NO_POINTS], const double *limits,
+	int saturated, const BatchFunction *function, const char *inputs,
+	void *object) {
+	// Select range of temperatures
+	//
+	double T_min_K = limits[2];
+	double T_max_K = limits[3];
+
+	if (!(T_max_K > 0)) {
+		T_min_K = 273.15;
+		T_max_K = 373.15;
+
+	} else if (!(T_min_K > 0 && T_min_K < T_max_K)) {
+		T_min_K = T_max_K - 50;
+
+	}
+
+	// Calculate states: Vapor pressure is evaluated by working pair or by
+	// refrigerant handle
+	//
+	genFunc_1_0_1 p_sat_T = (function == NULL) ? &refh_p_sat_T : &ref_p_sat_T;
+	int pressures = (limits[0] > 0 && limits[0] < limits[1]);
+	int loadings = (limits[4] >= 0 && limits[4] < limits[5]);
+
+	for (int i = 0; i < NO_POINTS; i++) {
+		double f_T = (i + 0.5) / NO_POINTS;
+		double f_p = ((i * BENCH_STRIDE) % NO_POINTS + 0.5) / NO_POINTS;
+		double T_K = T_min_K + (T_max_K - T_min_K) * f_T;
+		double p_Pa;
+
+		if (pressures) {
+			p_Pa = limits[0] * pow(limits[1] / limits[0], f_p);
+
+		} else {
+			p_Pa = p_sat_T(T_K, object) * (saturated ? 1 : 0.1 + 0.8 * f_p);
+
+		}
+		if (!isfinite(p_Pa) || p_Pa <= 0) {
+			p_Pa = 1e3 * pow(1e3, f_p);
+		}
+
+		states[0][i] = p_Pa;
+		states[1][i] = T_K;
+		states[2][i] = loadings ? limits[4] + (limits[5] - limits[4]) * f_p :
+			0.05 + 0.9 * f_p;
+		states[3][i] = 1;
+		states[4][i] = -1;
+		states[5][i] = 0.018;
+	}
+
+	// Calculate loadings of states if possible
+	//
+	if (function != NULL) {
+		const double *in[BENCH_NO_STATES];
+		double w[NO_POINTS];
+
+		bench_inputs(in, inputs, states);
+		BatchEvaluation evaluation = {function, w, NULL, NULL, NULL, in,
+			object};
+		batch_kernel_values(0, NO_POINTS, &evaluation);
+
+		for (int i = 0; i < NO_POINTS; i++) {
+			if (isfinite(w[i]) && w[i] > 0) {
+				states[2][i] = w[i];
+			}
+		}
+	}
+}
+
+
+/*
+ * bench_function:
+ * ---------------
+ *
+ * Measures time per call of a function for all states and adds result to
+ * results of its kernel (i.e., isotherm or refrigerant equation). The best
+ * time of NO_REPETITIONS repetitions is used, and each repetition evaluates
+ * the states at least for MIN_TIME_S. Functions whose first call is slower
+ * than MIN_TIME_S are measured by this call only.
+ *
+ * Parameters:
+ * -----------
+ *	cJSON *json_kernels:
+ *		Tree of JSON-structs containing results of kernels.
+ *	const char *kernel:
+ *		Name of kernel.
+ *	const struct *BatchFunction:
+ *		Function that is benchmarked.
+ *	const char *inputs:
+ *		Characters of BENCH_STATES describing inputs of function.
+ *	double states[][NO_POINTS]:
+ *		Array containing states.
+ *	void *object:
+ *		Pointer of WorkingPair-struct or RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 on success and -1 if memory allocation fails.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int bench_function(cJSON *json_kernels, const char *kernel,
+	const BatchFunction *function, const char *inputs,
+	double states[][NO_POINTS], void *object) {
+	// Warm up by first state: Functions slower than MIN_TIME_S are only
+	// measured by this call
+	//
+	const double *in[BENCH_NO_STATES];
+	double values[NO_POINTS];
+	double y_1_molmol[NO_POINTS];
+	double y_2_molmol[NO_POINTS];
+
+	bench_inputs(in, inputs, states);
+	BatchEvaluation evaluation = {function, values, y_1_molmol, y_2_molmol,
+		NULL, in, object};
+
+	double time_start = benchmark_time_s();
+	batch_kernel_values(0, 1, &evaluation);
+
+	double ns_per_call = 1e9 * (benchmark_time_s() - time_start);
+	int no_points = 1;
+
+	if (ns_per_call < 1e9 * MIN_TIME_S) {
+		no_points = NO_POINTS;
+		ns_per_call = INFINITY;
+
+		for (int i_rep = 0; i_rep < NO_REPETITIONS; i_rep++) {
+			double no_calls = 0;
+			double time_elapsed;
+
+			time_start = benchmark_time_s();
+			do {
+				batch_kernel_values(0, NO_POINTS, &evaluation);
+				no_calls += NO_POINTS;
+				time_elapsed = benchmark_time_s() - time_start;
+			} while (time_elapsed < MIN_TIME_S);
+
+			if (1e9 * time_elapsed / no_calls < ns_per_call) {
+				ns_per_call = 1e9 * time_elapsed / no_calls;
+			}
+		}
+	}
+
+	int no_invalid = 0;
+	for (int i = 0; i < no_points; i++) {
+		no_invalid += !isfinite(values[i]);
+	}
+
+	// Add results to kernel: Sum of times is averaged when all kernels are
+	// benchmarked
+	//
+	cJSON *json_kernel = cJSON_GetObjectItemCaseSensitive(json_kernels,
+		kernel);
+
+	if (json_kernel == NULL) {
+		json_kernel = cJSON_AddObjectToObject(json_kernels, kernel);
+	}
+
+	cJSON *json_function = cJSON_GetObjectItemCaseSensitive(json_kernel,
+		function->name);
+
+	if (json_function == NULL) {
+		json_function = cJSON_AddObjectToObject(json_kernel, function->name);
+
+		if (json_function == NULL ||
+			cJSON_AddNumberToObject(json_function, "no_entries", 0) == NULL ||
+			cJSON_AddNumberToObject(json_function, "no_invalid", 0) == NULL ||
+			cJSON_AddNumberToObject(json_function, "ns_per_call", 0) == NULL ||
+			cJSON_AddNumberToObject(json_function, "ns_per_call_min",
+				ns_per_call) == NULL ||
+			cJSON_AddNumberToObject(json_function, "ns_per_call_max",
+				ns_per_call) == NULL) {
+			return -1;
+		}
+	}
+
+	cJSON *json_no_entries = cJSON_GetObjectItem(json_function, "no_entries");
+	cJSON *json_no_invalid = cJSON_GetObjectItem(json_function, "no_invalid");
+	cJSON *json_ns = cJSON_GetObjectItem(json_function, "ns_per_call");
+	cJSON *json_ns_min = cJSON_GetObjectItem(json_function, "ns_per_call_min");
+	cJSON *json_ns_max = cJSON_GetObjectItem(json_function, "ns_per_call_max");
+
+	cJSON_SetNumberValue(json_no_entries, json_no_entries->valuedouble + 1);
+	cJSON_SetNumberValue(json_no_invalid, json_no_invalid->valuedouble +
+		no_invalid);
+	cJSON_SetNumberValue(json_ns, json_ns->valuedouble + ns_per_call);
+	cJSON_SetNumberValue(json_ns_min, fmin(json_ns_min->valuedouble,
+		ns_per_call));
+	cJSON_SetNumberValue(json_ns_max, fmax(json_ns_max->valuedouble,
+		ns_per_call));
+
+	return 0;
+}
+
+
+/*
+ * bench_workingPair:
+ * ------------------
+ *
+ * Benchmarks all functions of one ID of an isotherm equation. Working pair is
+ * created with the first calculation approach of vapor pressure of
+ * bench_approaches that exists for the refrigerant.
+ *
+ * Parameters:
+ * -----------
+ *	cJSON *json_kernels:
+ *		Tree of JSON-structs containing results of kernels.
+ *	struct *Database:
+ *		Pointer of Database-struct.
+ *	cJSON *json_info:
+ *		Tree of JSON-structs containing names of working pair.
+ *	cJSON *json_equation:
+ *		Tree of JSON-structs representing one ID of isotherm equation.
+ *	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 on success and -1 if working pair cannot be created or
+ *		memory allocation fails.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int bench_workingPair(cJSON *json_kernels, Database *database,
+	cJSON *json_info, cJSON *json_equation, const char *wp_iso, int no_iso) {
+	// Create working pair
+	//
+	const char *wp_as = cJSON_GetStringValue(
+		cJSON_GetObjectItemCaseSensitive(json_info, "_as_"));
+	const char *wp_st = cJSON_GetStringValue(
+		cJSON_GetObjectItemCaseSensitive(json_info, "_st_"));
+	const char *wp_rf = cJSON_GetStringValue(
+		cJSON_GetObjectItemCaseSensitive(json_info, "_rf_"));
+	int no_approaches = sizeof(bench_approaches) / sizeof(bench_approaches[0]);
+	WorkingPair *workingPair = NULL;
+
+	for (int i = 0; i < no_approaches && workingPair == NULL; i++) {
+		workingPair = newWorkingPairDatabase(database, wp_as, wp_st, wp_rf,
+			wp_iso, no_iso, bench_approaches[i], 1,
+			"SaturatedLiquidDensity_EoS1", 1);
+	}
+
+	if (workingPair == NULL) {
+		return -1;
+	}
+
+	// Select family of functions of isotherm
+	//
+	const char *prefix;
+
+	if (workingPair->adsorption != NULL) {
+		prefix = "ads_";
+
+	} else if (workingPair->absorption->con_X_pT != NULL) {
+		prefix = "abs_con_";
+
+	} else if (workingPair->absorption->act_g_Txv1v2 != NULL) {
+		prefix = "abs_act_";
+
+	} else {
+		prefix = "abs_mix_";
+
+	}
+
+	// Benchmark functions of family: First function calculates loadings
+	//
+	int no_functions = sizeof(bench_functions) / sizeof(bench_functions[0]);
+	int first = 1;
+	int error = 0;
+	double limits[6];
+	double states[BENCH_NO_STATES][NO_POINTS];
+
+	bench_limits(limits, json_equation);
+
+	for (int i = 0; i < no_functions && !error; i++) {
+		if (strncmp(bench_functions[i][0], prefix, strlen(prefix)) != 0) {
+			continue;
+		}
+
+		const BatchFunction *function = batch_function(bench_functions[i][0]);
+
+		if (first) {
+			bench_states(states, limits, 0, function, bench_functions[i][1],
+				workingPair);
+			first = 0;
+		}
+
+		error = bench_function(json_kernels, wp_iso, function,
+			bench_functions[i][1], states, workingPair);
+	}
+
+	delWorkingPair(workingPair);
+	return -error;
+}
+
+
+/*
+ * bench_refrigerant:
+ * ------------------
+ *
+ * Benchmarks functions of one ID of a vapor pressure equation or saturated
+ * liquid density equation of a refrigerant.
+ *
+ * Parameters:
+ * -----------
+ *	cJSON *json_kernels:
+ *		Tree of JSON-structs containing results of kernels.
+ *	struct *Database:
+ *		Pointer of Database-struct.
+ *	const char *wp_rf:
+ *		Name of refrigerant.
+ *	cJSON *json_equation:
+ *		Tree of JSON-structs representing one ID of refrigerant equation.
+ *	const char *approach:
+ *		Name of calculation approach.
+ *	int no_approach:
+ *		ID of calculation approach.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 on success, 1 if approach is no refrigerant equation, and -1
+ *		if refrigerant cannot be created or memory allocation fails.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int bench_refrigerant(cJSON *json_kernels, Database *database,
+	const char *wp_rf, cJSON *json_equation, const char *approach,
+	int no_approach) {
+	// Create refrigerant: Vapor pressure is also required for saturated liquid
+	// density to calculate states
+	//
+	int vapor_pressure = (strncmp(approach, "VaporPressure_", 14) == 0);
+
+	if (!vapor_pressure &&
+		strncmp(approach, "SaturatedLiquidDensity_", 23) != 0) {
+		return 1;
+	}
+
+	RefrigerantHandle *refrigerant = NULL;
+	int no_approaches = sizeof(bench_approaches) / sizeof(bench_approaches[0]);
+
+	for (int i = 0; i < (vapor_pressure ? 1 : no_approaches) &&
+		refrigerant == NULL; i++) {
+		refrigerant = vapor_pressure ?
+			newRefrigerantHandle(database, wp_rf, approach, no_approach,
+				"SaturatedLiquidDensity_EoS1", 1) :
+			newRefrigerantHandle(database, wp_rf, bench_approaches[i], 1,
+				approach, no_approach);
+
+		if (refrigerant != NULL && (vapor_pressure ?
+			refrigerant->psat_par == NULL : refrigerant->rhol_par == NULL)) {
+			delRefrigerantHandle(refrigerant);
+			refrigerant = NULL;
+		}
+	}
+
+	if (refrigerant == NULL) {
+		return -1;
+	}
+
+	// Benchmark functions of equation
+	//
+	double limits[6];
+	double states[BENCH_NO_STATES][NO_POINTS];
+	int error = 0;
+
+	bench_limits(limits, json_equation);
+	bench_states(states, limits, 1, NULL, NULL, refrigerant);
+
+	for (int i = vapor_pressure ? 0 : 3; i < (vapor_pressure ? 3 : 5) &&
+		!error; i++) {
+		error = bench_function(json_kernels, approach,
+			&bench_refrigerant_functions[i], bench_refrigerant_inputs[i],
+			states, refrigerant);
+	}
+
+	delRefrigerantHandle(refrigerant);
+	return -error;
+}
+
+
+/*
+ * bench_finalize:
+ * ---------------
+ *
+ * Averages times per call of all kernels and adds calls per second.
+ *
+ * Parameters:
+ * -----------
+ *	cJSON *json_kernels:
+ *		Tree of JSON-structs containing results of kernels.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 on success and -1 if memory allocation fails.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int bench_finalize(cJSON *json_kernels) {
+	cJSON *json_kernel = NULL;
+	cJSON *json_function = NULL;
+
+	cJSON_ArrayForEach(json_kernel, json_kernels) {
+		cJSON_ArrayForEach(json_function, json_kernel) {
+			cJSON *json_ns = cJSON_GetObjectItem(json_function,
+				"ns_per_call");
+			double ns_per_call = json_ns->valuedouble / cJSON_GetObjectItem(
+				json_function, "no_entries")->valuedouble;
+
+			cJSON_SetNumberValue(json_ns, ns_per_call);
+			if (cJSON_AddNumberToObject(json_function, "calls_per_s",
+				1e9 / ns_per_call) == NULL) {
+				return -1;
+			}
+		}
+	}
+	return 0;
+}
+
+
+/*
+ * bench_save:
+ * -----------
+ *
+ * Writes results of benchmark to JSON file.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path:
+ *		Path of JSON file.
+ *	cJSON *json:
+ *		Tree of JSON-structs containing results.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 on success and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int bench_save(const char *path, cJSON *json) {
+	char *content = cJSON_Print(json);
+	FILE *fp = NULL;
+
+	if (content != NULL) {
+		#ifdef __unix
+		fp = fopen(path, "wb");
+		#else
+		if (fopen_s(&fp, path, "wb") != 0) {
+			fp = NULL;
+		}
+		#endif
+	}
+
+	int error = (fp == NULL || fputs(content, fp) == EOF);
+
+	if (fp != NULL) {
+		error = (fclose(fp) != 0) || error;
+	}
+
+	free(content);
+	return -error;
+}
+
+
+/*
+ * bench_compare:
+ * --------------
+ *
+ * Compares times per call of all kernels with a baseline saved by a previous
+ * run and prints kernels that are slower or faster by more than a relative
+ * tolerance.
+ *
+ * Parameters:
+ * -----------
+ *	cJSON *json_kernels:
+ *		Tree of JSON-structs containing results of kernels.
+ *	const char *path_baseline:
+ *		Path of JSON file containing results of baseline.
+ *	double tolerance:
+ *		Relative tolerance of time per call.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns number of slower kernels or -1 if baseline cannot be read.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int bench_compare(cJSON *json_kernels, const char *path_baseline,
+	double tolerance) {
+	// Read baseline
+	//
+	char *content = json_read_file(path_baseline);
+	cJSON *json_baseline = (content == NULL) ? NULL :
+		json_parse_file(content);
+	cJSON *json_baseline_kernels = cJSON_GetObjectItemCaseSensitive(
+		json_baseline, "kernels");
+
+	free(content);
+
+	if (!cJSON_IsObject(json_baseline_kernels)) {
+		printf("\n\nCannot read baseline \"%s\"!", path_baseline);
+		cJSON_Delete(json_baseline);
+		return -1;
+	}
+
+	// Compare kernels
+	//
+	int no_compared = 0;
+	int no_new = 0;
+	int no_slower = 0;
+	int no_faster = 0;
+	cJSON *json_kernel = NULL;
+	cJSON *json_function = NULL;
+
+	printf("\n\nComparison with baseline \"%s\" (tolerance: %.1f %%):",
+		path_baseline, 100 * tolerance);
+
+	cJSON_ArrayForEach(json_kernel, json_kernels) {
+		cJSON_ArrayForEach(json_function, json_kernel) {
+			cJSON *json_ns_baseline = cJSON_GetObjectItemCaseSensitive(
+				cJSON_GetObjectItemCaseSensitive(
+				cJSON_GetObjectItemCaseSensitive(json_baseline_kernels,
+				json_kernel->string), json_function->string), "ns_per_call");
+
+			if (!cJSON_IsNumber(json_ns_baseline)) {
+				no_new++;
+				continue;
+			}
+
+			double ns = cJSON_GetObjectItem(json_function,
+				"ns_per_call")->valuedouble;
+			double ratio = ns / json_ns_baseline->valuedouble;
+
+			no_compared++;
+			if (ratio > 1 + tolerance || ratio < 1 / (1 + tolerance)) {
+				printf("\n%-8s %-28s %-22s %10.1f ns -> %10.1f ns (%+.1f %%)",
+					(ratio > 1) ? "SLOWER" : "faster", json_kernel->string,
+					json_function->string, json_ns_baseline->valuedouble, ns,
+					100 * (ratio - 1));
+
+				no_slower += (ratio > 1);
+				no_faster += (ratio < 1);
+			}
+		}
+	}
+
+	printf("\n\nCompared functions: %i, new functions: %i", no_compared,
+		no_new);
+	printf("\nSlower functions: %i, faster functions: %i\n", no_slower,
+		no_faster);
+
+	cJSON_Delete(json_baseline);
+	return no_slower;
+}
+
+
+/*
+ * main:
+ * -----
+ *
+ * Benchmarks all functions of all isotherm equations and refrigerant equations
+ * of a database, i.e. all kernels of adsorption_*.c, absorption_*.c, and
+ * refrigerant_*.c. Each ID of an equation is evaluated at NO_POINTS states
+ * within its range of validity. Results are averaged per kernel and function
+ * and saved as JSON file. If a baseline is given, results are compared with
+ * the baseline and program fails if a function is slower than the tolerance.
+ *
+ * Usage:
+ * ------
+ *	bench_kernels.exe [path_db] [path_json] [path_baseline] [tolerance]
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main(int argc, char *argv[]) {
+	// Get command line arguments
+	//
+	if (argc > 5) {
+		printf("\n\nUsage: %s [path_db] [path_json] [path_baseline] "
+			"[tolerance]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	const char *path_db = (argc > 1) ? argv[1] : PATH;
+	const char *path_json = (argc > 2) ? argv[2] : "bench_kernels.json";
+	const char *path_baseline = (argc > 3) ? argv[3] : NULL;
+	double tolerance = (argc > 4) ? atof(argv[4]) : BENCH_TOLERANCE;
+
+	if (!(tolerance > 0)) {
+		printf("\n\nTolerance must be positive!");
+		return EXIT_FAILURE;
+	}
+
+	// Read database: Warnings of states outside of ranges of validity are not
+	// printed
+	//
+	Database *database = newDatabase(path_db);
+
+	if (database == NULL) {
+		return EXIT_FAILURE;
+	}
+	setStatusQuiet(1);
+
+	cJSON *json = cJSON_CreateObject();
+	cJSON *json_kernels = NULL;
+
+	if (json == NULL ||
+		cJSON_AddStringToObject(json, "benchmark", "kernels") == NULL ||
+		cJSON_AddStringToObject(json, "database", path_db) == NULL ||
+		cJSON_AddNumberToObject(json, "no_points", NO_POINTS) == NULL ||
+		cJSON_AddNumberToObject(json, "no_repetitions",
+			NO_REPETITIONS) == NULL ||
+		(json_kernels = cJSON_AddObjectToObject(json, "kernels")) == NULL) {
+		printf("\n\nCannot allocate memory for benchmark!");
+		return EXIT_FAILURE;
+	}
+
+	// Benchmark each ID of each equation of each entry of database
+	//
+	int no_entries = 0;
+	int no_skipped = 0;
+	double time_start = benchmark_time_s();
+	cJSON *json_entry = NULL;
+
+	cJSON_ArrayForEach(json_entry, database->json_file) {
+		cJSON *json_info = cJSON_GetObjectItemCaseSensitive(json_entry, "k");
+		const char *wp_tp = cJSON_GetStringValue(
+			cJSON_GetObjectItemCaseSensitive(json_info, "_tp_"));
+		cJSON *json_equations = cJSON_GetObjectItemCaseSensitive(
+			cJSON_GetObjectItemCaseSensitive(json_entry, "v"), "_ep_");
+		cJSON *json_equation = NULL;
+
+		if (wp_tp == NULL) {
+			continue;
+		}
+
+		cJSON_ArrayForEach(json_equation, json_equations) {
+			cJSON *json_id = NULL;
+			int no_id = 0;
+
+			cJSON_ArrayForEach(json_id, json_equation) {
+				int result;
+
+				if (strcmp(wp_tp, "refrig") == 0) {
+					result = bench_refrigerant(json_kernels, database,
+						cJSON_GetStringValue(cJSON_GetObjectItemCaseSensitive(
+						json_info, "_rf_")), json_id, json_equation->string,
+						++no_id);
+
+				} else {
+					result = bench_workingPair(json_kernels, database,
+						json_info, json_id, json_equation->string, ++no_id);
+
+				}
+
+				no_entries += (result == 0);
+				no_skipped += (result == -1);
+			}
+		}
+	}
+
+	double time_total = benchmark_time_s() - time_start;
+
+	if (bench_finalize(json_kernels) == -1 ||
+		cJSON_AddNumberToObject(json, "no_entries", no_entries) == NULL ||
+		cJSON_AddNumberToObject(json, "no_skipped", no_skipped) == NULL) {
+		printf("\n\nCannot allocate memory for benchmark!");
+		return EXIT_FAILURE;
+	}
+
+	// Print results
+	//
+	cJSON *json_kernel = NULL;
+	cJSON *json_function = NULL;
+
+	printf("\n\n##\n##\nBenchmark: Kernels of isotherms and refrigerants.");
+	printf("\nDatabase: %s", path_db);
+	printf("\nBenchmarked equations: %i, skipped equations: %i", no_entries,
+		no_skipped);
+	printf("\nStates per equation: %i, duration: %.1f s", NO_POINTS,
+		time_total);
+	printf("\n\n%-28s %-22s %7s %11s %11s %9s", "Kernel", "Function",
+		"Entries", "ns/call", "Mcalls/s", "Invalid");
+
+	cJSON_ArrayForEach(json_kernel, json_kernels) {
+		cJSON_ArrayForEach(json_function, json_kernel) {
+			printf("\n%-28s %-22s %7.0f %11.1f %11.3f %9.0f",
+				json_kernel->string, json_function->string,
+				cJSON_GetObjectItem(json_function, "no_entries")->valuedouble,
+				cJSON_GetObjectItem(json_function, "ns_per_call")->valuedouble,
+				1e-6 * cJSON_GetObjectItem(json_function,
+				"calls_per_s")->valuedouble,
+				cJSON_GetObjectItem(json_function, "no_invalid")->valuedouble);
+		}
+	}
+
+	// Save results and compare with baseline
+	//
+	int result = EXIT_SUCCESS;
+
+	if (bench_save(path_json, json) == -1) {
+		printf("\n\nCannot write results to \"%s\"!", path_json);
+		result = EXIT_FAILURE;
+
+	} else {
+		printf("\n\nResults written to \"%s\".", path_json);
+
+	}
+
+	if (path_baseline != NULL &&
+		bench_compare(json_kernels, path_baseline, tolerance) != 0) {
+		result = EXIT_FAILURE;
+	}
+	printf("\n");
+
+	// Free memory
+	//
+	cJSON_Delete(json);
+	delDatabase(database);
+
+	return result;
+}
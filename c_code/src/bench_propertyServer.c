@@ -0,0 +1,217 @@
+////////////////////////////
+// bench_propertyServer.c //
+////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef __unix
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+#include "benchmark.h"
+#include "propertyServer.h"
+#include "status.h"
+#include "workingPair.h"
+#include "workingPairBatch.h"
+
+#define PROPERTY_CLIENT_PREFIX
+#include "propertyClient.h"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//SorpPropLib_MinimalExample.json"
+#else
+	#define PATH ".\\data\\SorpPropLib_MinimalExample.json"
+#endif
+
+#ifndef NO_CALLS
+#define NO_CALLS 20000
+#endif
+
+#ifndef NO_POINTS
+#define NO_POINTS 100000
+#endif
+
+#ifndef NO_BATCHES
+#define NO_BATCHES 20
+#endif
+
+#ifndef NO_THREADS
+#define NO_THREADS 0
+#endif
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * main:
+ * -----
+ *
+ * Starts property server as child process and compares latency of single
+ * calls and throughput of batches of client with calls of library within the
+ * same process. Checks that client and library return identical results and
+ * stops server afterwards.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main() {
+#ifdef __unix
+	// Start server as child process at private socket
+	//
+	char path_socket[64];
+	snprintf(path_socket, sizeof(path_socket), "/tmp/sorpPropLib_bench_%i.sock",
+		(int) getpid());
+	setenv("SORP_SERVER_SOCKET", path_socket, 1);
+	fflush(stdout);
+
+	pid_t pid = fork();
+	if (pid == 0) {
+		PropertyServer *propertyServer = newPropertyServer(path_socket,
+			NO_THREADS);
+		int result = (propertyServer == NULL) ? -1 :
+			propertyServer_run(propertyServer);
+
+		delPropertyServer(propertyServer);
+		_exit((result == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+
+	} else if (pid < 0) {
+		printf("\n\nCannot start property server!");
+		return EXIT_FAILURE;
+	}
+
+	// Create working pairs: Client waits until server accepts connections
+	//
+	WorkingPair *workingPair = newWorkingPair(PATH, "zeolite", "5a", "water",
+		"Toth", 1, "VaporPressure_EoS1", 1, "SaturatedLiquidDensity_EoS1", 1);
+	ServerWorkingPair *serverWorkingPair = NULL;
+
+	setStatusQuiet(1);
+	for (int i = 0; i < 500 && serverWorkingPair == NULL; i++) {
+		serverWorkingPair = client_newWorkingPair(PATH, "zeolite", "5a",
+			"water", "Toth", 1, "VaporPressure_EoS1", 1,
+			"SaturatedLiquidDensity_EoS1", 1);
+
+		if (serverWorkingPair == NULL) {
+			usleep(10000);
+		}
+	}
+	setStatusQuiet(0);
+
+	BatchPool *batchPool = newBatchPool(NO_THREADS);
+	double *p_Pa = (double *) malloc(NO_POINTS * sizeof(double));
+	double *T_K = (double *) malloc(NO_POINTS * sizeof(double));
+	double *values = (double *) malloc(NO_POINTS * sizeof(double));
+	double *reference = (double *) malloc(NO_POINTS * sizeof(double));
+
+	if (workingPair == NULL || serverWorkingPair == NULL ||
+		batchPool == NULL || p_Pa == NULL || T_K == NULL || values == NULL ||
+		reference == NULL) {
+		printf("\n\nCannot initialize benchmark!");
+		kill(pid, SIGTERM);
+		waitpid(pid, NULL, 0);
+		return EXIT_FAILURE;
+	}
+
+	for (int i = 0; i < NO_POINTS; i++) {
+		p_Pa[i] = 500 + 4500.0 * ((i * 7) % NO_POINTS) / NO_POINTS;
+		T_K[i] = 293.15 + 60.0 * i / NO_POINTS;
+	}
+	const double *inputs[] = {p_Pa, T_K};
+	int no_failures = 0;
+
+	// Single calls within process and by server
+	//
+	double sum_library = 0;
+	double time_start = benchmark_time_s();
+	for (int i = 0; i < NO_CALLS; i++) {
+		sum_library += ads_w_pT(p_Pa[i % NO_POINTS], T_K[i % NO_POINTS],
+			workingPair);
+	}
+	double time_library = benchmark_time_s() - time_start;
+
+	double sum_server = 0;
+	time_start = benchmark_time_s();
+	for (int i = 0; i < NO_CALLS; i++) {
+		sum_server += client_ads_w_pT(p_Pa[i % NO_POINTS],
+			T_K[i % NO_POINTS], serverWorkingPair);
+	}
+	double time_server = benchmark_time_s() - time_start;
+
+	no_failures += (sum_library != sum_server);
+
+	// Batches within process and by server
+	//
+	time_start = benchmark_time_s();
+	for (int i = 0; i < NO_BATCHES; i++) {
+		batch_evaluate(reference, NULL, NULL, NULL, "ads_w_pT", inputs,
+			NO_POINTS, 0, batchPool, workingPair);
+	}
+	double time_batch_library = benchmark_time_s() - time_start;
+
+	time_start = benchmark_time_s();
+	for (int i = 0; i < NO_BATCHES; i++) {
+		no_failures += client_batch_evaluate(values, NULL, NULL, NULL,
+			"ads_w_pT", inputs, NO_POINTS, 0, NULL, serverWorkingPair) != 0;
+	}
+	double time_batch_server = benchmark_time_s() - time_start;
+
+	no_failures += memcmp(values, reference, NO_POINTS * sizeof(double)) != 0;
+
+	// Check errors of client
+	//
+	setStatusQuiet(1);
+	no_failures += client_batch_evaluate(values, NULL, NULL, NULL,
+		"unknown_function", inputs, NO_POINTS, 0, NULL,
+		serverWorkingPair) != -1;
+	no_failures += client_ads_w_pT(p_Pa[0], T_K[0], NULL) != -1;
+	setStatusQuiet(0);
+
+	// Stop server
+	//
+	int status;
+	client_delWorkingPair(serverWorkingPair);
+	no_failures += client_shutdownServer() != 0;
+	no_failures += waitpid(pid, &status, 0) != pid || !WIFEXITED(status) ||
+		WEXITSTATUS(status) != EXIT_SUCCESS;
+
+	// Print results
+	//
+	printf("\n\n##\n##\nBenchmark: Property server vs. calls within process.");
+	printf("\nNumber of single calls: %i", NO_CALLS);
+	printf("\nNumber of states per batch: %i", NO_POINTS);
+	printf("\nNumber of batches: %i", NO_BATCHES);
+	printf("\n\nLatency per call (library): %.3f us",
+		1e6 * time_library / NO_CALLS);
+	printf("\nLatency per call (server): %.3f us",
+		1e6 * time_server / NO_CALLS);
+	printf("\nThroughput of batches (library): %.2f Mstates/s",
+		1e-6 * NO_BATCHES * NO_POINTS / time_batch_library);
+	printf("\nThroughput of batches (server): %.2f Mstates/s",
+		1e-6 * NO_BATCHES * NO_POINTS / time_batch_server);
+	printf("\n\nTotal number of failures: %i\n", no_failures);
+
+	// Free memory
+	//
+	delWorkingPair(workingPair);
+	delBatchPool(batchPool);
+
+	free(p_Pa);
+	free(T_K);
+	free(values);
+	free(reference);
+
+	return (no_failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+#else
+	printf("\n\nProperty server is only available on Unix systems.\n");
+	return EXIT_SUCCESS;
+#endif
+}
@@ -0,0 +1,136 @@
+///////////////////////////////
+// bench_refrigerantHandle.c //
+///////////////////////////////
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "benchmark.h"
+#include "database.h"
+#include "refrigerantHandle.h"
+#include "workingPair.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//SorpPropLib_MinimalExample.json"
+#else
+	#define PATH ".\\data\\SorpPropLib_MinimalExample.json"
+#endif
+
+#ifndef NO_POINTS
+#define NO_POINTS 1000000
+#endif
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * main:
+ * -----
+ *
+ * Compares time required to calculate vapor pressures of water using a
+ * WorkingPair-struct, a RefrigerantHandle-struct for single states, and a
+ * RefrigerantHandle-struct for arrays of states.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main() {
+	// Allocate memory
+	//
+	double *T_K = (double *) malloc(NO_POINTS * sizeof(double));
+	double *p_wp_Pa = (double *) malloc(NO_POINTS * sizeof(double));
+	double *p_single_Pa = (double *) malloc(NO_POINTS * sizeof(double));
+	double *p_batch_Pa = (double *) malloc(NO_POINTS * sizeof(double));
+
+	if (T_K == NULL || p_wp_Pa == NULL || p_single_Pa == NULL ||
+		p_batch_Pa == NULL) {
+		printf("\n\nCannot allocate memory for benchmark!");
+		return EXIT_FAILURE;
+	}
+
+	for (int i = 0; i < NO_POINTS; i++) {
+		T_K[i] = 273.15 + 100.0 * i / NO_POINTS;
+	}
+
+	// Create working pair and refrigerant handle
+	//
+	double time_start = benchmark_time_s();
+	WorkingPair *workingPair = newWorkingPair(PATH, "zeolite", "5a", "water",
+		"Toth", 1, "VaporPressure_EoS1", 1, "SaturatedLiquidDensity_EoS1", 1);
+	double time_new_wp = benchmark_time_s() - time_start;
+
+	time_start = benchmark_time_s();
+	Database *database = newDatabase(PATH);
+	double time_new_db = benchmark_time_s() - time_start;
+
+	time_start = benchmark_time_s();
+	RefrigerantHandle *refrigerantHandle = newRefrigerantHandle(database,
+		"water", "VaporPressure_EoS1", 1, "SaturatedLiquidDensity_EoS1", 1);
+	double time_new_rfh = benchmark_time_s() - time_start;
+
+	if (workingPair == NULL || refrigerantHandle == NULL) {
+		return EXIT_FAILURE;
+	}
+
+	// Calculate vapor pressures
+	//
+	time_start = benchmark_time_s();
+	for (int i = 0; i < NO_POINTS; i++) {
+		p_wp_Pa[i] = ref_p_sat_T(T_K[i], workingPair);
+	}
+	double time_wp = benchmark_time_s() - time_start;
+
+	time_start = benchmark_time_s();
+	for (int i = 0; i < NO_POINTS; i++) {
+		p_single_Pa[i] = refh_p_sat_T(T_K[i], refrigerantHandle);
+	}
+	double time_single = benchmark_time_s() - time_start;
+
+	time_start = benchmark_time_s();
+	refh_p_sat_T_batch(p_batch_Pa, T_K, NO_POINTS, refrigerantHandle);
+	double time_batch = benchmark_time_s() - time_start;
+
+	// Check results
+	//
+	double max_diff = 0;
+	for (int i = 0; i < NO_POINTS; i++) {
+		double diff = fabs(p_wp_Pa[i] - p_single_Pa[i]) +
+			fabs(p_wp_Pa[i] - p_batch_Pa[i]);
+		max_diff = (diff > max_diff) ? diff : max_diff;
+	}
+
+	// Print results
+	//
+	printf("\n\n##\n##\nBenchmark: Vapor pressure of water.");
+	printf("\nNumber of states: %i", NO_POINTS);
+	printf("\n\nnewWorkingPair: %.3f ms", 1e3 * time_new_wp);
+	printf("\nnewDatabase: %.3f ms", 1e3 * time_new_db);
+	printf("\nnewRefrigerantHandle: %.3f ms", 1e3 * time_new_rfh);
+	printf("\n\nref_p_sat_T: %.2f ns/call", 1e9 * time_wp / NO_POINTS);
+	printf("\nrefh_p_sat_T: %.2f ns/call", 1e9 * time_single / NO_POINTS);
+	printf("\nrefh_p_sat_T_batch: %.2f ns/state",
+		1e9 * time_batch / NO_POINTS);
+	printf("\n\nMaximal absolute difference of vapor pressures: %e\n",
+		max_diff);
+
+	// Free memory
+	//
+	delRefrigerantHandle(refrigerantHandle);
+	delDatabase(database);
+	delWorkingPair(workingPair);
+
+	free(T_K);
+	free(p_wp_Pa);
+	free(p_single_Pa);
+	free(p_batch_Pa);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,243 @@
+//////////////////////////////////
+// bench_refrigerantSurrogate.c //
+//////////////////////////////////
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "benchmark.h"
+#include "database.h"
+#include "refrigerantHandle.h"
+#include "surrogate.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//sorpproplib.json"
+#else
+	#define PATH ".\\data\\sorpproplib.json"
+#endif
+
+#ifndef NO_POINTS
+#define NO_POINTS 20000
+#endif
+
+#ifndef MAX_REL_ERROR
+#define MAX_REL_ERROR 1e-8
+#endif
+
+#ifndef NO_FUNCTIONS
+#define NO_FUNCTIONS 4
+#endif
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+typedef int (*batchFunc)(double*, const double*, int, void*);
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * bench_function:
+ * ---------------
+ *
+ * Evaluates a batch function with a RefrigerantHandle-struct using original
+ * equations and with a RefrigerantHandle-struct using surrogates. Calculates
+ * maximal relative error of the surrogate and time required per state of
+ * both evaluations.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_time_exact_ns:
+ *		Time required by original equation in ns/state.
+ *	double *ret_time_surrogate_ns:
+ *		Time required by surrogate in ns/state.
+ *	double *tmp_exact:
+ *		Array used to store values of original equation.
+ *	double *tmp_surrogate:
+ *		Array used to store values of surrogate.
+ *	const double *x:
+ *		Array containing inputs of batch function.
+ *	batchFunc function:
+ *		Batch function of RefrigerantHandle-struct.
+ * 	struct *RefrigerantHandle exact:
+ *		Pointer of RefrigerantHandle-struct using original equations.
+ * 	struct *RefrigerantHandle surrogate:
+ *		Pointer of RefrigerantHandle-struct using surrogates.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns maximal relative error of surrogate.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_function(double *ret_time_exact_ns, double *ret_time_surrogate_ns,
+	double *tmp_exact, double *tmp_surrogate, const double *x,
+	batchFunc function, RefrigerantHandle *exact,
+	RefrigerantHandle *surrogate) {
+	// Evaluate original equation and surrogate
+	//
+	double time_start = benchmark_time_s();
+	function(tmp_exact, x, NO_POINTS, exact);
+	*ret_time_exact_ns = 1e9 * (benchmark_time_s() - time_start) / NO_POINTS;
+
+	time_start = benchmark_time_s();
+	function(tmp_surrogate, x, NO_POINTS, surrogate);
+	*ret_time_surrogate_ns = 1e9 * (benchmark_time_s() - time_start) /
+		NO_POINTS;
+
+	// Calculate maximal relative error: States whose original equation fails
+	// (i.e., returns -1 or non-finite values) are skipped
+	//
+	double max_error = 0;
+
+	for (int i = 0; i < NO_POINTS; i++) {
+		if (surrogate_finite(tmp_exact[i]) && tmp_exact[i] > 0) {
+			double error = fabs((tmp_surrogate[i] - tmp_exact[i]) /
+				tmp_exact[i]);
+			max_error = (error > max_error || !surrogate_finite(error)) ?
+				error : max_error;
+		}
+	}
+
+	return max_error;
+}
+
+
+/*
+ * main:
+ * -----
+ *
+ * Compares accuracy and time required to calculate refrigerant properties by
+ * original equations and by surrogates for different approaches of vapor
+ * pressure. Surrogates are created for ranges of validity given by the
+ * database or for ranges given below if the original equation fails within
+ * the range of validity. Surrogates are evaluated at random temperatures within
+ * these ranges.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main() {
+	// Define refrigerants and approaches of vapor pressure
+	//
+	const char *rf[] = {"Water", "Water", "Benzene", "R-142b", "Water"};
+	const char *rf_psat[] = {"VaporPressure_EoS1", "VaporPressure_Antoine",
+		"VaporPressure_EoS2", "VaporPressure_EoS3", "VaporPressure_EoSCubic"};
+	const double T_min_rf_K[] = {-1, -1, -1, -1, 340};
+	const double T_max_rf_K[] = {-1, -1, -1, -1, 550};
+	const char *names[NO_FUNCTIONS] = {"p_sat", "dp_sat_dT", "rho_l",
+		"T_sat"};
+	batchFunc functions[NO_FUNCTIONS] = {&refh_p_sat_T_batch,
+		&refh_dp_sat_dT_T_batch, &refh_rho_l_T_batch, &refh_T_sat_p_batch};
+	int no_approaches = sizeof(rf) / sizeof(rf[0]);
+
+	// Allocate memory
+	//
+	double *T_K = (double *) malloc(NO_POINTS * sizeof(double));
+	double *p_Pa = (double *) malloc(NO_POINTS * sizeof(double));
+	double *tmp_exact = (double *) malloc(NO_POINTS * sizeof(double));
+	double *tmp_surrogate = (double *) malloc(NO_POINTS * sizeof(double));
+
+	if (T_K == NULL || p_Pa == NULL || tmp_exact == NULL ||
+		tmp_surrogate == NULL) {
+		printf("\n\nCannot allocate memory for benchmark!");
+		return EXIT_FAILURE;
+	}
+
+	Database *database = newDatabase(PATH);
+
+	if (database == NULL) {
+		return EXIT_FAILURE;
+	}
+
+	printf("\n\n##\n##\nBenchmark: Surrogates of refrigerant functions.");
+	printf("\nNumber of states: %i", NO_POINTS);
+	printf("\nMaximal relative error required: %e", MAX_REL_ERROR);
+
+	for (int i_a = 0; i_a < no_approaches; i_a++) {
+		// Create refrigerant handles: Both handles share refrigerant
+		//
+		RefrigerantHandle *exact = newRefrigerantHandle(database, rf[i_a],
+			rf_psat[i_a], 1, "SaturatedLiquidDensity_EoS1", 1);
+		RefrigerantHandle *surrogate = newRefrigerantHandle(database, rf[i_a],
+			rf_psat[i_a], 1, "SaturatedLiquidDensity_EoS1", 1);
+
+		if (exact == NULL || surrogate == NULL) {
+			return EXIT_FAILURE;
+		}
+
+		// Select random states within range of validity of vapor pressure
+		//
+		RefrigerantParameters *entry = exact->refrigerant_parameters;
+		double T_min_K = (T_min_rf_K[i_a] < 0) ? entry->T_min_psat_K :
+			T_min_rf_K[i_a];
+		double T_max_K = (T_max_rf_K[i_a] < 0) ? entry->T_max_psat_K :
+			T_max_rf_K[i_a];
+
+		srand(42);
+		for (int i = 0; i < NO_POINTS; i++) {
+			T_K[i] = T_min_K + (T_max_K - T_min_K) * rand() / RAND_MAX;
+		}
+		refh_p_sat_T_batch(p_Pa, T_K, NO_POINTS, exact);
+
+		// Create surrogates
+		//
+		double time_start = benchmark_time_s();
+		int error = refh_enable_surrogate(T_min_K, T_max_K, MAX_REL_ERROR,
+			surrogate);
+		double time_new = benchmark_time_s() - time_start;
+
+		printf("\n\n%s (%s): %.2f - %.2f K", rf[i_a], rf_psat[i_a], T_min_K,
+			T_max_K);
+		printf("\nCreation of surrogates: %.3f ms", 1e3 * time_new);
+
+		if (error != 0) {
+			return EXIT_FAILURE;
+		}
+
+		// Evaluate functions: Saturation temperature depends on pressure
+		//
+		for (int i_f = 0; i_f < NO_FUNCTIONS; i_f++) {
+			double time_exact_ns;
+			double time_surrogate_ns;
+			double max_error = bench_function(&time_exact_ns,
+				&time_surrogate_ns, tmp_exact, tmp_surrogate,
+				(i_f == NO_FUNCTIONS - 1) ? p_Pa : T_K, functions[i_f], exact,
+				surrogate);
+
+			printf("\n%-10s exact: %8.2f ns/state, surrogate: %8.2f ns/state"
+				", speed-up: %7.2f, maximal relative error: %e", names[i_f],
+				time_exact_ns, time_surrogate_ns,
+				time_exact_ns / time_surrogate_ns, max_error);
+		}
+
+		delRefrigerantHandle(exact);
+		delRefrigerantHandle(surrogate);
+	}
+	printf("\n");
+
+	// Free memory
+	//
+	delDatabase(database);
+
+	free(T_K);
+	free(p_Pa);
+	free(tmp_exact);
+	free(tmp_surrogate);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,259 @@
+//////////////////////////////
+// bench_streamEvaluation.c //
+//////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef __unix
+#include <sys/resource.h>
+#endif
+#include "batchPool.h"
+#include "benchmark.h"
+#include "status.h"
+#include "streamEvaluation.h"
+#include "workingPair.h"
+#include "workingPairBatch.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//SorpPropLib_MinimalExample.json"
+#else
+	#define PATH ".\\data\\SorpPropLib_MinimalExample.json"
+#endif
+
+#ifndef NO_ROWS
+#define NO_ROWS 10000000
+#endif
+
+#ifndef NO_CHECKS
+#define NO_CHECKS 1000
+#endif
+
+#ifndef NO_THREADS
+#define NO_THREADS 0
+#endif
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * synthetic_state:
+ * ----------------
+ *
+ * Auxiliary function returning synthetic state of a row of plant log.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_p_Pa:
+ *		Pressure in Pa.
+ *	double *ret_T_K:
+ *		Temperature in K.
+ *	long long row:
+ *		Row of log.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static void synthetic_state(double *ret_p_Pa, double *ret_T_K, long long row) {
+	*ret_p_Pa = 500 + 4500.0 * ((row * 7919) % 100003) / 100003;
+	*ret_T_K = 293.15 + 60.0 * ((row * 104729) % 99991) / 99991;
+}
+
+
+/*
+ * peak_memory_MB:
+ * ---------------
+ *
+ * Auxiliary function returning peak resident memory of process.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Peak resident memory in MB or -1 if unknown.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static double peak_memory_MB(void) {
+#ifdef __unix
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_maxrss / 1024.0;
+#else
+	return -1;
+#endif
+}
+
+
+/*
+ * bench_stream:
+ * -------------
+ *
+ * Auxiliary function streaming synthetic file through ads_w_pT and checking
+ * sampled rows of outputs against calls of ads_w_pT.
+ *
+ * Parameters:
+ * -----------
+ *	int *ret_no_failures:
+ *		Number of failures to be increased.
+ *	int binary:
+ *		Flag indicating whether binary records (i.e., 1) or CSV rows (i.e., 0)
+ *		are streamed.
+ *	void *batchPool:
+ *		Pointer of BatchPool-struct.
+ *	void *workingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static void bench_stream(int *ret_no_failures, int binary, void *batchPool,
+	void *workingPair) {
+	// Write synthetic log: Records contain time, pressure, and temperature
+	//
+	FILE *input = tmpfile();
+	FILE *output = tmpfile();
+
+	if (input == NULL || output == NULL) {
+		printf("\n\nCannot create temporary files!");
+		(*ret_no_failures)++;
+		return;
+	}
+
+	if (!binary) {
+		fprintf(input, "t_s,p_Pa,T_K\n");
+	}
+
+	for (long long i = 0; i < NO_ROWS; i++) {
+		double record[3] = {(double) i, 0, 0};
+		synthetic_state(&record[1], &record[2], i);
+
+		if (binary) {
+			fwrite(record, sizeof(double), 3, input);
+		} else {
+			fprintf(input, "%.0f,%.17g,%.17g\n", record[0], record[1],
+				record[2]);
+		}
+	}
+	rewind(input);
+
+	// Stream log
+	//
+	int columns[] = {1, 2};
+	StreamEvaluation stream;
+	memset(&stream, 0, sizeof(stream));
+	stream.function = "ads_w_pT";
+	stream.columns = columns;
+	stream.no_fields = 3;
+	stream.binary_input = binary;
+	stream.binary_output = binary;
+	stream.no_header = binary ? 0 : 1;
+	stream.delimiter = ',';
+	stream.block_size = STREAM_BLOCK_SIZE;
+
+	long long no_rows;
+	double time_start = benchmark_time_s();
+	int result = streamEvaluation_run(&no_rows, input, output, &stream,
+		batchPool, workingPair);
+	fflush(output);
+	double time_stream = benchmark_time_s() - time_start;
+
+	*ret_no_failures += (result != 0) || (no_rows != NO_ROWS);
+
+	// Check sampled rows: CSV outputs are written with round-trip precision
+	//
+	rewind(output);
+	long long stride = NO_ROWS / NO_CHECKS;
+	char line[64];
+
+	for (long long i = 0, i_check = 0; i < NO_ROWS && i_check < NO_CHECKS;
+		i++) {
+		double value;
+
+		if (binary) {
+			if (fread(&value, sizeof(double), 1, output) != 1) {
+				(*ret_no_failures)++;
+				break;
+			}
+		} else {
+			if (fgets(line, sizeof(line), output) == NULL) {
+				(*ret_no_failures)++;
+				break;
+			}
+			value = strtod(line, NULL);
+		}
+
+		if (i == i_check * stride) {
+			double p_Pa, T_K;
+			synthetic_state(&p_Pa, &T_K, i);
+
+			*ret_no_failures += value != ads_w_pT(p_Pa, T_K, workingPair);
+			i_check++;
+		}
+	}
+
+	printf("\n\n%s: %lld rows in %.2f s (%.2f Mrows/s)",
+		binary ? "Binary records" : "CSV rows", no_rows, time_stream,
+		1e-6 * no_rows / time_stream);
+
+	fclose(input);
+	fclose(output);
+}
+
+
+/*
+ * main:
+ * -----
+ *
+ * Streams synthetic plant logs of NO_ROWS rows as binary records and CSV
+ * rows through ads_w_pT, prints throughput and peak memory, and checks
+ * sampled rows.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main() {
+	WorkingPair *workingPair = newWorkingPair(PATH, "zeolite", "5a", "water",
+		"Toth", 1, "VaporPressure_EoS1", 1, "SaturatedLiquidDensity_EoS1", 1);
+	BatchPool *batchPool = newBatchPool(NO_THREADS);
+
+	if (workingPair == NULL || batchPool == NULL) {
+		printf("\n\nCannot initialize benchmark!");
+		return EXIT_FAILURE;
+	}
+
+	int no_failures = 0;
+
+	printf("\n\n##\n##\nBenchmark: Streaming evaluation of plant logs.");
+	printf("\nNumber of rows: %i", NO_ROWS);
+	printf("\nNumber of threads: %i", getBatchPoolNoThreads(batchPool));
+	printf("\nRows per block: %i", STREAM_BLOCK_SIZE);
+
+	bench_stream(&no_failures, 1, batchPool, workingPair);
+	bench_stream(&no_failures, 0, batchPool, workingPair);
+
+	printf("\n\nPeak resident memory: %.1f MB", peak_memory_MB());
+	printf("\n\nTotal number of failures: %i\n", no_failures);
+
+	delWorkingPair(workingPair);
+	delBatchPool(batchPool);
+
+	return (no_failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,355 @@
+//////////////////////////////
+// bench_workingPairBatch.c //
+//////////////////////////////
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "batchPool.h"
+#include "benchmark.h"
+#include "database.h"
+#include "workingPair.h"
+#include "workingPairBatch.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//sorpproplib.json"
+#else
+	#define PATH ".\\data\\sorpproplib.json"
+#endif
+
+#ifndef NO_POINTS_INNER
+#define NO_POINTS_INNER 200
+#endif
+
+#ifndef NO_POINTS_OUTER
+#define NO_POINTS_OUTER 100
+#endif
+
+#define NO_POINTS (NO_POINTS_INNER * NO_POINTS_OUTER)
+
+#ifndef NO_REPETITIONS
+#define NO_REPETITIONS 3
+#endif
+
+#ifndef NO_MODES
+#define NO_MODES 3
+#endif
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+typedef double (*equFunc)(double, double, void*);
+
+
+/////////////////////////////////
+// Definition of working pairs //
+/////////////////////////////////
+static const char *wp_as[] = {"zeolite crystal", "ionic liquid",
+	"ionic liquid"};
+static const char *wp_st[] = {"5A", "[C4mim][NTf2]", "[C4mim][NTf2]"};
+static const char *wp_rf[] = {"Propane", "CarbonDioxide", "CarbonDioxide"};
+static const char *wp_iso[] = {"DubininAstakhov", "MixingRule",
+	"MixingRule"};
+static const char *wp_function[] = {"ads_w_pT", "abs_mix_x_pT",
+	"abs_mix_p_Tx"};
+static const double in_0_min[] = {1e3, 1e5, 293.15};
+static const double in_0_max[] = {1e5, 6e6, 333.15};
+static const double in_1_min[] = {273.15, 293.15, 0.05};
+static const double in_1_max[] = {353.15, 333.15, 0.65};
+static const int in_0_log[] = {1, 1, 0};
+
+static const char *mode_names[] = {"static partition",
+	"work stealing", "temporary pool"};
+
+#define NO_CASES ((int) (sizeof(wp_as) / sizeof(wp_as[0])))
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * bench_mix_x_pT:
+ * ---------------
+ *
+ * Calculates liquid mole fraction by abs_mix_x_pT with same signature as
+ * equilibrium functions of adsorption.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_mix_x_pT(double p_Pa, double T_K, void *workingPair) {
+	double y_1_molmol;
+	double y_2_molmol;
+
+	return abs_mix_x_pT(&y_1_molmol, &y_2_molmol, p_Pa, T_K, workingPair);
+}
+
+
+/*
+ * bench_mix_p_Tx:
+ * ---------------
+ *
+ * Calculates pressure by abs_mix_p_Tx with same signature as equilibrium
+ * functions of adsorption.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_mix_p_Tx(double T_K, double x_molmol, void *workingPair) {
+	double y_1_molmol;
+	double y_2_molmol;
+
+	return abs_mix_p_Tx(&y_1_molmol, &y_2_molmol, T_K, x_molmol, workingPair);
+}
+
+
+/*
+ * bench_run:
+ * ----------
+ *
+ * Evaluates function of a working pair at all states NO_REPETITIONS times by
+ * batch_evaluate using one of the following modes:
+ *
+ *	0: Long-lived pool and one chunk per thread (i.e., static partition).
+ *	1: Long-lived pool and automatic grain size (i.e., work stealing).
+ *	2: Temporary pool and automatic grain size created for each call.
+ *
+ * Parameters:
+ * -----------
+ *	double *results:
+ *		Array used to store results of function.
+ *	const char *function:
+ *		Name of function.
+ *	const double **inputs:
+ *		Array containing arrays of inputs of function.
+ *	int no_threads:
+ *		Number of threads.
+ *	int mode:
+ *		Mode of evaluation.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns time required in s or -1 if evaluation failed.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_run(double *results, const char *function, const double **inputs,
+	int no_threads, int mode, WorkingPair *workingPair) {
+	// Create long-lived pool before time measurement
+	//
+	BatchPool *batchPool = NULL;
+
+	if (mode != 2) {
+		batchPool = newBatchPool(no_threads);
+
+		if (batchPool == NULL) {
+			return -1;
+		}
+	}
+
+	int grain_size = (mode == 0) ? (NO_POINTS + no_threads - 1) / no_threads :
+		0;
+	int flag = 0;
+	double time_start = benchmark_time_s();
+
+	for (int i_r = 0; i_r < NO_REPETITIONS; i_r++) {
+		BatchPool *pool = (mode == 2) ? newBatchPool(no_threads) : batchPool;
+
+		flag |= batch_evaluate(results, NULL, NULL, NULL, function, inputs,
+			NO_POINTS, grain_size, pool, workingPair);
+
+		if (mode == 2) {
+			delBatchPool(pool);
+		}
+	}
+
+	double time_s = benchmark_time_s() - time_start;
+	delBatchPool(batchPool);
+
+	return (flag != 0) ? -1 : time_s;
+}
+
+
+/*
+ * main:
+ * -----
+ *
+ * Scaling benchmark of batch evaluation by 1 to N threads. Functions of the
+ * Dubinin-Astakhov and mixing rule working pairs are evaluated for grids of
+ * states. The second input changes along the grid only every NO_POINTS_INNER
+ * states and, thus, iterations of abs_mix_p_Tx get more expensive from the
+ * beginning to the end of the array. Each number of threads is run with a
+ * static partition, work stealing, and a temporary pool. Results of all modes
+ * must be bit-identical to a serial loop calling the functions directly. The
+ * maximal number of threads N can be given by the command line argument
+ * "no_threads" and is the number of processors otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main(int argc, char *argv[]) {
+	// Get maximal number of threads
+	//
+	int no_threads_max = batchPool_no_processors();
+
+	if (argc == 2) {
+		no_threads_max = atoi(argv[1]);
+
+	} else if (argc != 1) {
+		printf("\n\nUsage: %s [no_threads]\n", argv[0]);
+		return EXIT_FAILURE;
+
+	}
+
+	if (no_threads_max < 1 || no_threads_max > NO_POINTS) {
+		printf("\n\nNumber of threads must be between 1 and %i!", NO_POINTS);
+		return EXIT_FAILURE;
+	}
+
+	// Allocate memory
+	//
+	double *in_0 = (double *) malloc(NO_POINTS * sizeof(double));
+	double *in_1 = (double *) malloc(NO_POINTS * sizeof(double));
+	double *reference = (double *) malloc(NO_POINTS * sizeof(double));
+	double *results = (double *) malloc(NO_POINTS * sizeof(double));
+
+	if (in_0 == NULL || in_1 == NULL || reference == NULL || results == NULL) {
+		printf("\n\nCannot allocate memory for benchmark!");
+		return EXIT_FAILURE;
+	}
+
+	const double *inputs[] = {in_0, in_1};
+
+	Database *database = newDatabase(PATH);
+
+	if (database == NULL) {
+		return EXIT_FAILURE;
+	}
+
+	printf("\n\n##\n##\nBenchmark: Batch evaluation by thread pools.");
+	printf("\nNumber of states: %i", NO_POINTS);
+	printf("\nNumber of repetitions: %i", NO_REPETITIONS);
+	printf("\nMaximal number of threads: %i", no_threads_max);
+
+	int no_failures = 0;
+
+	for (int i_c = 0; i_c < NO_CASES; i_c++) {
+		// Create working pair
+		//
+		WorkingPair *workingPair = newWorkingPairDatabase(database,
+			wp_as[i_c], wp_st[i_c], wp_rf[i_c], wp_iso[i_c], 1,
+			"VaporPressure_EoS1", 1, "SaturatedLiquidDensity_EoS1", 1);
+
+		if (workingPair == NULL) {
+			return EXIT_FAILURE;
+		}
+
+		printf("\n\n%s / %s / %s (%s 1): %s", wp_as[i_c], wp_st[i_c],
+			wp_rf[i_c], wp_iso[i_c], wp_function[i_c]);
+
+		// Generate grid of states: First input changes fastest and may be
+		// distributed logarithmically
+		//
+		for (int i = 0; i < NO_POINTS; i++) {
+			double r_0 = (double) (i % NO_POINTS_INNER) /
+				(NO_POINTS_INNER - 1);
+			double r_1 = (double) (i / NO_POINTS_INNER) /
+				(NO_POINTS_OUTER - 1);
+
+			in_0[i] = (in_0_log[i_c] == 1) ?
+				in_0_min[i_c] * pow(in_0_max[i_c] / in_0_min[i_c], r_0) :
+				in_0_min[i_c] + r_0 * (in_0_max[i_c] - in_0_min[i_c]);
+			in_1[i] = in_1_min[i_c] + r_1 * (in_1_max[i_c] - in_1_min[i_c]);
+		}
+
+		// Calculate reference results by serial loop
+		//
+		equFunc function = (i_c == 0) ? &ads_w_pT :
+			((i_c == 1) ? &bench_mix_x_pT : &bench_mix_p_Tx);
+		double time_start = benchmark_time_s();
+
+		for (int i = 0; i < NO_POINTS; i++) {
+			reference[i] = function(in_0[i], in_1[i], workingPair);
+		}
+
+		double time_serial_s = benchmark_time_s() - time_start;
+		printf("\nSerial loop: %10.3f Mcalls/s",
+			1e-6 * NO_POINTS / time_serial_s);
+
+		// Evaluate function by 1 to N threads: Numbers of threads are powers
+		// of two and maximal number of threads
+		//
+		for (int i_m = 0; i_m < NO_MODES; i_m++) {
+			double time_single_s = -1;
+
+			printf("\n%s:", mode_names[i_m]);
+
+			for (int no_threads = 1; no_threads <= no_threads_max;
+				no_threads = (2 * no_threads > no_threads_max &&
+				no_threads < no_threads_max) ? no_threads_max :
+				2 * no_threads) {
+				memset(results, 0, NO_POINTS * sizeof(double));
+
+				double time_s = bench_run(results, wp_function[i_c], inputs,
+					no_threads, i_m, workingPair);
+
+				if (time_s < 0) {
+					printf("\n\nCannot evaluate batch for benchmark!");
+					return EXIT_FAILURE;
+				}
+
+				int no_different = 0;
+
+				for (int i = 0; i < NO_POINTS; i++) {
+					no_different += (memcmp(&reference[i], &results[i],
+						sizeof(double)) != 0);
+				}
+				no_failures += no_different;
+
+				time_single_s = (no_threads == 1) ? time_s : time_single_s;
+				printf("\nThreads: %3i, throughput: %10.3f Mcalls/s, "
+					"speed-up: %6.2f, efficiency: %6.2f %%, different "
+					"results: %i", no_threads,
+					1e-6 * NO_REPETITIONS * NO_POINTS / time_s,
+					time_single_s / time_s,
+					100 * time_single_s / time_s / no_threads, no_different);
+			}
+		}
+
+		delWorkingPair(workingPair);
+	}
+	printf("\n\nTotal number of failures: %i\n", no_failures);
+
+	// Free memory
+	//
+	delDatabase(database);
+
+	free(in_0);
+	free(in_1);
+	free(reference);
+	free(results);
+
+	return (no_failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
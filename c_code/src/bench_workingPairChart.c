@@ -0,0 +1,227 @@
+//////////////////////////////
+// bench_workingPairChart.c //
+//////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "batchPool.h"
+#include "benchmark.h"
+#include "status.h"
+#include "surrogate.h"
+#include "workingPair.h"
+#include "workingPairBatch.h"
+#include "workingPairChart.h"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//SorpPropLib_MinimalExample.json"
+#else
+	#define PATH ".\\data\\SorpPropLib_MinimalExample.json"
+#endif
+
+#ifndef NO_CURVES
+#define NO_CURVES 50
+#endif
+
+#ifndef NO_POINTS
+#define NO_POINTS 2000
+#endif
+
+#ifndef NO_THREADS
+#define NO_THREADS 0
+#endif
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * bench_chart:
+ * ------------
+ *
+ * Auxiliary function generating a chart by chart_evaluate and by scalar calls
+ * (i.e., as plotting scripts do), printing both durations, and checking that
+ * values and validity flags are identical.
+ *
+ * Parameters:
+ * -----------
+ *	int *ret_no_failures:
+ *		Number of failures to be increased.
+ *	int chart:
+ *		Type of chart (e.g., CHART_ISOTHERMS).
+ *	const char *name:
+ *		Name of chart printed.
+ *	const double *curves:
+ *		Array containing inputs that are constant along each curve.
+ *	const double *points:
+ *		Array containing inputs that vary along each curve.
+ *	void *batchPool:
+ *		Pointer of BatchPool-struct.
+ *	void *workingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static void bench_chart(int *ret_no_failures, int chart, const char *name,
+	const double *curves, const double *points, void *batchPool,
+	void *workingPair) {
+	long no_entries = (long) NO_CURVES * NO_POINTS;
+	double *values = (double *) malloc(no_entries * sizeof(double));
+	double *T_sat_K = (double *) malloc(no_entries * sizeof(double));
+	unsigned char *valid = (unsigned char *) malloc(no_entries);
+
+	if (values == NULL || T_sat_K == NULL || valid == NULL) {
+		printf("\n\nCannot allocate memory!");
+		(*ret_no_failures)++;
+		free(values);
+		free(T_sat_K);
+		free(valid);
+		return;
+	}
+
+	const char *function = (chart == CHART_ISOTHERMS ||
+		chart == CHART_ISOBARS) ? "ads_w_pT" : "ads_p_wT";
+
+	// Generate chart by one call
+	//
+	double time_start = benchmark_time_s();
+	int result = chart_evaluate(values, T_sat_K, valid, NULL, chart,
+		function, curves, NO_CURVES, points, NO_POINTS, batchPool,
+		workingPair);
+	double time_chart = benchmark_time_s() - time_start;
+
+	*ret_no_failures += (result != 0);
+
+	// Generate chart by scalar calls: Vapor pressure is calculated for each
+	// state
+	//
+	int quiet = status_quiet_thread(1);
+	long no_valid = 0;
+	int no_mismatches = 0;
+
+	time_start = benchmark_time_s();
+	for (int i = 0; i < NO_CURVES; i++) {
+		for (int j = 0; j < NO_POINTS; j++) {
+			double value;
+			double p_Pa;
+			double p_sat_Pa;
+
+			if (chart == CHART_ISOTHERMS) {
+				value = ads_w_pT(points[j], curves[i], workingPair);
+				p_Pa = points[j];
+				p_sat_Pa = ref_p_sat_T(curves[i], workingPair);
+
+			} else if (chart == CHART_ISOBARS) {
+				value = ads_w_pT(curves[i], points[j], workingPair);
+				p_Pa = curves[i];
+				p_sat_Pa = ref_p_sat_T(points[j], workingPair);
+
+			} else {
+				value = ads_p_wT(curves[i], points[j], workingPair);
+				p_Pa = value;
+				p_sat_Pa = ref_p_sat_T(points[j], workingPair);
+			}
+
+			int valid_scalar = (status_code() == STATUS_OK) &&
+				surrogate_finite(value) && (p_Pa >= 0) && (p_Pa <= p_sat_Pa);
+			double T_sat_scalar = valid_scalar ? ref_T_sat_p(p_Pa,
+				workingPair) : -1;
+
+			long index = (long) i * NO_POINTS + j;
+			no_valid += valid_scalar;
+			no_mismatches += (value != values[index]) ||
+				(valid_scalar != valid[index]) || (chart == CHART_DUEHRING &&
+				T_sat_scalar != T_sat_K[index]);
+		}
+	}
+	double time_scalar = benchmark_time_s() - time_start;
+	status_quiet_thread(quiet);
+
+	*ret_no_failures += no_mismatches;
+
+	printf("\n\n%s: %i curves of %i points (%li valid entries)", name,
+		NO_CURVES, NO_POINTS, no_valid);
+	printf("\nScalar calls: %.2f ms", 1e3 * time_scalar);
+	printf("\nChart: %.2f ms (speed-up: %.1f)", 1e3 * time_chart,
+		time_scalar / time_chart);
+	printf("\nMismatches: %i", no_mismatches);
+
+	free(values);
+	free(T_sat_K);
+	free(valid);
+}
+
+
+/*
+ * main:
+ * -----
+ *
+ * Generates isotherms, isosteres, isobars, and Dühring chart of an adsorption
+ * working pair by chart_evaluate and by scalar calls, prints durations, and
+ * checks that results are identical.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main() {
+	WorkingPair *workingPair = newWorkingPair(PATH, "zeolite", "5a", "water",
+		"Toth", 1, "VaporPressure_EoS1", 1, "SaturatedLiquidDensity_EoS1", 1);
+	BatchPool *batchPool = newBatchPool(NO_THREADS);
+
+	double *T_K = (double *) malloc(NO_POINTS * sizeof(double));
+	double *p_Pa = (double *) malloc(NO_POINTS * sizeof(double));
+	double T_curves_K[NO_CURVES];
+	double p_curves_Pa[NO_CURVES];
+	double w_curves_kgkg[NO_CURVES];
+
+	if (workingPair == NULL || batchPool == NULL || T_K == NULL ||
+		p_Pa == NULL) {
+		printf("\n\nCannot initialize benchmark!");
+		return EXIT_FAILURE;
+	}
+
+	// Grids of charts: Pressures exceed vapor pressures of lower temperatures
+	// so that clipping is benchmarked, too
+	//
+	for (int i = 0; i < NO_POINTS; i++) {
+		T_K[i] = 273.15 + 250.0 * i / (NO_POINTS - 1);
+		p_Pa[i] = 100 + 19900.0 * i / (NO_POINTS - 1);
+	}
+	for (int i = 0; i < NO_CURVES; i++) {
+		T_curves_K[i] = 273.15 + 150.0 * i / (NO_CURVES - 1);
+		p_curves_Pa[i] = 500 + 9500.0 * i / (NO_CURVES - 1);
+		w_curves_kgkg[i] = 0.01 + 0.25 * i / (NO_CURVES - 1);
+	}
+
+	int no_failures = 0;
+
+	printf("\n\n##\n##\nBenchmark: Generation of charts.");
+	printf("\nNumber of threads: %i", getBatchPoolNoThreads(batchPool));
+
+	bench_chart(&no_failures, CHART_ISOTHERMS, "Isotherms", T_curves_K, p_Pa,
+		batchPool, workingPair);
+	bench_chart(&no_failures, CHART_ISOSTERES, "Isosteres", w_curves_kgkg,
+		T_K, batchPool, workingPair);
+	bench_chart(&no_failures, CHART_ISOBARS, "Isobars", p_curves_Pa, T_K,
+		batchPool, workingPair);
+	bench_chart(&no_failures, CHART_DUEHRING, "Dühring chart", w_curves_kgkg,
+		T_K, batchPool, workingPair);
+
+	printf("\n\nTotal number of failures: %i\n", no_failures);
+
+	free(T_K);
+	free(p_Pa);
+	delWorkingPair(workingPair);
+	delBatchPool(batchPool);
+
+	return (no_failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
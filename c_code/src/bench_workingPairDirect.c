@@ -0,0 +1,123 @@
+///////////////////////////////
+// bench_workingPairDirect.c //
+///////////////////////////////
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "benchmark.h"
+#include "workingPair.h"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//SorpPropLib_MinimalExample.json"
+#else
+	#define PATH ".\\data\\SorpPropLib_MinimalExample.json"
+#endif
+
+#ifndef NO_CALLS_UNCACHED
+#define NO_CALLS_UNCACHED 200
+#endif
+
+#ifndef NO_CALLS_CACHED
+#define NO_CALLS_CACHED 200000
+#endif
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * bench_direct:
+ * -------------
+ *
+ * Evaluates equilibrium loading and vapor pressure by functions working
+ * without WorkingPair-struct like a Modelica simulation using direct function
+ * calls, i.e. each call passes the names of the working pair.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_sum:
+ *		Sum of all results to check that cached and uncached calls agree.
+ *	int no_calls:
+ *		Number of calls of each function.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns elapsed time in s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_direct(double *ret_sum, int no_calls) {
+	double time_start = benchmark_time_s();
+	*ret_sum = 0;
+
+	for (int i = 0; i < no_calls; i++) {
+		double T_K = 293.15 + 60.0 * (i % 100) / 100;
+
+		*ret_sum += direct_ads_w_pT(1000, T_K, PATH, "zeolite", "5a", "water",
+			"Toth", 1, "VaporPressure_EoS1", 1, "SaturatedLiquidDensity_EoS1",
+			1);
+		*ret_sum += direct_ref_p_sat_T(T_K, PATH, "zeolite", "5a", "water",
+			"Toth", 1, "VaporPressure_EoS1", 1, "SaturatedLiquidDensity_EoS1",
+			1);
+	}
+
+	return benchmark_time_s() - time_start;
+}
+
+
+/*
+ * main:
+ * -----
+ *
+ * Compares time of functions working without WorkingPair-struct without cache
+ * (i.e., database is read and parsed for each call) and with cache (i.e.,
+ * database is read and parsed once per working pair). Furthermore, checks
+ * that both variants calculate identical results.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main() {
+	// Run benchmark without cache
+	//
+	double sum_uncached;
+	setDirectWorkingPairCache(0);
+	double time_uncached = bench_direct(&sum_uncached, NO_CALLS_UNCACHED);
+
+	// Run benchmark with cache: First call creates working pair
+	//
+	double sum_cached;
+	setDirectWorkingPairCache(1);
+	double time_first = bench_direct(&sum_cached, 1);
+	bench_direct(&sum_cached, NO_CALLS_UNCACHED);
+	double diff = fabs(sum_cached - sum_uncached);
+	double time_cached = bench_direct(&sum_cached, NO_CALLS_CACHED);
+
+	clearDirectWorkingPairs();
+
+	// Print results: Each iteration calls two functions
+	//
+	printf("\n\n##\n##\nBenchmark: Direct function calls.");
+	printf("\n\nWithout cache: %.3f us/call",
+		1e6 * time_uncached / (2.0 * NO_CALLS_UNCACHED));
+	printf("\nWith cache (first call): %.3f us/call", 1e6 * time_first / 2.0);
+	printf("\nWith cache: %.3f us/call",
+		1e6 * time_cached / (2.0 * NO_CALLS_CACHED));
+	printf("\nSpeed-up of cache: %.1f",
+		(time_uncached / NO_CALLS_UNCACHED) / (time_cached / NO_CALLS_CACHED));
+	printf("\nAbsolute difference of results: %e\n", diff);
+
+	return (diff == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,173 @@
+////////////////////////////////
+// bench_workingPairLabVIEW.c //
+////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "benchmark.h"
+#include "status.h"
+#include "workingPair.h"
+#include "workingPairBatch.h"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//SorpPropLib_MinimalExample.json"
+#else
+	#define PATH ".\\data\\SorpPropLib_MinimalExample.json"
+#endif
+
+#ifndef NO_POINTS
+#define NO_POINTS 1000
+#endif
+
+#ifndef NO_BUFFERS
+#define NO_BUFFERS 2000
+#endif
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * compare_doubles:
+ * ----------------
+ *
+ * Auxiliary function comparing two doubles for qsort.
+ *
+ * Parameters:
+ * -----------
+ *	const void *a:
+ *		Pointer to first double.
+ *	const void *b:
+ *		Pointer to second double.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns -1, 0, or 1 if first double is smaller, equal, or greater.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int compare_doubles(const void *a, const void *b) {
+	double diff = *(const double *) a - *(const double *) b;
+	return (diff > 0) - (diff < 0);
+}
+
+
+/*
+ * main:
+ * -----
+ *
+ * Simulates a DAQ loop of LabVIEW converting buffers of pressures and
+ * temperatures to equilibrium loadings by one call of batch_evaluate_labview
+ * per buffer (i.e., by calling thread). Prints distribution of latency per
+ * buffer, compares it with one call per state, and checks that results and
+ * error cluster are correct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main() {
+	// Create working pair and buffers: Rows of inputs are pressures and
+	// temperatures
+	//
+	WorkingPair *workingPair = newWorkingPair(PATH, "zeolite", "5a", "water",
+		"Toth", 1, "VaporPressure_EoS1", 1, "SaturatedLiquidDensity_EoS1", 1);
+
+	double *inputs = (double *) malloc(2 * NO_POINTS * sizeof(double));
+	double *values = (double *) malloc(NO_POINTS * sizeof(double));
+	double *reference = (double *) malloc(NO_POINTS * sizeof(double));
+	int *status = (int *) malloc(NO_POINTS * sizeof(int));
+	double *latency = (double *) malloc(NO_BUFFERS * sizeof(double));
+
+	if (workingPair == NULL || inputs == NULL || values == NULL ||
+		reference == NULL || status == NULL || latency == NULL) {
+		printf("\n\nCannot allocate memory for benchmark!");
+		return EXIT_FAILURE;
+	}
+
+	unsigned char error;
+	int code;
+	char source[256];
+	int no_failures = 0;
+	double time_scalar = 0;
+
+	for (int i_b = 0; i_b < NO_BUFFERS; i_b++) {
+		// Fill buffer with new samples
+		//
+		for (int i = 0; i < NO_POINTS; i++) {
+			inputs[i] = 500 + 4500.0 * ((i * 7 + i_b) % NO_POINTS) / NO_POINTS;
+			inputs[NO_POINTS + i] = 293.15 + 60.0 * i / NO_POINTS;
+		}
+
+		// Convert buffer by one call
+		//
+		double time_start = benchmark_time_s();
+		batch_evaluate_labview(values, status, &error, &code, source,
+			sizeof(source), "ads_w_pT", inputs, 2, NO_POINTS, NULL,
+			workingPair);
+		latency[i_b] = benchmark_time_s() - time_start;
+
+		// Convert buffer by one call per state
+		//
+		time_start = benchmark_time_s();
+		for (int i = 0; i < NO_POINTS; i++) {
+			reference[i] = ads_w_pT(inputs[i], inputs[NO_POINTS + i],
+				workingPair);
+		}
+		time_scalar += benchmark_time_s() - time_start;
+
+		no_failures += (error != 0) || (code != 0) ||
+			(memcmp(values, reference, NO_POINTS * sizeof(double)) != 0);
+	}
+
+	// Check error cluster of invalid number of inputs
+	//
+	int no_failed = batch_evaluate_labview(values, status, &error, &code,
+		source, sizeof(source), "ads_w_pT", inputs, 3, NO_POINTS, NULL,
+		workingPair);
+	no_failures += (no_failed != -1) || (error != 1) ||
+		(code != LABVIEW_ERROR_CODE + STATUS_INVALID_INPUT);
+
+	// Print results
+	//
+	qsort(latency, NO_BUFFERS, sizeof(double), &compare_doubles);
+
+	printf("\n\n##\n##\nBenchmark: Buffers of LabVIEW DAQ loop.");
+	printf("\nNumber of states per buffer: %i", NO_POINTS);
+	printf("\nNumber of buffers: %i", NO_BUFFERS);
+	printf("\n\nLatency per buffer (min): %.1f us", 1e6 * latency[0]);
+	printf("\nLatency per buffer (median): %.1f us",
+		1e6 * latency[NO_BUFFERS / 2]);
+	printf("\nLatency per buffer (99 %%): %.1f us",
+		1e6 * latency[(int) (0.99 * (NO_BUFFERS - 1))]);
+	printf("\nLatency per buffer (max): %.1f us",
+		1e6 * latency[NO_BUFFERS - 1]);
+	printf("\nLatency per buffer (one call per state): %.1f us",
+		1e6 * time_scalar / NO_BUFFERS);
+	printf("\nError cluster of invalid inputs: %i, %i, %s", error, code,
+		source);
+	printf("\n\nTotal number of failures: %i\n", no_failures);
+
+	// Free memory
+	//
+	delWorkingPair(workingPair);
+
+	free(inputs);
+	free(values);
+	free(reference);
+	free(status);
+	free(latency);
+
+	return (no_failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,502 @@
+///////////////////////////////
+// bench_workingPairReplay.c //
+///////////////////////////////
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "benchmark.h"
+#include "database.h"
+#include "statistics.h"
+#include "status.h"
+#include "trace.h"
+#include "workingPair.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//sorpproplib.json"
+#else
+	#define PATH ".\\data\\sorpproplib.json"
+#endif
+
+#ifndef NO_REPETITIONS
+#define NO_REPETITIONS 3
+#endif
+
+#ifndef REPLAY_TOLERANCE
+#define REPLAY_TOLERANCE 1e-9
+#endif
+
+#ifndef REPLAY_NO_PRINTED
+#define REPLAY_NO_PRINTED 10
+#endif
+
+#define REPLAY_NAME(name) #name,
+
+#define REPLAY_1(name) \
+	case STATISTICS_FUNCTION_##name: \
+		return name(a[0], workingPair);
+#define REPLAY_2(name) \
+	case STATISTICS_FUNCTION_##name: \
+		return name(a[0], a[1], workingPair);
+#define REPLAY_3(name) \
+	case STATISTICS_FUNCTION_##name: \
+		return name(a[0], a[1], a[2], workingPair);
+#define REPLAY_4(name) \
+	case STATISTICS_FUNCTION_##name: \
+		return name(a[0], a[1], a[2], a[3], workingPair);
+#define REPLAY_5(name) \
+	case STATISTICS_FUNCTION_##name: \
+		return name(a[0], a[1], a[2], a[3], a[4], workingPair);
+#define REPLAY_6(name) \
+	case STATISTICS_FUNCTION_##name: \
+		return name(a[0], a[1], a[2], a[3], a[4], a[5], workingPair);
+#define REPLAY_7(name) \
+	case STATISTICS_FUNCTION_##name: \
+		return name(a[0], a[1], a[2], a[3], a[4], a[5], a[6], workingPair);
+#define REPLAY_8(name) \
+	case STATISTICS_FUNCTION_##name: \
+		return name(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], \
+			workingPair);
+#define REPLAY_MIX(name) \
+	case STATISTICS_FUNCTION_##name: \
+		return name(&y_1_molmol, &y_2_molmol, a[0], a[1], workingPair);
+
+
+/////////////////////////////
+// Definition of variables //
+/////////////////////////////
+/*
+ * Names of functions of this library in order of their indices.
+ *
+ */
+static const char *replay_names[] = {
+	STATISTICS_FUNCTIONS(REPLAY_NAME)
+};
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * replay_call:
+ * ------------
+ *
+ * Calls function of working pair with recorded inputs.
+ *
+ * Parameters:
+ * -----------
+ *	int function:
+ *		Index of function (i.e., STATISTICS_FUNCTION_*).
+ *	const double *a:
+ *		Array containing inputs of call.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Result of function or -1 if function is unknown.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double replay_call(int function, const double *a, WorkingPair *workingPair) {
+	double y_1_molmol;
+	double y_2_molmol;
+
+	switch (function) {
+		REPLAY_2(ads_w_pT)
+		REPLAY_2(ads_p_wT)
+		REPLAY_2(ads_T_pw)
+		REPLAY_2(ads_dw_dp_pT)
+		REPLAY_2(ads_dw_dT_pT)
+		REPLAY_2(ads_dp_dw_wT)
+		REPLAY_2(ads_dp_dT_wT)
+		REPLAY_4(ads_w_pT_der)
+		REPLAY_4(ads_p_wT_der)
+		REPLAY_4(ads_T_pw_der)
+		REPLAY_4(ads_dw_dp_pT_der)
+		REPLAY_4(ads_dw_dT_pT_der)
+		REPLAY_4(ads_dp_dw_wT_der)
+		REPLAY_4(ads_dp_dT_wT_der)
+		REPLAY_6(ads_piStar_pyxgTM)
+		REPLAY_2(ads_sur_w_pT)
+		REPLAY_2(ads_sur_p_wT)
+		REPLAY_2(ads_sur_T_pw)
+		REPLAY_2(ads_sur_dw_dp_pT)
+		REPLAY_2(ads_sur_dw_dT_pT)
+		REPLAY_2(ads_sur_dp_dw_wT)
+		REPLAY_2(ads_sur_dp_dT_wT)
+		REPLAY_6(ads_sur_piStar_pyxgTM)
+		REPLAY_3(ads_sur_w_pTpsat)
+		REPLAY_3(ads_sur_p_wTpsat)
+		REPLAY_3(ads_sur_T_pwpsat)
+		REPLAY_3(ads_sur_dw_dp_pTpsat)
+		REPLAY_4(ads_sur_dw_dT_pTpsat)
+		REPLAY_3(ads_sur_dp_dw_wTpsat)
+		REPLAY_4(ads_sur_dp_dT_wTpsat)
+		REPLAY_7(ads_sur_piStar_pyxgTpsatM)
+		REPLAY_2(ads_vol_W_ARho)
+		REPLAY_2(ads_vol_A_WRho)
+		REPLAY_4(ads_vol_w_pTpsatRho)
+		REPLAY_4(ads_vol_p_wTpsatRho)
+		REPLAY_4(ads_vol_T_pwpsatRho)
+		REPLAY_2(ads_vol_dW_dA_ARho)
+		REPLAY_2(ads_vol_dA_dW_WRho)
+		REPLAY_4(ads_vol_dw_dp_pTpsatRho)
+		REPLAY_6(ads_vol_dw_dT_pTpsatRho)
+		REPLAY_4(ads_vol_dp_dw_wTpsatRho)
+		REPLAY_6(ads_vol_dp_dT_wTpsatRho)
+		REPLAY_8(ads_vol_piStar_pyxgTpsatRhoM)
+		REPLAY_2(abs_con_X_pT)
+		REPLAY_2(abs_con_p_XT)
+		REPLAY_2(abs_con_T_pX)
+		REPLAY_2(abs_con_dX_dp_pT)
+		REPLAY_2(abs_con_dX_dT_pT)
+		REPLAY_2(abs_con_dp_dX_XT)
+		REPLAY_2(abs_con_dp_dT_XT)
+		REPLAY_4(abs_con_X_pT_der)
+		REPLAY_4(abs_con_p_XT_der)
+		REPLAY_4(abs_con_T_pX_der)
+		REPLAY_4(abs_con_dX_dp_pT_der)
+		REPLAY_4(abs_con_dX_dT_pT_der)
+		REPLAY_4(abs_con_dp_dX_XT_der)
+		REPLAY_4(abs_con_dp_dT_XT_der)
+		REPLAY_4(abs_act_g_Txv1v2)
+		REPLAY_5(abs_act_p_Txv1v2psat)
+		REPLAY_5(abs_act_x_pTv1v2psat)
+		REPLAY_4(abs_act_p_Txv1v2)
+		REPLAY_4(abs_act_x_pTv1v2)
+		REPLAY_MIX(abs_mix_x_pT)
+		REPLAY_MIX(abs_mix_p_Tx)
+		REPLAY_MIX(abs_mix_T_px)
+		REPLAY_2(abs_mix_dp_dx_Tx)
+		REPLAY_2(abs_mix_dp_dT_Tx)
+		REPLAY_4(abs_mix_dp_dx_Tx_der)
+		REPLAY_4(abs_mix_dp_dT_Tx_der)
+		REPLAY_1(ref_p_sat_T)
+		REPLAY_1(ref_dp_sat_dT_T)
+		REPLAY_1(ref_rho_l_T)
+		REPLAY_1(ref_drho_l_dT_T)
+		REPLAY_1(ref_T_sat_p)
+		REPLAY_2(ref_p_sat_T_der)
+		REPLAY_2(ref_T_sat_p_der)
+		REPLAY_2(ref_rho_l_T_der)
+		REPLAY_2(ref_dp_sat_dT_T_der)
+		REPLAY_2(ref_drho_l_dT_T_der)
+		REPLAY_2(tab_w_pT)
+		REPLAY_2(tab_p_wT)
+		REPLAY_2(tab_T_pw)
+		REPLAY_4(tab_w_pT_der)
+		REPLAY_4(tab_p_wT_der)
+		REPLAY_4(tab_T_pw_der)
+		default:
+			return -1;
+	}
+}
+
+
+/*
+ * replay_compare:
+ * ---------------
+ *
+ * Compares two doubles for qsort.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int replay_compare(const void *a, const void *b) {
+	double value_a = *((const double *) a);
+	double value_b = *((const double *) b);
+
+	return (value_a > value_b) - (value_a < value_b);
+}
+
+
+/*
+ * replay_print_latencies:
+ * -----------------------
+ *
+ * Sorts latencies and prints their percentiles.
+ *
+ * Parameters:
+ * -----------
+ *	const char *label:
+ *		Label of latencies.
+ *	double *latencies_ns:
+ *		Array containing latencies in ns that is sorted.
+ *	size_t no_latencies:
+ *		Number of latencies.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void replay_print_latencies(const char *label, double *latencies_ns,
+	size_t no_latencies) {
+	const double percentiles[] = {0.5, 0.9, 0.99, 0.999};
+
+	if (no_latencies == 0) {
+		return;
+	}
+	qsort(latencies_ns, no_latencies, sizeof(double), &replay_compare);
+
+	printf("\n%-9s latency:", label);
+
+	for (int i = 0; i < 4; i++) {
+		size_t index = (size_t) ceil(percentiles[i] * no_latencies) - 1;
+
+		printf(" p%g %9.0f ns,", 100 * percentiles[i], latencies_ns[index]);
+	}
+	printf(" max %9.0f ns", latencies_ns[no_latencies - 1]);
+}
+
+
+/*
+ * main:
+ * -----
+ *
+ * Replays a trace recorded by sorp_trace_save against the current library:
+ * Working pairs of the trace are created from the database and all recorded
+ * calls are executed in their original order. The benchmark reports the
+ * throughput of the best of NO_REPETITIONS replays, percentiles of recorded and
+ * replayed latencies, and the results that differ from the recorded results.
+ * Command line arguments are the path of the trace file and, optionally, the
+ * path of the database and the number of repetitions.
+ *
+ * Remarks:
+ * --------
+ *	Calls are replayed by one thread. Surrogates and spline tables are not
+ *	recorded and, thus, not enabled when replaying.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main(int argc, char *argv[]) {
+	// Get command line arguments
+	//
+	if (argc < 2 || argc > 4) {
+		printf("\n\nUsage: %s path_trace [path_db] [no_repetitions]\n",
+			argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	const char *path_db = (argc > 2) ? argv[2] : PATH;
+	int no_repetitions = (argc > 3) ? atoi(argv[3]) : NO_REPETITIONS;
+
+	if (no_repetitions < 1) {
+		printf("\n\nNumber of repetitions must be positive!");
+		return EXIT_FAILURE;
+	}
+
+	// Read trace and database: Warnings of replayed calls are not printed
+	//
+	TraceFile *traceFile = newTraceFile(argv[1]);
+
+	if (traceFile == NULL) {
+		return EXIT_FAILURE;
+	}
+
+	Database *database = newDatabase(path_db);
+
+	if (database == NULL) {
+		delTraceFile(traceFile);
+		return EXIT_FAILURE;
+	}
+	setStatusQuiet(1);
+
+	// Map functions of trace to functions of this library and create working
+	// pairs of trace
+	//
+	size_t no_records = (size_t) traceFile->no_records;
+	int *functions = (int *) malloc((traceFile->no_functions + 1) *
+		sizeof(int));
+	WorkingPair **workingPairs = (WorkingPair **) calloc(
+		traceFile->no_pairs + 1, sizeof(WorkingPair *));
+	double *latencies_recorded = (double *) malloc((no_records + 1) *
+		sizeof(double));
+	double *latencies_replayed = (double *) malloc((no_records + 1) *
+		sizeof(double));
+	double *results = (double *) malloc((no_records + 1) * sizeof(double));
+
+	if (functions == NULL || workingPairs == NULL ||
+		latencies_recorded == NULL || latencies_replayed == NULL ||
+		results == NULL) {
+		printf("\n\nCannot allocate memory for benchmark!");
+		return EXIT_FAILURE;
+	}
+
+	for (int i = 0; i < traceFile->no_functions; i++) {
+		functions[i] = -1;
+
+		for (int j = 0; j < STATISTICS_NO_FUNCTIONS; j++) {
+			if (strcmp(traceFile->functions[i], replay_names[j]) == 0) {
+				functions[i] = j;
+				break;
+			}
+		}
+	}
+
+	printf("\n\n##\n##\nBenchmark: Replay of recorded calls.");
+	printf("\nTrace: %s", argv[1]);
+	printf("\nNumber of recorded calls: %.0f (of %.0f calls)",
+		(double) traceFile->no_records, (double) traceFile->no_calls);
+	printf("\nNumber of repetitions: %i", no_repetitions);
+
+	for (int i = 0; i < traceFile->no_pairs; i++) {
+		TracePair *pair = &traceFile->pairs[i];
+
+		workingPairs[i] = newWorkingPairDatabase(database, pair->wp_as,
+			pair->wp_st, pair->wp_rf, pair->wp_iso, pair->no_iso,
+			pair->rf_psat, pair->no_p_sat, pair->rf_rhol, pair->no_rhol);
+
+		printf("\nWorking pair %i: %s / %s / %s (%s %i)%s", i, pair->wp_as,
+			pair->wp_st, pair->wp_rf, pair->wp_iso, pair->no_iso,
+			(workingPairs[i] == NULL) ? " cannot be created" : "");
+	}
+
+	// Count calls that can be replayed
+	//
+	size_t no_skipped = 0;
+
+	for (size_t i = 0; i < no_records; i++) {
+		TraceRecord *record = &traceFile->records[i];
+
+		no_skipped += (functions[record->function] < 0 ||
+			workingPairs[record->pair] == NULL);
+	}
+
+	// Measure throughput without timing each call
+	//
+	double time_best_s = -1;
+	double sink = 0;
+
+	for (int i_r = 0; i_r < no_repetitions; i_r++) {
+		double time_start = benchmark_time_s();
+
+		for (size_t i = 0; i < no_records; i++) {
+			TraceRecord *record = &traceFile->records[i];
+			int function = functions[record->function];
+			WorkingPair *workingPair = workingPairs[record->pair];
+
+			if (function >= 0 && workingPair != NULL) {
+				sink += replay_call(function, record->arguments, workingPair);
+			}
+		}
+
+		double time_s = benchmark_time_s() - time_start;
+		time_best_s = (time_best_s < 0 || time_s < time_best_s) ? time_s :
+			time_best_s;
+	}
+
+	// Measure latency of each call and store results
+	//
+	size_t no_replayed = 0;
+
+	for (size_t i = 0; i < no_records; i++) {
+		TraceRecord *record = &traceFile->records[i];
+		int function = functions[record->function];
+		WorkingPair *workingPair = workingPairs[record->pair];
+
+		if (function >= 0 && workingPair != NULL) {
+			double time_start = benchmark_time_s();
+			results[i] = replay_call(function, record->arguments, workingPair);
+			double time_s = benchmark_time_s() - time_start;
+
+			latencies_recorded[no_replayed] = record->time_ns;
+			latencies_replayed[no_replayed] = 1e9 * time_s;
+			no_replayed++;
+		}
+	}
+
+	printf("\n\nReplayed calls: %.0f, skipped calls: %.0f",
+		(double) no_replayed, (double) no_skipped);
+	printf("\nThroughput: %10.3f Mcalls/s (checksum: %g)",
+		(time_best_s > 0) ? 1e-6 * no_replayed / time_best_s : 0, sink);
+
+	// Compare results: Results are identical if they are bit-identical or both
+	// are NaN
+	//
+	size_t no_different = 0;
+	size_t no_failures = 0;
+	double error_abs_max = 0;
+	double error_rel_max = 0;
+
+	for (size_t i = 0; i < no_records; i++) {
+		TraceRecord *record = &traceFile->records[i];
+
+		if (functions[record->function] < 0 ||
+			workingPairs[record->pair] == NULL ||
+			memcmp(&record->result, &results[i], sizeof(double)) == 0 ||
+			(isnan(record->result) && isnan(results[i]))) {
+			continue;
+		}
+
+		double error_abs = fabs(results[i] - record->result);
+		double error_rel = error_abs / fmax(fabs(record->result), 1e-300);
+
+		no_different++;
+		error_abs_max = isnan(error_abs) ? error_abs :
+			fmax(error_abs, error_abs_max);
+		error_rel_max = isnan(error_rel) ? error_rel :
+			fmax(error_rel, error_rel_max);
+
+		if (!(error_rel <= REPLAY_TOLERANCE)) {
+			if (no_failures < REPLAY_NO_PRINTED) {
+				printf("\nCall %.0f: %s of working pair %i at (",
+					(double) i, traceFile->functions[record->function],
+					record->pair);
+
+				for (int j = 0; j < record->no_arguments; j++) {
+					printf((j == 0) ? "%.17g" : ", %.17g",
+						record->arguments[j]);
+				}
+				printf("): recorded %.17g, replayed %.17g", record->result,
+					results[i]);
+			}
+			no_failures++;
+		}
+	}
+
+	printf("\nDifferent results: %.0f, maximal absolute difference: %g, "
+		"maximal relative difference: %g",
+		(double) no_different, error_abs_max, error_rel_max);
+	printf("\nResults exceeding relative tolerance of %g: %.0f",
+		REPLAY_TOLERANCE, (double) no_failures);
+
+	replay_print_latencies("Recorded", latencies_recorded, no_replayed);
+	replay_print_latencies("Replayed", latencies_replayed, no_replayed);
+	printf("\n");
+
+	// Free memory
+	//
+	for (int i = 0; i < traceFile->no_pairs; i++) {
+		delWorkingPair(workingPairs[i]);
+	}
+	delDatabase(database);
+	delTraceFile(traceFile);
+
+	free(functions);
+	free(workingPairs);
+	free(latencies_recorded);
+	free(latencies_replayed);
+	free(results);
+
+	return (no_failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,401 @@
+//////////////////////////////////
+// bench_workingPairSurrogate.c //
+//////////////////////////////////
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "benchmark.h"
+#include "database.h"
+#include "surrogate.h"
+#include "workingPair.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//sorpproplib.json"
+#else
+	#define PATH ".\\data\\sorpproplib.json"
+#endif
+
+#ifndef NO_POINTS
+#define NO_POINTS 20000
+#endif
+
+#ifndef MAX_REL_ERROR
+#define MAX_REL_ERROR 1e-6
+#endif
+
+#ifndef NO_FUNCTIONS
+#define NO_FUNCTIONS 3
+#endif
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+typedef double (*equFunc)(double, double, void*);
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * bench_mix_x_pT:
+ * ---------------
+ *
+ * Calculates liquid mole fraction by abs_mix_x_pT with same signature as
+ * equilibrium functions of adsorption.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_mix_x_pT(double p_Pa, double T_K, void *workingPair) {
+	double y_1_molmol;
+	double y_2_molmol;
+
+	return abs_mix_x_pT(&y_1_molmol, &y_2_molmol, p_Pa, T_K, workingPair);
+}
+
+
+/*
+ * bench_mix_p_xT:
+ * ---------------
+ *
+ * Calculates pressure by abs_mix_p_Tx with same signature as equilibrium
+ * functions of adsorption.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_mix_p_xT(double x_molmol, double T_K, void *workingPair) {
+	double y_1_molmol;
+	double y_2_molmol;
+
+	return abs_mix_p_Tx(&y_1_molmol, &y_2_molmol, T_K, x_molmol, workingPair);
+}
+
+
+/*
+ * bench_mix_T_px:
+ * ---------------
+ *
+ * Calculates temperature by abs_mix_T_px with same signature as equilibrium
+ * functions of adsorption.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_mix_T_px(double p_Pa, double x_molmol, void *workingPair) {
+	double y_1_molmol;
+	double y_2_molmol;
+
+	return abs_mix_T_px(&y_1_molmol, &y_2_molmol, p_Pa, x_molmol, workingPair);
+}
+
+
+/*
+ * bench_function:
+ * ---------------
+ *
+ * Evaluates an equilibrium function with a WorkingPair-struct using original
+ * equations and with a WorkingPair-struct using surrogates. Calculates maximal
+ * relative error of the surrogate and time required per state of both
+ * evaluations.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_time_exact_ns:
+ *		Time required by original equation in ns/state.
+ *	double *ret_time_surrogate_ns:
+ *		Time required by surrogate in ns/state.
+ *	double *tmp_exact:
+ *		Array used to store values of original equation.
+ *	double *tmp_surrogate:
+ *		Array used to store values of surrogate.
+ *	const double *x:
+ *		Array containing first inputs of equilibrium function.
+ *	const double *y:
+ *		Array containing second inputs of equilibrium function.
+ *	equFunc function:
+ *		Equilibrium function of WorkingPair-struct.
+ * 	struct *WorkingPair exact:
+ *		Pointer of WorkingPair-struct using original equations.
+ * 	struct *WorkingPair surrogate:
+ *		Pointer of WorkingPair-struct using surrogates.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns maximal relative error of surrogate.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_function(double *ret_time_exact_ns, double *ret_time_surrogate_ns,
+	double *tmp_exact, double *tmp_surrogate, const double *x, const double *y,
+	equFunc function, WorkingPair *exact, WorkingPair *surrogate) {
+	// Evaluate original equation and surrogate
+	//
+	double time_start = benchmark_time_s();
+	for (int i = 0; i < NO_POINTS; i++) {
+		tmp_exact[i] = function(x[i], y[i], exact);
+	}
+	*ret_time_exact_ns = 1e9 * (benchmark_time_s() - time_start) / NO_POINTS;
+
+	time_start = benchmark_time_s();
+	for (int i = 0; i < NO_POINTS; i++) {
+		tmp_surrogate[i] = function(x[i], y[i], surrogate);
+	}
+	*ret_time_surrogate_ns = 1e9 * (benchmark_time_s() - time_start) /
+		NO_POINTS;
+
+	// Calculate maximal relative error: States whose original equation fails
+	// (i.e., returns -1 or non-finite values) are skipped
+	//
+	double max_error = 0;
+
+	for (int i = 0; i < NO_POINTS; i++) {
+		if (surrogate_finite(tmp_exact[i]) && tmp_exact[i] != -1 &&
+			tmp_exact[i] != 0) {
+			double error = fabs((tmp_surrogate[i] - tmp_exact[i]) /
+				tmp_exact[i]);
+			max_error = (error > max_error || !surrogate_finite(error)) ?
+				error : max_error;
+		}
+	}
+
+	return max_error;
+}
+
+
+/*
+ * bench_fraction_exact:
+ * ---------------------
+ *
+ * Calculates fraction of cells of a surrogate that are evaluated by the
+ * original function.
+ *
+ * Parameters:
+ * -----------
+ * 	const struct *Surrogate2D:
+ *		Pointer of Surrogate2D-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns fraction of cells evaluated by original function.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_fraction_exact(const Surrogate2D *surrogate) {
+	int no_cells = surrogate->no_intervals * surrogate->no_intervals;
+	int no_exact = 0;
+
+	for (int i = 0; i < no_cells; i++) {
+		no_exact += surrogate->exact[i];
+	}
+
+	return (double) no_exact / no_cells;
+}
+
+
+/*
+ * main:
+ * -----
+ *
+ * Reports accuracy and time required to calculate equilibrium properties by
+ * original equations and by surrogates of working pairs. By default, working
+ * pairs with complete ranges of validity in the database are evaluated, as
+ * well as absorption working pairs whose pressure and composition limits are
+ * given below. Alternatively, one working pair with complete range of
+ * validity can be given by the command line arguments "sorbent subtype
+ * refrigerant isotherm no_isotherm". Surrogates are evaluated at random states
+ * within their limits, using logarithmically distributed pressures.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main(int argc, char *argv[]) {
+	// Define working pairs and limits: Negative limits are read from range
+	// of validity of database
+	//
+	const char *wp_as[] = {"mof powder", "zeolite crystal", "zeolite crystal",
+		"activated carbon fiber", "NaOH-KOH-CsOH", "ionic liquid"};
+	const char *wp_st[] = {"cubtc", "5A", "5A", "A-20", "", "[C4mim][NTf2]"};
+	const char *wp_rf[] = {"Propane", "Propane", "Propane", "CarbonDioxide",
+		"Water", "CarbonDioxide"};
+	const char *wp_iso[] = {"DualSiteSips", "Toth", "DubininAstakhov",
+		"Langmuir", "Duehring", "MixingRule"};
+	int no_iso[] = {1, 1, 1, 1, 1, 1};
+	const double p_min_Pa[] = {-1, -1, -1, -1, 500, 1e6};
+	const double p_max_Pa[] = {-1, -1, -1, -1, 5000, 8e6};
+	const double w_min[] = {-1, -1, -1, -1, 0.6, 0.1};
+	const double w_max[] = {-1, -1, -1, -1, 0.85, 0.6};
+	int no_wp = sizeof(wp_as) / sizeof(wp_as[0]);
+
+	if (argc == 6) {
+		wp_as[0] = argv[1];
+		wp_st[0] = argv[2];
+		wp_rf[0] = argv[3];
+		wp_iso[0] = argv[4];
+		no_iso[0] = atoi(argv[5]);
+		no_wp = 1;
+
+	} else if (argc != 1) {
+		printf("\n\nUsage: %s [sorbent subtype refrigerant isotherm "
+			"no_isotherm]\n", argv[0]);
+		return EXIT_FAILURE;
+
+	}
+
+	// Allocate memory
+	//
+	double *x = (double *) malloc(NO_POINTS * sizeof(double));
+	double *y = (double *) malloc(NO_POINTS * sizeof(double));
+	double *tmp_exact = (double *) malloc(NO_POINTS * sizeof(double));
+	double *tmp_surrogate = (double *) malloc(NO_POINTS * sizeof(double));
+
+	if (x == NULL || y == NULL || tmp_exact == NULL || tmp_surrogate == NULL) {
+		printf("\n\nCannot allocate memory for benchmark!");
+		return EXIT_FAILURE;
+	}
+
+	Database *database = newDatabase(PATH);
+
+	if (database == NULL) {
+		return EXIT_FAILURE;
+	}
+
+	printf("\n\n##\n##\nBenchmark: Surrogates of equilibrium functions.");
+	printf("\nNumber of states: %i", NO_POINTS);
+	printf("\nMaximal relative error required: %e", MAX_REL_ERROR);
+
+	for (int i_wp = 0; i_wp < no_wp; i_wp++) {
+		// Create working pairs
+		//
+		WorkingPair *exact = newWorkingPairDatabase(database, wp_as[i_wp],
+			wp_st[i_wp], wp_rf[i_wp], wp_iso[i_wp], no_iso[i_wp],
+			"VaporPressure_EoS1", 1, "SaturatedLiquidDensity_EoS1", 1);
+		WorkingPair *surrogate = cloneWorkingPair(exact);
+
+		if (exact == NULL || surrogate == NULL) {
+			return EXIT_FAILURE;
+		}
+
+		// Create surrogates
+		//
+		double time_start = benchmark_time_s();
+		int error = enableWorkingPairSurrogate(database, p_min_Pa[i_wp],
+			p_max_Pa[i_wp], -1, -1, w_min[i_wp], w_max[i_wp], MAX_REL_ERROR,
+			surrogate);
+		double time_new = benchmark_time_s() - time_start;
+
+		printf("\n\n%s / %s / %s (%s %i):", wp_as[i_wp], wp_st[i_wp],
+			wp_rf[i_wp], wp_iso[i_wp], no_iso[i_wp]);
+
+		if (error != 0) {
+			return EXIT_FAILURE;
+		}
+
+		WorkingPairSurrogate *surrogates = surrogate->surrogates;
+		printf("\np = %.1f - %.1f Pa, T = %.2f - %.2f K, w = %.6f - %.6f",
+			surrogates->p_min_Pa, surrogates->p_max_Pa, surrogates->T_min_K,
+			surrogates->T_max_K, surrogates->w_min, surrogates->w_max);
+		printf("\nCreation of surrogates: %.3f ms", 1e3 * time_new);
+
+		// Select equilibrium functions depending on type of working pair
+		//
+		const char *names[NO_FUNCTIONS] = {"w_pT", "p_wT", "T_pw"};
+		equFunc functions[NO_FUNCTIONS] = {&ads_w_pT, &ads_p_wT, &ads_T_pw};
+		Surrogate2D *fits[NO_FUNCTIONS] = {surrogates->w_pT,
+			surrogates->p_wT, surrogates->T_pw};
+
+		if (exact->absorption != NULL &&
+			exact->absorption->mix_x_pT != NULL) {
+			functions[0] = &bench_mix_x_pT;
+			functions[1] = &bench_mix_p_xT;
+			functions[2] = &bench_mix_T_px;
+
+		} else if (exact->absorption != NULL) {
+			functions[0] = &abs_con_X_pT;
+			functions[1] = &abs_con_p_XT;
+			functions[2] = &abs_con_T_pX;
+
+		}
+
+		// Evaluate functions at random states: Inputs are (p, T), (w, T), and
+		// (p, w)
+		//
+		for (int i_f = 0; i_f < NO_FUNCTIONS; i_f++) {
+			if (fits[i_f] == NULL) {
+				continue;
+			}
+
+			srand(42);
+			for (int i = 0; i < NO_POINTS; i++) {
+				double r_x = (double) rand() / RAND_MAX;
+				double r_y = (double) rand() / RAND_MAX;
+
+				x[i] = (i_f == 1) ? surrogates->w_min + r_x *
+					(surrogates->w_max - surrogates->w_min) :
+					surrogates->p_min_Pa * pow(surrogates->p_max_Pa /
+					surrogates->p_min_Pa, r_x);
+				y[i] = (i_f == 2) ? surrogates->w_min + r_y *
+					(surrogates->w_max - surrogates->w_min) :
+					surrogates->T_min_K + r_y *
+					(surrogates->T_max_K - surrogates->T_min_K);
+			}
+
+			double time_exact_ns;
+			double time_surrogate_ns;
+			double max_error = bench_function(&time_exact_ns,
+				&time_surrogate_ns, tmp_exact, tmp_surrogate, x, y,
+				functions[i_f], exact, surrogate);
+
+			printf("\n%-5s cells: %5i, exact cells: %6.2f %%, exact: %9.2f "
+				"ns/state, surrogate: %8.2f ns/state, speed-up: %7.2f, "
+				"maximal relative error: %e", names[i_f],
+				fits[i_f]->no_intervals * fits[i_f]->no_intervals,
+				100 * bench_fraction_exact(fits[i_f]), time_exact_ns,
+				time_surrogate_ns, time_exact_ns / time_surrogate_ns,
+				max_error);
+		}
+
+		delWorkingPair(exact);
+		delWorkingPair(surrogate);
+	}
+	printf("\n");
+
+	// Free memory
+	//
+	delDatabase(database);
+
+	free(x);
+	free(y);
+	free(tmp_exact);
+	free(tmp_surrogate);
+
+	return EXIT_SUCCESS;
+}
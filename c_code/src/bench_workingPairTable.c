@@ -0,0 +1,521 @@
+//////////////////////////////
+// bench_workingPairTable.c //
+//////////////////////////////
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "benchmark.h"
+#include "database.h"
+#include "spline.h"
+#include "surrogate.h"
+#include "workingPair.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//sorpproplib.json"
+	#define PATH_TABLE ".//test//bench_workingPairTable.json"
+#else
+	#define PATH ".\\data\\sorpproplib.json"
+	#define PATH_TABLE ".\\test\\bench_workingPairTable.json"
+#endif
+
+#ifndef NO_POINTS
+#define NO_POINTS 20000
+#endif
+
+#ifndef NO_NODES
+#define NO_NODES 33
+#endif
+
+#ifndef NO_FUNCTIONS
+#define NO_FUNCTIONS 3
+#endif
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+typedef double (*equFunc)(double, double, void*);
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * bench_mix_x_pT:
+ * ---------------
+ *
+ * Calculates liquid mole fraction by abs_mix_x_pT with same signature as
+ * equilibrium functions of adsorption.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_mix_x_pT(double p_Pa, double T_K, void *workingPair) {
+	double y_1_molmol;
+	double y_2_molmol;
+
+	return abs_mix_x_pT(&y_1_molmol, &y_2_molmol, p_Pa, T_K, workingPair);
+}
+
+
+/*
+ * bench_mix_p_xT:
+ * ---------------
+ *
+ * Calculates pressure by abs_mix_p_Tx with same signature as equilibrium
+ * functions of adsorption.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_mix_p_xT(double x_molmol, double T_K, void *workingPair) {
+	double y_1_molmol;
+	double y_2_molmol;
+
+	return abs_mix_p_Tx(&y_1_molmol, &y_2_molmol, T_K, x_molmol, workingPair);
+}
+
+
+/*
+ * bench_mix_T_px:
+ * ---------------
+ *
+ * Calculates temperature by abs_mix_T_px with same signature as equilibrium
+ * functions of adsorption.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_mix_T_px(double p_Pa, double x_molmol, void *workingPair) {
+	double y_1_molmol;
+	double y_2_molmol;
+
+	return abs_mix_T_px(&y_1_molmol, &y_2_molmol, p_Pa, x_molmol, workingPair);
+}
+
+
+/*
+ * bench_function:
+ * ---------------
+ *
+ * Evaluates an equilibrium function with a WorkingPair-struct using original
+ * equations and the corresponding function tab_* with a WorkingPair-struct
+ * using spline tables. Calculates maximal relative error of the tables and
+ * time required per state of both evaluations.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_time_exact_ns:
+ *		Time required by original equation in ns/state.
+ *	double *ret_time_table_ns:
+ *		Time required by tables in ns/state.
+ *	double *tmp_exact:
+ *		Array used to store values of original equation.
+ *	double *tmp_table:
+ *		Array used to store values of tables.
+ *	const double *x:
+ *		Array containing first inputs of equilibrium function.
+ *	const double *y:
+ *		Array containing second inputs of equilibrium function.
+ *	int function:
+ *		Function (i.e., 0 for w_pT, 1 for p_wT, and 2 for T_pw).
+ *	equFunc *functions:
+ *		Array containing equilibrium functions of WorkingPair-struct.
+ *	equFunc function_table:
+ *		Function tab_* corresponding to equilibrium function.
+ *	double value_min:
+ *		Lower limit of values of equilibrium function.
+ *	double value_max:
+ *		Upper limit of values of equilibrium function.
+ * 	struct *WorkingPair exact:
+ *		Pointer of WorkingPair-struct using original equations.
+ * 	struct *WorkingPair table:
+ *		Pointer of WorkingPair-struct using spline tables.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns maximal relative error of tables.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_function(double *ret_time_exact_ns, double *ret_time_table_ns,
+	double *tmp_exact, double *tmp_table, const double *x, const double *y,
+	int function, equFunc *functions, equFunc function_table,
+	double value_min, double value_max, WorkingPair *exact,
+	WorkingPair *table) {
+	// Evaluate original equation and tables
+	//
+	double time_start = benchmark_time_s();
+	for (int i = 0; i < NO_POINTS; i++) {
+		tmp_exact[i] = functions[function](x[i], y[i], exact);
+	}
+	*ret_time_exact_ns = 1e9 * (benchmark_time_s() - time_start) / NO_POINTS;
+
+	time_start = benchmark_time_s();
+	for (int i = 0; i < NO_POINTS; i++) {
+		tmp_table[i] = function_table(x[i], y[i], table);
+	}
+	*ret_time_table_ns = 1e9 * (benchmark_time_s() - time_start) / NO_POINTS;
+
+	// Calculate maximal relative error: States whose original equation fails
+	// (i.e., returns -1, non-finite values, or values inconsistent with the
+	// inverse function) or whose values are outside of limits are skipped and
+	// marked by -1
+	//
+	double max_error = 0;
+
+	for (int i = 0; i < NO_POINTS; i++) {
+		double check = (function == 0) ?
+			functions[1](tmp_exact[i], y[i], exact) : ((function == 1) ?
+			functions[0](tmp_exact[i], y[i], exact) :
+			functions[0](x[i], tmp_exact[i], exact));
+		double reference = (function == 2) ? y[i] : x[i];
+
+		if (!(fabs(check - reference) <= 1e-4 * reference) ||
+			!(tmp_exact[i] >= value_min && tmp_exact[i] <= value_max)) {
+			tmp_exact[i] = -1;
+		}
+
+		if (surrogate_finite(tmp_exact[i]) && tmp_exact[i] != -1 &&
+			tmp_exact[i] != 0) {
+			double error = fabs((tmp_table[i] - tmp_exact[i]) / tmp_exact[i]);
+			max_error = (error > max_error || !surrogate_finite(error)) ?
+				error : max_error;
+		}
+	}
+
+	return max_error;
+}
+
+
+/*
+ * bench_derivative:
+ * -----------------
+ *
+ * Evaluates both partial derivatives of an equilibrium function with a
+ * WorkingPair-struct using analytical derivatives of the original equations
+ * and with a WorkingPair-struct using spline tables. States skipped by
+ * bench_function are skipped.
+ *
+ * Parameters:
+ * -----------
+ *	const double *tmp_exact:
+ *		Array containing values of original equation.
+ *	const double *x:
+ *		Array containing first inputs of equilibrium function.
+ *	const double *y:
+ *		Array containing second inputs of equilibrium function.
+ *	int function:
+ *		Function (i.e., 0 for w_pT, 1 for p_wT, and 2 for T_pw).
+ * 	struct *WorkingPair exact:
+ *		Pointer of WorkingPair-struct using original equations.
+ * 	struct *WorkingPair table:
+ *		Pointer of WorkingPair-struct using spline tables.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns maximal relative error of partial derivatives of tables.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_derivative(const double *tmp_exact, const double *x,
+	const double *y, int function, WorkingPair *exact, WorkingPair *table) {
+	double max_error = 0;
+
+	for (int i = 0; i < NO_POINTS; i++) {
+		double der_exact[2];
+		double der_table[2];
+
+		if (tmp_exact[i] == -1 ||
+			workingPair_table(&der_exact[0], &der_exact[1], function, x[i],
+			y[i], exact) == -1 ||
+			workingPair_table(&der_table[0], &der_table[1], function, x[i],
+			y[i], table) == -1) {
+			continue;
+		}
+
+		for (int i_d = 0; i_d < 2; i_d++) {
+			if (surrogate_finite(der_exact[i_d]) && der_exact[i_d] != 0) {
+				double error = fabs((der_table[i_d] - der_exact[i_d]) /
+					der_exact[i_d]);
+				max_error = (error > max_error || !surrogate_finite(error)) ?
+					error : max_error;
+			}
+		}
+	}
+
+	return max_error;
+}
+
+
+/*
+ * bench_fraction_valid:
+ * ---------------------
+ *
+ * Calculates fraction of nodes of a spline table that are valid.
+ *
+ * Parameters:
+ * -----------
+ * 	const struct *Spline2D:
+ *		Pointer of Spline2D-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns fraction of valid nodes.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_fraction_valid(const Spline2D *spline) {
+	int no_nodes = spline->no_nodes_x * spline->no_nodes_y;
+	int no_valid = 0;
+
+	for (int i = 0; i < no_nodes; i++) {
+		no_valid += spline->valid[i];
+	}
+
+	return (double) no_valid / no_nodes;
+}
+
+
+/*
+ * main:
+ * -----
+ *
+ * Reports accuracy and time required to calculate equilibrium properties and
+ * their partial derivatives by original equations and by spline tables of
+ * working pairs. Furthermore, tables are exported, loaded by a clone of the
+ * working pair, and checked for identical results. By default, working pairs
+ * with complete ranges of validity in the database are evaluated, as well as
+ * absorption working pairs whose pressure and composition limits are given
+ * below. Alternatively, one working pair with complete range of validity can
+ * be given by the command line arguments "sorbent subtype refrigerant
+ * isotherm no_isotherm". Tables are evaluated at random states within their
+ * limits, using logarithmically distributed pressures. Errors are only
+ * evaluated at states whose results are within the limits, too.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main(int argc, char *argv[]) {
+	// Define working pairs and limits: Negative limits are read from range
+	// of validity of database
+	//
+	const char *wp_as[] = {"mof powder", "zeolite crystal", "zeolite crystal",
+		"activated carbon fiber", "NaOH-KOH-CsOH", "ionic liquid"};
+	const char *wp_st[] = {"cubtc", "5A", "5A", "A-20", "", "[C4mim][NTf2]"};
+	const char *wp_rf[] = {"Propane", "Propane", "Propane", "CarbonDioxide",
+		"Water", "CarbonDioxide"};
+	const char *wp_iso[] = {"DualSiteSips", "Toth", "DubininAstakhov",
+		"Langmuir", "Duehring", "MixingRule"};
+	int no_iso[] = {1, 1, 1, 1, 1, 1};
+	const double p_min_Pa[] = {-1, -1, -1, -1, 500, 1e6};
+	const double p_max_Pa[] = {-1, -1, -1, -1, 5000, 8e6};
+	const double w_min[] = {-1, -1, -1, -1, 0.6, 0.1};
+	const double w_max[] = {-1, -1, -1, -1, 0.85, 0.6};
+	int no_wp = sizeof(wp_as) / sizeof(wp_as[0]);
+
+	if (argc == 6) {
+		wp_as[0] = argv[1];
+		wp_st[0] = argv[2];
+		wp_rf[0] = argv[3];
+		wp_iso[0] = argv[4];
+		no_iso[0] = atoi(argv[5]);
+		no_wp = 1;
+
+	} else if (argc != 1) {
+		printf("\n\nUsage: %s [sorbent subtype refrigerant isotherm "
+			"no_isotherm]\n", argv[0]);
+		return EXIT_FAILURE;
+
+	}
+
+	// Allocate memory
+	//
+	double *x = (double *) malloc(NO_POINTS * sizeof(double));
+	double *y = (double *) malloc(NO_POINTS * sizeof(double));
+	double *tmp_exact = (double *) malloc(NO_POINTS * sizeof(double));
+	double *tmp_table = (double *) malloc(NO_POINTS * sizeof(double));
+
+	if (x == NULL || y == NULL || tmp_exact == NULL || tmp_table == NULL) {
+		printf("\n\nCannot allocate memory for benchmark!");
+		return EXIT_FAILURE;
+	}
+
+	Database *database = newDatabase(PATH);
+
+	if (database == NULL) {
+		return EXIT_FAILURE;
+	}
+
+	printf("\n\n##\n##\nBenchmark: Spline tables of equilibrium functions.");
+	printf("\nNumber of states: %i", NO_POINTS);
+	printf("\nNumber of nodes per variable: %i", NO_NODES);
+
+	for (int i_wp = 0; i_wp < no_wp; i_wp++) {
+		// Create working pairs
+		//
+		WorkingPair *exact = newWorkingPairDatabase(database, wp_as[i_wp],
+			wp_st[i_wp], wp_rf[i_wp], wp_iso[i_wp], no_iso[i_wp],
+			"VaporPressure_EoS1", 1, "SaturatedLiquidDensity_EoS1", 1);
+		WorkingPair *table = cloneWorkingPair(exact);
+		WorkingPair *loaded = cloneWorkingPair(exact);
+
+		if (exact == NULL || table == NULL || loaded == NULL) {
+			return EXIT_FAILURE;
+		}
+
+		// Create, export, and load tables
+		//
+		double time_start = benchmark_time_s();
+		int error = enableWorkingPairTable(database, p_min_Pa[i_wp],
+			p_max_Pa[i_wp], -1, -1, w_min[i_wp], w_max[i_wp], NO_NODES,
+			table);
+		double time_new = benchmark_time_s() - time_start;
+
+		printf("\n\n%s / %s / %s (%s %i):", wp_as[i_wp], wp_st[i_wp],
+			wp_rf[i_wp], wp_iso[i_wp], no_iso[i_wp]);
+
+		if (error != 0) {
+			return EXIT_FAILURE;
+		}
+
+		time_start = benchmark_time_s();
+		if (exportWorkingPairTable(PATH_TABLE, table) != 0 ||
+			loadWorkingPairTable(PATH_TABLE, loaded) != 0) {
+			return EXIT_FAILURE;
+		}
+		double time_io = benchmark_time_s() - time_start;
+		remove(PATH_TABLE);
+
+		WorkingPairTable *tables = table->tables;
+		printf("\np = %.1f - %.1f Pa, T = %.2f - %.2f K, w = %.6f - %.6f",
+			tables->p_min_Pa, tables->p_max_Pa, tables->T_min_K,
+			tables->T_max_K, tables->w_min, tables->w_max);
+		printf("\nCreation of tables: %.3f ms, export and loading of tables: "
+			"%.3f ms", 1e3 * time_new, 1e3 * time_io);
+
+		// Select equilibrium functions depending on type of working pair
+		//
+		const char *names[NO_FUNCTIONS] = {"w_pT", "p_wT", "T_pw"};
+		equFunc functions[NO_FUNCTIONS] = {&ads_w_pT, &ads_p_wT, &ads_T_pw};
+		equFunc functions_table[NO_FUNCTIONS] = {&tab_w_pT, &tab_p_wT,
+			&tab_T_pw};
+		Spline2D *splines[NO_FUNCTIONS] = {tables->w_pT, tables->p_wT,
+			tables->T_pw};
+		double values_min[NO_FUNCTIONS] = {tables->w_min, tables->p_min_Pa,
+			tables->T_min_K};
+		double values_max[NO_FUNCTIONS] = {tables->w_max, tables->p_max_Pa,
+			tables->T_max_K};
+
+		if (exact->absorption != NULL &&
+			exact->absorption->mix_x_pT != NULL) {
+			functions[0] = &bench_mix_x_pT;
+			functions[1] = &bench_mix_p_xT;
+			functions[2] = &bench_mix_T_px;
+
+		} else if (exact->absorption != NULL) {
+			functions[0] = &abs_con_X_pT;
+			functions[1] = &abs_con_p_XT;
+			functions[2] = &abs_con_T_pX;
+
+		}
+
+		// Evaluate functions at random states: Inputs are (p, T), (w, T), and
+		// (p, w)
+		//
+		for (int i_f = 0; i_f < NO_FUNCTIONS; i_f++) {
+			if (splines[i_f] == NULL) {
+				continue;
+			}
+
+			srand(42);
+			for (int i = 0; i < NO_POINTS; i++) {
+				double r_x = (double) rand() / RAND_MAX;
+				double r_y = (double) rand() / RAND_MAX;
+
+				x[i] = (i_f == 1) ? tables->w_min + r_x *
+					(tables->w_max - tables->w_min) :
+					tables->p_min_Pa * pow(tables->p_max_Pa /
+					tables->p_min_Pa, r_x);
+				y[i] = (i_f == 2) ? tables->w_min + r_y *
+					(tables->w_max - tables->w_min) :
+					tables->T_min_K + r_y *
+					(tables->T_max_K - tables->T_min_K);
+			}
+
+			double time_exact_ns;
+			double time_table_ns;
+			double max_error = bench_function(&time_exact_ns,
+				&time_table_ns, tmp_exact, tmp_table, x, y, i_f, functions,
+				functions_table[i_f], values_min[i_f], values_max[i_f], exact,
+				table);
+			double max_error_der = bench_derivative(tmp_exact, x, y, i_f,
+				exact, table);
+
+			// Check that loaded tables give identical results
+			//
+			int no_different = 0;
+
+			for (int i = 0; i < NO_POINTS; i++) {
+				no_different += (functions_table[i_f](x[i], y[i], loaded) !=
+					tmp_table[i]);
+			}
+
+			printf("\n%-5s valid nodes: %6.2f %%, exact: %9.2f ns/state, "
+				"table: %8.2f ns/state, speed-up: %7.2f, maximal relative "
+				"error: %e, maximal relative error of derivatives: %e, "
+				"different states after loading: %i", names[i_f],
+				100 * bench_fraction_valid(splines[i_f]), time_exact_ns,
+				time_table_ns, time_exact_ns / time_table_ns, max_error,
+				max_error_der, no_different);
+		}
+
+		delWorkingPair(exact);
+		delWorkingPair(table);
+		delWorkingPair(loaded);
+	}
+	printf("\n");
+
+	// Free memory
+	//
+	delDatabase(database);
+
+	free(x);
+	free(y);
+	free(tmp_exact);
+	free(tmp_table);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,634 @@
+////////////////////////////////
+// bench_workingPairThreads.c //
+////////////////////////////////
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef __unix
+#include <unistd.h>
+#endif
+#include "benchmark.h"
+#include "database.h"
+#include "workingPair.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//sorpproplib.json"
+#else
+	#define PATH ".\\data\\sorpproplib.json"
+#endif
+
+#ifndef NO_POINTS
+#define NO_POINTS 4000
+#endif
+
+#ifndef NO_REPETITIONS
+#define NO_REPETITIONS 5
+#endif
+
+#ifndef NO_THREADS_DEFAULT
+#define NO_THREADS_DEFAULT 64
+#endif
+
+#ifndef NO_FUNCTIONS
+#define NO_FUNCTIONS 7
+#endif
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+typedef double (*equFunc)(double, double, void*);
+
+
+///////////////////////////
+// Definition of structs //
+///////////////////////////
+/*
+ * BenchTask:
+ * ----------
+ *
+ * Contains inputs and outputs of one thread of the benchmark. All threads
+ * share inputs, outputs, and WorkingPair-struct, but write different parts of
+ * the outputs.
+ *
+ * Attributes:
+ * -----------
+ *	int i_start:
+ *		First state evaluated by thread.
+ *	int i_end:
+ *		State after last state evaluated by thread.
+ *	const double *x:
+ *		Array containing first inputs of functions.
+ *	const double *y:
+ *		Array containing second inputs of functions.
+ *	double *results:
+ *		Array containing results of all functions (i.e., results of function
+ *		i_f at state i are stored at index i_f * NO_POINTS + i).
+ *	equFunc *functions:
+ *		Array containing functions (i.e., NULL if function is skipped).
+ *	WorkingPair *workingPair:
+ *		Pointer of WorkingPair-struct shared by all threads.
+ *
+ *	Database *database:
+ *		Pointer of Database-struct shared by all threads (i.e., only used to
+ *		construct working pairs).
+ *	int i_wp:
+ *		Index of working pair constructed by thread.
+ *	WorkingPair *constructed:
+ *		Pointer of WorkingPair-struct constructed by thread.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct BenchTask BenchTask;
+
+struct BenchTask {
+	int i_start;
+	int i_end;
+	const double *x;
+	const double *y;
+	double *results;
+	equFunc *functions;
+	WorkingPair *workingPair;
+
+	Database *database;
+	int i_wp;
+	WorkingPair *constructed;
+};
+
+
+/////////////////////////////////
+// Definition of working pairs //
+/////////////////////////////////
+static const char *wp_as[] = {"mof powder", "zeolite crystal",
+	"zeolite crystal", "activated carbon fiber", "NaOH-KOH-CsOH",
+	"ionic liquid"};
+static const char *wp_st[] = {"cubtc", "5A", "5A", "A-20", "",
+	"[C4mim][NTf2]"};
+static const char *wp_rf[] = {"Propane", "Propane", "Propane",
+	"CarbonDioxide", "Water", "CarbonDioxide"};
+static const char *wp_iso[] = {"DualSiteSips", "Toth", "DubininAstakhov",
+	"Langmuir", "Duehring", "MixingRule"};
+static const double p_min_Pa[] = {1e3, 1e3, 1e3, 1e3, 500, 1e6};
+static const double p_max_Pa[] = {1e5, 1e5, 1e5, 1e5, 5000, 5e6};
+static const double T_min_K[] = {273.15, 273.15, 273.15, 273.15, 293.15,
+	313.15};
+static const double T_max_K[] = {353.15, 353.15, 353.15, 353.15, 353.15,
+	323.15};
+
+#define NO_WORKINGPAIRS ((int) (sizeof(wp_as) / sizeof(wp_as[0])))
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * bench_mix_x_pT:
+ * ---------------
+ *
+ * Calculates liquid mole fraction by abs_mix_x_pT with same signature as
+ * equilibrium functions of adsorption.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_mix_x_pT(double p_Pa, double T_K, void *workingPair) {
+	double y_1_molmol;
+	double y_2_molmol;
+
+	return abs_mix_x_pT(&y_1_molmol, &y_2_molmol, p_Pa, T_K, workingPair);
+}
+
+
+/*
+ * bench_mix_p_xT:
+ * ---------------
+ *
+ * Calculates pressure by abs_mix_p_Tx with same signature as equilibrium
+ * functions of adsorption.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_mix_p_xT(double x_molmol, double T_K, void *workingPair) {
+	double y_1_molmol;
+	double y_2_molmol;
+
+	return abs_mix_p_Tx(&y_1_molmol, &y_2_molmol, T_K, x_molmol, workingPair);
+}
+
+
+/*
+ * bench_mix_dp_dx_xT:
+ * -------------------
+ *
+ * Calculates derivative of pressure wrt. liquid mole fraction by
+ * abs_mix_dp_dx_Tx with same signature as equilibrium functions of
+ * adsorption.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_mix_dp_dx_xT(double x_molmol, double T_K, void *workingPair) {
+	return abs_mix_dp_dx_Tx(T_K, x_molmol, workingPair);
+}
+
+
+/*
+ * bench_mix_dp_dT_xT:
+ * -------------------
+ *
+ * Calculates derivative of pressure wrt. temperature by abs_mix_dp_dT_Tx with
+ * same signature as equilibrium functions of adsorption.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_mix_dp_dT_xT(double x_molmol, double T_K, void *workingPair) {
+	return abs_mix_dp_dT_Tx(T_K, x_molmol, workingPair);
+}
+
+
+/*
+ * bench_p_sat_T:
+ * --------------
+ *
+ * Calculates vapor pressure by ref_p_sat_T with same signature as equilibrium
+ * functions of adsorption. First input is ignored.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_p_sat_T(double x, double T_K, void *workingPair) {
+	(void) x;
+	return ref_p_sat_T(T_K, workingPair);
+}
+
+
+/*
+ * bench_rho_l_T:
+ * --------------
+ *
+ * Calculates saturated liquid density by ref_rho_l_T with same signature as
+ * equilibrium functions of adsorption. First input is ignored.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_rho_l_T(double x, double T_K, void *workingPair) {
+	(void) x;
+	return ref_rho_l_T(T_K, workingPair);
+}
+
+
+/*
+ * bench_evaluate:
+ * ---------------
+ *
+ * Thread function that evaluates all functions at states of its task
+ * NO_REPETITIONS times. Functions with indices 1, 3, and 4 use loadings,
+ * concentrations, or mole fractions and temperatures, and function with index
+ * 2 uses pressures and loadings, concentrations, or mole fractions. Loadings,
+ * concentrations, or mole fractions are calculated by function with index 0
+ * beforehand.
+ *
+ * Parameters:
+ * -----------
+ *	void *task:
+ *		Pointer of BenchTask-struct.
+ *
+ * Returns:
+ * --------
+ *	void *:
+ *		Returns NULL.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void *bench_evaluate(void *task) {
+	BenchTask *retTask = (BenchTask *) task;
+	double *w = retTask->results;
+
+	for (int i_r = 0; i_r < NO_REPETITIONS; i_r++) {
+		for (int i = retTask->i_start; i < retTask->i_end; i++) {
+			double p_Pa = retTask->x[i];
+			double T_K = retTask->y[i];
+
+			w[i] = retTask->functions[0](p_Pa, T_K, retTask->workingPair);
+			for (int i_f = 1; i_f < NO_FUNCTIONS; i_f++) {
+				double x = (i_f == 1 || i_f == 3 || i_f == 4) ? w[i] : p_Pa;
+				double y = (i_f == 2) ? w[i] : T_K;
+
+				retTask->results[i_f * NO_POINTS + i] =
+					(retTask->functions[i_f] == NULL) ? 0 :
+					retTask->functions[i_f](x, y, retTask->workingPair);
+			}
+		}
+	}
+
+	return NULL;
+}
+
+
+/*
+ * bench_construct:
+ * ----------------
+ *
+ * Thread function that constructs the working pair of its task using the
+ * database shared by all threads.
+ *
+ * Parameters:
+ * -----------
+ *	void *task:
+ *		Pointer of BenchTask-struct.
+ *
+ * Returns:
+ * --------
+ *	void *:
+ *		Returns NULL.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void *bench_construct(void *task) {
+	BenchTask *retTask = (BenchTask *) task;
+	int i_wp = retTask->i_wp;
+
+	retTask->constructed = newWorkingPairDatabase(retTask->database,
+		wp_as[i_wp], wp_st[i_wp], wp_rf[i_wp], wp_iso[i_wp], 1,
+		"VaporPressure_EoS1", 1, "SaturatedLiquidDensity_EoS1", 1);
+
+	return NULL;
+}
+
+
+/*
+ * bench_run:
+ * ----------
+ *
+ * Evaluates all functions at all states by several threads sharing one
+ * WorkingPair-struct. States are divided into contiguous blocks of equal size.
+ *
+ * Parameters:
+ * -----------
+ *	double *results:
+ *		Array used to store results of all functions.
+ *	const double *x:
+ *		Array containing pressures.
+ *	const double *y:
+ *		Array containing temperatures.
+ *	equFunc *functions:
+ *		Array containing functions.
+ *	int no_threads:
+ *		Number of threads.
+ *	BenchTask *tasks:
+ *		Array used to store tasks of threads.
+ *	pthread_t *threads:
+ *		Array used to store threads.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct shared by all threads.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns time required in s or -1 if threads cannot be created.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_run(double *results, const double *x, const double *y,
+	equFunc *functions, int no_threads, BenchTask *tasks, pthread_t *threads,
+	WorkingPair *workingPair) {
+	double time_start = benchmark_time_s();
+
+	for (int i_t = 0; i_t < no_threads; i_t++) {
+		tasks[i_t].i_start = (int) ((long) NO_POINTS * i_t / no_threads);
+		tasks[i_t].i_end = (int) ((long) NO_POINTS * (i_t + 1) / no_threads);
+		tasks[i_t].x = x;
+		tasks[i_t].y = y;
+		tasks[i_t].results = results;
+		tasks[i_t].functions = functions;
+		tasks[i_t].workingPair = workingPair;
+
+		if (pthread_create(&threads[i_t], NULL, &bench_evaluate,
+			&tasks[i_t]) != 0) {
+			for (int i_j = 0; i_j < i_t; i_j++) {
+				pthread_join(threads[i_j], NULL);
+			}
+			return -1;
+		}
+	}
+
+	for (int i_t = 0; i_t < no_threads; i_t++) {
+		pthread_join(threads[i_t], NULL);
+	}
+
+	return benchmark_time_s() - time_start;
+}
+
+
+/*
+ * main:
+ * -----
+ *
+ * Stress test and scaling benchmark of working pairs shared by several
+ * threads. First, all threads construct working pairs from one database at the
+ * same time and results are compared to a working pair constructed by one
+ * thread. Afterwards, one WorkingPair-struct per working pair is shared by
+ * 1 to N threads that evaluate equilibrium functions, their partial
+ * derivatives, and refrigerant functions at random states. Results of all
+ * numbers of threads must be bit-identical to results of one thread. The
+ * maximal number of threads N can be given by the command line argument
+ * "no_threads" and is the number of processors otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main(int argc, char *argv[]) {
+	// Get maximal number of threads
+	//
+	int no_threads_max = NO_THREADS_DEFAULT;
+
+#ifdef __unix
+	no_threads_max = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	no_threads_max = (no_threads_max < 1) ? 1 : no_threads_max;
+#endif
+
+	if (argc == 2) {
+		no_threads_max = atoi(argv[1]);
+
+	} else if (argc != 1) {
+		printf("\n\nUsage: %s [no_threads]\n", argv[0]);
+		return EXIT_FAILURE;
+
+	}
+
+	if (no_threads_max < 1 || no_threads_max > NO_POINTS) {
+		printf("\n\nNumber of threads must be between 1 and %i!", NO_POINTS);
+		return EXIT_FAILURE;
+	}
+
+	// Allocate memory
+	//
+	size_t no_results = (size_t) NO_FUNCTIONS * NO_POINTS;
+	double *x = (double *) malloc(NO_POINTS * sizeof(double));
+	double *y = (double *) malloc(NO_POINTS * sizeof(double));
+	double *reference = (double *) malloc(no_results * sizeof(double));
+	double *results = (double *) malloc(no_results * sizeof(double));
+	double *check = (double *) malloc(no_results * sizeof(double));
+	BenchTask *tasks = (BenchTask *) calloc(no_threads_max,
+		sizeof(BenchTask));
+	pthread_t *threads = (pthread_t *) malloc(no_threads_max *
+		sizeof(pthread_t));
+
+	if (x == NULL || y == NULL || reference == NULL || results == NULL ||
+		check == NULL || tasks == NULL || threads == NULL) {
+		printf("\n\nCannot allocate memory for benchmark!");
+		return EXIT_FAILURE;
+	}
+
+	Database *database = newDatabase(PATH);
+
+	if (database == NULL) {
+		return EXIT_FAILURE;
+	}
+
+	printf("\n\n##\n##\nBenchmark: Working pairs shared by several threads.");
+	printf("\nNumber of states: %i", NO_POINTS);
+	printf("\nNumber of repetitions: %i", NO_REPETITIONS);
+	printf("\nMaximal number of threads: %i", no_threads_max);
+
+	int no_failures = 0;
+
+	for (int i_wp = 0; i_wp < NO_WORKINGPAIRS; i_wp++) {
+		// Create working pair shared by all threads
+		//
+		WorkingPair *workingPair = newWorkingPairDatabase(database,
+			wp_as[i_wp], wp_st[i_wp], wp_rf[i_wp], wp_iso[i_wp], 1,
+			"VaporPressure_EoS1", 1, "SaturatedLiquidDensity_EoS1", 1);
+
+		if (workingPair == NULL) {
+			return EXIT_FAILURE;
+		}
+
+		printf("\n\n%s / %s / %s (%s 1):", wp_as[i_wp], wp_st[i_wp],
+			wp_rf[i_wp], wp_iso[i_wp]);
+
+		// Select functions depending on type of working pair: Functions 0 to
+		// 2 are equilibrium functions, functions 3 and 4 are partial
+		// derivatives, and functions 5 and 6 are refrigerant functions. For
+		// mixing rules, temperature is not calculated as its iteration often
+		// does not converge and would dominate the benchmark
+		//
+		equFunc functions[NO_FUNCTIONS] = {&ads_w_pT, &ads_p_wT, &ads_T_pw,
+			&ads_dp_dw_wT, &ads_dp_dT_wT, &bench_p_sat_T, &bench_rho_l_T};
+
+		if (workingPair->absorption != NULL &&
+			workingPair->absorption->mix_x_pT != NULL) {
+			functions[0] = &bench_mix_x_pT;
+			functions[1] = &bench_mix_p_xT;
+			functions[2] = NULL;
+			functions[3] = &bench_mix_dp_dx_xT;
+			functions[4] = &bench_mix_dp_dT_xT;
+
+		} else if (workingPair->absorption != NULL) {
+			functions[0] = &abs_con_X_pT;
+			functions[1] = &abs_con_p_XT;
+			functions[2] = &abs_con_T_pX;
+			functions[3] = &abs_con_dp_dX_XT;
+			functions[4] = &abs_con_dp_dT_XT;
+
+		}
+
+		// Generate random states using logarithmically distributed pressures
+		//
+		srand(42);
+		for (int i = 0; i < NO_POINTS; i++) {
+			double r_x = (double) rand() / RAND_MAX;
+			double r_y = (double) rand() / RAND_MAX;
+
+			x[i] = p_min_Pa[i_wp] * pow(p_max_Pa[i_wp] / p_min_Pa[i_wp], r_x);
+			y[i] = T_min_K[i_wp] + r_y * (T_max_K[i_wp] - T_min_K[i_wp]);
+		}
+
+		// Construct working pair by all threads at the same time and compare
+		// results with working pair constructed by one thread
+		//
+		for (int i_t = 0; i_t < no_threads_max; i_t++) {
+			tasks[i_t].database = database;
+			tasks[i_t].i_wp = i_wp;
+			tasks[i_t].constructed = NULL;
+
+			if (pthread_create(&threads[i_t], NULL, &bench_construct,
+				&tasks[i_t]) != 0) {
+				printf("\n\nCannot create threads for benchmark!");
+				return EXIT_FAILURE;
+			}
+		}
+
+		for (int i_t = 0; i_t < no_threads_max; i_t++) {
+			pthread_join(threads[i_t], NULL);
+		}
+
+		BenchTask task_single = {0, NO_POINTS, x, y, NULL, functions, NULL,
+			NULL, 0, NULL};
+		int no_different_construction = 0;
+
+		task_single.results = reference;
+		task_single.workingPair = workingPair;
+		bench_evaluate(&task_single);
+
+		for (int i_t = 0; i_t < no_threads_max; i_t++) {
+			WorkingPair *constructed = tasks[i_t].constructed;
+
+			if (constructed == NULL || constructed->refrigerant_parameters !=
+				workingPair->refrigerant_parameters) {
+				no_different_construction++;
+
+			} else {
+				task_single.results = check;
+				task_single.workingPair = constructed;
+				bench_evaluate(&task_single);
+				no_different_construction += (memcmp(reference, check,
+					no_results * sizeof(double)) != 0);
+
+			}
+			delWorkingPair(constructed);
+		}
+
+		printf("\nConstruction by %i threads: %i different working pairs",
+			no_threads_max, no_different_construction);
+		no_failures += no_different_construction;
+
+		// Evaluate functions by 1 to N threads: Numbers of threads are powers
+		// of two and maximal number of threads
+		//
+		double time_single_s = -1;
+
+		for (int no_threads = 1; no_threads <= no_threads_max;
+			no_threads = (2 * no_threads > no_threads_max &&
+			no_threads < no_threads_max) ? no_threads_max : 2 * no_threads) {
+			memset(results, 0, no_results * sizeof(double));
+
+			double time_s = bench_run(results, x, y, functions, no_threads,
+				tasks, threads, workingPair);
+
+			if (time_s < 0) {
+				printf("\n\nCannot create threads for benchmark!");
+				return EXIT_FAILURE;
+			}
+
+			int no_different = 0;
+
+			for (size_t i = 0; i < no_results; i++) {
+				no_different += (memcmp(&reference[i], &results[i],
+					sizeof(double)) != 0);
+			}
+			no_failures += no_different;
+
+			time_single_s = (no_threads == 1) ? time_s : time_single_s;
+			printf("\nThreads: %3i, throughput: %10.3f Mcalls/s, speed-up: "
+				"%6.2f, efficiency: %6.2f %%, different results: %i",
+				no_threads, 1e-6 * NO_REPETITIONS * no_results / time_s,
+				time_single_s / time_s,
+				100 * time_single_s / time_s / no_threads, no_different);
+		}
+
+		delWorkingPair(workingPair);
+	}
+	printf("\n\nTotal number of failures: %i\n", no_failures);
+
+	// Free memory
+	//
+	delDatabase(database);
+
+	free(x);
+	free(y);
+	free(reference);
+	free(results);
+	free(check);
+	free(tasks);
+	free(threads);
+
+	return (no_failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
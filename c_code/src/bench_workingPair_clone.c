@@ -0,0 +1,141 @@
+///////////////////////////////
+// bench_workingPair_clone.c //
+///////////////////////////////
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "benchmark.h"
+#include "workingPair.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//SorpPropLib_MinimalExample.json"
+#else
+	#define PATH ".\\data\\SorpPropLib_MinimalExample.json"
+#endif
+
+#ifndef NO_COPIES
+#define NO_COPIES 256
+#endif
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * main:
+ * -----
+ *
+ * Compares time required to create working pairs by reading the database,
+ * by cloning an existing working pair, and by deserializing a byte array.
+ * Furthermore, checks that all copies calculate identical equilibrium
+ * properties.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main() {
+	// Allocate memory
+	//
+	WorkingPair **workingPairs = (WorkingPair **) malloc(NO_COPIES *
+		sizeof(WorkingPair *));
+
+	if (workingPairs == NULL) {
+		printf("\n\nCannot allocate memory for benchmark!");
+		return EXIT_FAILURE;
+	}
+
+	// Create working pairs by reading the database
+	//
+	double time_start = benchmark_time_s();
+	for (int i = 0; i < NO_COPIES; i++) {
+		workingPairs[i] = newWorkingPair(PATH, "silicagel", "123", "water",
+			"DubininArctan1", 1, "VaporPressure_EoS1", 1,
+			"SaturatedLiquidDensity_EoS1", 1);
+	}
+	double time_new = benchmark_time_s() - time_start;
+
+	WorkingPair *original = workingPairs[0];
+	for (int i = 1; i < NO_COPIES; i++) {
+		delWorkingPair(workingPairs[i]);
+	}
+
+	// Create working pairs by cloning
+	//
+	time_start = benchmark_time_s();
+	for (int i = 1; i < NO_COPIES; i++) {
+		workingPairs[i] = cloneWorkingPair(original);
+	}
+	double time_clone = benchmark_time_s() - time_start;
+
+	// Check results of clones and free clones
+	//
+	double p_Pa = 1000;
+	double T_K = 303.15;
+	double w_kgkg = ads_w_pT(p_Pa, T_K, original);
+	double max_diff_clone = 0;
+
+	for (int i = 1; i < NO_COPIES; i++) {
+		double diff = fabs(ads_w_pT(p_Pa, T_K, workingPairs[i]) - w_kgkg);
+		max_diff_clone = (diff > max_diff_clone) ? diff : max_diff_clone;
+		delWorkingPair(workingPairs[i]);
+	}
+
+	// Create working pairs by deserializing a byte array
+	//
+	size_t size_blob = serializeWorkingPair(NULL, 0, original);
+	unsigned char *blob = (unsigned char *) malloc(size_blob);
+
+	if (blob == NULL || serializeWorkingPair(blob, size_blob, original) == 0) {
+		printf("\n\nCannot serialize working pair!");
+		return EXIT_FAILURE;
+	}
+
+	time_start = benchmark_time_s();
+	for (int i = 1; i < NO_COPIES; i++) {
+		workingPairs[i] = deserializeWorkingPair(blob, size_blob);
+	}
+	double time_deserialize = benchmark_time_s() - time_start;
+
+	// Check results of deserialized working pairs and free them
+	//
+	double max_diff_deserialize = 0;
+
+	for (int i = 1; i < NO_COPIES; i++) {
+		double diff = fabs(ads_w_pT(p_Pa, T_K, workingPairs[i]) - w_kgkg);
+		max_diff_deserialize = (diff > max_diff_deserialize) ? diff :
+			max_diff_deserialize;
+		delWorkingPair(workingPairs[i]);
+	}
+
+	// Print results
+	//
+	printf("\n\n##\n##\nBenchmark: Creation of working pairs.");
+	printf("\nNumber of working pairs: %i", NO_COPIES);
+	printf("\nSize of serialized working pair: %zu bytes", size_blob);
+	printf("\n\nnewWorkingPair: %.3f us/call",
+		1e6 * time_new / NO_COPIES);
+	printf("\ncloneWorkingPair: %.3f us/call",
+		1e6 * time_clone / (NO_COPIES - 1));
+	printf("\ndeserializeWorkingPair: %.3f us/call",
+		1e6 * time_deserialize / (NO_COPIES - 1));
+	printf("\n\nMaximal absolute difference of loadings (clone): %e",
+		max_diff_clone);
+	printf("\nMaximal absolute difference of loadings (deserialize): %e\n",
+		max_diff_deserialize);
+
+	// Free memory
+	//
+	delWorkingPair(original);
+	free(workingPairs);
+	free(blob);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,197 @@
+/////////////////////////////////
+// bench_workingPair_compact.c //
+/////////////////////////////////
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "benchmark.h"
+#include "workingPair.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//SorpPropLib_MinimalExample.json"
+#else
+	#define PATH ".\\data\\SorpPropLib_MinimalExample.json"
+#endif
+
+#ifndef NO_COPIES
+#define NO_COPIES 128
+#endif
+
+#ifndef NO_ROUNDS
+#define NO_ROUNDS 200
+#endif
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * bench_roundRobin:
+ * -----------------
+ *
+ * Evaluates equilibrium loading of all working pairs round-robin, i.e. every
+ * working pair is evaluated once before the first working pair is evaluated
+ * again.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_w_kgkg:
+ *		Array containing equilibrium loadings of last round.
+ * 	WorkingPair **workingPairs:
+ *		Array containing working pairs.
+ *	int no_wp:
+ *		Number of working pairs.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns elapsed time in s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_roundRobin(double *ret_w_kgkg, WorkingPair **workingPairs,
+	int no_wp) {
+	double time_start = benchmark_time_s();
+
+	for (int round = 0; round < NO_ROUNDS; round++) {
+		// Vary state slightly every round to avoid that compiler hoists calls
+		//
+		double p_Pa = 1000 + 10 * (round % 100);
+		double T_K = 303.15 + 0.1 * (round % 50);
+
+		for (int i = 0; i < no_wp; i++) {
+			ret_w_kgkg[i] = ads_w_pT(p_Pa, T_K, workingPairs[i]);
+		}
+	}
+
+	return benchmark_time_s() - time_start;
+}
+
+
+/*
+ * main:
+ * -----
+ *
+ * Creates many working pairs with standard and compact memory layout and
+ * compares time required to evaluate all working pairs round-robin.
+ *
+ * Remarks:
+ * --------
+ *	Cache misses are not counted by this program. To count cache misses, run
+ *	program with a hardware counter tool (e.g., 'perf stat -e cache-misses').
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main() {
+	// Define working pairs that are evaluated round-robin
+	//
+	const char *wp_as[] = {"mof", "mof", "carbon", "carbon", "carbon", "carbon",
+		"carbon", "zeolite", "zeolite", "silicagel", "zeolite", "zeolite",
+		"silicagel", "silicagel"};
+	const char *wp_st[] = {"cubtc", "cubtc", "norit-rb1", "norit-rb1",
+		"maxsorb-iii", "maxsorb-iii", "acf-a-20", "5a", "13x", "", "5a", "13x",
+		"", "123"};
+	const char *wp_rf[] = {"propane", "isobutane", "carbonDioxide", "methane",
+		"R-134a", "propane", "R-134a", "water", "water", "water",
+		"carbonDioxide", "carbonDioxide", "carbonDioxide", "water"};
+	const char *wp_iso[] = {"DualSiteSips", "DualSiteSips", "Langmuir",
+		"Langmuir", "DubininAstakhov", "DubininAstakhov", "DubininAstakhov",
+		"Toth", "Toth", "Toth", "Toth", "Toth", "Toth", "DubininArctan1"};
+	int no_types = sizeof(wp_as) / sizeof(wp_as[0]);
+	int no_wp = no_types * NO_COPIES;
+
+	// Allocate memory
+	//
+	WorkingPair **wp_standard = (WorkingPair **) malloc(no_wp *
+		sizeof(WorkingPair *));
+	WorkingPair **wp_compact = (WorkingPair **) malloc(no_wp *
+		sizeof(WorkingPair *));
+	double *w_standard = (double *) malloc(no_wp * sizeof(double));
+	double *w_compact = (double *) malloc(no_wp * sizeof(double));
+
+	if (wp_standard == NULL || wp_compact == NULL || w_standard == NULL ||
+		w_compact == NULL) {
+		printf("\n\nCannot allocate memory for benchmark!");
+		return EXIT_FAILURE;
+	}
+
+	// Create working pairs: Standard and compact working pairs are created
+	// alternately like in an application creating many working pairs
+	//
+	for (int i = 0; i < no_wp; i++) {
+		int type = i % no_types;
+
+		wp_standard[i] = newWorkingPair(PATH, wp_as[type], wp_st[type],
+			wp_rf[type], wp_iso[type], 1, "VaporPressure_EoS1", 1,
+			"SaturatedLiquidDensity_EoS1", 1);
+		if (wp_standard[i] == NULL) {
+			printf("\n\nCannot create working pair %s/%s/%s!", wp_as[type],
+				wp_st[type], wp_rf[type]);
+			return EXIT_FAILURE;
+		}
+
+		wp_compact[i] = copy_workingPair_compact(wp_standard[i]);
+		if (wp_compact[i] == NULL) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	// Warm up and run benchmark
+	//
+	bench_roundRobin(w_standard, wp_standard, no_wp);
+	bench_roundRobin(w_compact, wp_compact, no_wp);
+
+	double time_standard = bench_roundRobin(w_standard, wp_standard, no_wp);
+	double time_compact = bench_roundRobin(w_compact, wp_compact, no_wp);
+
+	// Check results
+	//
+	double max_diff = 0;
+	for (int i = 0; i < no_wp; i++) {
+		double diff = fabs(w_standard[i] - w_compact[i]);
+		max_diff = (diff > max_diff) ? diff : max_diff;
+	}
+
+	// Print results
+	//
+	double no_calls = (double) no_wp * NO_ROUNDS;
+
+	printf("\n\n##\n##\nBenchmark: Round-robin evaluation of working pairs.");
+	printf("\nNumber of working pairs: %i", no_wp);
+	printf("\nNumber of rounds: %i", NO_ROUNDS);
+	printf("\n\nStandard layout: %.2f ns/call, %.3e calls/s",
+		1e9 * time_standard / no_calls, no_calls / time_standard);
+	printf("\nCompact layout: %.2f ns/call, %.3e calls/s",
+		1e9 * time_compact / no_calls, no_calls / time_compact);
+	printf("\nSpeed-up of compact layout: %.3f",
+		time_standard / time_compact);
+	printf("\nMaximal absolute difference of loadings: %e", max_diff);
+	printf("\n\nCount cache misses with 'perf stat -e cache-misses'.\n");
+
+	// Free memory
+	//
+	for (int i = 0; i < no_wp; i++) {
+		delWorkingPair(wp_standard[i]);
+		delWorkingPair(wp_compact[i]);
+	}
+
+	free(wp_standard);
+	free(wp_compact);
+	free(w_standard);
+	free(w_compact);
+
+	return EXIT_SUCCESS;
+}
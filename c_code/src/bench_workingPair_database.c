@@ -0,0 +1,280 @@
+//////////////////////////////////
+// bench_workingPair_database.c //
+//////////////////////////////////
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "benchmark.h"
+#include "database.h"
+#include "refrigerant.h"
+#include "workingPair.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//SorpPropLib_MinimalExample.json"
+#else
+	#define PATH ".\\data\\SorpPropLib_MinimalExample.json"
+#endif
+
+#ifndef NO_COPIES
+#define NO_COPIES 32
+#endif
+
+#ifndef NO_TEMPERATURES
+#define NO_TEMPERATURES 2000
+#endif
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * bench_sweep:
+ * ------------
+ *
+ * Evaluates equilibrium loading of all working pairs for a sweep of
+ * temperatures like a screening of working pairs, i.e. all working pairs are
+ * evaluated at the same temperature before the temperature is changed.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_w_kgkg:
+ *		Array containing equilibrium loadings of last temperature.
+ * 	WorkingPair **workingPairs:
+ *		Array containing working pairs.
+ *	int no_wp:
+ *		Number of working pairs.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns elapsed time in s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double bench_sweep(double *ret_w_kgkg, WorkingPair **workingPairs,
+	int no_wp) {
+	double time_start = benchmark_time_s();
+
+	for (int i_T = 0; i_T < NO_TEMPERATURES; i_T++) {
+		double T_K = 293.15 + 60.0 * i_T / NO_TEMPERATURES;
+
+		for (int i = 0; i < no_wp; i++) {
+			ret_w_kgkg[i] = ads_w_pT(1000, T_K, workingPairs[i]);
+		}
+	}
+
+	return benchmark_time_s() - time_start;
+}
+
+
+/*
+ * size_refrigerants:
+ * ------------------
+ *
+ * Calculates memory required by Refrigerant-structs and coefficients of
+ * refrigerant functions of all working pairs. Memory shared by several working
+ * pairs is counted only once.
+ *
+ * Parameters:
+ * -----------
+ *	int *ret_no_refrigerants:
+ *		Number of distinct Refrigerant-structs.
+ * 	WorkingPair **workingPairs:
+ *		Array containing working pairs.
+ *	int no_wp:
+ *		Number of working pairs.
+ *
+ * Returns:
+ * --------
+ *	size_t:
+ *		Returns memory in bytes.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+size_t size_refrigerants(int *ret_no_refrigerants, WorkingPair **workingPairs,
+	int no_wp) {
+	size_t size = 0;
+	*ret_no_refrigerants = 0;
+
+	for (int i = 0; i < no_wp; i++) {
+		// Check if Refrigerant-struct is already counted
+		//
+		int counted = 0;
+
+		for (int j = 0; j < i && !counted; j++) {
+			counted = (workingPairs[j]->refrigerant ==
+				workingPairs[i]->refrigerant);
+		}
+
+		if (!counted) {
+			size += sizeof(Refrigerant) + (size_t) (
+				workingPairs[i]->no_psat_par + workingPairs[i]->no_rhol_par) *
+				sizeof(double);
+			(*ret_no_refrigerants)++;
+		}
+	}
+
+	return size;
+}
+
+
+/*
+ * main:
+ * -----
+ *
+ * Creates many working pairs with private refrigerants (i.e., newWorkingPair)
+ * and with refrigerants interned by a database (i.e., newWorkingPairDatabase).
+ * Compares memory required by refrigerants and time required for a screening
+ * sweep over temperatures. Furthermore, checks that both kinds of working
+ * pairs calculate identical equilibrium loadings.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main() {
+	// Define working pairs that are screened
+	//
+	const char *wp_as[] = {"mof", "mof", "carbon", "carbon", "carbon", "carbon",
+		"carbon", "zeolite", "zeolite", "silicagel", "zeolite", "zeolite",
+		"silicagel", "silicagel"};
+	const char *wp_st[] = {"cubtc", "cubtc", "norit-rb1", "norit-rb1",
+		"maxsorb-iii", "maxsorb-iii", "acf-a-20", "5a", "13x", "", "5a", "13x",
+		"", "123"};
+	const char *wp_rf[] = {"propane", "isobutane", "carbonDioxide", "methane",
+		"R-134a", "propane", "R-134a", "water", "water", "water",
+		"carbonDioxide", "carbonDioxide", "carbonDioxide", "water"};
+	const char *wp_iso[] = {"DualSiteSips", "DualSiteSips", "Langmuir",
+		"Langmuir", "DubininAstakhov", "DubininAstakhov", "DubininAstakhov",
+		"Toth", "Toth", "Toth", "Toth", "Toth", "Toth", "DubininArctan1"};
+	int no_types = sizeof(wp_as) / sizeof(wp_as[0]);
+	int no_wp = no_types * NO_COPIES;
+
+	// Allocate memory
+	//
+	WorkingPair **wp_private = (WorkingPair **) malloc(no_wp *
+		sizeof(WorkingPair *));
+	WorkingPair **wp_interned = (WorkingPair **) malloc(no_wp *
+		sizeof(WorkingPair *));
+	double *w_private = (double *) malloc(no_wp * sizeof(double));
+	double *w_interned = (double *) malloc(no_wp * sizeof(double));
+
+	if (wp_private == NULL || wp_interned == NULL || w_private == NULL ||
+		w_interned == NULL) {
+		printf("\n\nCannot allocate memory for benchmark!");
+		return EXIT_FAILURE;
+	}
+
+	// Create working pairs with private refrigerants
+	//
+	double time_start = benchmark_time_s();
+	for (int i = 0; i < no_wp; i++) {
+		int type = i % no_types;
+
+		wp_private[i] = newWorkingPair(PATH, wp_as[type], wp_st[type],
+			wp_rf[type], wp_iso[type], 1, "VaporPressure_EoS1", 1,
+			"SaturatedLiquidDensity_EoS1", 1);
+		if (wp_private[i] == NULL) {
+			return EXIT_FAILURE;
+		}
+	}
+	double time_new_private = benchmark_time_s() - time_start;
+
+	// Create working pairs with refrigerants interned by database: Database
+	// is deleted before working pairs are used
+	//
+	time_start = benchmark_time_s();
+	Database *database = newDatabase(PATH);
+
+	if (database == NULL) {
+		return EXIT_FAILURE;
+	}
+
+	for (int i = 0; i < no_wp; i++) {
+		int type = i % no_types;
+
+		wp_interned[i] = newWorkingPairDatabase(database, wp_as[type],
+			wp_st[type], wp_rf[type], wp_iso[type], 1, "VaporPressure_EoS1", 1,
+			"SaturatedLiquidDensity_EoS1", 1);
+		if (wp_interned[i] == NULL) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	delDatabase(database);
+	double time_new_interned = benchmark_time_s() - time_start;
+
+	// Warm up and run benchmark
+	//
+	bench_sweep(w_private, wp_private, no_wp);
+	bench_sweep(w_interned, wp_interned, no_wp);
+
+	double time_private = bench_sweep(w_private, wp_private, no_wp);
+	double time_interned = bench_sweep(w_interned, wp_interned, no_wp);
+
+	// Check results
+	//
+	double max_diff = 0;
+	for (int i = 0; i < no_wp; i++) {
+		double diff = fabs(w_private[i] - w_interned[i]);
+		max_diff = (diff > max_diff) ? diff : max_diff;
+	}
+
+	// Print results
+	//
+	int no_rf_private;
+	int no_rf_interned;
+	size_t size_private = size_refrigerants(&no_rf_private, wp_private,
+		no_wp);
+	size_t size_interned = size_refrigerants(&no_rf_interned, wp_interned,
+		no_wp);
+	double no_calls = (double) no_wp * NO_TEMPERATURES;
+
+	printf("\n\n##\n##\nBenchmark: Screening sweep of working pairs.");
+	printf("\nNumber of working pairs: %i", no_wp);
+	printf("\nNumber of temperatures: %i", NO_TEMPERATURES);
+	printf("\n\nCreation (private refrigerants): %.3f us/working pair",
+		1e6 * time_new_private / no_wp);
+	printf("\nCreation (interned refrigerants): %.3f us/working pair",
+		1e6 * time_new_interned / no_wp);
+	printf("\n\nRefrigerants (private): %i structs, %zu bytes",
+		no_rf_private, size_private);
+	printf("\nRefrigerants (interned): %i structs, %zu bytes",
+		no_rf_interned, size_interned);
+	printf("\n\nSweep (private refrigerants): %.2f ns/call",
+		1e9 * time_private / no_calls);
+	printf("\nSweep (interned refrigerants): %.2f ns/call",
+		1e9 * time_interned / no_calls);
+	printf("\nSpeed-up of interned refrigerants: %.3f",
+		time_private / time_interned);
+	printf("\nMaximal absolute difference of loadings: %e\n", max_diff);
+
+	// Free memory
+	//
+	for (int i = 0; i < no_wp; i++) {
+		delWorkingPair(wp_private[i]);
+		delWorkingPair(wp_interned[i]);
+	}
+
+	free(wp_private);
+	free(wp_interned);
+	free(w_private);
+	free(w_interned);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,51 @@
+/////////////////
+// benchmark.c //
+/////////////////
+#ifdef __unix
+#include <time.h>
+#else
+#include <windows.h>
+#endif
+#include "benchmark.h"
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * benchmark_time_s:
+ * -----------------
+ *
+ * Auxiliary function to get current time of a monotonic clock. Function is used
+ * by benchmark programs to measure elapsed times.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns current time in s.
+ *
+ * Remarks:
+ * --------
+ *	Only differences of returned values are meaningful.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double benchmark_time_s(void) {
+#ifdef __unix
+	struct timespec time_now;
+	clock_gettime(CLOCK_MONOTONIC, &time_now);
+
+	return (double) time_now.tv_sec + 1e-9 * (double) time_now.tv_nsec;
+#else
+	LARGE_INTEGER frequency;
+	LARGE_INTEGER time_now;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&time_now);
+
+	return (double) time_now.QuadPart / (double) frequency.QuadPart;
+#endif
+}
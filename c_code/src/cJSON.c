@@ -56,6 +56,7 @@
 #endif
 
 #include "cJSON.h"
+#include "threadLocal.h"
 
 /* define our own boolean type */
 #ifdef true
@@ -72,7 +73,8 @@ typedef struct {
     const unsigned char *json;
     size_t position;
 } error;
-static error global_error = { NULL, 0 };
+/* error is stored per thread so that several threads can parse at the same time */
+static THREAD_LOCAL error global_error = { NULL, 0 };
 
 CJSON_PUBLIC(const char *) cJSON_GetErrorPtr(void)
 {
@@ -0,0 +1,619 @@
+////////////////
+// database.c //
+////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cJSON.h"
+#include "database.h"
+#include "json_interface.h"
+#include "referenceCounter.h"
+#include "refrigerant.h"
+#include "spinLock.h"
+#include "status.h"
+#include "structDefinitions.c"
+
+
+///////////////////////////
+// Definition of structs //
+///////////////////////////
+/*
+ * Database:
+ * ---------
+ *
+ * Contains tree of JSON-structs representing content of the database. Thus,
+ * the database must only be read and parsed once when creating several working
+ * pairs or refrigerants.
+ *
+ * Attributes:
+ * -----------
+ * 	char *path_db:
+ *		Malloc-ed copy of path to database.
+ *	cJSON *json_file:
+ *		Tree of JSON-structs that represent content of database.
+ *
+ *	RefrigerantParameters **refrigerant_parameters:
+ *		Array containing refrigerants that are interned by database and shared
+ *		by working pairs and refrigerant handles.
+ *	int no_refrigerant_parameters:
+ *		Number of interned refrigerants.
+ *	long lock_refrigerant_parameters:
+ *		Spin lock that is 1 while a thread searches or changes interned
+ *		refrigerants and 0 otherwise.
+ *
+ * Remarks:
+ * --------
+ *	Tree of JSON-structs is only read after creation. Thus, several threads
+ *	can create working pairs and refrigerant handles from the same database
+ *	at the same time.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/*
+ * RefrigerantParameters:
+ * ----------------------
+ *
+ * Contains coefficients of refrigerant functions and Refrigerant-struct that
+ * are read once per database and shared read-only by all working pairs and
+ * refrigerant handles using the same refrigerant, calculation approaches, and
+ * IDs of equations.
+ *
+ * Attributes:
+ * -----------
+ * 	char *wp_rf:
+ *		Malloc-ed copy of name of refrigerant.
+ * 	char *rf_psat:
+ *		Malloc-ed copy of name of calculation approach for vapor pressure.
+ * 	char *rf_rhol:
+ *		Malloc-ed copy of name of calculation approach for liquid density.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation.
+ *	int no_rhol:
+ *		ID of liquid density equation.
+ *
+ * 	double *psat_par:
+ *		Array containing coefficients of vapor pressure equation.
+ * 	double *rhol_par:
+ *		Array containing coefficients of saturated liquid density equation.
+ *	int no_psat_par:
+ *		Number of coefficients of vapor pressure equation.
+ *	int no_rhol_par:
+ *		Number of coefficients of saturated liquid density equation.
+ *
+ *	double T_min_psat_K:
+ *		Lower limit of temperature of vapor pressure equation (i.e., -1 if
+ *		not given by database).
+ *	double T_max_psat_K:
+ *		Upper limit of temperature of vapor pressure equation (i.e., -1 if
+ *		not given by database).
+ *	double T_min_rhol_K:
+ *		Lower limit of temperature of saturated liquid density equation (i.e.,
+ *		-1 if not given by database).
+ *	double T_max_rhol_K:
+ *		Upper limit of temperature of saturated liquid density equation (i.e.,
+ *		-1 if not given by database).
+ *
+ *	Refrigerant *refrigerant:
+ *		Struct containing function pointers for refrigerant functions with
+ *		enabled per-thread cache of vapor pressure.
+ *
+ *	long no_references:
+ *		Number of references to struct (i.e., database and number of working
+ *		pairs and refrigerant handles sharing struct).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * newDatabase:
+ * ------------
+ *
+ * Initialization function to create a new Database-struct. Therefore, function
+ * reads content of database and parses it to a tree of JSON-structs. If reading
+ * or parsing fails, functions returns NULL and prints a warning.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path_db:
+ *		Path to database.
+ *
+ * Returns:
+ * --------
+ *	struct *Database:
+ *		Returns malloc-ed Database-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API Database *newDatabase(const char *path_db) {
+    // Try to allocate memory for Database-struct and copy of path
+	//
+    Database *retDatabase = (Database *) malloc(sizeof(Database));
+
+    if (retDatabase == NULL) {
+		// Not enough memory available for Database-struct
+		//
+		if (status_report(STATUS_NO_MEMORY, "newDatabase", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for Database-struct.");
+		}
+        return NULL;
+	}
+
+	retDatabase->path_db = (char *) malloc(strlen(path_db) + 1);
+    if (retDatabase->path_db == NULL) {
+		// Not enough memory available for copy of path
+		//
+		if (status_report(STATUS_NO_MEMORY, "newDatabase", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for path of Database-struct.");
+		}
+		free(retDatabase);
+        return NULL;
+	}
+	strcpy(retDatabase->path_db, path_db);
+
+	// Connect to JSON database and parse database's content to JSON-structs
+	//
+	char *json_content = json_read_file(path_db);
+    if (json_content == NULL) {
+		// If connection to database fails, free memory
+		//
+		if (status_report(STATUS_DATABASE, "newDatabase", 0, 0)) {
+			printf("\n\n###########\n# Error #\n###########");
+			printf("\nCannot read JSON database! See warnings printed before!");
+		}
+		free(retDatabase->path_db);
+		free(retDatabase);
+        return NULL;
+	}
+
+	retDatabase->json_file = json_parse_file(json_content);
+	free(json_content);
+
+    if (retDatabase->json_file == NULL) {
+		// If content of database cannot be parsed to JSON-struct, free memory
+		//
+		if (status_report(STATUS_DATABASE, "newDatabase", 0, 0)) {
+			printf("\n\n###########\n# Error #\n###########");
+			printf("\nCannot work with JSON-structs! See warnings printed "
+				"before!");
+		}
+		free(retDatabase->path_db);
+		free(retDatabase);
+        return NULL;
+	}
+
+	// Initialize array of interned refrigerants
+	//
+	retDatabase->refrigerant_parameters = NULL;
+	retDatabase->no_refrigerant_parameters = 0;
+	retDatabase->lock_refrigerant_parameters = 0;
+
+	// Return structure
+	//
+	return retDatabase;
+}
+
+
+/*
+ * delDatabase:
+ * ------------
+ *
+ * Destructor function to free allocated memory of a Database-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Database:
+ *		Pointer of Database-struct.
+ *
+ * Remarks:
+ * --------
+ *	Interned refrigerants are only freed when no working pair or refrigerant
+ *	handle uses them anymore. Thus, working pairs created by the database can
+ *	still be used after deleting the database.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void delDatabase(void *database) {
+	// Typecast void pointer given as input to pointer of Database-struct
+	//
+	Database *retDatabase = (Database *) database;
+
+    // Because of initialization function, database is NULL or fully built
+	//
+    if (retDatabase != NULL) {
+		for (int i = 0; i < retDatabase->no_refrigerant_parameters; i++) {
+			delRefrigerantParameters(retDatabase->refrigerant_parameters[i]);
+		}
+		free(retDatabase->refrigerant_parameters);
+
+		cJSON_Delete(retDatabase->json_file);
+		free(retDatabase->path_db);
+		free(retDatabase);
+    }
+}
+
+
+/*
+ * database_find:
+ * --------------
+ *
+ * Auxiliary function to search interned RefrigerantParameters-struct of
+ * database. Spin lock of database must be held by caller.
+ *
+ * Parameters:
+ * -----------
+ *	struct *Database:
+ *		Pointer of Database-struct.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation.
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation.
+ *
+ * Returns:
+ * --------
+ *	struct *RefrigerantParameters:
+ *		Interned struct whose number of references is incremented or NULL if
+ *		struct is not interned.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static RefrigerantParameters *database_find(Database *database,
+	const char *wp_rf, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol) {
+	for (int i = 0; i < database->no_refrigerant_parameters; i++) {
+		RefrigerantParameters *entry = database->refrigerant_parameters[i];
+
+		if (entry->no_p_sat == no_p_sat && entry->no_rhol == no_rhol &&
+			strcmp(entry->wp_rf, wp_rf) == 0 &&
+			strcmp(entry->rf_psat, rf_psat) == 0 &&
+			strcmp(entry->rf_rhol, rf_rhol) == 0) {
+			REFERENCES_INCREMENT(&entry->no_references);
+			return entry;
+		}
+	}
+	return NULL;
+}
+
+
+/*
+ * database_refrigerant_parameters:
+ * --------------------------------
+ *
+ * Auxiliary function to get coefficients of refrigerant functions and the
+ * Refrigerant-struct that are interned by the database. If the combination of
+ * refrigerant, calculation approaches, and IDs of equations is requested for
+ * the first time, the coefficients are read from the database and a new
+ * RefrigerantParameters-struct is interned. Otherwise, the interned struct is
+ * shared.
+ *
+ * Parameters:
+ * -----------
+ *	struct *Database:
+ *		Pointer of Database-struct.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	struct *RefrigerantParameters:
+ *		Returns interned RefrigerantParameters-struct whose number of references
+ *		is incremented. Returns NULL if refrigerant does not exist in database
+ *		or memory allocation fails.
+ *
+ * Remarks:
+ * --------
+ *	Returned struct must be released by delRefrigerantParameters. Array of
+ *	interned refrigerants is protected by spin lock of database. Thus,
+ *	function can be called by several threads for the same database at the
+ *	same time. The lock is not held while coefficients are read. If another
+ *	thread interned the same combination meanwhile, its struct is shared and
+ *	the struct created is freed.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+RefrigerantParameters *database_refrigerant_parameters(Database *database,
+	const char *wp_rf, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol) {
+	// Search interned refrigerants first
+	//
+	SPINLOCK_ACQUIRE(&database->lock_refrigerant_parameters);
+	RefrigerantParameters *entry = database_find(database, wp_rf, rf_psat,
+		no_p_sat, rf_rhol, no_rhol);
+	SPINLOCK_RELEASE(&database->lock_refrigerant_parameters);
+
+	if (entry != NULL) {
+		return entry;
+	}
+
+	// Refrigerant is requested for the first time: Read coefficients without
+	// holding lock because database is searched and memory is allocated
+	//
+	RefrigerantParameters *retEntry = newRefrigerantParameters(database,
+		wp_rf, rf_psat, no_p_sat, rf_rhol, no_rhol);
+
+	if (retEntry == NULL) {
+		return NULL;
+	}
+
+	// Intern new struct unless another thread was faster
+	//
+	SPINLOCK_ACQUIRE(&database->lock_refrigerant_parameters);
+
+	entry = database_find(database, wp_rf, rf_psat, no_p_sat, rf_rhol,
+		no_rhol);
+
+	if (entry != NULL) {
+		SPINLOCK_RELEASE(&database->lock_refrigerant_parameters);
+
+		delRefrigerantParameters(retEntry);
+		return entry;
+	}
+
+	RefrigerantParameters **entries = (RefrigerantParameters **) realloc(
+		database->refrigerant_parameters,
+		(size_t) (database->no_refrigerant_parameters + 1) *
+		sizeof(RefrigerantParameters *));
+
+	if (entries == NULL) {
+		// Not enough memory available, thus do not intern struct
+		//
+		SPINLOCK_RELEASE(&database->lock_refrigerant_parameters);
+		if (status_report(STATUS_NO_MEMORY, "database_refrigerant_parameters",
+			0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for interned refrigerants of "
+				"Database-struct.");
+		}
+		delRefrigerantParameters(retEntry);
+		return NULL;
+	}
+
+	// Database holds one reference and caller holds one reference
+	//
+	database->refrigerant_parameters = entries;
+	database->refrigerant_parameters[database->no_refrigerant_parameters] =
+		retEntry;
+	database->no_refrigerant_parameters++;
+	REFERENCES_INCREMENT(&retEntry->no_references);
+
+	SPINLOCK_RELEASE(&database->lock_refrigerant_parameters);
+	return retEntry;
+}
+
+
+/*
+ * newRefrigerantParameters:
+ * -------------------------
+ *
+ * Initialization function to create a new RefrigerantParameters-struct.
+ * Therefore, function reads coefficients of refrigerant functions from the
+ * entry of the refrigerant within the database (i.e. entry of type "refrig")
+ * and creates a Refrigerant-struct with enabled per-thread cache of vapor
+ * pressure. If refrigerant cannot be found or memory allocation fails,
+ * functions returns NULL and prints a warning.
+ *
+ * Parameters:
+ * -----------
+ *	struct *Database:
+ *		Pointer of Database-struct.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	struct *RefrigerantParameters:
+ *		Returns malloc-ed RefrigerantParameters-struct with one reference.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+RefrigerantParameters *newRefrigerantParameters(Database *database,
+	const char *wp_rf, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol) {
+	// Search entry of refrigerant
+	//
+	int rf_tp;
+	cJSON *json_refrigerant = json_search_equation("dum_sorb", "dum_subtype",
+		wp_rf, &rf_tp, database->json_file);
+
+    if (json_refrigerant == NULL) {
+		if (status_report(STATUS_DATABASE, "newRefrigerantParameters", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot select refrigerant \"%s\" required for "
+				"calculating fluid properties.", wp_rf);
+		}
+        return NULL;
+	}
+
+    // Try to allocate memory for RefrigerantParameters-struct and key
+	//
+    RefrigerantParameters *retEntry = (RefrigerantParameters *) malloc(
+		sizeof(RefrigerantParameters));
+
+    if (retEntry == NULL) {
+		if (status_report(STATUS_NO_MEMORY, "newRefrigerantParameters", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for "
+				"RefrigerantParameters-struct.");
+		}
+        return NULL;
+	}
+
+	retEntry->wp_rf = (char *) malloc(strlen(wp_rf) + 1);
+	retEntry->rf_psat = (char *) malloc(strlen(rf_psat) + 1);
+	retEntry->rf_rhol = (char *) malloc(strlen(rf_rhol) + 1);
+	retEntry->no_p_sat = no_p_sat;
+	retEntry->no_rhol = no_rhol;
+	retEntry->refrigerant = NULL;
+	retEntry->no_references = 1;
+
+	// Select coefficients for vapor pressure and saturated liquid density:
+	// If function and thus coefficients are not implemented, pointer is set to
+	// NULL
+	//
+	retEntry->psat_par = json_search_parameters(&retEntry->no_psat_par,
+		rf_psat, no_p_sat, json_refrigerant);
+	retEntry->rhol_par = json_search_parameters(&retEntry->no_rhol_par,
+		rf_rhol, no_rhol, json_refrigerant);
+
+	if (retEntry->psat_par == NULL) {
+		retEntry->no_psat_par = 0;
+	}
+	if (retEntry->rhol_par == NULL) {
+		retEntry->no_rhol_par = 0;
+	}
+
+	// Read ranges of validity of equations if given
+	//
+	double *limits[] = {&retEntry->T_min_psat_K, &retEntry->T_max_psat_K,
+		&retEntry->T_min_rhol_K, &retEntry->T_max_rhol_K};
+	const char *names_limits[] = {"temperature-min", "temperature-max"};
+
+	for (int i = 0; i < 4; i++) {
+		if (json_search_validity(limits[i], (i < 2) ? rf_psat : rf_rhol,
+			(i < 2) ? no_p_sat : no_rhol, names_limits[i % 2],
+			json_refrigerant) == -1) {
+			*limits[i] = -1;
+		}
+	}
+
+	// Initialize struct containing refrigerant functions
+	//
+	if (retEntry->wp_rf != NULL && retEntry->rf_psat != NULL &&
+		retEntry->rf_rhol != NULL) {
+		strcpy(retEntry->wp_rf, wp_rf);
+		strcpy(retEntry->rf_psat, rf_psat);
+		strcpy(retEntry->rf_rhol, rf_rhol);
+
+		retEntry->refrigerant = newRefrigerant(
+			(retEntry->psat_par == NULL) ? "NoVaporPressure" : rf_psat,
+			(retEntry->rhol_par == NULL) ? "NoSaturatedLiquidDensity" :
+			rf_rhol, retEntry->psat_par);
+	}
+
+	if (retEntry->refrigerant == NULL) {
+		// Cannot create struct, free memory
+		//
+		if (status_report(STATUS_DATABASE, "newRefrigerantParameters", 0, 0)) {
+			printf("\n\n###########\n# Error #\n###########");
+			printf("\nCannot create Refrigerant-struct within "
+				"RefrigerantParameters-struct!");
+		}
+		delRefrigerantParameters(retEntry);
+		return NULL;
+	}
+
+	// Enable per-thread cache as struct is shared by several working pairs
+	//
+	refrigerant_enable_cache(retEntry->refrigerant);
+
+	// Avoid compiler warning C4100 by adding "do nothing" expression
+	// "Do nothing" expression will be optimized out by compiler
+	//
+	(rf_tp) = (rf_tp);
+
+	// Return structure
+	//
+	return retEntry;
+}
+
+
+/*
+ * delRefrigerantParameters:
+ * -------------------------
+ *
+ * Destructor function to release a RefrigerantParameters-struct. Function
+ * decrements number of references and frees memory when last reference is
+ * released.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *RefrigerantParameters:
+ *		Pointer of RefrigerantParameters-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void delRefrigerantParameters(void *refrigerantParameters) {
+	// Typecast void pointer given as input to pointer of
+	// RefrigerantParameters-struct
+	//
+	RefrigerantParameters *retEntry =
+		(RefrigerantParameters *) refrigerantParameters;
+
+    // Free memory when last reference is released
+	//
+    if (retEntry != NULL &&
+		REFERENCES_DECREMENT(&retEntry->no_references) == 0) {
+		delRefrigerant(retEntry->refrigerant);
+		free(retEntry->psat_par);
+		free(retEntry->rhol_par);
+		free(retEntry->wp_rf);
+		free(retEntry->rf_psat);
+		free(retEntry->rf_rhol);
+		free(retEntry);
+    }
+}
@@ -5,6 +5,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include "json_interface.h"
+#include "spline.h"
+#include "status.h"
+#include "structDefinitions.c"
 
 
 /////////////////////////////
@@ -67,23 +70,29 @@ char *json_read_file(const char *path) {
 	if ((fp = fopen(path, "rb")) == NULL) {
 		// Cannot open JSON-file
 		//
-		printf("\n\n###########\n# Warning #\n###########");
-		printf("\nCannot open file JSON-file.");
+		if (status_report(STATUS_DATABASE, "json_read_file", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot open file JSON-file.");
+		}
 		return NULL;
 	#else
 	if ((fopen_s(&fp, path, "rb")) != 0) {
 		// Cannot open JSON-file
 		//
-		printf("\n\n###########\n# Warning #\n###########");
-		printf("\nCannot open file JSON-file.");
+		if (status_report(STATUS_DATABASE, "json_read_file", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot open file JSON-file.");
+		}
 		return NULL;
 	#endif
 
 	} else if (fseek(fp, 0, SEEK_END) != 0) {
 		// Cannot set JSON-file position
 		//
-		printf("\n\n###########\n# Warning #\n###########");
-		printf("\nCannot set JSON-file position to end of file.");
+		if (status_report(STATUS_DATABASE, "json_read_file", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot set JSON-file position to end of file.");
+		}
 		fclose(fp);
 		return NULL;
 
@@ -100,8 +109,10 @@ char *json_read_file(const char *path) {
 			if (fread(data, 1, size, fp) != (size_t) size) {
 				// Cannot read content of JSON-file
 				//
-				printf("\n\n###########\n# Warning #\n###########");
-				printf("\nCannot read content of JSON-file.");
+				if (status_report(STATUS_DATABASE, "json_read_file", 0, 0)) {
+					printf("\n\n###########\n# Warning #\n###########");
+					printf("\nCannot read content of JSON-file.");
+				}
 				free(data);
 				fclose(fp);
 				return NULL;
@@ -118,8 +129,11 @@ char *json_read_file(const char *path) {
 		} else {
 			// Cannot allocate memory for data
 			//
-			printf("\n\n###########\n# Warning #\n###########");
-			printf("\nCannot allocate memory to save content of JSON-file.");
+			if (status_report(STATUS_NO_MEMORY, "json_read_file", 0, 0)) {
+				printf("\n\n###########\n# Warning #\n###########");
+				printf("\nCannot allocate memory to save content of "
+					"JSON-file.");
+			}
 			fclose(fp);
 			return NULL;
 		}
@@ -148,20 +162,25 @@ char *json_read_file(const char *path) {
  * --------
  *	10/18/2019, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Position of error is returned by parser instead of global pointer.
  *
  */
 cJSON *json_parse_file(const char *content) {
-	// Parse content of JSON-file
+	// Parse content of JSON-file: End of parsing is returned by cJSON and
+	// marks position of error if parsing fails
 	//
-	cJSON*retJson = cJSON_Parse(content);
+	const char *error_ptr = NULL;
+	cJSON*retJson = cJSON_ParseWithOpts(content, &error_ptr, 0);
 
     if (retJson == NULL) {
 		// Not enough memory available for tree of JSON-structs
 		//
-		printf("\n\n###########\n# Warning #\n###########");
-		printf("\nCannot allocate memory for tree of JSON-structs.");
+		if (status_report(STATUS_NO_MEMORY, "json_parse_file", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for tree of JSON-structs.");
+		}
 
-        const char *error_ptr = cJSON_GetErrorPtr();
         if (error_ptr != NULL) {
             fprintf(stderr, "Error before: %s\n\n", error_ptr);
         }
@@ -306,8 +325,11 @@ cJSON *json_search_equation(const char *wp_as, const char *wp_st,
 
 	// Working pair defined by input does not exist in JSON-struct json
 	//
-	printf("\n\n###########\n# Warning #\n###########");
-	printf("\nCannot find working pair that is defined by input in JSON-file.");
+	if (status_report(STATUS_DATABASE, "json_search_equation", 0, 0)) {
+		printf("\n\n###########\n# Warning #\n###########");
+		printf("\nCannot find working pair that is defined by input in "
+			"JSON-file.");
+	}
 	return NULL;
 
 }
@@ -333,14 +355,24 @@ cJSON *json_search_equation(const char *wp_as, const char *wp_st,
  * --------
  *	double *equ_par:
  *		Malloc-ed array containing coefficients of selected working pair.
+ *	int *ret_no_par:
+ *		Number of coefficients contained in returned array.
  *
  * History:
  * --------
  *	10/18/2019, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Added number of coefficients as output.
  *
  */
-double *json_search_parameters(const char *equation, int no_equ, cJSON *json) {
+double *json_search_parameters(int *ret_no_par, const char *equation,
+	int no_equ, cJSON *json) {
+	// Initialize number of coefficients to indicate that no coefficients are
+	// found
+	//
+	*ret_no_par = 0;
+
 	// Get correct equation
 	//
     cJSON *json_equation = cJSON_GetObjectItemCaseSensitive(json, equation);
@@ -377,9 +409,12 @@ double *json_search_parameters(const char *equation, int no_equ, cJSON *json) {
 					if (coefficients == NULL) {
 						// Not enough memory available for coefficients
 						//
-						printf("\n\n###########\n# Warning #\n###########");
-						printf("\nCannot allocate memory for coefficients of "
-							"equation \" %s \".", equation);
+						if (status_report(STATUS_NO_MEMORY,
+							"json_search_parameters", 0, 0)) {
+							printf("\n\n###########\n# Warning #\n###########");
+							printf("\nCannot allocate memory for coefficients "
+								"of equation \" %s \".", equation);
+						}
 						return NULL;
 
 					}
@@ -406,14 +441,18 @@ double *json_search_parameters(const char *equation, int no_equ, cJSON *json) {
 
 					// Return coefficients
 					//
+					*ret_no_par = no_coef;
 					return coefficients;
 
 				} else {
 					// Equation does not saved as object
 					//
-					printf("\n\n###########\n# Warning #\n###########");
-					printf("\nEquation \" %s \" is not saved as object.",
-						equation);
+					if (status_report(STATUS_DATABASE, "json_search_parameters",
+						0, 0)) {
+						printf("\n\n###########\n# Warning #\n###########");
+						printf("\nEquation \" %s \" is not saved as object.",
+							equation);
+					}
 					return NULL;
 
 				}
@@ -423,19 +462,245 @@ double *json_search_parameters(const char *equation, int no_equ, cJSON *json) {
 		}
 		// Equation ID does not exist for selected working pair
 		//
-		printf("\n\n###########\n# Warning #\n###########");
-		printf("\nEquation ID \" %i \" does not exist for selected working "
-			"pair.", no_equ);
+		if (status_report(STATUS_DATABASE, "json_search_parameters", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nEquation ID \" %i \" does not exist for selected working "
+				"pair.", no_equ);
+		}
 		return NULL;
 
 	} else {
 		// Equation is not saved as array
 		//
-		printf("\n\n###########\n# Warning #\n###########");
-		printf("\nEquation \" %s \"  is not saved as array or does not exist.",
-			equation);
+		if (status_report(STATUS_DATABASE, "json_search_parameters", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nEquation \" %s \"  is not saved as array or does not "
+				"exist.",
+				equation);
+		}
+		return NULL;
+
+	}
+
+}
+
+
+/*
+ * json_search_validity:
+ * ---------------------
+ *
+ * Searches tree of JSON-structs that contains equations of a specific working
+ * pair for a limit of the range of validity (i.e. entry of "_va_") of an
+ * equation that is defined by user input. In contrast to
+ * json_search_parameters, no warning is printed if limit does not exist
+ * because many equations have no or empty ranges of validity.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_value:
+ *		Value of limit.
+ * 	const char *equation:
+ *		Name of equation.
+ *	int no_equ:
+ *		ID of equation (i.e. when more than one equation is available)
+ * 	const char *limit:
+ *		Name of limit (e.g. "temperature-min").
+ *	cJSON *json:
+ *		Tree of JSON-structs that represent equations of a working pair.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if limit exists and is a number and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int json_search_validity(double *ret_value, const char *equation, int no_equ,
+	const char *limit, cJSON *json) {
+	// Get correct equation and ID
+	//
+    cJSON *json_equation = cJSON_GetObjectItemCaseSensitive(json, equation);
+	cJSON *json_equation_ID = cJSON_IsArray(json_equation) ?
+		cJSON_GetArrayItem(json_equation, no_equ - 1) : NULL;
+
+	if (!cJSON_IsObject(json_equation_ID)) {
+		return -1;
+	}
+
+	// Get limit of range of validity
+	//
+	cJSON *json_validity = cJSON_GetObjectItemCaseSensitive(json_equation_ID,
+		"_va_");
+	cJSON *json_limit = cJSON_GetObjectItemCaseSensitive(json_validity, limit);
+
+	if (!cJSON_IsNumber(json_limit)) {
+		return -1;
+	}
+
+	*ret_value = json_limit->valuedouble;
+	return 0;
+}
+
+
+/*
+ * json_create_spline:
+ * -------------------
+ *
+ * Auxiliary function to create a tree of JSON-structs representing a
+ * Spline2D-struct (e.g., when exporting spline tables of a working pair).
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Spline2D:
+ *		Pointer of Spline2D-struct.
+ *
+ * Returns:
+ * --------
+ *	cJSON *json:
+ *		Tree of JSON-structs or NULL if memory allocation fails.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+cJSON *json_create_spline(const Spline2D *spline) {
+	// Create object containing grid
+	//
+	cJSON *json = cJSON_CreateObject();
+	int no_nodes = spline->no_nodes_x * spline->no_nodes_y;
+
+	if (json == NULL ||
+		cJSON_AddNumberToObject(json, "x-min", spline->x_min) == NULL ||
+		cJSON_AddNumberToObject(json, "x-max", spline->x_max) == NULL ||
+		cJSON_AddNumberToObject(json, "y-min", spline->y_min) == NULL ||
+		cJSON_AddNumberToObject(json, "y-max", spline->y_max) == NULL ||
+		cJSON_AddNumberToObject(json, "nodes-x", spline->no_nodes_x) == NULL ||
+		cJSON_AddNumberToObject(json, "nodes-y", spline->no_nodes_y) == NULL) {
+		cJSON_Delete(json);
+		return NULL;
+	}
+
+	// Add arrays containing values and derivatives at nodes: Validity is
+	// stored as numbers
+	//
+	const char *names[] = {"f", "f_x", "f_y", "f_xy"};
+	const double *values[] = {spline->f, spline->f_x, spline->f_y,
+		spline->f_xy};
+	int *valid = (int *) malloc(no_nodes * sizeof(int));
+	cJSON *json_array = NULL;
+
+	for (int i = 0; i < no_nodes && valid != NULL; i++) {
+		valid[i] = spline->valid[i];
+	}
+
+	for (int i = 0; i < 5; i++) {
+		json_array = (i < 4) ? cJSON_CreateDoubleArray(values[i], no_nodes) :
+			(valid == NULL) ? NULL : cJSON_CreateIntArray(valid, no_nodes);
+
+		if (json_array == NULL) {
+			break;
+		}
+		cJSON_AddItemToObject(json, (i < 4) ? names[i] : "valid", json_array);
+	}
+
+	free(valid);
+
+	if (json_array == NULL) {
+		cJSON_Delete(json);
+		return NULL;
+	}
+
+	return json;
+}
+
+
+/*
+ * json_read_spline:
+ * -----------------
+ *
+ * Auxiliary function to create a Spline2D-struct from a tree of JSON-structs
+ * (e.g., when loading spline tables of a working pair). If tree of JSON-structs
+ * is invalid, function returns NULL.
+ *
+ * Parameters:
+ * -----------
+ *	cJSON *json:
+ *		Tree of JSON-structs representing Spline2D-struct.
+ *
+ * Returns:
+ * --------
+ *	struct *Spline2D:
+ *		Returns malloc-ed Spline2D-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+Spline2D *json_read_spline(const cJSON *json) {
+	// Read grid
+	//
+	const char *names_grid[] = {"x-min", "x-max", "y-min", "y-max", "nodes-x",
+		"nodes-y"};
+	double grid[6];
+
+	for (int i = 0; i < 6; i++) {
+		cJSON *json_value = cJSON_GetObjectItemCaseSensitive(json,
+			names_grid[i]);
+
+		if (!cJSON_IsNumber(json_value)) {
+			return NULL;
+		}
+		grid[i] = json_value->valuedouble;
+	}
+
+	Spline2D *retSpline = newSpline2D((int) grid[4], (int) grid[5], grid[0],
+		grid[1], grid[2], grid[3]);
+
+	if (retSpline == NULL) {
 		return NULL;
+	}
+
+	// Read values and derivatives at nodes: Arrays must contain all nodes
+	//
+	const char *names[] = {"f", "f_x", "f_y", "f_xy", "valid"};
+	double *values[] = {retSpline->f, retSpline->f_x, retSpline->f_y,
+		retSpline->f_xy, NULL};
+	int no_nodes = retSpline->no_nodes_x * retSpline->no_nodes_y;
+
+	for (int i = 0; i < 5; i++) {
+		cJSON *json_array = cJSON_GetObjectItemCaseSensitive(json, names[i]);
+
+		if (!cJSON_IsArray(json_array) ||
+			cJSON_GetArraySize(json_array) != no_nodes) {
+			delSpline2D(retSpline);
+			return NULL;
+		}
+
+		int node = 0;
+		cJSON *json_value = NULL;
 
+		cJSON_ArrayForEach(json_value, json_array) {
+			if (!cJSON_IsNumber(json_value)) {
+				delSpline2D(retSpline);
+				return NULL;
+			}
+
+			if (i < 4) {
+				values[i][node] = json_value->valuedouble;
+			} else {
+				retSpline->valid[node] = (json_value->valueint != 0);
+			}
+			node++;
+		}
 	}
 
+	return retSpline;
 }
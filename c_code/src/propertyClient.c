@@ -0,0 +1,849 @@
+//////////////////////
+// propertyClient.c //
+//////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "propertyClient.h"
+#include "propertyServer.h"
+#include "spinLock.h"
+#include "status.h"
+#include "structDefinitions.c"
+
+#ifdef __unix
+	#include <errno.h>
+	#include <sys/socket.h>
+	#include <sys/un.h>
+	#include <unistd.h>
+#endif
+
+
+/////////////////////////////
+// Definition of variables //
+/////////////////////////////
+/*
+ * Socket connected to property server (i.e., -1 if not connected) and spin
+ * lock serialising requests of all threads of the process.
+ *
+ */
+static int client_socket = -1;
+static long client_lock = 0;
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+#ifdef __unix
+/*
+ * client_transfer:
+ * ----------------
+ *
+ * Auxiliary function reading or writing exactly size bytes from or to the
+ * socket of the client, i.e. partial transfers and interrupts are repeated.
+ * Bytes are discarded if buffer is NULL while reading.
+ *
+ * Parameters:
+ * -----------
+ *	void *buffer:
+ *		Buffer.
+ *	size_t size:
+ *		Number of bytes.
+ *	int write:
+ *		Flag indicating whether bytes are written (i.e., 1) or read (i.e., 0).
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all bytes are transferred and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static int client_transfer(void *buffer, size_t size, int write) {
+	char discard[4096];
+	char *position = (char *) buffer;
+
+	while (size > 0) {
+		size_t size_chunk = (buffer != NULL) ? size :
+			(size < sizeof(discard)) ? size : sizeof(discard);
+		ssize_t no_bytes = write ?
+			send(client_socket, position, size_chunk, MSG_NOSIGNAL) :
+			recv(client_socket, (buffer != NULL) ? position : discard,
+				size_chunk, 0);
+
+		if (no_bytes < 0 && errno == EINTR) {
+			continue;
+		} else if (no_bytes <= 0) {
+			return -1;
+		}
+
+		position += (buffer != NULL) ? no_bytes : 0;
+		size -= (size_t) no_bytes;
+	}
+	return 0;
+}
+#endif
+
+
+/*
+ * client_exchange:
+ * ----------------
+ *
+ * Auxiliary function sending request and its payload to property server and
+ * reading header of response: Client connects to server if not connected yet.
+ * Function must be called while spin lock of client is acquired, and payload
+ * of response must be read by caller afterwards.
+ *
+ * Parameters:
+ * -----------
+ *	ServerResponse *ret_response:
+ *		Header of response.
+ *	const ServerRequest *request:
+ *		Header of request.
+ *	const void **payloads:
+ *		Array containing parts of payload.
+ *	const size_t *sizes:
+ *		Array containing sizes of parts of payload in bytes.
+ *	int no_payloads:
+ *		Number of parts of payload.
+ *	const char *function:
+ *		Name of calling function used for warnings.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if request was exchanged and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static int client_exchange(ServerResponse *ret_response,
+	const ServerRequest *request, const void **payloads, const size_t *sizes,
+	int no_payloads, const char *function) {
+#ifdef __unix
+	// Connect to server: Path of socket can be changed by environment
+	//
+	const char *path_socket = getenv("SORP_SERVER_SOCKET");
+	path_socket = (path_socket == NULL) ? SERVER_SOCKET : path_socket;
+
+	if (client_socket < 0) {
+		struct sockaddr_un address;
+		memset(&address, 0, sizeof(address));
+		address.sun_family = AF_UNIX;
+
+		if (strlen(path_socket) < sizeof(address.sun_path)) {
+			strcpy(address.sun_path, path_socket);
+			client_socket = socket(AF_UNIX, SOCK_STREAM, 0);
+		}
+
+		if (client_socket >= 0 && connect(client_socket,
+			(struct sockaddr *) &address, sizeof(address)) != 0) {
+			close(client_socket);
+			client_socket = -1;
+		}
+	}
+
+	// Exchange request
+	//
+	int exchanged = (client_socket >= 0) &&
+		(client_transfer((void *) request, sizeof(ServerRequest), 1) == 0);
+
+	for (int i = 0; exchanged && i < no_payloads; i++) {
+		exchanged = client_transfer((void *) payloads[i], sizes[i], 1) == 0;
+	}
+
+	if (exchanged && client_transfer(ret_response, sizeof(ServerResponse),
+		0) == 0) {
+		return 0;
+	}
+
+	if (client_socket >= 0) {
+		close(client_socket);
+		client_socket = -1;
+	}
+#else
+	(void) ret_response;
+	(void) request;
+	(void) payloads;
+	(void) sizes;
+	(void) no_payloads;
+	const char *path_socket = SERVER_SOCKET;
+#endif
+
+	if (status_report(STATUS_DATABASE, function, 0, 0)) {
+		printf("\n\n###########\n# Warning #\n###########");
+		printf("\nProperty server at \"%s\" is not reachable.", path_socket);
+		printf("\nReturn -1 for function call \"%s\".", function);
+	}
+	return -1;
+}
+
+
+/*
+ * client_no_inputs:
+ * -----------------
+ *
+ * Auxiliary function returning number of inputs of a function that can be
+ * evaluated by property server.
+ *
+ * Parameters:
+ * -----------
+ *	const char *function:
+ *		Name of function.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of inputs or -1 if function cannot be evaluated.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static int client_no_inputs(const char *function) {
+#define CLIENT_MATCH(name, no_inputs) \
+	if (strcmp(function, #name) == 0) return no_inputs;
+#define CLIENT_MATCH_1(name) CLIENT_MATCH(name, 1)
+#define CLIENT_MATCH_2(name) CLIENT_MATCH(name, 2)
+#define CLIENT_MATCH_3(name) CLIENT_MATCH(name, 3)
+#define CLIENT_MATCH_4(name) CLIENT_MATCH(name, 4)
+#define CLIENT_MATCH_5(name) CLIENT_MATCH(name, 5)
+#define CLIENT_MATCH_6(name) CLIENT_MATCH(name, 6)
+#define CLIENT_MATCH_7(name) CLIENT_MATCH(name, 7)
+
+	CLIENT_FUNCTIONS_1(CLIENT_MATCH_1)
+	CLIENT_FUNCTIONS_2(CLIENT_MATCH_2)
+	CLIENT_FUNCTIONS_3(CLIENT_MATCH_3)
+	CLIENT_FUNCTIONS_4(CLIENT_MATCH_4)
+	CLIENT_FUNCTIONS_5(CLIENT_MATCH_5)
+	CLIENT_FUNCTIONS_6(CLIENT_MATCH_6)
+	CLIENT_FUNCTIONS_7(CLIENT_MATCH_7)
+	CLIENT_FUNCTIONS_VAPOR(CLIENT_MATCH_2)
+
+	return -1;
+}
+
+
+/*
+ * client_evaluate:
+ * ----------------
+ *
+ * Auxiliary function evaluating a function for arrays of states by requests
+ * to property server: Arrays are split into requests of at most
+ * SERVER_MAX_POINTS states.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_values:
+ *		Array to be filled with values of function.
+ *	double *ret_y_1_molmol:
+ *		Array to be filled with mole fractions of first component in vapor
+ *		phase (i.e., may be NULL).
+ *	double *ret_y_2_molmol:
+ *		Array to be filled with mole fractions of second component in vapor
+ *		phase (i.e., may be NULL).
+ *	int *ret_status:
+ *		Array to be filled with status codes of states (i.e., may be NULL).
+ *	const char *function:
+ *		Name of function.
+ *	const double **inputs:
+ *		Array containing arrays of inputs in order of inputs of function.
+ *	int no_inputs:
+ *		Number of inputs of function.
+ *	int no_points:
+ *		Number of states.
+ *	struct *ServerWorkingPair:
+ *		Handle of working pair.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all states are calculated and code of error otherwise.
+ *		In case of an error, all remaining states are set to -1.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static int client_evaluate(double *ret_values, double *ret_y_1_molmol,
+	double *ret_y_2_molmol, int *ret_status, const char *function,
+	const double **inputs, int no_inputs, int no_points,
+	ServerWorkingPair *workingPair) {
+	ServerRequest request;
+	memset(&request, 0, sizeof(request));
+	request.type = SERVER_EVALUATE;
+	request.handle = workingPair->handle;
+	request.no_inputs = no_inputs;
+	strcpy(request.function, function);
+
+	int code = STATUS_OK;
+	int start = 0;
+
+	while (code == STATUS_OK && start < no_points) {
+		// Send chunk of states
+		//
+		int n = no_points - start;
+		n = (n < SERVER_MAX_POINTS) ? n : SERVER_MAX_POINTS;
+
+		const void *payloads[CLIENT_MAX_INPUTS];
+		size_t sizes[CLIENT_MAX_INPUTS];
+
+		for (int i = 0; i < no_inputs; i++) {
+			payloads[i] = inputs[i] + start;
+			sizes[i] = (size_t) n * sizeof(double);
+		}
+		request.no_points = n;
+		request.length_payload = no_inputs * n * (int) sizeof(double);
+
+		SPINLOCK_ACQUIRE(&client_lock);
+
+		ServerResponse response;
+		if (client_exchange(&response, &request, payloads, sizes, no_inputs,
+			function) != 0) {
+			SPINLOCK_RELEASE(&client_lock);
+			code = STATUS_DATABASE;
+			break;
+		}
+
+		// Read values, mole fractions in vapor phase, and status codes
+		//
+		int received = (response.no_points == 0);
+
+#ifdef __unix
+		if (response.no_points == n && (response.no_outputs == 1 ||
+			response.no_outputs == 3)) {
+			size_t size = (size_t) n * sizeof(double);
+
+			received = client_transfer(ret_values + start, size, 0) == 0;
+
+			if (received && response.no_outputs == 3) {
+				received =
+					client_transfer((ret_y_1_molmol == NULL) ? NULL :
+						ret_y_1_molmol + start, size, 0) == 0 &&
+					client_transfer((ret_y_2_molmol == NULL) ? NULL :
+						ret_y_2_molmol + start, size, 0) == 0;
+			}
+
+			received = received && client_transfer((ret_status == NULL) ?
+				NULL : ret_status + start, (size_t) n * sizeof(int), 0) == 0;
+		}
+
+		if (!received && client_socket >= 0) {
+			close(client_socket);
+			client_socket = -1;
+		}
+#endif
+
+		SPINLOCK_RELEASE(&client_lock);
+
+		code = !received ? STATUS_DATABASE : (response.status != STATUS_OK) ?
+			response.status : (response.no_points == 0) ? STATUS_INVALID_INPUT :
+			STATUS_OK;
+		start += (code == STATUS_OK) ? n : 0;
+	}
+
+	// Indicate error for remaining states
+	//
+	for (int i = start; code != STATUS_OK && i < no_points; i++) {
+		ret_values[i] = -1;
+
+		if (ret_status != NULL) {
+			ret_status[i] = code;
+		}
+	}
+	return code;
+}
+
+
+/*
+ * client_scalar:
+ * --------------
+ *
+ * Auxiliary function evaluating a function for one state by one request to
+ * property server.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_y_1_molmol:
+ *		Mole fraction of first component in vapor phase (i.e., may be NULL).
+ *	double *ret_y_2_molmol:
+ *		Mole fraction of second component in vapor phase (i.e., may be NULL).
+ *	const char *function:
+ *		Name of function.
+ *	const double *values:
+ *		Array containing inputs in order of inputs of function.
+ *	int no_inputs:
+ *		Number of inputs of function.
+ *	void *workingPair:
+ *		Handle of working pair.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Value of function or -1 if function cannot be evaluated.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static double client_scalar(double *ret_y_1_molmol, double *ret_y_2_molmol,
+	const char *function, const double *values, int no_inputs,
+	void *workingPair) {
+	if (workingPair == NULL) {
+		if (status_report(STATUS_INVALID_STRUCT, function, 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nHandle of working pair does not exist.");
+			printf("\nReturn -1 for function call \"%s\".", function);
+		}
+		return -1;
+	}
+
+	const double *inputs[CLIENT_MAX_INPUTS];
+	for (int i = 0; i < no_inputs; i++) {
+		inputs[i] = values + i;
+	}
+
+	double value;
+	int status = STATUS_OK;
+	int code = client_evaluate(&value, ret_y_1_molmol, ret_y_2_molmol,
+		&status, function, inputs, no_inputs, 1,
+		(ServerWorkingPair *) workingPair);
+
+	if (code == STATUS_OK && status != STATUS_OK) {
+		if (status_report(status, function, 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nProperty server returned status \"%s\".",
+				getStatusMessage(status));
+		}
+	}
+	return value;
+}
+
+
+/*
+ * newWorkingPair:
+ * ---------------
+ *
+ * Requests working pair from property server: Server opens database once per
+ * path and keeps working pairs hot for all clients. Client connects to server
+ * when first called, using socket given by environment variable
+ * SORP_SERVER_SOCKET or SERVER_SOCKET.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path_db:
+ *		Path to database as seen by server.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	struct *ServerWorkingPair:
+ *		Returns malloc-ed handle of working pair or NULL if server is not
+ *		reachable or working pair cannot be created.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API ServerWorkingPair *CLIENT_NAME(newWorkingPair)(const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf,
+	const char *wp_iso, int no_iso, const char *rf_psat, int no_p_sat,
+	const char *rf_rhol, int no_rhol) {
+	// Encode names and IDs
+	//
+	const char *names[7] = {path_db, wp_as, wp_st, wp_rf, wp_iso, rf_psat,
+		rf_rhol};
+	int lengths[7];
+	int ids[3] = {no_iso, no_p_sat, no_rhol};
+	size_t size = 10 * sizeof(int);
+
+	for (int i = 0; i < 7; i++) {
+		size_t length = (names[i] == NULL) ? 0 : strlen(names[i]);
+
+		if (length > SERVER_MAX_NAME) {
+			if (status_report(STATUS_INVALID_INPUT, "newWorkingPair", 0, 0)) {
+				printf("\n\n###########\n# Warning #\n###########");
+				printf("\nNames of working pair are too long.");
+				printf("\nReturn NULL for function call \"newWorkingPair\".");
+			}
+			return NULL;
+		}
+
+		lengths[i] = (names[i] == NULL) ? -1 : (int) length;
+		size += length;
+	}
+
+	char *payload = (char *) malloc(size);
+	ServerWorkingPair *retWorkingPair = (ServerWorkingPair *) malloc(
+		sizeof(ServerWorkingPair));
+
+	if (payload == NULL || retWorkingPair == NULL) {
+		if (status_report(STATUS_NO_MEMORY, "newWorkingPair", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for handle of working pair.");
+			printf("\nReturn NULL for function call \"newWorkingPair\".");
+		}
+		free(payload);
+		free(retWorkingPair);
+		return NULL;
+	}
+
+	char *position = payload;
+	for (int i = 0; i < 7; i++) {
+		memcpy(position, &lengths[i], sizeof(int));
+		position += sizeof(int);
+
+		if (lengths[i] > 0) {
+			memcpy(position, names[i], (size_t) lengths[i]);
+			position += lengths[i];
+		}
+	}
+	memcpy(position, ids, sizeof(ids));
+
+	// Request working pair
+	//
+	ServerRequest request;
+	memset(&request, 0, sizeof(request));
+	request.type = SERVER_NEW_WORKINGPAIR;
+	request.length_payload = (int) size;
+
+	const void *payloads[1] = {payload};
+	ServerResponse response;
+
+	SPINLOCK_ACQUIRE(&client_lock);
+	int exchanged = client_exchange(&response, &request, payloads, &size, 1,
+		"newWorkingPair") == 0;
+	SPINLOCK_RELEASE(&client_lock);
+
+	free(payload);
+
+	if (!exchanged || response.status != STATUS_OK) {
+		if (exchanged && status_report(response.status, "newWorkingPair", 0,
+			0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nProperty server cannot create working pair (i.e., "
+				"\"%s\").", getStatusMessage(response.status));
+			printf("\nReturn NULL for function call \"newWorkingPair\".");
+		}
+		free(retWorkingPair);
+		return NULL;
+	}
+
+	retWorkingPair->handle = response.handle;
+	return retWorkingPair;
+}
+
+
+/*
+ * delWorkingPair:
+ * ---------------
+ *
+ * Releases handle of working pair: Server keeps working pair hot.
+ *
+ * Parameters:
+ * -----------
+ *	struct *ServerWorkingPair:
+ *		Handle of working pair.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void CLIENT_NAME(delWorkingPair)(void *workingPair) {
+	// Typecast void pointer given as input to correct struct
+	//
+	ServerWorkingPair *retWorkingPair = (ServerWorkingPair *) workingPair;
+
+	if (retWorkingPair == NULL) {
+		return;
+	}
+
+	ServerRequest request;
+	memset(&request, 0, sizeof(request));
+	request.type = SERVER_DEL_WORKINGPAIR;
+	request.handle = retWorkingPair->handle;
+
+	ServerResponse response;
+
+	SPINLOCK_ACQUIRE(&client_lock);
+	client_exchange(&response, &request, NULL, NULL, 0, "delWorkingPair");
+	SPINLOCK_RELEASE(&client_lock);
+
+	free(retWorkingPair);
+}
+
+
+/*
+ * batch_evaluate:
+ * ---------------
+ *
+ * Evaluates a function of the WorkingPair-struct for arrays of states by one
+ * request to the property server. Server evaluates states in parallel by its
+ * thread pool.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_values:
+ *		Array to be filled with values of function.
+ *	double *ret_y_1_molmol:
+ *		Array to be filled with mole fractions of first component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	double *ret_y_2_molmol:
+ *		Array to be filled with mole fractions of second component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	int *ret_status:
+ *		Array to be filled with status codes of states (i.e., may be NULL).
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT" or "abs_mix_x_pT").
+ *	const double **inputs:
+ *		Array containing arrays of inputs in order of inputs of function.
+ *	int no_points:
+ *		Number of states.
+ *	int grain_size:
+ *		Ignored (i.e., chosen by server).
+ *	void *batchPool:
+ *		Ignored (i.e., pool of server is used).
+ *	struct *ServerWorkingPair:
+ *		Handle of working pair.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all states are calculated and -1 otherwise. In case
+ *		of an error, all states of returned array are set to -1.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int CLIENT_NAME(batch_evaluate)(double *ret_values,
+	double *ret_y_1_molmol, double *ret_y_2_molmol, int *ret_status,
+	const char *function, const double **inputs, int no_points,
+	int grain_size, void *batchPool, void *workingPair) {
+	(void) grain_size;
+	(void) batchPool;
+
+	if (ret_values == NULL || no_points < 0) {
+		if (status_report(STATUS_INVALID_INPUT, "batch_evaluate", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nArrays of states are invalid.");
+			printf("\nReturn -1 for function call \"batch_evaluate\".");
+		}
+		return -1;
+	}
+
+	// Check function, inputs, and working pair
+	//
+	int no_inputs = (function == NULL) ? -1 : client_no_inputs(function);
+	int code = STATUS_OK;
+
+	if (workingPair == NULL) {
+		code = STATUS_INVALID_STRUCT;
+
+	} else if (no_inputs < 0) {
+		code = STATUS_NOT_IMPLEMENTED;
+
+	} else if (inputs == NULL) {
+		code = STATUS_INVALID_INPUT;
+
+	} else {
+		for (int i = 0; i < no_inputs; i++) {
+			code = (inputs[i] == NULL) ? STATUS_INVALID_INPUT : code;
+		}
+	}
+
+	if (code != STATUS_OK) {
+		if (status_report(code, "batch_evaluate", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nFunction \"%s\" cannot be evaluated for arrays of "
+				"states (i.e., \"%s\").", (function == NULL) ? "" : function,
+				getStatusMessage(code));
+			printf("\nReturn -1 for function call \"batch_evaluate\".");
+		}
+
+		for (int i = 0; i < no_points; i++) {
+			ret_values[i] = -1;
+
+			if (ret_status != NULL) {
+				ret_status[i] = code;
+			}
+		}
+		return -1;
+	}
+
+	// Evaluate states by server
+	//
+	return (client_evaluate(ret_values, ret_y_1_molmol, ret_y_2_molmol,
+		ret_status, function, inputs, no_inputs, no_points,
+		(ServerWorkingPair *) workingPair) == STATUS_OK) ? 0 : -1;
+}
+
+
+/*
+ * Functions of the WorkingPair-struct:
+ * ------------------------------------
+ *
+ * Each function of the lists CLIENT_FUNCTIONS_* has the signature of the
+ * function of workingPair.h with the same name (e.g., "double ads_w_pT(double
+ * p_Pa, double T_K, void *workingPair)") and evaluates one state by one
+ * request to the property server. Documentation of inputs and outputs is
+ * given in workingPair.h. Functions return -1 if server is not reachable.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#define CLIENT_DEFINE_1(name) \
+	DLL_API double CLIENT_NAME(name)(double x_1, void *workingPair) { \
+		double values[] = {x_1}; \
+		return client_scalar(NULL, NULL, #name, values, 1, workingPair); \
+	}
+#define CLIENT_DEFINE_2(name) \
+	DLL_API double CLIENT_NAME(name)(double x_1, double x_2, \
+		void *workingPair) { \
+		double values[] = {x_1, x_2}; \
+		return client_scalar(NULL, NULL, #name, values, 2, workingPair); \
+	}
+#define CLIENT_DEFINE_3(name) \
+	DLL_API double CLIENT_NAME(name)(double x_1, double x_2, double x_3, \
+		void *workingPair) { \
+		double values[] = {x_1, x_2, x_3}; \
+		return client_scalar(NULL, NULL, #name, values, 3, workingPair); \
+	}
+#define CLIENT_DEFINE_4(name) \
+	DLL_API double CLIENT_NAME(name)(double x_1, double x_2, double x_3, \
+		double x_4, void *workingPair) { \
+		double values[] = {x_1, x_2, x_3, x_4}; \
+		return client_scalar(NULL, NULL, #name, values, 4, workingPair); \
+	}
+#define CLIENT_DEFINE_5(name) \
+	DLL_API double CLIENT_NAME(name)(double x_1, double x_2, double x_3, \
+		double x_4, double x_5, void *workingPair) { \
+		double values[] = {x_1, x_2, x_3, x_4, x_5}; \
+		return client_scalar(NULL, NULL, #name, values, 5, workingPair); \
+	}
+#define CLIENT_DEFINE_6(name) \
+	DLL_API double CLIENT_NAME(name)(double x_1, double x_2, double x_3, \
+		double x_4, double x_5, double x_6, void *workingPair) { \
+		double values[] = {x_1, x_2, x_3, x_4, x_5, x_6}; \
+		return client_scalar(NULL, NULL, #name, values, 6, workingPair); \
+	}
+#define CLIENT_DEFINE_7(name) \
+	DLL_API double CLIENT_NAME(name)(double x_1, double x_2, double x_3, \
+		double x_4, double x_5, double x_6, double x_7, void *workingPair) { \
+		double values[] = {x_1, x_2, x_3, x_4, x_5, x_6, x_7}; \
+		return client_scalar(NULL, NULL, #name, values, 7, workingPair); \
+	}
+#define CLIENT_DEFINE_VAPOR(name) \
+	DLL_API double CLIENT_NAME(name)(double *ret_y_1_molmol, \
+		double *ret_y_2_molmol, double x_1, double x_2, void *workingPair) { \
+		double values[] = {x_1, x_2}; \
+		return client_scalar(ret_y_1_molmol, ret_y_2_molmol, #name, values, \
+			2, workingPair); \
+	}
+
+CLIENT_FUNCTIONS_1(CLIENT_DEFINE_1)
+CLIENT_FUNCTIONS_2(CLIENT_DEFINE_2)
+CLIENT_FUNCTIONS_3(CLIENT_DEFINE_3)
+CLIENT_FUNCTIONS_4(CLIENT_DEFINE_4)
+CLIENT_FUNCTIONS_5(CLIENT_DEFINE_5)
+CLIENT_FUNCTIONS_6(CLIENT_DEFINE_6)
+CLIENT_FUNCTIONS_7(CLIENT_DEFINE_7)
+CLIENT_FUNCTIONS_VAPOR(CLIENT_DEFINE_VAPOR)
+
+
+/*
+ * client_shutdownServer:
+ * ----------------------
+ *
+ * Requests property server to stop and disconnects client.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if server confirmed request and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int client_shutdownServer(void) {
+	ServerRequest request;
+	memset(&request, 0, sizeof(request));
+	request.type = SERVER_SHUTDOWN;
+
+	ServerResponse response;
+
+	SPINLOCK_ACQUIRE(&client_lock);
+	int exchanged = client_exchange(&response, &request, NULL, NULL, 0,
+		"client_shutdownServer") == 0;
+	SPINLOCK_RELEASE(&client_lock);
+
+	client_disconnect();
+	return (exchanged && response.status == STATUS_OK) ? 0 : -1;
+}
+
+
+/*
+ * client_disconnect:
+ * ------------------
+ *
+ * Disconnects client from property server. Next request connects again.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void client_disconnect(void) {
+	SPINLOCK_ACQUIRE(&client_lock);
+#ifdef __unix
+	if (client_socket >= 0) {
+		close(client_socket);
+		client_socket = -1;
+	}
+#endif
+	SPINLOCK_RELEASE(&client_lock);
+}
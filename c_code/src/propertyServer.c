@@ -0,0 +1,775 @@
+//////////////////////
+// propertyServer.c //
+//////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "batchPool.h"
+#include "database.h"
+#include "propertyServer.h"
+#include "status.h"
+#include "workingPair.h"
+#include "workingPairBatch.h"
+#include "structDefinitions.c"
+
+#ifdef __unix
+	#include <errno.h>
+	#include <poll.h>
+	#include <signal.h>
+	#include <sys/socket.h>
+	#include <sys/stat.h>
+	#include <sys/un.h>
+	#include <unistd.h>
+#endif
+
+
+/////////////////////////////
+// Definition of variables //
+/////////////////////////////
+/*
+ * Flag indicating that server shall stop (i.e., set by SIGINT or SIGTERM).
+ *
+ */
+#ifdef __unix
+static volatile sig_atomic_t server_stop = 0;
+#endif
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+#ifdef __unix
+/*
+ * server_signal:
+ * --------------
+ *
+ * Auxiliary function handling SIGINT and SIGTERM: Server stops after current
+ * request.
+ *
+ * Parameters:
+ * -----------
+ *	int signal:
+ *		Number of signal.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static void server_signal(int signal) {
+	(void) signal;
+	server_stop = 1;
+}
+
+
+/*
+ * server_transfer:
+ * ----------------
+ *
+ * Auxiliary function reading or writing exactly size bytes from or to a
+ * socket, i.e. partial transfers and interrupts are repeated.
+ *
+ * Parameters:
+ * -----------
+ *	int socket:
+ *		Socket.
+ *	void *buffer:
+ *		Buffer.
+ *	size_t size:
+ *		Number of bytes.
+ *	int write:
+ *		Flag indicating whether bytes are written (i.e., 1) or read (i.e., 0).
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all bytes are transferred and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static int server_transfer(int socket, void *buffer, size_t size, int write) {
+	char *position = (char *) buffer;
+
+	while (size > 0) {
+		ssize_t no_bytes = write ?
+			send(socket, position, size, MSG_NOSIGNAL) :
+			recv(socket, position, size, 0);
+
+		if (no_bytes < 0 && errno == EINTR) {
+			continue;
+		} else if (no_bytes <= 0) {
+			return -1;
+		}
+
+		position += no_bytes;
+		size -= (size_t) no_bytes;
+	}
+	return 0;
+}
+
+
+/*
+ * server_buffer:
+ * --------------
+ *
+ * Auxiliary function growing buffer of server to required size.
+ *
+ * Parameters:
+ * -----------
+ *	struct *PropertyServer:
+ *		Pointer of PropertyServer-struct.
+ *	size_t size:
+ *		Required size of buffer in bytes.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if buffer is large enough and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static int server_buffer(PropertyServer *propertyServer, size_t size) {
+	if (size <= propertyServer->size_buffer) {
+		return 0;
+	}
+
+	char *buffer = (char *) realloc(propertyServer->buffer, size);
+	if (buffer == NULL) {
+		return -1;
+	}
+
+	propertyServer->buffer = buffer;
+	propertyServer->size_buffer = size;
+	return 0;
+}
+
+
+/*
+ * server_database:
+ * ----------------
+ *
+ * Auxiliary function returning database of path: Each database is opened
+ * once and kept until server is stopped.
+ *
+ * Parameters:
+ * -----------
+ *	struct *PropertyServer:
+ *		Pointer of PropertyServer-struct.
+ *	const char *path_db:
+ *		Path to database.
+ *
+ * Returns:
+ * --------
+ *	struct *Database:
+ *		Database or NULL if database cannot be opened.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static Database *server_database(PropertyServer *propertyServer,
+	const char *path_db) {
+	for (int i = 0; i < propertyServer->no_databases; i++) {
+		if (strcmp(propertyServer->databases[i]->path_db, path_db) == 0) {
+			return propertyServer->databases[i];
+		}
+	}
+
+	Database **databases = (Database **) realloc(propertyServer->databases,
+		(propertyServer->no_databases + 1) * sizeof(Database *));
+	if (databases == NULL) {
+		return NULL;
+	}
+	propertyServer->databases = databases;
+
+	Database *database = newDatabase(path_db);
+	if (database != NULL) {
+		databases[propertyServer->no_databases++] = database;
+	}
+	return database;
+}
+
+
+/*
+ * server_new_workingPair:
+ * -----------------------
+ *
+ * Auxiliary function serving request SERVER_NEW_WORKINGPAIR: Working pair is
+ * searched among hot working pairs by its arguments and only created if it is
+ * not hot yet.
+ *
+ * Parameters:
+ * -----------
+ *	ServerResponse *ret_response:
+ *		Response whose status and handle are set.
+ *	struct *PropertyServer:
+ *		Pointer of PropertyServer-struct.
+ *	const char *payload:
+ *		Payload of request.
+ *	int length_payload:
+ *		Length of payload in bytes.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static void server_new_workingPair(ServerResponse *ret_response,
+	PropertyServer *propertyServer, const char *payload, int length_payload) {
+	// Decode names and IDs
+	//
+	const char *names[7];
+	int lengths[7];
+	int ids[3];
+	int position = 0;
+
+	ret_response->status = STATUS_INVALID_INPUT;
+	ret_response->handle = 0;
+
+	for (int i = 0; i < 7; i++) {
+		if (position + (int) sizeof(int) > length_payload) {
+			return;
+		}
+		memcpy(&lengths[i], payload + position, sizeof(int));
+		position += sizeof(int);
+
+		if (lengths[i] < -1 || lengths[i] > SERVER_MAX_NAME ||
+			position + ((lengths[i] < 0) ? 0 : lengths[i]) > length_payload) {
+			return;
+		}
+		names[i] = payload + position;
+
+		if (lengths[i] > 0 && memchr(names[i], '\0', lengths[i]) != NULL) {
+			return;
+		}
+		position += (lengths[i] < 0) ? 0 : lengths[i];
+	}
+
+	if (position + 3 * (int) sizeof(int) != length_payload ||
+		lengths[0] < 0) {
+		return;
+	}
+	memcpy(ids, payload + position, 3 * sizeof(int));
+
+	// Search hot working pair: Each name is encoded by a marker (i.e., 0 for
+	// NULL) and its characters with terminating zero
+	//
+	char copy[7 * (SERVER_MAX_NAME + 2)];
+	char *end = copy;
+
+	for (int i = 0; i < 7; i++) {
+		*end++ = (lengths[i] < 0) ? 0 : 1;
+		if (lengths[i] > 0) {
+			memcpy(end, names[i], (size_t) lengths[i]);
+			end += lengths[i];
+		}
+		*end++ = '\0';
+	}
+
+	for (int i = 0; i < propertyServer->no_entries; i++) {
+		ServerEntry *entry = &propertyServer->entries[i];
+
+		if (entry->no_iso == ids[0] && entry->no_p_sat == ids[1] &&
+			entry->no_rhol == ids[2] &&
+			entry->names_end - entry->names == end - copy &&
+			memcmp(entry->names, copy, (size_t) (end - copy)) == 0) {
+			entry->no_references++;
+			ret_response->status = STATUS_OK;
+			ret_response->handle = i + 1;
+			return;
+		}
+	}
+
+	// Create new hot working pair: Pointers refer to copies of names
+	//
+	ServerEntry *entries = (ServerEntry *) realloc(propertyServer->entries,
+		(propertyServer->no_entries + 1) * sizeof(ServerEntry));
+	if (entries == NULL) {
+		ret_response->status = STATUS_NO_MEMORY;
+		return;
+	}
+	propertyServer->entries = entries;
+
+	char *block = (char *) malloc((size_t) (end - copy));
+	if (block == NULL) {
+		ret_response->status = STATUS_NO_MEMORY;
+		return;
+	}
+	memcpy(block, copy, (size_t) (end - copy));
+
+	const char *args[7];
+	char *name = block;
+
+	for (int i = 0; i < 7; i++) {
+		args[i] = (*name == 0) ? NULL : name + 1;
+		name += strlen(name + 1) + 2;
+	}
+
+	Database *database = server_database(propertyServer, args[0]);
+	WorkingPair *workingPair = (database == NULL) ? NULL :
+		newWorkingPairDatabase(database, args[1], args[2], args[3], args[4],
+			ids[0], args[5], ids[1], args[6], ids[2]);
+
+	if (workingPair == NULL) {
+		free(block);
+		ret_response->status = (database == NULL) ? STATUS_DATABASE :
+			STATUS_INVALID_STRUCT;
+		return;
+	}
+
+	ServerEntry *entry = &entries[propertyServer->no_entries++];
+	entry->names = block;
+	entry->names_end = block + (end - copy);
+	entry->no_iso = ids[0];
+	entry->no_p_sat = ids[1];
+	entry->no_rhol = ids[2];
+	entry->no_references = 1;
+	entry->workingPair = workingPair;
+
+	ret_response->status = STATUS_OK;
+	ret_response->handle = propertyServer->no_entries;
+}
+
+
+/*
+ * server_request:
+ * ---------------
+ *
+ * Auxiliary function reading one request of a client, serving it, and
+ * sending the response.
+ *
+ * Parameters:
+ * -----------
+ *	int *ret_shutdown:
+ *		Flag set to 1 if client requests shutdown of server.
+ *	struct *PropertyServer:
+ *		Pointer of PropertyServer-struct.
+ *	int client:
+ *		Socket of client.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if request was served and -1 if client shall be
+ *		disconnected.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static int server_request(int *ret_shutdown, PropertyServer *propertyServer,
+	int client) {
+	// Read header and check limits of payload
+	//
+	ServerRequest request;
+	ServerResponse response = {STATUS_OK, 0, 0, 0};
+
+	if (server_transfer(client, &request, sizeof(request), 0) != 0) {
+		return -1;
+	}
+	request.function[SERVER_LENGTH_FUNCTION - 1] = '\0';
+
+	if (request.length_payload < 0 || request.no_points < 0 ||
+		request.no_points > SERVER_MAX_POINTS || request.no_inputs < 0 ||
+		request.no_inputs > BATCH_MAX_INPUTS || request.length_payload >
+		(int) ((BATCH_MAX_INPUTS + 3) * sizeof(double)) * SERVER_MAX_POINTS) {
+		return -1;
+	}
+
+	// Read payload: Buffer also holds response (i.e., three arrays of values
+	// and array of status codes)
+	//
+	size_t size_request = (size_t) request.length_payload;
+	size_t size_response = (size_t) request.no_points * (3 * sizeof(double) +
+		sizeof(int));
+
+	if (server_buffer(propertyServer, size_request + size_response) != 0) {
+		return -1;
+	}
+
+	char *payload = propertyServer->buffer;
+	char *payload_response = payload + size_request;
+	size_t length_response = 0;
+
+	if (server_transfer(client, payload, size_request, 0) != 0) {
+		return -1;
+	}
+
+	// Serve request
+	//
+	switch (request.type) {
+		case SERVER_NEW_WORKINGPAIR:
+			server_new_workingPair(&response, propertyServer, payload,
+				request.length_payload);
+			break;
+
+		case SERVER_DEL_WORKINGPAIR:
+			if (request.handle < 1 ||
+				request.handle > propertyServer->no_entries) {
+				response.status = STATUS_INVALID_STRUCT;
+			} else {
+				propertyServer->entries[request.handle - 1].no_references--;
+			}
+			break;
+
+		case SERVER_EVALUATE: {
+			const BatchFunction *function = batch_function(request.function);
+			int n = request.no_points;
+
+			response.handle = request.handle;
+			response.no_points = n;
+
+			if (request.handle < 1 ||
+				request.handle > propertyServer->no_entries) {
+				response.status = STATUS_INVALID_STRUCT;
+				response.no_points = 0;
+				break;
+
+			} else if (function == NULL) {
+				response.status = STATUS_NOT_IMPLEMENTED;
+				response.no_points = 0;
+				break;
+
+			} else if (request.no_inputs != function->no_inputs ||
+				(size_t) request.length_payload != (size_t) n *
+				(size_t) request.no_inputs * sizeof(double)) {
+				response.status = STATUS_INVALID_INPUT;
+				response.no_points = 0;
+				break;
+
+			}
+
+			// Evaluate batch by thread pool: Payload is aligned because it
+			// starts at beginning of malloc-ed buffer
+			//
+			const double *inputs[BATCH_MAX_INPUTS] = {NULL};
+			double *values = (double *) payload_response;
+			double *y_1_molmol = values + n;
+			double *y_2_molmol = values + 2 * (size_t) n;
+
+			for (int i = 0; i < request.no_inputs; i++) {
+				inputs[i] = (const double *) payload + (size_t) i * n;
+			}
+
+			response.no_outputs = function->vapor ? 3 : 1;
+			int *status = (int *) (values + (size_t) n *
+				response.no_outputs);
+
+			if (batch_evaluate(values, function->vapor ? y_1_molmol : NULL,
+				function->vapor ? y_2_molmol : NULL, status, request.function,
+				inputs, n, 0, propertyServer->batchPool,
+				propertyServer->entries[request.handle - 1].workingPair) != 0) {
+				response.status = status_code();
+			}
+
+			length_response = (size_t) n * (response.no_outputs *
+				sizeof(double) + sizeof(int));
+			break;
+		}
+
+		case SERVER_SHUTDOWN:
+			*ret_shutdown = 1;
+			break;
+
+		default:
+			response.status = STATUS_NOT_IMPLEMENTED;
+			break;
+	}
+
+	// Send response
+	//
+	if (server_transfer(client, &response, sizeof(response), 1) != 0 ||
+		server_transfer(client, payload_response, length_response, 1) != 0) {
+		return -1;
+	}
+	return 0;
+}
+#endif
+
+
+/*
+ * newPropertyServer:
+ * ------------------
+ *
+ * Initiates property server: Creates Unix domain socket that is only
+ * accessible by current user and thread pool evaluating batched requests.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path_socket:
+ *		Path of Unix domain socket (i.e., SERVER_SOCKET if NULL). An existing
+ *		socket file is replaced.
+ *	int no_threads:
+ *		Number of threads of pool. If no_threads is smaller than 1, one thread
+ *		per processor is started.
+ *
+ * Returns:
+ * --------
+ *	struct *PropertyServer:
+ *		Returns malloc-ed PropertyServer-struct or NULL if server cannot be
+ *		created.
+ *
+ * Remarks:
+ * --------
+ *	Server is only available on Unix systems.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+PropertyServer *newPropertyServer(const char *path_socket, int no_threads) {
+#ifdef __unix
+	// Allocate memory for server and copy path of socket
+	//
+	path_socket = (path_socket == NULL) ? SERVER_SOCKET : path_socket;
+
+	struct sockaddr_un address;
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+
+	PropertyServer *retPropertyServer = (PropertyServer *) calloc(1,
+		sizeof(PropertyServer));
+
+	if (retPropertyServer == NULL ||
+		strlen(path_socket) >= sizeof(address.sun_path)) {
+		if (status_report(STATUS_NO_MEMORY, "newPropertyServer", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot create PropertyServer-struct for socket "
+				"\"%s\".", path_socket);
+		}
+		free(retPropertyServer);
+		return NULL;
+	}
+
+	retPropertyServer->socket = -1;
+	for (int i = 0; i < SERVER_MAX_CLIENTS; i++) {
+		retPropertyServer->clients[i] = -1;
+	}
+	strcpy(address.sun_path, path_socket);
+
+	// Create socket accessible only by current user and thread pool
+	//
+	retPropertyServer->path_socket = (char *) malloc(strlen(path_socket) + 1);
+	retPropertyServer->batchPool = newBatchPool(no_threads);
+	retPropertyServer->socket = socket(AF_UNIX, SOCK_STREAM, 0);
+
+	if (retPropertyServer->path_socket != NULL) {
+		strcpy(retPropertyServer->path_socket, path_socket);
+		unlink(path_socket);
+	}
+
+	mode_t mask = umask(0077);
+	int failed = retPropertyServer->path_socket == NULL ||
+		retPropertyServer->batchPool == NULL ||
+		retPropertyServer->socket < 0 ||
+		bind(retPropertyServer->socket, (struct sockaddr *) &address,
+			sizeof(address)) != 0 ||
+		listen(retPropertyServer->socket, SERVER_MAX_CLIENTS) != 0;
+	umask(mask);
+
+	if (failed) {
+		if (status_report(STATUS_INVALID_INPUT, "newPropertyServer", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot listen on socket \"%s\".", path_socket);
+		}
+		delPropertyServer(retPropertyServer);
+		return NULL;
+	}
+
+	return retPropertyServer;
+#else
+	(void) path_socket;
+	(void) no_threads;
+
+	if (status_report(STATUS_NOT_IMPLEMENTED, "newPropertyServer", 0, 0)) {
+		printf("\n\n###########\n# Warning #\n###########");
+		printf("\nProperty server is only available on Unix systems.");
+	}
+	return NULL;
+#endif
+}
+
+
+/*
+ * delPropertyServer:
+ * ------------------
+ *
+ * Closes sockets, removes socket file, and frees memory of property server
+ * including its databases and hot working pairs.
+ *
+ * Parameters:
+ * -----------
+ *	struct *PropertyServer:
+ *		Pointer of PropertyServer-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void delPropertyServer(PropertyServer *propertyServer) {
+	if (propertyServer == NULL) {
+		return;
+	}
+
+#ifdef __unix
+	// Close sockets
+	//
+	for (int i = 0; i < SERVER_MAX_CLIENTS; i++) {
+		if (propertyServer->clients[i] >= 0) {
+			close(propertyServer->clients[i]);
+		}
+	}
+
+	if (propertyServer->socket >= 0) {
+		close(propertyServer->socket);
+		unlink(propertyServer->path_socket);
+	}
+#endif
+
+	// Free hot working pairs, databases, and thread pool
+	//
+	for (int i = 0; i < propertyServer->no_entries; i++) {
+		delWorkingPair(propertyServer->entries[i].workingPair);
+		free(propertyServer->entries[i].names);
+	}
+
+	for (int i = 0; i < propertyServer->no_databases; i++) {
+		delDatabase(propertyServer->databases[i]);
+	}
+
+	if (propertyServer->batchPool != NULL) {
+		delBatchPool(propertyServer->batchPool);
+	}
+
+	free(propertyServer->entries);
+	free(propertyServer->databases);
+	free(propertyServer->buffer);
+	free(propertyServer->path_socket);
+	free(propertyServer);
+}
+
+
+/*
+ * propertyServer_run:
+ * -------------------
+ *
+ * Serves requests of clients until a client sends SERVER_SHUTDOWN or until
+ * SIGINT or SIGTERM is received. Requests are served one after another, and
+ * each batch is evaluated in parallel by the thread pool of the server.
+ *
+ * Parameters:
+ * -----------
+ *	struct *PropertyServer:
+ *		Pointer of PropertyServer-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if server was stopped regularly and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int propertyServer_run(PropertyServer *propertyServer) {
+	if (propertyServer == NULL) {
+		return -1;
+	}
+
+#ifdef __unix
+	// Stop server after current request when SIGINT or SIGTERM is received
+	//
+	struct sigaction action;
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = &server_signal;
+	sigemptyset(&action.sa_mask);
+	sigaction(SIGINT, &action, NULL);
+	sigaction(SIGTERM, &action, NULL);
+
+	int shutdown = 0;
+	server_stop = 0;
+
+	while (!shutdown && !server_stop) {
+		// Wait for new clients and requests
+		//
+		struct pollfd fds[SERVER_MAX_CLIENTS + 1];
+		int no_fds = 1;
+
+		fds[0].fd = propertyServer->socket;
+		fds[0].events = POLLIN;
+
+		for (int i = 0; i < SERVER_MAX_CLIENTS; i++) {
+			if (propertyServer->clients[i] >= 0) {
+				fds[no_fds].fd = propertyServer->clients[i];
+				fds[no_fds++].events = POLLIN;
+			}
+		}
+
+		if (poll(fds, (nfds_t) no_fds, -1) < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return -1;
+		}
+
+		// Serve requests of connected clients: Clients are disconnected in
+		// case of invalid requests
+		//
+		for (int i = 1; i < no_fds && !shutdown; i++) {
+			if (fds[i].revents == 0) {
+				continue;
+			}
+
+			if (server_request(&shutdown, propertyServer, fds[i].fd) != 0) {
+				close(fds[i].fd);
+
+				for (int j = 0; j < SERVER_MAX_CLIENTS; j++) {
+					if (propertyServer->clients[j] == fds[i].fd) {
+						propertyServer->clients[j] = -1;
+					}
+				}
+			}
+		}
+
+		// Accept new client: Clients exceeding limit are rejected
+		//
+		if (fds[0].revents & POLLIN) {
+			int client = accept(propertyServer->socket, NULL, NULL);
+
+			for (int j = 0; j < SERVER_MAX_CLIENTS && client >= 0; j++) {
+				if (propertyServer->clients[j] < 0) {
+					propertyServer->clients[j] = client;
+					client = -1;
+				}
+			}
+
+			if (client >= 0) {
+				close(client);
+			}
+		}
+	}
+	return 0;
+#else
+	return -1;
+#endif
+}
@@ -4,13 +4,57 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include "referenceCounter.h"
 #include "refrigerant.h"
 #include "refrigerant_cubicEoS.h"
 #include "refrigerant_saturatedLiquidDensity.h"
 #include "refrigerant_vaporPressure.h"
+#include "threadLocal.h"
+#include "status.h"
 #include "structDefinitions.c"
 
 
+/////////////////////////////
+// Definition of constants //
+/////////////////////////////
+#ifndef REFRIGERANT_NO_CACHE_SLOTS
+#define REFRIGERANT_NO_CACHE_SLOTS 16
+#endif
+
+
+/////////////////////////////
+// Definition of variables //
+/////////////////////////////
+/*
+ * Number of IDs that are assigned to Refrigerant-structs with enabled cache.
+ * IDs are never reused. Thus, cache cannot return results of a freed struct
+ * whose memory is reused by another struct.
+ *
+ */
+long refrigerant_no_cache_ids = 0;
+
+/*
+ * Per-thread caches of vapor pressure and derivative of vapor pressure wrt.
+ * temperature: Each cache is direct-mapped by ID of Refrigerant-struct and
+ * stores ID, temperature in K, result, and status of last calculation. Thus,
+ * working pairs with different refrigerants evaluated alternately do not evict
+ * each other's results, and failures are reported again by cached results.
+ *
+ */
+THREAD_LOCAL long refrigerant_cache_p_sat_id[REFRIGERANT_NO_CACHE_SLOTS];
+THREAD_LOCAL double refrigerant_cache_p_sat_T_K[REFRIGERANT_NO_CACHE_SLOTS];
+THREAD_LOCAL double refrigerant_cache_p_sat_Pa[REFRIGERANT_NO_CACHE_SLOTS];
+THREAD_LOCAL Status refrigerant_cache_p_sat_status[REFRIGERANT_NO_CACHE_SLOTS];
+
+THREAD_LOCAL long refrigerant_cache_dp_sat_dT_id[REFRIGERANT_NO_CACHE_SLOTS];
+THREAD_LOCAL double refrigerant_cache_dp_sat_dT_T_K[
+	REFRIGERANT_NO_CACHE_SLOTS];
+THREAD_LOCAL double refrigerant_cache_dp_sat_dT_PaK[
+	REFRIGERANT_NO_CACHE_SLOTS];
+THREAD_LOCAL Status refrigerant_cache_dp_sat_dT_status[
+	REFRIGERANT_NO_CACHE_SLOTS];
+
+
 /////////////////////////////
 // Definition of functions //
 /////////////////////////////
@@ -57,11 +101,17 @@ Refrigerant *newRefrigerant(const char *vaporPressure_approach,
     if (retRefrigerant == NULL) {
 		// Not enough memory available for Refrigerant-struct
 		//
-		printf("\n\n###########\n# Warning #\n###########");
-		printf("\nCannot allocate memory for Refrigerant-struct.");
+		if (status_report(STATUS_NO_MEMORY, "newRefrigerant", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for Refrigerant-struct.");
+		}
         return NULL;
 	}
 
+	// Initialize number of references
+	//
+	retRefrigerant->no_references = 1;
+
 	// Initialize all function pointers with NULL because NULL is used by
 	// functions of Ad-/Absorption-struct and WorkingPair-struct to check if
 	// refrigerant function is implemented or not
@@ -81,6 +131,10 @@ Refrigerant *newRefrigerant(const char *vaporPressure_approach,
 	retRefrigerant->cubic_gen_eos_parameters = NULL;
 	retRefrigerant->cubic_fug_coefficient = NULL;
 
+	retRefrigerant->uncached_p_sat_T = NULL;
+	retRefrigerant->uncached_dp_sat_dT = NULL;
+	retRefrigerant->cache_id = 0;
+
 	// Set function pointers for vapor pressure
 	//
 	if (strcmp(vaporPressure_approach, "VaporPressure_EoS1") == 0) {
@@ -125,10 +179,13 @@ Refrigerant *newRefrigerant(const char *vaporPressure_approach,
 		if (refrigerant_par == NULL) {
 			// Parameters are not given
 			//
-			printf("\n\n###########\n# Warning #\n###########");
-			printf("\nParameters for saturated vapor pressure are not given. "
-				"Therefore, cannot select and execute cubic equation of "
-				"state!");
+			if (status_report(STATUS_INVALID_INPUT, "newRefrigerant", 0, 0)) {
+				printf("\n\n###########\n# Warning #\n###########");
+				printf("\nParameters for saturated vapor pressure are not "
+					"given. "
+					"Therefore, cannot select and execute cubic equation of "
+					"state!");
+			}
 			free(retRefrigerant);
 			return NULL;
 		}
@@ -195,9 +252,12 @@ Refrigerant *newRefrigerant(const char *vaporPressure_approach,
 	} else {
 		// Calculation approach does not exist. Therefore, throw warning.
 		//
-		printf("\n\n###########\n# Warning #\n###########");
-		printf("\nChosen approach \"%s\" does not exist for vapor pressure.",
-			vaporPressure_approach);
+		if (status_report(STATUS_NOT_IMPLEMENTED, "newRefrigerant", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nChosen approach \"%s\" does not exist for vapor "
+				"pressure.",
+				vaporPressure_approach);
+		}
 
 	}
 
@@ -211,9 +271,11 @@ Refrigerant *newRefrigerant(const char *vaporPressure_approach,
 	} else {
 		// Calculation approach does not exist. Therefore, throw warning.
 		//
-		printf("\n\n###########\n# Warning #\n###########");
-		printf("\nChosen approach \"%s\" does not exist for saturated liquid "
-			"density.", saturatedLiquidDensity_approach);
+		if (status_report(STATUS_NOT_IMPLEMENTED, "newRefrigerant", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nChosen approach \"%s\" does not exist for saturated "
+				"liquid density.", saturatedLiquidDensity_approach);
+		}
 
 	}
 
@@ -228,6 +290,8 @@ Refrigerant *newRefrigerant(const char *vaporPressure_approach,
  * ---------------
  *
  * Destructor function to free allocated memory of a Refrigerant-struct.
+ * If struct is shared by several working pairs, function only decrements
+ * number of references and frees memory when last reference is deleted.
  *
  * Parameters:
  * -----------
@@ -238,6 +302,8 @@ Refrigerant *newRefrigerant(const char *vaporPressure_approach,
  * --------
  *	01/05/2020, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Added number of references.
  *
  */
 void delRefrigerant(void *refrigerant) {
@@ -247,7 +313,8 @@ void delRefrigerant(void *refrigerant) {
 
     // Because of initialization function, refrigerant is NULL or fully built
 	//
-    if (retRefrigerant != NULL) {
+    if (retRefrigerant != NULL &&
+		REFERENCES_DECREMENT(&retRefrigerant->no_references) == 0) {
 		free(retRefrigerant);
     }
 }
@@ -536,3 +603,215 @@ double refrigerant_cubic_dp_sat_dT(double T_K, double refrigerant_par[],
 	retRefrigerant->cubic_gen_eos_parameters,
 	retRefrigerant->cubic_fug_coefficient, refrigerant_par);
 }
+
+
+/*
+ * refrigerant_enable_cache:
+ * -------------------------
+ *
+ * Auxiliary function to enable the per-thread cache of the vapor pressure and
+ * its derivative wrt. temperature. Therefore, function pointers p_sat_T and
+ * dp_sat_dT are replaced by cached functions and struct gets a unique ID.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Refrigerant
+ *		Pointer of Refrigerant-struct.
+ *
+ * Remarks:
+ * --------
+ *	Cache should only be enabled for structs that are shared by several working
+ *	pairs (e.g., refrigerants interned by Database-struct). Then, evaluating
+ *	all working pairs at the same temperature calculates the vapor pressure
+ *	only once per thread. Cache must be enabled before struct is shared.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void refrigerant_enable_cache(Refrigerant *refrigerant) {
+	// Check if cache is already enabled or vapor pressure does not exist
+	//
+	if (refrigerant == NULL || refrigerant->cache_id != 0 ||
+		refrigerant->p_sat_T == NULL) {
+		return;
+	}
+
+	// Wrap vapor pressure functions by cached functions
+	//
+	refrigerant->cache_id = REFERENCES_INCREMENT(&refrigerant_no_cache_ids);
+
+	refrigerant->uncached_p_sat_T = refrigerant->p_sat_T;
+	refrigerant->p_sat_T = &refrigerant_cached_p_sat;
+
+	if (refrigerant->dp_sat_dT != NULL) {
+		refrigerant->uncached_dp_sat_dT = refrigerant->dp_sat_dT;
+		refrigerant->dp_sat_dT = &refrigerant_cached_dp_sat_dT;
+	}
+}
+
+
+/*
+ * refrigerant_cached_p_sat:
+ * -------------------------
+ *
+ * Calculates vapor pressure in Pa depending on saturation temperature T in K
+ * if cache is enabled. If the same thread has calculated the vapor pressure of
+ * the same Refrigerant-struct at the same temperature before, the cached
+ * result is returned.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Saturation temperature in K.
+ *	double refrigerant_par[]:
+ *		Array of doubles that contains coefficients for refrigerant function.
+ * 	struct *Refrigerant
+ *		Pointer of Refrigerant-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Vapor pressure in Pa.
+ *
+ * Remarks:
+ * --------
+ *	Due to initialization procedure of Refrigerant-struct, this function is only
+ *	callable when Refrigerant-struct and sub-functions exist. Thus, no further
+ *	checks are necessary. Status of calculation is cached together with
+ *	result: If calculation failed, each call at the same temperature reports
+ *	failure again in status record, but warning is only printed once.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double refrigerant_cached_p_sat(double T_K, double refrigerant_par[],
+	void *refrigerant) {
+	// Typecast void pointer given as input to pointer of Refrigerant-struct
+	//
+	Refrigerant *retRefrigerant = (Refrigerant *) refrigerant;
+
+	// Calculate vapor pressure only if not cached by current thread
+	//
+	int slot = (int) (retRefrigerant->cache_id % REFRIGERANT_NO_CACHE_SLOTS);
+
+	if (refrigerant_cache_p_sat_id[slot] == retRefrigerant->cache_id &&
+		refrigerant_cache_p_sat_T_K[slot] == T_K) {
+		Status *status = &refrigerant_cache_p_sat_status[slot];
+
+		if (status->code != STATUS_OK) {
+			status_report(status->code, status->function, status->iterations,
+				status->residual);
+		}
+		return refrigerant_cache_p_sat_Pa[slot];
+	}
+
+	// Calculate result with reset status code to cache status of calculation
+	// only: Afterwards, restore status record if calculation did not fail
+	//
+	Status status_previous = status_record();
+	status_code();
+
+	double p_sat_Pa = retRefrigerant->uncached_p_sat_T(T_K, refrigerant_par,
+		refrigerant);
+	Status status_current = status_record();
+
+	if (status_current.code == STATUS_OK) {
+		status_report(status_previous.code, status_previous.function,
+			status_previous.iterations, status_previous.residual);
+	}
+
+	refrigerant_cache_p_sat_id[slot] = retRefrigerant->cache_id;
+	refrigerant_cache_p_sat_T_K[slot] = T_K;
+	refrigerant_cache_p_sat_Pa[slot] = p_sat_Pa;
+	refrigerant_cache_p_sat_status[slot] = status_current;
+
+	return p_sat_Pa;
+}
+
+
+/*
+ * refrigerant_cached_dp_sat_dT:
+ * -----------------------------
+ *
+ * Calculates derivative of vapor pressure wrt. temperature in Pa/K depending
+ * on saturation temperature T in K if cache is enabled. If the same thread has
+ * calculated the derivative of the same Refrigerant-struct at the same
+ * temperature before, the cached result is returned.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Saturation temperature in K.
+ *	double refrigerant_par[]:
+ *		Array of doubles that contains coefficients for refrigerant function.
+ * 	struct *Refrigerant
+ *		Pointer of Refrigerant-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of vapor pressure wrt. temperature in Pa/K.
+ *
+ * Remarks:
+ * --------
+ *	Due to initialization procedure of Refrigerant-struct, this function is only
+ *	callable when Refrigerant-struct and sub-functions exist. Thus, no further
+ *	checks are necessary. Status of calculation is cached together with
+ *	result: If calculation failed, each call at the same temperature reports
+ *	failure again in status record, but warning is only printed once.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double refrigerant_cached_dp_sat_dT(double T_K, double refrigerant_par[],
+	void *refrigerant) {
+	// Typecast void pointer given as input to pointer of Refrigerant-struct
+	//
+	Refrigerant *retRefrigerant = (Refrigerant *) refrigerant;
+
+	// Calculate derivative only if not cached by current thread
+	//
+	int slot = (int) (retRefrigerant->cache_id % REFRIGERANT_NO_CACHE_SLOTS);
+
+	if (refrigerant_cache_dp_sat_dT_id[slot] == retRefrigerant->cache_id &&
+		refrigerant_cache_dp_sat_dT_T_K[slot] == T_K) {
+		Status *status = &refrigerant_cache_dp_sat_dT_status[slot];
+
+		if (status->code != STATUS_OK) {
+			status_report(status->code, status->function, status->iterations,
+				status->residual);
+		}
+		return refrigerant_cache_dp_sat_dT_PaK[slot];
+	}
+
+	// Calculate result with reset status code to cache status of calculation
+	// only: Afterwards, restore status record if calculation did not fail
+	//
+	Status status_previous = status_record();
+	status_code();
+
+	double dp_sat_dT_PaK = retRefrigerant->uncached_dp_sat_dT(T_K,
+		refrigerant_par, refrigerant);
+	Status status_current = status_record();
+
+	if (status_current.code == STATUS_OK) {
+		status_report(status_previous.code, status_previous.function,
+			status_previous.iterations, status_previous.residual);
+	}
+
+	refrigerant_cache_dp_sat_dT_id[slot] = retRefrigerant->cache_id;
+	refrigerant_cache_dp_sat_dT_T_K[slot] = T_K;
+	refrigerant_cache_dp_sat_dT_PaK[slot] = dp_sat_dT_PaK;
+	refrigerant_cache_dp_sat_dT_status[slot] = status_current;
+
+	return dp_sat_dT_PaK;
+}
@@ -0,0 +1,1244 @@
+/////////////////////////
+// refrigerantHandle.c //
+/////////////////////////
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "database.h"
+#include "refrigerant.h"
+#include "refrigerantHandle.h"
+#include "surrogate.h"
+#include "workingPair.h"
+#include "status.h"
+#include "structDefinitions.c"
+
+
+///////////////////////////
+// Definition of structs //
+///////////////////////////
+/*
+ * RefrigerantHandle:
+ * ------------------
+ *
+ * Contains strings defining refrigerant and calculation approaches,
+ * coefficients for calculation approaches, and structure that contains
+ * function pointers for the refrigerant functions. In contrast to the
+ * WorkingPair-struct, no isotherm is required.
+ *
+ * Attributes:
+ * -----------
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * 	double *psat_par:
+ *		Array containing coefficients of vapor pressure equation.
+ * 	double *rhol_par:
+ *		Array containing coefficients of saturated liquid density equation.
+ *	int no_psat_par:
+ *		Number of coefficients of vapor pressure equation.
+ *	int no_rhol_par:
+ *		Number of coefficients of saturated liquid density equation.
+ *
+ *	Refrigerant *refrigerant:
+ *		Struct containing function pointers for refrigerant functions.
+ *	RefrigerantParameters *refrigerant_parameters:
+ *		Struct interned by database that owns coefficients of refrigerant
+ *		functions and Refrigerant-struct.
+ *
+ *	Surrogate *surrogate_p_sat:
+ *		Surrogate of vapor pressure depending on temperature (i.e., NULL if
+ *		surrogates are disabled).
+ *	Surrogate *surrogate_dp_sat_dT:
+ *		Surrogate of derivative of vapor pressure wrt. temperature depending on
+ *		temperature.
+ *	Surrogate *surrogate_rho_l:
+ *		Surrogate of saturated liquid density depending on temperature.
+ *	Surrogate *surrogate_T_sat:
+ *		Surrogate of saturation temperature depending on logarithm of pressure.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * newRefrigerantHandle:
+ * ---------------------
+ *
+ * Initialization function to create a new RefrigerantHandle-struct. Therefore,
+ * function reads coefficients of refrigerant functions from the entry of the
+ * refrigerant within the database (i.e. entry of type "refrig"). Coefficients
+ * and Refrigerant-struct are interned by the database and shared with working
+ * pairs using the same refrigerant. In contrast to newWorkingPair, no isotherm
+ * is searched. If refrigerant cannot be found or memory allocation fails,
+ * functions returns NULL and prints a warning.
+ *
+ * Parameters:
+ * -----------
+ *	struct *Database:
+ *		Pointer of Database-struct.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	struct *RefrigerantHandle:
+ *		Returns malloc-ed RefrigerantHandle-struct containing all information
+ *		required to calculate the saturation properties of the refrigerant.
+ *
+ * Remarks:
+ * --------
+ *	Strings are not copied and must stay valid as long as the
+ *	RefrigerantHandle-struct is used.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API RefrigerantHandle *newRefrigerantHandle(Database *database,
+	const char *wp_rf, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol) {
+	// Check if database exists
+	//
+	if (database == NULL) {
+		if (status_report(STATUS_INVALID_STRUCT, "newRefrigerantHandle",
+			0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nDatabase-struct does not exist.");
+		}
+		return NULL;
+	}
+
+    // Try to allocate memory for RefrigerantHandle-struct
+	//
+    RefrigerantHandle *retRefrigerantHandle = (RefrigerantHandle *) malloc(
+		sizeof(RefrigerantHandle));
+
+    if (retRefrigerantHandle == NULL) {
+		// Not enough memory available for RefrigerantHandle-struct
+		//
+		if (status_report(STATUS_NO_MEMORY, "newRefrigerantHandle", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for RefrigerantHandle-struct.");
+		}
+        return NULL;
+	}
+
+    // Set general information of refrigerant
+	//
+	retRefrigerantHandle->wp_rf = wp_rf;
+	retRefrigerantHandle->rf_psat = rf_psat;
+	retRefrigerantHandle->rf_rhol = rf_rhol;
+	retRefrigerantHandle->no_p_sat = no_p_sat;
+	retRefrigerantHandle->no_rhol = no_rhol;
+
+	// Get coefficients for refrigerant equations and Refrigerant-struct
+	// interned by database
+	//
+	retRefrigerantHandle->refrigerant_parameters =
+		database_refrigerant_parameters(database, wp_rf, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
+
+    if (retRefrigerantHandle->refrigerant_parameters == NULL) {
+		// Cannot select refrigerant, free memory
+		//
+		if (status_report(STATUS_INVALID_INPUT, "newRefrigerantHandle", 0, 0)) {
+			printf("\n\n###########\n# Error #\n###########");
+			printf("\nCannot select refrigerant \"%s\"! See warnings printed "
+				"before!", wp_rf);
+		}
+		free(retRefrigerantHandle);
+        return NULL;
+	}
+
+	// Share coefficients for vapor pressure and saturated liquid density:
+	// If function and thus coefficients are not implemented, pointer is set to
+	// NULL
+	//
+	retRefrigerantHandle->psat_par =
+		retRefrigerantHandle->refrigerant_parameters->psat_par;
+	retRefrigerantHandle->rhol_par =
+		retRefrigerantHandle->refrigerant_parameters->rhol_par;
+	retRefrigerantHandle->no_psat_par =
+		retRefrigerantHandle->refrigerant_parameters->no_psat_par;
+	retRefrigerantHandle->no_rhol_par =
+		retRefrigerantHandle->refrigerant_parameters->no_rhol_par;
+	retRefrigerantHandle->refrigerant =
+		retRefrigerantHandle->refrigerant_parameters->refrigerant;
+
+	retRefrigerantHandle->surrogate_p_sat = NULL;
+	retRefrigerantHandle->surrogate_dp_sat_dT = NULL;
+	retRefrigerantHandle->surrogate_rho_l = NULL;
+	retRefrigerantHandle->surrogate_T_sat = NULL;
+
+	// Return structure
+	//
+	return retRefrigerantHandle;
+}
+
+
+/*
+ * delRefrigerantHandle:
+ * ---------------------
+ *
+ * Destructor function to free allocated memory of a RefrigerantHandle-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void delRefrigerantHandle(void *refrigerantHandle) {
+	// Typecast void pointer given as input to pointer of
+	// RefrigerantHandle-struct
+	//
+	RefrigerantHandle *retRefrigerantHandle =
+		(RefrigerantHandle *) refrigerantHandle;
+
+    // Because of initialization function, refrigerantHandle is NULL or fully
+	// built
+	//
+    if (retRefrigerantHandle != NULL) {
+		refh_disable_surrogate(retRefrigerantHandle);
+		delRefrigerantParameters(retRefrigerantHandle->refrigerant_parameters);
+		free(retRefrigerantHandle);
+    }
+}
+
+
+/*
+ * refh_enable_surrogate:
+ * ----------------------
+ *
+ * Creates surrogates of vapor pressure, its derivative wrt. temperature,
+ * saturated liquid density, and saturation temperature. Afterwards, all
+ * functions of the RefrigerantHandle-struct are evaluated by piecewise
+ * Chebyshev polynomials instead of the original equations. The surrogates
+ * meet the maximal relative error given as input. Saturation temperature is
+ * approximated depending on the logarithm of the pressure.
+ *
+ * Parameters:
+ * -----------
+ *	double T_min_K:
+ *		Lower limit of temperature in K.
+ *	double T_max_K:
+ *		Upper limit of temperature in K.
+ *	double max_rel_error:
+ *		Maximal relative error of surrogates.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if surrogates are created for all existing functions and -1
+ *		otherwise. In case of an error, surrogates are disabled.
+ *
+ * Remarks:
+ * --------
+ *	If T_min_K is not smaller than T_max_K, ranges of validity of equations
+ *	given by the database are used. Outside of limits and within intervals
+ *	whose approximation is not accurate enough (e.g., close to the critical
+ *	point), original equations are evaluated. Derivative of saturated liquid
+ *	density is always evaluated by the original equation.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int refh_enable_surrogate(double T_min_K, double T_max_K,
+	double max_rel_error, void *refrigerantHandle) {
+	// Typecast void pointers given as inputs to correct structs
+	//
+	RefrigerantHandle *retRefrigerantHandle =
+		(RefrigerantHandle *) refrigerantHandle;
+
+	if (retRefrigerantHandle == NULL) {
+		warning_struct("refrigerantHandle", "refh_enable_surrogate");
+		return -1;
+	}
+
+	// Free existing surrogates and select limits of temperature
+	//
+	refh_disable_surrogate(retRefrigerantHandle);
+
+	Refrigerant *refrigerant = retRefrigerantHandle->refrigerant;
+	RefrigerantParameters *entry =
+		retRefrigerantHandle->refrigerant_parameters;
+	int use_limits = (T_min_K < T_max_K);
+	int no_missing = 0;
+
+	// Create surrogates of vapor pressure equation
+	//
+	if (refrigerant->p_sat_T != NULL &&
+		retRefrigerantHandle->psat_par != NULL) {
+		double T_min_psat_K = use_limits ? T_min_K : entry->T_min_psat_K;
+		double T_max_psat_K = use_limits ? T_max_K : entry->T_max_psat_K;
+
+		retRefrigerantHandle->surrogate_p_sat = newSurrogate(
+			&refh_exact_p_sat_T, retRefrigerantHandle, T_min_psat_K,
+			T_max_psat_K, max_rel_error);
+		no_missing += (retRefrigerantHandle->surrogate_p_sat == NULL);
+
+		if (refrigerant->dp_sat_dT != NULL) {
+			retRefrigerantHandle->surrogate_dp_sat_dT = newSurrogate(
+				&refh_exact_dp_sat_dT_T, retRefrigerantHandle, T_min_psat_K,
+				T_max_psat_K, max_rel_error);
+			no_missing += (retRefrigerantHandle->surrogate_dp_sat_dT == NULL);
+		}
+
+		if (refrigerant->T_sat_p != NULL && no_missing == 0) {
+			retRefrigerantHandle->surrogate_T_sat = newSurrogate(
+				&refh_exact_T_sat_lnp, retRefrigerantHandle,
+				log(refh_exact_p_sat_T(T_min_psat_K, retRefrigerantHandle)),
+				log(refh_exact_p_sat_T(T_max_psat_K, retRefrigerantHandle)),
+				max_rel_error);
+			no_missing += (retRefrigerantHandle->surrogate_T_sat == NULL);
+		}
+	}
+
+	// Create surrogate of saturated liquid density equation
+	//
+	if (refrigerant->rho_l_T != NULL &&
+		retRefrigerantHandle->rhol_par != NULL) {
+		retRefrigerantHandle->surrogate_rho_l = newSurrogate(
+			&refh_exact_rho_l_T, retRefrigerantHandle,
+			use_limits ? T_min_K : entry->T_min_rhol_K,
+			use_limits ? T_max_K : entry->T_max_rhol_K, max_rel_error);
+		no_missing += (retRefrigerantHandle->surrogate_rho_l == NULL);
+	}
+
+	// Disable all surrogates if one surrogate cannot be created
+	//
+	if (no_missing > 0) {
+		if (status_report(STATUS_INVALID_INPUT, "refh_enable_surrogate",
+			0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot create surrogates for refrigerant \"%s\". Check "
+				"limits of temperature!", retRefrigerantHandle->wp_rf);
+		}
+		refh_disable_surrogate(retRefrigerantHandle);
+		return -1;
+	}
+
+	return 0;
+}
+
+
+/*
+ * refh_disable_surrogate:
+ * -----------------------
+ *
+ * Frees surrogates of RefrigerantHandle-struct. Afterwards, all functions of
+ * the RefrigerantHandle-struct are evaluated by the original equations.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void refh_disable_surrogate(void *refrigerantHandle) {
+	// Typecast void pointers given as inputs to correct structs
+	//
+	RefrigerantHandle *retRefrigerantHandle =
+		(RefrigerantHandle *) refrigerantHandle;
+
+	if (retRefrigerantHandle != NULL) {
+		delSurrogate(retRefrigerantHandle->surrogate_p_sat);
+		delSurrogate(retRefrigerantHandle->surrogate_dp_sat_dT);
+		delSurrogate(retRefrigerantHandle->surrogate_rho_l);
+		delSurrogate(retRefrigerantHandle->surrogate_T_sat);
+
+		retRefrigerantHandle->surrogate_p_sat = NULL;
+		retRefrigerantHandle->surrogate_dp_sat_dT = NULL;
+		retRefrigerantHandle->surrogate_rho_l = NULL;
+		retRefrigerantHandle->surrogate_T_sat = NULL;
+	}
+}
+
+
+/*
+ * refh_exact_p_sat_T:
+ * -------------------
+ *
+ * Auxiliary function to calculate saturation pressure in Pa depending on
+ * equilibrium temperature T in K by the original equation. Function is
+ * approximated by surrogate.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Saturation pressure in Pa.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double refh_exact_p_sat_T(double T_K, void *refrigerantHandle) {
+	RefrigerantHandle *retRefrigerantHandle =
+		(RefrigerantHandle *) refrigerantHandle;
+
+	return retRefrigerantHandle->refrigerant->p_sat_T(T_K,
+		retRefrigerantHandle->psat_par, retRefrigerantHandle->refrigerant);
+}
+
+
+/*
+ * refh_exact_dp_sat_dT_T:
+ * -----------------------
+ *
+ * Auxiliary function to calculate derivative of saturation pressure in Pa/K
+ * wrt to temperature depending on equilibrium temperature T in K by the
+ * original equation. Function is approximated by surrogate.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double refh_exact_dp_sat_dT_T(double T_K, void *refrigerantHandle) {
+	RefrigerantHandle *retRefrigerantHandle =
+		(RefrigerantHandle *) refrigerantHandle;
+
+	return retRefrigerantHandle->refrigerant->dp_sat_dT(T_K,
+		retRefrigerantHandle->psat_par, retRefrigerantHandle->refrigerant);
+}
+
+
+/*
+ * refh_exact_rho_l_T:
+ * -------------------
+ *
+ * Auxiliary function to calculate saturated liquid density in kg/m3 depending
+ * on equilibrium temperature T in K by the original equation. Function is
+ * approximated by surrogate.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Saturated liquid density in kg/m3.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double refh_exact_rho_l_T(double T_K, void *refrigerantHandle) {
+	RefrigerantHandle *retRefrigerantHandle =
+		(RefrigerantHandle *) refrigerantHandle;
+
+	return retRefrigerantHandle->refrigerant->rho_l_T(T_K,
+		retRefrigerantHandle->rhol_par);
+}
+
+
+/*
+ * refh_exact_T_sat_lnp:
+ * ---------------------
+ *
+ * Auxiliary function to calculate saturation temperature in K depending on
+ * logarithm of pressure ln(p) in ln(Pa) by the original equation. Function is
+ * approximated by surrogate.
+ *
+ * Parameters:
+ * -----------
+ *	double ln_p_Pa:
+ *		Logarithm of pressure in ln(Pa).
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Saturation temperature in K.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double refh_exact_T_sat_lnp(double ln_p_Pa, void *refrigerantHandle) {
+	RefrigerantHandle *retRefrigerantHandle =
+		(RefrigerantHandle *) refrigerantHandle;
+
+	return retRefrigerantHandle->refrigerant->T_sat_p(exp(ln_p_Pa),
+		retRefrigerantHandle->psat_par, retRefrigerantHandle->refrigerant);
+}
+
+
+///////////////////////////////////////////////
+// Definition of functions for single states //
+///////////////////////////////////////////////
+/*
+ * refh_p_sat_T:
+ * -------------
+ *
+ * Calculates saturation pressure in Pa depending on equilibrium temperature T
+ * in K.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Saturation pressure in Pa.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double refh_p_sat_T(double T_K, void *refrigerantHandle) {
+	// Typecast void pointers given as inputs to correct structs
+	//
+	RefrigerantHandle *retRefrigerantHandle =
+		(RefrigerantHandle *) refrigerantHandle;
+
+	if (retRefrigerantHandle == NULL) {
+		return warning_struct("refrigerantHandle", "refh_p_sat_T");
+	}
+
+	// Check if refrigerant function exists for chosen refrigerant
+	//
+	if (retRefrigerantHandle->refrigerant->p_sat_T == NULL) {
+		return warning_function("p_sat_T", "refh_p_sat_T");
+
+	} else if (retRefrigerantHandle->psat_par == NULL) {
+		return warning_parameter("the saturated vapor pressure",
+			"refh_p_sat_T");
+
+	} else if (retRefrigerantHandle->surrogate_p_sat != NULL) {
+		return surrogate_evaluate(T_K, retRefrigerantHandle->surrogate_p_sat);
+
+	} else {
+		return retRefrigerantHandle->refrigerant->p_sat_T(T_K,
+			retRefrigerantHandle->psat_par, retRefrigerantHandle->refrigerant);
+
+	}
+}
+
+
+/*
+ * refh_dp_sat_dT_T:
+ * -----------------
+ *
+ * Calculates derivative of saturation pressure in Pa/K wrt to temperature
+ * depending on equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double refh_dp_sat_dT_T(double T_K, void *refrigerantHandle) {
+	// Typecast void pointers given as inputs to correct structs
+	//
+	RefrigerantHandle *retRefrigerantHandle =
+		(RefrigerantHandle *) refrigerantHandle;
+
+	if (retRefrigerantHandle == NULL) {
+		return warning_struct("refrigerantHandle", "refh_dp_sat_dT_T");
+	}
+
+	// Check if refrigerant function exists for chosen refrigerant
+	//
+	if (retRefrigerantHandle->refrigerant->dp_sat_dT == NULL) {
+		return warning_function("dp_sat_dT", "refh_dp_sat_dT_T");
+
+	} else if (retRefrigerantHandle->psat_par == NULL) {
+		return warning_parameter("the derivative of the saturated vapor "
+			"pressure with respect to temperature",
+			"refh_dp_sat_dT_T");
+
+	} else if (retRefrigerantHandle->surrogate_dp_sat_dT != NULL) {
+		return surrogate_evaluate(T_K,
+			retRefrigerantHandle->surrogate_dp_sat_dT);
+
+	} else {
+		return retRefrigerantHandle->refrigerant->dp_sat_dT(T_K,
+			retRefrigerantHandle->psat_par, retRefrigerantHandle->refrigerant);
+
+	}
+}
+
+
+/*
+ * refh_rho_l_T:
+ * -------------
+ *
+ * Calculates saturated liquid density in kg/m3 depending on equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Saturated liquid density in kg/m3.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double refh_rho_l_T(double T_K, void *refrigerantHandle) {
+	// Typecast void pointers given as inputs to correct structs
+	//
+	RefrigerantHandle *retRefrigerantHandle =
+		(RefrigerantHandle *) refrigerantHandle;
+
+	if (retRefrigerantHandle == NULL) {
+		return warning_struct("refrigerantHandle", "refh_rho_l_T");
+	}
+
+	// Check if refrigerant function exists for chosen refrigerant
+	//
+	if (retRefrigerantHandle->refrigerant->rho_l_T == NULL) {
+		return warning_function("rho_l_T", "refh_rho_l_T");
+
+	} else if (retRefrigerantHandle->rhol_par == NULL) {
+		return warning_parameter("the saturated liquid density",
+			"refh_rho_l_T");
+
+	} else if (retRefrigerantHandle->surrogate_rho_l != NULL) {
+		return surrogate_evaluate(T_K, retRefrigerantHandle->surrogate_rho_l);
+
+	} else {
+		return retRefrigerantHandle->refrigerant->rho_l_T(T_K,
+			retRefrigerantHandle->rhol_par);
+
+	}
+}
+
+
+/*
+ * refh_drho_l_dT_T:
+ * -----------------
+ *
+ * Calculates derivative of saturated liquid density in kg/m3/K wrt to
+ * temperature depending on equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of saturated liquid density wrt. temperature in kg/m3/K.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double refh_drho_l_dT_T(double T_K, void *refrigerantHandle) {
+	// Typecast void pointers given as inputs to correct structs
+	//
+	RefrigerantHandle *retRefrigerantHandle =
+		(RefrigerantHandle *) refrigerantHandle;
+
+	if (retRefrigerantHandle == NULL) {
+		return warning_struct("refrigerantHandle", "refh_drho_l_dT_T");
+	}
+
+	// Check if refrigerant function exists for chosen refrigerant
+	//
+	if (retRefrigerantHandle->refrigerant->drho_l_dT == NULL) {
+		return warning_function("drho_l_dT", "refh_drho_l_dT_T");
+
+	} else if (retRefrigerantHandle->rhol_par == NULL) {
+		return warning_parameter("the derivative of the saturated liquid "
+			"density with respect to temperature",
+			"refh_drho_l_dT_T");
+
+	} else {
+		return retRefrigerantHandle->refrigerant->drho_l_dT(T_K,
+			retRefrigerantHandle->rhol_par);
+
+	}
+}
+
+
+/*
+ * refh_T_sat_p:
+ * -------------
+ *
+ * Calculates saturation temperature in K depending on equilibrium pressure p
+ * in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Saturation pressure in Pa.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium temperature in K.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double refh_T_sat_p(double p_Pa, void *refrigerantHandle) {
+	// Typecast void pointers given as inputs to correct structs
+	//
+	RefrigerantHandle *retRefrigerantHandle =
+		(RefrigerantHandle *) refrigerantHandle;
+
+	if (retRefrigerantHandle == NULL) {
+		return warning_struct("refrigerantHandle", "refh_T_sat_p");
+	}
+
+	// Check if refrigerant function exists for chosen refrigerant
+	//
+	if (retRefrigerantHandle->refrigerant->T_sat_p == NULL) {
+		return warning_function("T_sat_p", "refh_T_sat_p");
+
+	} else if (retRefrigerantHandle->psat_par == NULL) {
+		return warning_parameter("the saturated vapor pressure",
+			"refh_T_sat_p");
+
+	} else if (retRefrigerantHandle->surrogate_T_sat != NULL) {
+		// States not approximated by surrogate are calculated with original
+		// pressure to avoid round-off errors of logarithm
+		//
+		double T_sat_K;
+
+		return (surrogate_approximate(&T_sat_K, log(p_Pa),
+			retRefrigerantHandle->surrogate_T_sat) == 0) ? T_sat_K :
+			retRefrigerantHandle->refrigerant->T_sat_p(p_Pa,
+			retRefrigerantHandle->psat_par, retRefrigerantHandle->refrigerant);
+
+	} else {
+		return retRefrigerantHandle->refrigerant->T_sat_p(p_Pa,
+			retRefrigerantHandle->psat_par, retRefrigerantHandle->refrigerant);
+
+	}
+}
+
+
+//////////////////////////////////////////////////
+// Definition of functions for arrays of states //
+//////////////////////////////////////////////////
+/*
+ * refh_p_sat_T_batch:
+ * -------------------
+ *
+ * Calculates saturation pressure in Pa depending on equilibrium temperature T
+ * in K. Function evaluates an array of states and checks existence of function
+ * and coefficients only once.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_p_sat_Pa:
+ *		Array to be filled with saturation pressure in Pa.
+ *	const double *T_K:
+ *		Array of equilibrium temperature in K.
+ *	int no_points:
+ *		Number of states.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all states are calculated and -1 otherwise. In case
+ *		of an error, all states of returned array are set to -1.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int refh_p_sat_T_batch(double *ret_p_sat_Pa, const double *T_K,
+	int no_points, void *refrigerantHandle) {
+	// Typecast void pointers given as inputs to correct structs
+	//
+	RefrigerantHandle *retRefrigerantHandle =
+		(RefrigerantHandle *) refrigerantHandle;
+
+	// Check if refrigerant function exists for chosen refrigerant
+	//
+	if (retRefrigerantHandle == NULL) {
+		warning_struct("refrigerantHandle", "refh_p_sat_T_batch");
+
+	} else if (retRefrigerantHandle->refrigerant->p_sat_T == NULL) {
+		warning_function("p_sat_T", "refh_p_sat_T_batch");
+
+	} else if (retRefrigerantHandle->psat_par == NULL) {
+		warning_parameter("the saturated vapor pressure",
+			"refh_p_sat_T_batch");
+
+	} else if (retRefrigerantHandle->surrogate_p_sat != NULL) {
+		// Calculate all states by surrogate
+		//
+		const Surrogate *surrogate = retRefrigerantHandle->surrogate_p_sat;
+
+		for (int i = 0; i < no_points; i++) {
+			ret_p_sat_Pa[i] = surrogate_evaluate(T_K[i], surrogate);
+		}
+		return 0;
+
+	} else {
+		// Calculate all states
+		//
+		Refrigerant *refrigerant = retRefrigerantHandle->refrigerant;
+		double *psat_par = retRefrigerantHandle->psat_par;
+
+		for (int i = 0; i < no_points; i++) {
+			ret_p_sat_Pa[i] = refrigerant->p_sat_T(T_K[i], psat_par,
+				refrigerant);
+		}
+		return 0;
+
+	}
+
+	// Indicate error for all states
+	//
+	for (int i = 0; i < no_points; i++) {
+		ret_p_sat_Pa[i] = -1;
+	}
+	return -1;
+}
+
+
+/*
+ * refh_dp_sat_dT_T_batch:
+ * -----------------------
+ *
+ * Calculates derivative of saturation pressure in Pa/K wrt to temperature
+ * depending on equilibrium temperature T in K. Function evaluates an array of
+ * states and checks existence of function and coefficients only once.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_dp_sat_dT_PaK:
+ *		Array to be filled with derivative of saturation pressure wrt.
+ *		temperature in Pa/K.
+ *	const double *T_K:
+ *		Array of equilibrium temperature in K.
+ *	int no_points:
+ *		Number of states.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all states are calculated and -1 otherwise. In case
+ *		of an error, all states of returned array are set to -1.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int refh_dp_sat_dT_T_batch(double *ret_dp_sat_dT_PaK, const double *T_K,
+	int no_points, void *refrigerantHandle) {
+	// Typecast void pointers given as inputs to correct structs
+	//
+	RefrigerantHandle *retRefrigerantHandle =
+		(RefrigerantHandle *) refrigerantHandle;
+
+	// Check if refrigerant function exists for chosen refrigerant
+	//
+	if (retRefrigerantHandle == NULL) {
+		warning_struct("refrigerantHandle", "refh_dp_sat_dT_T_batch");
+
+	} else if (retRefrigerantHandle->refrigerant->dp_sat_dT == NULL) {
+		warning_function("dp_sat_dT", "refh_dp_sat_dT_T_batch");
+
+	} else if (retRefrigerantHandle->psat_par == NULL) {
+		warning_parameter("the derivative of the saturated vapor pressure "
+			"with respect to temperature",
+			"refh_dp_sat_dT_T_batch");
+
+	} else if (retRefrigerantHandle->surrogate_dp_sat_dT != NULL) {
+		// Calculate all states by surrogate
+		//
+		const Surrogate *surrogate = retRefrigerantHandle->surrogate_dp_sat_dT;
+
+		for (int i = 0; i < no_points; i++) {
+			ret_dp_sat_dT_PaK[i] = surrogate_evaluate(T_K[i], surrogate);
+		}
+		return 0;
+
+	} else {
+		// Calculate all states
+		//
+		Refrigerant *refrigerant = retRefrigerantHandle->refrigerant;
+		double *psat_par = retRefrigerantHandle->psat_par;
+
+		for (int i = 0; i < no_points; i++) {
+			ret_dp_sat_dT_PaK[i] = refrigerant->dp_sat_dT(T_K[i], psat_par,
+				refrigerant);
+		}
+		return 0;
+
+	}
+
+	// Indicate error for all states
+	//
+	for (int i = 0; i < no_points; i++) {
+		ret_dp_sat_dT_PaK[i] = -1;
+	}
+	return -1;
+}
+
+
+/*
+ * refh_rho_l_T_batch:
+ * -------------------
+ *
+ * Calculates saturated liquid density in kg/m3 depending on equilibrium
+ * temperature T in K. Function evaluates an array of states and checks
+ * existence of function and coefficients only once.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_rho_l_kgm3:
+ *		Array to be filled with saturated liquid density in kg/m3.
+ *	const double *T_K:
+ *		Array of equilibrium temperature in K.
+ *	int no_points:
+ *		Number of states.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all states are calculated and -1 otherwise. In case
+ *		of an error, all states of returned array are set to -1.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int refh_rho_l_T_batch(double *ret_rho_l_kgm3, const double *T_K,
+	int no_points, void *refrigerantHandle) {
+	// Typecast void pointers given as inputs to correct structs
+	//
+	RefrigerantHandle *retRefrigerantHandle =
+		(RefrigerantHandle *) refrigerantHandle;
+
+	// Check if refrigerant function exists for chosen refrigerant
+	//
+	if (retRefrigerantHandle == NULL) {
+		warning_struct("refrigerantHandle", "refh_rho_l_T_batch");
+
+	} else if (retRefrigerantHandle->refrigerant->rho_l_T == NULL) {
+		warning_function("rho_l_T", "refh_rho_l_T_batch");
+
+	} else if (retRefrigerantHandle->rhol_par == NULL) {
+		warning_parameter("the saturated liquid density",
+			"refh_rho_l_T_batch");
+
+	} else if (retRefrigerantHandle->surrogate_rho_l != NULL) {
+		// Calculate all states by surrogate
+		//
+		const Surrogate *surrogate = retRefrigerantHandle->surrogate_rho_l;
+
+		for (int i = 0; i < no_points; i++) {
+			ret_rho_l_kgm3[i] = surrogate_evaluate(T_K[i], surrogate);
+		}
+		return 0;
+
+	} else {
+		// Calculate all states
+		//
+		Refrigerant *refrigerant = retRefrigerantHandle->refrigerant;
+		double *rhol_par = retRefrigerantHandle->rhol_par;
+
+		for (int i = 0; i < no_points; i++) {
+			ret_rho_l_kgm3[i] = refrigerant->rho_l_T(T_K[i], rhol_par);
+		}
+		return 0;
+
+	}
+
+	// Indicate error for all states
+	//
+	for (int i = 0; i < no_points; i++) {
+		ret_rho_l_kgm3[i] = -1;
+	}
+	return -1;
+}
+
+
+/*
+ * refh_drho_l_dT_T_batch:
+ * -----------------------
+ *
+ * Calculates derivative of saturated liquid density in kg/m3/K wrt to
+ * temperature depending on equilibrium temperature T in K. Function evaluates
+ * an array of states and checks existence of function and coefficients only
+ * once.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_drho_l_dT_kgm3K:
+ *		Array to be filled with derivative of saturated liquid density wrt.
+ *		temperature in kg/m3/K.
+ *	const double *T_K:
+ *		Array of equilibrium temperature in K.
+ *	int no_points:
+ *		Number of states.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all states are calculated and -1 otherwise. In case
+ *		of an error, all states of returned array are set to -1.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int refh_drho_l_dT_T_batch(double *ret_drho_l_dT_kgm3K,
+	const double *T_K, int no_points, void *refrigerantHandle) {
+	// Typecast void pointers given as inputs to correct structs
+	//
+	RefrigerantHandle *retRefrigerantHandle =
+		(RefrigerantHandle *) refrigerantHandle;
+
+	// Check if refrigerant function exists for chosen refrigerant
+	//
+	if (retRefrigerantHandle == NULL) {
+		warning_struct("refrigerantHandle", "refh_drho_l_dT_T_batch");
+
+	} else if (retRefrigerantHandle->refrigerant->drho_l_dT == NULL) {
+		warning_function("drho_l_dT", "refh_drho_l_dT_T_batch");
+
+	} else if (retRefrigerantHandle->rhol_par == NULL) {
+		warning_parameter("the derivative of the saturated liquid density "
+			"with respect to temperature",
+			"refh_drho_l_dT_T_batch");
+
+	} else {
+		// Calculate all states
+		//
+		Refrigerant *refrigerant = retRefrigerantHandle->refrigerant;
+		double *rhol_par = retRefrigerantHandle->rhol_par;
+
+		for (int i = 0; i < no_points; i++) {
+			ret_drho_l_dT_kgm3K[i] = refrigerant->drho_l_dT(T_K[i], rhol_par);
+		}
+		return 0;
+
+	}
+
+	// Indicate error for all states
+	//
+	for (int i = 0; i < no_points; i++) {
+		ret_drho_l_dT_kgm3K[i] = -1;
+	}
+	return -1;
+}
+
+
+/*
+ * refh_T_sat_p_batch:
+ * -------------------
+ *
+ * Calculates saturation temperature in K depending on equilibrium pressure p in
+ * Pa. Function evaluates an array of states and checks existence of function
+ * and coefficients only once.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_T_sat_K:
+ *		Array to be filled with equilibrium temperature in K.
+ *	const double *p_Pa:
+ *		Array of saturation pressure in Pa.
+ *	int no_points:
+ *		Number of states.
+ * 	struct *RefrigerantHandle:
+ *		Pointer of RefrigerantHandle-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all states are calculated and -1 otherwise. In case
+ *		of an error, all states of returned array are set to -1.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int refh_T_sat_p_batch(double *ret_T_sat_K, const double *p_Pa,
+	int no_points, void *refrigerantHandle) {
+	// Typecast void pointers given as inputs to correct structs
+	//
+	RefrigerantHandle *retRefrigerantHandle =
+		(RefrigerantHandle *) refrigerantHandle;
+
+	// Check if refrigerant function exists for chosen refrigerant
+	//
+	if (retRefrigerantHandle == NULL) {
+		warning_struct("refrigerantHandle", "refh_T_sat_p_batch");
+
+	} else if (retRefrigerantHandle->refrigerant->T_sat_p == NULL) {
+		warning_function("T_sat_p", "refh_T_sat_p_batch");
+
+	} else if (retRefrigerantHandle->psat_par == NULL) {
+		warning_parameter("the saturated vapor pressure",
+			"refh_T_sat_p_batch");
+
+	} else if (retRefrigerantHandle->surrogate_T_sat != NULL) {
+		// Calculate all states by surrogate: States not approximated by
+		// surrogate are calculated with original pressure to avoid round-off
+		// errors of logarithm
+		//
+		const Surrogate *surrogate = retRefrigerantHandle->surrogate_T_sat;
+		Refrigerant *refrigerant = retRefrigerantHandle->refrigerant;
+		double *psat_par = retRefrigerantHandle->psat_par;
+
+		for (int i = 0; i < no_points; i++) {
+			if (surrogate_approximate(&ret_T_sat_K[i], log(p_Pa[i]),
+				surrogate) != 0) {
+				ret_T_sat_K[i] = refrigerant->T_sat_p(p_Pa[i], psat_par,
+					refrigerant);
+			}
+		}
+		return 0;
+
+	} else {
+		// Calculate all states
+		//
+		Refrigerant *refrigerant = retRefrigerantHandle->refrigerant;
+		double *psat_par = retRefrigerantHandle->psat_par;
+
+		for (int i = 0; i < no_points; i++) {
+			ret_T_sat_K[i] = refrigerant->T_sat_p(p_Pa[i], psat_par,
+				refrigerant);
+		}
+		return 0;
+
+	}
+
+	// Indicate error for all states
+	//
+	for (int i = 0; i < no_points; i++) {
+		ret_T_sat_K[i] = -1;
+	}
+	return -1;
+}
@@ -3,8 +3,11 @@
 /////////////////////////////////
 #include <math.h>
 #include <stdio.h>
+#include "dispatch.h"
 #include "refrigerant_cubicEoS.h"
 #include "refrigerant_vaporPressure.h"
+#include "statistics.h"
+#include "status.h"
 
 
 /////////////////////////////
@@ -99,6 +102,7 @@
  *		Improved code.
  *
  */
+DISPATCH_CLONES
 double refrigerant_p_sat_eos1(const double T_K,
 	const double refrigerant_par[]) {
 	// Calculate temperature-dependent coefficients
@@ -147,6 +151,7 @@ double refrigerant_p_sat_eos1(const double T_K,
  *		Improved code.
  *
  */
+DISPATCH_CLONES
 double refrigerant_dp_sat_dT_eos1(const double T_K,
 	const double refrigerant_par[]) {
 	// Calculate temperature-dependent coefficients
@@ -265,6 +270,18 @@ double refrigerant_T_sat_eos1(const double p_Pa,
 		}
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(refrigerant_T_sat_eos1, counter_NRM,
+		counter_NRM != MAX_ITERATIONS_NEWTON);
+
+	// Record failure when number of iterations exceeds MAX_ITERATIONS_NEWTON
+	//
+	if (counter_NRM == MAX_ITERATIONS_NEWTON) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"refrigerant_T_sat_eos1", counter_NRM, p_guess_Pa - p_Pa);
+	}
+
 	// Return -1 when number of iterations exceeds MAX_ITERATIONS_NEWTON
 	//
 	return (counter_NRM == MAX_ITERATIONS_NEWTON ? -1 : T_guess_K);
@@ -482,6 +499,18 @@ double refrigerant_T_sat_eos2(const double p_Pa,
 		}
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(refrigerant_T_sat_eos2, counter_NRM,
+		counter_NRM != MAX_ITERATIONS_NEWTON);
+
+	// Record failure when number of iterations exceeds MAX_ITERATIONS_NEWTON
+	//
+	if (counter_NRM == MAX_ITERATIONS_NEWTON) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"refrigerant_T_sat_eos2", counter_NRM, p_guess_Pa - p_Pa);
+	}
+
 	// Return -1 when number of iterations exceeds MAX_ITERATIONS_NEWTON
 	//
 	return (counter_NRM == MAX_ITERATIONS_NEWTON ? -1 : T_guess_K);
@@ -683,6 +712,18 @@ double refrigerant_T_sat_eos3(const double p_Pa,
 		}
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(refrigerant_T_sat_eos3, counter_NRM,
+		counter_NRM != MAX_ITERATIONS_NEWTON);
+
+	// Record failure when number of iterations exceeds MAX_ITERATIONS_NEWTON
+	//
+	if (counter_NRM == MAX_ITERATIONS_NEWTON) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"refrigerant_T_sat_eos3", counter_NRM, p_guess_Pa - p_Pa);
+	}
+
 	// Return -1 when number of iterations exceeds MAX_ITERATIONS_NEWTON
 	//
 	return (counter_NRM == MAX_ITERATIONS_NEWTON ? -1 : T_guess_K);
@@ -973,6 +1014,18 @@ double refrigerant_p_sat_cubic_internal(double T_K, double p_guess_Pa,
 		}
 	}
 
+	// Record number of iterations of solver
+	//
+	STATISTICS_SOLVER(refrigerant_p_sat_cubic_internal, counter,
+		counter != MAX_ITERATIONS_CUBIC);
+
+	// Record failure when number of iterations exceeds MAX_ITERATIONS_CUBIC
+	//
+	if (counter == MAX_ITERATIONS_CUBIC) {
+		status_report(STATUS_NO_CONVERGENCE,
+			"refrigerant_p_sat_cubic_internal", counter, delta);
+	}
+
 	// Return result
 	//
 	return (counter == MAX_ITERATIONS_CUBIC ? -1 : p);
@@ -1079,9 +1132,12 @@ double refrigerant_p_sat_cubic(double T_K,
 	if (T_K >= refrigerant_par[2]) {
 		// VLE does not exist: Print warning and return -1
 		//
-		printf("\n\n###########\n# Warning #\n###########");
-		printf("\nVapor-Liquid-Equilibrium does not exist because temperature "
-			" is greater than critical temperature.");
+		if (status_report(STATUS_OUT_OF_RANGE, "refrigerant_p_sat_cubic", 0,
+			T_K - refrigerant_par[2])) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nVapor-Liquid-Equilibrium does not exist because "
+				"temperature  is greater than critical temperature.");
+		}
 
 		return -1;
 
@@ -1200,9 +1256,12 @@ double refrigerant_T_sat_cubic(double p_Pa,
 	if (p_Pa >= refrigerant_par[1]) {
 		// VLE does not exist: Print warning and return -1
 		//
-		printf("\n\n###########\n# Warning #\n###########");
-		printf("\nVapor-Liquid-Equilibrium does not exist because pressure "
-			" is greater than critical pressure.");
+		if (status_report(STATUS_OUT_OF_RANGE, "refrigerant_T_sat_cubic", 0,
+			p_Pa - refrigerant_par[1])) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nVapor-Liquid-Equilibrium does not exist because pressure "
+				" is greater than critical pressure.");
+		}
 
 		return -1;
 
@@ -1242,6 +1301,19 @@ double refrigerant_T_sat_cubic(double p_Pa,
 			T_guess_K = T_guess_K < 0 ? 5 : T_guess_K;
 		}
 
+		// Record number of iterations of solver
+		//
+		STATISTICS_SOLVER(refrigerant_T_sat_cubic, counter_NRM,
+			counter_NRM != MAX_ITERATIONS_NEWTON);
+
+		// Record failure when number of iterations exceeds
+		// MAX_ITERATIONS_NEWTON
+		//
+		if (counter_NRM == MAX_ITERATIONS_NEWTON) {
+			status_report(STATUS_NO_CONVERGENCE,
+				"refrigerant_T_sat_cubic", counter_NRM, p_guess_Pa - p_Pa);
+		}
+
 		// Return -1 when number of iterations exceeds 50
 		//
 		return (counter_NRM == MAX_ITERATIONS_NEWTON ? -1 : T_guess_K);
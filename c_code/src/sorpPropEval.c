@@ -0,0 +1,272 @@
+////////////////////
+// sorpPropEval.c //
+////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+#include "batchPool.h"
+#include "status.h"
+#include "streamEvaluation.h"
+#include "workingPair.h"
+#include "workingPairBatch.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//sorpproplib.json"
+#else
+	#define PATH ".\\data\\sorpproplib.json"
+#endif
+
+#define SIZE_BUFFER_IO (1 << 20)
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * usage:
+ * ------
+ *
+ * Auxiliary function printing usage of command-line tool to stderr.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static void usage(void) {
+	fprintf(stderr,
+		"Usage: sorpPropEval.exe [options] [file]\n"
+		"\n"
+		"Evaluates a function of a working pair for each row of file or of\n"
+		"stdin (i.e., if file is omitted or \"-\") and writes one row of\n"
+		"outputs per row to stdout.\n"
+		"\n"
+		"Working pair:\n"
+		"  --db path            Database (default: %s)\n"
+		"  --sorbent name       Name of sorbent (required)\n"
+		"  --subtype name       Name of sub-type of sorbent (required)\n"
+		"  --refrigerant name   Name of refrigerant (required)\n"
+		"  --isotherm name      Name of isotherm (required)\n"
+		"  --no-isotherm id     ID of isotherm (default: 1)\n"
+		"  --psat name          Vapor pressure (default: VaporPressure_EoS1)\n"
+		"  --no-psat id         ID of vapor pressure (default: 1)\n"
+		"  --rhol name          Liquid density (default: "
+		"SaturatedLiquidDensity_EoS1)\n"
+		"  --no-rhol id         ID of liquid density (default: 1)\n"
+		"\n"
+		"Evaluation:\n"
+		"  --function name      Function (required, e.g. ads_w_pT)\n"
+		"  --columns c1,c2,...  Columns used as inputs, counted from 1\n"
+		"                       (default: 1,2,...)\n"
+		"  --binary-input n     Inputs are records of n doubles\n"
+		"  --binary-output      Outputs are records of doubles\n"
+		"  --status             Append status code to each row of outputs\n"
+		"  --header n           Skip first n lines of CSV file (default: 0)\n"
+		"  --delimiter c        Delimiter of CSV fields (default: ,)\n"
+		"  --block n            Rows per block (default: %i)\n"
+		"  --threads n          Threads (default: one per processor)\n",
+		PATH, STREAM_BLOCK_SIZE);
+}
+
+
+/*
+ * main:
+ * -----
+ *
+ * Streams rows of a CSV file or records of a binary file through a function
+ * of a working pair: Rows are evaluated block by block by a thread pool, and
+ * memory is independent of number of rows.
+ *
+ * Usage:
+ * ------
+ *	sorpPropEval.exe [options] [file]
+ *
+ *	Options are printed if an option is invalid (e.g., --help).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main(int argc, char *argv[]) {
+	// Parse options
+	//
+	const char *path_db = PATH;
+	const char *names[6] = {NULL, NULL, NULL, NULL, "VaporPressure_EoS1",
+		"SaturatedLiquidDensity_EoS1"};
+	const char *options_names[6] = {"--sorbent", "--subtype",
+		"--refrigerant", "--isotherm", "--psat", "--rhol"};
+	int ids[3] = {1, 1, 1};
+	const char *options_ids[3] = {"--no-isotherm", "--no-psat", "--no-rhol"};
+	const char *columns = NULL;
+	const char *path_input = NULL;
+	int no_threads = 0;
+	int valid = 1;
+
+	StreamEvaluation stream;
+	memset(&stream, 0, sizeof(stream));
+	stream.delimiter = ',';
+	stream.block_size = STREAM_BLOCK_SIZE;
+
+	for (int i = 1; valid && i < argc; i++) {
+		const char *option = argv[i];
+		const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+		int found = 0;
+
+		for (int j = 0; j < 6; j++) {
+			if (strcmp(option, options_names[j]) == 0) {
+				names[j] = value;
+				found = 1;
+			}
+		}
+		for (int j = 0; j < 3; j++) {
+			if (strcmp(option, options_ids[j]) == 0) {
+				ids[j] = (value == NULL) ? 0 : atoi(value);
+				found = 1;
+			}
+		}
+
+		if (strcmp(option, "--binary-output") == 0) {
+			stream.binary_output = 1;
+			continue;
+		} else if (strcmp(option, "--status") == 0) {
+			stream.write_status = 1;
+			continue;
+		} else if (strcmp(option, "--db") == 0) {
+			path_db = value;
+		} else if (strcmp(option, "--function") == 0) {
+			stream.function = value;
+		} else if (strcmp(option, "--columns") == 0) {
+			columns = value;
+		} else if (strcmp(option, "--binary-input") == 0) {
+			stream.binary_input = 1;
+			stream.no_fields = (value == NULL) ? 0 : atoi(value);
+			valid = stream.no_fields > 0;
+		} else if (strcmp(option, "--header") == 0) {
+			stream.no_header = (value == NULL) ? -1 : atoi(value);
+			valid = stream.no_header >= 0;
+		} else if (strcmp(option, "--delimiter") == 0) {
+			stream.delimiter = (value == NULL) ? '\0' : value[0];
+			valid = stream.delimiter != '\0';
+		} else if (strcmp(option, "--block") == 0) {
+			stream.block_size = (value == NULL) ? 0 : atoi(value);
+			valid = stream.block_size > 0;
+		} else if (strcmp(option, "--threads") == 0) {
+			no_threads = (value == NULL) ? 0 : atoi(value);
+		} else if (!found && i == argc - 1 && (option[0] != '-' ||
+			strcmp(option, "-") == 0)) {
+			path_input = option;
+			continue;
+		} else if (!found) {
+			valid = 0;
+		}
+
+		valid = valid && (value != NULL);
+		i++;
+	}
+
+	// Check function and columns: Columns default to first fields
+	//
+	const BatchFunction *function = (stream.function == NULL) ? NULL :
+		batch_function(stream.function);
+	int column[BATCH_MAX_INPUTS];
+
+	if (valid && function != NULL) {
+		const char *position = columns;
+
+		for (int i = 0; i < function->no_inputs; i++) {
+			column[i] = i;
+
+			if (columns != NULL) {
+				char *end;
+				column[i] = (int) strtol(position, &end, 10) - 1;
+				valid = valid && (end != position) && (column[i] >= 0) &&
+					(*end == ((i + 1 < function->no_inputs) ? ',' : '\0'));
+				position = (*end == ',') ? end + 1 : end;
+			}
+		}
+		stream.columns = column;
+	}
+
+	for (int i = 0; i < 4; i++) {
+		valid = valid && (names[i] != NULL);
+	}
+
+	if (!valid || function == NULL) {
+		if (valid) {
+			fprintf(stderr, "Function \"%s\" cannot be evaluated for arrays "
+				"of states.\n\n", (stream.function == NULL) ? "" :
+				stream.function);
+		}
+		usage();
+		return EXIT_FAILURE;
+	}
+
+	// Open streams: Binary streams must not translate line breaks
+	//
+	int read_stdin = (path_input == NULL) || (strcmp(path_input, "-") == 0);
+	FILE *input = read_stdin ? stdin :
+		fopen(path_input, stream.binary_input ? "rb" : "r");
+
+	if (input == NULL) {
+		fprintf(stderr, "Cannot open file \"%s\".\n", path_input);
+		return EXIT_FAILURE;
+	}
+
+#ifdef _WIN32
+	if (read_stdin && stream.binary_input) {
+		_setmode(_fileno(stdin), _O_BINARY);
+	}
+	if (stream.binary_output) {
+		_setmode(_fileno(stdout), _O_BINARY);
+	}
+#endif
+
+	setvbuf(input, NULL, _IOFBF, SIZE_BUFFER_IO);
+	setvbuf(stdout, NULL, _IOFBF, SIZE_BUFFER_IO);
+
+	// Create working pair and thread pool: Warnings of library must not mix
+	// with outputs
+	//
+	setStatusQuiet(1);
+	WorkingPair *workingPair = newWorkingPair(path_db, names[0], names[1],
+		names[2], names[3], ids[0], names[4], ids[1], names[5], ids[2]);
+	BatchPool *batchPool = newBatchPool(no_threads);
+
+	long long no_rows = 0;
+	int result = -1;
+
+	if (workingPair == NULL) {
+		fprintf(stderr, "Cannot create working pair (i.e., \"%s\").\n",
+			getStatusMessage(getStatusCode()));
+	} else if (batchPool == NULL) {
+		fprintf(stderr, "Cannot create thread pool.\n");
+	} else {
+		setStatusQuiet(0);
+		result = streamEvaluation_run(&no_rows, input, stdout, &stream,
+			batchPool, workingPair);
+	}
+
+	fflush(stdout);
+
+	// Free memory
+	//
+	delWorkingPair(workingPair);
+	delBatchPool(batchPool);
+
+	if (!read_stdin) {
+		fclose(input);
+	}
+	return (result == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
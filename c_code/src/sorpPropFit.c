@@ -0,0 +1,258 @@
+///////////////////
+// sorpPropFit.c //
+///////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "batchPool.h"
+#include "benchmark.h"
+#include "database.h"
+#include "json_interface.h"
+#include "status.h"
+#include "workingPairFit.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//sorpproplib.json"
+#else
+	#define PATH ".\\data\\sorpproplib.json"
+#endif
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * usage:
+ * ------
+ *
+ * Auxiliary function printing usage of command-line tool to stderr.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static void usage(void) {
+	fprintf(stderr,
+		"Usage: sorpPropFit.exe --isotherm name --data path --start list "
+		"[options]\n"
+		"\n"
+		"Fits coefficients of an isotherm equation to experimental data given\n"
+		"in the format of the database (i.e., \"_ed_\") and writes fitted\n"
+		"coefficients, covariance matrix, and errors as JSON object in the\n"
+		"format of isotherm equations of the database (i.e., \"_p_\").\n"
+		"Lists contain one value per coefficient separated by commas.\n"
+		"\n"
+		"Options:\n"
+		"  --isotherm name      Isotherm equation (e.g., Toth)\n"
+		"  --data path          JSON file containing array of blocks of\n"
+		"                       experimental data or one block\n"
+		"  --start list         Start values of coefficients\n"
+		"  --lower list         Lower bounds (default: none)\n"
+		"  --upper list         Upper bounds (default: none)\n"
+		"  --relative 0|1       Fit relative errors (default: 0)\n"
+		"  --refrigerant name   Refrigerant if isotherm equation requires\n"
+		"                       vapor pressure or liquid density\n"
+		"  --db path            Database of refrigerant (default: %s)\n"
+		"  --literature text    Literature of report (default: empty)\n"
+		"  --output path        JSON report (default: stdout)\n"
+		"  --threads n          Threads (default: one per processor)\n",
+		PATH);
+}
+
+
+/*
+ * parse_list:
+ * -----------
+ *
+ * Auxiliary function reading list of numbers separated by commas.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_values:
+ *		Array to be filled with numbers.
+ *	const char *list:
+ *		List of numbers separated by commas.
+ *	int no_values:
+ *		Number of numbers expected.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if list contains exactly no_values numbers and -1
+ *		otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static int parse_list(double *ret_values, const char *list, int no_values) {
+	const char *position = list;
+
+	for (int i = 0; i < no_values; i++) {
+		char *end;
+		ret_values[i] = strtod(position, &end);
+
+		if (end == position || (i + 1 < no_values && *end != ',')) {
+			return -1;
+		}
+		position = end + 1;
+	}
+	return (position[-1] == '\0') ? 0 : -1;
+}
+
+
+/*
+ * main:
+ * -----
+ *
+ * Fits coefficients of an isotherm equation to experimental data: Residuals
+ * and analytic derivatives wrt. coefficients of all points are evaluated by a
+ * thread pool, and fitted coefficients are written as JSON report. Number of
+ * points, iterations, and duration are printed to stderr.
+ *
+ * Usage:
+ * ------
+ *	sorpPropFit.exe --isotherm name --data path --start list [options]
+ *
+ *	Options are printed if an option is invalid (e.g., --help).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main(int argc, char *argv[]) {
+	// Parse options
+	//
+	const char *path_db = PATH;
+	const char *path_data = NULL;
+	const char *path_output = NULL;
+	const char *wp_iso = NULL;
+	const char *wp_rf = NULL;
+	const char *literature = NULL;
+	const char *lists[3] = {NULL, NULL, NULL};
+	int relative = 0;
+	int no_threads = 0;
+	int valid = 1;
+
+	for (int i = 1; valid && i < argc; i++) {
+		const char *option = argv[i];
+		const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+		if (strcmp(option, "--isotherm") == 0) {
+			wp_iso = value;
+		} else if (strcmp(option, "--data") == 0) {
+			path_data = value;
+		} else if (strcmp(option, "--start") == 0) {
+			lists[0] = value;
+		} else if (strcmp(option, "--lower") == 0) {
+			lists[1] = value;
+		} else if (strcmp(option, "--upper") == 0) {
+			lists[2] = value;
+		} else if (strcmp(option, "--relative") == 0) {
+			relative = (value == NULL) ? 0 : atoi(value);
+		} else if (strcmp(option, "--refrigerant") == 0) {
+			wp_rf = value;
+		} else if (strcmp(option, "--db") == 0) {
+			path_db = value;
+		} else if (strcmp(option, "--literature") == 0) {
+			literature = value;
+		} else if (strcmp(option, "--output") == 0) {
+			path_output = value;
+		} else if (strcmp(option, "--threads") == 0) {
+			no_threads = (value == NULL) ? 0 : atoi(value);
+		} else {
+			valid = 0;
+		}
+
+		valid = valid && (value != NULL);
+		i++;
+	}
+
+	if (!valid || wp_iso == NULL || path_data == NULL || lists[0] == NULL) {
+		usage();
+		return EXIT_FAILURE;
+	}
+
+	// Read experimental data and refrigerant: Warnings of library must not
+	// mix with report
+	//
+	double time_start = benchmark_time_s();
+
+	setStatusQuiet(1);
+	char *json_ed = json_read_file(path_data);
+	Database *database = (wp_rf == NULL) ? NULL : newDatabase(path_db);
+	Fit *fit = (json_ed == NULL) ? NULL : newFit(database, wp_iso, wp_rf,
+		NULL, 1, NULL, 1, json_ed);
+	BatchPool *batchPool = newBatchPool(no_threads);
+
+	free(json_ed);
+
+	double par[3][FIT_MAX_NO_COEFFICIENTS];
+	int no_par = (fit == NULL) ? 0 : getFitNoCoefficients(fit);
+	int result = -1;
+
+	for (int j = 0; fit != NULL && j < 3; j++) {
+		valid = valid && (lists[j] == NULL ||
+			parse_list(par[j], lists[j], no_par) == 0);
+	}
+
+	if (fit == NULL) {
+		fprintf(stderr, "Cannot fit isotherm equation \"%s\" to data \"%s\" "
+			"(i.e., \"%s\").\n", wp_iso, path_data,
+			getStatusMessage(getStatusCode()));
+	} else if (!valid) {
+		fprintf(stderr, "Lists must contain %i numbers:", no_par);
+		for (int j = 0; j < no_par; j++) {
+			fprintf(stderr, " %s", getFitCoefficientName(j, fit));
+		}
+		fprintf(stderr, "\n");
+	} else if (batchPool == NULL) {
+		fprintf(stderr, "Cannot create thread pool.\n");
+	} else {
+		double time_setup = benchmark_time_s() - time_start;
+
+		// Fit coefficients and write report: Report is also written if
+		// algorithm did not converge
+		//
+		time_start = benchmark_time_s();
+		result = fit_optimize(par[0], (lists[1] == NULL) ? NULL : par[1],
+			(lists[2] == NULL) ? NULL : par[2], relative, 0, 0, batchPool,
+			fit);
+		double time_fit = benchmark_time_s() - time_start;
+
+		result = (fit_report(path_output, literature, fit) == 0) ? result :
+			-1;
+
+		int no_valid, no_iterations;
+		double rmse, are, max_error;
+		int status = getFitStatistics(&no_valid, &no_iterations, &rmse, &are,
+			&max_error, fit);
+
+		fprintf(stderr, "Fitted %i coefficients to %i of %i points in %i "
+			"iterations (status: \"%s\", setup: %.2f s, fit: %.2f s, "
+			"threads: %i).\n", no_par, no_valid, getFitNoPoints(fit),
+			no_iterations, getStatusMessage(status), time_setup, time_fit,
+			getBatchPoolNoThreads(batchPool));
+	}
+
+	fflush(stdout);
+
+	// Free memory
+	//
+	delFit(fit);
+	delDatabase(database);
+	delBatchPool(batchPool);
+
+	return (result == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,54 @@
+//////////////////////
+// sorpPropServer.c //
+//////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "propertyServer.h"
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * main:
+ * -----
+ *
+ * Runs property server until a client requests shutdown or until SIGINT or
+ * SIGTERM is received.
+ *
+ * Usage:
+ * ------
+ *	sorpPropServer.exe [path_socket] [no_threads]
+ *
+ *	path_socket:
+ *		Path of Unix domain socket (i.e., SERVER_SOCKET if omitted).
+ *	no_threads:
+ *		Number of threads evaluating batches (i.e., one thread per processor
+ *		if omitted).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main(int argc, char *argv[]) {
+	const char *path_socket = (argc > 1) ? argv[1] : SERVER_SOCKET;
+	int no_threads = (argc > 2) ? atoi(argv[2]) : 0;
+
+	PropertyServer *propertyServer = newPropertyServer(path_socket,
+		no_threads);
+
+	if (propertyServer == NULL) {
+		printf("\n\nCannot start property server at \"%s\"!\n", path_socket);
+		return EXIT_FAILURE;
+	}
+
+	printf("Property server listens at \"%s\".\n", path_socket);
+	fflush(stdout);
+
+	int result = propertyServer_run(propertyServer);
+	delPropertyServer(propertyServer);
+
+	return (result == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,159 @@
+//////////////////////
+// sorpPropVerify.c //
+//////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "batchPool.h"
+#include "benchmark.h"
+#include "database.h"
+#include "status.h"
+#include "workingPairVerification.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//sorpproplib.json"
+#else
+	#define PATH ".\\data\\sorpproplib.json"
+#endif
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * usage:
+ * ------
+ *
+ * Auxiliary function printing usage of command-line tool to stderr.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static void usage(void) {
+	fprintf(stderr,
+		"Usage: sorpPropVerify.exe [options]\n"
+		"\n"
+		"Compares all isotherm equations of a database with the experimental\n"
+		"data stored in the database and writes root-mean-square error,\n"
+		"average absolute relative deviation, and maximal error of each\n"
+		"block of experimental data as JSON report.\n"
+		"\n"
+		"Options:\n"
+		"  --db path            Database (default: %s)\n"
+		"  --refrigerant name   Verify only working pairs using refrigerant\n"
+		"                       (default: all refrigerants)\n"
+		"  --output path        JSON report (default: stdout)\n"
+		"  --threads n          Threads (default: one per processor)\n",
+		PATH);
+}
+
+
+/*
+ * main:
+ * -----
+ *
+ * Verifies all working pairs of a database against the experimental data
+ * stored in the database: All points are evaluated by a thread pool, and
+ * statistics of each block of experimental data are written as JSON report.
+ * Number of entries and duration are printed to stderr.
+ *
+ * Usage:
+ * ------
+ *	sorpPropVerify.exe [options]
+ *
+ *	Options are printed if an option is invalid (e.g., --help).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int main(int argc, char *argv[]) {
+	// Parse options
+	//
+	const char *path_db = PATH;
+	const char *path_output = NULL;
+	const char *wp_rf = NULL;
+	int no_threads = 0;
+	int valid = 1;
+
+	for (int i = 1; valid && i < argc; i++) {
+		const char *option = argv[i];
+		const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+		if (strcmp(option, "--db") == 0) {
+			path_db = value;
+		} else if (strcmp(option, "--refrigerant") == 0) {
+			wp_rf = value;
+		} else if (strcmp(option, "--output") == 0) {
+			path_output = value;
+		} else if (strcmp(option, "--threads") == 0) {
+			no_threads = (value == NULL) ? 0 : atoi(value);
+		} else {
+			valid = 0;
+		}
+
+		valid = valid && (value != NULL);
+		i++;
+	}
+
+	if (!valid) {
+		usage();
+		return EXIT_FAILURE;
+	}
+
+	// Read database and create entries: Warnings of library must not mix
+	// with report
+	//
+	double time_start = benchmark_time_s();
+
+	setStatusQuiet(1);
+	Database *database = newDatabase(path_db);
+	Verification *verification = (database == NULL) ? NULL :
+		newVerification(database, wp_rf);
+	BatchPool *batchPool = newBatchPool(no_threads);
+
+	int result = -1;
+
+	if (verification == NULL) {
+		fprintf(stderr, "Cannot find experimental data in database \"%s\" "
+			"(i.e., \"%s\").\n", path_db, getStatusMessage(getStatusCode()));
+	} else if (batchPool == NULL) {
+		fprintf(stderr, "Cannot create thread pool.\n");
+	} else {
+		double time_setup = benchmark_time_s() - time_start;
+
+		// Evaluate all points and write report
+		//
+		time_start = benchmark_time_s();
+		result = verification_evaluate(0, batchPool, verification);
+		double time_evaluation = benchmark_time_s() - time_start;
+
+		result = (result == 0) ? verification_report(path_output,
+			verification) : result;
+
+		fprintf(stderr, "Verified %i blocks of experimental data "
+			"(setup: %.2f s, evaluation: %.2f s, threads: %i).\n",
+			getVerificationNoEntries(verification), time_setup,
+			time_evaluation, getBatchPoolNoThreads(batchPool));
+	}
+
+	fflush(stdout);
+
+	// Free memory
+	//
+	delVerification(verification);
+	delDatabase(database);
+	delBatchPool(batchPool);
+
+	return (result == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,359 @@
+//////////////
+// spline.c //
+//////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "spline.h"
+#include "dispatch.h"
+#include "status.h"
+#include "structDefinitions.c"
+
+
+///////////////////////////
+// Definition of structs //
+///////////////////////////
+/*
+ * Spline2D:
+ * ---------
+ *
+ * Contains bicubic Hermite spline of a function of two variables on an
+ * equidistant grid. For each node, the spline stores the value, both partial
+ * derivatives, and the mixed partial derivative of the function. Thus, the
+ * spline and its first partial derivatives are continuous and interpolate the
+ * given values and derivatives at all nodes. Cells with at least one invalid
+ * node (e.g., the original function fails) cannot be evaluated.
+ *
+ * Attributes:
+ * -----------
+ *	double x_min:
+ *		Lower limit of first variable.
+ *	double x_max:
+ *		Upper limit of first variable.
+ *	double y_min:
+ *		Lower limit of second variable.
+ *	double y_max:
+ *		Upper limit of second variable.
+ *	double h_x:
+ *		Distance between nodes regarding first variable.
+ *	double h_y:
+ *		Distance between nodes regarding second variable.
+ *	int no_nodes_x:
+ *		Number of nodes regarding first variable.
+ *	int no_nodes_y:
+ *		Number of nodes regarding second variable.
+ *
+ *	double *f:
+ *		Array containing values at nodes.
+ *	double *f_x:
+ *		Array containing partial derivatives wrt. first variable at nodes.
+ *	double *f_y:
+ *		Array containing partial derivatives wrt. second variable at nodes.
+ *	double *f_xy:
+ *		Array containing mixed partial derivatives at nodes.
+ *	char *valid:
+ *		Array indicating whether node is valid.
+ *
+ * Remarks:
+ * --------
+ *	Node (i_x, i_y) is stored at index i_x * no_nodes_y + i_y.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * newSpline2D:
+ * ------------
+ *
+ * Initialization function to create a new Spline2D-struct. Therefore,
+ * function allocates memory for values and derivatives at all nodes of the
+ * grid and marks all nodes as invalid. Values and derivatives must be set
+ * afterwards. If limits or numbers of nodes are invalid or memory allocation
+ * fails, functions returns NULL and prints a warning.
+ *
+ * Parameters:
+ * -----------
+ *	int no_nodes_x:
+ *		Number of nodes regarding first variable.
+ *	int no_nodes_y:
+ *		Number of nodes regarding second variable.
+ *	double x_min:
+ *		Lower limit of first variable.
+ *	double x_max:
+ *		Upper limit of first variable.
+ *	double y_min:
+ *		Lower limit of second variable.
+ *	double y_max:
+ *		Upper limit of second variable.
+ *
+ * Returns:
+ * --------
+ *	struct *Spline2D:
+ *		Returns malloc-ed Spline2D-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+Spline2D *newSpline2D(int no_nodes_x, int no_nodes_y, double x_min,
+	double x_max, double y_min, double y_max) {
+	// Check limits and numbers of nodes: Comparisons fail for NaN
+	//
+	if (no_nodes_x < 2 || no_nodes_y < 2 || !(x_min < x_max) ||
+		!(y_min < y_max)) {
+		if (status_report(STATUS_INVALID_INPUT, "newSpline2D", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot create spline with %i x %i nodes for cell "
+				"[%f, %f] x [%f, %f].", no_nodes_x, no_nodes_y, x_min, x_max,
+				y_min, y_max);
+		}
+		return NULL;
+	}
+
+	// Try to allocate memory for Spline2D-struct: Values and derivatives are
+	// stored in one array
+	//
+	Spline2D *retSpline = (Spline2D *) malloc(sizeof(Spline2D));
+
+	if (retSpline == NULL) {
+		if (status_report(STATUS_NO_MEMORY, "newSpline2D", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for Spline2D-struct.");
+		}
+		return NULL;
+	}
+
+	size_t no_nodes = (size_t) no_nodes_x * no_nodes_y;
+	retSpline->f = (double *) malloc(4 * no_nodes * sizeof(double));
+	retSpline->valid = (char *) calloc(no_nodes, sizeof(char));
+
+	if (retSpline->f == NULL || retSpline->valid == NULL) {
+		if (status_report(STATUS_NO_MEMORY, "newSpline2D", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for nodes of Spline2D-struct.");
+		}
+		delSpline2D(retSpline);
+		return NULL;
+	}
+
+	retSpline->f_x = retSpline->f + no_nodes;
+	retSpline->f_y = retSpline->f + 2 * no_nodes;
+	retSpline->f_xy = retSpline->f + 3 * no_nodes;
+
+	retSpline->x_min = x_min;
+	retSpline->x_max = x_max;
+	retSpline->y_min = y_min;
+	retSpline->y_max = y_max;
+	retSpline->h_x = (x_max - x_min) / (no_nodes_x - 1);
+	retSpline->h_y = (y_max - y_min) / (no_nodes_y - 1);
+	retSpline->no_nodes_x = no_nodes_x;
+	retSpline->no_nodes_y = no_nodes_y;
+
+	for (size_t i = 0; i < 4 * no_nodes; i++) {
+		retSpline->f[i] = 0;
+	}
+
+	// Return structure
+	//
+	return retSpline;
+}
+
+
+/*
+ * delSpline2D:
+ * ------------
+ *
+ * Destructor function to free allocated memory of a Spline2D-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Spline2D:
+ *		Pointer of Spline2D-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void delSpline2D(void *spline) {
+	// Typecast void pointer given as input to pointer of Spline2D-struct
+	//
+	Spline2D *retSpline = (Spline2D *) spline;
+
+	if (retSpline != NULL) {
+		free(retSpline->f);
+		free(retSpline->valid);
+		free(retSpline);
+	}
+}
+
+
+/*
+ * spline2D_mixed_derivatives:
+ * ---------------------------
+ *
+ * Auxiliary function to calculate mixed partial derivatives at all valid nodes
+ * by central differences of the partial derivatives wrt. first variable
+ * regarding second variable. At the limits or next to invalid nodes, one-sided
+ * differences are used. As the spline interpolates the mixed partial
+ * derivatives given at the nodes, the approximated mixed partial derivatives
+ * do not affect continuity of spline and its first partial derivatives.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Spline2D:
+ *		Pointer of Spline2D-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void spline2D_mixed_derivatives(Spline2D *spline) {
+	for (int i_x = 0; i_x < spline->no_nodes_x; i_x++) {
+		for (int i_y = 0; i_y < spline->no_nodes_y; i_y++) {
+			// Select neighbors regarding second variable that are valid
+			//
+			int node = i_x * spline->no_nodes_y + i_y;
+			int lower = (i_y > 0 && spline->valid[node - 1]) ? node - 1 : node;
+			int upper = (i_y < spline->no_nodes_y - 1 &&
+				spline->valid[node + 1]) ? node + 1 : node;
+
+			spline->f_xy[node] = (!spline->valid[node] || lower == upper) ? 0 :
+				(spline->f_x[upper] - spline->f_x[lower]) /
+				((upper - lower) * spline->h_y);
+		}
+	}
+}
+
+
+/*
+ * spline2D_evaluate:
+ * ------------------
+ *
+ * Evaluates spline and its partial derivatives at variables x and y if x and y
+ * are within limits of spline and all nodes of the cell are valid. Thus,
+ * callers can evaluate the original function with their own inputs
+ * otherwise.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_value:
+ *		Value of spline.
+ *	double *ret_df_dx:
+ *		Partial derivative of spline wrt. first variable.
+ *	double *ret_df_dy:
+ *		Partial derivative of spline wrt. second variable.
+ *	double x:
+ *		First variable.
+ *	double y:
+ *		Second variable.
+ * 	struct *Spline2D:
+ *		Pointer of Spline2D-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if state is evaluated by spline and -1 otherwise.
+ *
+ * Remarks:
+ * --------
+ *	Cubic Hermite basis functions of both variables are multiplied. Weights
+ *	of derivatives are scaled by distance between nodes.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DISPATCH_CLONES
+int spline2D_evaluate(double *ret_value, double *ret_df_dx, double *ret_df_dy,
+	double x, double y, const Spline2D *spline) {
+	// Check limits of spline: Comparisons fail for NaN
+	//
+	if (spline == NULL ||
+		!(x >= spline->x_min && x <= spline->x_max) ||
+		!(y >= spline->y_min && y <= spline->y_max)) {
+		return -1;
+	}
+
+	// Select cell: Upper limits belong to last cells
+	//
+	double t_x = (x - spline->x_min) / spline->h_x;
+	double t_y = (y - spline->y_min) / spline->h_y;
+	int i_x = (int) t_x;
+	int i_y = (int) t_y;
+	i_x = (i_x < spline->no_nodes_x - 1) ? i_x : spline->no_nodes_x - 2;
+	i_y = (i_y < spline->no_nodes_y - 1) ? i_y : spline->no_nodes_y - 2;
+	t_x -= i_x;
+	t_y -= i_y;
+
+	int nodes[4] = {i_x * spline->no_nodes_y + i_y, 0, 0, 0};
+	nodes[1] = nodes[0] + 1;
+	nodes[2] = nodes[0] + spline->no_nodes_y;
+	nodes[3] = nodes[2] + 1;
+
+	if (!spline->valid[nodes[0]] || !spline->valid[nodes[1]] ||
+		!spline->valid[nodes[2]] || !spline->valid[nodes[3]]) {
+		return -1;
+	}
+
+	// Calculate weights of values (i.e., a) and derivatives (i.e., b) of
+	// lower and upper nodes and their derivatives (i.e., da and db)
+	//
+	double h_x = spline->h_x;
+	double h_y = spline->h_y;
+	double a_x[2] = {(1 + 2 * t_x) * (1 - t_x) * (1 - t_x),
+		t_x * t_x * (3 - 2 * t_x)};
+	double b_x[2] = {h_x * t_x * (1 - t_x) * (1 - t_x),
+		h_x * t_x * t_x * (t_x - 1)};
+	double da_x[2] = {6 * t_x * (t_x - 1) / h_x, 6 * t_x * (1 - t_x) / h_x};
+	double db_x[2] = {(3 * t_x - 1) * (t_x - 1), t_x * (3 * t_x - 2)};
+
+	double a_y[2] = {(1 + 2 * t_y) * (1 - t_y) * (1 - t_y),
+		t_y * t_y * (3 - 2 * t_y)};
+	double b_y[2] = {h_y * t_y * (1 - t_y) * (1 - t_y),
+		h_y * t_y * t_y * (t_y - 1)};
+	double da_y[2] = {6 * t_y * (t_y - 1) / h_y, 6 * t_y * (1 - t_y) / h_y};
+	double db_y[2] = {(3 * t_y - 1) * (t_y - 1), t_y * (3 * t_y - 2)};
+
+	// Sum contributions of all nodes of cell
+	//
+	double value = 0;
+	double df_dx = 0;
+	double df_dy = 0;
+
+	for (int j_x = 0; j_x < 2; j_x++) {
+		for (int j_y = 0; j_y < 2; j_y++) {
+			int node = nodes[2 * j_x + j_y];
+			double f = spline->f[node];
+			double f_x = spline->f_x[node];
+			double f_y = spline->f_y[node];
+			double f_xy = spline->f_xy[node];
+
+			value += a_x[j_x] * (a_y[j_y] * f + b_y[j_y] * f_y) +
+				b_x[j_x] * (a_y[j_y] * f_x + b_y[j_y] * f_xy);
+			df_dx += da_x[j_x] * (a_y[j_y] * f + b_y[j_y] * f_y) +
+				db_x[j_x] * (a_y[j_y] * f_x + b_y[j_y] * f_xy);
+			df_dy += a_x[j_x] * (da_y[j_y] * f + db_y[j_y] * f_y) +
+				b_x[j_x] * (da_y[j_y] * f_x + db_y[j_y] * f_xy);
+		}
+	}
+
+	*ret_value = value;
+	*ret_df_dx = df_dx;
+	*ret_df_dy = df_dy;
+	return 0;
+}
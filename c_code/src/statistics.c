@@ -0,0 +1,771 @@
+//////////////////
+// statistics.c //
+//////////////////
+#ifdef __unix
+#include <time.h>
+#else
+#include <windows.h>
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "statistics.h"
+#include "status.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+/*
+ * STATISTICS_ADD / STATISTICS_LOAD / STATISTICS_STORE:
+ * ----------------------------------------------------
+ *
+ * Atomic operations on counters of type unsigned long long. Counters are only
+ * summed up and, thus, no ordering between counters is required.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#if defined(__GNUC__)
+	#define STATISTICS_ADD(counter, value) \
+		__atomic_add_fetch((counter), (value), __ATOMIC_RELAXED)
+	#define STATISTICS_LOAD(counter) \
+		__atomic_load_n((counter), __ATOMIC_RELAXED)
+	#define STATISTICS_STORE(counter, value) \
+		__atomic_store_n((counter), (value), __ATOMIC_RELAXED)
+#else
+	#include <intrin.h>
+	#define STATISTICS_ADD(counter, value) \
+		_InterlockedExchangeAdd64((__int64 volatile *) (counter), \
+			(__int64) (value))
+	#define STATISTICS_LOAD(counter) \
+		(*((unsigned long long volatile *) (counter)))
+	#define STATISTICS_STORE(counter, value) \
+		_InterlockedExchange64((__int64 volatile *) (counter), \
+			(__int64) (value))
+#endif
+
+#define STATISTICS_NAME(name) #name,
+
+
+///////////////////////////
+// Definition of structs //
+///////////////////////////
+/*
+ * StatisticsFunction:
+ * -------------------
+ *
+ * Contains statistics of calls of a function.
+ *
+ * Attributes:
+ * -----------
+ *	const char *name:
+ *		Name of function.
+ *	unsigned long long no_calls:
+ *		Number of calls.
+ *	unsigned long long time_ns:
+ *		Cumulative time of all calls in ns.
+ *	unsigned long long bins[]:
+ *		Latency histogram with logarithmic bins (see STATISTICS_NO_BINS_TIME).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/*
+ * StatisticsSolver:
+ * -----------------
+ *
+ * Contains statistics of calls of an iterative solver.
+ *
+ * Attributes:
+ * -----------
+ *	const char *name:
+ *		Name of solver.
+ *	unsigned long long no_calls:
+ *		Number of calls.
+ *	unsigned long long no_failures:
+ *		Number of calls that did not converge.
+ *	unsigned long long iterations:
+ *		Cumulative number of iterations of all calls.
+ *	unsigned long long bins[]:
+ *		Iteration histogram with logarithmic bins (see
+ *		STATISTICS_NO_BINS_ITERATIONS).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/*
+ * Statistics:
+ * -----------
+ *
+ * Contains snapshot of statistics of all instrumented functions and solvers.
+ *
+ * Attributes:
+ * -----------
+ *	int enabled:
+ *		Flag indicating whether instrumentation is compiled (i.e., whether
+ *		SORP_STATS was defined).
+ *	StatisticsFunction functions[]:
+ *		Statistics of functions of the WorkingPair-struct.
+ *	StatisticsSolver solvers[]:
+ *		Statistics of iterative solvers.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/////////////////////////////
+// Definition of variables //
+/////////////////////////////
+/*
+ * Statistics of all threads: Counters are updated atomically by all threads.
+ * Thus, statistics of batch evaluations are complete and snapshots can be
+ * created at any time.
+ *
+ */
+Statistics statistics_global;
+
+/*
+ * Names of instrumented functions and solvers in order of their indices.
+ *
+ */
+const char *statistics_names_functions[] = {
+	STATISTICS_FUNCTIONS(STATISTICS_NAME)
+};
+const char *statistics_names_solvers[] = {
+	STATISTICS_SOLVERS(STATISTICS_NAME)
+};
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * statistics_now_ns:
+ * ------------------
+ *
+ * Auxiliary function returning current time of a monotonic clock in ns.
+ *
+ * Returns:
+ * --------
+ *	unsigned long long:
+ *		Current time in ns.
+ *
+ * Remarks:
+ * --------
+ *	Only differences of returned values are meaningful.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+unsigned long long statistics_now_ns(void) {
+#ifdef __unix
+	struct timespec time_now;
+	clock_gettime(CLOCK_MONOTONIC, &time_now);
+
+	return (unsigned long long) time_now.tv_sec * 1000000000ULL +
+		(unsigned long long) time_now.tv_nsec;
+#else
+	static LARGE_INTEGER frequency;
+	LARGE_INTEGER time_now;
+
+	if (frequency.QuadPart == 0) {
+		QueryPerformanceFrequency(&frequency);
+	}
+	QueryPerformanceCounter(&time_now);
+
+	return (unsigned long long) (1e9 * (double) time_now.QuadPart /
+		(double) frequency.QuadPart);
+#endif
+}
+
+
+/*
+ * statistics_bin:
+ * ---------------
+ *
+ * Auxiliary function returning logarithmic bin of a value (i.e., number of
+ * binary digits of value limited to last bin).
+ *
+ * Parameters:
+ * -----------
+ *	unsigned long long value:
+ *		Value to be sorted into bins.
+ *	int no_bins:
+ *		Number of bins.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Bin of value.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int statistics_bin(unsigned long long value, int no_bins) {
+	int bin = 0;
+
+	while (value > 0 && bin < no_bins - 1) {
+		value >>= 1;
+		bin++;
+	}
+	return bin;
+}
+
+
+/*
+ * statistics_function:
+ * --------------------
+ *
+ * Auxiliary function recording a call of a function of the WorkingPair-struct
+ * and its time. Function is called by macro STATISTICS_RETURN.
+ *
+ * Parameters:
+ * -----------
+ *	int index:
+ *		Index of function (i.e., STATISTICS_FUNCTION_*).
+ *	unsigned long long start_ns:
+ *		Time at beginning of call in ns.
+ *	double value:
+ *		Value returned by function.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns value given as input.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double statistics_function(int index, unsigned long long start_ns,
+	double value) {
+	unsigned long long time_ns = statistics_now_ns() - start_ns;
+	StatisticsFunction *function = &statistics_global.functions[index];
+
+	STATISTICS_ADD(&function->no_calls, 1);
+	STATISTICS_ADD(&function->time_ns, time_ns);
+	STATISTICS_ADD(&function->bins[statistics_bin(time_ns,
+		STATISTICS_NO_BINS_TIME)], 1);
+
+	return value;
+}
+
+
+/*
+ * statistics_solver:
+ * ------------------
+ *
+ * Auxiliary function recording a call of an iterative solver. Function is
+ * called by macro STATISTICS_SOLVER.
+ *
+ * Parameters:
+ * -----------
+ *	int index:
+ *		Index of solver (i.e., STATISTICS_SOLVER_*).
+ *	int iterations:
+ *		Number of iterations.
+ *	int converged:
+ *		Flag indicating whether solver converged.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void statistics_solver(int index, int iterations, int converged) {
+	StatisticsSolver *solver = &statistics_global.solvers[index];
+	unsigned long long no_iterations = (iterations < 0) ? 0 :
+		(unsigned long long) iterations;
+
+	STATISTICS_ADD(&solver->no_calls, 1);
+	STATISTICS_ADD(&solver->iterations, no_iterations);
+	STATISTICS_ADD(&solver->bins[statistics_bin(no_iterations,
+		STATISTICS_NO_BINS_ITERATIONS)], 1);
+
+	if (!converged) {
+		STATISTICS_ADD(&solver->no_failures, 1);
+	}
+}
+
+
+/*
+ * sorp_stats_enabled:
+ * -------------------
+ *
+ * Returns flag indicating whether instrumentation is compiled.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 1 if library is compiled with SORP_STATS and 0 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int sorp_stats_enabled(void) {
+#ifdef SORP_STATS
+	return 1;
+#else
+	return 0;
+#endif
+}
+
+
+/*
+ * sorp_stats_snapshot:
+ * --------------------
+ *
+ * Creates snapshot of statistics of all threads. Statistics keep being
+ * recorded while and after snapshot is created.
+ *
+ * Returns:
+ * --------
+ *	struct *Statistics:
+ *		Returns pointer of Statistics-struct or NULL if memory cannot be
+ *		allocated.
+ *
+ * Remarks:
+ * --------
+ *	Snapshot must be deleted by delStatistics. Counters are read one by one
+ *	and, thus, calls of other threads during snapshot may only be partially
+ *	contained.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API Statistics *sorp_stats_snapshot(void) {
+	// Try to allocate memory for snapshot
+	//
+	Statistics *retStatistics = (Statistics *) malloc(sizeof(Statistics));
+
+	if (retStatistics == NULL) {
+		if (status_report(STATUS_NO_MEMORY, "sorp_stats_snapshot", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for Statistics-struct.");
+		}
+		return NULL;
+	}
+
+	// Copy counters of all functions and solvers
+	//
+	retStatistics->enabled = sorp_stats_enabled();
+
+	for (int i = 0; i < STATISTICS_NO_FUNCTIONS; i++) {
+		StatisticsFunction *global = &statistics_global.functions[i];
+		StatisticsFunction *copy = &retStatistics->functions[i];
+
+		copy->name = statistics_names_functions[i];
+		copy->no_calls = STATISTICS_LOAD(&global->no_calls);
+		copy->time_ns = STATISTICS_LOAD(&global->time_ns);
+
+		for (int j = 0; j < STATISTICS_NO_BINS_TIME; j++) {
+			copy->bins[j] = STATISTICS_LOAD(&global->bins[j]);
+		}
+	}
+
+	for (int i = 0; i < STATISTICS_NO_SOLVERS; i++) {
+		StatisticsSolver *global = &statistics_global.solvers[i];
+		StatisticsSolver *copy = &retStatistics->solvers[i];
+
+		copy->name = statistics_names_solvers[i];
+		copy->no_calls = STATISTICS_LOAD(&global->no_calls);
+		copy->no_failures = STATISTICS_LOAD(&global->no_failures);
+		copy->iterations = STATISTICS_LOAD(&global->iterations);
+
+		for (int j = 0; j < STATISTICS_NO_BINS_ITERATIONS; j++) {
+			copy->bins[j] = STATISTICS_LOAD(&global->bins[j]);
+		}
+	}
+
+	return retStatistics;
+}
+
+
+/*
+ * sorp_stats_reset:
+ * -----------------
+ *
+ * Resets statistics of all threads.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void sorp_stats_reset(void) {
+	for (int i = 0; i < STATISTICS_NO_FUNCTIONS; i++) {
+		StatisticsFunction *global = &statistics_global.functions[i];
+
+		STATISTICS_STORE(&global->no_calls, 0);
+		STATISTICS_STORE(&global->time_ns, 0);
+
+		for (int j = 0; j < STATISTICS_NO_BINS_TIME; j++) {
+			STATISTICS_STORE(&global->bins[j], 0);
+		}
+	}
+
+	for (int i = 0; i < STATISTICS_NO_SOLVERS; i++) {
+		StatisticsSolver *global = &statistics_global.solvers[i];
+
+		STATISTICS_STORE(&global->no_calls, 0);
+		STATISTICS_STORE(&global->no_failures, 0);
+		STATISTICS_STORE(&global->iterations, 0);
+
+		for (int j = 0; j < STATISTICS_NO_BINS_ITERATIONS; j++) {
+			STATISTICS_STORE(&global->bins[j], 0);
+		}
+	}
+}
+
+
+/*
+ * sorp_stats_dump:
+ * ----------------
+ *
+ * Writes statistics as JSON file. Only functions and solvers that have been
+ * called are written.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path:
+ *		Path of JSON file. If path is NULL, JSON is printed to standard output.
+ *	void *statistics:
+ *		Pointer of Statistics-struct. If pointer is NULL, a new snapshot is
+ *		taken.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if statistics are written and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int sorp_stats_dump(const char *path, void *statistics) {
+	// Take snapshot if no snapshot is given
+	//
+	Statistics *retStatistics = (statistics == NULL) ?
+		sorp_stats_snapshot() : (Statistics *) statistics;
+
+	if (retStatistics == NULL) {
+		return -1;
+	}
+
+	// Open file or use standard output
+	//
+	FILE *fp = NULL;
+
+	if (path == NULL) {
+		fp = stdout;
+
+	} else {
+		#ifdef __unix
+		fp = fopen(path, "wb");
+		#else
+		if (fopen_s(&fp, path, "wb") != 0) {
+			fp = NULL;
+		}
+		#endif
+	}
+
+	// Write JSON: Histograms are written as arrays and names of functions and
+	// solvers do not need to be escaped
+	//
+	int error = (fp == NULL);
+	const char *separator = "";
+
+	if (!error) {
+		fprintf(fp, "{\n\t\"enabled\": %s,\n\t\"functions\": {",
+			retStatistics->enabled ? "true" : "false");
+
+		for (int i = 0; i < STATISTICS_NO_FUNCTIONS; i++) {
+			StatisticsFunction *function = &retStatistics->functions[i];
+
+			if (function->no_calls == 0) {
+				continue;
+			}
+
+			fprintf(fp, "%s\n\t\t\"%s\": {\"calls\": %.0f, \"time-s\": %.9g, "
+				"\"mean-time-ns\": %.6g, \"histogram-time-ns\": [", separator,
+				function->name, (double) function->no_calls,
+				1e-9 * (double) function->time_ns,
+				(double) function->time_ns / (double) function->no_calls);
+
+			for (int j = 0; j < STATISTICS_NO_BINS_TIME; j++) {
+				fprintf(fp, (j == 0) ? "%.0f" : ", %.0f",
+					(double) function->bins[j]);
+			}
+			fprintf(fp, "]}");
+			separator = ",";
+		}
+
+		fprintf(fp, "\n\t},\n\t\"solvers\": {");
+		separator = "";
+
+		for (int i = 0; i < STATISTICS_NO_SOLVERS; i++) {
+			StatisticsSolver *solver = &retStatistics->solvers[i];
+
+			if (solver->no_calls == 0) {
+				continue;
+			}
+
+			fprintf(fp, "%s\n\t\t\"%s\": {\"calls\": %.0f, \"failures\": %.0f, "
+				"\"mean-iterations\": %.6g, \"histogram-iterations\": [",
+				separator, solver->name, (double) solver->no_calls,
+				(double) solver->no_failures,
+				(double) solver->iterations / (double) solver->no_calls);
+
+			for (int j = 0; j < STATISTICS_NO_BINS_ITERATIONS; j++) {
+				fprintf(fp, (j == 0) ? "%.0f" : ", %.0f",
+					(double) solver->bins[j]);
+			}
+			fprintf(fp, "]}");
+			separator = ",";
+		}
+
+		error = (fprintf(fp, "\n\t}\n}\n") < 0);
+	}
+
+	if (fp != NULL && fp != stdout) {
+		error = (fclose(fp) != 0) || error;
+	}
+
+	if (statistics == NULL) {
+		delStatistics(retStatistics);
+	}
+
+	if (error) {
+		if (status_report(STATUS_INVALID_INPUT, "sorp_stats_dump", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot write statistics to file \"%s\".",
+				(path == NULL) ? "stdout" : path);
+		}
+		return -1;
+	}
+
+	return 0;
+}
+
+
+/*
+ * delStatistics:
+ * --------------
+ *
+ * Frees memory of Statistics-struct.
+ *
+ * Parameters:
+ * -----------
+ *	void *statistics:
+ *		Pointer of Statistics-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void delStatistics(void *statistics) {
+	free(statistics);
+}
+
+
+/*
+ * getStatisticsNoCalls:
+ * ---------------------
+ *
+ * Returns number of calls of a function or solver of a snapshot.
+ *
+ * Parameters:
+ * -----------
+ *	const char *name:
+ *		Name of function or solver (e.g., "ads_w_pT").
+ *	void *statistics:
+ *		Pointer of Statistics-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Number of calls or -1 if function or solver is not instrumented.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double getStatisticsNoCalls(const char *name, void *statistics) {
+	Statistics *retStatistics = (Statistics *) statistics;
+
+	if (retStatistics == NULL || name == NULL) {
+		return -1;
+	}
+
+	for (int i = 0; i < STATISTICS_NO_FUNCTIONS; i++) {
+		if (strcmp(retStatistics->functions[i].name, name) == 0) {
+			return (double) retStatistics->functions[i].no_calls;
+		}
+	}
+	for (int i = 0; i < STATISTICS_NO_SOLVERS; i++) {
+		if (strcmp(retStatistics->solvers[i].name, name) == 0) {
+			return (double) retStatistics->solvers[i].no_calls;
+		}
+	}
+	return -1;
+}
+
+
+/*
+ * sorp_stats_no_calls:
+ * --------------------
+ *
+ * Returns number of calls of all instrumented functions of all threads since
+ * last reset (e.g., to count external function calls of a Modelica simulation
+ * with and without derivative annotations).
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Number of calls or -1 if library is not compiled with SORP_STATS or
+ *		memory of snapshot cannot be allocated.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double sorp_stats_no_calls(void) {
+	Statistics *retStatistics = sorp_stats_enabled() ? sorp_stats_snapshot() :
+		NULL;
+
+	if (retStatistics == NULL) {
+		return -1;
+	}
+
+	double no_calls = 0;
+
+	for (int i = 0; i < STATISTICS_NO_FUNCTIONS; i++) {
+		no_calls += (double) retStatistics->functions[i].no_calls;
+	}
+
+	delStatistics(retStatistics);
+	return no_calls;
+}
+
+
+/*
+ * getStatisticsTime:
+ * ------------------
+ *
+ * Returns cumulative time of all calls of a function of a snapshot.
+ *
+ * Parameters:
+ * -----------
+ *	const char *name:
+ *		Name of function (e.g., "ads_w_pT").
+ *	void *statistics:
+ *		Pointer of Statistics-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Cumulative time in s or -1 if function is not instrumented.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double getStatisticsTime(const char *name, void *statistics) {
+	Statistics *retStatistics = (Statistics *) statistics;
+
+	if (retStatistics == NULL || name == NULL) {
+		return -1;
+	}
+
+	for (int i = 0; i < STATISTICS_NO_FUNCTIONS; i++) {
+		if (strcmp(retStatistics->functions[i].name, name) == 0) {
+			return 1e-9 * (double) retStatistics->functions[i].time_ns;
+		}
+	}
+	return -1;
+}
+
+
+/*
+ * getStatisticsNoFailures:
+ * ------------------------
+ *
+ * Returns number of calls of a solver of a snapshot that did not converge.
+ *
+ * Parameters:
+ * -----------
+ *	const char *name:
+ *		Name of solver (e.g., "absorption_mixing_p_Tx_internal").
+ *	void *statistics:
+ *		Pointer of Statistics-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Number of failures or -1 if solver is not instrumented.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double getStatisticsNoFailures(const char *name, void *statistics) {
+	Statistics *retStatistics = (Statistics *) statistics;
+
+	if (retStatistics == NULL || name == NULL) {
+		return -1;
+	}
+
+	for (int i = 0; i < STATISTICS_NO_SOLVERS; i++) {
+		if (strcmp(retStatistics->solvers[i].name, name) == 0) {
+			return (double) retStatistics->solvers[i].no_failures;
+		}
+	}
+	return -1;
+}
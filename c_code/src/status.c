@@ -0,0 +1,381 @@
+//////////////
+// status.c //
+//////////////
+#include <stdio.h>
+#include "status.h"
+#include "threadLocal.h"
+#include "structDefinitions.c"
+
+
+///////////////////////////
+// Definition of structs //
+///////////////////////////
+/*
+ * Status:
+ * -------
+ *
+ * Contains last failure of a thread. Each thread owns one status record and,
+ * thus, the record can be read after a function call without locks.
+ *
+ * Attributes:
+ * -----------
+ *	int code:
+ *		Code of last failure (i.e., STATUS_OK if no failure occurred).
+ *	const char *function:
+ *		Name of function that failed (i.e., NULL if no failure occurred).
+ *	int iterations:
+ *		Number of iterations of failed iterative method (i.e., 0 for
+ *		non-iterative functions).
+ *	double residual:
+ *		Last residual of failed iterative method (e.g., difference between
+ *		calculated and given pressure) or value that is out of range.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+
+/////////////////////////////
+// Definition of variables //
+/////////////////////////////
+/*
+ * Status record of each thread: Record contains last failure until it is
+ * reset. Thus, status can be checked after a sequence of function calls.
+ *
+ */
+THREAD_LOCAL Status status_last = {STATUS_OK, NULL, 0, 0};
+
+/*
+ * Flags indicating whether warnings are suppressed for all threads or for
+ * calling thread only.
+ *
+ */
+int status_quiet = 0;
+THREAD_LOCAL int status_quiet_calling_thread = 0;
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * status_report:
+ * --------------
+ *
+ * Auxiliary function recording a failure in the status record of the calling
+ * thread. Function is called instead of printing a warning directly: Warnings
+ * are only printed if the function returns 1.
+ *
+ * Parameters:
+ * -----------
+ *	int code:
+ *		Code of failure.
+ *	const char *function:
+ *		Name of function that failed.
+ *	int iterations:
+ *		Number of iterations of iterative method.
+ *	double residual:
+ *		Last residual of iterative method or value that is out of range.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 1 if warning shall be printed and 0 if quiet mode is enabled
+ *		globally or for the calling thread.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int status_report(int code, const char *function, int iterations,
+	double residual) {
+	status_last.code = code;
+	status_last.function = function;
+	status_last.iterations = iterations;
+	status_last.residual = residual;
+
+	return !(status_quiet || status_quiet_calling_thread);
+}
+
+
+/*
+ * status_quiet_thread:
+ * --------------------
+ *
+ * Auxiliary function enabling or disabling quiet mode for the calling thread
+ * only (e.g., while batch functions fill arrays of status codes).
+ *
+ * Parameters:
+ * -----------
+ *	int quiet:
+ *		Flag indicating whether warnings of calling thread are suppressed.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Previous flag of calling thread.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int status_quiet_thread(int quiet) {
+	int quiet_previous = status_quiet_calling_thread;
+
+	status_quiet_calling_thread = quiet;
+	return quiet_previous;
+}
+
+
+/*
+ * status_code:
+ * ------------
+ *
+ * Auxiliary function returning code of status record of calling thread and
+ * resetting it afterwards. Function is used by batch functions after each
+ * state.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Code of last failure.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int status_code(void) {
+	int code = status_last.code;
+
+	status_last.code = STATUS_OK;
+	return code;
+}
+
+
+/*
+ * status_record:
+ * --------------
+ *
+ * Auxiliary function returning a copy of status record of calling thread
+ * without resetting it. Function is used by caches to store failures together
+ * with cached results.
+ *
+ * Returns:
+ * --------
+ *	Status:
+ *		Copy of status record.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+Status status_record(void) {
+	return status_last;
+}
+
+
+/*
+ * setStatusQuiet:
+ * ---------------
+ *
+ * Enables or disables quiet mode of all threads. In quiet mode, no warnings are
+ * printed, but failures are still recorded in the status records.
+ *
+ * Parameters:
+ * -----------
+ *	int quiet:
+ *		Flag indicating whether warnings are suppressed.
+ *
+ * Remarks:
+ * --------
+ *	Quiet mode should be set before threads call functions of the library.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void setStatusQuiet(int quiet) {
+	status_quiet = quiet;
+}
+
+
+/*
+ * getStatusQuiet:
+ * ---------------
+ *
+ * Returns flag indicating whether quiet mode of all threads is enabled.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Flag indicating whether warnings are suppressed.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getStatusQuiet(void) {
+	return status_quiet;
+}
+
+
+/*
+ * resetStatus:
+ * ------------
+ *
+ * Resets status record of calling thread to STATUS_OK.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void resetStatus(void) {
+	status_last.code = STATUS_OK;
+	status_last.function = NULL;
+	status_last.iterations = 0;
+	status_last.residual = 0;
+}
+
+
+/*
+ * getStatusCode:
+ * --------------
+ *
+ * Returns code of last failure of calling thread.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Code of last failure (i.e., STATUS_OK if no failure occurred since
+ *		last reset).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getStatusCode(void) {
+	return status_last.code;
+}
+
+
+/*
+ * getStatusFunction:
+ * ------------------
+ *
+ * Returns name of function of last failure of calling thread.
+ *
+ * Returns:
+ * --------
+ *	const char *:
+ *		Name of function (i.e., "" if no failure occurred since last reset).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API const char *getStatusFunction(void) {
+	return (status_last.function == NULL) ? "" : status_last.function;
+}
+
+
+/*
+ * getStatusIterations:
+ * --------------------
+ *
+ * Returns number of iterations of last failure of calling thread.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of iterations (i.e., 0 for non-iterative functions).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getStatusIterations(void) {
+	return status_last.iterations;
+}
+
+
+/*
+ * getStatusResidual:
+ * ------------------
+ *
+ * Returns residual of last failure of calling thread.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Last residual of iterative method or value that is out of range.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double getStatusResidual(void) {
+	return status_last.residual;
+}
+
+
+/*
+ * getStatusMessage:
+ * -----------------
+ *
+ * Returns description of a status code.
+ *
+ * Parameters:
+ * -----------
+ *	int code:
+ *		Status code.
+ *
+ * Returns:
+ * --------
+ *	const char *:
+ *		Description of status code.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API const char *getStatusMessage(int code) {
+	static const char *messages[STATUS_NO_CODES] = {
+		"No failure occurred.",
+		"Struct does not exist.",
+		"Function or its coefficients are not implemented.",
+		"Iterative method did not converge.",
+		"State is out of range.",
+		"Inputs are invalid.",
+		"Memory cannot be allocated.",
+		"Database cannot be read or does not contain entry."};
+
+	return (code < 0 || code >= STATUS_NO_CODES) ? "Unknown status code." :
+		messages[code];
+}
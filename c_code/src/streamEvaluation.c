@@ -0,0 +1,491 @@
+////////////////////////
+// streamEvaluation.c //
+////////////////////////
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "batchPool.h"
+#include "status.h"
+#include "streamEvaluation.h"
+#include "workingPair.h"
+#include "workingPairBatch.h"
+#include "structDefinitions.c"
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * stream_warning:
+ * ---------------
+ *
+ * Auxiliary function reporting an error that stops streaming evaluation.
+ *
+ * Parameters:
+ * -----------
+ *	int code:
+ *		Status code of error.
+ *	const char *message:
+ *		Description of error.
+ *	long long line:
+ *		Line or record at which error occurred (i.e., 0 if unknown).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static void stream_warning(int code, const char *message, long long line) {
+	if (status_report(code, "streamEvaluation_run", 0, 0)) {
+		fprintf(stderr, "\n\n###########\n# Warning #\n###########");
+		fprintf(stderr, "\n%s", message);
+		if (line > 0) {
+			fprintf(stderr, " (i.e., at line or record %lld)", line);
+		}
+		fprintf(stderr, "\nStop function call \"streamEvaluation_run\".\n");
+	}
+}
+
+
+/*
+ * stream_parse:
+ * -------------
+ *
+ * Auxiliary function splitting a CSV line into fields and converting the
+ * selected fields to inputs of one row.
+ *
+ * Parameters:
+ * -----------
+ *	double **ret_inputs:
+ *		Arrays of inputs of block.
+ *	int row:
+ *		Row within block.
+ *	const char **fields:
+ *		Array to be filled with beginnings of fields.
+ *	char *line:
+ *		Line of CSV file.
+ *	const struct *StreamEvaluation:
+ *		Options of streaming evaluation.
+ *	int no_inputs:
+ *		Number of inputs of function.
+ *	int no_columns:
+ *		Number of columns needed (i.e., largest selected column plus 1).
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all selected fields are numbers and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static int stream_parse(double **ret_inputs, int row, const char **fields,
+	char *line, const StreamEvaluation *stream, int no_inputs,
+	int no_columns) {
+	// Find beginnings of needed fields
+	//
+	int no_found = 0;
+	char *position = line;
+
+	while (no_found < no_columns) {
+		fields[no_found++] = position;
+		position = strchr(position, stream->delimiter);
+
+		if (position == NULL) {
+			break;
+		}
+		position++;
+	}
+
+	// Convert selected fields: Field must only contain number surrounded by
+	// white spaces
+	//
+	int valid = 0;
+
+	for (int i = 0; i < no_inputs; i++) {
+		int column = stream->columns[i];
+		char *end = NULL;
+
+		if (column < no_found) {
+			ret_inputs[i][row] = strtod(fields[column], &end);
+
+			if (end != fields[column]) {
+				while (*end != stream->delimiter &&
+					isspace((unsigned char) *end)) {
+					end++;
+				}
+			}
+		}
+
+		if (end == NULL || end == fields[column] ||
+			(*end != stream->delimiter && *end != '\0')) {
+			ret_inputs[i][row] = 0;
+			valid = -1;
+		}
+	}
+	return valid;
+}
+
+
+/*
+ * stream_read:
+ * ------------
+ *
+ * Auxiliary function reading next block of rows.
+ *
+ * Parameters:
+ * -----------
+ *	int *ret_no_rows:
+ *		Number of rows of block.
+ *	double **ret_inputs:
+ *		Arrays to be filled with inputs of block.
+ *	char *ret_invalid:
+ *		Array to be filled with flags indicating rows with invalid fields.
+ *	long long *ret_line:
+ *		Number of lines or records read so far.
+ *	void *buffer:
+ *		Buffer holding binary records or CSV line and beginnings of fields.
+ *	FILE *input:
+ *		Stream of inputs.
+ *	const struct *StreamEvaluation:
+ *		Options of streaming evaluation.
+ *	int no_inputs:
+ *		Number of inputs of function.
+ *	int no_columns:
+ *		Number of columns needed (i.e., largest selected column plus 1).
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if block was read and -1 if an error occurred.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static int stream_read(int *ret_no_rows, double **ret_inputs,
+	char *ret_invalid, long long *ret_line, void *buffer, FILE *input,
+	const StreamEvaluation *stream, int no_inputs, int no_columns) {
+	*ret_no_rows = 0;
+
+	if (stream->binary_input) {
+		// Read whole records and scatter selected fields into arrays
+		//
+		size_t size_record = stream->no_fields * sizeof(double);
+		size_t no_bytes = fread(buffer, 1, stream->block_size * size_record,
+			input);
+		const double *records = (const double *) buffer;
+
+		if (no_bytes % size_record != 0) {
+			stream_warning(STATUS_INVALID_INPUT, "Last binary record is "
+				"truncated.", *ret_line + no_bytes / size_record + 1);
+			return -1;
+		}
+
+		int n = (int) (no_bytes / size_record);
+		for (int i = 0; i < no_inputs; i++) {
+			const double *field = records + stream->columns[i];
+			double *values = ret_inputs[i];
+
+			for (int j = 0; j < n; j++) {
+				values[j] = field[(size_t) j * stream->no_fields];
+			}
+		}
+
+		memset(ret_invalid, 0, n);
+		*ret_no_rows = n;
+		*ret_line += n;
+
+	} else {
+		// Read lines until block is full: Line is followed by beginnings of
+		// its fields within buffer
+		//
+		char *line = (char *) buffer;
+		const char **fields = (const char **) (line + STREAM_MAX_LINE);
+
+		while (*ret_no_rows < stream->block_size &&
+			fgets(line, STREAM_MAX_LINE, input) != NULL) {
+			size_t length = strlen(line);
+			(*ret_line)++;
+
+			if (length == STREAM_MAX_LINE - 1 && line[length - 1] != '\n' &&
+				!feof(input)) {
+				stream_warning(STATUS_INVALID_INPUT, "Line of CSV file is too "
+					"long.", *ret_line);
+				return -1;
+			}
+
+			char *position = line;
+			while (isspace((unsigned char) *position)) {
+				position++;
+			}
+
+			if (*ret_line <= stream->no_header || *position == '\0') {
+				continue;
+			}
+
+			ret_invalid[*ret_no_rows] = (char) (stream_parse(ret_inputs,
+				*ret_no_rows, fields, line, stream, no_inputs,
+				no_columns) != 0);
+			(*ret_no_rows)++;
+		}
+	}
+
+	if (ferror(input)) {
+		stream_warning(STATUS_INVALID_INPUT, "Cannot read inputs.", *ret_line);
+		return -1;
+	}
+	return 0;
+}
+
+
+/*
+ * stream_write:
+ * -------------
+ *
+ * Auxiliary function writing outputs of a block.
+ *
+ * Parameters:
+ * -----------
+ *	FILE *output:
+ *		Stream of outputs.
+ *	double **outputs:
+ *		Arrays of outputs (i.e., values and mole fractions of both components
+ *		in vapor phase).
+ *	int no_outputs:
+ *		Number of arrays of outputs.
+ *	const int *status:
+ *		Array of status codes.
+ *	void *buffer:
+ *		Buffer that can hold one binary record per row.
+ *	int no_rows:
+ *		Number of rows of block.
+ *	const struct *StreamEvaluation:
+ *		Options of streaming evaluation.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if block was written and -1 if an error occurred.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static int stream_write(FILE *output, double **outputs, int no_outputs,
+	const int *status, void *buffer, int no_rows,
+	const StreamEvaluation *stream) {
+	if (stream->binary_output) {
+		// Gather outputs into records and write them at once
+		//
+		int no_fields = no_outputs + stream->write_status;
+		double *records = (double *) buffer;
+
+		for (int j = 0; j < no_rows; j++) {
+			double *record = records + (size_t) j * no_fields;
+
+			for (int i = 0; i < no_outputs; i++) {
+				record[i] = outputs[i][j];
+			}
+			if (stream->write_status) {
+				record[no_outputs] = status[j];
+			}
+		}
+
+		if (fwrite(records, no_fields * sizeof(double), no_rows, output) !=
+			(size_t) no_rows) {
+			stream_warning(STATUS_INVALID_INPUT, "Cannot write outputs.", 0);
+			return -1;
+		}
+
+	} else {
+		// Write one line per row with round-trip precision
+		//
+		for (int j = 0; j < no_rows; j++) {
+			fprintf(output, "%.17g", outputs[0][j]);
+
+			for (int i = 1; i < no_outputs; i++) {
+				fprintf(output, "%c%.17g", stream->delimiter, outputs[i][j]);
+			}
+			if (stream->write_status) {
+				fprintf(output, "%c%i", stream->delimiter, status[j]);
+			}
+			fputc('\n', output);
+		}
+
+		if (ferror(output)) {
+			stream_warning(STATUS_INVALID_INPUT, "Cannot write outputs.", 0);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+
+/*
+ * streamEvaluation_run:
+ * ---------------------
+ *
+ * Reads rows of inputs block by block, evaluates each block by
+ * batch_evaluate, and writes one row of outputs per row of inputs. Memory is
+ * independent of number of rows because only one block is kept.
+ *
+ * CSV rows are written as value, mole fractions of both components in vapor
+ * phase (i.e., only for mixing rules), and status code (i.e., only if
+ * requested), separated by the delimiter. Binary records contain the same
+ * fields as doubles in native byte order.
+ *
+ * Parameters:
+ * -----------
+ *	long long *ret_no_rows:
+ *		Number of rows that were evaluated.
+ *	FILE *input:
+ *		Stream of inputs (i.e., opened in binary mode for binary records).
+ *	FILE *output:
+ *		Stream of outputs (i.e., opened in binary mode for binary records).
+ *	const struct *StreamEvaluation:
+ *		Options of streaming evaluation.
+ *	void *batchPool:
+ *		Pointer of BatchPool-struct evaluating blocks.
+ *	void *workingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all rows were evaluated and -1 if stream was stopped by
+ *		an error (e.g., invalid options, truncated binary record, or too
+ *		long line).
+ *
+ * Remarks:
+ * --------
+ *	CSV fields that are no numbers do not stop the stream: Their rows are
+ *	returned with value -1 and status STATUS_INVALID_INPUT. Empty lines are
+ *	skipped. Warnings are written to stderr because stdout usually holds the
+ *	outputs.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int streamEvaluation_run(long long *ret_no_rows, FILE *input, FILE *output,
+	const StreamEvaluation *stream, void *batchPool, void *workingPair) {
+	// Check options
+	//
+	const BatchFunction *function = (stream == NULL) ? NULL :
+		batch_function(stream->function);
+	int no_columns = 0;
+
+	*ret_no_rows = 0;
+
+	if (function == NULL) {
+		stream_warning(STATUS_NOT_IMPLEMENTED, "Function cannot be evaluated "
+			"for arrays of states.", 0);
+		return -1;
+	}
+
+	for (int i = 0; i < function->no_inputs; i++) {
+		int column = (stream->columns == NULL) ? i : stream->columns[i];
+		no_columns = (column + 1 > no_columns) ? column + 1 : no_columns;
+
+		if (column < 0 || column > STREAM_MAX_COLUMN) {
+			no_columns = -1;
+			break;
+		}
+	}
+
+	if (no_columns < 0 || stream->columns == NULL || stream->block_size < 1 ||
+		(stream->binary_input && stream->no_fields < no_columns) ||
+		input == NULL || output == NULL || workingPair == NULL) {
+		stream_warning(STATUS_INVALID_INPUT, "Options of stream are invalid.",
+			0);
+		return -1;
+	}
+
+	// Allocate memory of one block: Buffer holds binary records of inputs or
+	// outputs, or CSV line and beginnings of its fields
+	//
+	int n = stream->block_size;
+	int no_outputs = function->vapor ? 3 : 1;
+	size_t size_record = (size_t) ((stream->binary_input &&
+		stream->no_fields > no_outputs + 1) ? stream->no_fields :
+		no_outputs + 1) * sizeof(double);
+	size_t size_buffer = (size_t) n * size_record;
+	size_t size_line = STREAM_MAX_LINE + (STREAM_MAX_COLUMN + 1) *
+		sizeof(char *);
+	size_buffer = (size_buffer > size_line) ? size_buffer : size_line;
+
+	double *values = (double *) malloc((size_t) n * (no_outputs +
+		function->no_inputs) * sizeof(double));
+	int *status = (int *) malloc((size_t) n * sizeof(int));
+	char *invalid = (char *) malloc((size_t) n);
+	void *buffer = malloc(size_buffer);
+
+	if (values == NULL || status == NULL || invalid == NULL ||
+		buffer == NULL) {
+		stream_warning(STATUS_NO_MEMORY, "Cannot allocate memory for block.",
+			0);
+		free(values);
+		free(status);
+		free(invalid);
+		free(buffer);
+		return -1;
+	}
+
+	double *outputs[3] = {values, values + n, values + 2 * (size_t) n};
+	double *inputs[BATCH_MAX_INPUTS];
+
+	for (int i = 0; i < function->no_inputs; i++) {
+		inputs[i] = values + (size_t) (no_outputs + i) * n;
+	}
+
+	// Stream blocks until end of inputs
+	//
+	long long line = 0;
+	int result = 0;
+
+	while (result == 0) {
+		int no_rows;
+		result = stream_read(&no_rows, inputs, invalid, &line, buffer, input,
+			stream, function->no_inputs, no_columns);
+
+		if (result != 0 || no_rows == 0) {
+			break;
+		}
+
+		batch_evaluate(outputs[0], function->vapor ? outputs[1] : NULL,
+			function->vapor ? outputs[2] : NULL, status, stream->function,
+			(const double **) inputs, no_rows, 0, batchPool, workingPair);
+
+		for (int j = 0; j < no_rows; j++) {
+			if (invalid[j]) {
+				outputs[0][j] = -1;
+				status[j] = STATUS_INVALID_INPUT;
+			}
+		}
+
+		result = stream_write(output, outputs, no_outputs, status, buffer,
+			no_rows, stream);
+		*ret_no_rows += (result == 0) ? no_rows : 0;
+	}
+
+	// Free memory
+	//
+	free(values);
+	free(status);
+	free(invalid);
+	free(buffer);
+
+	return result;
+}
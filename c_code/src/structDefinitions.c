@@ -3,6 +3,11 @@
 /////////////////////////
 #ifndef structDefinitions_c
 #define structDefinitions_c
+#include "propertyServer.h"
+#include "statistics.h"
+#include "threadSupport.h"
+#include "workingPairFit.h"
+#include "workingPairVerification.h"
 
 
 ////////////////////////////
@@ -20,6 +25,8 @@
  */
 typedef double (*genFunc_1_1_0)(double, double[]);
 typedef double (*genFunc_1_1_1)(double, double[], void*);
+typedef double (*genFunc_1_0_1)(double, void*);
+typedef double (*genFunc_2_0_1)(double, double, void*);
 typedef double (*genFunc_2_1_0)(double, double, double[]);
 typedef double (*genFunc_3_1_0)(double, double, double, double[]);
 typedef double (*genFunc_4_1_0)(double, double, double, double, double[]);
@@ -31,6 +38,20 @@ typedef double (*genFunc_6_1_0)(double, double, double, double, double, double,
 	double[]);
 typedef double (*genFunc_2_3_2)(double, double, double[], double[], double[],
 	void*, void*);
+typedef double (*genFunc_3_0_1)(double, double, double, void*);
+typedef double (*genFunc_4_0_1)(double, double, double, double, void*);
+typedef double (*genFunc_5_0_1)(double, double, double, double, double,
+	void*);
+typedef double (*genFunc_6_0_1)(double, double, double, double, double,
+	double, void*);
+typedef double (*genFunc_7_0_1)(double, double, double, double, double,
+	double, double, void*);
+typedef double (*genFunc_8_0_1)(double, double, double, double, double,
+	double, double, double, void*);
+typedef double (*genFunc_2_2_1)(double*, double*, double, double, void*);
+
+typedef void (*genFunc)(void);
+typedef void (*genBatchFunc)(int, int, void*);
 
 typedef void (*genMixFunc_1)(double[], double, double[]);
 typedef void (*genMixFunc_2)(double[], double, double, double, double, double,
@@ -244,6 +265,10 @@ typedef double (*genMixFunc_4)(int*, int, double, double, double, double,
  *		equilibrium temperature T in K, saturation pressure p_Sat in Pa, density
  *		of adsorpt rho in kg/m³ and molar mass of refrigerant M in kg/mol.
  *
+ *	long no_references:
+ *		Number of references to struct (i.e., number of working pairs sharing
+ *		struct).
+ *
  * Remarks:
  * --------
  *	Function returns NULL when function does not exist for a specific isotherm
@@ -259,6 +284,8 @@ typedef double (*genMixFunc_4)(int*, int, double, double, double, double,
  *		Added function pointers to Refrigerant-struct for isotherm types based
  *		on both, the surface approach using saturated vapor pressure and the
  *		volumetric approach.
+ *	10/18/2026, by agent:
+ *		Added number of references.
  *
  */
 struct Adsorption {
@@ -333,6 +360,11 @@ struct Adsorption {
 
 	double (*vol_piStar_pyxgTpsatRhoM)(double, double, double, double, double,
 		double, double, double, double[]);
+
+	// Number of references to struct that is shared by several working
+	// pairs
+	//
+	long no_references;
 };
 
 
@@ -482,6 +514,10 @@ struct Adsorption {
  *	function mix_mixture_fugacity_coefficient:
  *		Returns mixture fugacity coefficient of cubic equation of state.
  *
+ *	long no_references:
+ *		Number of references to struct (i.e., number of working pairs sharing
+ *		struct).
+ *
  * Remarks:
  * --------
  *	Function returns NULL when function does not exist for a specific isotherm
@@ -491,6 +527,8 @@ struct Adsorption {
  * --------
  *	02/13/2020, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Added number of references.
  *
  */
 struct Absorption {
@@ -557,6 +595,11 @@ struct Absorption {
 	genMixFunc_2 mix_mixture_parameters;
 	genMixFunc_3 mix_gen_parameters;
 	genMixFunc_4 mix_mixture_fugacity_coefficient;
+
+	// Number of references to struct that is shared by several working
+	// pairs
+	//
+	long no_references;
 };
 
 
@@ -607,6 +650,19 @@ struct Absorption {
  * 	function cubic_fug_coefficient:
  *		Calculates fugacity coefficient of cubic equation of state.
  *
+ *	long no_references:
+ *		Number of references to struct (i.e., number of working pairs sharing
+ *		struct).
+ *
+ * 	function uncached_p_sat_T:
+ *		Returns vapor pressure in Pa if p_sat_T is replaced by cached function.
+ * 	function uncached_dp_sat_dT:
+ *		Returns derivative of vapor pressure wrt. temperature in Pa/K if
+ *		dp_sat_dT is replaced by cached function.
+ *	long cache_id:
+ *		Unique ID identifying results of struct within per-thread cache (i.e.,
+ *		0 if cache is disabled).
+ *
  * Remarks:
  * --------
  *	Function pointer is NULL-pointer if refrigerant function does not exist.
@@ -617,6 +673,9 @@ struct Absorption {
  *		First implementation.
  *	04/07/2020, by Mirko Engelpracht:
  *		Added function pointers for cubic equations of state.
+ *	10/18/2026, by agent:
+ *		Added number of references.
+ *		Added per-thread cache of vapor pressure.
  *
  */
 struct Refrigerant {
@@ -639,6 +698,18 @@ struct Refrigerant {
 	void (*cubic_eos_parameters)(double[], double, double[]);
 	void (*cubic_gen_eos_parameters)(double[], double, double, double, double);
 	double (*cubic_fug_coefficient)(int*, double, double, double);
+
+	// Number of references to struct that is shared by several working
+	// pairs
+	//
+	long no_references;
+
+	// Pointers for vapor pressure functions that are wrapped by cached
+	// functions and ID of struct within cache
+	//
+	genFunc_1_1_1 uncached_p_sat_T;
+	genFunc_1_1_1 uncached_dp_sat_dT;
+	long cache_id;
 };
 
 
@@ -687,10 +758,44 @@ struct Refrigerant {
  *	Refrigerant *refrigerant:
  *		Struct containing function pointers for refrigerant functions.
  *
+ *	int no_iso_par:
+ *		Number of coefficients of isotherm.
+ *	int no_psat_par:
+ *		Number of coefficients of vapor pressure equation.
+ *	int no_rhol_par:
+ *		Number of coefficients of saturated liquid density equation.
+ *	int layout:
+ *		Memory layout of WorkingPair-struct (i.e., WORKINGPAIR_LAYOUT_STANDARD
+ *		or WORKINGPAIR_LAYOUT_COMPACT).
+ *
+ *	RefrigerantParameters *refrigerant_parameters:
+ *		Struct interned by database that owns coefficients of refrigerant
+ *		functions and Refrigerant-struct. NULL if working pair owns them.
+ *
+ *	WorkingPairSurrogate *surrogates:
+ *		Struct containing surrogates of equilibrium functions. NULL if
+ *		surrogates are disabled.
+ *	WorkingPairTable *tables:
+ *		Struct containing spline tables of equilibrium functions. NULL if
+ *		tables are disabled.
+ *
+ * Remarks:
+ * --------
+ *	All ads_*-, abs_*-, ref_*-, and tab_*-functions only read the struct.
+ *	Hence, several threads can evaluate the same WorkingPair-struct at the
+ *	same time. Functions enabling or disabling surrogates or tables change
+ *	the struct and must not be called while other threads use it.
+ *
  * History:
  * --------
  *	01/06/2020, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Added numbers of coefficients and memory layout.
+ *		Added interned refrigerant.
+ *		Added surrogates.
+ *		Added spline tables.
+ *		Added remarks on thread safety.
  *
  */
 struct WorkingPair {
@@ -718,6 +823,1964 @@ struct WorkingPair {
 	struct Adsorption *adsorption;
 	struct Absorption *absorption;
 	struct Refrigerant *refrigerant;
+
+	// Numbers of coefficients of functions and memory layout of struct
+	//
+	int no_iso_par;
+	int no_psat_par;
+	int no_rhol_par;
+	int layout;
+
+	// Struct interned by database that owns coefficients of refrigerant
+	// functions and Refrigerant-struct
+	//
+	struct RefrigerantParameters *refrigerant_parameters;
+
+	// Structs containing surrogates and spline tables of equilibrium
+	// functions
+	//
+	struct WorkingPairSurrogate *surrogates;
+	struct WorkingPairTable *tables;
+};
+
+
+/*
+ * Database:
+ * ---------
+ *
+ * Contains tree of JSON-structs representing content of the database. Thus,
+ * the database must only be read and parsed once when creating several working
+ * pairs or refrigerants.
+ *
+ * Attributes:
+ * -----------
+ * 	char *path_db:
+ *		Malloc-ed copy of path to database.
+ *	cJSON *json_file:
+ *		Tree of JSON-structs that represent content of database.
+ *
+ *	RefrigerantParameters **refrigerant_parameters:
+ *		Array containing refrigerants that are interned by database and shared
+ *		by working pairs and refrigerant handles.
+ *	int no_refrigerant_parameters:
+ *		Number of interned refrigerants.
+ *	long lock_refrigerant_parameters:
+ *		Spin lock that is 1 while a thread searches or changes interned
+ *		refrigerants and 0 otherwise.
+ *
+ * Remarks:
+ * --------
+ *	Tree of JSON-structs is only read after creation. Thus, several threads
+ *	can create working pairs and refrigerant handles from the same database
+ *	at the same time.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct Database {
+	// Path to database and content of database
+	//
+	char *path_db;
+	struct cJSON *json_file;
+
+	// Interned refrigerants and lock protecting them
+	//
+	struct RefrigerantParameters **refrigerant_parameters;
+	int no_refrigerant_parameters;
+	long lock_refrigerant_parameters;
+};
+
+
+/*
+ * RefrigerantParameters:
+ * ----------------------
+ *
+ * Contains coefficients of refrigerant functions and Refrigerant-struct that
+ * are read once per database and shared read-only by all working pairs and
+ * refrigerant handles using the same refrigerant, calculation approaches, and
+ * IDs of equations.
+ *
+ * Attributes:
+ * -----------
+ * 	char *wp_rf:
+ *		Malloc-ed copy of name of refrigerant.
+ * 	char *rf_psat:
+ *		Malloc-ed copy of name of calculation approach for vapor pressure.
+ * 	char *rf_rhol:
+ *		Malloc-ed copy of name of calculation approach for liquid density.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation.
+ *	int no_rhol:
+ *		ID of liquid density equation.
+ *
+ * 	double *psat_par:
+ *		Array containing coefficients of vapor pressure equation.
+ * 	double *rhol_par:
+ *		Array containing coefficients of saturated liquid density equation.
+ *	int no_psat_par:
+ *		Number of coefficients of vapor pressure equation.
+ *	int no_rhol_par:
+ *		Number of coefficients of saturated liquid density equation.
+ *
+ *	double T_min_psat_K:
+ *		Lower limit of temperature of vapor pressure equation (i.e., -1 if
+ *		not given by database).
+ *	double T_max_psat_K:
+ *		Upper limit of temperature of vapor pressure equation (i.e., -1 if
+ *		not given by database).
+ *	double T_min_rhol_K:
+ *		Lower limit of temperature of saturated liquid density equation (i.e.,
+ *		-1 if not given by database).
+ *	double T_max_rhol_K:
+ *		Upper limit of temperature of saturated liquid density equation (i.e.,
+ *		-1 if not given by database).
+ *
+ *	Refrigerant *refrigerant:
+ *		Struct containing function pointers for refrigerant functions with
+ *		enabled per-thread cache of vapor pressure.
+ *
+ *	long no_references:
+ *		Number of references to struct (i.e., database and number of working
+ *		pairs and refrigerant handles sharing struct).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct RefrigerantParameters {
+	// Key of interned refrigerant
+	//
+	char *wp_rf;
+	char *rf_psat;
+	char *rf_rhol;
+	int no_p_sat;
+	int no_rhol;
+
+	// Arrays containing coefficients of functions
+	//
+	double *psat_par;
+	double *rhol_par;
+	int no_psat_par;
+	int no_rhol_par;
+
+	// Ranges of validity of equations
+	//
+	double T_min_psat_K;
+	double T_max_psat_K;
+	double T_min_rhol_K;
+	double T_max_rhol_K;
+
+	// Struct containing function pointers of refrigerant functions
+	//
+	struct Refrigerant *refrigerant;
+
+	// Number of references to struct
+	//
+	long no_references;
+};
+
+
+/*
+ * Surrogate:
+ * ----------
+ *
+ * Contains piecewise Chebyshev polynomials approximating a function of one
+ * variable on equidistant intervals. Intervals whose approximation does not
+ * meet the required accuracy are marked and evaluated by the original
+ * function.
+ *
+ * Attributes:
+ * -----------
+ * 	function function:
+ *		Original function that is approximated depending on variable x and
+ *		pointer to data.
+ *	void *data:
+ *		Pointer to data that is passed to original function.
+ *
+ *	double x_min:
+ *		Lower limit of variable.
+ *	double x_max:
+ *		Upper limit of variable.
+ *	double inv_h:
+ *		Inverse of width of intervals.
+ *	int no_intervals:
+ *		Number of intervals.
+ *
+ *	double *coefficients:
+ *		Array containing Chebyshev coefficients of all intervals.
+ *	char *exact:
+ *		Array indicating whether interval is evaluated by original function.
+ *	double max_error:
+ *		Maximal relative error of approximation at check points.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct Surrogate {
+	// Original function
+	//
+	genFunc_1_0_1 function;
+	void *data;
+
+	// Intervals
+	//
+	double x_min;
+	double x_max;
+	double inv_h;
+	int no_intervals;
+
+	// Coefficients and accuracy
+	//
+	double *coefficients;
+	char *exact;
+	double max_error;
+};
+
+
+/*
+ * Surrogate2D:
+ * ------------
+ *
+ * Contains piecewise tensor-product Chebyshev polynomials approximating a
+ * function of two variables on equidistant cells. Cells whose approximation
+ * does not meet the required accuracy are marked and evaluated by the original
+ * function.
+ *
+ * Attributes:
+ * -----------
+ * 	function function:
+ *		Original function that is approximated depending on variables x and y
+ *		and pointer to data.
+ *	void *data:
+ *		Pointer to data that is passed to original function.
+ *	int log_output:
+ *		Flag indicating whether logarithm of function is approximated.
+ *
+ *	double x_min:
+ *		Lower limit of first variable.
+ *	double x_max:
+ *		Upper limit of first variable.
+ *	double y_min:
+ *		Lower limit of second variable.
+ *	double y_max:
+ *		Upper limit of second variable.
+ *	double inv_h_x:
+ *		Inverse of width of cells regarding first variable.
+ *	double inv_h_y:
+ *		Inverse of width of cells regarding second variable.
+ *	int no_intervals:
+ *		Number of intervals per variable.
+ *
+ *	double *coefficients:
+ *		Array containing Chebyshev coefficients of all cells.
+ *	char *exact:
+ *		Array indicating whether cell is evaluated by original function.
+ *	double max_error:
+ *		Maximal relative error of approximation at check points.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct Surrogate2D {
+	// Original function
+	//
+	genFunc_2_0_1 function;
+	void *data;
+	int log_output;
+
+	// Cells
+	//
+	double x_min;
+	double x_max;
+	double y_min;
+	double y_max;
+	double inv_h_x;
+	double inv_h_y;
+	int no_intervals;
+
+	// Coefficients and accuracy
+	//
+	double *coefficients;
+	char *exact;
+	double max_error;
+};
+
+
+/*
+ * WorkingPairSurrogate:
+ * ---------------------
+ *
+ * Contains surrogates of equilibrium functions of a working pair. Loading w
+ * denotes equilibrium loading for adsorption, concentration for conventional
+ * absorption, and mole fraction in liquid phase for absorption based on
+ * mixing rules. Pressure is approximated by its logarithm, and surrogates
+ * depending on pressure use logarithm of pressure as variable.
+ *
+ * Attributes:
+ * -----------
+ *	double p_min_Pa:
+ *		Lower limit of pressure in Pa.
+ *	double p_max_Pa:
+ *		Upper limit of pressure in Pa.
+ *	double T_min_K:
+ *		Lower limit of temperature in K.
+ *	double T_max_K:
+ *		Upper limit of temperature in K.
+ *	double w_min:
+ *		Lower limit of loading.
+ *	double w_max:
+ *		Upper limit of loading.
+ *
+ *	Surrogate2D *w_pT:
+ *		Surrogate of loading depending on pressure and temperature.
+ *	Surrogate2D *p_wT:
+ *		Surrogate of pressure depending on loading and temperature.
+ *	Surrogate2D *T_pw:
+ *		Surrogate of temperature depending on pressure and loading.
+ *	Surrogate2D *y_1_pT:
+ *		Surrogate of mole fraction of first component in vapor phase depending
+ *		on pressure and temperature (i.e., only for mixing rules).
+ *	Surrogate2D *y_1_wT:
+ *		Surrogate of mole fraction of first component in vapor phase depending
+ *		on loading and temperature (i.e., only for mixing rules).
+ *	Surrogate2D *y_1_pw:
+ *		Surrogate of mole fraction of first component in vapor phase depending
+ *		on pressure and loading (i.e., only for mixing rules).
+ *	Surrogate2D *y_2_pT:
+ *		Surrogate of mole fraction of second component in vapor phase depending
+ *		on pressure and temperature (i.e., only for mixing rules).
+ *	Surrogate2D *y_2_wT:
+ *		Surrogate of mole fraction of second component in vapor phase depending
+ *		on loading and temperature (i.e., only for mixing rules).
+ *	Surrogate2D *y_2_pw:
+ *		Surrogate of mole fraction of second component in vapor phase depending
+ *		on pressure and loading (i.e., only for mixing rules).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct WorkingPairSurrogate {
+	// Limits of surrogates
+	//
+	double p_min_Pa;
+	double p_max_Pa;
+	double T_min_K;
+	double T_max_K;
+	double w_min;
+	double w_max;
+
+	// Surrogates of equilibrium functions
+	//
+	struct Surrogate2D *w_pT;
+	struct Surrogate2D *p_wT;
+	struct Surrogate2D *T_pw;
+	struct Surrogate2D *y_1_pT;
+	struct Surrogate2D *y_1_wT;
+	struct Surrogate2D *y_1_pw;
+	struct Surrogate2D *y_2_pT;
+	struct Surrogate2D *y_2_wT;
+	struct Surrogate2D *y_2_pw;
+};
+
+
+/*
+ * Spline2D:
+ * ---------
+ *
+ * Contains bicubic Hermite spline of a function of two variables on an
+ * equidistant grid. For each node, the spline stores the value, both partial
+ * derivatives, and the mixed partial derivative of the function. Thus, the
+ * spline and its first partial derivatives are continuous and interpolate the
+ * given values and derivatives at all nodes. Cells with at least one invalid
+ * node (e.g., the original function fails) cannot be evaluated.
+ *
+ * Attributes:
+ * -----------
+ *	double x_min:
+ *		Lower limit of first variable.
+ *	double x_max:
+ *		Upper limit of first variable.
+ *	double y_min:
+ *		Lower limit of second variable.
+ *	double y_max:
+ *		Upper limit of second variable.
+ *	double h_x:
+ *		Distance between nodes regarding first variable.
+ *	double h_y:
+ *		Distance between nodes regarding second variable.
+ *	int no_nodes_x:
+ *		Number of nodes regarding first variable.
+ *	int no_nodes_y:
+ *		Number of nodes regarding second variable.
+ *
+ *	double *f:
+ *		Array containing values at nodes.
+ *	double *f_x:
+ *		Array containing partial derivatives wrt. first variable at nodes.
+ *	double *f_y:
+ *		Array containing partial derivatives wrt. second variable at nodes.
+ *	double *f_xy:
+ *		Array containing mixed partial derivatives at nodes.
+ *	char *valid:
+ *		Array indicating whether node is valid.
+ *
+ * Remarks:
+ * --------
+ *	Node (i_x, i_y) is stored at index i_x * no_nodes_y + i_y.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct Spline2D {
+	// Grid
+	//
+	double x_min;
+	double x_max;
+	double y_min;
+	double y_max;
+	double h_x;
+	double h_y;
+	int no_nodes_x;
+	int no_nodes_y;
+
+	// Values and derivatives at nodes
+	//
+	double *f;
+	double *f_x;
+	double *f_y;
+	double *f_xy;
+	char *valid;
+};
+
+
+/*
+ * WorkingPairTable:
+ * -----------------
+ *
+ * Contains spline tables of equilibrium functions of a working pair whose
+ * values and partial derivatives at the nodes are calculated by the original
+ * equations and their analytical derivatives. Loading w denotes equilibrium
+ * loading for adsorption, concentration for conventional absorption, and mole
+ * fraction in liquid phase for absorption based on mixing rules. Pressure and
+ * loading span several orders of magnitude. Thus, both are tabulated and used
+ * as variables by their logarithms, and the lower limit of loading must be
+ * positive.
+ *
+ * Attributes:
+ * -----------
+ *	double p_min_Pa:
+ *		Lower limit of pressure in Pa.
+ *	double p_max_Pa:
+ *		Upper limit of pressure in Pa.
+ *	double T_min_K:
+ *		Lower limit of temperature in K.
+ *	double T_max_K:
+ *		Upper limit of temperature in K.
+ *	double w_min:
+ *		Lower limit of loading.
+ *	double w_max:
+ *		Upper limit of loading.
+ *
+ *	Spline2D *w_pT:
+ *		Spline of loading depending on pressure and temperature.
+ *	Spline2D *p_wT:
+ *		Spline of pressure depending on loading and temperature.
+ *	Spline2D *T_pw:
+ *		Spline of temperature depending on pressure and loading.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct WorkingPairTable {
+	// Limits of tables
+	//
+	double p_min_Pa;
+	double p_max_Pa;
+	double T_min_K;
+	double T_max_K;
+	double w_min;
+	double w_max;
+
+	// Splines of equilibrium functions
+	//
+	struct Spline2D *w_pT;
+	struct Spline2D *p_wT;
+	struct Spline2D *T_pw;
+};
+
+
+/*
+ * RefrigerantHandle:
+ * ------------------
+ *
+ * Contains strings defining refrigerant and calculation approaches,
+ * coefficients for calculation approaches, and structure that contains
+ * function pointers for the refrigerant functions. In contrast to the
+ * WorkingPair-struct, no isotherm is required.
+ *
+ * Attributes:
+ * -----------
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * 	double *psat_par:
+ *		Array containing coefficients of vapor pressure equation.
+ * 	double *rhol_par:
+ *		Array containing coefficients of saturated liquid density equation.
+ *	int no_psat_par:
+ *		Number of coefficients of vapor pressure equation.
+ *	int no_rhol_par:
+ *		Number of coefficients of saturated liquid density equation.
+ *
+ *	Refrigerant *refrigerant:
+ *		Struct containing function pointers for refrigerant functions.
+ *	RefrigerantParameters *refrigerant_parameters:
+ *		Struct interned by database that owns coefficients of refrigerant
+ *		functions and Refrigerant-struct.
+ *
+ *	Surrogate *surrogate_p_sat:
+ *		Surrogate of vapor pressure depending on temperature (i.e., NULL if
+ *		surrogates are disabled).
+ *	Surrogate *surrogate_dp_sat_dT:
+ *		Surrogate of derivative of vapor pressure wrt. temperature depending on
+ *		temperature.
+ *	Surrogate *surrogate_rho_l:
+ *		Surrogate of saturated liquid density depending on temperature.
+ *	Surrogate *surrogate_T_sat:
+ *		Surrogate of saturation temperature depending on logarithm of pressure.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct RefrigerantHandle {
+	// General information of refrigerant
+	//
+	const char *wp_rf;
+	const char *rf_psat;
+	const char *rf_rhol;
+	int no_p_sat;
+	int no_rhol;
+
+	// Arrays containing coefficients of functions
+	//
+	double *psat_par;
+	double *rhol_par;
+	int no_psat_par;
+	int no_rhol_par;
+
+	// Struct containing function pointers of refrigerant functions and
+	// interned struct owning coefficients and function pointers
+	//
+	struct Refrigerant *refrigerant;
+	struct RefrigerantParameters *refrigerant_parameters;
+
+	// Surrogates of refrigerant functions
+	//
+	struct Surrogate *surrogate_p_sat;
+	struct Surrogate *surrogate_dp_sat_dT;
+	struct Surrogate *surrogate_rho_l;
+	struct Surrogate *surrogate_T_sat;
+};
+
+
+
+/*
+ * BatchRange:
+ * -----------
+ *
+ * Contains range of chunks that is owned by one thread of a BatchPool-struct.
+ * The owning thread takes chunks from the beginning of the range, while other
+ * threads steal the upper half of the range when their own range is empty.
+ *
+ * Attributes:
+ * -----------
+ *	long lock:
+ *		Spin lock that is 1 while a thread changes the range and 0 otherwise.
+ *	int begin:
+ *		First chunk of range.
+ *	int end:
+ *		Chunk after last chunk of range.
+ *	char padding[]:
+ *		Padding so that ranges of different threads do not share a cache
+ *		line.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct BatchRange {
+	long lock;
+	int begin;
+	int end;
+	char padding[64 - sizeof(long) - 2 * sizeof(int)];
+};
+
+
+/*
+ * BatchWorker:
+ * ------------
+ *
+ * Contains argument of a worker thread of a BatchPool-struct.
+ *
+ * Attributes:
+ * -----------
+ *	BatchPool *batchPool:
+ *		Pointer of BatchPool-struct owning worker thread.
+ *	int index:
+ *		Index of worker thread (i.e., index of its range of chunks).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct BatchWorker {
+	struct BatchPool *batchPool;
+	int index;
+};
+
+
+/*
+ * BatchPool:
+ * ----------
+ *
+ * Contains long-lived worker threads that evaluate batches of items in
+ * parallel. Items are divided into chunks of a given grain size and chunks are
+ * distributed among threads by work stealing. Thus, threads whose chunks are
+ * evaluated fast (e.g., states that converge quickly) take over chunks of
+ * other threads.
+ *
+ * Attributes:
+ * -----------
+ *	int no_threads:
+ *		Number of threads including the thread calling the pool.
+ *	THREAD *threads:
+ *		Array containing worker threads (i.e., no_threads - 1 threads).
+ *	BatchWorker *workers:
+ *		Array containing arguments of worker threads.
+ *	BatchRange *ranges:
+ *		Cache-line aligned array containing ranges of chunks of all threads.
+ *
+ *	MUTEX mutex:
+ *		Mutex protecting generation, number of running threads, and shutdown
+ *		flag.
+ *	MUTEX mutex_run:
+ *		Mutex ensuring that only one batch is evaluated at a time.
+ *	CONDITION condition_start:
+ *		Condition variable signaling new batch or shutdown to worker threads.
+ *	CONDITION condition_finished:
+ *		Condition variable signaling that all worker threads are finished.
+ *	unsigned long generation:
+ *		Number of batches started.
+ *	int no_running:
+ *		Number of worker threads that still evaluate current batch.
+ *	int shutdown:
+ *		Flag indicating whether worker threads shall terminate.
+ *
+ *	function kernel:
+ *		Function evaluating items from first item to item after last item
+ *		with pointer to context of current batch.
+ *	void *context:
+ *		Pointer to context of current batch.
+ *	int no_items:
+ *		Number of items of current batch.
+ *	int grain_size:
+ *		Number of items per chunk of current batch.
+ *
+ * Remarks:
+ * --------
+ *	Each item is evaluated exactly once and by exactly one thread. Hence, if
+ *	results of each item are written to their own memory, results do not
+ *	depend on the number of threads or the order of evaluation.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct BatchPool {
+	// Threads and their ranges of chunks
+	//
+	int no_threads;
+	THREAD *threads;
+	struct BatchWorker *workers;
+	struct BatchRange *ranges;
+
+	// Synchronization of threads
+	//
+	MUTEX mutex;
+	MUTEX mutex_run;
+	CONDITION condition_start;
+	CONDITION condition_finished;
+	unsigned long generation;
+	int no_running;
+	int shutdown;
+
+	// Current batch
+	//
+	genBatchFunc kernel;
+	void *context;
+	int no_items;
+	int grain_size;
+};
+
+
+
+/*
+ * BatchFunction:
+ * --------------
+ *
+ * Contains name and function pointer of a function of the WorkingPair-struct
+ * that can be evaluated for arrays of states.
+ *
+ * Attributes:
+ * -----------
+ *	const char *name:
+ *		Name of function (e.g., "ads_w_pT").
+ *	function function:
+ *		Pointer to function that is cast to its actual type before call.
+ *	int no_inputs:
+ *		Number of inputs of type double.
+ *	int vapor:
+ *		Flag indicating whether function returns mole fractions of both
+ *		components in vapor phase by its first two inputs (i.e., mixing
+ *		rules).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct BatchFunction {
+	const char *name;
+	genFunc function;
+	int no_inputs;
+	int vapor;
+};
+
+
+/*
+ * BatchEvaluation:
+ * ----------------
+ *
+ * Contains inputs and outputs of an evaluation of a function of the
+ * WorkingPair-struct for arrays of states.
+ *
+ * Attributes:
+ * -----------
+ *	const BatchFunction *function:
+ *		Function that is evaluated.
+ *	double *ret_values:
+ *		Array to be filled with values of function.
+ *	double *ret_y_1_molmol:
+ *		Array to be filled with mole fractions of first component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	double *ret_y_2_molmol:
+ *		Array to be filled with mole fractions of second component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	int *ret_status:
+ *		Array to be filled with status codes of states (i.e., may be NULL).
+ *	const double **inputs:
+ *		Array containing arrays of inputs in order of inputs of function.
+ *	void *workingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct BatchEvaluation {
+	const struct BatchFunction *function;
+	double *ret_values;
+	double *ret_y_1_molmol;
+	double *ret_y_2_molmol;
+	int *ret_status;
+	const double **inputs;
+	void *workingPair;
+};
+
+
+/*
+ * ScreeningCandidate:
+ * -------------------
+ *
+ * Contains names and ID of an isotherm equation of a working pair found in the
+ * database. Candidates are sorted by isotherm type before working pairs are
+ * created.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_as:
+ *		Name of sorbent.
+ *	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ *	const char *wp_rf:
+ *		Name of refrigerant.
+ *	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm.
+ *	int index:
+ *		Position of candidate in database (i.e., keeps order of database within
+ *		one isotherm type).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct ScreeningCandidate {
+	const char *wp_as;
+	const char *wp_st;
+	const char *wp_rf;
+	const char *wp_iso;
+	int no_iso;
+	int index;
+};
+
+/*
+ * Screening:
+ * ----------
+ *
+ * Contains all working pairs of a database that use a given refrigerant. Each
+ * isotherm equation and each ID of a working pair is a separate
+ * WorkingPair-struct. Working pairs are grouped by isotherm type, so threads
+ * evaluating neighboring working pairs call the same isotherm functions.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_rf:
+ *		Name of refrigerant used as filter (i.e., NULL or "" for all
+ *		refrigerants).
+ *	int no_workingPairs:
+ *		Number of working pairs.
+ *	WorkingPair **workingPairs:
+ *		Array containing pointers of WorkingPair-structs grouped by isotherm
+ *		type.
+ *
+ * Remarks:
+ * --------
+ *	Working pairs share interned refrigerants and names with the database.
+ *	Thus, the database must not be deleted before the Screening-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct Screening {
+	const char *wp_rf;
+	int no_workingPairs;
+	struct WorkingPair **workingPairs;
+};
+
+/*
+ * ScreeningEvaluation:
+ * --------------------
+ *
+ * Contains inputs and outputs of an evaluation of a function for all working
+ * pairs of a Screening-struct. Results are stored as dense matrix with one row
+ * per working pair and one column per state.
+ *
+ * Attributes:
+ * -----------
+ *	const BatchFunction *function:
+ *		Function that is evaluated.
+ *	double *ret_values:
+ *		Matrix to be filled with values of function.
+ *	double *ret_y_1_molmol:
+ *		Matrix to be filled with mole fractions of first component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	double *ret_y_2_molmol:
+ *		Matrix to be filled with mole fractions of second component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	int *ret_status:
+ *		Matrix to be filled with status codes (i.e., may be NULL).
+ *	const double **inputs:
+ *		Array containing arrays of inputs in order of inputs of function.
+ *	int no_points:
+ *		Number of states (i.e., number of columns).
+ *	const int *supported:
+ *		Array containing flags indicating whether working pairs support
+ *		function.
+ *	WorkingPair **workingPairs:
+ *		Array containing pointers of WorkingPair-structs.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct ScreeningEvaluation {
+	const struct BatchFunction *function;
+	double *ret_values;
+	double *ret_y_1_molmol;
+	double *ret_y_2_molmol;
+	int *ret_status;
+	const double **inputs;
+	int no_points;
+	const int *supported;
+	struct WorkingPair **workingPairs;
+};
+
+
+/*
+ * Status:
+ * -------
+ *
+ * Contains last failure of a thread. Each thread owns one status record and,
+ * thus, the record can be read after a function call without locks.
+ *
+ * Attributes:
+ * -----------
+ *	int code:
+ *		Code of last failure (i.e., STATUS_OK if no failure occurred).
+ *	const char *function:
+ *		Name of function that failed (i.e., NULL if no failure occurred).
+ *	int iterations:
+ *		Number of iterations of failed iterative method (i.e., 0 for
+ *		non-iterative functions).
+ *	double residual:
+ *		Last residual of failed iterative method (e.g., difference between
+ *		calculated and given pressure) or value that is out of range.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct Status {
+	int code;
+	const char *function;
+	int iterations;
+	double residual;
+};
+
+
+/*
+ * StatisticsFunction:
+ * -------------------
+ *
+ * Contains statistics of calls of a function.
+ *
+ * Attributes:
+ * -----------
+ *	const char *name:
+ *		Name of function.
+ *	unsigned long long no_calls:
+ *		Number of calls.
+ *	unsigned long long time_ns:
+ *		Cumulative time of all calls in ns.
+ *	unsigned long long bins[]:
+ *		Latency histogram with logarithmic bins (see STATISTICS_NO_BINS_TIME).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct StatisticsFunction {
+	const char *name;
+	unsigned long long no_calls;
+	unsigned long long time_ns;
+	unsigned long long bins[STATISTICS_NO_BINS_TIME];
+};
+
+/*
+ * StatisticsSolver:
+ * -----------------
+ *
+ * Contains statistics of calls of an iterative solver.
+ *
+ * Attributes:
+ * -----------
+ *	const char *name:
+ *		Name of solver.
+ *	unsigned long long no_calls:
+ *		Number of calls.
+ *	unsigned long long no_failures:
+ *		Number of calls that did not converge.
+ *	unsigned long long iterations:
+ *		Cumulative number of iterations of all calls.
+ *	unsigned long long bins[]:
+ *		Iteration histogram with logarithmic bins (see
+ *		STATISTICS_NO_BINS_ITERATIONS).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct StatisticsSolver {
+	const char *name;
+	unsigned long long no_calls;
+	unsigned long long no_failures;
+	unsigned long long iterations;
+	unsigned long long bins[STATISTICS_NO_BINS_ITERATIONS];
+};
+
+/*
+ * Statistics:
+ * -----------
+ *
+ * Contains snapshot of statistics of all instrumented functions and solvers.
+ *
+ * Attributes:
+ * -----------
+ *	int enabled:
+ *		Flag indicating whether instrumentation is compiled (i.e., whether
+ *		SORP_STATS was defined).
+ *	StatisticsFunction functions[]:
+ *		Statistics of functions of the WorkingPair-struct.
+ *	StatisticsSolver solvers[]:
+ *		Statistics of iterative solvers.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct Statistics {
+	int enabled;
+	struct StatisticsFunction functions[STATISTICS_NO_FUNCTIONS];
+	struct StatisticsSolver solvers[STATISTICS_NO_SOLVERS];
+};
+
+/*
+ * TraceCall:
+ * ----------
+ *
+ * Contains inputs of a call that is in progress. Struct is a local variable of
+ * each recorded function and, thus, calls of several threads do not interfere.
+ *
+ * Attributes:
+ * -----------
+ *	int function:
+ *		Index of function (i.e., STATISTICS_FUNCTION_*) or -1 if call is not
+ *		recorded.
+ *	int pair:
+ *		Index of working pair in trace.
+ *	int no_arguments:
+ *		Number of inputs.
+ *	int iterations:
+ *		Iterations of calling thread at beginning of call.
+ *	unsigned long long start_ns:
+ *		Time at beginning of call in ns.
+ *	double arguments[]:
+ *		Inputs of call.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct TraceCall {
+	int function;
+	int pair;
+	int no_arguments;
+	int iterations;
+	unsigned long long start_ns;
+	double arguments[TRACE_NO_ARGUMENTS];
+};
+
+/*
+ * TracePair:
+ * ----------
+ *
+ * Contains names and numbers of equations identifying a working pair of a
+ * trace. Thus, the working pair can be created again when replaying a trace.
+ *
+ * Attributes:
+ * -----------
+ *	char wp_as[]:
+ *		Name of sorbent.
+ *	char wp_st[]:
+ *		Name of sub-type of sorbent.
+ *	char wp_rf[]:
+ *		Name of refrigerant.
+ *	char wp_iso[]:
+ *		Name of isotherm.
+ *	char rf_psat[]:
+ *		Name of calculation approach for vapor pressure.
+ *	char rf_rhol[]:
+ *		Name of calculation approach for liquid density.
+ *	int no_iso:
+ *		ID of isotherm.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation.
+ *	int no_rhol:
+ *		ID of liquid density equation.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct TracePair {
+	char wp_as[TRACE_LENGTH_NAME];
+	char wp_st[TRACE_LENGTH_NAME];
+	char wp_rf[TRACE_LENGTH_NAME];
+	char wp_iso[TRACE_LENGTH_NAME];
+	char rf_psat[TRACE_LENGTH_NAME];
+	char rf_rhol[TRACE_LENGTH_NAME];
+	int no_iso;
+	int no_p_sat;
+	int no_rhol;
+};
+
+/*
+ * TraceRecord:
+ * ------------
+ *
+ * Contains a recorded call. Records have a fixed size of 88 bytes and are
+ * written to trace files without conversion (i.e., in native byte order).
+ *
+ * Attributes:
+ * -----------
+ *	unsigned short function:
+ *		Index of function in table of function names of trace.
+ *	unsigned short pair:
+ *		Index of working pair in table of working pairs of trace.
+ *	unsigned short no_arguments:
+ *		Number of inputs.
+ *	unsigned short iterations:
+ *		Number of iterations of solvers required by call (i.e., limited to
+ *		65535).
+ *	unsigned int thread:
+ *		Identifier of thread that executed call.
+ *	unsigned int time_ns:
+ *		Duration of call in ns (i.e., limited to about 4.3 s).
+ *	double arguments[]:
+ *		Inputs of call.
+ *	double result:
+ *		Result of call.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct TraceRecord {
+	unsigned short function;
+	unsigned short pair;
+	unsigned short no_arguments;
+	unsigned short iterations;
+	unsigned int thread;
+	unsigned int time_ns;
+	double arguments[TRACE_NO_ARGUMENTS];
+	double result;
+};
+
+/*
+ * TraceFile:
+ * ----------
+ *
+ * Contains content of a trace file.
+ *
+ * Attributes:
+ * -----------
+ *	int no_functions:
+ *		Number of function names.
+ *	int no_pairs:
+ *		Number of working pairs.
+ *	unsigned long long no_records:
+ *		Number of recorded calls.
+ *	unsigned long long no_calls:
+ *		Number of calls during recording (i.e., greater than no_records if
+ *		ring buffer overflowed).
+ *	char (*functions)[]:
+ *		Malloc-ed array containing names of functions.
+ *	TracePair *pairs:
+ *		Malloc-ed array containing working pairs.
+ *	TraceRecord *records:
+ *		Malloc-ed array containing recorded calls in chronological order.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct TraceFile {
+	int no_functions;
+	int no_pairs;
+	unsigned long long no_records;
+	unsigned long long no_calls;
+	char (*functions)[TRACE_LENGTH_NAME];
+	struct TracePair *pairs;
+	struct TraceRecord *records;
+};
+
+
+/*
+ * DirectWorkingPair:
+ * ------------------
+ *
+ * Contains a working pair cached for functions working without WorkingPair-
+ * struct (i.e., direct_*-functions) and the arguments identifying it. Cached
+ * working pairs form a singly linked list.
+ *
+ * Attributes:
+ * -----------
+ *	char *names:
+ *		Malloc-ed memory block containing copies of all names.
+ *	char *path_db:
+ *		Copy of path to database.
+ * 	char *wp_as:
+ *		Copy of name of sorbent.
+ * 	char *wp_st:
+ *		Copy of name of sub-type of sorbent.
+ * 	char *wp_rf:
+ *		Copy of name of refrigerant.
+ * 	char *wp_iso:
+ *		Copy of name of isotherm.
+ * 	char *rf_psat:
+ *		Copy of name of calculation approach for vapor pressure.
+ * 	char *rf_rhol:
+ *		Copy of name of calculation approach for liquid density.
+ *	int no_iso:
+ *		ID of isotherm.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation.
+ *	int no_rhol:
+ *		ID of liquid density equation.
+ *	WorkingPair *workingPair:
+ *		Cached working pair referring to copies of names.
+ *	DirectWorkingPair *next:
+ *		Next cached working pair or NULL.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct DirectWorkingPair {
+	// Copies of arguments identifying working pair
+	//
+	char *names;
+	char *path_db;
+	char *wp_as;
+	char *wp_st;
+	char *wp_rf;
+	char *wp_iso;
+	char *rf_psat;
+	char *rf_rhol;
+	int no_iso;
+	int no_p_sat;
+	int no_rhol;
+
+	// Cached working pair and next entry of list
+	//
+	struct WorkingPair *workingPair;
+	struct DirectWorkingPair *next;
+};
+
+
+/*
+ * ServerRequest:
+ * --------------
+ *
+ * Contains header of request sent by client to property server. The header
+ * is followed by the payload of the request.
+ *
+ * Attributes:
+ * -----------
+ *	int type:
+ *		Type of request (e.g., SERVER_EVALUATE).
+ *	int handle:
+ *		Handle of working pair (i.e., 0 if request has no working pair).
+ *	int no_inputs:
+ *		Number of arrays of inputs.
+ *	int no_points:
+ *		Number of states.
+ *	int length_payload:
+ *		Length of payload in bytes.
+ *	char function[]:
+ *		Name of function that is evaluated (e.g., "ads_w_pT").
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct ServerRequest {
+	int type;
+	int handle;
+	int no_inputs;
+	int no_points;
+	int length_payload;
+	char function[SERVER_LENGTH_FUNCTION];
+};
+
+
+/*
+ * ServerResponse:
+ * ---------------
+ *
+ * Contains header of response sent by property server to client. The header
+ * is followed by the payload of the response.
+ *
+ * Attributes:
+ * -----------
+ *	int status:
+ *		Status code of request (e.g., STATUS_OK or STATUS_INVALID_INPUT).
+ *	int handle:
+ *		Handle of working pair.
+ *	int no_points:
+ *		Number of states.
+ *	int no_outputs:
+ *		Number of arrays of values.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct ServerResponse {
+	int status;
+	int handle;
+	int no_points;
+	int no_outputs;
+};
+
+
+/*
+ * ServerEntry:
+ * ------------
+ *
+ * Contains a hot working pair of property server and the arguments
+ * identifying it. Handle of working pair is its index plus 1.
+ *
+ * Attributes:
+ * -----------
+ *	char *names:
+ *		Malloc-ed memory block containing copies of all names.
+ *	char *names_end:
+ *		End of memory block containing copies of all names.
+ *	int no_iso:
+ *		ID of isotherm.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation.
+ *	int no_rhol:
+ *		ID of liquid density equation.
+ *	int no_references:
+ *		Number of handles given to clients that are not released yet.
+ *	WorkingPair *workingPair:
+ *		Hot working pair.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct ServerEntry {
+	char *names;
+	char *names_end;
+	int no_iso;
+	int no_p_sat;
+	int no_rhol;
+	int no_references;
+	struct WorkingPair *workingPair;
+};
+
+
+/*
+ * PropertyServer:
+ * ---------------
+ *
+ * Contains socket, clients, databases, hot working pairs, and thread pool of
+ * property server.
+ *
+ * Attributes:
+ * -----------
+ *	int socket:
+ *		Listening Unix domain socket.
+ *	char *path_socket:
+ *		Malloc-ed copy of path of socket.
+ *	int clients[]:
+ *		Sockets of connected clients (i.e., -1 if unused).
+ *	Database **databases:
+ *		Array containing databases that are opened once per path.
+ *	int no_databases:
+ *		Number of databases.
+ *	ServerEntry *entries:
+ *		Array containing hot working pairs.
+ *	int no_entries:
+ *		Number of hot working pairs.
+ *	BatchPool *batchPool:
+ *		Thread pool evaluating batched requests.
+ *	char *buffer:
+ *		Malloc-ed buffer of payloads of requests and responses.
+ *	size_t size_buffer:
+ *		Size of buffer in bytes.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct PropertyServer {
+	// Sockets
+	//
+	int socket;
+	char *path_socket;
+	int clients[SERVER_MAX_CLIENTS];
+
+	// Databases and hot working pairs
+	//
+	struct Database **databases;
+	int no_databases;
+	struct ServerEntry *entries;
+	int no_entries;
+
+	// Evaluation of batched requests
+	//
+	struct BatchPool *batchPool;
+	char *buffer;
+	size_t size_buffer;
+};
+
+
+/*
+ * ServerWorkingPair:
+ * ------------------
+ *
+ * Contains handle of a working pair of property server used by clients.
+ *
+ * Attributes:
+ * -----------
+ *	int handle:
+ *		Handle of working pair given by property server.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct ServerWorkingPair {
+	int handle;
+};
+
+
+/*
+ * StreamEvaluation:
+ * -----------------
+ *
+ * Contains options of streaming evaluation of a function of the
+ * WorkingPair-struct for rows of a CSV file or records of a binary file.
+ *
+ * Attributes:
+ * -----------
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT" or "abs_mix_x_pT").
+ *	const int *columns:
+ *		Array containing columns of CSV file or fields of binary record that
+ *		are used as inputs, in order of inputs of function and counted from 0.
+ *	int no_fields:
+ *		Number of doubles per binary record.
+ *	int binary_input:
+ *		Flag indicating whether inputs are binary records (i.e., 1) or CSV
+ *		rows (i.e., 0).
+ *	int binary_output:
+ *		Flag indicating whether outputs are binary records (i.e., 1) or CSV
+ *		rows (i.e., 0).
+ *	int write_status:
+ *		Flag indicating whether status code of each row is written.
+ *	int no_header:
+ *		Number of lines of CSV file that are skipped.
+ *	char delimiter:
+ *		Delimiter of CSV fields.
+ *	int block_size:
+ *		Number of rows evaluated by one batch.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct StreamEvaluation {
+	// Function and inputs
+	//
+	const char *function;
+	const int *columns;
+	int no_fields;
+
+	// Formats
+	//
+	int binary_input;
+	int binary_output;
+	int write_status;
+	int no_header;
+	char delimiter;
+
+	// Blocks
+	//
+	int block_size;
+};
+
+
+/*
+ * ChartEvaluation:
+ * ----------------
+ *
+ * Contains inputs and outputs of the generation of a chart of a working pair.
+ * Results are stored as dense matrices with one row per curve and one column
+ * per point.
+ *
+ * Attributes:
+ * -----------
+ *	int chart:
+ *		Type of chart (e.g., CHART_ISOTHERMS).
+ *	const BatchFunction *function:
+ *		Function that is evaluated.
+ *	double *ret_values:
+ *		Matrix to be filled with values of function.
+ *	double *ret_T_sat_K:
+ *		Matrix to be filled with vapor temperatures of equilibrium pressures
+ *		(i.e., only for CHART_DUEHRING and may be NULL otherwise).
+ *	unsigned char *ret_valid:
+ *		Matrix to be filled with flags indicating valid entries.
+ *	const double *p_sat_Pa:
+ *		Array containing vapor pressures of curves (i.e., for CHART_ISOTHERMS)
+ *		or of points (i.e., otherwise).
+ *	double p_limit_Pa:
+ *		Highest finite vapor pressure that limits pressures if vapor pressure
+ *		is not defined (e.g., above critical temperature).
+ *	const double *curves:
+ *		Array containing inputs that are constant along each curve.
+ *	const double *points:
+ *		Array containing inputs that vary along each curve.
+ *	int no_points:
+ *		Number of points per curve (i.e., number of columns).
+ *	void *workingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct ChartEvaluation {
+	// Chart and function
+	//
+	int chart;
+	const struct BatchFunction *function;
+
+	// Outputs
+	//
+	double *ret_values;
+	double *ret_T_sat_K;
+	unsigned char *ret_valid;
+
+	// Saturation
+	//
+	const double *p_sat_Pa;
+	double p_limit_Pa;
+
+	// Inputs
+	//
+	const double *curves;
+	const double *points;
+	int no_points;
+	void *workingPair;
+};
+
+/*
+ * VerificationRule:
+ * -----------------
+ *
+ * Describes how one type of experimental data is compared with a working pair:
+ * Function is evaluated with inputs taken from data sets or constant inputs,
+ * and result is compared with measured data set.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_tp:
+ *		Type of working pair (i.e., "ads" or "abs").
+ *	const char *type:
+ *		Type of experimental data (e.g., "isotherms").
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT").
+ *	const char *measured:
+ *		Name of data set compared with values of function (e.g., "loadings").
+ *	const char *inputs[VERIFICATION_NO_INPUTS]:
+ *		Names of data sets used as inputs in order of inputs of function. If
+ *		name is NULL, constant input is used.
+ *	double constants[VERIFICATION_NO_INPUTS]:
+ *		Constant inputs (e.g., -1 to use molar volumes of database).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct VerificationRule {
+	// Type of working pair and of experimental data
+	//
+	const char *wp_tp;
+	const char *type;
+
+	// Function and its inputs
+	//
+	const char *function;
+	const char *measured;
+	const char *inputs[VERIFICATION_NO_INPUTS];
+	double constants[VERIFICATION_NO_INPUTS];
+};
+
+/*
+ * VerificationEntry:
+ * ------------------
+ *
+ * Contains one block of experimental data of the database, the isotherm
+ * equation and ID it is compared with, and the statistics of the comparison.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_as:
+ *		Name of sorbent.
+ *	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ *	const char *wp_rf:
+ *		Name of refrigerant.
+ *	const char *wp_tp:
+ *		Type of working pair (i.e., "ads" or "abs").
+ *	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm.
+ *	const char *literature:
+ *		Literature of isotherm equation and experimental data.
+ *	const char *type:
+ *		Type of experimental data (e.g., "isotherms").
+ *	cJSON *data:
+ *		Pointer of cJSON-struct containing data sets.
+ *	const VerificationRule *rule:
+ *		Rule used for comparison (i.e., NULL if data cannot be compared).
+ *	WorkingPair *workingPair:
+ *		Pointer of WorkingPair-struct (i.e., NULL if working pair cannot be
+ *		created).
+ *	int first_point:
+ *		Index of first point of entry.
+ *	int no_points:
+ *		Number of points of entry.
+ *	int status:
+ *		Status code of entry (e.g., STATUS_NOT_IMPLEMENTED if data cannot be
+ *		compared).
+ *	int no_valid:
+ *		Number of points that are evaluated without failure.
+ *	double rmse:
+ *		Root-mean-square error of valid points.
+ *	double aard:
+ *		Average absolute relative deviation of valid points.
+ *	double max_error:
+ *		Maximal absolute error of valid points.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct VerificationEntry {
+	// Working pair and isotherm
+	//
+	const char *wp_as;
+	const char *wp_st;
+	const char *wp_rf;
+	const char *wp_tp;
+	const char *wp_iso;
+	int no_iso;
+
+	// Experimental data
+	//
+	const char *literature;
+	const char *type;
+	struct cJSON *data;
+
+	// Comparison
+	//
+	const struct VerificationRule *rule;
+	struct WorkingPair *workingPair;
+	int first_point;
+	int no_points;
+
+	// Statistics
+	//
+	int status;
+	int no_valid;
+	double rmse;
+	double aard;
+	double max_error;
+};
+
+/*
+ * Verification:
+ * -------------
+ *
+ * Contains all blocks of experimental data of a database that can be assigned
+ * to an isotherm equation and the points of all blocks. Points are stored in
+ * flat arrays, so all points of all entries are evaluated by one call of a
+ * BatchPool-struct.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_rf:
+ *		Name of refrigerant used as filter (i.e., NULL or "" for all
+ *		refrigerants).
+ *	int no_entries:
+ *		Number of entries.
+ *	VerificationEntry *entries:
+ *		Array containing entries.
+ *	int no_points:
+ *		Number of points of all entries.
+ *	double *inputs[VERIFICATION_NO_INPUTS]:
+ *		Arrays containing inputs of all points.
+ *	double *measured:
+ *		Array containing measured values of all points.
+ *	double *values:
+ *		Array containing calculated values of all points.
+ *	int *status:
+ *		Array containing status codes of all points.
+ *	int *point_entries:
+ *		Array containing index of entry of each point.
+ *
+ * Remarks:
+ * --------
+ *	Entries share names and data with the database. Thus, the database must
+ *	not be deleted before the Verification-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct Verification {
+	// Filter and entries
+	//
+	const char *wp_rf;
+	int no_entries;
+	struct VerificationEntry *entries;
+
+	// Points of all entries
+	//
+	int no_points;
+	double *inputs[VERIFICATION_NO_INPUTS];
+	double *measured;
+	double *values;
+	int *status;
+	int *point_entries;
+};
+
+/*
+ * FitModel:
+ * ---------
+ *
+ * Describes an isotherm equation whose coefficients can be fitted: Names of
+ * coefficients in order of the database, measured value calculated by the
+ * isotherm equation, and function calculating this value and its derivatives
+ * with respect to the coefficients.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_iso:
+ *		Name of isotherm equation (e.g., "Toth").
+ *	const char *wp_tp:
+ *		Type of working pair (i.e., "ads" or "abs").
+ *	const char *measured:
+ *		Name of data set compared with values of function (i.e., "loadings"
+ *		or "pressures").
+ *	int refrigerant:
+ *		Number of refrigerant functions required by function (i.e., 0: none,
+ *		1: saturation pressure, 2: saturation pressure and saturated liquid
+ *		density).
+ *	int no_par:
+ *		Number of coefficients.
+ *	const char *names[FIT_MAX_NO_COEFFICIENTS]:
+ *		Names of coefficients in order of coefficients (i.e., keys of "_p_" in
+ *		the database).
+ *	double (*function)(double[], double, double, double, double, double,
+ *	double[]):
+ *		Function calculating measured value and its derivatives wrt.
+ *		coefficients depending on pressure in Pa, temperature in K, loading
+ *		(i.e., in kg/kg or mol/mol), saturation pressure in Pa, saturated
+ *		liquid density in kg/m3, and coefficients.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct FitModel {
+	// Names of isotherm equation and coefficients
+	//
+	const char *wp_iso;
+	const char *wp_tp;
+	const char *measured;
+	int refrigerant;
+	int no_par;
+	const char *names[FIT_MAX_NO_COEFFICIENTS];
+
+	// Function calculating measured value and its derivatives wrt.
+	// coefficients
+	//
+	double (*function)(double[], double, double, double, double, double,
+		double[]);
+};
+
+/*
+ * Fit:
+ * ----
+ *
+ * Contains points of experimental data and coefficients of an isotherm
+ * equation fitted to these points by a Levenberg-Marquardt algorithm with
+ * bounds. Points are stored in flat arrays, so residuals and derivatives of
+ * all points are evaluated by one call of a BatchPool-struct.
+ *
+ * Attributes:
+ * -----------
+ *	const FitModel *model:
+ *		Isotherm equation whose coefficients are fitted.
+ *	int no_points:
+ *		Number of points.
+ *	double *inputs[FIT_NO_INPUTS]:
+ *		Arrays containing pressure in Pa, temperature in K, loading,
+ *		saturation pressure in Pa, and saturated liquid density in kg/m3 of all
+ *		points.
+ *	double *measured:
+ *		Array containing measured values of all points (i.e., pointer of
+ *		array of inputs).
+ *	double *weights:
+ *		Array containing weights of residuals of all points.
+ *	int *valid:
+ *		Array containing flags indicating if points are valid.
+ *	double *values:
+ *		Array containing calculated values of all points.
+ *	double *jacobian:
+ *		Array containing derivatives of weighted residuals wrt. coefficients
+ *		of all points (i.e., row-major with one row per point).
+ *	double *trial_values:
+ *		Array containing calculated values of trial coefficients.
+ *	double *trial_jacobian:
+ *		Array containing derivatives of trial coefficients.
+ *	double trial_par[FIT_MAX_NO_COEFFICIENTS]:
+ *		Trial coefficients evaluated by threads.
+ *	double par[FIT_MAX_NO_COEFFICIENTS]:
+ *		Fitted coefficients.
+ *	double covariance[FIT_MAX_NO_COEFFICIENTS * FIT_MAX_NO_COEFFICIENTS]:
+ *		Covariance matrix of fitted coefficients (i.e., row-major).
+ *	int status:
+ *		Status code of fit (e.g., STATUS_NO_CONVERGENCE if maximal number of
+ *		iterations is reached).
+ *	int no_iterations:
+ *		Number of iterations (i.e., evaluations of trial coefficients).
+ *	int no_valid:
+ *		Number of valid points.
+ *	double rmse:
+ *		Root-mean-square error of valid points.
+ *	double are:
+ *		Average absolute relative deviation of valid points.
+ *	double max_error:
+ *		Maximal absolute error of valid points.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+struct Fit {
+	// Isotherm equation
+	//
+	const struct FitModel *model;
+
+	// Points
+	//
+	int no_points;
+	double *inputs[FIT_NO_INPUTS];
+	double *measured;
+	double *weights;
+	int *valid;
+
+	// Values and derivatives of accepted and trial coefficients
+	//
+	double *values;
+	double *jacobian;
+	double *trial_values;
+	double *trial_jacobian;
+	double trial_par[FIT_MAX_NO_COEFFICIENTS];
+
+	// Results
+	//
+	double par[FIT_MAX_NO_COEFFICIENTS];
+	double covariance[FIT_MAX_NO_COEFFICIENTS * FIT_MAX_NO_COEFFICIENTS];
+	int status;
+	int no_iterations;
+	int no_valid;
+	double rmse;
+	double are;
+	double max_error;
 };
 
 #endif
@@ -0,0 +1,1055 @@
+/////////////////
+// surrogate.c //
+/////////////////
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "surrogate.h"
+#include "dispatch.h"
+#include "status.h"
+#include "structDefinitions.c"
+
+
+/////////////////////////////
+// Definition of constants //
+/////////////////////////////
+#ifndef SURROGATE_DEGREE
+#define SURROGATE_DEGREE 6
+#endif
+
+#ifndef SURROGATE_NO_CHECKS
+#define SURROGATE_NO_CHECKS 16
+#endif
+
+#ifndef SURROGATE_NO_INTERVALS_MIN
+#define SURROGATE_NO_INTERVALS_MIN 8
+#endif
+
+#ifndef SURROGATE_NO_INTERVALS_MAX
+#define SURROGATE_NO_INTERVALS_MAX 1024
+#endif
+
+#ifndef SURROGATE_2D_DEGREE
+#define SURROGATE_2D_DEGREE 6
+#endif
+
+#ifndef SURROGATE_2D_NO_CHECKS
+#define SURROGATE_2D_NO_CHECKS 6
+#endif
+
+#ifndef SURROGATE_2D_NO_INTERVALS_MIN
+#define SURROGATE_2D_NO_INTERVALS_MIN 2
+#endif
+
+#ifndef SURROGATE_2D_NO_INTERVALS_MAX
+#define SURROGATE_2D_NO_INTERVALS_MAX 64
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+
+///////////////////////////
+// Definition of structs //
+///////////////////////////
+/*
+ * Surrogate:
+ * ----------
+ *
+ * Contains piecewise Chebyshev polynomials approximating a function of one
+ * variable on equidistant intervals. Intervals whose approximation does not
+ * meet the required accuracy are marked and evaluated by the original
+ * function.
+ *
+ * Attributes:
+ * -----------
+ * 	function function:
+ *		Original function that is approximated depending on variable x and
+ *		pointer to data.
+ *	void *data:
+ *		Pointer to data that is passed to original function.
+ *
+ *	double x_min:
+ *		Lower limit of variable.
+ *	double x_max:
+ *		Upper limit of variable.
+ *	double inv_h:
+ *		Inverse of width of intervals.
+ *	int no_intervals:
+ *		Number of intervals.
+ *
+ *	double *coefficients:
+ *		Array containing Chebyshev coefficients of all intervals.
+ *	char *exact:
+ *		Array indicating whether interval is evaluated by original function.
+ *	double max_error:
+ *		Maximal relative error of approximation at check points.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/*
+ * Surrogate2D:
+ * ------------
+ *
+ * Contains piecewise tensor-product Chebyshev polynomials approximating a
+ * function of two variables on equidistant cells. Cells whose approximation
+ * does not meet the required accuracy are marked and evaluated by the original
+ * function.
+ *
+ * Attributes:
+ * -----------
+ * 	function function:
+ *		Original function that is approximated depending on variables x and y
+ *		and pointer to data.
+ *	void *data:
+ *		Pointer to data that is passed to original function.
+ *	int log_output:
+ *		Flag indicating whether logarithm of function is approximated.
+ *
+ *	double x_min:
+ *		Lower limit of first variable.
+ *	double x_max:
+ *		Upper limit of first variable.
+ *	double y_min:
+ *		Lower limit of second variable.
+ *	double y_max:
+ *		Upper limit of second variable.
+ *	double inv_h_x:
+ *		Inverse of width of cells regarding first variable.
+ *	double inv_h_y:
+ *		Inverse of width of cells regarding second variable.
+ *	int no_intervals:
+ *		Number of intervals per variable.
+ *
+ *	double *coefficients:
+ *		Array containing Chebyshev coefficients of all cells.
+ *	char *exact:
+ *		Array indicating whether cell is evaluated by original function.
+ *	double max_error:
+ *		Maximal relative error of approximation at check points.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * newSurrogate:
+ * -------------
+ *
+ * Initialization function to create a new Surrogate-struct. Therefore,
+ * function approximates the original function by Chebyshev polynomials of
+ * degree SURROGATE_DEGREE on equidistant intervals. The number of intervals is
+ * doubled until the relative error at SURROGATE_NO_CHECKS + 1 check points per
+ * interval is smaller than the required error or SURROGATE_NO_INTERVALS_MAX is
+ * reached. Refinement also stops if the fraction of inaccurate intervals does
+ * not decrease for two refinements (e.g., for functions with numerical noise).
+ * Then, intervals that still do not meet the required error (e.g., close to
+ * singularities at the critical point) are evaluated by the original function.
+ * If limits are invalid or memory allocation fails, functions returns NULL and
+ * prints a warning.
+ *
+ * Parameters:
+ * -----------
+ *	function function:
+ *		Original function depending on variable x and pointer to data.
+ *	void *data:
+ *		Pointer to data that is passed to original function.
+ *	double x_min:
+ *		Lower limit of variable.
+ *	double x_max:
+ *		Upper limit of variable.
+ *	double max_rel_error:
+ *		Maximal relative error of approximation.
+ *
+ * Returns:
+ * --------
+ *	struct *Surrogate:
+ *		Returns malloc-ed Surrogate-struct.
+ *
+ * Remarks:
+ * --------
+ *	Accuracy is checked at the Chebyshev nodes and at equidistant check points
+ *	of each interval. Data must stay valid as long as the surrogate is used.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+Surrogate *newSurrogate(double (*function)(double, void*), void *data,
+	double x_min, double x_max, double max_rel_error) {
+	// Check limits
+	//
+	if (!surrogate_finite(x_min) || !surrogate_finite(x_max) ||
+		!surrogate_finite(max_rel_error) || x_min >= x_max ||
+		max_rel_error <= 0) {
+		if (status_report(STATUS_INVALID_INPUT, "newSurrogate", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot create surrogate for interval [%f, %f] with "
+				"maximal relative error %e.", x_min, x_max, max_rel_error);
+		}
+		return NULL;
+	}
+
+    // Try to allocate memory for Surrogate-struct
+	//
+    Surrogate *retSurrogate = (Surrogate *) malloc(sizeof(Surrogate));
+
+    if (retSurrogate == NULL) {
+		if (status_report(STATUS_NO_MEMORY, "newSurrogate", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for Surrogate-struct.");
+		}
+        return NULL;
+	}
+
+	retSurrogate->function = function;
+	retSurrogate->data = data;
+	retSurrogate->x_min = x_min;
+	retSurrogate->x_max = x_max;
+	retSurrogate->coefficients = NULL;
+	retSurrogate->exact = NULL;
+
+	// Refine intervals until required accuracy is reached or refinement does
+	// not improve accuracy
+	//
+	double fraction_exact = 1;
+	int no_stagnations = 0;
+
+	for (int no_intervals = SURROGATE_NO_INTERVALS_MIN;
+		no_intervals <= SURROGATE_NO_INTERVALS_MAX; no_intervals *= 2) {
+		free(retSurrogate->coefficients);
+		free(retSurrogate->exact);
+
+		retSurrogate->no_intervals = no_intervals;
+		retSurrogate->inv_h = no_intervals / (x_max - x_min);
+		retSurrogate->coefficients = (double *) malloc((size_t) no_intervals *
+			(SURROGATE_DEGREE + 1) * sizeof(double));
+		retSurrogate->exact = (char *) malloc((size_t) no_intervals *
+			sizeof(char));
+
+		if (retSurrogate->coefficients == NULL ||
+			retSurrogate->exact == NULL) {
+			if (status_report(STATUS_NO_MEMORY, "newSurrogate", 0, 0)) {
+				printf("\n\n###########\n# Warning #\n###########");
+				printf("\nCannot allocate memory for coefficients of "
+					"Surrogate-struct.");
+			}
+			delSurrogate(retSurrogate);
+			return NULL;
+		}
+
+		int no_exact = surrogate_fit(retSurrogate, max_rel_error);
+
+		no_stagnations = ((double) no_exact / no_intervals >= fraction_exact) ?
+			no_stagnations + 1 : 0;
+		fraction_exact = (double) no_exact / no_intervals;
+
+		if (no_exact == 0 || no_stagnations == 2) {
+			break;
+		}
+	}
+
+	// Return structure
+	//
+	return retSurrogate;
+}
+
+
+/*
+ * delSurrogate:
+ * -------------
+ *
+ * Destructor function to free allocated memory of a Surrogate-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Surrogate:
+ *		Pointer of Surrogate-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void delSurrogate(void *surrogate) {
+	// Typecast void pointer given as input to pointer of Surrogate-struct
+	//
+	Surrogate *retSurrogate = (Surrogate *) surrogate;
+
+    if (retSurrogate != NULL) {
+		free(retSurrogate->coefficients);
+		free(retSurrogate->exact);
+		free(retSurrogate);
+    }
+}
+
+
+/*
+ * surrogate_fit:
+ * --------------
+ *
+ * Auxiliary function to calculate Chebyshev coefficients of all intervals of a
+ * Surrogate-struct whose number of intervals is set before. Intervals that do
+ * not meet required accuracy or that contain non-finite values are marked to
+ * be evaluated by the original function. As functions of SorpPropLib return -1
+ * in case of an error (e.g., if the Newton-Raphson method does not converge),
+ * intervals containing -1 are also evaluated by the original function.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Surrogate:
+ *		Pointer of Surrogate-struct.
+ *	double max_rel_error:
+ *		Maximal relative error of approximation.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns number of intervals that are evaluated by original function.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int surrogate_fit(Surrogate *surrogate, double max_rel_error) {
+	// Initialize variables
+	//
+	const int no_nodes = SURROGATE_DEGREE + 1;
+	double h = 1 / surrogate->inv_h;
+	double values[SURROGATE_DEGREE + 1];
+	int no_exact = 0;
+
+	surrogate->max_error = 0;
+
+	for (int i = 0; i < surrogate->no_intervals; i++) {
+		// Evaluate original function at Chebyshev nodes of interval
+		//
+		double *c = &surrogate->coefficients[i * no_nodes];
+		double x_start = surrogate->x_min + i * h;
+		int accurate = 1;
+
+		for (int k = 0; k < no_nodes; k++) {
+			double u = cos(M_PI * (k + 0.5) / no_nodes);
+			values[k] = surrogate->function(x_start + 0.5 * (u + 1) * h,
+				surrogate->data);
+			accurate = accurate && surrogate_finite(values[k]) &&
+				values[k] != -1;
+		}
+
+		// Calculate Chebyshev coefficients by discrete cosine transformation
+		//
+		for (int j = 0; j < no_nodes; j++) {
+			double sum = 0;
+
+			for (int k = 0; k < no_nodes; k++) {
+				sum += values[k] * cos(M_PI * j * (k + 0.5) / no_nodes);
+			}
+			c[j] = 2.0 / no_nodes * sum;
+		}
+		c[0] *= 0.5;
+
+		// Check accuracy at equidistant points including limits of interval
+		//
+		double max_error_interval = 0;
+
+		for (int k = 0; k <= SURROGATE_NO_CHECKS && accurate; k++) {
+			double x = x_start + h * k / SURROGATE_NO_CHECKS;
+			double value = surrogate->function(x, surrogate->data);
+			double error = fabs(surrogate_chebyshev(2.0 * k /
+				SURROGATE_NO_CHECKS - 1, c) - value);
+
+			error = (value == 0) ? error : error / fabs(value);
+			accurate = surrogate_finite(error) && value != -1 &&
+				error <= max_rel_error;
+			max_error_interval = (error > max_error_interval) ? error :
+				max_error_interval;
+		}
+
+		// Intervals that are not accurate are evaluated by original function
+		//
+		surrogate->exact[i] = !accurate;
+
+		if (surrogate->exact[i]) {
+			no_exact++;
+		} else if (max_error_interval > surrogate->max_error) {
+			surrogate->max_error = max_error_interval;
+		}
+	}
+
+	return no_exact;
+}
+
+
+/*
+ * surrogate_chebyshev:
+ * --------------------
+ *
+ * Auxiliary function to evaluate a Chebyshev series of degree SURROGATE_DEGREE
+ * by Clenshaw's recurrence.
+ *
+ * Parameters:
+ * -----------
+ *	double u:
+ *		Variable scaled to interval [-1, 1].
+ *	const double *c:
+ *		Array containing Chebyshev coefficients.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Value of Chebyshev series.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DISPATCH_CLONES
+double surrogate_chebyshev(double u, const double *c) {
+	double b_1 = 0;
+	double b_2 = 0;
+
+	for (int j = SURROGATE_DEGREE; j > 0; j--) {
+		double b_0 = 2 * u * b_1 - b_2 + c[j];
+		b_2 = b_1;
+		b_1 = b_0;
+	}
+
+	return u * b_1 - b_2 + c[0];
+}
+
+
+/*
+ * surrogate_approximate:
+ * ----------------------
+ *
+ * Evaluates Chebyshev polynomial of surrogate at variable x if x is within
+ * limits of surrogate and within an interval that is accurate enough. Thus,
+ * callers can evaluate the original function with their own inputs
+ * otherwise.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_value:
+ *		Value of surrogate.
+ *	double x:
+ *		Variable.
+ * 	struct *Surrogate:
+ *		Pointer of Surrogate-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if state is approximated by surrogate and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int surrogate_approximate(double *ret_value, double x,
+	const Surrogate *surrogate) {
+	// Check limits of surrogate: Non-finite values are outside of limits
+	//
+	if (!(x >= surrogate->x_min && x <= surrogate->x_max) ||
+		!surrogate_finite(x)) {
+		return -1;
+	}
+
+	// Select interval: Upper limit belongs to last interval
+	//
+	double t = (x - surrogate->x_min) * surrogate->inv_h;
+	int i = (int) t;
+	i = (i < surrogate->no_intervals) ? i : surrogate->no_intervals - 1;
+
+	if (surrogate->exact[i]) {
+		return -1;
+	}
+
+	*ret_value = surrogate_chebyshev(2 * (t - i) - 1,
+		&surrogate->coefficients[i * (SURROGATE_DEGREE + 1)]);
+	return 0;
+}
+
+
+/*
+ * surrogate_evaluate:
+ * -------------------
+ *
+ * Evaluates surrogate at variable x. If x is outside of limits of surrogate or
+ * within an interval that is not accurate enough, the original function is
+ * evaluated.
+ *
+ * Parameters:
+ * -----------
+ *	double x:
+ *		Variable.
+ * 	struct *Surrogate:
+ *		Pointer of Surrogate-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Value of surrogate.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double surrogate_evaluate(double x, const Surrogate *surrogate) {
+	double value;
+
+	return (surrogate_approximate(&value, x, surrogate) == 0) ? value :
+		surrogate->function(x, surrogate->data);
+}
+
+
+/*
+ * surrogate_finite:
+ * -----------------
+ *
+ * Auxiliary function to check if a value is finite. Checks exponent bits of
+ * value directly because release builds use -Ofast, which assumes finite values
+ * and may remove checks like isfinite().
+ *
+ * Parameters:
+ * -----------
+ *	double x:
+ *		Value.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 1 if value is finite and 0 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int surrogate_finite(double x) {
+	uint64_t bits;
+	memcpy(&bits, &x, sizeof(bits));
+
+	return ((bits >> 52) & 0x7FF) != 0x7FF;
+}
+
+
+/*
+ * newSurrogate2D:
+ * ---------------
+ *
+ * Initialization function to create a new Surrogate2D-struct. Therefore,
+ * function approximates the original function by tensor-product Chebyshev
+ * polynomials of degree SURROGATE_2D_DEGREE on equidistant cells. The number of
+ * intervals per variable is doubled until the relative error at
+ * (SURROGATE_2D_NO_CHECKS + 1)^2 check points per cell is smaller than the
+ * required error or SURROGATE_2D_NO_INTERVALS_MAX is reached. Like for
+ * newSurrogate, refinement stops if the fraction of inaccurate cells does not
+ * decrease by a quarter for two refinements (e.g., if the original function
+ * fails in parts of the domain), and inaccurate cells are evaluated by the
+ * original function. If limits are invalid or memory allocation fails,
+ * functions returns NULL and prints a warning.
+ *
+ * Parameters:
+ * -----------
+ *	function function:
+ *		Original function depending on variables x and y and pointer to data.
+ *	void *data:
+ *		Pointer to data that is passed to original function.
+ *	int log_output:
+ *		Flag indicating whether logarithm of function is approximated (e.g.,
+ *		for pressures that span several orders of magnitude).
+ *	double x_min:
+ *		Lower limit of first variable.
+ *	double x_max:
+ *		Upper limit of first variable.
+ *	double y_min:
+ *		Lower limit of second variable.
+ *	double y_max:
+ *		Upper limit of second variable.
+ *	double max_rel_error:
+ *		Maximal relative error of approximation.
+ *
+ * Returns:
+ * --------
+ *	struct *Surrogate2D:
+ *		Returns malloc-ed Surrogate2D-struct.
+ *
+ * Remarks:
+ * --------
+ *	Accuracy is checked at the Chebyshev nodes and at equidistant check points
+ *	of each cell. Data must stay valid as long as the surrogate is used.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+Surrogate2D *newSurrogate2D(double (*function)(double, double, void*),
+	void *data, int log_output, double x_min, double x_max, double y_min,
+	double y_max, double max_rel_error) {
+	// Check limits
+	//
+	if (!surrogate_finite(x_min) || !surrogate_finite(x_max) ||
+		!surrogate_finite(y_min) || !surrogate_finite(y_max) ||
+		!surrogate_finite(max_rel_error) || x_min >= x_max ||
+		y_min >= y_max || max_rel_error <= 0) {
+		if (status_report(STATUS_INVALID_INPUT, "newSurrogate2D", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot create surrogate for cell [%f, %f] x [%f, %f] "
+				"with maximal relative error %e.", x_min, x_max, y_min, y_max,
+				max_rel_error);
+		}
+		return NULL;
+	}
+
+    // Try to allocate memory for Surrogate2D-struct
+	//
+    Surrogate2D *retSurrogate = (Surrogate2D *) malloc(sizeof(Surrogate2D));
+
+    if (retSurrogate == NULL) {
+		if (status_report(STATUS_NO_MEMORY, "newSurrogate2D", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for Surrogate2D-struct.");
+		}
+        return NULL;
+	}
+
+	retSurrogate->function = function;
+	retSurrogate->data = data;
+	retSurrogate->log_output = log_output;
+	retSurrogate->x_min = x_min;
+	retSurrogate->x_max = x_max;
+	retSurrogate->y_min = y_min;
+	retSurrogate->y_max = y_max;
+	retSurrogate->coefficients = NULL;
+	retSurrogate->exact = NULL;
+
+	// Refine cells until required accuracy is reached or refinement does not
+	// improve accuracy
+	//
+	const size_t no_coefficients = (SURROGATE_2D_DEGREE + 1) *
+		(SURROGATE_2D_DEGREE + 1);
+	double fraction_exact = 1;
+	int no_stagnations = 0;
+	double *coefficients_parent = NULL;
+	char *exact_parent = NULL;
+
+	for (int no_intervals = SURROGATE_2D_NO_INTERVALS_MIN;
+		no_intervals <= SURROGATE_2D_NO_INTERVALS_MAX; no_intervals *= 2) {
+		size_t no_cells = (size_t) no_intervals * no_intervals;
+
+		retSurrogate->no_intervals = no_intervals;
+		retSurrogate->inv_h_x = no_intervals / (x_max - x_min);
+		retSurrogate->inv_h_y = no_intervals / (y_max - y_min);
+		retSurrogate->coefficients = (double *) malloc(no_cells *
+			no_coefficients * sizeof(double));
+		retSurrogate->exact = (char *) malloc(no_cells * sizeof(char));
+
+		if (retSurrogate->coefficients == NULL ||
+			retSurrogate->exact == NULL) {
+			if (status_report(STATUS_NO_MEMORY, "newSurrogate2D", 0, 0)) {
+				printf("\n\n###########\n# Warning #\n###########");
+				printf("\nCannot allocate memory for coefficients of "
+					"Surrogate2D-struct.");
+			}
+			free(coefficients_parent);
+			free(exact_parent);
+			delSurrogate2D(retSurrogate);
+			return NULL;
+		}
+
+		// Cells of previous refinement are parents of new cells: Accurate
+		// parents are not evaluated again
+		//
+		int no_exact = surrogate2D_fit(retSurrogate, coefficients_parent,
+			exact_parent, max_rel_error);
+
+		free(coefficients_parent);
+		free(exact_parent);
+		coefficients_parent = retSurrogate->coefficients;
+		exact_parent = retSurrogate->exact;
+
+		no_stagnations = ((double) no_exact / no_cells >
+			0.75 * fraction_exact) ? no_stagnations + 1 : 0;
+		fraction_exact = (double) no_exact / no_cells;
+
+		if (no_exact == 0 || no_stagnations == 2) {
+			break;
+		}
+	}
+
+	// Return structure
+	//
+	return retSurrogate;
+}
+
+
+/*
+ * delSurrogate2D:
+ * ---------------
+ *
+ * Destructor function to free allocated memory of a Surrogate2D-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Surrogate2D:
+ *		Pointer of Surrogate2D-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void delSurrogate2D(void *surrogate) {
+	// Typecast void pointer given as input to pointer of Surrogate2D-struct
+	//
+	Surrogate2D *retSurrogate = (Surrogate2D *) surrogate;
+
+    if (retSurrogate != NULL) {
+		free(retSurrogate->coefficients);
+		free(retSurrogate->exact);
+		free(retSurrogate);
+    }
+}
+
+
+/*
+ * surrogate2D_fit:
+ * ----------------
+ *
+ * Auxiliary function to calculate Chebyshev coefficients of all cells of a
+ * Surrogate2D-struct whose number of intervals is set before. Like for
+ * surrogate_fit, cells that do not meet required accuracy or that contain
+ * non-finite values or -1 are marked to be evaluated by the original function.
+ * If logarithm of function is approximated, cells containing non-positive
+ * values are marked as well. Cells whose parent cell of the previous
+ * refinement is accurate are calculated from the polynomial of the parent
+ * without evaluating the original function. Thus, only inaccurate regions are
+ * refined adaptively.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Surrogate2D:
+ *		Pointer of Surrogate2D-struct.
+ *	const double *coefficients_parent:
+ *		Array containing Chebyshev coefficients of previous refinement with
+ *		half the number of intervals (i.e., NULL for first refinement).
+ *	const char *exact_parent:
+ *		Array indicating whether cell of previous refinement is evaluated by
+ *		original function (i.e., NULL for first refinement).
+ *	double max_rel_error:
+ *		Maximal relative error of approximation.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns number of cells that are evaluated by original function.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int surrogate2D_fit(Surrogate2D *surrogate, const double *coefficients_parent,
+	const char *exact_parent, double max_rel_error) {
+	// Initialize variables: Cosines of discrete cosine transformation are
+	// calculated only once
+	//
+	const int no_nodes = SURROGATE_2D_DEGREE + 1;
+	double h_x = 1 / surrogate->inv_h_x;
+	double h_y = 1 / surrogate->inv_h_y;
+	double nodes[SURROGATE_2D_DEGREE + 1];
+	double cosines[SURROGATE_2D_DEGREE + 1][SURROGATE_2D_DEGREE + 1];
+	double values[SURROGATE_2D_DEGREE + 1][SURROGATE_2D_DEGREE + 1];
+	double tmp[SURROGATE_2D_DEGREE + 1][SURROGATE_2D_DEGREE + 1];
+	int no_exact = 0;
+
+	for (int j = 0; j < no_nodes; j++) {
+		nodes[j] = cos(M_PI * (j + 0.5) / no_nodes);
+
+		for (int k = 0; k < no_nodes; k++) {
+			cosines[j][k] = cos(M_PI * j * (k + 0.5) / no_nodes);
+		}
+	}
+
+	// Maximal error of accurate parents is kept
+	//
+	surrogate->max_error = (coefficients_parent == NULL) ? 0 :
+		surrogate->max_error;
+
+	for (int i_x = 0; i_x < surrogate->no_intervals; i_x++) {
+		for (int i_y = 0; i_y < surrogate->no_intervals; i_y++) {
+			// Evaluate original function at Chebyshev nodes of cell
+			//
+			int cell = i_x * surrogate->no_intervals + i_y;
+			double *c = &surrogate->coefficients[cell * no_nodes * no_nodes];
+			double x_start = surrogate->x_min + i_x * h_x;
+			double y_start = surrogate->y_min + i_y * h_y;
+			int accurate = 1;
+
+			int parent = (i_x / 2) * (surrogate->no_intervals / 2) + i_y / 2;
+			const double *c_parent = (coefficients_parent == NULL ||
+				exact_parent[parent]) ? NULL :
+				&coefficients_parent[parent * no_nodes * no_nodes];
+
+			for (int k = 0; k < no_nodes && accurate; k++) {
+				for (int l = 0; l < no_nodes && accurate; l++) {
+					if (c_parent != NULL) {
+						// Cell is part of accurate parent: Polynomial of
+						// parent is evaluated at nodes of cell
+						//
+						values[k][l] = surrogate2D_chebyshev(
+							(i_x % 2) + 0.5 * (nodes[k] + 1) - 1,
+							(i_y % 2) + 0.5 * (nodes[l] + 1) - 1, c_parent);
+						continue;
+					}
+
+					double value = surrogate->function(x_start + 0.5 *
+						(nodes[k] + 1) * h_x, y_start + 0.5 * (nodes[l] + 1) *
+						h_y, surrogate->data);
+
+					accurate = surrogate_finite(value) && value != -1 &&
+						(!surrogate->log_output || value > 0);
+					values[k][l] = !accurate ? 0 : (surrogate->log_output ?
+						log(value) : value);
+				}
+			}
+
+			if (!accurate) {
+				// Cell contains states where original function fails, thus
+				// remaining nodes are not evaluated
+				//
+				surrogate->exact[cell] = 1;
+				no_exact++;
+				continue;
+			}
+
+			// Calculate Chebyshev coefficients by discrete cosine
+			// transformation regarding both variables
+			//
+			for (int j = 0; j < no_nodes; j++) {
+				for (int l = 0; l < no_nodes; l++) {
+					double sum = 0;
+
+					for (int k = 0; k < no_nodes; k++) {
+						sum += values[k][l] * cosines[j][k];
+					}
+					tmp[j][l] = ((j == 0) ? 1.0 : 2.0) / no_nodes * sum;
+				}
+			}
+
+			for (int j = 0; j < no_nodes; j++) {
+				for (int m = 0; m < no_nodes; m++) {
+					double sum = 0;
+
+					for (int l = 0; l < no_nodes; l++) {
+						sum += tmp[j][l] * cosines[m][l];
+					}
+					c[j * no_nodes + m] = ((m == 0) ? 1.0 : 2.0) / no_nodes *
+						sum;
+				}
+			}
+
+			// Check accuracy at equidistant points including limits of cell:
+			// Accuracy of accurate parents is already checked
+			//
+			double max_error_cell = 0;
+			int no_checks = (c_parent == NULL) ? SURROGATE_2D_NO_CHECKS : -1;
+
+			for (int k = 0; k <= no_checks && accurate; k++) {
+				for (int l = 0; l <= no_checks && accurate; l++) {
+					double value = surrogate->function(x_start + h_x * k /
+						SURROGATE_2D_NO_CHECKS, y_start + h_y * l /
+						SURROGATE_2D_NO_CHECKS, surrogate->data);
+					double approximation = surrogate2D_chebyshev(2.0 * k /
+						SURROGATE_2D_NO_CHECKS - 1, 2.0 * l /
+						SURROGATE_2D_NO_CHECKS - 1, c);
+
+					approximation = surrogate->log_output ? exp(approximation) :
+						approximation;
+
+					double error = fabs(approximation - value);
+					error = (value == 0) ? error : error / fabs(value);
+					accurate = surrogate_finite(error) && value != -1 &&
+						error <= max_rel_error;
+					max_error_cell = (error > max_error_cell) ? error :
+						max_error_cell;
+				}
+			}
+
+			// Cells that are not accurate are evaluated by original function
+			//
+			surrogate->exact[cell] = !accurate;
+
+			if (surrogate->exact[cell]) {
+				no_exact++;
+			} else if (max_error_cell > surrogate->max_error) {
+				surrogate->max_error = max_error_cell;
+			}
+		}
+	}
+
+	return no_exact;
+}
+
+
+/*
+ * surrogate2D_chebyshev:
+ * ----------------------
+ *
+ * Auxiliary function to evaluate a tensor-product Chebyshev series of degree
+ * SURROGATE_2D_DEGREE. Therefore, Chebyshev polynomials of both variables are
+ * calculated by their recurrence first. Afterwards, the sums of all rows are
+ * independent of each other and are not limited by the latency of a
+ * recurrence like Clenshaw's recurrence.
+ *
+ * Parameters:
+ * -----------
+ *	double u:
+ *		First variable scaled to interval [-1, 1].
+ *	double v:
+ *		Second variable scaled to interval [-1, 1].
+ *	const double *c:
+ *		Array containing Chebyshev coefficients (i.e., row-major with first
+ *		variable as row).
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Value of Chebyshev series.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DISPATCH_CLONES
+double surrogate2D_chebyshev(double u, double v, const double *c) {
+	// Calculate Chebyshev polynomials of both variables
+	//
+	double t_u[SURROGATE_2D_DEGREE + 1];
+	double t_v[SURROGATE_2D_DEGREE + 1];
+
+	t_u[0] = 1;
+	t_u[1] = u;
+	t_v[0] = 1;
+	t_v[1] = v;
+
+	for (int j = 2; j <= SURROGATE_2D_DEGREE; j++) {
+		t_u[j] = 2 * u * t_u[j - 1] - t_u[j - 2];
+		t_v[j] = 2 * v * t_v[j - 1] - t_v[j - 2];
+	}
+
+	// Sum up rows of coefficients
+	//
+	double sum = 0;
+
+	for (int j = 0; j <= SURROGATE_2D_DEGREE; j++) {
+		double sum_row = 0;
+
+		for (int k = 0; k <= SURROGATE_2D_DEGREE; k++) {
+			sum_row += c[j * (SURROGATE_2D_DEGREE + 1) + k] * t_v[k];
+		}
+		sum += sum_row * t_u[j];
+	}
+
+	return sum;
+}
+
+
+/*
+ * surrogate2D_approximate:
+ * ------------------------
+ *
+ * Evaluates Chebyshev polynomial of surrogate at variables x and y if both are
+ * within limits of surrogate and within a cell that is accurate enough. Thus,
+ * callers can evaluate the original function with their own inputs
+ * otherwise.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_value:
+ *		Value of surrogate.
+ *	double x:
+ *		First variable.
+ *	double y:
+ *		Second variable.
+ * 	struct *Surrogate2D:
+ *		Pointer of Surrogate2D-struct (i.e., may be NULL).
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if state is approximated by surrogate and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int surrogate2D_approximate(double *ret_value, double x, double y,
+	const Surrogate2D *surrogate) {
+	// Check limits of surrogate: Non-finite values are outside of limits
+	//
+	if (surrogate == NULL ||
+		!(x >= surrogate->x_min && x <= surrogate->x_max) ||
+		!(y >= surrogate->y_min && y <= surrogate->y_max) ||
+		!surrogate_finite(x) || !surrogate_finite(y)) {
+		return -1;
+	}
+
+	// Select cell: Upper limits belong to last intervals
+	//
+	double t_x = (x - surrogate->x_min) * surrogate->inv_h_x;
+	double t_y = (y - surrogate->y_min) * surrogate->inv_h_y;
+	int i_x = (int) t_x;
+	int i_y = (int) t_y;
+	i_x = (i_x < surrogate->no_intervals) ? i_x : surrogate->no_intervals - 1;
+	i_y = (i_y < surrogate->no_intervals) ? i_y : surrogate->no_intervals - 1;
+
+	int cell = i_x * surrogate->no_intervals + i_y;
+
+	if (surrogate->exact[cell]) {
+		return -1;
+	}
+
+	double value = surrogate2D_chebyshev(2 * (t_x - i_x) - 1,
+		2 * (t_y - i_y) - 1, &surrogate->coefficients[cell *
+		(SURROGATE_2D_DEGREE + 1) * (SURROGATE_2D_DEGREE + 1)]);
+
+	*ret_value = surrogate->log_output ? exp(value) : value;
+	return 0;
+}
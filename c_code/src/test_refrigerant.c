@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "refrigerant.h"
+#include "status.h"
 #include "structDefinitions.c"
 
 
@@ -327,6 +328,45 @@ int main() {
 		"temperature results in dp_dT = %f Pa/K.",
 		T_K, dpsat_dT_R142b_EoS3_PaK);
 
+	// Check that failures of cached vapor pressure are reported by each call:
+	// Temperature is above critical temperature of cubic equation of state
+	//
+	double T_failure_K = 400;
+	int status_failure[4];
+
+	refrigerant_enable_cache(refrigerant_R134a_cubic_PRE);
+	setStatusQuiet(1);
+
+	for (int i = 0; i < 2; i++) {
+		resetStatus();
+		refrigerant_R134a_cubic_PRE->p_sat_T(T_failure_K,
+			refrigerant_R134a_vaporPressure_cubic_PRE,
+			refrigerant_R134a_cubic_PRE);
+		status_failure[i] = getStatusCode();
+
+		resetStatus();
+		refrigerant_R134a_cubic_PRE->dp_sat_dT(T_failure_K,
+			refrigerant_R134a_vaporPressure_cubic_PRE,
+			refrigerant_R134a_cubic_PRE);
+		status_failure[2 + i] = getStatusCode();
+	}
+
+	setStatusQuiet(0);
+	resetStatus();
+
+	int failed = status_failure[0] == STATUS_OK ||
+		status_failure[1] == STATUS_OK || status_failure[2] == STATUS_OK ||
+		status_failure[3] == STATUS_OK;
+
+	printf("\n\n##\n##\nCached vapor pressure of: \"R-134a\" - \"PRE\".");
+	printf("\nFor T = %f K, status of vapor pressure results in %i and %i.",
+		T_failure_K, status_failure[0], status_failure[1]);
+	printf("\nFor T = %f K, status of derivative of vapor pressure wrt. "
+		"temperature results in %i and %i.",
+		T_failure_K, status_failure[2], status_failure[3]);
+	printf("\nRepeated failures are %s.\n",
+		failed ? "not reported" : "reported");
+
 	// Free memory that is allocate for structures
 	//
 	delRefrigerant(refrigerant_R134a_EoS1);
@@ -338,5 +378,5 @@ int main() {
 	delRefrigerant(refrigerant_benzene_antoine);
 	delRefrigerant(refrigerant_R142b_EoS3);
 
-    return EXIT_SUCCESS;
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
 }
@@ -0,0 +1,123 @@
+//////////////////////////////
+// test_refrigerantHandle.c //
+//////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "database.h"
+#include "refrigerantHandle.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//SorpPropLib_MinimalExample.json"
+#else
+	#define PATH ".\\data\\SorpPropLib_MinimalExample.json"
+#endif
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+void testRefrigerantHandle(Database *database, const char *wp_rf,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Initialize refrigerant handle
+	//
+	RefrigerantHandle *refrigerantHandle = newRefrigerantHandle(database,
+		wp_rf, rf_psat, no_p_sat, rf_rhol, no_rhol);
+
+	if (refrigerantHandle != NULL) {
+		// Define some random parameters to calculate saturation properties
+		//
+		double T_K[] = {273.15, 303.15, 333.15};
+		double p_sat_Pa[3];
+		double dp_sat_dT_PaK[3];
+		double rho_l_kgm3[3];
+		double T_sat_K[3];
+
+		// Execute functions for arrays of states
+		//
+		refh_p_sat_T_batch(p_sat_Pa, T_K, 3, refrigerantHandle);
+		refh_dp_sat_dT_T_batch(dp_sat_dT_PaK, T_K, 3, refrigerantHandle);
+		refh_rho_l_T_batch(rho_l_kgm3, T_K, 3, refrigerantHandle);
+		refh_T_sat_p_batch(T_sat_K, p_sat_Pa, 3, refrigerantHandle);
+
+		// Print results
+		//
+		printf("\n\n##\n##\nCreated refrigerant handle for \"%s\".", wp_rf);
+		printf("\nApproaches: \"%s\" and \"%s\".", rf_psat, rf_rhol);
+
+		for (int i = 0; i < 3; i++) {
+			printf("\n\nFor T = %f K:", T_K[i]);
+			printf("\np_sat = %f Pa (single state: %f Pa).", p_sat_Pa[i],
+				refh_p_sat_T(T_K[i], refrigerantHandle));
+			printf("\ndp_sat_dT = %f Pa/K (single state: %f Pa/K).",
+				dp_sat_dT_PaK[i], refh_dp_sat_dT_T(T_K[i], refrigerantHandle));
+			printf("\nrho_l = %f kg/m3 (single state: %f kg/m3).",
+				rho_l_kgm3[i], refh_rho_l_T(T_K[i], refrigerantHandle));
+			printf("\nT_sat(p_sat) = %f K (single state: %f K).", T_sat_K[i],
+				refh_T_sat_p(p_sat_Pa[i], refrigerantHandle));
+		}
+
+		// Execute functions using surrogates
+		//
+		if (refh_enable_surrogate(263.15, 343.15, 1e-9,
+			refrigerantHandle) == 0) {
+			printf("\n\nSurrogates enabled for T = 263.15 - 343.15 K:");
+
+			for (int i = 0; i < 3; i++) {
+				printf("\n\nFor T = %f K:", T_K[i]);
+				printf("\np_sat = %f Pa.", refh_p_sat_T(T_K[i],
+					refrigerantHandle));
+				printf("\ndp_sat_dT = %f Pa/K.", refh_dp_sat_dT_T(T_K[i],
+					refrigerantHandle));
+				printf("\nrho_l = %f kg/m3.", refh_rho_l_T(T_K[i],
+					refrigerantHandle));
+				printf("\nT_sat(p_sat) = %f K.", refh_T_sat_p(p_sat_Pa[i],
+					refrigerantHandle));
+			}
+		}
+	}
+
+	// Free memory
+	//
+	delRefrigerantHandle(refrigerantHandle);
+}
+
+
+int main() {
+	// Read and parse database only once for all refrigerants
+	//
+	Database *database = newDatabase(PATH);
+
+	if (database == NULL) {
+		return EXIT_FAILURE;
+	}
+
+	// Test refrigerant: Water
+	//
+	testRefrigerantHandle(database, "water", "VaporPressure_EoS1", 1,
+		"SaturatedLiquidDensity_EoS1", 1);
+
+	// Test refrigerant: R-134a
+	//
+	testRefrigerantHandle(database, "R-134a", "VaporPressure_EoS1", 1,
+		"SaturatedLiquidDensity_EoS1", 1);
+
+	// Test refrigerant: Propane with Antoine equation
+	//
+	testRefrigerantHandle(database, "propane", "VaporPressure_Antoine", 1,
+		"SaturatedLiquidDensity_EoS1", 1);
+
+	// Test refrigerant without sorbent entry: R-410a
+	//
+	testRefrigerantHandle(database, "R-410a", "VaporPressure_EoS1", 1,
+		"SaturatedLiquidDensity_EoS1", 1);
+
+	// Free memory
+	//
+	delDatabase(database);
+	return EXIT_SUCCESS;
+}
@@ -4,6 +4,8 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include "batchPool.h"
 #include "workingPair.h"
 #include "structDefinitions.c"
 
@@ -839,6 +841,117 @@ void testWorkingPair_abs_mix(double T_K, double x_molmol,
 }
 
 
+int testWorkingPair_serialization(const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Initialize working pair and serialize it
+	//
+	WorkingPair *workingPair = newWorkingPair(path_db, wp_as, wp_st, wp_rf,
+		wp_iso, no_iso, rf_psat, no_p_sat, rf_rhol, no_rhol);
+	size_t size_blob = serializeWorkingPair(NULL, 0, workingPair);
+	unsigned char *blob = (unsigned char *) malloc(size_blob);
+	int failed = 1;
+
+	if (workingPair != NULL && blob != NULL &&
+		serializeWorkingPair(blob, size_blob, workingPair) == size_blob) {
+		// Deserialize original byte array and byte arrays whose numbers of
+		// coefficients do not match isotherm equation: Modified byte arrays
+		// must be rejected
+		//
+		WorkingPair *copy = deserializeWorkingPair(blob, size_blob);
+		WorkingPair *copy_truncated = deserializeWorkingPair(blob,
+			size_blob / 2);
+
+		int header[7];
+		memcpy(header, blob, sizeof(header));
+		int no_iso_par = header[6];
+
+		header[6] = 0;
+		memcpy(blob, header, sizeof(header));
+		WorkingPair *copy_no_par = deserializeWorkingPair(blob, size_blob);
+
+		header[6] = no_iso_par - 1;
+		memcpy(blob, header, sizeof(header));
+		WorkingPair *copy_less_par = deserializeWorkingPair(blob, size_blob);
+
+		failed = (copy == NULL || copy_truncated != NULL ||
+			copy_no_par != NULL || copy_less_par != NULL ||
+			ads_w_pT(0.1e6, 303.15, copy) != ads_w_pT(0.1e6, 303.15,
+			workingPair));
+
+		printf("\n\n##\n##\nSerialization of %s / %s (%s): %s.", wp_as,
+			wp_st, wp_iso, failed ? "failed" : "passed");
+
+		delWorkingPair(copy);
+		delWorkingPair(copy_truncated);
+		delWorkingPair(copy_no_par);
+		delWorkingPair(copy_less_par);
+	}
+
+	// Free memory
+	//
+	free(blob);
+	delWorkingPair(workingPair);
+	return failed;
+}
+
+
+typedef struct {
+	BatchPool *batchPool;
+	int *counts;
+	int offset;
+} TestBatch;
+
+
+void testWorkingPair_inner_kernel(int begin, int end, void *context) {
+	TestBatch *batch = (TestBatch *) context;
+
+	for (int i = begin; i < end; i++) {
+		batch->counts[batch->offset + i]++;
+	}
+}
+
+
+void testWorkingPair_outer_kernel(int begin, int end, void *context) {
+	// Each item of outer batch evaluates inner batch with the same pool
+	//
+	TestBatch *batch = (TestBatch *) context;
+
+	for (int i = begin; i < end; i++) {
+		TestBatch inner = {batch->batchPool, batch->counts, 8 * i};
+
+		batchPool_run(batch->batchPool, 8, 1, &testWorkingPair_inner_kernel,
+			&inner);
+	}
+}
+
+
+int testWorkingPair_nested_batch(void) {
+	// Evaluate batches whose kernels call the same pool: Nested batches must
+	// neither block nor skip items
+	//
+	BatchPool *batchPool = newBatchPool(4);
+	int counts[64 * 8] = {0};
+	int failed = (batchPool == NULL);
+
+	if (!failed) {
+		TestBatch outer = {batchPool, counts, 0};
+		batchPool_run(batchPool, 64, 1, &testWorkingPair_outer_kernel,
+			&outer);
+
+		for (int i = 0; i < 64 * 8; i++) {
+			failed = failed || (counts[i] != 1);
+		}
+	}
+
+	printf("\n\n##\n##\nNested batches of BatchPool-struct: %s.",
+		failed ? "failed" : "passed");
+
+	delBatchPool(batchPool);
+	return failed;
+}
+
+
 /////////////////////////////////
 // Definition of main function //
 /////////////////////////////////
@@ -1059,5 +1172,24 @@ int main() {
 		"SaturatedLiquidDensity_EoS1",
 		1);
 
-	return EXIT_SUCCESS;
+	// Test serialization: Carbon Maxsorb-III / R-134a
+	//
+	int failed = testWorkingPair_serialization(
+		PATH,
+		"carbon",
+		"maxsorb-iii",
+		"R-134a",
+		"DubininAstakhov",
+		1,
+		"VaporPressure_EoS1",
+		1,
+		"SaturatedLiquidDensity_EoS1",
+		1);
+
+	// Test batches whose kernels call the same pool
+	//
+	failed = testWorkingPair_nested_batch() || failed;
+	printf("\n");
+
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
 }
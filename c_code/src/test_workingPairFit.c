@@ -0,0 +1,346 @@
+///////////////////////////
+// test_workingPairFit.c //
+///////////////////////////
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "batchPool.h"
+#include "cJSON.h"
+#include "database.h"
+#include "status.h"
+#include "workingPairFit.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//sorpproplib.json"
+#else
+	#define PATH ".\\data\\sorpproplib.json"
+#endif
+
+// Maximal error of analytic derivatives compared with central differences:
+// Wrong derivatives result in errors of order one, whereas central
+// differences of exponential equations (e.g., Antoine) are truncated
+//
+#define MAX_ERROR_JACOBIAN 1e-1
+
+
+/////////////////////////////
+// Definition of variables //
+/////////////////////////////
+/*
+ * Isotherm equations whose fits of all data sets of the database converge:
+ * Fits of other equations may stop after maximal number of iterations.
+ *
+ */
+const char *models_converging[] = {"DualSiteSips", "DubininAstakhov",
+	"Freundlich", "Heil", "Langmuir", "TsubokaKatayama", "WangChao",
+	"WilsonFixedDl"};
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+double testJacobian(Fit *fit, const double *par) {
+	// Compare analytic derivatives with central differences at all points:
+	// Derivatives that are zero by definition (e.g., flags) are skipped
+	//
+	const FitModel *model = fit->model;
+	double par_h[FIT_MAX_NO_COEFFICIENTS];
+	double dvalue_dpar[FIT_MAX_NO_COEFFICIENTS];
+	double dummy[FIT_MAX_NO_COEFFICIENTS];
+	double max_error = 0;
+
+	for (int i = 0; i < fit->no_points; i++) {
+		double inputs[FIT_NO_INPUTS];
+
+		for (int k = 0; k < FIT_NO_INPUTS; k++) {
+			inputs[k] = fit->inputs[k][i];
+		}
+		for (int j = 0; j < model->no_par; j++) {
+			par_h[j] = par[j];
+		}
+
+		double value = model->function(dvalue_dpar, inputs[0], inputs[1],
+			inputs[2], inputs[3], inputs[4], par_h);
+
+		for (int j = 0; j < model->no_par; j++) {
+			if (dvalue_dpar[j] == 0 || !(fabs(value) < 1e300)) {
+				continue;
+			}
+
+			double h = 1e-6 * (fabs(par[j]) + 1e-6);
+
+			par_h[j] = par[j] + h;
+			double value_plus = model->function(dummy, inputs[0], inputs[1],
+				inputs[2], inputs[3], inputs[4], par_h);
+			par_h[j] = par[j] - h;
+			double value_minus = model->function(dummy, inputs[0], inputs[1],
+				inputs[2], inputs[3], inputs[4], par_h);
+			par_h[j] = par[j];
+
+			double difference = (value_plus - value_minus) / (2 * h);
+			double error = fabs(dvalue_dpar[j] - difference) /
+				(fabs(dvalue_dpar[j]) + fabs(difference) + 1e-6 *
+				fabs(value) / (fabs(par[j]) + 1e-6));
+
+			max_error = (error > max_error) ? error : max_error;
+		}
+	}
+	return max_error;
+}
+
+
+int testRecovery(Database *database, BatchPool *batchPool, Fit *fit,
+	const char *wp_rf, const double *par) {
+	// Replace measured values by values of isotherm equation with
+	// coefficients of database at the same inputs
+	//
+	const FitModel *model = fit->model;
+	static const char *names[3] = {"pressures", "temperatures", "loadings"};
+	double *inputs[3] = {NULL, NULL, NULL};
+	double dummy[FIT_MAX_NO_COEFFICIENTS];
+	double par_model[FIT_MAX_NO_COEFFICIENTS];
+	int no_points = 0;
+
+	for (int k = 0; k < 3; k++) {
+		inputs[k] = (double *) malloc(fit->no_points * sizeof(double));
+	}
+	for (int j = 0; j < model->no_par; j++) {
+		par_model[j] = par[j];
+	}
+
+	for (int i = 0; inputs[0] != NULL && inputs[1] != NULL &&
+		inputs[2] != NULL && i < fit->no_points; i++) {
+		double value = model->function(dummy, fit->inputs[0][i],
+			fit->inputs[1][i], fit->inputs[2][i], fit->inputs[3][i],
+			fit->inputs[4][i], par_model);
+
+		if (!(fabs(value) < 1e300)) {
+			continue;
+		}
+		for (int k = 0; k < 3; k++) {
+			inputs[k][no_points] = (strcmp(model->measured, names[k]) == 0) ?
+				value : fit->inputs[k][i];
+		}
+		no_points++;
+	}
+
+	cJSON *json_block = cJSON_CreateObject();
+	cJSON *json_data = cJSON_AddObjectToObject(json_block, "_d_");
+
+	for (int k = 0; json_data != NULL && k < 3; k++) {
+		cJSON_AddItemToObject(json_data, names[k], (inputs[k] == NULL) ?
+			cJSON_CreateArray() : cJSON_CreateDoubleArray(inputs[k],
+			no_points));
+		free(inputs[k]);
+	}
+
+	char *text = cJSON_PrintUnformatted(json_block);
+	cJSON_Delete(json_block);
+
+	Fit *fit_model_data = (text == NULL) ? NULL : newFit(database,
+		model->wp_iso, wp_rf, NULL, 1, NULL, 1, text);
+	cJSON_free(text);
+
+	if (fit_model_data == NULL) {
+		printf("\n%s: Cannot create fit of points of isotherm equation.",
+			model->wp_iso);
+		return 1;
+	}
+
+	// Fit coefficients starting from disturbed coefficients: Coefficients of
+	// database must be recovered
+	//
+	double par_start[FIT_MAX_NO_COEFFICIENTS];
+	double par_fit[FIT_MAX_NO_COEFFICIENTS];
+	double max_deviation = 0;
+
+	for (int j = 0; j < model->no_par; j++) {
+		par_start[j] = par[j] * ((j % 2 == 0) ? 1.05 : 0.95);
+	}
+
+	int no_valid, no_iterations;
+	double rmse, are, max_error;
+
+	fit_optimize(par_start, NULL, NULL, 0, 0, 0, batchPool, fit_model_data);
+	getFitCoefficients(par_fit, NULL, fit_model_data);
+	int status = getFitStatistics(&no_valid, &no_iterations, &rmse, &are,
+		&max_error, fit_model_data);
+
+	for (int j = 0; j < model->no_par; j++) {
+		double deviation = fabs(par_fit[j] - par[j]) / (fabs(par[j]) +
+			1e-12);
+
+		max_deviation = (deviation > max_deviation) ? deviation :
+			max_deviation;
+	}
+
+	int failed = (status != STATUS_OK || !(max_deviation < 1e-4));
+
+	printf("\n%-20s %-10s %4i points of isotherm equation: Maximal relative "
+		"deviation of coefficients %8.2e (%4i iterations, status: \"%s\"): "
+		"%s.", model->wp_iso, wp_rf, no_valid, max_deviation, no_iterations,
+		getStatusMessage(status), failed ? "failed" : "passed");
+
+	// Free memory
+	//
+	delFit(fit_model_data);
+	return failed;
+}
+
+
+int testFit(Database *database, BatchPool *batchPool, cJSON *json_entry,
+	const char *wp_iso, cJSON *json_equation) {
+	// Collect all blocks of experimental data sharing literature with
+	// isotherm equation
+	//
+	cJSON *json_key = cJSON_GetObjectItemCaseSensitive(json_entry, "k");
+	cJSON *json_value = cJSON_GetObjectItemCaseSensitive(json_entry, "v");
+	cJSON *json_ed = cJSON_GetObjectItemCaseSensitive(json_value, "_ed_");
+	const char *wp_rf = cJSON_GetStringValue(
+		cJSON_GetObjectItemCaseSensitive(json_key, "_rf_"));
+	const char *literature = cJSON_GetStringValue(
+		cJSON_GetObjectItemCaseSensitive(json_equation, "_c_"));
+	cJSON *json_blocks = cJSON_CreateArray();
+	cJSON *json_block;
+
+	cJSON_ArrayForEach(json_block, json_ed) {
+		const char *literature_block = cJSON_GetStringValue(
+			cJSON_GetObjectItemCaseSensitive(json_block, "_c_"));
+
+		if (literature != NULL && literature_block != NULL &&
+			strcmp(literature, literature_block) == 0) {
+			cJSON_AddItemReferenceToArray(json_blocks, json_block);
+		}
+	}
+
+	char *text = cJSON_PrintUnformatted(json_blocks);
+	cJSON_Delete(json_blocks);
+
+	Fit *fit = (text == NULL) ? NULL : newFit(database, wp_iso, wp_rf, NULL,
+		1, NULL, 1, text);
+	cJSON_free(text);
+
+	if (fit == NULL) {
+		return 0;
+	}
+
+	// Read coefficients of database in order of coefficients of fit
+	//
+	cJSON *json_par = cJSON_GetObjectItemCaseSensitive(json_equation, "_p_");
+	int no_par = getFitNoCoefficients(fit);
+	double par[FIT_MAX_NO_COEFFICIENTS];
+
+	for (int j = 0; j < no_par; j++) {
+		cJSON *json_number = cJSON_GetObjectItemCaseSensitive(json_par,
+			getFitCoefficientName(j, fit));
+
+		if (!cJSON_IsNumber(json_number)) {
+			printf("\n%s: Coefficient \"%s\" is missing.", wp_iso,
+				getFitCoefficientName(j, fit));
+			delFit(fit);
+			return 0;
+		}
+		par[j] = json_number->valuedouble;
+	}
+
+	// Calculate errors of coefficients of database by fixing all
+	// coefficients and fit all coefficients afterwards
+	//
+	int no_valid, no_iterations;
+	double rmse_start, rmse, are, max_error;
+
+	fit_optimize(par, par, par, 0, 0, 0, batchPool, fit);
+	getFitStatistics(&no_valid, &no_iterations, &rmse_start, &are,
+		&max_error, fit);
+
+	double error_jacobian = testJacobian(fit, par);
+	fit_optimize(par, NULL, NULL, 0, 0, 0, batchPool, fit);
+	int status = getFitStatistics(&no_valid, &no_iterations, &rmse, &are,
+		&max_error, fit);
+
+	// Check fit: Fit must not increase RMSE of coefficients of database,
+	// derivatives must be correct, and fit must converge for equations known
+	// to converge
+	//
+	int converging = 0;
+
+	for (size_t i = 0; i < sizeof(models_converging) /
+		sizeof(models_converging[0]); i++) {
+		converging |= (strcmp(wp_iso, models_converging[i]) == 0);
+	}
+
+	int failed = !(rmse <= rmse_start * (1 + 1e-9) + 1e-12) ||
+		!(error_jacobian < MAX_ERROR_JACOBIAN) ||
+		(status != STATUS_OK && (converging ||
+		status != STATUS_NO_CONVERGENCE));
+
+	printf("\n%-20s %-10s %4i of %4i points: RMSE %10.4e -> %10.4e (%4i "
+		"iterations, status: \"%s\"), Jacobian error: %8.2e: %s.", wp_iso,
+		wp_rf, no_valid, getFitNoPoints(fit), rmse_start, rmse, no_iterations,
+		getStatusMessage(status), error_jacobian, failed ? "failed" :
+		"passed");
+
+	// Recover coefficients of database from points of isotherm equation for
+	// equations with few coefficients that are determined by all data sets
+	//
+	if (strcmp(wp_iso, "Langmuir") == 0) {
+		failed |= testRecovery(database, batchPool, fit, wp_rf, par);
+	}
+
+	// Free memory
+	//
+	delFit(fit);
+	return failed;
+}
+
+
+int main() {
+	// Read and parse database only once for all fits and create pool reused
+	// by all fits
+	//
+	Database *database = newDatabase(PATH);
+	BatchPool *batchPool = newBatchPool(0);
+
+	if (database == NULL || batchPool == NULL) {
+		return EXIT_FAILURE;
+	}
+
+	// Test fits: Coefficients of all isotherm equations having experimental
+	// data are fitted starting from the coefficients of the database
+	//
+	setStatusQuiet(1);
+	cJSON *json_entry;
+	int failed = 0;
+
+	cJSON_ArrayForEach(json_entry, database->json_file) {
+		cJSON *json_value = cJSON_GetObjectItemCaseSensitive(json_entry, "v");
+		cJSON *json_equations = cJSON_GetObjectItemCaseSensitive(json_value,
+			"_ep_");
+		cJSON *json_equation_type;
+
+		cJSON_ArrayForEach(json_equation_type, json_equations) {
+			cJSON *json_equation;
+
+			if (fit_model(json_equation_type->string) == NULL) {
+				continue;
+			}
+			cJSON_ArrayForEach(json_equation, json_equation_type) {
+				failed |= testFit(database, batchPool, json_entry,
+					json_equation_type->string, json_equation);
+			}
+		}
+	}
+	printf("\n");
+
+	// Free memory
+	//
+	delBatchPool(batchPool);
+	delDatabase(database);
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
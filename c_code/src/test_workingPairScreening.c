@@ -0,0 +1,127 @@
+/////////////////////////////////
+// test_workingPairScreening.c //
+/////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "batchPool.h"
+#include "database.h"
+#include "status.h"
+#include "workingPair.h"
+#include "workingPairScreening.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#define PATH ".//data//SorpPropLib_MinimalExample.json"
+#else
+	#define PATH ".\\data\\SorpPropLib_MinimalExample.json"
+#endif
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+void testScreening(Database *database, BatchPool *batchPool,
+	const char *wp_rf, const char *function, const double *input_0,
+	const double *input_1, int no_points) {
+	// Initialize screening of all working pairs using refrigerant
+	//
+	Screening *screening = newScreening(database, wp_rf, "VaporPressure_EoS1",
+		1, "SaturatedLiquidDensity_EoS1", 1);
+
+	if (screening != NULL) {
+		// Evaluate function for all working pairs and states
+		//
+		int no_workingPairs = getScreeningNoWorkingPairs(screening);
+		double *values = (double *) malloc(no_workingPairs * no_points *
+			sizeof(double));
+		int *status = (int *) malloc(no_workingPairs * no_points *
+			sizeof(int));
+		const double *inputs[] = {input_0, input_1};
+
+		if (values == NULL || status == NULL || screening_evaluate(values,
+			NULL, NULL, status, function, inputs, no_points, 0, batchPool,
+			screening) != 0) {
+			free(values);
+			free(status);
+			delScreening(screening);
+			return;
+		}
+
+		// Print results and compare loadings with single states
+		//
+		printf("\n\n##\n##\nScreened %i working pairs using \"%s\" by \"%s\".",
+			no_workingPairs, wp_rf, function);
+
+		for (int i = 0; i < no_workingPairs; i++) {
+			const char *wp_as;
+			const char *wp_st;
+			const char *wp_iso;
+			int no_iso;
+			WorkingPair *workingPair = getScreeningWorkingPair(&wp_as, &wp_st,
+				NULL, &wp_iso, &no_iso, i, screening);
+
+			printf("\n\n%s / %s (%s %i):", wp_as, wp_st, wp_iso, no_iso);
+
+			for (int j = 0; j < no_points; j++) {
+				double value = values[i * no_points + j];
+				int code = status[i * no_points + j];
+
+				if (code != STATUS_OK) {
+					printf("\nState %i: %f (status: %s).", j, value,
+						getStatusMessage(code));
+
+				} else if (strcmp(function, "ads_w_pT") != 0) {
+					printf("\nState %i: %f.", j, value);
+
+				} else {
+					printf("\nState %i: %f (single state: %f).", j, value,
+						ads_w_pT(input_0[j], input_1[j], workingPair));
+
+				}
+			}
+		}
+		free(values);
+		free(status);
+	}
+
+	// Free memory
+	//
+	delScreening(screening);
+}
+
+
+int main() {
+	// Read and parse database only once for all screenings and create pool
+	// reused by all screenings
+	//
+	Database *database = newDatabase(PATH);
+	BatchPool *batchPool = newBatchPool(0);
+
+	if (database == NULL || batchPool == NULL) {
+		return EXIT_FAILURE;
+	}
+
+	// Test screening: Loadings of all water working pairs at adsorption and
+	// desorption conditions
+	//
+	double p_Pa[] = {1228.0, 4246.0};
+	double T_K[] = {303.15, 353.15};
+
+	testScreening(database, batchPool, "water", "ads_w_pT", p_Pa, T_K, 2);
+
+	// Test screening: Vapor pressure of all R-134a working pairs
+	//
+	testScreening(database, batchPool, "R-134a", "ref_p_sat_T", T_K, NULL, 2);
+	printf("\n");
+
+	// Free memory
+	//
+	delBatchPool(batchPool);
+	delDatabase(database);
+	return EXIT_SUCCESS;
+}
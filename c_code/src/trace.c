@@ -0,0 +1,1066 @@
+/////////////
+// trace.c //
+/////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "spinLock.h"
+#include "statistics.h"
+#include "status.h"
+#include "threadLocal.h"
+#include "trace.h"
+#include "workingPair.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+/*
+ * TRACE_FETCH_ADD / TRACE_INCREMENT / TRACE_LOAD / TRACE_STORE /
+ * TRACE_EXCHANGE:
+ * --------------------------------------------------------------
+ *
+ * Atomic operations on position of ring buffer (i.e., unsigned long long) and
+ * on flags and counters (i.e., long). Flags are stored with release semantics
+ * and loaded with acquire semantics. Thus, the ring buffer is allocated before
+ * recording is seen to be active.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#if defined(__GNUC__)
+	#define TRACE_FETCH_ADD(counter, value) \
+		__atomic_fetch_add((counter), (value), __ATOMIC_RELAXED)
+	#define TRACE_INCREMENT(counter) \
+		__atomic_add_fetch((counter), 1, __ATOMIC_RELAXED)
+	#define TRACE_LOAD(flag) \
+		__atomic_load_n((flag), __ATOMIC_ACQUIRE)
+	#define TRACE_STORE(flag, value) \
+		__atomic_store_n((flag), (value), __ATOMIC_RELEASE)
+	#define TRACE_EXCHANGE(flag, value) \
+		__atomic_exchange_n((flag), (value), __ATOMIC_ACQ_REL)
+#else
+	#include <intrin.h>
+	#define TRACE_FETCH_ADD(counter, value) \
+		((unsigned long long) _InterlockedExchangeAdd64( \
+			(__int64 volatile *) (counter), (__int64) (value)))
+	#define TRACE_INCREMENT(counter) \
+		_InterlockedIncrement((long volatile *) (counter))
+	#define TRACE_LOAD(flag) \
+		(*((long volatile *) (flag)))
+	#define TRACE_STORE(flag, value) \
+		_InterlockedExchange((long volatile *) (flag), (long) (value))
+	#define TRACE_EXCHANGE(flag, value) \
+		_InterlockedExchange((long volatile *) (flag), (long) (value))
+#endif
+
+/*
+ * TRACE_NO_KEYS:
+ * --------------
+ *
+ * Number of pointers of working pairs that are mapped to working pairs of the
+ * trace at the same time.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#ifndef TRACE_NO_KEYS
+#define TRACE_NO_KEYS 256
+#endif
+
+#define TRACE_NAME(name) #name,
+#define TRACE_MAGIC "SORPTRC"
+#define TRACE_VERSION 1
+
+
+///////////////////////////
+// Definition of structs //
+///////////////////////////
+/*
+ * TraceCall:
+ * ----------
+ *
+ * Contains inputs of a call that is in progress. Struct is a local variable of
+ * each recorded function and, thus, calls of several threads do not interfere.
+ *
+ * Attributes:
+ * -----------
+ *	int function:
+ *		Index of function (i.e., STATISTICS_FUNCTION_*) or -1 if call is not
+ *		recorded.
+ *	int pair:
+ *		Index of working pair in trace.
+ *	int no_arguments:
+ *		Number of inputs.
+ *	int iterations:
+ *		Iterations of calling thread at beginning of call.
+ *	unsigned long long start_ns:
+ *		Time at beginning of call in ns.
+ *	double arguments[]:
+ *		Inputs of call.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/*
+ * TracePair:
+ * ----------
+ *
+ * Contains names and numbers of equations identifying a working pair of a
+ * trace. Thus, the working pair can be created again when replaying a trace.
+ *
+ * Attributes:
+ * -----------
+ *	char wp_as[]:
+ *		Name of sorbent.
+ *	char wp_st[]:
+ *		Name of sub-type of sorbent.
+ *	char wp_rf[]:
+ *		Name of refrigerant.
+ *	char wp_iso[]:
+ *		Name of isotherm.
+ *	char rf_psat[]:
+ *		Name of calculation approach for vapor pressure.
+ *	char rf_rhol[]:
+ *		Name of calculation approach for liquid density.
+ *	int no_iso:
+ *		ID of isotherm.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation.
+ *	int no_rhol:
+ *		ID of liquid density equation.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/*
+ * TraceRecord:
+ * ------------
+ *
+ * Contains a recorded call. Records have a fixed size of 88 bytes and are
+ * written to trace files without conversion (i.e., in native byte order).
+ *
+ * Attributes:
+ * -----------
+ *	unsigned short function:
+ *		Index of function in table of function names of trace.
+ *	unsigned short pair:
+ *		Index of working pair in table of working pairs of trace.
+ *	unsigned short no_arguments:
+ *		Number of inputs.
+ *	unsigned short iterations:
+ *		Number of iterations of solvers required by call (i.e., limited to
+ *		65535).
+ *	unsigned int thread:
+ *		Identifier of thread that executed call.
+ *	unsigned int time_ns:
+ *		Duration of call in ns (i.e., limited to about 4.3 s).
+ *	double arguments[]:
+ *		Inputs of call.
+ *	double result:
+ *		Result of call.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/*
+ * TraceFile:
+ * ----------
+ *
+ * Contains content of a trace file.
+ *
+ * Attributes:
+ * -----------
+ *	int no_functions:
+ *		Number of function names.
+ *	int no_pairs:
+ *		Number of working pairs.
+ *	unsigned long long no_records:
+ *		Number of recorded calls.
+ *	unsigned long long no_calls:
+ *		Number of calls during recording (i.e., greater than no_records if
+ *		ring buffer overflowed).
+ *	char (*functions)[]:
+ *		Malloc-ed array containing names of functions.
+ *	TracePair *pairs:
+ *		Malloc-ed array containing working pairs.
+ *	TraceRecord *records:
+ *		Malloc-ed array containing recorded calls in chronological order.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/////////////////////////////
+// Definition of variables //
+/////////////////////////////
+/*
+ * Ring buffer of all threads: Each call reserves its record by incrementing
+ * the position atomically. Thus, threads do not wait for each other when
+ * recording calls.
+ *
+ */
+TraceRecord *trace_records = NULL;
+unsigned long long trace_capacity = 0;
+unsigned long long trace_position = 0;
+long trace_active = 0;
+long trace_initialized = 0;
+
+/*
+ * Working pairs of trace and map from pointers of working pairs to working
+ * pairs of trace: Both are only changed when holding the lock. The generation
+ * changes when a working pair is deleted and invalidates the maps of all
+ * threads.
+ *
+ */
+TracePair trace_pairs[TRACE_NO_PAIRS];
+int trace_no_pairs = 0;
+void *trace_keys[TRACE_NO_KEYS];
+int trace_keys_pairs[TRACE_NO_KEYS];
+long trace_lock = 0;
+long trace_generation = 0;
+
+/*
+ * Map of last working pair, number of iterations of solvers, and identifier of
+ * each thread.
+ *
+ */
+THREAD_LOCAL void *trace_last_key = NULL;
+THREAD_LOCAL long trace_last_generation = -1;
+THREAD_LOCAL int trace_last_pair = -1;
+THREAD_LOCAL int trace_iterations = 0;
+THREAD_LOCAL unsigned int trace_thread = 0;
+long trace_no_threads = 0;
+
+/*
+ * Path of trace file given by environment variable SORP_TRACE_FILE.
+ *
+ */
+char *trace_path = NULL;
+
+/*
+ * Names of recorded functions in order of their indices.
+ *
+ */
+const char *trace_names_functions[] = {
+	STATISTICS_FUNCTIONS(TRACE_NAME)
+};
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * trace_exit:
+ * -----------
+ *
+ * Auxiliary function saving trace to file given by environment variable
+ * SORP_TRACE_FILE when program exits.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void trace_exit(void) {
+	if (trace_path != NULL) {
+		sorp_trace_save(trace_path);
+		free(trace_path);
+		trace_path = NULL;
+	}
+}
+
+
+/*
+ * trace_initialize:
+ * -----------------
+ *
+ * Auxiliary function starting recording when first call is traced if the
+ * environment variable SORP_TRACE_FILE is set. The capacity of the ring buffer
+ * is given by the environment variable SORP_TRACE_CAPACITY or TRACE_CAPACITY.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void trace_initialize(void) {
+	// Only first thread checks environment variables
+	//
+	if (TRACE_EXCHANGE(&trace_initialized, 1) != 0) {
+		return;
+	}
+
+	const char *path = getenv("SORP_TRACE_FILE");
+	const char *capacity = getenv("SORP_TRACE_CAPACITY");
+
+	if (path == NULL || path[0] == '\0') {
+		return;
+	}
+
+	trace_path = (char *) malloc((strlen(path) + 1) * sizeof(char));
+
+	if (trace_path == NULL) {
+		return;
+	}
+	strcpy(trace_path, path);
+
+	if (sorp_trace_start((capacity == NULL) ? TRACE_CAPACITY :
+		atoi(capacity)) == 0) {
+		atexit(&trace_exit);
+	}
+}
+
+
+/*
+ * trace_copy_name:
+ * ----------------
+ *
+ * Auxiliary function copying name into string of fixed length. Longer names
+ * are truncated.
+ *
+ * Parameters:
+ * -----------
+ *	char *name_trace:
+ *		String of length TRACE_LENGTH_NAME.
+ *	const char *name:
+ *		Name to be copied.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void trace_copy_name(char *name_trace, const char *name) {
+	if (name != NULL) {
+		strncpy(name_trace, name, TRACE_LENGTH_NAME - 1);
+	}
+	name_trace[TRACE_LENGTH_NAME - 1] = '\0';
+}
+
+
+/*
+ * trace_pair:
+ * -----------
+ *
+ * Auxiliary function returning index of working pair in trace. Working pairs
+ * are identified by their names. Thus, clones of working pairs used by several
+ * threads and working pairs created for each call of direct functions are the
+ * same working pair of the trace.
+ *
+ * Parameters:
+ * -----------
+ *	WorkingPair *workingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns index of working pair or -1 if trace contains already
+ *		TRACE_NO_PAIRS working pairs.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int trace_pair(WorkingPair *workingPair) {
+	// Check map of last working pair of calling thread first
+	//
+	long generation = TRACE_LOAD(&trace_generation);
+
+	if (workingPair == trace_last_key &&
+		generation == trace_last_generation) {
+		return trace_last_pair;
+	}
+
+	// Search pointer in map of all threads and, afterwards, names in working
+	// pairs of trace
+	//
+	int pair = -1;
+	int key_free = -1;
+
+	SPINLOCK_ACQUIRE(&trace_lock);
+	for (int i = 0; i < TRACE_NO_KEYS; i++) {
+		if (trace_keys[i] == workingPair) {
+			pair = trace_keys_pairs[i];
+			break;
+
+		} else if (trace_keys[i] == NULL && key_free < 0) {
+			key_free = i;
+
+		}
+	}
+
+	if (pair < 0) {
+		TracePair candidate;
+		memset(&candidate, 0, sizeof(TracePair));
+
+		trace_copy_name(candidate.wp_as, workingPair->wp_as);
+		trace_copy_name(candidate.wp_st, workingPair->wp_st);
+		trace_copy_name(candidate.wp_rf, workingPair->wp_rf);
+		trace_copy_name(candidate.wp_iso, workingPair->wp_iso);
+		trace_copy_name(candidate.rf_psat, workingPair->rf_psat);
+		trace_copy_name(candidate.rf_rhol, workingPair->rf_rhol);
+		candidate.no_iso = workingPair->no_iso;
+		candidate.no_p_sat = workingPair->no_p_sat;
+		candidate.no_rhol = workingPair->no_rhol;
+
+		for (int i = 0; i < trace_no_pairs; i++) {
+			if (memcmp(&trace_pairs[i], &candidate, sizeof(TracePair)) == 0) {
+				pair = i;
+				break;
+			}
+		}
+
+		if (pair < 0 && trace_no_pairs < TRACE_NO_PAIRS) {
+			pair = trace_no_pairs++;
+			trace_pairs[pair] = candidate;
+		}
+
+		if (pair >= 0 && key_free >= 0) {
+			trace_keys[key_free] = workingPair;
+			trace_keys_pairs[key_free] = pair;
+		}
+	}
+	SPINLOCK_RELEASE(&trace_lock);
+
+	// Update map of last working pair of calling thread
+	//
+	trace_last_key = workingPair;
+	trace_last_generation = generation;
+	trace_last_pair = pair;
+
+	return pair;
+}
+
+
+/*
+ * trace_begin:
+ * ------------
+ *
+ * Auxiliary function storing inputs of a call if recording is active. Function
+ * is called by macro TRACE_BEGIN.
+ *
+ * Parameters:
+ * -----------
+ *	TraceCall *call:
+ *		Pointer of TraceCall-struct of calling function.
+ *	int function:
+ *		Index of function (i.e., STATISTICS_FUNCTION_*).
+ *	void *workingPair:
+ *		Pointer of WorkingPair-struct.
+ *	const double *arguments:
+ *		Array containing inputs of call.
+ *	int no_arguments:
+ *		Number of inputs.
+ *
+ * Remarks:
+ * --------
+ *	Recording is started when the first call is traced if the environment
+ *	variable SORP_TRACE_FILE is set. Then, the trace is saved to this file when
+ *	the program exits.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void trace_begin(TraceCall *call, int function, void *workingPair,
+	const double *arguments, int no_arguments) {
+	call->function = -1;
+
+	if (TRACE_LOAD(&trace_initialized) == 0) {
+		trace_initialize();
+	}
+
+	// Calls without working pair cannot be replayed and are not recorded
+	//
+	if (TRACE_LOAD(&trace_active) == 0 || workingPair == NULL) {
+		return;
+	}
+
+	int pair = trace_pair((WorkingPair *) workingPair);
+
+	if (pair < 0) {
+		return;
+	}
+
+	call->function = function;
+	call->pair = pair;
+	call->no_arguments = (no_arguments > TRACE_NO_ARGUMENTS) ?
+		TRACE_NO_ARGUMENTS : no_arguments;
+	call->iterations = trace_iterations;
+
+	memset(call->arguments, 0, TRACE_NO_ARGUMENTS * sizeof(double));
+	memcpy(call->arguments, arguments, call->no_arguments * sizeof(double));
+
+	call->start_ns = statistics_now_ns();
+}
+
+
+/*
+ * trace_end:
+ * ----------
+ *
+ * Auxiliary function writing a call and its result into the ring buffer.
+ * Function is called by macro TRACE_RETURN.
+ *
+ * Parameters:
+ * -----------
+ *	TraceCall *call:
+ *		Pointer of TraceCall-struct of calling function.
+ *	double value:
+ *		Value returned by function.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns value given as input.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double trace_end(TraceCall *call, double value) {
+	if (call->function < 0) {
+		return value;
+	}
+
+	unsigned long long time_ns = statistics_now_ns() - call->start_ns;
+	int iterations = trace_iterations - call->iterations;
+
+	if (trace_thread == 0) {
+		trace_thread = (unsigned int) TRACE_INCREMENT(&trace_no_threads);
+	}
+
+	// Reserve record: If ring buffer is full, oldest record is overwritten
+	//
+	unsigned long long position = TRACE_FETCH_ADD(&trace_position, 1);
+	TraceRecord *record = &trace_records[position % trace_capacity];
+
+	record->function = (unsigned short) call->function;
+	record->pair = (unsigned short) call->pair;
+	record->no_arguments = (unsigned short) call->no_arguments;
+	record->iterations = (unsigned short) ((iterations > 65535) ? 65535 :
+		iterations);
+	record->thread = trace_thread;
+	record->time_ns = (unsigned int) ((time_ns > 4294967295ULL) ?
+		4294967295ULL : time_ns);
+	memcpy(record->arguments, call->arguments,
+		TRACE_NO_ARGUMENTS * sizeof(double));
+	record->result = value;
+
+	return value;
+}
+
+
+/*
+ * trace_solver:
+ * -------------
+ *
+ * Auxiliary function adding iterations of a solver to the iterations of the
+ * calling thread. Function is called by macro TRACE_SOLVER.
+ *
+ * Parameters:
+ * -----------
+ *	int iterations:
+ *		Number of iterations.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void trace_solver(int iterations) {
+	if (iterations > 0) {
+		trace_iterations += iterations;
+	}
+}
+
+
+/*
+ * trace_delete:
+ * -------------
+ *
+ * Auxiliary function forgetting pointer of a working pair that is deleted.
+ * Thus, a new working pair allocated at the same address is identified by its
+ * names again. Function is called by macro TRACE_DELETE.
+ *
+ * Parameters:
+ * -----------
+ *	void *workingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void trace_delete(void *workingPair) {
+	SPINLOCK_ACQUIRE(&trace_lock);
+	for (int i = 0; i < TRACE_NO_KEYS; i++) {
+		if (trace_keys[i] == workingPair) {
+			trace_keys[i] = NULL;
+		}
+	}
+	TRACE_INCREMENT(&trace_generation);
+	SPINLOCK_RELEASE(&trace_lock);
+}
+
+
+/*
+ * sorp_trace_enabled:
+ * -------------------
+ *
+ * Returns flag indicating whether recording of calls is compiled.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 1 if library is compiled with SORP_TRACE and 0 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int sorp_trace_enabled(void) {
+#ifdef SORP_TRACE
+	return 1;
+#else
+	return 0;
+#endif
+}
+
+
+/*
+ * sorp_trace_start:
+ * -----------------
+ *
+ * Starts recording of calls into a new ring buffer. If the ring buffer is full,
+ * the oldest calls are overwritten.
+ *
+ * Parameters:
+ * -----------
+ *	int capacity:
+ *		Number of calls stored by ring buffer.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if recording is started and -1 otherwise.
+ *
+ * Remarks:
+ * --------
+ *	Function must not be called while other threads call functions of the
+ *	library.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int sorp_trace_start(int capacity) {
+	// Check if recording is compiled and capacity is valid
+	//
+	if (!sorp_trace_enabled()) {
+		if (status_report(STATUS_NOT_IMPLEMENTED, "sorp_trace_start", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nLibrary is not compiled with SORP_TRACE. Calls cannot be "
+				"recorded.");
+		}
+		return -1;
+
+	} else if (capacity < 1) {
+		if (status_report(STATUS_INVALID_INPUT, "sorp_trace_start", 0,
+			capacity)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCapacity of ring buffer must be positive.");
+		}
+		return -1;
+
+	}
+
+	// Stop recording and replace ring buffer
+	//
+	TRACE_STORE(&trace_active, 0);
+	TRACE_STORE(&trace_initialized, 1);
+
+	TraceRecord *records = (TraceRecord *) malloc((size_t) capacity *
+		sizeof(TraceRecord));
+
+	if (records == NULL) {
+		if (status_report(STATUS_NO_MEMORY, "sorp_trace_start", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for ring buffer of trace.");
+		}
+		return -1;
+	}
+
+	free(trace_records);
+	trace_records = records;
+	trace_capacity = (unsigned long long) capacity;
+	trace_position = 0;
+
+	// Forget working pairs of previous trace
+	//
+	SPINLOCK_ACQUIRE(&trace_lock);
+	trace_no_pairs = 0;
+
+	for (int i = 0; i < TRACE_NO_KEYS; i++) {
+		trace_keys[i] = NULL;
+	}
+	TRACE_INCREMENT(&trace_generation);
+	SPINLOCK_RELEASE(&trace_lock);
+
+	TRACE_STORE(&trace_active, 1);
+	return 0;
+}
+
+
+/*
+ * sorp_trace_stop:
+ * ----------------
+ *
+ * Stops recording of calls. Recorded calls are kept until recording is started
+ * again.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void sorp_trace_stop(void) {
+	TRACE_STORE(&trace_active, 0);
+}
+
+
+/*
+ * sorp_trace_no_records:
+ * ----------------------
+ *
+ * Returns number of calls stored by ring buffer.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Number of stored calls.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double sorp_trace_no_records(void) {
+	unsigned long long position = TRACE_FETCH_ADD(&trace_position, 0);
+
+	return (double) ((position < trace_capacity) ? position :
+		trace_capacity);
+}
+
+
+/*
+ * sorp_trace_save:
+ * ----------------
+ *
+ * Writes recorded calls in chronological order to binary trace file. File
+ * contains header, table of function names, table of working pairs, and
+ * records (see TraceRecord).
+ *
+ * Parameters:
+ * -----------
+ *	const char *path:
+ *		Path of trace file.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if trace is written and -1 otherwise.
+ *
+ * Remarks:
+ * --------
+ *	Function should not be called while other threads call functions of the
+ *	library. Otherwise, calls in progress may be written incompletely.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int sorp_trace_save(const char *path) {
+	// Open file
+	//
+	FILE *fp = NULL;
+
+	if (path != NULL) {
+		#ifdef __unix
+		fp = fopen(path, "wb");
+		#else
+		if (fopen_s(&fp, path, "wb") != 0) {
+			fp = NULL;
+		}
+		#endif
+	}
+
+	// Write header: Magic number, version, numbers of functions and working
+	// pairs, numbers of records and of all calls
+	//
+	int error = (fp == NULL);
+
+	if (!error) {
+		unsigned long long no_calls = TRACE_FETCH_ADD(&trace_position, 0);
+		unsigned long long no_records = (no_calls < trace_capacity) ?
+			no_calls : trace_capacity;
+
+		char magic[8] = TRACE_MAGIC;
+		char name[TRACE_LENGTH_NAME];
+		unsigned int header[4] = {TRACE_VERSION, STATISTICS_NO_FUNCTIONS, 0,
+			0};
+		unsigned long long counts[2] = {no_records, no_calls};
+		TracePair pairs[TRACE_NO_PAIRS];
+
+		SPINLOCK_ACQUIRE(&trace_lock);
+		header[2] = (unsigned int) trace_no_pairs;
+		memcpy(pairs, trace_pairs, trace_no_pairs * sizeof(TracePair));
+		SPINLOCK_RELEASE(&trace_lock);
+
+		error |= (fwrite(magic, sizeof(char), 8, fp) != 8);
+		error |= (fwrite(header, sizeof(unsigned int), 4, fp) != 4);
+		error |= (fwrite(counts, sizeof(unsigned long long), 2, fp) != 2);
+
+		// Write table of function names and table of working pairs
+		//
+		for (int i = 0; i < STATISTICS_NO_FUNCTIONS; i++) {
+			memset(name, 0, TRACE_LENGTH_NAME * sizeof(char));
+			trace_copy_name(name, trace_names_functions[i]);
+
+			error |= (fwrite(name, sizeof(char), TRACE_LENGTH_NAME, fp) !=
+				TRACE_LENGTH_NAME);
+		}
+		error |= (fwrite(pairs, sizeof(TracePair), header[2], fp) !=
+			header[2]);
+
+		// Write records in chronological order: Oldest record follows newest
+		// record if ring buffer overflowed
+		//
+		unsigned long long first = (no_calls - no_records) % trace_capacity;
+		unsigned long long no_first = (first + no_records > trace_capacity) ?
+			trace_capacity - first : no_records;
+
+		if (no_records > 0) {
+			error |= (fwrite(&trace_records[first], sizeof(TraceRecord),
+				(size_t) no_first, fp) != (size_t) no_first);
+			error |= (fwrite(trace_records, sizeof(TraceRecord),
+				(size_t) (no_records - no_first), fp) !=
+				(size_t) (no_records - no_first));
+		}
+	}
+
+	if (fp != NULL) {
+		error = (fclose(fp) != 0) || error;
+	}
+
+	if (error) {
+		if (status_report(STATUS_INVALID_INPUT, "sorp_trace_save", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot write trace to file \"%s\".",
+				(path == NULL) ? "NULL" : path);
+		}
+		return -1;
+	}
+
+	return 0;
+}
+
+
+/*
+ * newTraceFile:
+ * -------------
+ *
+ * Reads binary trace file written by sorp_trace_save.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path:
+ *		Path of trace file.
+ *
+ * Returns:
+ * --------
+ *	struct *TraceFile:
+ *		Returns pointer of TraceFile-struct or NULL if file cannot be read.
+ *
+ * Remarks:
+ * --------
+ *	Trace file must be deleted by delTraceFile.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API TraceFile *newTraceFile(const char *path) {
+	// Try to allocate memory for struct and to open file
+	//
+	TraceFile *retTraceFile = (TraceFile *) calloc(1, sizeof(TraceFile));
+
+	if (retTraceFile == NULL) {
+		if (status_report(STATUS_NO_MEMORY, "newTraceFile", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for TraceFile-struct.");
+		}
+		return NULL;
+	}
+
+	FILE *fp = NULL;
+
+	if (path != NULL) {
+		#ifdef __unix
+		fp = fopen(path, "rb");
+		#else
+		if (fopen_s(&fp, path, "rb") != 0) {
+			fp = NULL;
+		}
+		#endif
+	}
+
+	// Read and check header
+	//
+	char magic[8];
+	unsigned int header[4] = {0, 0, 0, 0};
+	unsigned long long counts[2] = {0, 0};
+
+	int error = (fp == NULL);
+	error = error || (fread(magic, sizeof(char), 8, fp) != 8);
+	error = error || (fread(header, sizeof(unsigned int), 4, fp) != 4);
+	error = error || (fread(counts, sizeof(unsigned long long), 2, fp) != 2);
+	error = error || (memcmp(magic, TRACE_MAGIC, 8) != 0) ||
+		(header[0] != TRACE_VERSION) || (header[1] > 65536) ||
+		(header[2] > 65536) || (counts[0] > counts[1]);
+
+	// Read tables and records
+	//
+	if (!error) {
+		retTraceFile->no_functions = (int) header[1];
+		retTraceFile->no_pairs = (int) header[2];
+		retTraceFile->no_records = counts[0];
+		retTraceFile->no_calls = counts[1];
+
+		retTraceFile->functions = (char (*)[TRACE_LENGTH_NAME]) malloc(
+			(header[1] + 1) * TRACE_LENGTH_NAME * sizeof(char));
+		retTraceFile->pairs = (TracePair *) malloc((header[2] + 1) *
+			sizeof(TracePair));
+		retTraceFile->records = (TraceRecord *) malloc((size_t) (counts[0] +
+			1) * sizeof(TraceRecord));
+
+		error = (retTraceFile->functions == NULL ||
+			retTraceFile->pairs == NULL || retTraceFile->records == NULL);
+	}
+
+	error = error || (fread(retTraceFile->functions, TRACE_LENGTH_NAME,
+		header[1], fp) != header[1]);
+	error = error || (fread(retTraceFile->pairs, sizeof(TracePair),
+		header[2], fp) != header[2]);
+	error = error || (fread(retTraceFile->records, sizeof(TraceRecord),
+		(size_t) counts[0], fp) != (size_t) counts[0]);
+
+	// Check records and terminate strings
+	//
+	for (unsigned long long i = 0; !error && i < counts[0]; i++) {
+		TraceRecord *record = &retTraceFile->records[i];
+
+		error = (record->function >= header[1]) ||
+			(record->pair >= header[2]) ||
+			(record->no_arguments > TRACE_NO_ARGUMENTS);
+	}
+
+	for (unsigned int i = 0; !error && i < header[1]; i++) {
+		retTraceFile->functions[i][TRACE_LENGTH_NAME - 1] = '\0';
+	}
+
+	if (fp != NULL) {
+		fclose(fp);
+	}
+
+	if (error) {
+		if (status_report(STATUS_INVALID_INPUT, "newTraceFile", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot read trace file \"%s\".",
+				(path == NULL) ? "NULL" : path);
+		}
+		delTraceFile(retTraceFile);
+		return NULL;
+	}
+
+	return retTraceFile;
+}
+
+
+/*
+ * delTraceFile:
+ * -------------
+ *
+ * Frees memory of TraceFile-struct.
+ *
+ * Parameters:
+ * -----------
+ *	void *traceFile:
+ *		Pointer of TraceFile-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void delTraceFile(void *traceFile) {
+	TraceFile *retTraceFile = (TraceFile *) traceFile;
+
+	if (retTraceFile != NULL) {
+		free(retTraceFile->functions);
+		free(retTraceFile->pairs);
+		free(retTraceFile->records);
+		free(retTraceFile);
+	}
+}
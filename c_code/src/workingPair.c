@@ -1,17 +1,103 @@
 ///////////////////
 // workingPair.c //
 ///////////////////
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#ifndef __unix
+#include <malloc.h>
+#endif
 #include "absorption.h"
 #include "adsorption.h"
 #include "cJSON.h"
+#include "database.h"
 #include "json_interface.h"
+#include "referenceCounter.h"
 #include "refrigerant.h"
+#include "spinLock.h"
+#include "spline.h"
+#include "surrogate.h"
+#include "threadLocal.h"
 #include "workingPair.h"
+#include "statistics.h"
+#include "status.h"
 #include "structDefinitions.c"
 
 
+/////////////////////////////
+// Definition of constants //
+/////////////////////////////
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE 64
+#endif
+
+#ifndef WORKINGPAIR_BLOB_ID
+#define WORKINGPAIR_BLOB_ID 0x50575053
+#endif
+
+#ifndef WORKINGPAIR_BLOB_VERSION
+#define WORKINGPAIR_BLOB_VERSION 1
+#endif
+
+#ifndef WORKINGPAIR_BLOB_NO_HEADER
+#define WORKINGPAIR_BLOB_NO_HEADER 15
+#endif
+
+#ifndef WORKINGPAIR_TABLE_TOLERANCE
+#define WORKINGPAIR_TABLE_TOLERANCE 1e-4
+#endif
+
+#ifndef WORKINGPAIR_DERIVATIVE_STEP
+#define WORKINGPAIR_DERIVATIVE_STEP 1e-4
+#endif
+
+#ifndef WORKINGPAIR_DERIVATIVE_STEP_MIX
+#define WORKINGPAIR_DERIVATIVE_STEP_MIX 1e-3
+#endif
+
+
+/////////////////////////////
+// Definition of variables //
+/////////////////////////////
+/*
+ * Working pairs cached for functions working without WorkingPair-struct, spin
+ * lock protecting the cache, and flag indicating if caching is enabled.
+ *
+ */
+DirectWorkingPair *direct_workingPairs = NULL;
+long direct_lock = 0;
+int direct_cache = 1;
+
+
+/*
+ * Flag indicating if working pair returned by direct_workingPair to current
+ * thread is not cached and, thus, must be deleted by direct_release.
+ *
+ */
+THREAD_LOCAL int direct_not_cached = 0;
+
+
+/////////////////////////////////
+// Definition of static arrays //
+/////////////////////////////////
+/*
+ * Names of isotherm and refrigerant equations and numbers of coefficients
+ * indexed by their functions (i.e., number of keys of "_p_" in the database).
+ *
+ */
+static const char *workingPair_equations[] = {"DualSiteSips", "Langmuir",
+	"Toth", "Freundlich", "DubininAstakhov", "DubininArctan1", "Duehring",
+	"Antoine", "WilsonFixedDl", "WilsonTemperatureDl", "TsubokaKatayama",
+	"Heil", "WangChao", "NrtlFixedDg", "NrtlTemperatureDg", "UniquacFixedDu",
+	"UniquacTemperatureDu", "FloryHuggins", "MixingRule",
+	"VaporPressure_EoS1", "VaporPressure_EoS2", "VaporPressure_EoS3",
+	"VaporPressure_Antoine", "VaporPressure_EoSCubic",
+	"SaturatedLiquidDensity_EoS1"};
+static const int workingPair_equations_no_par[] = {9, 3, 7, 8, 4, 4, 15, 12,
+	6, 7, 4, 4, 5, 3, 5, 7, 9, 3, 23, 16, 13, 9, 3, 9, 19};
+
+
 ///////////////////////////
 // Definition of structs //
 ///////////////////////////
@@ -54,10 +140,145 @@
  *	Refrigerant *refrigerant:
  *		Struct containing function pointers for refrigerant functions.
  *
+ *	int no_iso_par:
+ *		Number of coefficients of isotherm.
+ *	int no_psat_par:
+ *		Number of coefficients of vapor pressure equation.
+ *	int no_rhol_par:
+ *		Number of coefficients of saturated liquid density equation.
+ *	int layout:
+ *		Memory layout of WorkingPair-struct (i.e., WORKINGPAIR_LAYOUT_STANDARD
+ *		or WORKINGPAIR_LAYOUT_COMPACT).
+ *
+ *	RefrigerantParameters *refrigerant_parameters:
+ *		Struct interned by database that owns coefficients of refrigerant
+ *		functions and Refrigerant-struct. NULL if working pair owns them.
+ *
+ *	WorkingPairSurrogate *surrogates:
+ *		Struct containing surrogates of equilibrium functions. NULL if
+ *		surrogates are disabled.
+ *	WorkingPairTable *tables:
+ *		Struct containing spline tables of equilibrium functions. NULL if
+ *		tables are disabled.
+ *
+ * Remarks:
+ * --------
+ *	All ads_*-, abs_*-, ref_*-, and tab_*-functions only read the struct.
+ *	Hence, several threads can evaluate the same WorkingPair-struct at the
+ *	same time. Functions enabling or disabling surrogates or tables change
+ *	the struct and must not be called while other threads use it.
+ *
  * History:
  * --------
  *	01/06/2020, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Added numbers of coefficients and memory layout.
+ *		Added interned refrigerant.
+ *		Added surrogates.
+ *		Added spline tables.
+ *		Added remarks on thread safety.
+ *
+ */
+
+
+/*
+ * WorkingPairSurrogate:
+ * ---------------------
+ *
+ * Contains surrogates of equilibrium functions of a working pair. Loading w
+ * denotes equilibrium loading for adsorption, concentration for conventional
+ * absorption, and mole fraction in liquid phase for absorption based on
+ * mixing rules. Pressure is approximated by its logarithm, and surrogates
+ * depending on pressure use logarithm of pressure as variable.
+ *
+ * Attributes:
+ * -----------
+ *	double p_min_Pa:
+ *		Lower limit of pressure in Pa.
+ *	double p_max_Pa:
+ *		Upper limit of pressure in Pa.
+ *	double T_min_K:
+ *		Lower limit of temperature in K.
+ *	double T_max_K:
+ *		Upper limit of temperature in K.
+ *	double w_min:
+ *		Lower limit of loading.
+ *	double w_max:
+ *		Upper limit of loading.
+ *
+ *	Surrogate2D *w_pT:
+ *		Surrogate of loading depending on pressure and temperature.
+ *	Surrogate2D *p_wT:
+ *		Surrogate of pressure depending on loading and temperature.
+ *	Surrogate2D *T_pw:
+ *		Surrogate of temperature depending on pressure and loading.
+ *	Surrogate2D *y_1_pT:
+ *		Surrogate of mole fraction of first component in vapor phase depending
+ *		on pressure and temperature (i.e., only for mixing rules).
+ *	Surrogate2D *y_1_wT:
+ *		Surrogate of mole fraction of first component in vapor phase depending
+ *		on loading and temperature (i.e., only for mixing rules).
+ *	Surrogate2D *y_1_pw:
+ *		Surrogate of mole fraction of first component in vapor phase depending
+ *		on pressure and loading (i.e., only for mixing rules).
+ *	Surrogate2D *y_2_pT:
+ *		Surrogate of mole fraction of second component in vapor phase depending
+ *		on pressure and temperature (i.e., only for mixing rules).
+ *	Surrogate2D *y_2_wT:
+ *		Surrogate of mole fraction of second component in vapor phase depending
+ *		on loading and temperature (i.e., only for mixing rules).
+ *	Surrogate2D *y_2_pw:
+ *		Surrogate of mole fraction of second component in vapor phase depending
+ *		on pressure and loading (i.e., only for mixing rules).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/*
+ * WorkingPairTable:
+ * -----------------
+ *
+ * Contains spline tables of equilibrium functions of a working pair whose
+ * values and partial derivatives at the nodes are calculated by the original
+ * equations and their analytical derivatives. Loading w denotes equilibrium
+ * loading for adsorption, concentration for conventional absorption, and mole
+ * fraction in liquid phase for absorption based on mixing rules. Pressure and
+ * loading span several orders of magnitude. Thus, both are tabulated and used
+ * as variables by their logarithms, and the lower limit of loading must be
+ * positive.
+ *
+ * Attributes:
+ * -----------
+ *	double p_min_Pa:
+ *		Lower limit of pressure in Pa.
+ *	double p_max_Pa:
+ *		Upper limit of pressure in Pa.
+ *	double T_min_K:
+ *		Lower limit of temperature in K.
+ *	double T_max_K:
+ *		Upper limit of temperature in K.
+ *	double w_min:
+ *		Lower limit of loading.
+ *	double w_max:
+ *		Upper limit of loading.
+ *
+ *	Spline2D *w_pT:
+ *		Spline of loading depending on pressure and temperature.
+ *	Spline2D *p_wT:
+ *		Spline of pressure depending on loading and temperature.
+ *	Spline2D *T_pw:
+ *		Spline of temperature depending on pressure and loading.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
  *
  */
 
@@ -110,11 +331,107 @@
  * --------
  *	01/06/2020, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Moved reading of coefficients to newWorkingPairDatabase.
  *
  */
 DLL_API WorkingPair *newWorkingPair(const char *path_db, const char *wp_as,
 	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
 	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Connect to JSON database and parse database's content to JSON-structs
+	//
+	Database *database = newDatabase(path_db);
+
+	if (database == NULL) {
+        return NULL;
+	}
+
+	// Create working pair: Interned refrigerant is kept alive by working pair
+	// after database is deleted
+	//
+	WorkingPair *retWorkingPair = newWorkingPairDatabase(database, wp_as,
+		wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat, rf_rhol, no_rhol);
+	delDatabase(database);
+
+	// Return structure
+	//
+	return retWorkingPair;
+}
+
+
+/*
+ * newWorkingPairDatabase:
+ * -----------------------
+ *
+ * Initialization function to create a new WorkingPair-struct from a database
+ * that is already read and parsed. Therefore, function checks first if enough
+ * memory available to allocate WorkingPair-struct and then reads coefficients
+ * of isotherm from database. Coefficients of refrigerant functions and the
+ * Refrigerant-struct are interned by the database and shared read-only by all
+ * working pairs using the same refrigerant, calculation approaches, and IDs of
+ * equations. If memory allocation fails, functions returns NULL and prints a
+ * warning.
+ *
+ * Parameters:
+ * -----------
+ *	struct *Database:
+ *		Pointer of Database-struct.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	struct *WorkingPair:
+ *		Returns malloc-ed WorkingPair-struct containing all information required
+ *		to calculate the resorption equilibrium of the working working.
+ *
+ * Remarks:
+ * --------
+ *	Working pair can be used after deleting the database. Because the vapor
+ *	pressure of interned refrigerants is cached per thread, evaluating many
+ *	working pairs with the same refrigerant at the same temperature calculates
+ *	the vapor pressure only once. Function can be called by several threads
+ *	for the same database at the same time.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API WorkingPair *newWorkingPairDatabase(Database *database,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol) {
+	// Check if database exists
+	//
+	if (database == NULL) {
+		if (status_report(STATUS_INVALID_STRUCT, "newWorkingPairDatabase",
+			0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nDatabase-struct does not exist.");
+		}
+		return NULL;
+	}
+
     // Try to allocate memory for WorkingPair-struct
 	//
     WorkingPair *retWorkingPair = (WorkingPair *) malloc(sizeof(WorkingPair));
@@ -122,8 +439,10 @@ DLL_API WorkingPair *newWorkingPair(const char *path_db, const char *wp_as,
     if (retWorkingPair == NULL) {
 		// Not enough memory available for WorkingPair-struct
 		//
-		printf("\n\n###########\n# Warning #\n###########");
-		printf("\nCannot allocate memory for WorkingPair-struct.");
+		if (status_report(STATUS_NO_MEMORY, "newWorkingPairDatabase", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for WorkingPair-struct.");
+		}
         return NULL;
 	}
 
@@ -138,168 +457,84 @@ DLL_API WorkingPair *newWorkingPair(const char *path_db, const char *wp_as,
 	retWorkingPair->no_iso = no_iso;
 	retWorkingPair->no_p_sat = no_p_sat;
 	retWorkingPair->no_rhol = no_rhol;
-
-	// Connect to JSON database and parse database's content to JSON-structs
-	//
-	char *json_content = json_read_file(path_db);
-    if (json_content == NULL) {
-		// If connection to database fails, free memory
-		//
-		printf("\n\n###########\n# Error #\n###########");
-		printf("\nCannot read JSON database! See warnings printed before!");
-		free(retWorkingPair);
-        return NULL;
-	}
-
-	cJSON *json_file = json_parse_file(json_content);
-    if (json_file == NULL) {
-		// If content of database cannot be parsed to JSON-struct, free memory
-		//
-		printf("\n\n###########\n# Error #\n###########");
-		printf("\nCannot work with JSON-structs! See warnings printed before!");
-		free(json_content);
-		free(retWorkingPair);
-        return NULL;
-	}
+	retWorkingPair->layout = WORKINGPAIR_LAYOUT_STANDARD;
+	retWorkingPair->surrogates = NULL;
+	retWorkingPair->tables = NULL;
 
 	// First, read coefficients for isotherm equation
 	//
 	int wp_tp;
 	cJSON *json_isotherm = json_search_equation(wp_as, wp_st, wp_rf, &wp_tp,
-		json_file);
+		database->json_file);
 
     if (json_isotherm == NULL) {
 		// Cannot select isotherm, free memory
 		//
-		printf("\n\n###########\n# Error #\n###########");
-		printf("\nCannot get coefficients of isotherm! See warnings printed "
-			"before!");
-		free(json_file);
-		free(json_content);
+		if (status_report(STATUS_DATABASE, "newWorkingPairDatabase", 0, 0)) {
+			printf("\n\n###########\n# Error #\n###########");
+			printf("\nCannot get coefficients of isotherm! See warnings "
+				"printed before!");
+		}
 		free(retWorkingPair);
         return NULL;
 	}
 
-	retWorkingPair->iso_par = json_search_parameters(wp_iso, no_iso,
-		json_isotherm);
+	retWorkingPair->iso_par = json_search_parameters(
+		&retWorkingPair->no_iso_par, wp_iso, no_iso, json_isotherm);
     if (retWorkingPair->iso_par == NULL) {
 		// Cannot select coefficients of isotherm, free memory
 		//
-		printf("\n\n###########\n# Error #\n###########");
-		printf("\nCannot save coefficients of isotherm! See warnings printed "
-			"before!");
-		free(json_file);
-		free(json_content);
+		if (status_report(STATUS_DATABASE, "newWorkingPairDatabase", 0, 0)) {
+			printf("\n\n###########\n# Error #\n###########");
+			printf("\nCannot save coefficients of isotherm! See warnings "
+				"printed before!");
+		}
 		free(retWorkingPair);
         return NULL;
 	}
 
-	// Second, read coefficients for refrigerant equations
+	// Second, get coefficients for refrigerant equations interned by database
 	// If equations are not implemented, throw warning but do not fail as not
 	// all isotherms need refrigerant properties
 	//
-	int rf_tp;
-	cJSON *json_refrigerant = json_search_equation("dum_sorb", "dum_subtype",
-		wp_rf, &rf_tp, json_file);
+	retWorkingPair->refrigerant_parameters = database_refrigerant_parameters(
+		database, wp_rf, rf_psat, no_p_sat, rf_rhol, no_rhol);
 
-    if (json_refrigerant == NULL) {
-		// Cannot select refrigerant, free memory
+    if (retWorkingPair->refrigerant_parameters == NULL) {
+		// Cannot select refrigerant, thus working pair creates its own
+		// Refrigerant-struct without refrigerant functions
 		//
-		printf("\n\n###########\n# Warning #\n###########");
-		printf("\nCannot select refrigerant \"%s\" required for calculating "
-			"fluid properties.", wp_rf);
 		retWorkingPair->psat_par = NULL;
 		retWorkingPair->rhol_par = NULL;
+		retWorkingPair->no_psat_par = 0;
+		retWorkingPair->no_rhol_par = 0;
 
 	} else {
-		// Select coefficients for vapor pressure and saturated liquid density:
+		// Share coefficients for vapor pressure and saturated liquid density:
 		// If function and thus coefficients are not implemented, pointer is
 		// set to NULL
 		//
-		retWorkingPair->psat_par = json_search_parameters(rf_psat, no_p_sat,
-			json_refrigerant);
-		retWorkingPair->rhol_par = json_search_parameters(rf_rhol, no_rhol,
-			json_refrigerant);
+		retWorkingPair->psat_par =
+			retWorkingPair->refrigerant_parameters->psat_par;
+		retWorkingPair->rhol_par =
+			retWorkingPair->refrigerant_parameters->rhol_par;
+		retWorkingPair->no_psat_par =
+			retWorkingPair->refrigerant_parameters->no_psat_par;
+		retWorkingPair->no_rhol_par =
+			retWorkingPair->refrigerant_parameters->no_rhol_par;
 	}
 
-	// Free memory that is not needed anymore
-	//
-	free(json_file);
-	free(json_content);
-
-	// Check which equations of states exists for initialization of
-	// "Refrigerant"-struct
-	//
-	const char *rf_psat_int = (retWorkingPair->psat_par == NULL) ?
-		"NoVaporPressure" : rf_psat;
-	const char *rf_rhol_int= (retWorkingPair->rhol_par == NULL) ?
-		"NoSaturatedLiquidDensity" : rf_rhol;
-
-	// Initialize structs containing isotherm functions
+	// Initialize structs containing isotherm and refrigerant functions
 	//
-	if (wp_tp == 1) {
-		// Adsorption equations
-		//
-		retWorkingPair->adsorption = newAdsorption(wp_iso);
-		retWorkingPair->absorption = NULL;
-		if (retWorkingPair->adsorption == NULL) {
-			// Cannot create Adsorption-struct, free memory
-			//
-			printf("\n\n###########\n# Error #\n###########");
-			printf("\nCannot create Adsorption-struct within "
-				"WorkingPair-struct!");
-			printf("\nTherefore, cannot execute isotherm functions!");
-			free(retWorkingPair);
-			return NULL;
-		}
-
-	} else if (wp_tp == 2) {
-		// Absorption equations
-		//
-		retWorkingPair->absorption = newAbsorption(wp_iso,
-			retWorkingPair->iso_par);
-		retWorkingPair->adsorption = NULL;
-		if (retWorkingPair->absorption == NULL) {
-			// Cannot create Absorption-struct, free memory
-			//
-			printf("\n\n###########\n# Error #\n###########");
-			printf("\nCannot create Absorption-struct within "
-				"WorkingPair-struct!");
-			printf("\nTherefore, cannot execute isotherm functions!");
-			free(retWorkingPair);
-			return NULL;
-		}
-
-	} else {
-		// Neither adsorption nor absorption: Something went wrong!
+	if (init_workingPair_structs(retWorkingPair, wp_tp) == -1) {
+		// Cannot create structs, free memory
 		//
-		printf("\n\n###########\n# Error #\n###########");
-		printf("\nDo not know whether to create Adsorption- or "
-			"Absorption-struct! This should not happen: Most likely, the "
-			"column 'type' is wrong within the JSON database.");
-		printf("\nTherefore, cannot execute isotherm functions!");
+		delRefrigerantParameters(retWorkingPair->refrigerant_parameters);
+		free(retWorkingPair->iso_par);
 		free(retWorkingPair);
 		return NULL;
-
-	}
-
-	retWorkingPair->refrigerant = newRefrigerant(rf_psat_int, rf_rhol_int,
-		retWorkingPair->psat_par);
-    if (retWorkingPair->refrigerant == NULL) {
-		// Cannot create "Refrigerant"-struct, free memory
-		//
-		printf("\n\n###########\n# Error #\n###########");
-		printf("\nCannot create Refrigerant-struct within WorkingPair-struct!");
-		printf("\nTherefore, cannot execute refrigerant functions!");
-		free(retWorkingPair);
-        return NULL;
 	}
 
-	// Avoid compiler warning C4100 by adding "do nothing" expression
-	// "Do nothing" expression will be optimized out by compiler
-	//
-	(rf_tp) = (rf_tp);
-
 	// Return structure
 	//
 	return retWorkingPair;
@@ -321,6 +556,11 @@ DLL_API WorkingPair *newWorkingPair(const char *path_db, const char *wp_as,
  * --------
  *	01/06/2020, by Mirko Engelpracht:
  *		First implementation.
+ *	10/18/2026, by agent:
+ *		Added compact memory layout.
+ *		Added interned refrigerant.
+ *		Added surrogates.
+ *		Added spline tables.
  *
  */
 DLL_API void delWorkingPair(void *workingPair) {
@@ -331,25 +571,48 @@ DLL_API void delWorkingPair(void *workingPair) {
     // Because of initialization function, workingPair is NULL or fully built
 	//
     if (retWorkingPair != NULL) {
-		// Free allocated memory of structs containing function pointers
+		// Forget working pair when recording calls
+		//
+		TRACE_DELETE(retWorkingPair);
+
+		// Free allocated memory of surrogates and tables that are owned by
+		// working pair
+		//
+		disableWorkingPairSurrogate(retWorkingPair);
+		disableWorkingPairTable(retWorkingPair);
+
+		// Compact memory layout consists of one memory block only
 		//
-		delRefrigerant(retWorkingPair->refrigerant);
+		if (retWorkingPair->layout == WORKINGPAIR_LAYOUT_COMPACT) {
+			free_aligned(retWorkingPair);
+			return;
+		}
 
+		// Free allocated memory of structs containing function pointers
+		//
 		if (retWorkingPair->absorption != NULL) {
-			delAdsorption(retWorkingPair->absorption);
+			delAbsorption(retWorkingPair->absorption);
 		}
 		if (retWorkingPair->adsorption != NULL) {
 			delAdsorption(retWorkingPair->adsorption);
 		}
 
-		// Free allocated memory of coefficients of functions if memory is
-		// allocated
+		// Free allocated memory of refrigerant: Interned refrigerant is only
+		// released, otherwise memory of coefficients is freed if allocated
 		//
-		if (retWorkingPair->rhol_par != NULL) {
-			free(retWorkingPair->rhol_par);
-		}
-		if (retWorkingPair->psat_par != NULL) {
-			free(retWorkingPair->psat_par);
+		if (retWorkingPair->refrigerant_parameters != NULL) {
+			delRefrigerantParameters(retWorkingPair->refrigerant_parameters);
+
+		} else {
+			delRefrigerant(retWorkingPair->refrigerant);
+
+			if (retWorkingPair->rhol_par != NULL) {
+				free(retWorkingPair->rhol_par);
+			}
+			if (retWorkingPair->psat_par != NULL) {
+				free(retWorkingPair->psat_par);
+			}
+
 		}
 
 		free(retWorkingPair->iso_par);
@@ -362,2443 +625,9156 @@ DLL_API void delWorkingPair(void *workingPair) {
 
 
 /*
- * warning_struct:
- * ---------------
+ * cloneWorkingPair:
+ * -----------------
  *
- * Auxiliary function to throw warning if some struct (e.g. workingPair or
- * Adsorption) does not exist.
+ * Function to create a copy of an existing WorkingPair-struct without reading
+ * the database again. Therefore, coefficients of functions are copied and
+ * structs containing function pointers are shared with the original WorkingPair-
+ * struct. Coefficients of a refrigerant interned by a database are shared as
+ * well. Thus, each thread can work with its own WorkingPair-struct. If memory
+ * allocation fails, functions returns NULL and prints a warning.
  *
  * Parameters:
  * -----------
- * 	const char *name_struct:
- *		Name of struct that does not exist.
- * 	const char *name_function:
- *		Name of function that does not exist.
+ * 	const struct *WorkingPair:
+ *		Pointer of WorkingPair-struct that shall be cloned.
  *
  * Returns:
  * --------
- *	double:
- *		Returns -1 to indicate error.
+ *	struct *WorkingPair:
+ *		Returns copy of WorkingPair-struct with same memory layout.
+ *
+ * Remarks:
+ * --------
+ *	Clone must be freed by delWorkingPair. Original and clones can be freed in
+ *	any order and from different threads as shared structs are counted
+ *	atomically. Strings defining a working pair with standard memory layout are
+ *	not copied and must stay valid as long as the clone is used.
  *
  * History:
  * --------
- *	27/03/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-double warning_struct(const char *name_struct, const char *name_function) {
-	// Print warning
+DLL_API WorkingPair *cloneWorkingPair(const WorkingPair *workingPair) {
+	// Check if WorkingPair-struct exists
 	//
-	printf("\n\n###########\n# Warning #\n###########");
-	printf("\n%s-struct does not exist.", name_struct);
-	printf("\nReturn -1 for function call \"%s\".", name_function);
+	if (workingPair == NULL) {
+		if (status_report(STATUS_INVALID_STRUCT, "cloneWorkingPair", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nWorkingPair-struct does not exist and cannot be cloned.");
+		}
+		return NULL;
+	}
 
-	// Return error indicator
+	// Compact memory layout does not share any memory and is simply copied
 	//
-	return -1.0;
- }
-
+	if (workingPair->layout == WORKINGPAIR_LAYOUT_COMPACT) {
+		return copy_workingPair_compact(workingPair);
+	}
 
-/*
- * warning_parameter:
- * ------------------
- *
- * Auxiliary function to throw warning if some parameter is missing.
- *
- * Parameters:
- * -----------
- * 	const char *name_parameter:
- *		Name of parameter that is missing.
- * 	const char *name_wpair_function:
- *		Name of working pair function that does not exist.
- *
- * Returns:
- * --------
- *	double:
- *		Returns -1 to indicate error.
- *
- * History:
- * --------
- *	27/03/2020, by Mirko Engelpracht:
- *		First implementation.
- *
- */
-double warning_parameter(const char *name_parameter,
-	const char *name_wpair_function) {
-	// Print warning
+    // Try to allocate memory for WorkingPair-struct and coefficients
 	//
-	printf("\n\n###########\n# Warning #\n###########");
-	printf("\nParameters required to calculate \"%s\" are not stored within "
-		"the workingPair-struct.", name_parameter);
-	printf("\nReturn -1 for function call \"%s\".", name_wpair_function);
+    WorkingPair *retWorkingPair = (WorkingPair *) malloc(sizeof(WorkingPair));
 
-	// Return error indicator
+    if (retWorkingPair == NULL) {
+		if (status_report(STATUS_NO_MEMORY, "cloneWorkingPair", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for WorkingPair-struct.");
+		}
+        return NULL;
+	}
+
+	// Coefficients of interned refrigerant are shared and thus not copied
 	//
-	return -1.0;
-}
+	int copy_refrigerant = (workingPair->refrigerant_parameters == NULL);
 
+	*retWorkingPair = *workingPair;
+	retWorkingPair->surrogates = NULL;
+	retWorkingPair->tables = NULL;
+	retWorkingPair->iso_par = (double *) malloc(
+		(size_t) workingPair->no_iso_par * sizeof(double));
+	retWorkingPair->psat_par = (workingPair->psat_par == NULL ||
+		!copy_refrigerant) ? workingPair->psat_par :
+		(double *) malloc((size_t) workingPair->no_psat_par * sizeof(double));
+	retWorkingPair->rhol_par = (workingPair->rhol_par == NULL ||
+		!copy_refrigerant) ? workingPair->rhol_par :
+		(double *) malloc((size_t) workingPair->no_rhol_par * sizeof(double));
 
-/*
- * warning_function:
- * -----------------
- *
- * Auxiliary function to throw warning if some function does not exist.
- *
- * Parameters:
- * -----------
- * 	const char *name_iso_function:
- *		Name of isotherm function that does not exist.
- * 	const char *name_wpair_function:
- *		Name of working pair function that does not exist.
- *
- * Returns:
- * --------
- *	double:
- *		Returns -1 to indicate error.
- *
- * History:
- * --------
- *	27/03/2020, by Mirko Engelpracht:
- *		First implementation.
- *
- */
-double warning_function(const char *name_function,
-	const char *name_wpair_function) {
-	// Print warning
+	if (retWorkingPair->iso_par == NULL ||
+		(workingPair->psat_par != NULL && retWorkingPair->psat_par == NULL) ||
+		(workingPair->rhol_par != NULL && retWorkingPair->rhol_par == NULL)) {
+		// Not enough memory available for coefficients, free memory
+		//
+		if (status_report(STATUS_NO_MEMORY, "cloneWorkingPair", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for coefficients of "
+				"WorkingPair-struct.");
+		}
+		free(retWorkingPair->iso_par);
+		if (copy_refrigerant) {
+			free(retWorkingPair->psat_par);
+			free(retWorkingPair->rhol_par);
+		}
+		free(retWorkingPair);
+        return NULL;
+	}
+
+	// Copy coefficients of functions
 	//
-	printf("\n\n###########\n# Warning #\n###########");
-	printf("\nChosen isotherm function \"%s\" is not implemented.",
-		name_function);
-	printf("\nReturn -1 for function call \"%s\".", name_wpair_function);
+	memcpy(retWorkingPair->iso_par, workingPair->iso_par,
+		(size_t) workingPair->no_iso_par * sizeof(double));
+	if (workingPair->psat_par != NULL && copy_refrigerant) {
+		memcpy(retWorkingPair->psat_par, workingPair->psat_par,
+			(size_t) workingPair->no_psat_par * sizeof(double));
+	}
+	if (workingPair->rhol_par != NULL && copy_refrigerant) {
+		memcpy(retWorkingPair->rhol_par, workingPair->rhol_par,
+			(size_t) workingPair->no_rhol_par * sizeof(double));
+	}
 
-	// Return error indicator
+	// Share structs containing function pointers as they are not changed
+	// after initialization
 	//
-	return -1.0;
+	if (copy_refrigerant) {
+		REFERENCES_INCREMENT(&retWorkingPair->refrigerant->no_references);
+	} else {
+		REFERENCES_INCREMENT(
+			&retWorkingPair->refrigerant_parameters->no_references);
+	}
+	if (retWorkingPair->adsorption != NULL) {
+		REFERENCES_INCREMENT(&retWorkingPair->adsorption->no_references);
+	}
+	if (retWorkingPair->absorption != NULL) {
+		REFERENCES_INCREMENT(&retWorkingPair->absorption->no_references);
+	}
+
+	// Return structure
+	//
+	return retWorkingPair;
 }
 
 
-////////////////////////////////////////////////////////////////////////////
-// Definition of function prototypes regarding adsorption working w struct//
-////////////////////////////////////////////////////////////////////////////
 /*
- * ads_w_pT:
- * ---------
+ * serializeWorkingPair:
+ * ---------------------
  *
- * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
- * p in Pa and equilibrium temperature T in K.
+ * Function to write a WorkingPair-struct into a byte array. The byte array
+ * contains strings defining the working pair and coefficients of functions.
+ * Thus, the working pair can be created by deserializeWorkingPair in another
+ * process that cannot access the database.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
+ *	unsigned char *ret_blob:
+ *		Byte array to be filled. If NULL, only the required size is returned.
+ *	size_t size_blob:
+ *		Size of byte array in bytes.
+ * 	const struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- *	double:
- *		Equilibrium loading in kg/kg.
+ *	size_t:
+ *		Returns number of bytes required for serialized WorkingPair-struct.
+ *		Returns 0 if WorkingPair-struct does not exist or byte array is too
+ *		small.
+ *
+ * Remarks:
+ * --------
+ *	Byte array uses native byte order and sizes of types. Thus, byte array can
+ *	only be exchanged between processes running on same architecture.
  *
  * History:
  * --------
- *	01/06/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_w_pT(double p_Pa, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_w_pT");
+DLL_API size_t serializeWorkingPair(unsigned char *ret_blob, size_t size_blob,
+	const WorkingPair *workingPair) {
+	// Check if WorkingPair-struct exists
+	//
+	if (workingPair == NULL) {
+		if (status_report(STATUS_INVALID_STRUCT, "serializeWorkingPair",
+			0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nWorkingPair-struct does not exist and cannot be "
+				"serialized.");
+		}
+		return 0;
+	}
+
+	// Create header containing general information of working pair, numbers
+	// of coefficients, and lengths of strings: Number -1 indicates that
+	// coefficients or strings do not exist
+	//
+	const char *strings[] = {workingPair->wp_as, workingPair->wp_st,
+		workingPair->wp_rf, workingPair->wp_iso, workingPair->rf_psat,
+		workingPair->rf_rhol};
+	int header[WORKINGPAIR_BLOB_NO_HEADER];
+
+	header[0] = WORKINGPAIR_BLOB_ID;
+	header[1] = WORKINGPAIR_BLOB_VERSION;
+	header[2] = (workingPair->adsorption != NULL) ? 1 : 2;
+	header[3] = workingPair->no_iso;
+	header[4] = workingPair->no_p_sat;
+	header[5] = workingPair->no_rhol;
+	header[6] = workingPair->no_iso_par;
+	header[7] = (workingPair->psat_par == NULL) ? -1 : workingPair->no_psat_par;
+	header[8] = (workingPair->rhol_par == NULL) ? -1 : workingPair->no_rhol_par;
+
+	size_t size_strings = 0;
+	for (int i = 0; i < 6; i++) {
+		header[9 + i] = (strings[i] == NULL) ? -1 :
+			(int) strlen(strings[i]) + 1;
+		size_strings += (strings[i] == NULL) ? 0 : (size_t) header[9 + i];
+	}
+
+	// Calculate size of byte array
+	//
+	size_t size_iso_par = (size_t) header[6] * sizeof(double);
+	size_t size_psat_par = (header[7] < 0) ? 0 :
+		(size_t) header[7] * sizeof(double);
+	size_t size_rhol_par = (header[8] < 0) ? 0 :
+		(size_t) header[8] * sizeof(double);
+	size_t size_required = sizeof(header) + size_iso_par + size_psat_par +
+		size_rhol_par + size_strings;
+
+	if (ret_blob == NULL) {
+		return size_required;
+
+	} else if (size_blob < size_required) {
+		if (status_report(STATUS_INVALID_INPUT, "serializeWorkingPair", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nByte array is too small to serialize WorkingPair-struct: "
+				"%zu bytes are required.", size_required);
+		}
+		return 0;
 	}
 
-	// Check if isotherm function exists for chosen isotherm type
-	//	
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_w_pT");
-		
-	} else if (retWorkingPair->adsorption->w_pT==NULL) {
-		return warning_function("w_pT", "ads_w_pT");
-
-	} else {
-		return retWorkingPair->adsorption->w_pT(p_Pa, T_K,
-			retWorkingPair->iso_par, retWorkingPair->psat_par,
-			retWorkingPair->rhol_par, retWorkingPair->adsorption,
-			retWorkingPair->refrigerant);
+	// Fill byte array
+	//
+	unsigned char *position = ret_blob;
 
+	memcpy(position, header, sizeof(header));
+	position += sizeof(header);
+	memcpy(position, workingPair->iso_par, size_iso_par);
+	position += size_iso_par;
+	if (size_psat_par > 0) {
+		memcpy(position, workingPair->psat_par, size_psat_par);
+		position += size_psat_par;
+	}
+	if (size_rhol_par > 0) {
+		memcpy(position, workingPair->rhol_par, size_rhol_par);
+		position += size_rhol_par;
+	}
+	for (int i = 0; i < 6; i++) {
+		if (strings[i] != NULL) {
+			memcpy(position, strings[i], (size_t) header[9 + i]);
+			position += header[9 + i];
+		}
 	}
+
+	return size_required;
 }
 
 
 /*
- * ads_p_wT:
- * ---------
+ * deserializeWorkingPair:
+ * -----------------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
- * in kg/kg and equilibrium temperature T in K.
+ * Function to create a WorkingPair-struct from a byte array written by
+ * serializeWorkingPair. Created WorkingPair-struct has a compact memory layout
+ * and contains copies of all strings. If byte array is invalid or memory
+ * allocation fails, functions returns NULL and prints a warning.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	const unsigned char *blob:
+ *		Byte array containing serialized WorkingPair-struct.
+ *	size_t size_blob:
+ *		Size of byte array in bytes.
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium pressure in Pa.
+ *	struct *WorkingPair:
+ *		Returns WorkingPair-struct with compact memory layout.
+ *
+ * Remarks:
+ * --------
+ *	WorkingPair-struct must be freed by delWorkingPair.
  *
  * History:
  * --------
- *	01/06/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_p_wT(double w_kgkg, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API WorkingPair *deserializeWorkingPair(const unsigned char *blob,
+	size_t size_blob) {
+	// Read and check header
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	int header[WORKINGPAIR_BLOB_NO_HEADER];
 
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_p_wT");
+	if (blob == NULL || size_blob < sizeof(header)) {
+		if (status_report(STATUS_INVALID_INPUT, "deserializeWorkingPair",
+			0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nByte array is too small to contain WorkingPair-struct.");
+		}
+		return NULL;
 	}
 
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_p_wT");
-		
-	} else if (retWorkingPair->adsorption->p_wT==NULL) {
-		return warning_function("p_wT", "ads_p_wT");
+	memcpy(header, blob, sizeof(header));
+	size_t size_required = sizeof(header);
+	int valid = (header[0] == WORKINGPAIR_BLOB_ID &&
+		header[1] == WORKINGPAIR_BLOB_VERSION &&
+		(header[2] == 1 || header[2] == 2) && header[6] >= 0);
 
-	} else {
-		return retWorkingPair->adsorption->p_wT(w_kgkg, T_K,
-			retWorkingPair->iso_par, retWorkingPair->psat_par,
-			retWorkingPair->rhol_par, retWorkingPair->adsorption,
-			retWorkingPair->refrigerant);
+	for (int i = 6; i < WORKINGPAIR_BLOB_NO_HEADER && valid; i++) {
+		if (header[i] > 0) {
+			size_required += (size_t) header[i] * ((i < 9) ? sizeof(double) :
+				sizeof(char));
+		}
+	}
 
+	if (!valid || size_blob < size_required) {
+		if (status_report(STATUS_INVALID_INPUT, "deserializeWorkingPair",
+			0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nByte array does not contain a valid WorkingPair-struct.");
+		}
+		return NULL;
 	}
-}
 
+	// Try to allocate memory for temporary WorkingPair-struct with standard
+	// memory layout
+	//
+	WorkingPair *workingPair = (WorkingPair *) malloc(sizeof(WorkingPair));
 
-/*
- * ads_T_pw:
- * ---------
- *
- * Calculates equilibrium temperature in K depending on equilibrium pressure p
- * in Pa and equilibrium loading w in kg/kg.
- *
- * Parameters:
- * -----------
- *	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
- *
- * Returns:
- * --------
- * 	double:
- *		Equilibrium temperature in K.
- *
- * Remarks:
- * --------
- *	Function uses equation of states implemented for calculation of vapor
- *	pressure, saturated liquid density, derivative of vapor pressure wrt.
- *	temperature, and derivative of saturated liquid density wrt. temperature
- *	when isotherm of working pair is based on volumetric approach (e.g.
- *	Dubinin theory).
- *
- * History:
- * --------
- *	01/06/2020, by Mirko Engelpracht:
- *		First implementation.
- *
- */
-DLL_API double ads_T_pw(double p_Pa, double w_kgkg, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+	if (workingPair == NULL) {
+		if (status_report(STATUS_NO_MEMORY, "deserializeWorkingPair", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for WorkingPair-struct.");
+		}
+		return NULL;
+	}
+
+	workingPair->no_iso = header[3];
+	workingPair->no_p_sat = header[4];
+	workingPair->no_rhol = header[5];
+	workingPair->no_iso_par = header[6];
+	workingPair->no_psat_par = (header[7] < 0) ? 0 : header[7];
+	workingPair->no_rhol_par = (header[8] < 0) ? 0 : header[8];
+	workingPair->layout = WORKINGPAIR_LAYOUT_STANDARD;
+	workingPair->refrigerant_parameters = NULL;
+	workingPair->surrogates = NULL;
+	workingPair->tables = NULL;
+
+	// Copy coefficients of functions: Coefficients are copied to new arrays
+	// because byte array does not need to be aligned
+	//
+	const unsigned char *position = blob + sizeof(header);
+	double **coefficients[] = {&workingPair->iso_par, &workingPair->psat_par,
+		&workingPair->rhol_par};
+
+	for (int i = 0; i < 3; i++) {
+		*coefficients[i] = NULL;
+	}
+	for (int i = 0; i < 3; i++) {
+		if (header[6 + i] >= 0) {
+			size_t size_par = (size_t) header[6 + i] * sizeof(double);
+			*coefficients[i] = (double *) malloc(size_par + sizeof(double));
+
+			if (*coefficients[i] == NULL) {
+				if (status_report(STATUS_NO_MEMORY, "deserializeWorkingPair",
+					0, 0)) {
+					printf("\n\n###########\n# Warning #\n###########");
+					printf("\nCannot allocate memory for coefficients of "
+						"WorkingPair-struct.");
+				}
+				free(workingPair->iso_par);
+				free(workingPair->psat_par);
+				free(workingPair);
+				return NULL;
+			}
+
+			memcpy(*coefficients[i], position, size_par);
+			position += size_par;
+		}
+	}
+
+	// Set strings: Strings point to byte array until WorkingPair-struct is
+	// copied into compact memory layout
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	const char **strings[] = {&workingPair->wp_as, &workingPair->wp_st,
+		&workingPair->wp_rf, &workingPair->wp_iso, &workingPair->rf_psat,
+		&workingPair->rf_rhol};
 
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_T_pw");
+	for (int i = 0; i < 6; i++) {
+		*strings[i] = NULL;
+
+		if (header[9 + i] > 0) {
+			if (position[header[9 + i] - 1] == '\0') {
+				*strings[i] = (const char *) position;
+			}
+			position += header[9 + i];
+		}
 	}
 
-	// Check if isotherm function exists for chosen isotherm type
+	if (workingPair->wp_iso == NULL) {
+		if (status_report(STATUS_INVALID_INPUT, "deserializeWorkingPair",
+			0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nByte array does not contain a valid isotherm name.");
+		}
+		free(workingPair->iso_par);
+		free(workingPair->psat_par);
+		free(workingPair->rhol_par);
+		free(workingPair);
+		return NULL;
+	}
+
+	// Check numbers of coefficients: Functions index coefficients without
+	// checking their number, so byte arrays of other versions or truncated
+	// byte arrays must be rejected
+	//
+	int no_psat_par = (workingPair->rf_psat == NULL) ? -1 :
+		workingPair_no_coefficients(workingPair->rf_psat);
+	int no_rhol_par = (workingPair->rf_rhol == NULL) ? -1 :
+		workingPair_no_coefficients(workingPair->rf_rhol);
+
+	if (header[6] != workingPair_no_coefficients(workingPair->wp_iso) ||
+		(header[7] >= 0 && header[7] != no_psat_par) ||
+		(header[8] >= 0 && header[8] != no_rhol_par)) {
+		if (status_report(STATUS_INVALID_INPUT, "deserializeWorkingPair",
+			0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nNumbers of coefficients of byte array do not match "
+				"isotherm equation \"%s\" and refrigerant equations.",
+				workingPair->wp_iso);
+		}
+		free(workingPair->iso_par);
+		free(workingPair->psat_par);
+		free(workingPair->rhol_par);
+		free(workingPair);
+		return NULL;
+	}
+
+	// Initialize structs containing isotherm and refrigerant functions and
+	// copy WorkingPair-struct into compact memory layout
 	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_T_pw");
-		
-	} else if (retWorkingPair->adsorption->T_pw==NULL) {
-		return warning_function("T_pw", "ads_T_pw");
+	WorkingPair *retWorkingPair = NULL;
+
+	if (init_workingPair_structs(workingPair, header[2]) == 0) {
+		retWorkingPair = copy_workingPair_compact(workingPair);
+		delWorkingPair(workingPair);
 
 	} else {
-		return retWorkingPair->adsorption->T_pw(p_Pa, w_kgkg,
-			retWorkingPair->iso_par, retWorkingPair->psat_par,
-			retWorkingPair->rhol_par, retWorkingPair->adsorption,
-			retWorkingPair->refrigerant);
+		free(workingPair->iso_par);
+		free(workingPair->psat_par);
+		free(workingPair->rhol_par);
+		free(workingPair);
 
 	}
+
+	// Return structure
+	//
+	return retWorkingPair;
 }
 
 
+
 /*
- * ads_dw_dp_pT:
- * -------------
+ * workingPair_no_coefficients:
+ * ----------------------------
  *
- * Calculates derivative of equilibrium loading w with respect to pressure
- * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Auxiliary function returning number of coefficients of an isotherm or
+ * refrigerant equation that are indexed by its functions.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	const char *equation:
+ *		Name of isotherm equation (e.g., "Toth") or calculation approach of
+ *		refrigerant (e.g., "VaporPressure_EoS1").
  *
  * Returns:
  * --------
- *	double:
- *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *	int:
+ *		Number of coefficients or -1 if equation does not exist.
  *
  * History:
  * --------
- *	01/06/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_dw_dp_pT(double p_Pa, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_dw_dp_pT");
-	}
-
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_dw_dp_pT");
-		
-	} else if (retWorkingPair->adsorption->dw_dp_pT==NULL) {
-		return warning_function("dw_dp_pT", "ads_dw_dp_pT");
-
-	} else {
-		return retWorkingPair->adsorption->dw_dp_pT(p_Pa, T_K,
-			retWorkingPair->iso_par, retWorkingPair->psat_par,
-			retWorkingPair->rhol_par, retWorkingPair->adsorption,
-			retWorkingPair->refrigerant);
+int workingPair_no_coefficients(const char *equation) {
+	int no_equations = (int) (sizeof(workingPair_equations) /
+		sizeof(workingPair_equations[0]));
 
+	for (int i = 0; i < no_equations; i++) {
+		if (strcmp(workingPair_equations[i], equation) == 0) {
+			return workingPair_equations_no_par[i];
+		}
 	}
+	return -1;
 }
 
 
 /*
- * ads_dw_dT_pT:
- * -------------
+ * init_workingPair_structs:
+ * -------------------------
  *
- * Calculates derivative of equilibrium loading w with respect to temperature
- * T in kg/kg/K depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Auxiliary function to create structs containing function pointers of
+ * isotherm and refrigerant functions of a WorkingPair-struct. Therefore,
+ * general information and coefficients of the WorkingPair-struct must be set
+ * before.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
+ *	int wp_tp:
+ *		Type of working pair (i.e., 1 for adsorption and 2 for absorption).
  *
  * Returns:
  * --------
- *	double:
- *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *	int:
+ *		Returns 0 if structs are created and -1 otherwise.
  *
  * History:
  * --------
- *	01/06/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_dw_dT_pT(double p_Pa, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+int init_workingPair_structs(WorkingPair *retWorkingPair, int wp_tp) {
+	// Check which equations of states exists for initialization of
+	// "Refrigerant"-struct
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_dw_dT_pT");
-	}
+	const char *rf_psat_int = (retWorkingPair->psat_par == NULL) ?
+		"NoVaporPressure" : retWorkingPair->rf_psat;
+	const char *rf_rhol_int= (retWorkingPair->rhol_par == NULL) ?
+		"NoSaturatedLiquidDensity" : retWorkingPair->rf_rhol;
 
-	// Check if isotherm function exists for chosen isotherm type
+	// Initialize structs containing isotherm functions
 	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_dw_dT_pT");
-		
-	} else if (retWorkingPair->adsorption->dw_dT_pT==NULL) {
-		return warning_function("dw_dT_pT", "ads_dw_dT_pT");
-
-	} else {
-		return retWorkingPair->adsorption->dw_dT_pT(p_Pa, T_K,
-			retWorkingPair->iso_par, retWorkingPair->psat_par,
-			retWorkingPair->rhol_par, retWorkingPair->adsorption,
-			retWorkingPair->refrigerant);
-
-	}
-}
+	if (wp_tp == 1) {
+		// Adsorption equations
+		//
+		retWorkingPair->adsorption = newAdsorption(retWorkingPair->wp_iso);
+		retWorkingPair->absorption = NULL;
+		if (retWorkingPair->adsorption == NULL) {
+			// Cannot create Adsorption-struct
+			//
+			if (status_report(STATUS_INVALID_INPUT, "init_workingPair_structs",
+				0, 0)) {
+				printf("\n\n###########\n# Error #\n###########");
+				printf("\nCannot create Adsorption-struct within "
+					"WorkingPair-struct!");
+				printf("\nTherefore, cannot execute isotherm functions!");
+			}
+			return -1;
+		}
+
+	} else if (wp_tp == 2) {
+		// Absorption equations
+		//
+		retWorkingPair->absorption = newAbsorption(retWorkingPair->wp_iso,
+			retWorkingPair->iso_par);
+		retWorkingPair->adsorption = NULL;
+		if (retWorkingPair->absorption == NULL) {
+			// Cannot create Absorption-struct
+			//
+			if (status_report(STATUS_INVALID_INPUT, "init_workingPair_structs",
+				0, 0)) {
+				printf("\n\n###########\n# Error #\n###########");
+				printf("\nCannot create Absorption-struct within "
+					"WorkingPair-struct!");
+				printf("\nTherefore, cannot execute isotherm functions!");
+			}
+			return -1;
+		}
+
+	} else {
+		// Neither adsorption nor absorption: Something went wrong!
+		//
+		if (status_report(STATUS_INVALID_INPUT, "init_workingPair_structs",
+			0, 0)) {
+			printf("\n\n###########\n# Error #\n###########");
+			printf("\nDo not know whether to create Adsorption- or "
+				"Absorption-struct! This should not happen: Most likely, the "
+				"column 'type' is wrong within the JSON database.");
+			printf("\nTherefore, cannot execute isotherm functions!");
+		}
+		return -1;
+
+	}
+
+	// Refrigerant-struct of interned refrigerant is shared
+	//
+	if (retWorkingPair->refrigerant_parameters != NULL) {
+		retWorkingPair->refrigerant =
+			retWorkingPair->refrigerant_parameters->refrigerant;
+		return 0;
+	}
+
+	retWorkingPair->refrigerant = newRefrigerant(rf_psat_int, rf_rhol_int,
+		retWorkingPair->psat_par);
+    if (retWorkingPair->refrigerant == NULL) {
+		// Cannot create "Refrigerant"-struct
+		//
+		if (status_report(STATUS_INVALID_INPUT, "init_workingPair_structs",
+			0, 0)) {
+			printf("\n\n###########\n# Error #\n###########");
+			printf("\nCannot create Refrigerant-struct within "
+				"WorkingPair-struct!");
+			printf("\nTherefore, cannot execute refrigerant functions!");
+		}
+		delAdsorption(retWorkingPair->adsorption);
+		delAbsorption(retWorkingPair->absorption);
+        return -1;
+	}
+
+	// Return success
+	//
+	return 0;
+}
 
 
 /*
- * ads_dp_dw_wT:
- * -------------
+ * newWorkingPairCompact:
+ * ----------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to loading
- * w in kgPa/kg depending on equilibrium loading w in kg/kg and equilibrium
- * temperature T in K.
+ * Initialization function to create a new WorkingPair-struct with a compact
+ * memory layout. Therefore, function creates first a WorkingPair-struct with
+ * the standard memory layout and copies it afterwards into one single memory
+ * block aligned to a cache line. The memory block contains the WorkingPair-
+ * struct, all coefficients of functions, and the structs containing function
+ * pointers at fixed offsets. Thus, evaluating many working pairs one after
+ * another touches fewer cache lines. If memory allocation fails, functions
+ * returns NULL and prints a warning.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
- *	double:
- *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *	struct *WorkingPair:
+ *		Returns WorkingPair-struct with compact memory layout containing all
+ *		information required to calculate the resorption equilibrium of the
+ *		working pair.
+ *
+ * Remarks:
+ * --------
+ *	WorkingPair-struct must be freed by delWorkingPair.
  *
  * History:
  * --------
- *	01/13/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_dp_dw_wT(double w_kgkg, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API WorkingPair *newWorkingPairCompact(const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol) {
+	// Create working pair with standard memory layout first
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	WorkingPair *workingPair = newWorkingPair(path_db, wp_as, wp_st, wp_rf,
+		wp_iso, no_iso, rf_psat, no_p_sat, rf_rhol, no_rhol);
 
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_dp_dw_wT");
+	if (workingPair == NULL) {
+		return NULL;
 	}
 
-	// Check if isotherm function exists for chosen isotherm type
+	// Copy working pair into one memory block and free working pair with
+	// standard memory layout afterwards
 	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_dp_dw_wT");
-		
-	} else if (retWorkingPair->adsorption->dp_dw_wT==NULL) {
-		return warning_function("dp_dw_wT", "ads_dp_dw_wT");
+	WorkingPair *retWorkingPair = copy_workingPair_compact(workingPair);
+	delWorkingPair(workingPair);
 
-	} else {
-		return retWorkingPair->adsorption->dp_dw_wT(w_kgkg, T_K,
-			retWorkingPair->iso_par, retWorkingPair->psat_par,
-			retWorkingPair->rhol_par, retWorkingPair->adsorption,
-			retWorkingPair->refrigerant);
-
-	}
+	// Return structure
+	//
+	return retWorkingPair;
 }
 
 
 /*
- * ads_dp_dT_wT:
- * -------------
+ * copy_workingPair_compact:
+ * -------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium loading w in kg/kg and equilibrium
- * temperature T in K.
+ * Auxiliary function to copy a WorkingPair-struct into one single memory block
+ * that is aligned to a cache line. The memory block is ordered as follows:
+ * WorkingPair-struct, coefficients of isotherm, coefficients of vapor pressure
+ * equation, coefficients of saturated liquid density equation, Refrigerant-
+ * struct, Adsorption- or Absorption-struct, and strings defining the working
+ * pair. Thus, the copy does not depend on memory of the original.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
  * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *		Pointer of WorkingPair-struct that shall be copied.
  *
  * Returns:
  * --------
- *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *	struct *WorkingPair:
+ *		Returns WorkingPair-struct with compact memory layout. Returns NULL if
+ *		memory allocation fails.
  *
  * History:
  * --------
- *	01/13/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_dp_dT_wT(double w_kgkg, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+WorkingPair *copy_workingPair_compact(const WorkingPair *workingPair) {
+	// Calculate sizes of sections of memory block: Sizes are rounded up to
+	// multiples of the size of a double to keep coefficients aligned
+	//
+	size_t size_struct = (sizeof(WorkingPair) + sizeof(double) - 1) /
+		sizeof(double) * sizeof(double);
+	size_t size_iso_par = (size_t) workingPair->no_iso_par * sizeof(double);
+	size_t size_psat_par = (workingPair->psat_par == NULL) ? 0 :
+		(size_t) workingPair->no_psat_par * sizeof(double);
+	size_t size_rhol_par = (workingPair->rhol_par == NULL) ? 0 :
+		(size_t) workingPair->no_rhol_par * sizeof(double);
+	size_t size_refrigerant = (sizeof(Refrigerant) + sizeof(double) - 1) /
+		sizeof(double) * sizeof(double);
+	size_t size_isotherm = (workingPair->adsorption != NULL) ?
+		sizeof(Adsorption) : sizeof(Absorption);
+
+	const char *strings[] = {workingPair->wp_as, workingPair->wp_st,
+		workingPair->wp_rf, workingPair->wp_iso, workingPair->rf_psat,
+		workingPair->rf_rhol};
+	size_t size_strings = 0;
+
+	for (int i = 0; i < 6; i++) {
+		size_strings += (strings[i] == NULL) ? 0 : strlen(strings[i]) + 1;
+	}
+
+	// Allocate one memory block aligned to a cache line
+	//
+	char *block = (char *) malloc_aligned(size_struct + size_iso_par +
+		size_psat_par + size_rhol_par + size_refrigerant + size_isotherm +
+		size_strings);
+
+	if (block == NULL) {
+		// Print warning
+		//
+		if (status_report(STATUS_NO_MEMORY, "copy_workingPair_compact", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for compact WorkingPair-struct!");
+		}
+		return NULL;
+	}
+
+	// Copy WorkingPair-struct and set pointers to sections of memory block
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	WorkingPair *retWorkingPair = (WorkingPair *) block;
+	*retWorkingPair = *workingPair;
+	retWorkingPair->layout = WORKINGPAIR_LAYOUT_COMPACT;
+	retWorkingPair->refrigerant_parameters = NULL;
+	retWorkingPair->surrogates = NULL;
+	retWorkingPair->tables = NULL;
+	block += size_struct;
 
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_dp_dT_wT");
+	retWorkingPair->iso_par = (double *) block;
+	memcpy(retWorkingPair->iso_par, workingPair->iso_par, size_iso_par);
+	block += size_iso_par;
+
+	if (workingPair->psat_par != NULL) {
+		retWorkingPair->psat_par = (double *) block;
+		memcpy(retWorkingPair->psat_par, workingPair->psat_par, size_psat_par);
+		block += size_psat_par;
+	}
+	if (workingPair->rhol_par != NULL) {
+		retWorkingPair->rhol_par = (double *) block;
+		memcpy(retWorkingPair->rhol_par, workingPair->rhol_par, size_rhol_par);
+		block += size_rhol_par;
 	}
 
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_dp_dT_wT");
-		
-	} else if (retWorkingPair->adsorption->dp_dw_wT==NULL) {
-		return warning_function("dp_dw_wT", "ads_dp_dT_wT");
+	retWorkingPair->refrigerant = (Refrigerant *) block;
+	*retWorkingPair->refrigerant = *workingPair->refrigerant;
+	block += size_refrigerant;
 
+	if (workingPair->adsorption != NULL) {
+		retWorkingPair->adsorption = (Adsorption *) block;
+		*retWorkingPair->adsorption = *workingPair->adsorption;
 	} else {
-		return retWorkingPair->adsorption->dp_dT_wT(w_kgkg, T_K,
-			retWorkingPair->iso_par, retWorkingPair->psat_par,
-			retWorkingPair->rhol_par, retWorkingPair->adsorption,
-			retWorkingPair->refrigerant);
+		retWorkingPair->absorption = (Absorption *) block;
+		*retWorkingPair->absorption = *workingPair->absorption;
+	}
+	block += size_isotherm;
+
+	const char **ret_strings[] = {&retWorkingPair->wp_as,
+		&retWorkingPair->wp_st, &retWorkingPair->wp_rf, &retWorkingPair->wp_iso,
+		&retWorkingPair->rf_psat, &retWorkingPair->rf_rhol};
+
+	for (int i = 0; i < 6; i++) {
+		if (strings[i] != NULL) {
+			size_t size_string = strlen(strings[i]) + 1;
+			memcpy(block, strings[i], size_string);
+			*ret_strings[i] = block;
+			block += size_string;
+		}
+	}
 
+	// Structs containing function pointers are owned by memory block and thus
+	// are never freed by their destructors
+	//
+	retWorkingPair->refrigerant->no_references = 1;
+	if (retWorkingPair->adsorption != NULL) {
+		retWorkingPair->adsorption->isotherm_type = retWorkingPair->wp_iso;
+		retWorkingPair->adsorption->no_references = 1;
+	} else {
+		retWorkingPair->absorption->isotherm_type = retWorkingPair->wp_iso;
+		retWorkingPair->absorption->no_references = 1;
 	}
+
+	// Return structure
+	//
+	return retWorkingPair;
 }
 
 
 /*
- * ads_piStar_pyxgTM:
- * ------------------
- *
- * Calculates reduced spreading pressure piStar in kg/mol depending on
- * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
- * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
- * activity coefficient of refrigerant in adsorbed phase, equilibrium
- * temperature T in K and molar mass of refrigerant M in kg/mol. The reduced
- * spreading pressure is defined as follows:
- *
- * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
- *		Integral_0^p0{w(p,T) / p * dp}
+ * malloc_aligned:
+ * ---------------
  *
- *	where p0 = p_total*y / (gamma*x)
+ * Auxiliary function to allocate memory that is aligned to a cache line.
  *
  * Parameters:
  * -----------
- *	double p_total_Pa:
- *		Total pressure of vapor phase in Pa.
- *	double y_molmol:
- *		Molar fraction of refrigerant in vapor phase in mol/mol.
- *	double x_molmol:
- *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
- *	double gamma:
- *		Activity coefficient of refrigerant in adsorbed phase.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double M_kgmol:
- *		Molar mass of refrigerant M in kg/mol.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ * 	size_t size:
+ *		Number of bytes that shall be allocated.
  *
  * Returns:
  * --------
- *	double:
- *		Reduced spreading pressure in kg/mol.
+ *	void *:
+ *		Returns pointer to allocated memory. Returns NULL if memory allocation
+ *		fails.
+ *
+ * Remarks:
+ * --------
+ *	Memory must be freed by free_aligned.
  *
  * History:
  * --------
- *	01/13/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_piStar_pyxgTM(double p_total_Pa, double y_molmol,
-	double x_molmol, double gamma, double T_K, double M_kgmol,
-	void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_piStar_pyxgTM");
-	}
-
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_piStar_pyxgTM");
-		
-	} else if (retWorkingPair->adsorption->piStar_pyxgTM==NULL) {
-		return warning_function("piStar_pyxgTM", "ads_piStar_pyxgTM");
-
-	} else {
-		return retWorkingPair->adsorption->piStar_pyxgTM(p_total_Pa, y_molmol,
-			x_molmol, gamma, T_K, M_kgmol, retWorkingPair->iso_par,
-			retWorkingPair->psat_par, retWorkingPair->rhol_par,
-			retWorkingPair->adsorption, retWorkingPair->refrigerant);
+void *malloc_aligned(size_t size) {
+#ifdef __unix
+	void *ptr = NULL;
 
+	if (posix_memalign(&ptr, CACHE_LINE_SIZE, size) != 0) {
+		return NULL;
 	}
+	return ptr;
+#else
+	return _aligned_malloc(size, CACHE_LINE_SIZE);
+#endif
 }
 
 
 /*
- * ads_sur_w_pT:
+ * free_aligned:
  * -------------
  *
- * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
- * p in Pa and equilibrium temperature T in K.
+ * Auxiliary function to free memory that was allocated by malloc_aligned.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
- *
- * Returns:
- * --------
- *	double:
- *		Equilibrium loading in kg/kg.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach.
+ * 	void *ptr:
+ *		Pointer to memory that shall be freed.
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_w_pT(double p_Pa, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_sur_w_pT");
-	}
-
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_sur_w_pT");
-		
-	} else if (retWorkingPair->adsorption->sur_w_pT==NULL) {
-		return warning_function("sur_w_pT", "ads_sur_w_pT");
-
-	} else {
-		return retWorkingPair->adsorption->sur_w_pT(p_Pa, T_K,
-			retWorkingPair->iso_par);
-
-	}
+void free_aligned(void *ptr) {
+#ifdef __unix
+	free(ptr);
+#else
+	_aligned_free(ptr);
+#endif
 }
 
 
 /*
- * ads_sur_p_wT:
- * -------------
+ * enableWorkingPairSurrogate:
+ * ---------------------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
- * in kg/kg and equilibrium temperature T in K.
+ * Creates surrogates of the equilibrium functions of a working pair with two
+ * inputs (i.e., w_pT, p_wT, and T_pw for adsorption, X_pT, p_XT, and T_pX for
+ * conventional absorption, and x_pT, p_Tx, and T_px including vapor mole
+ * fractions for absorption based on mixing rules). Afterwards, these functions
+ * use the surrogates for states within the limits and evaluate the original
+ * equations otherwise. Limits whose minimum is not smaller than its maximum
+ * are read from the range of validity of the isotherm given by the database.
+ * If limits are not available or surrogates cannot be created, surrogates are
+ * disabled, function returns -1, and prints a warning.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
+ * 	struct *Database:
+ *		Pointer of Database-struct (i.e., may be NULL if all limits are given).
+ *	double p_min_Pa:
+ *		Lower limit of pressure in Pa.
+ *	double p_max_Pa:
+ *		Upper limit of pressure in Pa.
+ *	double T_min_K:
+ *		Lower limit of temperature in K.
+ *	double T_max_K:
+ *		Upper limit of temperature in K.
+ *	double w_min:
+ *		Lower limit of loading in kg/kg, concentration in kg/kg, or liquid
+ *		mole fraction in mol/mol.
+ *	double w_max:
+ *		Upper limit of loading in kg/kg, concentration in kg/kg, or liquid
+ *		mole fraction in mol/mol.
+ *	double max_rel_error:
+ *		Maximal relative error of surrogates.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium pressure in Pa.
+ *	int:
+ *		Returns 0 if surrogates are created and -1 otherwise.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach.
+ *	Surrogates are owned by the working pair and are neither shared with clones
+ *	nor serialized. They must not be enabled or disabled while other threads
+ *	use the working pair. Ranges of validity of absorption working pairs only
+ *	contain temperatures, thus pressure and composition limits must be given.
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_p_wT(double w_kgkg, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API int enableWorkingPairSurrogate(Database *database, double p_min_Pa,
+	double p_max_Pa, double T_min_K, double T_max_K, double w_min,
+	double w_max, double max_rel_error, void *workingPair) {
+	// Typecast void pointer given as input to pointer of WorkingPair-struct
 	//
 	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
 
 	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_sur_p_wT");
+		if (status_report(STATUS_INVALID_STRUCT, "enableWorkingPairSurrogate",
+			0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nWorkingPair-struct does not exist.");
+		}
+		return -1;
 	}
 
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_sur_p_wT");
-		
-	} else if (retWorkingPair->adsorption->sur_p_wT==NULL) {
-		return warning_function("sur_p_wT", "ads_sur_p_wT");
+	disableWorkingPairSurrogate(retWorkingPair);
 
-	} else {
-		return retWorkingPair->adsorption->sur_p_wT(w_kgkg, T_K,
-			retWorkingPair->iso_par);
+	// Check which equilibrium functions exist and read missing limits
+	//
+	double limits[] = {p_min_Pa, p_max_Pa, T_min_K, T_max_K, w_min, w_max};
+	int exists[3];
 
+	if (workingPair_limits(limits, exists, database, retWorkingPair) == -1) {
+		return -1;
 	}
-}
 
+	Adsorption *adsorption = retWorkingPair->adsorption;
+	Absorption *absorption = retWorkingPair->absorption;
+	int mix = (adsorption == NULL && absorption->mix_x_pT != NULL);
 
-/*
- * ads_sur_T_pw:
- * -------------
- *
- * Calculates equilibrium temperature in K depending on equilibrium pressure p
- * in Pa and equilibrium loading w in kg/kg.
+    // Try to allocate memory for WorkingPairSurrogate-struct
+	//
+	WorkingPairSurrogate *surrogates = (WorkingPairSurrogate *) malloc(
+		sizeof(WorkingPairSurrogate));
+
+    if (surrogates == NULL) {
+		if (status_report(STATUS_NO_MEMORY, "enableWorkingPairSurrogate",
+			0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for WorkingPairSurrogate-struct.");
+		}
+        return -1;
+	}
+
+	surrogates->p_min_Pa = limits[0];
+	surrogates->p_max_Pa = limits[1];
+	surrogates->T_min_K = limits[2];
+	surrogates->T_max_K = limits[3];
+	surrogates->w_min = limits[4];
+	surrogates->w_max = limits[5];
+	retWorkingPair->surrogates = surrogates;
+
+	// Create surrogates: Pressures span several orders of magnitude and are
+	// thus approximated and used as variables by their logarithms
+	//
+	double ln_p_min = log(limits[0]);
+	double ln_p_max = log(limits[1]);
+	Surrogate2D **ret_surrogates[] = {&surrogates->w_pT, &surrogates->p_wT,
+		&surrogates->T_pw, &surrogates->y_1_pT, &surrogates->y_1_wT,
+		&surrogates->y_1_pw, &surrogates->y_2_pT, &surrogates->y_2_wT,
+		&surrogates->y_2_pw};
+	double (*functions[])(double, double, void*) = {
+		&workingPair_surrogate_w_lnpT, &workingPair_surrogate_p_wT,
+		&workingPair_surrogate_T_lnpw, &workingPair_surrogate_y_1_lnpT,
+		&workingPair_surrogate_y_1_wT, &workingPair_surrogate_y_1_lnpw,
+		&workingPair_surrogate_y_2_lnpT, &workingPair_surrogate_y_2_wT,
+		&workingPair_surrogate_y_2_lnpw};
+	double x_min[] = {ln_p_min, limits[4], ln_p_min};
+	double x_max[] = {ln_p_max, limits[5], ln_p_max};
+	double y_min[] = {limits[2], limits[2], limits[4]};
+	double y_max[] = {limits[3], limits[3], limits[5]};
+	int error = 0;
+
+	for (int i = 0; i < 9; i++) {
+		*ret_surrogates[i] = NULL;
+	}
+	for (int i = 0; i < 9 && !error; i++) {
+		// Vapor mole fractions are only approximated for mixing rules
+		//
+		int i_f = i % 3;
+
+		if (!exists[i_f] || (i >= 3 && !mix)) {
+			continue;
+		}
+
+		*ret_surrogates[i] = newSurrogate2D(functions[i], retWorkingPair,
+			i_f == 1 && i < 3, x_min[i_f], x_max[i_f], y_min[i_f],
+			y_max[i_f], max_rel_error);
+		error = (*ret_surrogates[i] == NULL);
+	}
+
+	if (error) {
+		if (status_report(STATUS_INVALID_INPUT, "enableWorkingPairSurrogate",
+			0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot create surrogates of working pair. Surrogates are "
+				"disabled.");
+		}
+		disableWorkingPairSurrogate(retWorkingPair);
+		return -1;
+	}
+
+	return 0;
+}
+
+
+/*
+ * disableWorkingPairSurrogate:
+ * ----------------------------
+ *
+ * Deletes surrogates of the equilibrium functions of a working pair. Thus,
+ * equilibrium functions evaluate the original equations afterwards.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
- * Returns:
- * --------
- * 	double:
- *		Equilibrium temperature in K.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach.
- *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_T_pw(double p_Pa, double w_kgkg, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API void disableWorkingPairSurrogate(void *workingPair) {
+	// Typecast void pointer given as input to pointer of WorkingPair-struct
 	//
 	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
 
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_sur_T_pw");
-	}
-
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_sur_T_pw");
-		
-	} else if (retWorkingPair->adsorption->sur_T_pw==NULL) {
-		return warning_function("sur_T_pw", "ads_sur_T_pw");
+	if (retWorkingPair != NULL && retWorkingPair->surrogates != NULL) {
+		WorkingPairSurrogate *surrogates = retWorkingPair->surrogates;
 
-	} else {
-		return retWorkingPair->adsorption->sur_T_pw(p_Pa, w_kgkg,
-			retWorkingPair->iso_par);
+		delSurrogate2D(surrogates->w_pT);
+		delSurrogate2D(surrogates->p_wT);
+		delSurrogate2D(surrogates->T_pw);
+		delSurrogate2D(surrogates->y_1_pT);
+		delSurrogate2D(surrogates->y_1_wT);
+		delSurrogate2D(surrogates->y_1_pw);
+		delSurrogate2D(surrogates->y_2_pT);
+		delSurrogate2D(surrogates->y_2_wT);
+		delSurrogate2D(surrogates->y_2_pw);
 
+		free(surrogates);
+		retWorkingPair->surrogates = NULL;
 	}
 }
 
 
 /*
- * ads_sur_dw_dp_pT:
- * -----------------
+ * workingPair_exact:
+ * ------------------
  *
- * Calculates derivative of equilibrium loading w with respect to pressure
- * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Auxiliary function to evaluate an original equilibrium function of a
+ * working pair with two inputs when creating surrogates. Depending on the type
+ * of the working pair, the function of adsorption, conventional absorption, or
+ * absorption based on mixing rules is evaluated.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
+ *	double *ret_y_1_molmol:
+ *		Equilibrium mole fraction of first component (i.e., only for mixing
+ *		rules).
+ *	double *ret_y_2_molmol:
+ *		Equilibrium mole fraction of second component (i.e., only for mixing
+ *		rules).
+ *	int function:
+ *		Function (i.e., 0 for w_pT, 1 for p_wT, and 2 for T_pw).
+ *	double x:
+ *		First input (i.e., logarithm of pressure in Pa or loading).
+ *	double y:
+ *		Second input (i.e., temperature in K or loading).
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach.
+ *		Value of original function.
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_dw_dp_pT(double p_Pa, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_sur_dw_dp_pT");
-	}
+double workingPair_exact(double *ret_y_1_molmol, double *ret_y_2_molmol,
+	int function, double x, double y, const WorkingPair *workingPair) {
+	// Initialize variables: Vapor mole fractions of adsorption and
+	// conventional absorption are not defined
+	//
+	Adsorption *adsorption = workingPair->adsorption;
+	Absorption *absorption = workingPair->absorption;
+	double p_Pa = (function == 1) ? 0 : exp(x);
+
+	*ret_y_1_molmol = -1;
+	*ret_y_2_molmol = -1;
+
+	if (adsorption != NULL) {
+		switch (function) {
+			case 0:
+				return adsorption->w_pT(p_Pa, y, workingPair->iso_par,
+					workingPair->psat_par, workingPair->rhol_par, adsorption,
+					workingPair->refrigerant);
+			case 1:
+				return adsorption->p_wT(x, y, workingPair->iso_par,
+					workingPair->psat_par, workingPair->rhol_par, adsorption,
+					workingPair->refrigerant);
+			default:
+				return adsorption->T_pw(p_Pa, y, workingPair->iso_par,
+					workingPair->psat_par, workingPair->rhol_par, adsorption,
+					workingPair->refrigerant);
+		}
 
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_sur_dw_dp_pT");
-		
-	} else if (retWorkingPair->adsorption->sur_dw_dp_pT==NULL) {
-		return warning_function("sur_dw_dp_pT", "ads_sur_dw_dp_pT");
+	} else if (absorption->mix_x_pT == NULL) {
+		switch (function) {
+			case 0:
+				return absorption->con_X_pT(p_Pa, y, workingPair->iso_par);
+			case 1:
+				return absorption->con_p_XT(x, y, workingPair->iso_par);
+			default:
+				return absorption->con_T_pX(p_Pa, y, workingPair->iso_par);
+		}
 
 	} else {
-		return retWorkingPair->adsorption->sur_dw_dp_pT(p_Pa, T_K,
-			retWorkingPair->iso_par);
+		switch (function) {
+			case 0:
+				return absorption->mix_x_pT(ret_y_1_molmol, ret_y_2_molmol,
+					p_Pa, y, workingPair->iso_par, absorption);
+			case 1:
+				return absorption->mix_p_Tx(ret_y_1_molmol, ret_y_2_molmol,
+					y, x, workingPair->iso_par, absorption);
+			default:
+				return absorption->mix_T_px(ret_y_1_molmol, ret_y_2_molmol,
+					p_Pa, y, workingPair->iso_par, absorption);
+		}
 
 	}
 }
 
 
 /*
- * ads_sur_dw_dT_pT:
- * -----------------
+ * workingPair_surrogate_w_lnpT:
+ * -----------------------------
  *
- * Calculates derivative of equilibrium loading w with respect to temperature
- * T in kg/kg/K depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Auxiliary function to calculate equilibrium loading, concentration, or
+ * liquid mole fraction depending on logarithm of pressure in Pa and
+ * temperature in K by the original equation when creating surrogates.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ *	double ln_p:
+ *		Logarithm of pressure in Pa.
  *	double T_K:
- *		Equilibrium temperature in K.
+ *		Temperature in K.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach.
+ *		Equilibrium loading, concentration, or liquid mole fraction.
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_dw_dT_pT(double p_Pa, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_sur_dw_dT_pT");
-	}
-
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_sur_dw_dT_pT");
-		
-	} else if (retWorkingPair->adsorption->sur_dw_dT_pT==NULL) {
-		return warning_function("sur_dw_dT_pT", "ads_sur_dw_dT_pT");
-
-	} else {
-		return retWorkingPair->adsorption->sur_dw_dT_pT(p_Pa, T_K,
-			retWorkingPair->iso_par);
+double workingPair_surrogate_w_lnpT(double ln_p, double T_K,
+	void *workingPair) {
+	double y_1_molmol;
+	double y_2_molmol;
 
-	}
+	return workingPair_exact(&y_1_molmol, &y_2_molmol, 0, ln_p, T_K,
+		(WorkingPair *) workingPair);
 }
 
 
 /*
- * ads_sur_dp_dw_wT:
- * -----------------
+ * workingPair_surrogate_p_wT:
+ * ---------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to loading
- * w in kgPa/kg depending on equilibrium loading w in kg/kg and equilibrium
- * temperature T in K.
+ * Auxiliary function to calculate equilibrium pressure in Pa depending on
+ * loading, concentration, or liquid mole fraction and temperature in K by the
+ * original equation when creating surrogates.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double w:
+ *		Loading, concentration, or liquid mole fraction.
  *	double T_K:
- *		Equilibrium temperature in K.
+ *		Temperature in K.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach.
+ *		Equilibrium pressure in Pa.
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_dp_dw_wT(double w_kgkg, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_sur_dp_dw_wT");
-	}
-
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_sur_dp_dw_wT");
-		
-	} else if (retWorkingPair->adsorption->sur_dp_dw_wT==NULL) {
-		return warning_function("sur_dp_dw_wT", "ads_sur_dp_dw_wT");
-
-	} else {
-		return retWorkingPair->adsorption->sur_dp_dw_wT(w_kgkg, T_K,
-			retWorkingPair->iso_par);
+double workingPair_surrogate_p_wT(double w, double T_K, void *workingPair) {
+	double y_1_molmol;
+	double y_2_molmol;
 
-	}
+	return workingPair_exact(&y_1_molmol, &y_2_molmol, 1, w, T_K,
+		(WorkingPair *) workingPair);
 }
 
 
 /*
- * ads_sur_dp_dT_wT:
- * -----------------
+ * workingPair_surrogate_T_lnpw:
+ * -----------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium loading w in kg/kg and equilibrium
- * temperature T in K.
+ * Auxiliary function to calculate equilibrium temperature in K depending on
+ * logarithm of pressure in Pa and loading, concentration, or liquid mole
+ * fraction by the original equation when creating surrogates.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
+ *	double ln_p:
+ *		Logarithm of pressure in Pa.
+ *	double w:
+ *		Loading, concentration, or liquid mole fraction.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach.
+ *		Equilibrium temperature in K.
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_dp_dT_wT(double w_kgkg, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_sur_dp_dT_wT");
-	}
-
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_sur_dp_dT_wT");
-		
-	} else if (retWorkingPair->adsorption->sur_dp_dT_wT==NULL) {
-		return warning_function("sur_dp_dT_wT", "ads_sur_dp_dT_wT");
+double workingPair_surrogate_T_lnpw(double ln_p, double w, void *workingPair) {
+	double y_1_molmol;
+	double y_2_molmol;
 
-	} else {
-		return retWorkingPair->adsorption->sur_dp_dT_wT(w_kgkg, T_K,
-			retWorkingPair->iso_par);
-
-	}
+	return workingPair_exact(&y_1_molmol, &y_2_molmol, 2, ln_p, w,
+		(WorkingPair *) workingPair);
 }
 
 
 /*
- * ads_sur_piStar_pyxgTM:
- * ----------------------
- *
- * Calculates reduced spreading pressure piStar in kg/mol depending on
- * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
- * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
- * activity coefficient of refrigerant in adsorbed phase, equilibrium
- * temperature T in K and molar mass of refrigerant M in kg/mol. The reduced
- * spreading pressure is defined as follows:
- *
- * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
- *		Integral_0^p0{w(p,T) / p * dp}
+ * workingPair_surrogate_y_1_lnpT:
+ * -------------------------------
  *
- *	where p0 = p_total*y / (gamma*x)
+ * Auxiliary function to calculate vapor mole fraction of first component
+ * depending on logarithm of pressure in Pa and temperature in K by the
+ * original equation when creating surrogates.
  *
  * Parameters:
  * -----------
- *	double p_total_Pa:
- *		Total pressure of vapor phase in Pa.
- *	double y_molmol:
- *		Molar fraction of refrigerant in vapor phase in mol/mol.
- *	double x_molmol:
- *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
- *	double gamma:
- *		Activity coefficient of refrigerant in adsorbed phase.
+ *	double ln_p:
+ *		Logarithm of pressure in Pa.
  *	double T_K:
- *		Equilibrium temperature in K.
- *	double M_kgmol:
- *		Molar mass of refrigerant M in kg/mol.
+ *		Temperature in K.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Reduced spreading pressure in kg/mol.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach.
+ *		Vapor mole fraction of first component (i.e., -1 if original equation
+ *		fails).
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_piStar_pyxgTM(double p_total_Pa, double y_molmol,
-	double x_molmol, double gamma, double T_K, double M_kgmol,
+double workingPair_surrogate_y_1_lnpT(double ln_p, double T_K,
 	void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_sur_piStar_pyxgTM");
-	}
-
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_sur_piStar_pyxgTM");
-		
-	} else if (retWorkingPair->adsorption->sur_piStar_pyxgTM==NULL) {
-		return warning_function("sur_piStar_pyxgTM", "ads_sur_piStar_pyxgTM");
-
-	} else {
-		return retWorkingPair->adsorption->sur_piStar_pyxgTM(p_total_Pa,
-			y_molmol, x_molmol, gamma, T_K, M_kgmol, retWorkingPair->iso_par);
+	double y_1_molmol;
+	double y_2_molmol;
+	double value = workingPair_exact(&y_1_molmol, &y_2_molmol, 0, ln_p, T_K,
+		(WorkingPair *) workingPair);
 
-	}
+	return (value == -1) ? -1 : y_1_molmol;
 }
 
 
 /*
- * ads_sur_w_pTpsat:
- * -----------------
+ * workingPair_surrogate_y_1_wT:
+ * -----------------------------
  *
- * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
- * p in Pa, equilibrium temperature T in K, and saturation pressure p_sat in Pa.
+ * Auxiliary function to calculate vapor mole fraction of first component
+ * depending on liquid mole fraction and temperature in K by the original
+ * equation when creating surrogates.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ *	double w:
+ *		Liquid mole fraction.
  *	double T_K:
- *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ *		Temperature in K.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium loading in kg/kg.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *		Vapor mole fraction of first component (i.e., -1 if original equation
+ *		fails).
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_w_pTpsat(double p_Pa, double T_K, double p_sat_Pa,
-	void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+double workingPair_surrogate_y_1_wT(double w, double T_K, void *workingPair) {
+	double y_1_molmol;
+	double y_2_molmol;
+	double value = workingPair_exact(&y_1_molmol, &y_2_molmol, 1, w, T_K,
+		(WorkingPair *) workingPair);
 
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_sur_w_pTpsat");
-	}
-
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_sur_w_pTpsat");
-		
-	} else if (retWorkingPair->adsorption->sur_w_pTpsat==NULL) {
-		return warning_function("sur_w_pTpsat", "ads_sur_w_pTpsat");
-
-	} else {
-		return retWorkingPair->adsorption->sur_w_pTpsat(p_Pa, T_K, p_sat_Pa,
-			retWorkingPair->iso_par);
-
-	}
-}
+	return (value == -1) ? -1 : y_1_molmol;
+}
 
 
 /*
- * ads_sur_p_wTpsat:
- * -----------------
+ * workingPair_surrogate_y_1_lnpw:
+ * -------------------------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
- * in kg/kg, equilibrium temperature T in K, and saturation pressure p_sat in
- * Pa.
+ * Auxiliary function to calculate vapor mole fraction of first component
+ * depending on logarithm of pressure in Pa and liquid mole fraction by the
+ * original equation when creating surrogates.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ *	double ln_p:
+ *		Logarithm of pressure in Pa.
+ *	double w:
+ *		Liquid mole fraction.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium pressure in Pa.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	double:
+ *		Vapor mole fraction of first component (i.e., -1 if original equation
+ *		fails).
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_p_wTpsat(double w_kgkg, double T_K, double p_sat_Pa,
+double workingPair_surrogate_y_1_lnpw(double ln_p, double w,
 	void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	double y_1_molmol;
+	double y_2_molmol;
+	double value = workingPair_exact(&y_1_molmol, &y_2_molmol, 2, ln_p, w,
+		(WorkingPair *) workingPair);
 
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_sur_p_wTpsat");
-	}
-
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_sur_p_wTpsat");
-		
-	} else if (retWorkingPair->adsorption->sur_p_wTpsat==NULL) {
-		return warning_function("sur_p_wTpsat", "ads_sur_p_wTpsat");
-
-	} else {
-		return retWorkingPair->adsorption->sur_p_wTpsat(w_kgkg, T_K, p_sat_Pa,
-			retWorkingPair->iso_par);
-
-	}
+	return (value == -1) ? -1 : y_1_molmol;
 }
 
 
 /*
- * ads_sur_T_pwpsat:
- * -----------------
+ * workingPair_surrogate_y_2_lnpT:
+ * -------------------------------
  *
- * Calculates equilibrium temperature in K depending on equilibrium pressure p
- * in Pa, equilibrium loading w in kg/kg, and saturation pressure p_sat in Pa.
+ * Auxiliary function to calculate vapor mole fraction of second component
+ * depending on logarithm of pressure in Pa and temperature in K by the
+ * original equation when creating surrogates.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ *	double ln_p:
+ *		Logarithm of pressure in Pa.
+ *	double T_K:
+ *		Temperature in K.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium temperature in K.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
- *	Uses internal equation of states to calculate vapor pressure and derivative
- *	of vapor pressure wrt. temperature. If equation of state is not implemented
- *	for refrigerant, function returns -1 and throws warning. If user want to use
- *	his own equation of state, this function cannot be used and determination of
- *	root to calculate T must be implemented by user.
+ *	double:
+ *		Vapor mole fraction of second component (i.e., -1 if original equation
+ *		fails).
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_T_pwpsat(double p_Pa, double w_kgkg, double p_sat_Pa,
+double workingPair_surrogate_y_2_lnpT(double ln_p, double T_K,
 	void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_sur_T_pwpsat");
-	}
-
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_sur_T_pwpsat");
-		
-	} else if (retWorkingPair->adsorption->sur_T_pwpsat==NULL) {
-		return warning_function("sur_T_pwpsat", "ads_sur_T_pwpsat");
-
-	} else if (retWorkingPair->refrigerant->p_sat_T==NULL) {
-		return warning_function("psat_T", "ads_sur_T_pwpsat");
-
-	} else if (retWorkingPair->refrigerant->dp_sat_dT==NULL) {
-		return warning_function("dpsat_dT", "ads_sur_T_pwpsat");
-
-	} else if (retWorkingPair->psat_par==NULL) {
-		return warning_parameter("saturation pressure and its derivative with "
-		"respect to temperature", "ads_sur_T_pwpsat");
-
-	} else {
-		// Avoid compiler warning C4100 by adding "do nothing" expression
-		// "Do nothing" expression will be optimized out by compiler
-		//
-		(p_sat_Pa) = (p_sat_Pa);
-
-		return retWorkingPair->adsorption->sur_T_pwpsat(p_Pa, w_kgkg,
-			retWorkingPair->refrigerant->p_sat_T,
-			retWorkingPair->refrigerant->dp_sat_dT,
-			retWorkingPair->iso_par, retWorkingPair->psat_par,
-			retWorkingPair->refrigerant);
+	double y_1_molmol;
+	double y_2_molmol;
+	double value = workingPair_exact(&y_1_molmol, &y_2_molmol, 0, ln_p, T_K,
+		(WorkingPair *) workingPair);
 
-	}
+	return (value == -1) ? -1 : y_2_molmol;
 }
 
 
 /*
- * ads_sur_dw_dp_pTpsat:
- * ---------------------
+ * workingPair_surrogate_y_2_wT:
+ * -----------------------------
  *
- * Calculates derivative of equilibrium loading w with respect to pressure
- * p in kg/kg/Pa depending on equilibrium pressure p in Pa, equilibrium
- * temperature T in K, and saturation pressure p_sat in Pa.
+ * Auxiliary function to calculate vapor mole fraction of second component
+ * depending on liquid mole fraction and temperature in K by the original
+ * equation when creating surrogates.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ *	double w:
+ *		Liquid mole fraction.
  *	double T_K:
- *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ *		Temperature in K.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *		Vapor mole fraction of second component (i.e., -1 if original equation
+ *		fails).
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_dw_dp_pTpsat(double p_Pa, double T_K, double p_sat_Pa,
-	void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_sur_dw_dp_pTpsat");
-	}
-
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_sur_dw_dp_pTpsat");
-		
-	} else if (retWorkingPair->adsorption->sur_dw_dp_pTpsat==NULL) {
-		return warning_function("sur_dw_dp_pTpsat", "ads_sur_dw_dp_pTpsat");
+double workingPair_surrogate_y_2_wT(double w, double T_K, void *workingPair) {
+	double y_1_molmol;
+	double y_2_molmol;
+	double value = workingPair_exact(&y_1_molmol, &y_2_molmol, 1, w, T_K,
+		(WorkingPair *) workingPair);
 
-	} else {
-		return retWorkingPair->adsorption->sur_dw_dp_pTpsat(p_Pa, T_K, p_sat_Pa,
-			retWorkingPair->iso_par);
-
-	}
+	return (value == -1) ? -1 : y_2_molmol;
 }
 
 
 /*
- * ads_sur_dw_dT_pTpsat:
- * ---------------------
+ * workingPair_surrogate_y_2_lnpw:
+ * -------------------------------
  *
- * Calculates derivative of equilibrium loading w with respect to temperature
- * T in kg/kg/K depending on equilibrium pressure p in Pa, equilibrium
- * temperature T in K, saturation pressure p_sat in Pa, and derivative of
- * saturation pressure wrt. temperature dp_sat_dT in Pa/K.
+ * Auxiliary function to calculate vapor mole fraction of second component
+ * depending on logarithm of pressure in Pa and liquid mole fraction by the
+ * original equation when creating surrogates.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
- * 	double dp_sat_dT_PaK:
- *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ *	double ln_p:
+ *		Logarithm of pressure in Pa.
+ *	double w:
+ *		Liquid mole fraction.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *		Vapor mole fraction of second component (i.e., -1 if original equation
+ *		fails).
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_dw_dT_pTpsat(double p_Pa, double T_K, double p_sat_Pa,
-	double dp_sat_dT_PaK, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_sur_dw_dT_pTpsat");
-	}
-
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_sur_dw_dT_pTpsat");
-		
-	} else if (retWorkingPair->adsorption->sur_dw_dT_pTpsat==NULL) {
-		return warning_function("sur_dw_dT_pTpsat", "ads_sur_dw_dT_pTpsat");
-
-	} else {
-		return retWorkingPair->adsorption->sur_dw_dT_pTpsat(p_Pa, T_K, p_sat_Pa,
-			dp_sat_dT_PaK, retWorkingPair->iso_par);
+double workingPair_surrogate_y_2_lnpw(double ln_p, double w,
+	void *workingPair) {
+	double y_1_molmol;
+	double y_2_molmol;
+	double value = workingPair_exact(&y_1_molmol, &y_2_molmol, 2, ln_p, w,
+		(WorkingPair *) workingPair);
 
-	}
+	return (value == -1) ? -1 : y_2_molmol;
 }
 
 
 /*
- * ads_sur_dp_dw_wTpsat:
- * ---------------------
+ * workingPair_limits:
+ * -------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to loading
- * w in kgPa/kg depending on equilibrium loading w in kg/kg, equilibrium
- * temperature T in K, and saturation pressure p_sat in Pa.
+ * Auxiliary function to check which equilibrium functions of a working pair
+ * with two inputs exist and to read missing limits of pressure, temperature,
+ * and loading from the range of validity of the isotherm given by the
+ * database. Limits whose minimum is not smaller than its maximum are missing.
+ * If no equilibrium function exists or limits are not available, function
+ * returns -1 and prints a warning.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ *	double *ret_limits:
+ *		Array containing minimum and maximum of pressure in Pa, temperature in
+ *		K, and loading. Missing limits are replaced.
+ *	int *ret_exists:
+ *		Array indicating whether functions w_pT, p_wT, and T_pw exist.
+ *	struct *Database:
+ *		Pointer of Database-struct (i.e., may be NULL if all limits are given).
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- *	double:
- *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *	int:
+ *		Returns 0 if limits are valid and -1 otherwise.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	Functions based on activity coefficients have more than two inputs and do
+ *	not exist in this sense.
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_dp_dw_wTpsat(double w_kgkg, double T_K, double p_sat_Pa,
-	void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+int workingPair_limits(double *ret_limits, int *ret_exists,
+	Database *database, const WorkingPair *workingPair) {
+	// Check which equilibrium functions exist
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	Adsorption *adsorption = workingPair->adsorption;
+	Absorption *absorption = workingPair->absorption;
+
+	if (adsorption != NULL) {
+		ret_exists[0] = (adsorption->w_pT != NULL);
+		ret_exists[1] = (adsorption->p_wT != NULL);
+		ret_exists[2] = (adsorption->T_pw != NULL);
+
+	} else {
+		ret_exists[0] = (absorption->con_X_pT != NULL ||
+			absorption->mix_x_pT != NULL);
+		ret_exists[1] = (absorption->con_p_XT != NULL ||
+			absorption->mix_p_Tx != NULL);
+		ret_exists[2] = (absorption->con_T_pX != NULL ||
+			absorption->mix_T_px != NULL);
 
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_sur_dp_dw_wTpsat");
 	}
 
-	// Check if isotherm function exists for chosen isotherm type
+	if (!ret_exists[0] && !ret_exists[1] && !ret_exists[2]) {
+		if (status_report(STATUS_INVALID_INPUT, "workingPair_limits", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nIsotherm \"%s\" has no equilibrium functions that can be "
+				"approximated.", workingPair->wp_iso);
+		}
+		return -1;
+	}
+
+	// Read missing limits from range of validity of isotherm
 	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_sur_dp_dw_wTpsat");
-		
-	} else if (retWorkingPair->adsorption->sur_dp_dw_wTpsat==NULL) {
-		return warning_function("sur_dp_dw_wTpsat", "ads_sur_dp_dw_wTpsat");
+	const char *names[] = {"pressure-min", "pressure-max", "temperature-min",
+		"temperature-max", "loading-min", "loading-max"};
+	cJSON *json_isotherm = NULL;
 
-	} else {
-		return retWorkingPair->adsorption->sur_dp_dw_wTpsat(w_kgkg, T_K,
-			 p_sat_Pa, retWorkingPair->iso_par);
+	for (int i = 0; i < 6; i += 2) {
+		if (ret_limits[i] < ret_limits[i + 1]) {
+			continue;
+		}
+
+		if (json_isotherm == NULL && database != NULL) {
+			int wp_tp;
+			json_isotherm = json_search_equation(workingPair->wp_as,
+				workingPair->wp_st, workingPair->wp_rf, &wp_tp,
+				database->json_file);
+		}
+
+		if (json_isotherm == NULL ||
+			json_search_validity(&ret_limits[i], workingPair->wp_iso,
+				workingPair->no_iso, names[i], json_isotherm) == -1 ||
+			json_search_validity(&ret_limits[i + 1], workingPair->wp_iso,
+				workingPair->no_iso, names[i + 1], json_isotherm) == -1 ||
+			!(ret_limits[i] < ret_limits[i + 1])) {
+			if (status_report(STATUS_INVALID_INPUT, "workingPair_limits",
+				0, 0)) {
+				printf("\n\n###########\n# Warning #\n###########");
+				printf("\nCannot approximate equilibrium functions because "
+					"limits \"%s\" and \"%s\" are neither given nor valid in "
+					"database.",
+					names[i], names[i + 1]);
+			}
+			return -1;
+		}
+	}
 
+	if (ret_limits[0] <= 0) {
+		if (status_report(STATUS_INVALID_INPUT, "workingPair_limits", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot approximate equilibrium functions because lower "
+				"limit of pressure is not positive.");
+		}
+		return -1;
 	}
+
+	return 0;
 }
 
 
 /*
- * ads_sur_dp_dT_wTpsat:
- * ---------------------
+ * enableWorkingPairTable:
+ * -----------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium loading w in kg/kg, equilibrium
- * temperature T in K, saturation pressure p_sat in Pa, and derivative of
- * saturation pressure wrt. temperature dp_sat_dT in Pa/K.
+ * Creates spline tables of the equilibrium functions of a working pair with
+ * two inputs (i.e., w_pT, p_wT, and T_pw for adsorption, X_pT, p_XT, and T_pX
+ * for conventional absorption, and x_pT, p_Tx, and T_px for absorption based
+ * on mixing rules). Values and partial derivatives at the nodes are calculated
+ * by the original equations and their analytical derivatives. Thus, the
+ * functions tab_* are continuously differentiable and consistent with their
+ * derivatives afterwards. Limits whose minimum is not smaller than its maximum
+ * are read from the range of validity of the isotherm given by the database.
+ * If limits are not available, the lower limit of loading is not positive, or
+ * tables cannot be created, tables are disabled, function returns -1, and
+ * prints a warning.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
- * 	double dp_sat_dT_PaK:
- *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ * 	struct *Database:
+ *		Pointer of Database-struct (i.e., may be NULL if all limits are given).
+ *	double p_min_Pa:
+ *		Lower limit of pressure in Pa.
+ *	double p_max_Pa:
+ *		Upper limit of pressure in Pa.
+ *	double T_min_K:
+ *		Lower limit of temperature in K.
+ *	double T_max_K:
+ *		Upper limit of temperature in K.
+ *	double w_min:
+ *		Lower limit of loading in kg/kg, concentration in kg/kg, or liquid
+ *		mole fraction in mol/mol.
+ *	double w_max:
+ *		Upper limit of loading in kg/kg, concentration in kg/kg, or liquid
+ *		mole fraction in mol/mol.
+ *	int no_nodes:
+ *		Number of nodes per variable.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *	int:
+ *		Returns 0 if tables are created and -1 otherwise.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	Tables are owned by the working pair and are neither shared with clones
+ *	nor serialized. They must not be enabled or disabled while other threads
+ *	use the working pair. Nodes where the original equations or their
+ *	derivatives fail or are inconsistent with the inverse functions are
+ *	invalid, and cells containing invalid nodes are evaluated by the original
+ *	equations.
  *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_dp_dT_wTpsat(double w_kgkg, double T_K, double p_sat_Pa,
-	double dp_sat_dT_PaK, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API int enableWorkingPairTable(Database *database, double p_min_Pa,
+	double p_max_Pa, double T_min_K, double T_max_K, double w_min,
+	double w_max, int no_nodes, void *workingPair) {
+	// Typecast void pointer given as input to pointer of WorkingPair-struct
 	//
 	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
 
 	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_sur_dp_dT_wTpsat");
+		if (status_report(STATUS_INVALID_STRUCT, "enableWorkingPairTable",
+			0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nWorkingPair-struct does not exist.");
+		}
+		return -1;
 	}
 
-	// Check if isotherm function exists for chosen isotherm type
+	disableWorkingPairTable(retWorkingPair);
+
+	// Check which equilibrium functions exist and read missing limits
 	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_sur_dp_dT_wTpsat");
-		
-	} else if (retWorkingPair->adsorption->sur_dp_dT_wTpsat==NULL) {
-		return warning_function("sur_dp_dT_wTpsat", "ads_sur_dp_dT_wTpsat");
+	double limits[] = {p_min_Pa, p_max_Pa, T_min_K, T_max_K, w_min, w_max};
+	int exists[3];
 
-	} else {
-		return retWorkingPair->adsorption->sur_dp_dT_wTpsat(w_kgkg, T_K,
-			p_sat_Pa, dp_sat_dT_PaK, retWorkingPair->iso_par);
+	if (workingPair_limits(limits, exists, database, retWorkingPair) == -1) {
+		return -1;
+	}
+
+	if (!(limits[4] > 0)) {
+		if (status_report(STATUS_INVALID_INPUT, "enableWorkingPairTable",
+			0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot create tables because lower limit of loading %f "
+				"is not positive.", limits[4]);
+		}
+		return -1;
+	}
+
+	// Try to allocate memory for WorkingPairTable-struct
+	//
+	WorkingPairTable *tables = (WorkingPairTable *) malloc(
+		sizeof(WorkingPairTable));
+
+    if (tables == NULL) {
+		if (status_report(STATUS_NO_MEMORY, "enableWorkingPairTable", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for WorkingPairTable-struct.");
+		}
+        return -1;
+	}
+
+	tables->p_min_Pa = limits[0];
+	tables->p_max_Pa = limits[1];
+	tables->T_min_K = limits[2];
+	tables->T_max_K = limits[3];
+	tables->w_min = limits[4];
+	tables->w_max = limits[5];
+	tables->w_pT = NULL;
+	tables->p_wT = NULL;
+	tables->T_pw = NULL;
+	retWorkingPair->tables = tables;
+
+	// Create tables: Pressures and loadings span several orders of magnitude
+	// and are thus tabulated and used as variables by their logarithms
+	//
+	double ln_p_min = log(limits[0]);
+	double ln_p_max = log(limits[1]);
+	double ln_w_min = log(limits[4]);
+	double ln_w_max = log(limits[5]);
+	Spline2D **ret_splines[] = {&tables->w_pT, &tables->p_wT, &tables->T_pw};
+	double x_min[] = {ln_p_min, ln_w_min, ln_p_min};
+	double x_max[] = {ln_p_max, ln_w_max, ln_p_max};
+	double y_min[] = {limits[2], limits[2], ln_w_min};
+	double y_max[] = {limits[3], limits[3], ln_w_max};
+
+	for (int i_f = 0; i_f < 3; i_f++) {
+		if (!exists[i_f]) {
+			continue;
+		}
+
+		Spline2D *spline = newSpline2D(no_nodes, no_nodes, x_min[i_f],
+			x_max[i_f], y_min[i_f], y_max[i_f]);
+
+		if (spline == NULL) {
+			if (status_report(STATUS_INVALID_INPUT, "enableWorkingPairTable",
+				0, 0)) {
+				printf("\n\n###########\n# Warning #\n###########");
+				printf("\nCannot create tables of working pair. Tables are "
+					"disabled.");
+			}
+			disableWorkingPairTable(retWorkingPair);
+			return -1;
+		}
+		*ret_splines[i_f] = spline;
+
+		// Evaluate original equations and their derivatives at nodes
+		//
+		for (int i_x = 0; i_x < no_nodes; i_x++) {
+			for (int i_y = 0; i_y < no_nodes; i_y++) {
+				int node = i_x * no_nodes + i_y;
+				double x = x_min[i_f] + i_x * spline->h_x;
+				double y = y_min[i_f] + i_y * spline->h_y;
+				double y_1_molmol;
+				double y_2_molmol;
+				double value = workingPair_exact(&y_1_molmol, &y_2_molmol,
+					i_f, (i_f == 1) ? exp(x) : x, (i_f == 2) ? exp(y) : y,
+					retWorkingPair);
+
+				if (!surrogate_finite(value) || value == -1 ||
+					(i_f != 2 && value <= 0)) {
+					continue;
+				}
+
+				// Check node by inverse function: Iterative solvers may
+				// return values without convergence
+				//
+				double check = workingPair_exact(&y_1_molmol, &y_2_molmol,
+					(i_f == 0) ? 1 : 0, (i_f == 0) ? value : ((i_f == 1) ?
+					log(value) : x), (i_f == 2) ? value : y, retWorkingPair);
+				double reference = exp((i_f == 2) ? y : x);
+
+				if (!(fabs(check - reference) <=
+					WORKINGPAIR_TABLE_TOLERANCE * reference)) {
+					continue;
+				}
+
+				spline->f[node] = (i_f == 2) ? value : log(value);
+				spline->valid[node] = (workingPair_derivatives(
+					&spline->f_x[node], &spline->f_y[node], i_f, x, y,
+					spline->f[node], retWorkingPair) == 0);
+			}
+		}
 
+		spline2D_mixed_derivatives(spline);
 	}
+
+	return 0;
 }
 
 
 /*
- * ads_sur_piStar_pyxgTpsatM:
- * --------------------------
- *
- * Calculates reduced spreading pressure piStar in kg/mol depending on
- * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
- * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
- * activity coefficient of refrigerant in adsorbed phase, equilibrium
- * temperature T in K, saturation pressure p_sat in Pa, and molar mass of
- * refrigerant M in kg/mol. The reduced spreading pressure is defined as
- * follows:
- *
- * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
- *		Integral_0^p0{w(p,T) / p * dp}
+ * disableWorkingPairTable:
+ * ------------------------
  *
- *	where p0 = p_total*y / (gamma*x)
+ * Deletes spline tables of the equilibrium functions of a working pair. Thus,
+ * the functions tab_* evaluate the original equations afterwards.
  *
  * Parameters:
  * -----------
- *	double p_total_Pa:
- *		Total pressure of vapor phase in Pa.
- *	double y_molmol:
- *		Molar fraction of refrigerant in vapor phase in mol/mol.
- *	double x_molmol:
- *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
- *	double gamma:
- *		Activity coefficient of refrigerant in adsorbed phase.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
- *	double M_kgmol:
- *		Molar mass of refrigerant M in kg/mol.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
- * Returns:
- * --------
- *	double:
- *		Reduced spreading pressure in kg/mol.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
- *
  * History:
  * --------
- *	03/27/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_sur_piStar_pyxgTpsatM(double p_total_Pa, double y_molmol,
-	double x_molmol, double gamma, double T_K, double p_sat_Pa, double M_kgmol,
-	void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API void disableWorkingPairTable(void *workingPair) {
+	// Typecast void pointer given as input to pointer of WorkingPair-struct
 	//
 	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
 
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_sur_piStar_pyxgTpsatM");
-	}
-
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_sur_piStar_pyxgTpsatM");
-		
-	} else if (retWorkingPair->adsorption->sur_piStar_pyxgTpsatM==NULL) {
-		return warning_function("sur_piStar_pyxgTpsatM",
-			"ads_sur_piStar_pyxgTpsatM");
-
-	} else {
-		return retWorkingPair->adsorption->sur_piStar_pyxgTpsatM(p_total_Pa,
-			y_molmol, x_molmol, gamma, T_K, p_sat_Pa, M_kgmol,
-			retWorkingPair->iso_par);
+	if (retWorkingPair != NULL && retWorkingPair->tables != NULL) {
+		delSpline2D(retWorkingPair->tables->w_pT);
+		delSpline2D(retWorkingPair->tables->p_wT);
+		delSpline2D(retWorkingPair->tables->T_pw);
 
+		free(retWorkingPair->tables);
+		retWorkingPair->tables = NULL;
 	}
 }
 
 
 /*
- * ads_vol_W_ARho:
- * ---------------
+ * exportWorkingPairTable:
+ * -----------------------
  *
- * Calculates equilibrium volumetric loading W in m³/kg depending on equilibrium
- * adsorption potential A in J/mol and saturated liquid density of adsorpt rho_l
- * in kg/m3.
+ * Writes spline tables of a working pair to a JSON-file. Besides the names
+ * defining the working pair and the limits of the tables, the file contains
+ * for each table the grid and the values, partial derivatives, mixed partial
+ * derivatives, and validity of all nodes. Thus, tables can be loaded by
+ * loadWorkingPairTable without evaluating the original equations again. If
+ * tables are not enabled or file cannot be written, function returns -1 and
+ * prints a warning.
  *
  * Parameters:
  * -----------
- * 	double A_Jmol:
- *		Equilibrium adsorption potential A in J/mol.
- * 	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ *	const char *path_table:
+ *		Path to JSON-file that shall be written.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- *	double:
- *		Equilibrium volumetric loading W in m³/kg.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
- *	Saturated liquid density of adsorpt is required to calculate volumetric
- *	loading from characteristic curve in m3/kg when coefficients would directly
- *	return loading w in kg/kg. Therefore, function checks unit of coefficients
- *	by checking isotherm coefficients.
+ *	int:
+ *		Returns 0 if file is written and -1 otherwise.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_W_ARho(double A_Jmol, double rho_l_kgm3,
+DLL_API int exportWorkingPairTable(const char *path_table,
 	void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+	// Typecast void pointer given as input to pointer of WorkingPair-struct
 	//
 	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
 
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_vol_W_ARho");
+	if (retWorkingPair == NULL || retWorkingPair->tables == NULL) {
+		if (status_report(STATUS_INVALID_INPUT, "exportWorkingPairTable",
+			0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot export tables because tables of working pair are "
+				"not enabled.");
+		}
+		return -1;
+	}
+
+	// Create tree of JSON-structs
+	//
+	WorkingPairTable *tables = retWorkingPair->tables;
+	cJSON *json = cJSON_CreateObject();
+	cJSON *json_tables = cJSON_CreateObject();
+	const char *names[] = {"w_pT", "p_wT", "T_pw"};
+	Spline2D *splines[] = {tables->w_pT, tables->p_wT, tables->T_pw};
+	int error = (json == NULL || json_tables == NULL);
+
+	if (!error) {
+		cJSON_AddItemToObject(json, "tables", json_tables);
+		error = (cJSON_AddStringToObject(json, "sorbent",
+				retWorkingPair->wp_as) == NULL ||
+			cJSON_AddStringToObject(json, "subtype",
+				retWorkingPair->wp_st) == NULL ||
+			cJSON_AddStringToObject(json, "refrigerant",
+				retWorkingPair->wp_rf) == NULL ||
+			cJSON_AddStringToObject(json, "isotherm",
+				retWorkingPair->wp_iso) == NULL ||
+			cJSON_AddNumberToObject(json, "isotherm-ID",
+				retWorkingPair->no_iso) == NULL ||
+			cJSON_AddNumberToObject(json, "pressure-min",
+				tables->p_min_Pa) == NULL ||
+			cJSON_AddNumberToObject(json, "pressure-max",
+				tables->p_max_Pa) == NULL ||
+			cJSON_AddNumberToObject(json, "temperature-min",
+				tables->T_min_K) == NULL ||
+			cJSON_AddNumberToObject(json, "temperature-max",
+				tables->T_max_K) == NULL ||
+			cJSON_AddNumberToObject(json, "loading-min",
+				tables->w_min) == NULL ||
+			cJSON_AddNumberToObject(json, "loading-max",
+				tables->w_max) == NULL);
+	}
+
+	for (int i_f = 0; i_f < 3 && !error; i_f++) {
+		if (splines[i_f] != NULL) {
+			cJSON *json_spline = json_create_spline(splines[i_f]);
+			error = (json_spline == NULL);
+
+			if (!error) {
+				cJSON_AddItemToObject(json_tables, names[i_f], json_spline);
+			}
+		}
 	}
 
-	// Check if isotherm function exists for chosen isotherm type
+	// Write content of tree of JSON-structs to file
 	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_vol_W_ARho");
-		
-	} else if (retWorkingPair->adsorption->vol_W_ARho==NULL) {
-		return warning_function("vol_W_ARho", "ads_vol_W_ARho");
+	char *content = error ? NULL : cJSON_PrintUnformatted(json);
+	FILE *fp = NULL;
 
-	} else {
-		return retWorkingPair->adsorption->vol_W_ARho(A_Jmol, rho_l_kgm3,
-			retWorkingPair->iso_par);
+	if (content != NULL) {
+		#ifdef __unix
+		fp = fopen(path_table, "wb");
+		#else
+		if (fopen_s(&fp, path_table, "wb") != 0) {
+			fp = NULL;
+		}
+		#endif
+	}
+
+	error = (fp == NULL || fputs(content, fp) == EOF);
 
+	if (fp != NULL) {
+		error = (fclose(fp) != 0) || error;
 	}
+
+	free(content);
+	cJSON_Delete(json);
+
+	if (error) {
+		if (status_report(STATUS_INVALID_INPUT, "exportWorkingPairTable",
+			0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot write tables of working pair to file \"%s\".",
+				path_table);
+		}
+		return -1;
+	}
+
+	return 0;
 }
 
 
 /*
- * ads_vol_A_WRho:
- * ---------------
+ * loadWorkingPairTable:
+ * ---------------------
  *
- * Calculates equilibrium adsorption potential A in J/mol depending on
- * equilibrium volumetric loading W in m³/kg and saturated liquid density of
- * adsorpt rho_l in kg/m3.
+ * Reads spline tables of a working pair from a JSON-file that is written by
+ * exportWorkingPairTable. Afterwards, the functions tab_* use these tables.
+ * If file cannot be read, belongs to another working pair, or contains invalid
+ * tables, tables are disabled, function returns -1, and prints a warning.
  *
  * Parameters:
  * -----------
- * 	double W_m3kg:
- *		Equilibrium volumetric loading W in m³/kg.
- * 	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ *	const char *path_table:
+ *		Path to JSON-file that shall be read.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- *	double:
- *		Equilibrium adsorption potential A in J/mol.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
- *	Saturated liquid density of adsorpt is required to calculate volumetric
- *	loading from characteristic curve in m3/kg when coefficients would directly
- *	return loading w in kg/kg.
+ *	int:
+ *		Returns 0 if tables are loaded and -1 otherwise.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_A_WRho(double W_m3kg, double rho_l_kgm3,
-	void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API int loadWorkingPairTable(const char *path_table, void *workingPair) {
+	// Typecast void pointer given as input to pointer of WorkingPair-struct
 	//
 	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
 
 	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_vol_A_WRho");
+		if (status_report(STATUS_INVALID_STRUCT, "loadWorkingPairTable",
+			0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nWorkingPair-struct does not exist.");
+		}
+		return -1;
 	}
 
-	// Check if isotherm function exists for chosen isotherm type
+	disableWorkingPairTable(retWorkingPair);
+
+	// Read and parse file
 	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_vol_A_WRho");
-		
-	} else if (retWorkingPair->adsorption->vol_A_WRho==NULL) {
-		return warning_function("vol_A_WRho", "ads_vol_A_WRho");
+	char *content = json_read_file(path_table);
 
-	} else {
-		return retWorkingPair->adsorption->vol_A_WRho(W_m3kg, rho_l_kgm3,
-			retWorkingPair->iso_par);
+	if (content == NULL) {
+		return -1;
+	}
+
+	cJSON *json = json_parse_file(content);
+	free(content);
+
+	if (json == NULL) {
+		return -1;
+	}
 
+	// Check that tables belong to working pair
+	//
+	const char *names_wp[] = {"sorbent", "subtype", "refrigerant",
+		"isotherm"};
+	const char *values_wp[] = {retWorkingPair->wp_as, retWorkingPair->wp_st,
+		retWorkingPair->wp_rf, retWorkingPair->wp_iso};
+	cJSON *json_id = cJSON_GetObjectItemCaseSensitive(json, "isotherm-ID");
+	int error = (!cJSON_IsNumber(json_id) ||
+		json_id->valueint != retWorkingPair->no_iso);
+
+	for (int i = 0; i < 4 && !error; i++) {
+		cJSON *json_name = cJSON_GetObjectItemCaseSensitive(json,
+			names_wp[i]);
+		error = (!cJSON_IsString(json_name) ||
+			strcmp(json_name->valuestring, values_wp[i]) != 0);
+	}
+
+	if (error) {
+		if (status_report(STATUS_INVALID_INPUT, "loadWorkingPairTable", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nTables of file \"%s\" do not belong to working pair.",
+				path_table);
+		}
+		cJSON_Delete(json);
+		return -1;
+	}
+
+    // Try to allocate memory for WorkingPairTable-struct and read limits
+	//
+	WorkingPairTable *tables = (WorkingPairTable *) malloc(
+		sizeof(WorkingPairTable));
+
+    if (tables == NULL) {
+		if (status_report(STATUS_NO_MEMORY, "loadWorkingPairTable", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for WorkingPairTable-struct.");
+		}
+		cJSON_Delete(json);
+        return -1;
+	}
+
+	tables->w_pT = NULL;
+	tables->p_wT = NULL;
+	tables->T_pw = NULL;
+	retWorkingPair->tables = tables;
+
+	const char *names_limits[] = {"pressure-min", "pressure-max",
+		"temperature-min", "temperature-max", "loading-min", "loading-max"};
+	double *limits[] = {&tables->p_min_Pa, &tables->p_max_Pa,
+		&tables->T_min_K, &tables->T_max_K, &tables->w_min, &tables->w_max};
+
+	for (int i = 0; i < 6 && !error; i++) {
+		cJSON *json_limit = cJSON_GetObjectItemCaseSensitive(json,
+			names_limits[i]);
+		error = !cJSON_IsNumber(json_limit);
+		*limits[i] = error ? 0 : json_limit->valuedouble;
+	}
+
+	// Read tables
+	//
+	cJSON *json_tables = cJSON_GetObjectItemCaseSensitive(json, "tables");
+	const char *names[] = {"w_pT", "p_wT", "T_pw"};
+	Spline2D **ret_splines[] = {&tables->w_pT, &tables->p_wT, &tables->T_pw};
+
+	error = error || !cJSON_IsObject(json_tables);
+
+	for (int i_f = 0; i_f < 3 && !error; i_f++) {
+		cJSON *json_spline = cJSON_GetObjectItemCaseSensitive(json_tables,
+			names[i_f]);
+
+		if (json_spline != NULL) {
+			*ret_splines[i_f] = json_read_spline(json_spline);
+			error = (*ret_splines[i_f] == NULL);
+		}
+	}
+
+	cJSON_Delete(json);
+
+	if (error) {
+		if (status_report(STATUS_INVALID_INPUT, "loadWorkingPairTable", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nFile \"%s\" contains invalid tables. Tables are "
+				"disabled.",
+				path_table);
+		}
+		disableWorkingPairTable(retWorkingPair);
+		return -1;
 	}
+
+	return 0;
 }
 
 
 /*
- * ads_vol_w_pTpsatRho:
- * --------------------
+ * newWorkingPairWithTable:
+ * ------------------------
  *
- * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
- * p in Pa, equilibrium temperature T in K, saturation pressure p_Sat in Pa and
- * saturated liquid density of adsorpt rho in kg/m³.
+ * Initialization function to create a new WorkingPair-struct like
+ * newWorkingPair and to load spline tables of the working pair from a
+ * JSON-file written by exportWorkingPairTable afterwards. Thus, simulation
+ * tools that can only call a constructor (e.g., external objects of Modelica)
+ * can use the functions tab_* with tables. If path to tables is empty, no
+ * tables are loaded. If tables cannot be loaded, function prints a warning
+ * and the functions tab_* evaluate the original equations.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt in kg/m³.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *	const char *path_table:
+ *		Path to JSON-file containing tables (i.e., may be empty).
  *
  * Returns:
  * --------
- *	double:
- *		Equilibrium loading in kg/kg.
+ *	struct *WorkingPair:
+ *		Returns malloc-ed WorkingPair-struct containing all information required
+ *		to calculate the resorption equilibrium of the working working.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_w_pTpsatRho(double p_Pa, double T_K, double p_sat_Pa,
-	double rho_kgm3, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API WorkingPair *newWorkingPairWithTable(const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol, const char *path_table) {
+	// Create working pair first
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	WorkingPair *retWorkingPair = newWorkingPair(path_db, wp_as, wp_st, wp_rf,
+		wp_iso, no_iso, rf_psat, no_p_sat, rf_rhol, no_rhol);
 
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_vol_w_pTpsatRho");
+	// Load tables: Working pair is still usable without tables
+	//
+	if (retWorkingPair != NULL && path_table != NULL &&
+		path_table[0] != '\0') {
+		loadWorkingPairTable(path_table, retWorkingPair);
 	}
 
-	// Check if isotherm function exists for chosen isotherm type
+	// Return structure
 	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_vol_w_pTpsatRho");
-		
-	} else if (retWorkingPair->adsorption->vol_w_pTpsatRho==NULL) {
-		return warning_function("vol_w_pTpsatRho", "ads_vol_w_pTpsatRho");
-
-	} else {
-		return retWorkingPair->adsorption->vol_w_pTpsatRho(p_Pa, T_K, p_sat_Pa,
-			rho_kgm3, retWorkingPair->iso_par);
-
-	}
+	return retWorkingPair;
 }
 
 
 /*
- * ads_vol_p_wTpsatRho:
- * --------------------
+ * workingPair_partials:
+ * ---------------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium loading w in
- * kg/kg, equilibrium temperature T in K, saturation pressure p_Sat in Pa and
- * density of adsorpt rho in kg/m³.
+ * Auxiliary function to calculate partial derivatives of an equilibrium
+ * function of a working pair with two inputs by the analytical derivatives of
+ * the original equations. Derivatives of inverse functions (e.g., T_pw of
+ * adsorption) are calculated by the implicit function theorem. If required
+ * derivatives do not exist or are not finite, function returns -1.
  *
  * Parameters:
  * -----------
- * 	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double *ret_df_dx:
+ *		Partial derivative wrt. first input.
+ *	double *ret_df_dy:
+ *		Partial derivative wrt. second input.
+ *	int function:
+ *		Function (i.e., 0 for w_pT, 1 for p_wT, and 2 for T_pw).
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
+ * 	double w:
+ *		Equilibrium loading, concentration, or liquid mole fraction.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- *	double:
- *		Equilibrium pressure in Pa.
+ *	int:
+ *		Returns 0 if derivatives are calculated and -1 otherwise.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *	Loading is only required for mixing rules and temperature is only required
+ *	for T_pw. Thus, other inputs can be arbitrary.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_p_wTpsatRho(double w_kgkg, double T_K, double p_sat_Pa,
-	double rho_kgm3, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+int workingPair_partials(double *ret_df_dx, double *ret_df_dy, int function,
+	double p_Pa, double T_K, double w, const WorkingPair *workingPair) {
+	// Calculate derivatives of loading wrt. pressure and temperature or of
+	// pressure wrt. loading and temperature
+	//
+	Adsorption *adsorption = workingPair->adsorption;
+	Absorption *absorption = workingPair->absorption;
+	double dw_dp = 0;
+	double dw_dT = 0;
+	double dp_dw = 0;
+	double dp_dT = 0;
+
+	if (adsorption != NULL) {
+		if (function == 1 && adsorption->dp_dw_wT != NULL &&
+			adsorption->dp_dT_wT != NULL) {
+			dp_dw = adsorption->dp_dw_wT(w, T_K, workingPair->iso_par,
+				workingPair->psat_par, workingPair->rhol_par, adsorption,
+				workingPair->refrigerant);
+			dp_dT = adsorption->dp_dT_wT(w, T_K, workingPair->iso_par,
+				workingPair->psat_par, workingPair->rhol_par, adsorption,
+				workingPair->refrigerant);
+
+		} else if (function != 1 && adsorption->dw_dp_pT != NULL &&
+			adsorption->dw_dT_pT != NULL) {
+			dw_dp = adsorption->dw_dp_pT(p_Pa, T_K, workingPair->iso_par,
+				workingPair->psat_par, workingPair->rhol_par, adsorption,
+				workingPair->refrigerant);
+			dw_dT = adsorption->dw_dT_pT(p_Pa, T_K, workingPair->iso_par,
+				workingPair->psat_par, workingPair->rhol_par, adsorption,
+				workingPair->refrigerant);
+
+		} else {
+			return -1;
 
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_vol_p_wTpsatRho");
-	}
+		}
 
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_vol_p_wTpsatRho");
-		
-	} else if (retWorkingPair->adsorption->vol_p_wTpsatRho==NULL) {
-		return warning_function("vol_p_wTpsatRho", "ads_vol_p_wTpsatRho");
+	} else if (absorption->mix_x_pT == NULL) {
+		if (function == 1 && absorption->con_dp_dX_XT != NULL &&
+			absorption->con_dp_dT_XT != NULL) {
+			dp_dw = absorption->con_dp_dX_XT(w, T_K, workingPair->iso_par);
+			dp_dT = absorption->con_dp_dT_XT(w, T_K, workingPair->iso_par);
+
+		} else if (function != 1 && absorption->con_dX_dp_pT != NULL &&
+			absorption->con_dX_dT_pT != NULL) {
+			dw_dp = absorption->con_dX_dp_pT(p_Pa, T_K, workingPair->iso_par);
+			dw_dT = absorption->con_dX_dT_pT(p_Pa, T_K, workingPair->iso_par);
+
+		} else {
+			return -1;
+
+		}
 
 	} else {
-		return retWorkingPair->adsorption->vol_p_wTpsatRho(w_kgkg, T_K,
-			p_sat_Pa, rho_kgm3,retWorkingPair->iso_par);
+		// Mixing rules only provide derivatives of pressure: Derivatives of
+		// liquid mole fraction follow from implicit function theorem
+		//
+		if (absorption->mix_dp_dx_Tx == NULL ||
+			absorption->mix_dp_dT_Tx == NULL) {
+			return -1;
+		}
+
+		dp_dw = absorption->mix_dp_dx_Tx(T_K, w, workingPair->iso_par,
+			absorption);
+		dp_dT = absorption->mix_dp_dT_Tx(T_K, w, workingPair->iso_par,
+			absorption);
+		dw_dp = 1 / dp_dw;
+		dw_dT = -dp_dT / dp_dw;
 
 	}
-}
+
+	// Select derivatives of requested function
+	//
+	switch (function) {
+		case 0:
+			*ret_df_dx = dw_dp;
+			*ret_df_dy = dw_dT;
+			break;
+		case 1:
+			*ret_df_dx = dp_dw;
+			*ret_df_dy = dp_dT;
+			break;
+		default:
+			*ret_df_dx = -dw_dp / dw_dT;
+			*ret_df_dy = 1 / dw_dT;
+			break;
+	}
+
+	return (surrogate_finite(*ret_df_dx) && surrogate_finite(*ret_df_dy)) ?
+		0 : -1;
+}
 
 
 /*
- * ads_vol_T_pwpsatRho:
- * --------------------
+ * workingPair_derivatives:
+ * ------------------------
  *
- * Calculates equilibrium temperature T in K depending on equilibrium pressure
- * in Pa, equilibrium loading w in kg/kg, saturation pressure p_Sat in Pa and
- * density of adsorpt rho in kg/m³.
+ * Auxiliary function to calculate partial derivatives of an equilibrium
+ * function of a working pair with two inputs by the analytical derivatives of
+ * the original equations. Variables and value are given in the space of the
+ * tables (i.e., logarithms of pressure and loading). If required derivatives
+ * do not exist or are not finite, function returns -1.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure in Pa.
- * 	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
+ *	double *ret_df_dx:
+ *		Partial derivative wrt. first input.
+ *	double *ret_df_dy:
+ *		Partial derivative wrt. second input.
+ *	int function:
+ *		Function (i.e., 0 for w_pT, 1 for p_wT, and 2 for T_pw).
+ *	double x:
+ *		First input (i.e., logarithm of pressure in Pa or of loading).
+ *	double y:
+ *		Second input (i.e., temperature in K or logarithm of loading).
+ *	double value:
+ *		Value of function (i.e., logarithm of loading, logarithm of pressure
+ *		in Pa, or temperature in K).
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
- *	double:
- *		Equilibrium temperature in K.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
- *	Uses internal equations of states to calculate vapor pressure, saturated
- *	liquid density of adsorpt, derivative of vapor pressure wrt. temperature
- *	and derivative of saturated liquid density of adsorpt wrt. temperature. If
- *	equation of states are not implemented for refrigerant, function returns -1
- *  and throws warning. If user want to use his own equation of states, this
- *  function cannot be used and determination of root to calculate T must
- *  be implemented by user.
+ *	int:
+ *		Returns 0 if derivatives are calculated and -1 otherwise.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_T_pwpsatRho(double p_Pa, double w_kgkg, double p_sat_Pa,
-	double rho_kgm3, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_vol_T_pwpsatRho");
-	}
-
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_vol_T_pwpsatRho");
-		
-	} else if (retWorkingPair->adsorption->vol_T_pwpsatRho==NULL) {
-		return warning_function("vol_T_pwpsatRho", "ads_vol_T_pwpsatRho");
-
-	} else if (retWorkingPair->refrigerant->p_sat_T==NULL) {
-		return warning_function("p_sat_T", "ads_vol_T_pwpsatRho");
-
-	} else if (retWorkingPair->refrigerant->rho_l_T==NULL) {
-		return warning_function("rho_l_T", "ads_vol_T_pwpsatRho");
-
-	} else if (retWorkingPair->refrigerant->dp_sat_dT==NULL) {
-		return warning_function("dp_sat_dT", "ads_vol_T_pwpsatRho");
-
-	} else if (retWorkingPair->refrigerant->drho_l_dT==NULL) {
-		return warning_function("drho_l_dT", "ads_vol_T_pwpsatRho");
-
-	} else if (retWorkingPair->psat_par==NULL) {
-		return warning_parameter("saturated vapor pressure and its derivative "
-			"with respect to temperature", "ads_vol_T_pwpsatRho");
-
-	} else if (retWorkingPair->rhol_par==NULL) {
-		return warning_parameter("saturated liquid density and its derivative "
-			"with respect to temperature", "ads_vol_T_pwpsatRho");
-
-	} else {
-		// Avoid compiler warning C4100 by adding "do nothing" expression
-		// "Do nothing" expression will be optimized out by compiler
-		//
-		(p_sat_Pa) = (p_sat_Pa);
-		(rho_kgm3) = (rho_kgm3);
-
-		return retWorkingPair->adsorption->vol_T_pwpsatRho(p_Pa, w_kgkg,
-			retWorkingPair->refrigerant->p_sat_T,
-			retWorkingPair->refrigerant->rho_l_T,
-			retWorkingPair->refrigerant->dp_sat_dT,
-			retWorkingPair->refrigerant->drho_l_dT,
-			retWorkingPair->iso_par, retWorkingPair->psat_par,
-			retWorkingPair->rhol_par,
-			retWorkingPair->refrigerant);
-
-	}
+int workingPair_derivatives(double *ret_df_dx, double *ret_df_dy,
+	int function, double x, double y, double value,
+	const WorkingPair *workingPair) {
+	// Get state: Pressure, temperature, and loading
+	//
+	double p_Pa = exp((function == 1) ? value : x);
+	double T_K = (function == 2) ? value : y;
+	double w = exp((function == 0) ? value : ((function == 1) ? x : y));
+	double df_dx;
+	double df_dy;
+
+	if (workingPair_partials(&df_dx, &df_dy, function, p_Pa, T_K, w,
+		workingPair) == -1) {
+		return -1;
+	}
+
+	// Transform derivatives to space of tables
+	//
+	switch (function) {
+		case 0:
+			*ret_df_dx = p_Pa * df_dx / w;
+			*ret_df_dy = df_dy / w;
+			break;
+		case 1:
+			*ret_df_dx = w * df_dx / p_Pa;
+			*ret_df_dy = df_dy / p_Pa;
+			break;
+		default:
+			*ret_df_dx = p_Pa * df_dx;
+			*ret_df_dy = w * df_dy;
+			break;
+	}
+
+	return (surrogate_finite(*ret_df_dx) && surrogate_finite(*ret_df_dy)) ?
+		0 : -1;
 }
 
 
 /*
- * ads_vol_dW_dA_ARho:
- * -------------------
+ * workingPair_table:
+ * ------------------
  *
- * Calculates derivative of equilibrium volumetric loading dW_dA in m³mol/kg/J
- * depending on equilibrium adsorption potential A in J/mol and saturated liquid
- * density of adsorpt rho_l in kg/m3.
+ * Auxiliary function to evaluate an equilibrium function of a working pair
+ * and its partial derivatives by the spline tables. If tables are disabled or
+ * state is outside of the tables or within a cell containing invalid nodes,
+ * the original equations and their analytical derivatives are evaluated.
  *
  * Parameters:
  * -----------
- * 	double A_Jmol:
- *		Equilibrium adsorption potential A in mol/J.
- * 	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ *	double *ret_df_dx:
+ *		Partial derivative wrt. first input.
+ *	double *ret_df_dy:
+ *		Partial derivative wrt. second input.
+ *	int function:
+ *		Function (i.e., 0 for w_pT, 1 for p_wT, and 2 for T_pw).
+ *	double x:
+ *		First input (i.e., pressure in Pa or loading).
+ *	double y:
+ *		Second input (i.e., temperature in K or loading).
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of volumetric loading wrt. adsorption potential in
- *		m³mol/kg/J.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
- *	Saturated liquid density of adsorpt is required to calculate volumetric
- *	loading from characteristic curve in m3/kg when coefficients would directly
- *	return loading w in kg/kg.
+ *		Value of function or -1 if function or its derivatives fail.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_dW_dA_ARho(double A_Jmol, double rho_l_kgm3,
-	void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+double workingPair_table(double *ret_df_dx, double *ret_df_dy, int function,
+	double x, double y, const WorkingPair *workingPair) {
+	// Transform inputs to space of tables
+	//
+	WorkingPairTable *tables = workingPair->tables;
+	Spline2D *spline = (tables == NULL) ? NULL : ((function == 0) ?
+		tables->w_pT : ((function == 1) ? tables->p_wT : tables->T_pw));
+	double u = log(x);
+	double v = (function == 2) ? log(y) : y;
+	double value;
+	double df_du;
+	double df_dv;
+
+	if (spline2D_evaluate(&value, &df_du, &df_dv, u, v, spline) == -1) {
+		// Evaluate original equations
+		//
+		double y_1_molmol;
+		double y_2_molmol;
+		value = workingPair_exact(&y_1_molmol, &y_2_molmol, function,
+			(function == 1) ? x : u, y, workingPair);
+
+		if (!surrogate_finite(value) || value == -1 ||
+			(function != 2 && value <= 0)) {
+			*ret_df_dx = -1;
+			*ret_df_dy = -1;
+			return -1;
+		}
 
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_vol_dW_dA_ARho");
+		value = (function == 2) ? value : log(value);
+
+		if (workingPair_derivatives(&df_du, &df_dv, function, u, v, value,
+			workingPair) == -1) {
+			*ret_df_dx = -1;
+			*ret_df_dy = -1;
+			return -1;
+		}
 	}
 
-	// Check if isotherm function exists for chosen isotherm type
+	// Transform value and derivatives from space of tables: Derivatives wrt.
+	// logarithms are divided by the variables
 	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_vol_dW_dA_ARho");
-		
-	} else if (retWorkingPair->adsorption->vol_dW_dA_ARho==NULL) {
-		return warning_function("vol_dW_dA_ARho", "ads_vol_dW_dA_ARho");
+	if (function == 2) {
+		*ret_df_dx = df_du / x;
+		*ret_df_dy = df_dv / y;
 
 	} else {
-		return retWorkingPair->adsorption->vol_dW_dA_ARho(A_Jmol, rho_l_kgm3,
-			retWorkingPair->iso_par);
+		value = exp(value);
+		*ret_df_dx = value * df_du / x;
+		*ret_df_dy = value * df_dv;
 
 	}
+
+	return value;
 }
 
 
 /*
- * ads_vol_dA_dW_WRho:
- * -------------------
+ * workingPair_total_derivative:
+ * -----------------------------
  *
- * Calculates derivative of equilibrium adsorption potential dA_dW in kgJ/mol/m³
- * depending on equilibrium volumetric loading W in m³/kg and saturated liquid
- * density of adsorpt rho_l in kg/m3.
+ * Auxiliary function to calculate total derivative of an equilibrium function
+ * of a working pair with two inputs depending on both inputs and their
+ * derivatives by the analytical partial derivatives of the original equations.
+ * The original equation is only evaluated if the partial derivatives depend on
+ * its value (i.e., T_pw or w_pT of mixing rules).
  *
  * Parameters:
  * -----------
- * 	double W_m3kg:
- *		Equilibrium volumetric loading W in m³/kg.
- * 	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ *	int function:
+ *		Function (i.e., 0 for w_pT, 1 for p_wT, and 2 for T_pw).
+ *	double x:
+ *		First input (i.e., pressure in Pa or loading).
+ *	double y:
+ *		Second input (i.e., temperature in K or loading).
+ *	double x_der:
+ *		Derivative of first input.
+ *	double y_der:
+ *		Derivative of second input.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of adsorption potential wrt. volumetric loading in
- *		kgJ/mol/m³.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
- *	Saturated liquid density of adsorpt is required to calculate volumetric
- *	loading from characteristic curve in m3/kg when coefficients would directly
- *	return loading w in kg/kg.
+ *		Total derivative of function or -1 if function or its derivatives
+ *		fail.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_dA_dW_WRho(double W_m3kg, double rho_l_kgm3,
-	void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+double workingPair_total_derivative(int function, double x, double y,
+	double x_der, double y_der, const WorkingPair *workingPair) {
+	// Get state: Original equation is only required if derivatives depend on
+	// its value
+	//
+	double p_Pa = (function == 1) ? 0 : x;
+	double T_K = (function == 2) ? 0 : y;
+	double w = (function == 1) ? x : ((function == 2) ? y : 0);
+
+	if (function == 2 || (function == 0 && workingPair->absorption != NULL &&
+		workingPair->absorption->mix_x_pT != NULL)) {
+		double y_1_molmol;
+		double y_2_molmol;
+		double value = workingPair_exact(&y_1_molmol, &y_2_molmol, function,
+			log(x), y, workingPair);
+
+		if (!surrogate_finite(value) || value == -1) {
+			return -1;
+		}
 
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_vol_dA_dW_WRho");
+		T_K = (function == 2) ? value : T_K;
+		w = (function == 0) ? value : w;
 	}
 
-	// Check if isotherm function exists for chosen isotherm type
+	// Calculate total derivative by partial derivatives
 	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_vol_dA_dW_WRho");
-		
-	} else if (retWorkingPair->adsorption->vol_dA_dW_WRho==NULL) {
-		return warning_function("vol_dA_dW_WRho", "ads_vol_dA_dW_WRho");
-
-	} else {
-		return retWorkingPair->adsorption->vol_dA_dW_WRho(W_m3kg, rho_l_kgm3,
-			retWorkingPair->iso_par);
+	double df_dx;
+	double df_dy;
 
+	if (workingPair_partials(&df_dx, &df_dy, function, p_Pa, T_K, w,
+		workingPair) == -1) {
+		return -1;
 	}
+
+	return df_dx * x_der + df_dy * y_der;
 }
 
 
 /*
- * ads_vol_dw_dp_pTpsatRho:
- * ------------------------
+ * workingPair_derivative_kernel:
+ * ------------------------------
  *
- * Calculates derivative of equilibrium loading dw_dp with respect to pressure
- * in kg/kg/Pa depending on equilibrium pressure p in Pa, equilibrium
- * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
- * rho in kg/m³.
+ * Auxiliary function to evaluate analytical derivative of an equilibrium
+ * function of a working pair. For mixing rules, only derivatives of pressure
+ * exist. Function does not check if derivative exists.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
+ *	int derivative:
+ *		Derivative (i.e., 0 for dw_dp_pT, 1 for dw_dT_pT, 2 for dp_dw_wT, and
+ *		3 for dp_dT_wT).
+ *	double x:
+ *		First input (i.e., pressure in Pa or loading).
+ *	double y:
+ *		Second input (i.e., temperature in K).
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *		Derivative.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_dw_dp_pTpsatRho(double p_Pa, double T_K, double p_sat_Pa,
-	double rho_kgm3, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_vol_dw_dp_pTpsatRho");
-	}
+double workingPair_derivative_kernel(int derivative, double x, double y,
+	const WorkingPair *workingPair) {
+	// Select derivative depending on type of working pair
+	//
+	Adsorption *adsorption = workingPair->adsorption;
+	Absorption *absorption = workingPair->absorption;
+
+	if (adsorption != NULL) {
+		switch (derivative) {
+			case 0:
+				return adsorption->dw_dp_pT(x, y, workingPair->iso_par,
+					workingPair->psat_par, workingPair->rhol_par, adsorption,
+					workingPair->refrigerant);
+			case 1:
+				return adsorption->dw_dT_pT(x, y, workingPair->iso_par,
+					workingPair->psat_par, workingPair->rhol_par, adsorption,
+					workingPair->refrigerant);
+			case 2:
+				return adsorption->dp_dw_wT(x, y, workingPair->iso_par,
+					workingPair->psat_par, workingPair->rhol_par, adsorption,
+					workingPair->refrigerant);
+			default:
+				return adsorption->dp_dT_wT(x, y, workingPair->iso_par,
+					workingPair->psat_par, workingPair->rhol_par, adsorption,
+					workingPair->refrigerant);
+		}
 
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_vol_dw_dp_pTpsatRho");
-		
-	} else if (retWorkingPair->adsorption->vol_dw_dp_pTpsatRho==NULL) {
-		return warning_function("vol_dw_dp_pTpsatRho",
-			"ads_vol_dw_dp_pTpsatRho");
+	} else if (absorption->mix_x_pT == NULL) {
+		switch (derivative) {
+			case 0:
+				return absorption->con_dX_dp_pT(x, y, workingPair->iso_par);
+			case 1:
+				return absorption->con_dX_dT_pT(x, y, workingPair->iso_par);
+			case 2:
+				return absorption->con_dp_dX_XT(x, y, workingPair->iso_par);
+			default:
+				return absorption->con_dp_dT_XT(x, y, workingPair->iso_par);
+		}
 
 	} else {
-		return retWorkingPair->adsorption->vol_dw_dp_pTpsatRho(p_Pa, T_K,
-			p_sat_Pa, rho_kgm3, retWorkingPair->iso_par);
+		return (derivative == 2) ?
+			absorption->mix_dp_dx_Tx(y, x, workingPair->iso_par, absorption) :
+			absorption->mix_dp_dT_Tx(y, x, workingPair->iso_par, absorption);
 
 	}
 }
 
 
 /*
- * ads_vol_dw_dT_pTpsatRho:
- * ------------------------
+ * workingPair_second_derivative:
+ * ------------------------------
  *
- * Calculates derivative of equilibrium loading dw_dp with respect to
- * temperature in kg/kg/K depending on equilibrium pressure p in Pa, equilibrium
- * temperature T in K, saturation pressure p_Sat in Pa, density of adsorpt
- * rho in kg/m³, derivative of saturation pressure with respect to temperature
- * dp_sat_dT in Pa/K and derivative of density of adsorpt with respect to
- * temperature drho_dT in kg/m³/K.
+ * Auxiliary function to calculate total derivative of an analytical
+ * derivative of an equilibrium function of a working pair depending on both
+ * inputs and their derivatives. Partial derivatives of analytical derivative
+ * are calculated by the symmetric derivative using a relative change of
+ * WORKINGPAIR_DERIVATIVE_STEP or, for mixing rules whose derivatives are
+ * already numerical, of WORKINGPAIR_DERIVATIVE_STEP_MIX. Inputs whose
+ * derivatives are zero are not changed.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
- * 	double dp_sat_dT_PaK:
- *		Derivative of saturation pressure wrt. temperature in Pa/K.
- *	double drho_dT_kgm3K:
- *		Derivative of density of adsorpt wrt. temperature in kg/m³/K.
+ *	int derivative:
+ *		Derivative (i.e., 0 for dw_dp_pT, 1 for dw_dT_pT, 2 for dp_dw_wT, and
+ *		3 for dp_dT_wT).
+ *	double x:
+ *		First input (i.e., pressure in Pa or loading).
+ *	double y:
+ *		Second input (i.e., temperature in K).
+ *	double x_der:
+ *		Derivative of first input.
+ *	double y_der:
+ *		Derivative of second input.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *		Total derivative of analytical derivative or -1 if derivative is not
+ *		finite.
  *
  * History:
  * --------
- *	01/07/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_dw_dT_pTpsatRho(double p_Pa, double T_K, double p_sat_Pa,
-	double rho_kgm3, double dp_sat_dT_PaK, double drho_dT_kgm3K,
-	void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_vol_dw_dT_pTpsatRho");
-	}
-
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_vol_dw_dT_pTpsatRho");
-		
-	} else if (retWorkingPair->adsorption->vol_dw_dT_pTpsatRho==NULL) {
-		return warning_function("vol_dw_dT_pTpsatRho",
-			"ads_vol_dw_dT_pTpsatRho");
-
-	} else {
-		return retWorkingPair->adsorption->vol_dw_dT_pTpsatRho(p_Pa, T_K,
-			p_sat_Pa, rho_kgm3, dp_sat_dT_PaK, drho_dT_kgm3K,
-			retWorkingPair->iso_par);
-
-	}
+double workingPair_second_derivative(int derivative, double x, double y,
+	double x_der, double y_der, const WorkingPair *workingPair) {
+	// Calculate symmetric derivatives wrt. both inputs: Derivatives of mixing
+	// rules are already calculated numerically and, thus, require larger
+	// changes
+	//
+	double step = (workingPair->absorption != NULL &&
+		workingPair->absorption->mix_x_pT != NULL) ?
+		WORKINGPAIR_DERIVATIVE_STEP_MIX : WORKINGPAIR_DERIVATIVE_STEP;
+	double h_x = step * ((x == 0) ? 1 : fabs(x));
+	double h_y = step * ((y == 0) ? 1 : fabs(y));
+	double result = 0;
+
+	if (x_der != 0) {
+		result += x_der * (
+			workingPair_derivative_kernel(derivative, x + h_x, y,
+				workingPair) -
+			workingPair_derivative_kernel(derivative, x - h_x, y,
+				workingPair)) / (2 * h_x);
+	}
+
+	if (y_der != 0) {
+		result += y_der * (
+			workingPair_derivative_kernel(derivative, x, y + h_y,
+				workingPair) -
+			workingPair_derivative_kernel(derivative, x, y - h_y,
+				workingPair)) / (2 * h_y);
+	}
+
+	return surrogate_finite(result) ? result : -1;
 }
 
 
 /*
- * ads_vol_dp_dw_wTpsatRho:
- * ------------------------
+ * direct_equal:
+ * -------------
  *
- * Calculates derivative of equilibrium pressure p with respect to loading
- * w in kgPa/kg depending on equilibrium loading w in kg/kg, equilibrium
- * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
- * rho in kg/m³.
+ * Auxiliary function comparing two names that may be NULL.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	const char *name_1:
+ *		First name.
+ *	const char *name_2:
+ *		Second name.
  *
  * Returns:
  * --------
- *	double:
- *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *	int:
+ *		Returns 1 if names are equal and 0 otherwise.
  *
  * History:
  * --------
- *	01/13/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_dp_dw_wTpsatRho(double w_kgkg, double T_K,
-	double p_sat_Pa, double rho_kgm3, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
-	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_vol_dp_dw_wTpsatRho");
+static int direct_equal(const char *name_1, const char *name_2) {
+	if (name_1 == NULL || name_2 == NULL) {
+		return name_1 == name_2;
 	}
+	return strcmp(name_1, name_2) == 0;
+}
 
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_vol_dp_dw_wTpsatRho");
-		
-	} else if (retWorkingPair->adsorption->vol_dp_dw_wTpsatRho==NULL) {
-		return warning_function("vol_dp_dw_wTpsatRho",
-			"ads_vol_dp_dw_wTpsatRho");
+
+/*
+ * direct_copy:
+ * ------------
+ *
+ * Auxiliary function copying a name that may be NULL to a memory block and
+ * advancing the position within the memory block.
+ *
+ * Parameters:
+ * -----------
+ *	char **position:
+ *		Position within memory block.
+ *	const char *name:
+ *		Name.
+ *
+ * Returns:
+ * --------
+ *	char *:
+ *		Copy of name or NULL if name is NULL.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static char *direct_copy(char **position, const char *name) {
+	if (name == NULL) {
+		return NULL;
+	}
+
+	char *copy = *position;
+	size_t length = strlen(name) + 1;
+
+	memcpy(copy, name, length);
+	*position += length;
+	return copy;
+}
+
+
+/*
+ * direct_find:
+ * ------------
+ *
+ * Auxiliary function searching working pair in cache of functions working
+ * without WorkingPair-struct. Spin lock of cache must be acquired by caller.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm.
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation.
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation.
+ *
+ * Returns:
+ * --------
+ *	struct *WorkingPair:
+ *		Cached working pair or NULL if working pair is not cached.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static WorkingPair *direct_find(const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	for (DirectWorkingPair *entry = direct_workingPairs; entry != NULL;
+		entry = entry->next) {
+		if (entry->no_iso == no_iso && entry->no_p_sat == no_p_sat &&
+			entry->no_rhol == no_rhol && direct_equal(entry->wp_as, wp_as) &&
+			direct_equal(entry->wp_st, wp_st) &&
+			direct_equal(entry->wp_rf, wp_rf) &&
+			direct_equal(entry->wp_iso, wp_iso) &&
+			direct_equal(entry->rf_psat, rf_psat) &&
+			direct_equal(entry->rf_rhol, rf_rhol) &&
+			direct_equal(entry->path_db, path_db)) {
+			return entry->workingPair;
+		}
+	}
+	return NULL;
+}
+
+
+/*
+ * direct_workingPair:
+ * -------------------
+ *
+ * Auxiliary function returning working pair for functions working without
+ * WorkingPair-struct (i.e., direct_*-functions). If caching is enabled, the
+ * working pair is searched in the cache by its arguments and only created if
+ * it is not cached yet. Thus, the database is only read and parsed once per
+ * working pair instead of once per call. Otherwise, a new working pair is
+ * created.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *
+ * Returns:
+ * --------
+ *	struct *WorkingPair:
+ *		Working pair or NULL if working pair cannot be created. Working pair
+ *		must be released by direct_release.
+ *
+ * Remarks:
+ * --------
+ *	Working pairs that cannot be created are not cached. Thus, warnings are
+ *	still printed for each call. Working pairs are created outside of the
+ *	spin lock. If two threads create the same working pair at the same time,
+ *	the working pair of the second thread is deleted.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+WorkingPair *direct_workingPair(const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Create new working pair if caching is disabled
+	//
+	if (!direct_cache) {
+		direct_not_cached = 1;
+		return newWorkingPair(path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso,
+			rf_psat, no_p_sat, rf_rhol, no_rhol);
+	}
+	direct_not_cached = 0;
+
+	// Search working pair in cache
+	//
+	SPINLOCK_ACQUIRE(&direct_lock);
+
+	WorkingPair *workingPair = direct_find(path_db, wp_as, wp_st, wp_rf,
+		wp_iso, no_iso, rf_psat, no_p_sat, rf_rhol, no_rhol);
+
+	SPINLOCK_RELEASE(&direct_lock);
+
+	if (workingPair != NULL) {
+		return workingPair;
+	}
+
+	// Copy all names to one memory block because the working pair refers to
+	// names given during its creation
+	//
+	const char *names[] = {path_db, wp_as, wp_st, wp_rf, wp_iso, rf_psat,
+		rf_rhol};
+	size_t size_names = 0;
+
+	for (int i = 0; i < 7; i++) {
+		size_names += (names[i] == NULL) ? 0 : strlen(names[i]) + 1;
+	}
+
+	DirectWorkingPair *retEntry = (DirectWorkingPair *) malloc(
+		sizeof(DirectWorkingPair));
+	char *position = (char *) malloc(size_names + 1);
+
+	if (retEntry == NULL || position == NULL) {
+		if (status_report(STATUS_NO_MEMORY, "direct_workingPair", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for DirectWorkingPair-struct.");
+		}
+		free(retEntry);
+		free(position);
+		return NULL;
+	}
+
+	retEntry->names = position;
+	retEntry->path_db = direct_copy(&position, path_db);
+	retEntry->wp_as = direct_copy(&position, wp_as);
+	retEntry->wp_st = direct_copy(&position, wp_st);
+	retEntry->wp_rf = direct_copy(&position, wp_rf);
+	retEntry->wp_iso = direct_copy(&position, wp_iso);
+	retEntry->rf_psat = direct_copy(&position, rf_psat);
+	retEntry->rf_rhol = direct_copy(&position, rf_rhol);
+	retEntry->no_iso = no_iso;
+	retEntry->no_p_sat = no_p_sat;
+	retEntry->no_rhol = no_rhol;
+
+	// Create working pair: Working pair is not cached if it cannot be created
+	//
+	retEntry->workingPair = newWorkingPair(retEntry->path_db, retEntry->wp_as,
+		retEntry->wp_st, retEntry->wp_rf, retEntry->wp_iso, no_iso,
+		retEntry->rf_psat, no_p_sat, retEntry->rf_rhol, no_rhol);
+
+	if (retEntry->workingPair == NULL) {
+		free(retEntry->names);
+		free(retEntry);
+		return NULL;
+	}
+
+	// Add working pair to cache unless another thread was faster
+	//
+	SPINLOCK_ACQUIRE(&direct_lock);
+
+	workingPair = direct_find(path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso,
+		rf_psat, no_p_sat, rf_rhol, no_rhol);
+
+	if (workingPair != NULL) {
+		SPINLOCK_RELEASE(&direct_lock);
+
+		delWorkingPair(retEntry->workingPair);
+		free(retEntry->names);
+		free(retEntry);
+		return workingPair;
+	}
+
+	retEntry->next = direct_workingPairs;
+	direct_workingPairs = retEntry;
+
+	SPINLOCK_RELEASE(&direct_lock);
+	return retEntry->workingPair;
+}
+
+
+/*
+ * direct_release:
+ * ---------------
+ *
+ * Auxiliary function releasing working pair returned by direct_workingPair to
+ * current thread: Working pair is only deleted if it is not cached.
+ *
+ * Parameters:
+ * -----------
+ *	struct *WorkingPair:
+ *		Working pair returned by direct_workingPair.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void direct_release(WorkingPair *workingPair) {
+	if (direct_not_cached && workingPair != NULL) {
+		delWorkingPair(workingPair);
+	}
+}
+
+
+/*
+ * setDirectWorkingPairCache:
+ * --------------------------
+ *
+ * Enables or disables caching of working pairs of functions working without
+ * WorkingPair-struct (i.e., direct_*-functions). Caching is enabled by
+ * default. If disabled, each call reads and parses the database again (e.g.,
+ * to benchmark direct function calls of Modelica with and without cache).
+ *
+ * Parameters:
+ * -----------
+ *	int cache:
+ *		Flag indicating if working pairs are cached (i.e., 1) or not (i.e., 0).
+ *
+ * Remarks:
+ * --------
+ *	Working pairs that are already cached are kept. Call
+ *	clearDirectWorkingPairs to delete them.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void setDirectWorkingPairCache(int cache) {
+	direct_cache = (cache != 0);
+}
+
+
+/*
+ * clearDirectWorkingPairs:
+ * ------------------------
+ *
+ * Deletes all working pairs cached for functions working without
+ * WorkingPair-struct (e.g., after database has been changed).
+ *
+ * Remarks:
+ * --------
+ *	Function must not be called while other threads execute direct_*-
+ *	functions.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void clearDirectWorkingPairs(void) {
+	SPINLOCK_ACQUIRE(&direct_lock);
+
+	DirectWorkingPair *entry = direct_workingPairs;
+	direct_workingPairs = NULL;
+
+	SPINLOCK_RELEASE(&direct_lock);
+
+	while (entry != NULL) {
+		DirectWorkingPair *next = entry->next;
+
+		delWorkingPair(entry->workingPair);
+		free(entry->names);
+		free(entry);
+		entry = next;
+	}
+}
+
+
+/*
+ * warning_struct:
+ * ---------------
+ *
+ * Auxiliary function to throw warning if some struct (e.g. workingPair or
+ * Adsorption) does not exist.
+ *
+ * Parameters:
+ * -----------
+ * 	const char *name_struct:
+ *		Name of struct that does not exist.
+ * 	const char *name_function:
+ *		Name of function that does not exist.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns -1 to indicate error.
+ *
+ * History:
+ * --------
+ *	27/03/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+double warning_struct(const char *name_struct, const char *name_function) {
+	// Print warning
+	//
+	if (status_report(STATUS_INVALID_STRUCT, name_function, 0, 0)) {
+		printf("\n\n###########\n# Warning #\n###########");
+		printf("\n%s-struct does not exist.", name_struct);
+		printf("\nReturn -1 for function call \"%s\".", name_function);
+	}
+
+	// Return error indicator
+	//
+	return -1.0;
+ }
+
+
+/*
+ * warning_parameter:
+ * ------------------
+ *
+ * Auxiliary function to throw warning if some parameter is missing.
+ *
+ * Parameters:
+ * -----------
+ * 	const char *name_parameter:
+ *		Name of parameter that is missing.
+ * 	const char *name_wpair_function:
+ *		Name of working pair function that does not exist.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns -1 to indicate error.
+ *
+ * History:
+ * --------
+ *	27/03/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+double warning_parameter(const char *name_parameter,
+	const char *name_wpair_function) {
+	// Print warning
+	//
+	if (status_report(STATUS_NOT_IMPLEMENTED, name_wpair_function, 0,
+		0)) {
+		printf("\n\n###########\n# Warning #\n###########");
+		printf("\nParameters required to calculate \"%s\" are not stored "
+			"within the workingPair-struct.", name_parameter);
+		printf("\nReturn -1 for function call \"%s\".", name_wpair_function);
+	}
+
+	// Return error indicator
+	//
+	return -1.0;
+}
+
+
+/*
+ * warning_function:
+ * -----------------
+ *
+ * Auxiliary function to throw warning if some function does not exist.
+ *
+ * Parameters:
+ * -----------
+ * 	const char *name_iso_function:
+ *		Name of isotherm function that does not exist.
+ * 	const char *name_wpair_function:
+ *		Name of working pair function that does not exist.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns -1 to indicate error.
+ *
+ * History:
+ * --------
+ *	27/03/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+double warning_function(const char *name_function,
+	const char *name_wpair_function) {
+	// Print warning
+	//
+	if (status_report(STATUS_NOT_IMPLEMENTED, name_wpair_function, 0,
+		0)) {
+		printf("\n\n###########\n# Warning #\n###########");
+		printf("\nChosen isotherm function \"%s\" is not implemented.",
+			name_function);
+		printf("\nReturn -1 for function call \"%s\".", name_wpair_function);
+	}
+
+	// Return error indicator
+	//
+	return -1.0;
+}
+
+
+////////////////////////////////////////////////////////////////////////////
+// Definition of function prototypes regarding adsorption working w struct//
+////////////////////////////////////////////////////////////////////////////
+/*
+ * ads_w_pT:
+ * ---------
+ *
+ * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
+ * p in Pa and equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium loading in kg/kg.
+ *
+ * History:
+ * --------
+ *	01/06/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_w_pT(double p_Pa, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_w_pT, workingPair, p_Pa, T_K);
+	double w_kgkg;
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_w_pT,
+			warning_struct("workingPair", "ads_w_pT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//	
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_w_pT,
+			warning_struct("adsorption", "ads_w_pT"));
+		
+	} else if (retWorkingPair->adsorption->w_pT==NULL) {
+		return STATISTICS_RETURN(ads_w_pT,
+			warning_function("w_pT", "ads_w_pT"));
+
+	} else if (retWorkingPair->surrogates != NULL &&
+		surrogate2D_approximate(&w_kgkg, log(p_Pa), T_K,
+		retWorkingPair->surrogates->w_pT) == 0) {
+		return STATISTICS_RETURN(ads_w_pT, w_kgkg);
+
+	} else {
+		return STATISTICS_RETURN(ads_w_pT,
+			retWorkingPair->adsorption->w_pT(p_Pa, T_K,
+				retWorkingPair->iso_par, retWorkingPair->psat_par,
+				retWorkingPair->rhol_par, retWorkingPair->adsorption,
+				retWorkingPair->refrigerant));
+
+	}
+}
+
+
+/*
+ * ads_p_wT:
+ * ---------
+ *
+ * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
+ * in kg/kg and equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ * 	double:
+ *		Equilibrium pressure in Pa.
+ *
+ * History:
+ * --------
+ *	01/06/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_p_wT(double w_kgkg, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_p_wT, workingPair, w_kgkg, T_K);
+	double p_Pa;
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_p_wT,
+			warning_struct("workingPair", "ads_p_wT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_p_wT,
+			warning_struct("adsorption", "ads_p_wT"));
+		
+	} else if (retWorkingPair->adsorption->p_wT==NULL) {
+		return STATISTICS_RETURN(ads_p_wT,
+			warning_function("p_wT", "ads_p_wT"));
+
+	} else if (retWorkingPair->surrogates != NULL &&
+		surrogate2D_approximate(&p_Pa, w_kgkg, T_K,
+		retWorkingPair->surrogates->p_wT) == 0) {
+		return STATISTICS_RETURN(ads_p_wT, p_Pa);
+
+	} else {
+		return STATISTICS_RETURN(ads_p_wT,
+			retWorkingPair->adsorption->p_wT(w_kgkg, T_K,
+				retWorkingPair->iso_par, retWorkingPair->psat_par,
+				retWorkingPair->rhol_par, retWorkingPair->adsorption,
+				retWorkingPair->refrigerant));
+
+	}
+}
+
+
+/*
+ * ads_T_pw:
+ * ---------
+ *
+ * Calculates equilibrium temperature in K depending on equilibrium pressure p
+ * in Pa and equilibrium loading w in kg/kg.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ * 	double:
+ *		Equilibrium temperature in K.
+ *
+ * Remarks:
+ * --------
+ *	Function uses equation of states implemented for calculation of vapor
+ *	pressure, saturated liquid density, derivative of vapor pressure wrt.
+ *	temperature, and derivative of saturated liquid density wrt. temperature
+ *	when isotherm of working pair is based on volumetric approach (e.g.
+ *	Dubinin theory).
+ *
+ * History:
+ * --------
+ *	01/06/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_T_pw(double p_Pa, double w_kgkg, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_T_pw, workingPair, p_Pa, w_kgkg);
+	double T_K;
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_T_pw,
+			warning_struct("workingPair", "ads_T_pw"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_T_pw,
+			warning_struct("adsorption", "ads_T_pw"));
+		
+	} else if (retWorkingPair->adsorption->T_pw==NULL) {
+		return STATISTICS_RETURN(ads_T_pw,
+			warning_function("T_pw", "ads_T_pw"));
+
+	} else if (retWorkingPair->surrogates != NULL &&
+		surrogate2D_approximate(&T_K, log(p_Pa), w_kgkg,
+		retWorkingPair->surrogates->T_pw) == 0) {
+		return STATISTICS_RETURN(ads_T_pw, T_K);
+
+	} else {
+		return STATISTICS_RETURN(ads_T_pw,
+			retWorkingPair->adsorption->T_pw(p_Pa, w_kgkg,
+				retWorkingPair->iso_par, retWorkingPair->psat_par,
+				retWorkingPair->rhol_par, retWorkingPair->adsorption,
+				retWorkingPair->refrigerant));
+
+	}
+}
+
+
+/*
+ * ads_dw_dp_pT:
+ * -------------
+ *
+ * Calculates derivative of equilibrium loading w with respect to pressure
+ * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *
+ * History:
+ * --------
+ *	01/06/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_dw_dp_pT(double p_Pa, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_dw_dp_pT, workingPair, p_Pa, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_dw_dp_pT,
+			warning_struct("workingPair", "ads_dw_dp_pT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_dw_dp_pT,
+			warning_struct("adsorption", "ads_dw_dp_pT"));
+		
+	} else if (retWorkingPair->adsorption->dw_dp_pT==NULL) {
+		return STATISTICS_RETURN(ads_dw_dp_pT,
+			warning_function("dw_dp_pT", "ads_dw_dp_pT"));
+
+	} else {
+		return STATISTICS_RETURN(ads_dw_dp_pT,
+			retWorkingPair->adsorption->dw_dp_pT(p_Pa, T_K,
+				retWorkingPair->iso_par, retWorkingPair->psat_par,
+				retWorkingPair->rhol_par, retWorkingPair->adsorption,
+				retWorkingPair->refrigerant));
+
+	}
+}
+
+
+/*
+ * ads_dw_dT_pT:
+ * -------------
+ *
+ * Calculates derivative of equilibrium loading w with respect to temperature
+ * T in kg/kg/K depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *
+ * History:
+ * --------
+ *	01/06/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_dw_dT_pT(double p_Pa, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_dw_dT_pT, workingPair, p_Pa, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_dw_dT_pT,
+			warning_struct("workingPair", "ads_dw_dT_pT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_dw_dT_pT,
+			warning_struct("adsorption", "ads_dw_dT_pT"));
+		
+	} else if (retWorkingPair->adsorption->dw_dT_pT==NULL) {
+		return STATISTICS_RETURN(ads_dw_dT_pT,
+			warning_function("dw_dT_pT", "ads_dw_dT_pT"));
+
+	} else {
+		return STATISTICS_RETURN(ads_dw_dT_pT,
+			retWorkingPair->adsorption->dw_dT_pT(p_Pa, T_K,
+				retWorkingPair->iso_par, retWorkingPair->psat_par,
+				retWorkingPair->rhol_par, retWorkingPair->adsorption,
+				retWorkingPair->refrigerant));
+
+	}
+}
+
+
+/*
+ * ads_dp_dw_wT:
+ * -------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to loading
+ * w in kgPa/kg depending on equilibrium loading w in kg/kg and equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *
+ * History:
+ * --------
+ *	01/13/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_dp_dw_wT(double w_kgkg, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_dp_dw_wT, workingPair, w_kgkg, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_dp_dw_wT,
+			warning_struct("workingPair", "ads_dp_dw_wT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_dp_dw_wT,
+			warning_struct("adsorption", "ads_dp_dw_wT"));
+		
+	} else if (retWorkingPair->adsorption->dp_dw_wT==NULL) {
+		return STATISTICS_RETURN(ads_dp_dw_wT,
+			warning_function("dp_dw_wT", "ads_dp_dw_wT"));
+
+	} else {
+		return STATISTICS_RETURN(ads_dp_dw_wT,
+			retWorkingPair->adsorption->dp_dw_wT(w_kgkg, T_K,
+				retWorkingPair->iso_par, retWorkingPair->psat_par,
+				retWorkingPair->rhol_par, retWorkingPair->adsorption,
+				retWorkingPair->refrigerant));
+
+	}
+}
+
+
+/*
+ * ads_dp_dT_wT:
+ * -------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium loading w in kg/kg and equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *
+ * History:
+ * --------
+ *	01/13/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_dp_dT_wT(double w_kgkg, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_dp_dT_wT, workingPair, w_kgkg, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_dp_dT_wT,
+			warning_struct("workingPair", "ads_dp_dT_wT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_dp_dT_wT,
+			warning_struct("adsorption", "ads_dp_dT_wT"));
+		
+	} else if (retWorkingPair->adsorption->dp_dw_wT==NULL) {
+		return STATISTICS_RETURN(ads_dp_dT_wT,
+			warning_function("dp_dw_wT", "ads_dp_dT_wT"));
+
+	} else {
+		return STATISTICS_RETURN(ads_dp_dT_wT,
+			retWorkingPair->adsorption->dp_dT_wT(w_kgkg, T_K,
+				retWorkingPair->iso_par, retWorkingPair->psat_par,
+				retWorkingPair->rhol_par, retWorkingPair->adsorption,
+				retWorkingPair->refrigerant));
+
+	}
+}
+
+
+/*
+ * ads_w_pT_der:
+ * -------------
+ *
+ * Calculates total derivative of equilibrium loading w in kg/kg/s depending on
+ * equilibrium pressure p in Pa, equilibrium temperature T in K, and their
+ * derivatives by the analytical partial derivatives of the isotherm. Thus, the
+ * derivative can be used for derivative annotations of Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading in kg/kg/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_w_pT_der(double p_Pa, double T_K, double p_der_Pas,
+	double T_der_Ks, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_w_pT_der, workingPair, p_Pa, T_K, p_der_Pas, T_der_Ks);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_w_pT_der,
+			warning_struct("workingPair", "ads_w_pT_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->adsorption == NULL) {
+		return STATISTICS_RETURN(ads_w_pT_der,
+			warning_struct("adsorption", "ads_w_pT_der"));
+
+	} else if (retWorkingPair->adsorption->dw_dp_pT == NULL) {
+		return STATISTICS_RETURN(ads_w_pT_der,
+			warning_function("dw_dp_pT", "ads_w_pT_der"));
+
+	} else if (retWorkingPair->adsorption->dw_dT_pT == NULL) {
+		return STATISTICS_RETURN(ads_w_pT_der,
+			warning_function("dw_dT_pT", "ads_w_pT_der"));
+	}
+
+	// Calculate total derivative
+	//
+	return STATISTICS_RETURN(ads_w_pT_der,
+		workingPair_total_derivative(0, p_Pa, T_K, p_der_Pas, T_der_Ks,
+			retWorkingPair));
+}
+
+
+/*
+ * ads_p_wT_der:
+ * -------------
+ *
+ * Calculates total derivative of equilibrium pressure p in Pa/s depending on
+ * equilibrium loading w in kg/kg, equilibrium temperature T in K, and their
+ * derivatives by the analytical partial derivatives of the isotherm. Thus, the
+ * derivative can be used for derivative annotations of Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double w_der_kgkgs:
+ *		Derivative of equilibrium loading in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_p_wT_der(double w_kgkg, double T_K, double w_der_kgkgs,
+	double T_der_Ks, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_p_wT_der, workingPair, w_kgkg, T_K, w_der_kgkgs, T_der_Ks);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_p_wT_der,
+			warning_struct("workingPair", "ads_p_wT_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->adsorption == NULL) {
+		return STATISTICS_RETURN(ads_p_wT_der,
+			warning_struct("adsorption", "ads_p_wT_der"));
+
+	} else if (retWorkingPair->adsorption->dp_dw_wT == NULL) {
+		return STATISTICS_RETURN(ads_p_wT_der,
+			warning_function("dp_dw_wT", "ads_p_wT_der"));
+
+	} else if (retWorkingPair->adsorption->dp_dT_wT == NULL) {
+		return STATISTICS_RETURN(ads_p_wT_der,
+			warning_function("dp_dT_wT", "ads_p_wT_der"));
+	}
+
+	// Calculate total derivative
+	//
+	return STATISTICS_RETURN(ads_p_wT_der,
+		workingPair_total_derivative(1, w_kgkg, T_K, w_der_kgkgs, T_der_Ks,
+			retWorkingPair));
+}
+
+
+/*
+ * ads_T_pw_der:
+ * -------------
+ *
+ * Calculates total derivative of equilibrium temperature T in K/s depending on
+ * equilibrium pressure p in Pa, equilibrium loading w in kg/kg, and their
+ * derivatives by the analytical partial derivatives of the isotherm and the
+ * implicit function theorem. Thus, the derivative can be used for derivative
+ * annotations of Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double w_der_kgkgs:
+ *		Derivative of equilibrium loading in kg/kg/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_T_pw_der(double p_Pa, double w_kgkg, double p_der_Pas,
+	double w_der_kgkgs, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_T_pw_der, workingPair, p_Pa, w_kgkg, p_der_Pas,
+		w_der_kgkgs);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_T_pw_der,
+			warning_struct("workingPair", "ads_T_pw_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->adsorption == NULL) {
+		return STATISTICS_RETURN(ads_T_pw_der,
+			warning_struct("adsorption", "ads_T_pw_der"));
+
+	} else if (retWorkingPair->adsorption->T_pw == NULL) {
+		return STATISTICS_RETURN(ads_T_pw_der,
+			warning_function("T_pw", "ads_T_pw_der"));
+
+	} else if (retWorkingPair->adsorption->dw_dp_pT == NULL) {
+		return STATISTICS_RETURN(ads_T_pw_der,
+			warning_function("dw_dp_pT", "ads_T_pw_der"));
+
+	} else if (retWorkingPair->adsorption->dw_dT_pT == NULL) {
+		return STATISTICS_RETURN(ads_T_pw_der,
+			warning_function("dw_dT_pT", "ads_T_pw_der"));
+	}
+
+	// Calculate total derivative
+	//
+	return STATISTICS_RETURN(ads_T_pw_der,
+		workingPair_total_derivative(2, p_Pa, w_kgkg, p_der_Pas, w_der_kgkgs,
+			retWorkingPair));
+}
+
+
+/*
+ * ads_dw_dp_pT_der:
+ * -----------------
+ *
+ * Calculates total derivative of derivative of equilibrium loading w with
+ * respect to pressure p in kg/kg/Pa/s depending on equilibrium pressure p in
+ * Pa, equilibrium temperature T in K, and their derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium loading wrt. pressure in
+ *		kg/kg/Pa/s.
+ *
+ * Remarks:
+ * --------
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_dw_dp_pT_der(double p_Pa, double T_K, double p_der_Pas,
+	double T_der_Ks, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_dw_dp_pT_der, workingPair, p_Pa, T_K, p_der_Pas, T_der_Ks);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_dw_dp_pT_der,
+			warning_struct("workingPair", "ads_dw_dp_pT_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->adsorption == NULL) {
+		return STATISTICS_RETURN(ads_dw_dp_pT_der,
+			warning_struct("adsorption", "ads_dw_dp_pT_der"));
+
+	} else if (retWorkingPair->adsorption->dw_dp_pT == NULL) {
+		return STATISTICS_RETURN(ads_dw_dp_pT_der,
+			warning_function("dw_dp_pT", "ads_dw_dp_pT_der"));
+	}
+
+	// Calculate total derivative numerically
+	//
+	return STATISTICS_RETURN(ads_dw_dp_pT_der,
+		workingPair_second_derivative(0, p_Pa, T_K, p_der_Pas, T_der_Ks,
+			retWorkingPair));
+}
+
+
+/*
+ * ads_dw_dT_pT_der:
+ * -----------------
+ *
+ * Calculates total derivative of derivative of equilibrium loading w with
+ * respect to temperature T in kg/kg/K/s depending on equilibrium pressure p in
+ * Pa, equilibrium temperature T in K, and their derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium loading wrt. temperature in
+ *		kg/kg/K/s.
+ *
+ * Remarks:
+ * --------
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_dw_dT_pT_der(double p_Pa, double T_K, double p_der_Pas,
+	double T_der_Ks, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_dw_dT_pT_der, workingPair, p_Pa, T_K, p_der_Pas, T_der_Ks);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_dw_dT_pT_der,
+			warning_struct("workingPair", "ads_dw_dT_pT_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->adsorption == NULL) {
+		return STATISTICS_RETURN(ads_dw_dT_pT_der,
+			warning_struct("adsorption", "ads_dw_dT_pT_der"));
+
+	} else if (retWorkingPair->adsorption->dw_dT_pT == NULL) {
+		return STATISTICS_RETURN(ads_dw_dT_pT_der,
+			warning_function("dw_dT_pT", "ads_dw_dT_pT_der"));
+	}
+
+	// Calculate total derivative numerically
+	//
+	return STATISTICS_RETURN(ads_dw_dT_pT_der,
+		workingPair_second_derivative(1, p_Pa, T_K, p_der_Pas, T_der_Ks,
+			retWorkingPair));
+}
+
+
+/*
+ * ads_dp_dw_wT_der:
+ * -----------------
+ *
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to loading w in Pa/(kg/kg)/s depending on equilibrium loading w in
+ * kg/kg, equilibrium temperature T in K, and their derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double w_der_kgkgs:
+ *		Derivative of equilibrium loading in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium pressure wrt. loading in
+ *		Pa/(kg/kg)/s.
+ *
+ * Remarks:
+ * --------
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_dp_dw_wT_der(double w_kgkg, double T_K, double w_der_kgkgs,
+	double T_der_Ks, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_dp_dw_wT_der, workingPair, w_kgkg, T_K, w_der_kgkgs,
+		T_der_Ks);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_dp_dw_wT_der,
+			warning_struct("workingPair", "ads_dp_dw_wT_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->adsorption == NULL) {
+		return STATISTICS_RETURN(ads_dp_dw_wT_der,
+			warning_struct("adsorption", "ads_dp_dw_wT_der"));
+
+	} else if (retWorkingPair->adsorption->dp_dw_wT == NULL) {
+		return STATISTICS_RETURN(ads_dp_dw_wT_der,
+			warning_function("dp_dw_wT", "ads_dp_dw_wT_der"));
+	}
+
+	// Calculate total derivative numerically
+	//
+	return STATISTICS_RETURN(ads_dp_dw_wT_der,
+		workingPair_second_derivative(2, w_kgkg, T_K, w_der_kgkgs, T_der_Ks,
+			retWorkingPair));
+}
+
+
+/*
+ * ads_dp_dT_wT_der:
+ * -----------------
+ *
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to temperature T in Pa/K/s depending on equilibrium loading w in
+ * kg/kg, equilibrium temperature T in K, and their derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double w_der_kgkgs:
+ *		Derivative of equilibrium loading in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium pressure wrt. temperature in
+ *		Pa/K/s.
+ *
+ * Remarks:
+ * --------
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_dp_dT_wT_der(double w_kgkg, double T_K, double w_der_kgkgs,
+	double T_der_Ks, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_dp_dT_wT_der, workingPair, w_kgkg, T_K, w_der_kgkgs,
+		T_der_Ks);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_dp_dT_wT_der,
+			warning_struct("workingPair", "ads_dp_dT_wT_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->adsorption == NULL) {
+		return STATISTICS_RETURN(ads_dp_dT_wT_der,
+			warning_struct("adsorption", "ads_dp_dT_wT_der"));
+
+	} else if (retWorkingPair->adsorption->dp_dT_wT == NULL) {
+		return STATISTICS_RETURN(ads_dp_dT_wT_der,
+			warning_function("dp_dT_wT", "ads_dp_dT_wT_der"));
+	}
+
+	// Calculate total derivative numerically
+	//
+	return STATISTICS_RETURN(ads_dp_dT_wT_der,
+		workingPair_second_derivative(3, w_kgkg, T_K, w_der_kgkgs, T_der_Ks,
+			retWorkingPair));
+}
+
+
+/*
+ * ads_piStar_pyxgTM:
+ * ------------------
+ *
+ * Calculates reduced spreading pressure piStar in kg/mol depending on
+ * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
+ * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
+ * activity coefficient of refrigerant in adsorbed phase, equilibrium
+ * temperature T in K and molar mass of refrigerant M in kg/mol. The reduced
+ * spreading pressure is defined as follows:
+ *
+ * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
+ *		Integral_0^p0{w(p,T) / p * dp}
+ *
+ *	where p0 = p_total*y / (gamma*x)
+ *
+ * Parameters:
+ * -----------
+ *	double p_total_Pa:
+ *		Total pressure of vapor phase in Pa.
+ *	double y_molmol:
+ *		Molar fraction of refrigerant in vapor phase in mol/mol.
+ *	double x_molmol:
+ *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
+ *	double gamma:
+ *		Activity coefficient of refrigerant in adsorbed phase.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double M_kgmol:
+ *		Molar mass of refrigerant M in kg/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Reduced spreading pressure in kg/mol.
+ *
+ * History:
+ * --------
+ *	01/13/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_piStar_pyxgTM(double p_total_Pa, double y_molmol,
+	double x_molmol, double gamma, double T_K, double M_kgmol,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_piStar_pyxgTM, workingPair, p_total_Pa, y_molmol, x_molmol,
+		gamma, T_K, M_kgmol);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_piStar_pyxgTM,
+			warning_struct("workingPair", "ads_piStar_pyxgTM"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_piStar_pyxgTM,
+			warning_struct("adsorption", "ads_piStar_pyxgTM"));
+		
+	} else if (retWorkingPair->adsorption->piStar_pyxgTM==NULL) {
+		return STATISTICS_RETURN(ads_piStar_pyxgTM,
+			warning_function("piStar_pyxgTM", "ads_piStar_pyxgTM"));
+
+	} else {
+		return STATISTICS_RETURN(ads_piStar_pyxgTM,
+			retWorkingPair->adsorption->piStar_pyxgTM(p_total_Pa, y_molmol,
+				x_molmol, gamma, T_K, M_kgmol, retWorkingPair->iso_par,
+				retWorkingPair->psat_par, retWorkingPair->rhol_par,
+				retWorkingPair->adsorption, retWorkingPair->refrigerant));
+
+	}
+}
+
+
+/*
+ * ads_sur_w_pT:
+ * -------------
+ *
+ * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
+ * p in Pa and equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium loading in kg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_w_pT(double p_Pa, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_sur_w_pT, workingPair, p_Pa, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_sur_w_pT,
+			warning_struct("workingPair", "ads_sur_w_pT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_sur_w_pT,
+			warning_struct("adsorption", "ads_sur_w_pT"));
+		
+	} else if (retWorkingPair->adsorption->sur_w_pT==NULL) {
+		return STATISTICS_RETURN(ads_sur_w_pT,
+			warning_function("sur_w_pT", "ads_sur_w_pT"));
+
+	} else {
+		return STATISTICS_RETURN(ads_sur_w_pT,
+			retWorkingPair->adsorption->sur_w_pT(p_Pa, T_K,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_sur_p_wT:
+ * -------------
+ *
+ * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
+ * in kg/kg and equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ * 	double:
+ *		Equilibrium pressure in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_p_wT(double w_kgkg, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_sur_p_wT, workingPair, w_kgkg, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_sur_p_wT,
+			warning_struct("workingPair", "ads_sur_p_wT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_sur_p_wT,
+			warning_struct("adsorption", "ads_sur_p_wT"));
+		
+	} else if (retWorkingPair->adsorption->sur_p_wT==NULL) {
+		return STATISTICS_RETURN(ads_sur_p_wT,
+			warning_function("sur_p_wT", "ads_sur_p_wT"));
+
+	} else {
+		return STATISTICS_RETURN(ads_sur_p_wT,
+			retWorkingPair->adsorption->sur_p_wT(w_kgkg, T_K,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_sur_T_pw:
+ * -------------
+ *
+ * Calculates equilibrium temperature in K depending on equilibrium pressure p
+ * in Pa and equilibrium loading w in kg/kg.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ * 	double:
+ *		Equilibrium temperature in K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_T_pw(double p_Pa, double w_kgkg, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_sur_T_pw, workingPair, p_Pa, w_kgkg);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_sur_T_pw,
+			warning_struct("workingPair", "ads_sur_T_pw"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_sur_T_pw,
+			warning_struct("adsorption", "ads_sur_T_pw"));
+		
+	} else if (retWorkingPair->adsorption->sur_T_pw==NULL) {
+		return STATISTICS_RETURN(ads_sur_T_pw,
+			warning_function("sur_T_pw", "ads_sur_T_pw"));
+
+	} else {
+		return STATISTICS_RETURN(ads_sur_T_pw,
+			retWorkingPair->adsorption->sur_T_pw(p_Pa, w_kgkg,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_sur_dw_dp_pT:
+ * -----------------
+ *
+ * Calculates derivative of equilibrium loading w with respect to pressure
+ * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_dw_dp_pT(double p_Pa, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_sur_dw_dp_pT, workingPair, p_Pa, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_sur_dw_dp_pT,
+			warning_struct("workingPair", "ads_sur_dw_dp_pT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_sur_dw_dp_pT,
+			warning_struct("adsorption", "ads_sur_dw_dp_pT"));
+		
+	} else if (retWorkingPair->adsorption->sur_dw_dp_pT==NULL) {
+		return STATISTICS_RETURN(ads_sur_dw_dp_pT,
+			warning_function("sur_dw_dp_pT", "ads_sur_dw_dp_pT"));
+
+	} else {
+		return STATISTICS_RETURN(ads_sur_dw_dp_pT,
+			retWorkingPair->adsorption->sur_dw_dp_pT(p_Pa, T_K,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_sur_dw_dT_pT:
+ * -----------------
+ *
+ * Calculates derivative of equilibrium loading w with respect to temperature
+ * T in kg/kg/K depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_dw_dT_pT(double p_Pa, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_sur_dw_dT_pT, workingPair, p_Pa, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_sur_dw_dT_pT,
+			warning_struct("workingPair", "ads_sur_dw_dT_pT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_sur_dw_dT_pT,
+			warning_struct("adsorption", "ads_sur_dw_dT_pT"));
+		
+	} else if (retWorkingPair->adsorption->sur_dw_dT_pT==NULL) {
+		return STATISTICS_RETURN(ads_sur_dw_dT_pT,
+			warning_function("sur_dw_dT_pT", "ads_sur_dw_dT_pT"));
+
+	} else {
+		return STATISTICS_RETURN(ads_sur_dw_dT_pT,
+			retWorkingPair->adsorption->sur_dw_dT_pT(p_Pa, T_K,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_sur_dp_dw_wT:
+ * -----------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to loading
+ * w in kgPa/kg depending on equilibrium loading w in kg/kg and equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_dp_dw_wT(double w_kgkg, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_sur_dp_dw_wT, workingPair, w_kgkg, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_sur_dp_dw_wT,
+			warning_struct("workingPair", "ads_sur_dp_dw_wT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_sur_dp_dw_wT,
+			warning_struct("adsorption", "ads_sur_dp_dw_wT"));
+		
+	} else if (retWorkingPair->adsorption->sur_dp_dw_wT==NULL) {
+		return STATISTICS_RETURN(ads_sur_dp_dw_wT,
+			warning_function("sur_dp_dw_wT", "ads_sur_dp_dw_wT"));
+
+	} else {
+		return STATISTICS_RETURN(ads_sur_dp_dw_wT,
+			retWorkingPair->adsorption->sur_dp_dw_wT(w_kgkg, T_K,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_sur_dp_dT_wT:
+ * -----------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium loading w in kg/kg and equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_dp_dT_wT(double w_kgkg, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_sur_dp_dT_wT, workingPair, w_kgkg, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_sur_dp_dT_wT,
+			warning_struct("workingPair", "ads_sur_dp_dT_wT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_sur_dp_dT_wT,
+			warning_struct("adsorption", "ads_sur_dp_dT_wT"));
+		
+	} else if (retWorkingPair->adsorption->sur_dp_dT_wT==NULL) {
+		return STATISTICS_RETURN(ads_sur_dp_dT_wT,
+			warning_function("sur_dp_dT_wT", "ads_sur_dp_dT_wT"));
+
+	} else {
+		return STATISTICS_RETURN(ads_sur_dp_dT_wT,
+			retWorkingPair->adsorption->sur_dp_dT_wT(w_kgkg, T_K,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_sur_piStar_pyxgTM:
+ * ----------------------
+ *
+ * Calculates reduced spreading pressure piStar in kg/mol depending on
+ * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
+ * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
+ * activity coefficient of refrigerant in adsorbed phase, equilibrium
+ * temperature T in K and molar mass of refrigerant M in kg/mol. The reduced
+ * spreading pressure is defined as follows:
+ *
+ * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
+ *		Integral_0^p0{w(p,T) / p * dp}
+ *
+ *	where p0 = p_total*y / (gamma*x)
+ *
+ * Parameters:
+ * -----------
+ *	double p_total_Pa:
+ *		Total pressure of vapor phase in Pa.
+ *	double y_molmol:
+ *		Molar fraction of refrigerant in vapor phase in mol/mol.
+ *	double x_molmol:
+ *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
+ *	double gamma:
+ *		Activity coefficient of refrigerant in adsorbed phase.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double M_kgmol:
+ *		Molar mass of refrigerant M in kg/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Reduced spreading pressure in kg/mol.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_piStar_pyxgTM(double p_total_Pa, double y_molmol,
+	double x_molmol, double gamma, double T_K, double M_kgmol,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_sur_piStar_pyxgTM, workingPair, p_total_Pa, y_molmol,
+		x_molmol, gamma, T_K, M_kgmol);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_sur_piStar_pyxgTM,
+			warning_struct("workingPair", "ads_sur_piStar_pyxgTM"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_sur_piStar_pyxgTM,
+			warning_struct("adsorption", "ads_sur_piStar_pyxgTM"));
+		
+	} else if (retWorkingPair->adsorption->sur_piStar_pyxgTM==NULL) {
+		return STATISTICS_RETURN(ads_sur_piStar_pyxgTM,
+			warning_function("sur_piStar_pyxgTM", "ads_sur_piStar_pyxgTM"));
+
+	} else {
+		return STATISTICS_RETURN(ads_sur_piStar_pyxgTM,
+			retWorkingPair->adsorption->sur_piStar_pyxgTM(p_total_Pa,
+				y_molmol, x_molmol, gamma, T_K, M_kgmol,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_sur_w_pTpsat:
+ * -----------------
+ *
+ * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
+ * p in Pa, equilibrium temperature T in K, and saturation pressure p_sat in Pa.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium loading in kg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_w_pTpsat(double p_Pa, double T_K, double p_sat_Pa,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_sur_w_pTpsat, workingPair, p_Pa, T_K, p_sat_Pa);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_sur_w_pTpsat,
+			warning_struct("workingPair", "ads_sur_w_pTpsat"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_sur_w_pTpsat,
+			warning_struct("adsorption", "ads_sur_w_pTpsat"));
+		
+	} else if (retWorkingPair->adsorption->sur_w_pTpsat==NULL) {
+		return STATISTICS_RETURN(ads_sur_w_pTpsat,
+			warning_function("sur_w_pTpsat", "ads_sur_w_pTpsat"));
+
+	} else {
+		return STATISTICS_RETURN(ads_sur_w_pTpsat,
+			retWorkingPair->adsorption->sur_w_pTpsat(p_Pa, T_K, p_sat_Pa,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_sur_p_wTpsat:
+ * -----------------
+ *
+ * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
+ * in kg/kg, equilibrium temperature T in K, and saturation pressure p_sat in
+ * Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ * 	double:
+ *		Equilibrium pressure in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_p_wTpsat(double w_kgkg, double T_K, double p_sat_Pa,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_sur_p_wTpsat, workingPair, w_kgkg, T_K, p_sat_Pa);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_sur_p_wTpsat,
+			warning_struct("workingPair", "ads_sur_p_wTpsat"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_sur_p_wTpsat,
+			warning_struct("adsorption", "ads_sur_p_wTpsat"));
+		
+	} else if (retWorkingPair->adsorption->sur_p_wTpsat==NULL) {
+		return STATISTICS_RETURN(ads_sur_p_wTpsat,
+			warning_function("sur_p_wTpsat", "ads_sur_p_wTpsat"));
+
+	} else {
+		return STATISTICS_RETURN(ads_sur_p_wTpsat,
+			retWorkingPair->adsorption->sur_p_wTpsat(w_kgkg, T_K, p_sat_Pa,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_sur_T_pwpsat:
+ * -----------------
+ *
+ * Calculates equilibrium temperature in K depending on equilibrium pressure p
+ * in Pa, equilibrium loading w in kg/kg, and saturation pressure p_sat in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ * 	double:
+ *		Equilibrium temperature in K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *	Uses internal equation of states to calculate vapor pressure and derivative
+ *	of vapor pressure wrt. temperature. If equation of state is not implemented
+ *	for refrigerant, function returns -1 and throws warning. If user want to use
+ *	his own equation of state, this function cannot be used and determination of
+ *	root to calculate T must be implemented by user.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_T_pwpsat(double p_Pa, double w_kgkg, double p_sat_Pa,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_sur_T_pwpsat, workingPair, p_Pa, w_kgkg, p_sat_Pa);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_sur_T_pwpsat,
+			warning_struct("workingPair", "ads_sur_T_pwpsat"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_sur_T_pwpsat,
+			warning_struct("adsorption", "ads_sur_T_pwpsat"));
+		
+	} else if (retWorkingPair->adsorption->sur_T_pwpsat==NULL) {
+		return STATISTICS_RETURN(ads_sur_T_pwpsat,
+			warning_function("sur_T_pwpsat", "ads_sur_T_pwpsat"));
+
+	} else if (retWorkingPair->refrigerant->p_sat_T==NULL) {
+		return STATISTICS_RETURN(ads_sur_T_pwpsat,
+			warning_function("psat_T", "ads_sur_T_pwpsat"));
+
+	} else if (retWorkingPair->refrigerant->dp_sat_dT==NULL) {
+		return STATISTICS_RETURN(ads_sur_T_pwpsat,
+			warning_function("dpsat_dT", "ads_sur_T_pwpsat"));
+
+	} else if (retWorkingPair->psat_par==NULL) {
+		return STATISTICS_RETURN(ads_sur_T_pwpsat,
+			warning_parameter("saturation pressure and its derivative "
+				"with respect to temperature", "ads_sur_T_pwpsat"));
+
+	} else {
+		// Avoid compiler warning C4100 by adding "do nothing" expression
+		// "Do nothing" expression will be optimized out by compiler
+		//
+		(p_sat_Pa) = (p_sat_Pa);
+
+		return STATISTICS_RETURN(ads_sur_T_pwpsat,
+			retWorkingPair->adsorption->sur_T_pwpsat(p_Pa, w_kgkg,
+				retWorkingPair->refrigerant->p_sat_T,
+				retWorkingPair->refrigerant->dp_sat_dT,
+				retWorkingPair->iso_par, retWorkingPair->psat_par,
+				retWorkingPair->refrigerant));
+
+	}
+}
+
+
+/*
+ * ads_sur_dw_dp_pTpsat:
+ * ---------------------
+ *
+ * Calculates derivative of equilibrium loading w with respect to pressure
+ * p in kg/kg/Pa depending on equilibrium pressure p in Pa, equilibrium
+ * temperature T in K, and saturation pressure p_sat in Pa.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_dw_dp_pTpsat(double p_Pa, double T_K, double p_sat_Pa,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_sur_dw_dp_pTpsat, workingPair, p_Pa, T_K, p_sat_Pa);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_sur_dw_dp_pTpsat,
+			warning_struct("workingPair", "ads_sur_dw_dp_pTpsat"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_sur_dw_dp_pTpsat,
+			warning_struct("adsorption", "ads_sur_dw_dp_pTpsat"));
+		
+	} else if (retWorkingPair->adsorption->sur_dw_dp_pTpsat==NULL) {
+		return STATISTICS_RETURN(ads_sur_dw_dp_pTpsat,
+			warning_function("sur_dw_dp_pTpsat", "ads_sur_dw_dp_pTpsat"));
+
+	} else {
+		return STATISTICS_RETURN(ads_sur_dw_dp_pTpsat,
+			retWorkingPair->adsorption->sur_dw_dp_pTpsat(p_Pa, T_K, p_sat_Pa,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_sur_dw_dT_pTpsat:
+ * ---------------------
+ *
+ * Calculates derivative of equilibrium loading w with respect to temperature
+ * T in kg/kg/K depending on equilibrium pressure p in Pa, equilibrium
+ * temperature T in K, saturation pressure p_sat in Pa, and derivative of
+ * saturation pressure wrt. temperature dp_sat_dT in Pa/K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	double dp_sat_dT_PaK:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_dw_dT_pTpsat(double p_Pa, double T_K, double p_sat_Pa,
+	double dp_sat_dT_PaK, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_sur_dw_dT_pTpsat, workingPair, p_Pa, T_K, p_sat_Pa,
+		dp_sat_dT_PaK);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_sur_dw_dT_pTpsat,
+			warning_struct("workingPair", "ads_sur_dw_dT_pTpsat"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_sur_dw_dT_pTpsat,
+			warning_struct("adsorption", "ads_sur_dw_dT_pTpsat"));
+		
+	} else if (retWorkingPair->adsorption->sur_dw_dT_pTpsat==NULL) {
+		return STATISTICS_RETURN(ads_sur_dw_dT_pTpsat,
+			warning_function("sur_dw_dT_pTpsat", "ads_sur_dw_dT_pTpsat"));
+
+	} else {
+		return STATISTICS_RETURN(ads_sur_dw_dT_pTpsat,
+			retWorkingPair->adsorption->sur_dw_dT_pTpsat(p_Pa, T_K, p_sat_Pa,
+				dp_sat_dT_PaK, retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_sur_dp_dw_wTpsat:
+ * ---------------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to loading
+ * w in kgPa/kg depending on equilibrium loading w in kg/kg, equilibrium
+ * temperature T in K, and saturation pressure p_sat in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_dp_dw_wTpsat(double w_kgkg, double T_K, double p_sat_Pa,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_sur_dp_dw_wTpsat, workingPair, w_kgkg, T_K, p_sat_Pa);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_sur_dp_dw_wTpsat,
+			warning_struct("workingPair", "ads_sur_dp_dw_wTpsat"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_sur_dp_dw_wTpsat,
+			warning_struct("adsorption", "ads_sur_dp_dw_wTpsat"));
+		
+	} else if (retWorkingPair->adsorption->sur_dp_dw_wTpsat==NULL) {
+		return STATISTICS_RETURN(ads_sur_dp_dw_wTpsat,
+			warning_function("sur_dp_dw_wTpsat", "ads_sur_dp_dw_wTpsat"));
+
+	} else {
+		return STATISTICS_RETURN(ads_sur_dp_dw_wTpsat,
+			retWorkingPair->adsorption->sur_dp_dw_wTpsat(w_kgkg, T_K,
+				 p_sat_Pa, retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_sur_dp_dT_wTpsat:
+ * ---------------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium loading w in kg/kg, equilibrium
+ * temperature T in K, saturation pressure p_sat in Pa, and derivative of
+ * saturation pressure wrt. temperature dp_sat_dT in Pa/K.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	double dp_sat_dT_PaK:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_dp_dT_wTpsat(double w_kgkg, double T_K, double p_sat_Pa,
+	double dp_sat_dT_PaK, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_sur_dp_dT_wTpsat, workingPair, w_kgkg, T_K, p_sat_Pa,
+		dp_sat_dT_PaK);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_sur_dp_dT_wTpsat,
+			warning_struct("workingPair", "ads_sur_dp_dT_wTpsat"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_sur_dp_dT_wTpsat,
+			warning_struct("adsorption", "ads_sur_dp_dT_wTpsat"));
+		
+	} else if (retWorkingPair->adsorption->sur_dp_dT_wTpsat==NULL) {
+		return STATISTICS_RETURN(ads_sur_dp_dT_wTpsat,
+			warning_function("sur_dp_dT_wTpsat", "ads_sur_dp_dT_wTpsat"));
+
+	} else {
+		return STATISTICS_RETURN(ads_sur_dp_dT_wTpsat,
+			retWorkingPair->adsorption->sur_dp_dT_wTpsat(w_kgkg, T_K,
+				p_sat_Pa, dp_sat_dT_PaK, retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_sur_piStar_pyxgTpsatM:
+ * --------------------------
+ *
+ * Calculates reduced spreading pressure piStar in kg/mol depending on
+ * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
+ * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
+ * activity coefficient of refrigerant in adsorbed phase, equilibrium
+ * temperature T in K, saturation pressure p_sat in Pa, and molar mass of
+ * refrigerant M in kg/mol. The reduced spreading pressure is defined as
+ * follows:
+ *
+ * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
+ *		Integral_0^p0{w(p,T) / p * dp}
+ *
+ *	where p0 = p_total*y / (gamma*x)
+ *
+ * Parameters:
+ * -----------
+ *	double p_total_Pa:
+ *		Total pressure of vapor phase in Pa.
+ *	double y_molmol:
+ *		Molar fraction of refrigerant in vapor phase in mol/mol.
+ *	double x_molmol:
+ *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
+ *	double gamma:
+ *		Activity coefficient of refrigerant in adsorbed phase.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ *	double M_kgmol:
+ *		Molar mass of refrigerant M in kg/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Reduced spreading pressure in kg/mol.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *
+ * History:
+ * --------
+ *	03/27/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_sur_piStar_pyxgTpsatM(double p_total_Pa, double y_molmol,
+	double x_molmol, double gamma, double T_K, double p_sat_Pa, double M_kgmol,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_sur_piStar_pyxgTpsatM, workingPair, p_total_Pa, y_molmol,
+		x_molmol, gamma, T_K, p_sat_Pa, M_kgmol);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_sur_piStar_pyxgTpsatM,
+			warning_struct("workingPair", "ads_sur_piStar_pyxgTpsatM"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_sur_piStar_pyxgTpsatM,
+			warning_struct("adsorption", "ads_sur_piStar_pyxgTpsatM"));
+		
+	} else if (retWorkingPair->adsorption->sur_piStar_pyxgTpsatM==NULL) {
+		return STATISTICS_RETURN(ads_sur_piStar_pyxgTpsatM,
+			warning_function("sur_piStar_pyxgTpsatM",
+				"ads_sur_piStar_pyxgTpsatM"));
+
+	} else {
+		return STATISTICS_RETURN(ads_sur_piStar_pyxgTpsatM,
+			retWorkingPair->adsorption->sur_piStar_pyxgTpsatM(p_total_Pa,
+				y_molmol, x_molmol, gamma, T_K, p_sat_Pa, M_kgmol,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_vol_W_ARho:
+ * ---------------
+ *
+ * Calculates equilibrium volumetric loading W in m³/kg depending on equilibrium
+ * adsorption potential A in J/mol and saturated liquid density of adsorpt rho_l
+ * in kg/m3.
+ *
+ * Parameters:
+ * -----------
+ * 	double A_Jmol:
+ *		Equilibrium adsorption potential A in J/mol.
+ * 	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium volumetric loading W in m³/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *	Saturated liquid density of adsorpt is required to calculate volumetric
+ *	loading from characteristic curve in m3/kg when coefficients would directly
+ *	return loading w in kg/kg. Therefore, function checks unit of coefficients
+ *	by checking isotherm coefficients.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_W_ARho(double A_Jmol, double rho_l_kgm3,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_vol_W_ARho, workingPair, A_Jmol, rho_l_kgm3);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_vol_W_ARho,
+			warning_struct("workingPair", "ads_vol_W_ARho"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_vol_W_ARho,
+			warning_struct("adsorption", "ads_vol_W_ARho"));
+		
+	} else if (retWorkingPair->adsorption->vol_W_ARho==NULL) {
+		return STATISTICS_RETURN(ads_vol_W_ARho,
+			warning_function("vol_W_ARho", "ads_vol_W_ARho"));
+
+	} else {
+		return STATISTICS_RETURN(ads_vol_W_ARho,
+			retWorkingPair->adsorption->vol_W_ARho(A_Jmol, rho_l_kgm3,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_vol_A_WRho:
+ * ---------------
+ *
+ * Calculates equilibrium adsorption potential A in J/mol depending on
+ * equilibrium volumetric loading W in m³/kg and saturated liquid density of
+ * adsorpt rho_l in kg/m3.
+ *
+ * Parameters:
+ * -----------
+ * 	double W_m3kg:
+ *		Equilibrium volumetric loading W in m³/kg.
+ * 	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium adsorption potential A in J/mol.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *	Saturated liquid density of adsorpt is required to calculate volumetric
+ *	loading from characteristic curve in m3/kg when coefficients would directly
+ *	return loading w in kg/kg.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_A_WRho(double W_m3kg, double rho_l_kgm3,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_vol_A_WRho, workingPair, W_m3kg, rho_l_kgm3);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_vol_A_WRho,
+			warning_struct("workingPair", "ads_vol_A_WRho"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_vol_A_WRho,
+			warning_struct("adsorption", "ads_vol_A_WRho"));
+		
+	} else if (retWorkingPair->adsorption->vol_A_WRho==NULL) {
+		return STATISTICS_RETURN(ads_vol_A_WRho,
+			warning_function("vol_A_WRho", "ads_vol_A_WRho"));
+
+	} else {
+		return STATISTICS_RETURN(ads_vol_A_WRho,
+			retWorkingPair->adsorption->vol_A_WRho(W_m3kg, rho_l_kgm3,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_vol_w_pTpsatRho:
+ * --------------------
+ *
+ * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
+ * p in Pa, equilibrium temperature T in K, saturation pressure p_Sat in Pa and
+ * saturated liquid density of adsorpt rho in kg/m³.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt in kg/m³.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium loading in kg/kg.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_w_pTpsatRho(double p_Pa, double T_K, double p_sat_Pa,
+	double rho_kgm3, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_vol_w_pTpsatRho, workingPair, p_Pa, T_K, p_sat_Pa,
+		rho_kgm3);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_vol_w_pTpsatRho,
+			warning_struct("workingPair", "ads_vol_w_pTpsatRho"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_vol_w_pTpsatRho,
+			warning_struct("adsorption", "ads_vol_w_pTpsatRho"));
+		
+	} else if (retWorkingPair->adsorption->vol_w_pTpsatRho==NULL) {
+		return STATISTICS_RETURN(ads_vol_w_pTpsatRho,
+			warning_function("vol_w_pTpsatRho", "ads_vol_w_pTpsatRho"));
+
+	} else {
+		return STATISTICS_RETURN(ads_vol_w_pTpsatRho,
+			retWorkingPair->adsorption->vol_w_pTpsatRho(p_Pa, T_K, p_sat_Pa,
+				rho_kgm3, retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_vol_p_wTpsatRho:
+ * --------------------
+ *
+ * Calculates equilibrium pressure p in Pa depending on equilibrium loading w in
+ * kg/kg, equilibrium temperature T in K, saturation pressure p_Sat in Pa and
+ * density of adsorpt rho in kg/m³.
+ *
+ * Parameters:
+ * -----------
+ * 	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_p_wTpsatRho(double w_kgkg, double T_K, double p_sat_Pa,
+	double rho_kgm3, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_vol_p_wTpsatRho, workingPair, w_kgkg, T_K, p_sat_Pa,
+		rho_kgm3);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_vol_p_wTpsatRho,
+			warning_struct("workingPair", "ads_vol_p_wTpsatRho"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_vol_p_wTpsatRho,
+			warning_struct("adsorption", "ads_vol_p_wTpsatRho"));
+		
+	} else if (retWorkingPair->adsorption->vol_p_wTpsatRho==NULL) {
+		return STATISTICS_RETURN(ads_vol_p_wTpsatRho,
+			warning_function("vol_p_wTpsatRho", "ads_vol_p_wTpsatRho"));
+
+	} else {
+		return STATISTICS_RETURN(ads_vol_p_wTpsatRho,
+			retWorkingPair->adsorption->vol_p_wTpsatRho(w_kgkg, T_K,
+				p_sat_Pa, rho_kgm3,retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_vol_T_pwpsatRho:
+ * --------------------
+ *
+ * Calculates equilibrium temperature T in K depending on equilibrium pressure
+ * in Pa, equilibrium loading w in kg/kg, saturation pressure p_Sat in Pa and
+ * density of adsorpt rho in kg/m³.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ * 	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium temperature in K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *	Uses internal equations of states to calculate vapor pressure, saturated
+ *	liquid density of adsorpt, derivative of vapor pressure wrt. temperature
+ *	and derivative of saturated liquid density of adsorpt wrt. temperature. If
+ *	equation of states are not implemented for refrigerant, function returns -1
+ *  and throws warning. If user want to use his own equation of states, this
+ *  function cannot be used and determination of root to calculate T must
+ *  be implemented by user.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_T_pwpsatRho(double p_Pa, double w_kgkg, double p_sat_Pa,
+	double rho_kgm3, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_vol_T_pwpsatRho, workingPair, p_Pa, w_kgkg, p_sat_Pa,
+		rho_kgm3);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_vol_T_pwpsatRho,
+			warning_struct("workingPair", "ads_vol_T_pwpsatRho"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_vol_T_pwpsatRho,
+			warning_struct("adsorption", "ads_vol_T_pwpsatRho"));
+		
+	} else if (retWorkingPair->adsorption->vol_T_pwpsatRho==NULL) {
+		return STATISTICS_RETURN(ads_vol_T_pwpsatRho,
+			warning_function("vol_T_pwpsatRho", "ads_vol_T_pwpsatRho"));
+
+	} else if (retWorkingPair->refrigerant->p_sat_T==NULL) {
+		return STATISTICS_RETURN(ads_vol_T_pwpsatRho,
+			warning_function("p_sat_T", "ads_vol_T_pwpsatRho"));
+
+	} else if (retWorkingPair->refrigerant->rho_l_T==NULL) {
+		return STATISTICS_RETURN(ads_vol_T_pwpsatRho,
+			warning_function("rho_l_T", "ads_vol_T_pwpsatRho"));
+
+	} else if (retWorkingPair->refrigerant->dp_sat_dT==NULL) {
+		return STATISTICS_RETURN(ads_vol_T_pwpsatRho,
+			warning_function("dp_sat_dT", "ads_vol_T_pwpsatRho"));
+
+	} else if (retWorkingPair->refrigerant->drho_l_dT==NULL) {
+		return STATISTICS_RETURN(ads_vol_T_pwpsatRho,
+			warning_function("drho_l_dT", "ads_vol_T_pwpsatRho"));
+
+	} else if (retWorkingPair->psat_par==NULL) {
+		return STATISTICS_RETURN(ads_vol_T_pwpsatRho,
+			warning_parameter("saturated vapor pressure and its derivative "
+				"with respect to temperature", "ads_vol_T_pwpsatRho"));
+
+	} else if (retWorkingPair->rhol_par==NULL) {
+		return STATISTICS_RETURN(ads_vol_T_pwpsatRho,
+			warning_parameter("saturated liquid density and its derivative "
+				"with respect to temperature", "ads_vol_T_pwpsatRho"));
+
+	} else {
+		// Avoid compiler warning C4100 by adding "do nothing" expression
+		// "Do nothing" expression will be optimized out by compiler
+		//
+		(p_sat_Pa) = (p_sat_Pa);
+		(rho_kgm3) = (rho_kgm3);
+
+		return STATISTICS_RETURN(ads_vol_T_pwpsatRho,
+			retWorkingPair->adsorption->vol_T_pwpsatRho(p_Pa, w_kgkg,
+				retWorkingPair->refrigerant->p_sat_T,
+				retWorkingPair->refrigerant->rho_l_T,
+				retWorkingPair->refrigerant->dp_sat_dT,
+				retWorkingPair->refrigerant->drho_l_dT,
+				retWorkingPair->iso_par, retWorkingPair->psat_par,
+				retWorkingPair->rhol_par,
+				retWorkingPair->refrigerant));
+
+	}
+}
+
+
+/*
+ * ads_vol_dW_dA_ARho:
+ * -------------------
+ *
+ * Calculates derivative of equilibrium volumetric loading dW_dA in m³mol/kg/J
+ * depending on equilibrium adsorption potential A in J/mol and saturated liquid
+ * density of adsorpt rho_l in kg/m3.
+ *
+ * Parameters:
+ * -----------
+ * 	double A_Jmol:
+ *		Equilibrium adsorption potential A in mol/J.
+ * 	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of volumetric loading wrt. adsorption potential in
+ *		m³mol/kg/J.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *	Saturated liquid density of adsorpt is required to calculate volumetric
+ *	loading from characteristic curve in m3/kg when coefficients would directly
+ *	return loading w in kg/kg.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_dW_dA_ARho(double A_Jmol, double rho_l_kgm3,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_vol_dW_dA_ARho, workingPair, A_Jmol, rho_l_kgm3);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_vol_dW_dA_ARho,
+			warning_struct("workingPair", "ads_vol_dW_dA_ARho"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_vol_dW_dA_ARho,
+			warning_struct("adsorption", "ads_vol_dW_dA_ARho"));
+		
+	} else if (retWorkingPair->adsorption->vol_dW_dA_ARho==NULL) {
+		return STATISTICS_RETURN(ads_vol_dW_dA_ARho,
+			warning_function("vol_dW_dA_ARho", "ads_vol_dW_dA_ARho"));
+
+	} else {
+		return STATISTICS_RETURN(ads_vol_dW_dA_ARho,
+			retWorkingPair->adsorption->vol_dW_dA_ARho(A_Jmol, rho_l_kgm3,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_vol_dA_dW_WRho:
+ * -------------------
+ *
+ * Calculates derivative of equilibrium adsorption potential dA_dW in kgJ/mol/m³
+ * depending on equilibrium volumetric loading W in m³/kg and saturated liquid
+ * density of adsorpt rho_l in kg/m3.
+ *
+ * Parameters:
+ * -----------
+ * 	double W_m3kg:
+ *		Equilibrium volumetric loading W in m³/kg.
+ * 	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of adsorption potential wrt. volumetric loading in
+ *		kgJ/mol/m³.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *	Saturated liquid density of adsorpt is required to calculate volumetric
+ *	loading from characteristic curve in m3/kg when coefficients would directly
+ *	return loading w in kg/kg.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_dA_dW_WRho(double W_m3kg, double rho_l_kgm3,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_vol_dA_dW_WRho, workingPair, W_m3kg, rho_l_kgm3);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_vol_dA_dW_WRho,
+			warning_struct("workingPair", "ads_vol_dA_dW_WRho"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_vol_dA_dW_WRho,
+			warning_struct("adsorption", "ads_vol_dA_dW_WRho"));
+		
+	} else if (retWorkingPair->adsorption->vol_dA_dW_WRho==NULL) {
+		return STATISTICS_RETURN(ads_vol_dA_dW_WRho,
+			warning_function("vol_dA_dW_WRho", "ads_vol_dA_dW_WRho"));
+
+	} else {
+		return STATISTICS_RETURN(ads_vol_dA_dW_WRho,
+			retWorkingPair->adsorption->vol_dA_dW_WRho(W_m3kg, rho_l_kgm3,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_vol_dw_dp_pTpsatRho:
+ * ------------------------
+ *
+ * Calculates derivative of equilibrium loading dw_dp with respect to pressure
+ * in kg/kg/Pa depending on equilibrium pressure p in Pa, equilibrium
+ * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
+ * rho in kg/m³.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_dw_dp_pTpsatRho(double p_Pa, double T_K, double p_sat_Pa,
+	double rho_kgm3, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_vol_dw_dp_pTpsatRho, workingPair, p_Pa, T_K, p_sat_Pa,
+		rho_kgm3);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_vol_dw_dp_pTpsatRho,
+			warning_struct("workingPair", "ads_vol_dw_dp_pTpsatRho"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_vol_dw_dp_pTpsatRho,
+			warning_struct("adsorption", "ads_vol_dw_dp_pTpsatRho"));
+		
+	} else if (retWorkingPair->adsorption->vol_dw_dp_pTpsatRho==NULL) {
+		return STATISTICS_RETURN(ads_vol_dw_dp_pTpsatRho,
+			warning_function("vol_dw_dp_pTpsatRho",
+				"ads_vol_dw_dp_pTpsatRho"));
+
+	} else {
+		return STATISTICS_RETURN(ads_vol_dw_dp_pTpsatRho,
+			retWorkingPair->adsorption->vol_dw_dp_pTpsatRho(p_Pa, T_K,
+				p_sat_Pa, rho_kgm3, retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_vol_dw_dT_pTpsatRho:
+ * ------------------------
+ *
+ * Calculates derivative of equilibrium loading dw_dp with respect to
+ * temperature in kg/kg/K depending on equilibrium pressure p in Pa, equilibrium
+ * temperature T in K, saturation pressure p_Sat in Pa, density of adsorpt
+ * rho in kg/m³, derivative of saturation pressure with respect to temperature
+ * dp_sat_dT in Pa/K and derivative of density of adsorpt with respect to
+ * temperature drho_dT in kg/m³/K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ * 	double dp_sat_dT_PaK:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ *	double drho_dT_kgm3K:
+ *		Derivative of density of adsorpt wrt. temperature in kg/m³/K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *
+ * History:
+ * --------
+ *	01/07/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_dw_dT_pTpsatRho(double p_Pa, double T_K, double p_sat_Pa,
+	double rho_kgm3, double dp_sat_dT_PaK, double drho_dT_kgm3K,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_vol_dw_dT_pTpsatRho, workingPair, p_Pa, T_K, p_sat_Pa,
+		rho_kgm3, dp_sat_dT_PaK, drho_dT_kgm3K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_vol_dw_dT_pTpsatRho,
+			warning_struct("workingPair", "ads_vol_dw_dT_pTpsatRho"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_vol_dw_dT_pTpsatRho,
+			warning_struct("adsorption", "ads_vol_dw_dT_pTpsatRho"));
+		
+	} else if (retWorkingPair->adsorption->vol_dw_dT_pTpsatRho==NULL) {
+		return STATISTICS_RETURN(ads_vol_dw_dT_pTpsatRho,
+			warning_function("vol_dw_dT_pTpsatRho",
+				"ads_vol_dw_dT_pTpsatRho"));
+
+	} else {
+		return STATISTICS_RETURN(ads_vol_dw_dT_pTpsatRho,
+			retWorkingPair->adsorption->vol_dw_dT_pTpsatRho(p_Pa, T_K,
+				p_sat_Pa, rho_kgm3, dp_sat_dT_PaK, drho_dT_kgm3K,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_vol_dp_dw_wTpsatRho:
+ * ------------------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to loading
+ * w in kgPa/kg depending on equilibrium loading w in kg/kg, equilibrium
+ * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
+ * rho in kg/m³.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *
+ * History:
+ * --------
+ *	01/13/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_dp_dw_wTpsatRho(double w_kgkg, double T_K,
+	double p_sat_Pa, double rho_kgm3, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_vol_dp_dw_wTpsatRho, workingPair, w_kgkg, T_K, p_sat_Pa,
+		rho_kgm3);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_vol_dp_dw_wTpsatRho,
+			warning_struct("workingPair", "ads_vol_dp_dw_wTpsatRho"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_vol_dp_dw_wTpsatRho,
+			warning_struct("adsorption", "ads_vol_dp_dw_wTpsatRho"));
+		
+	} else if (retWorkingPair->adsorption->vol_dp_dw_wTpsatRho==NULL) {
+		return STATISTICS_RETURN(ads_vol_dp_dw_wTpsatRho,
+			warning_function("vol_dp_dw_wTpsatRho",
+				"ads_vol_dp_dw_wTpsatRho"));
+
+	} else {
+		return STATISTICS_RETURN(ads_vol_dp_dw_wTpsatRho,
+			retWorkingPair->adsorption->vol_dp_dw_wTpsatRho(w_kgkg, T_K,
+				p_sat_Pa, rho_kgm3, retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_vol_dp_dT_wTpsatRho:
+ * ------------------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium loading w in kg/kg, equilibrium
+ * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
+ * rho in kg/m³, derivative of saturation pressure with respect to temperature
+ * dp_sat_dT in Pa/K and derivative of density of adsorpt with respect to
+ * temperature drho_dT in kg/m³/K.
+ *
+ * Parameters:
+ * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ * 	double dp_sat_dT_PaK:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ *	double drho_dT_kgm3K:
+ *		Derivative of density of adsorpt wrt. temperature in kg/m³/K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *
+ * History:
+ * --------
+ *	01/13/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_dp_dT_wTpsatRho(double w_kgkg, double T_K,
+	double p_sat_Pa, double rho_kgm3, double dp_sat_dT_PaK,
+	double drho_dT_kgm3K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_vol_dp_dT_wTpsatRho, workingPair, w_kgkg, T_K, p_sat_Pa,
+		rho_kgm3, dp_sat_dT_PaK, drho_dT_kgm3K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_vol_dp_dT_wTpsatRho,
+			warning_struct("workingPair", "ads_vol_dp_dT_wTpsatRho"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_vol_dp_dT_wTpsatRho,
+			warning_struct("adsorption", "ads_vol_dp_dT_wTpsatRho"));
+		
+	} else if (retWorkingPair->adsorption->vol_dp_dT_wTpsatRho==NULL) {
+		return STATISTICS_RETURN(ads_vol_dp_dT_wTpsatRho,
+			warning_function("vol_dp_dT_wTpsatRho",
+				"ads_vol_dp_dT_wTpsatRho"));
+
+	} else {
+		return STATISTICS_RETURN(ads_vol_dp_dT_wTpsatRho,
+			retWorkingPair->adsorption->vol_dp_dT_wTpsatRho(w_kgkg, T_K,
+				p_sat_Pa, rho_kgm3, dp_sat_dT_PaK, drho_dT_kgm3K,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * ads_vol_piStar_pyxgTpsatRhoM:
+ * -----------------------------
+ *
+ * Calculates reduced spreading pressure in kg/mol depending on equilibrium
+ * pressure p in Pa, molar fraction of refrigerant in vapor phase in mol/mol,
+ * molar fraction of refrigerant in adsorbed phase in mol/mol, activity
+ * coefficient of refrigerant in adsorbed phase, equilibrium temperature T in K,
+ * saturation pressure p_Sat in Pa and density of adsorpt rho in kg/m³ and molar
+ * mass of refrigerant M in kg/mol. The reduced spreading pressure is defined as
+ * follows:
+ *
+ * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
+ *		Integral_0^p0{w(p,T) / p * dp}
+ *
+ *	where p0 = p_total*y / (gamma*x)
+ *
+ * Parameters:
+ * -----------
+ *	double p_total_Pa:
+ *		Total pressure of vapor phase in Pa.
+ *	double y_molmol:
+ *		Molar fraction of refrigerant in vapor phase in mol/mol.
+ *	double x_molmol:
+ *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
+ *	double gamma:
+ *		Activity coefficient of refrigerant in adsorbed phase.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ *	double M_kgmol:
+ *		Molar mass of refrigerant M in kg/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Reduced spreading pressure in kg/mol.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *
+ * History:
+ * --------
+ *	01/13/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ads_vol_piStar_pyxgTpsatRhoM(double p_total_Pa, double y_molmol,
+	double x_molmol, double gamma, double T_K, double p_sat_Pa,
+	double rho_kgm3, double M_kgmol, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ads_vol_piStar_pyxgTpsatRhoM, workingPair, p_total_Pa, y_molmol,
+		x_molmol, gamma, T_K, p_sat_Pa, rho_kgm3, M_kgmol);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ads_vol_piStar_pyxgTpsatRhoM,
+			warning_struct("workingPair", "ads_vol_piStar_pyxgTpsatRhoM"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->adsorption== NULL) {
+		return STATISTICS_RETURN(ads_vol_piStar_pyxgTpsatRhoM,
+			warning_struct("adsorption", "ads_vol_piStar_pyxgTpsatRhoM"));
+		
+	} else if (retWorkingPair->adsorption->vol_piStar_pyxgTpsatRhoM==NULL) {
+		return STATISTICS_RETURN(ads_vol_piStar_pyxgTpsatRhoM,
+			warning_function("vol_piStar_pyxgTpsatRhoM",
+				"ads_vol_piStar_pyxgTpsatRhoM"));
+
+	} else {
+		return STATISTICS_RETURN(ads_vol_piStar_pyxgTpsatRhoM,
+			retWorkingPair->adsorption->vol_piStar_pyxgTpsatRhoM(p_total_Pa,
+				y_molmol, x_molmol, gamma, T_K, p_sat_Pa, rho_kgm3, M_kgmol,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+////////////////////////////////////////////////////////////////////////////
+// Definition of function prototypes regarding absorption working w struct//
+////////////////////////////////////////////////////////////////////////////
+/*
+ * abs_con_X_pT:
+ * -------------
+ *
+ * Calculates equilibrium concentration X in kg/kg depending on equilibrium
+ * pressure p in Pa and equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium concentration in kg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_X_pT(double p_Pa, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_con_X_pT, workingPair, p_Pa, T_K);
+	double X_kgkg;
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_con_X_pT,
+			warning_struct("workingPair", "abs_X_pT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->absorption== NULL) {
+		return STATISTICS_RETURN(abs_con_X_pT,
+			warning_struct("absorption", "abs_con_X_pT"));
+		
+	} else if (retWorkingPair->absorption->con_X_pT==NULL) {
+		return STATISTICS_RETURN(abs_con_X_pT,
+			warning_function("con_X_pT", "abs_con_X_pT"));
+
+	} else if (retWorkingPair->surrogates != NULL &&
+		surrogate2D_approximate(&X_kgkg, log(p_Pa), T_K,
+		retWorkingPair->surrogates->w_pT) == 0) {
+		return STATISTICS_RETURN(abs_con_X_pT, X_kgkg);
+
+	} else {
+		return STATISTICS_RETURN(abs_con_X_pT,
+			retWorkingPair->absorption->con_X_pT(p_Pa, T_K,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * abs_con_p_XT:
+ * -------------
+ *
+ * Calculates equilibrium pressure p in Pa depending on equilibrium
+ * concentration X in kg/kg and equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ * 	double:
+ *		Equilibrium pressure in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_p_XT(double X_kgkg, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_con_p_XT, workingPair, X_kgkg, T_K);
+	double p_Pa;
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_con_p_XT,
+			warning_struct("workingPair", "abs_p_XT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->absorption== NULL) {
+		return STATISTICS_RETURN(abs_con_p_XT,
+			warning_struct("absorption", "abs_con_p_XT"));
+		
+	} else if (retWorkingPair->absorption->con_p_XT==NULL) {
+		return STATISTICS_RETURN(abs_con_p_XT,
+			warning_function("con_p_XT", "abs_con_p_XT"));
+
+	} else if (retWorkingPair->surrogates != NULL &&
+		surrogate2D_approximate(&p_Pa, X_kgkg, T_K,
+		retWorkingPair->surrogates->p_wT) == 0) {
+		return STATISTICS_RETURN(abs_con_p_XT, p_Pa);
+
+	} else {
+		return STATISTICS_RETURN(abs_con_p_XT,
+			retWorkingPair->absorption->con_p_XT(X_kgkg, T_K,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * abs_con_T_pX:
+ * -------------
+ *
+ * Calculates equilibrium temperature in K depending on equilibrium pressure p
+ * in Pa and equilibrium concentration X in kg/kg.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ * 	double:
+ *		Equilibrium temperature in K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_T_pX(double p_Pa, double X_kgkg, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_con_T_pX, workingPair, p_Pa, X_kgkg);
+	double T_K;
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_con_T_pX,
+			warning_struct("workingPair", "abs_T_pX"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->absorption== NULL) {
+		return STATISTICS_RETURN(abs_con_T_pX,
+			warning_struct("absorption", "abs_con_T_pX"));
+		
+	} else if (retWorkingPair->absorption->con_T_pX==NULL) {
+		return STATISTICS_RETURN(abs_con_T_pX,
+			warning_function("con_T_pX", "abs_con_T_pX"));
+
+	} else if (retWorkingPair->surrogates != NULL &&
+		surrogate2D_approximate(&T_K, log(p_Pa), X_kgkg,
+		retWorkingPair->surrogates->T_pw) == 0) {
+		return STATISTICS_RETURN(abs_con_T_pX, T_K);
+
+	} else {
+		return STATISTICS_RETURN(abs_con_T_pX,
+			retWorkingPair->absorption->con_T_pX(p_Pa, X_kgkg,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * abs_con_dX_dp_pT:
+ * -----------------
+ *
+ * Calculates derivative of equilibrium concentration X with respect to pressure
+ * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium concentration wrt. pressure in kg/kg/Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_dX_dp_pT(double p_Pa, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_con_dX_dp_pT, workingPair, p_Pa, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_con_dX_dp_pT,
+			warning_struct("workingPair", "abs_dX_dp_pT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->absorption== NULL) {
+		return STATISTICS_RETURN(abs_con_dX_dp_pT,
+			warning_struct("absorption", "abs_con_dX_dp_pT"));
+		
+	} else if (retWorkingPair->absorption->con_dX_dp_pT==NULL) {
+		return STATISTICS_RETURN(abs_con_dX_dp_pT,
+			warning_function("con_dX_dp_pT", "abs_con_dX_dp_pT"));
+
+	} else {
+		return STATISTICS_RETURN(abs_con_dX_dp_pT,
+			retWorkingPair->absorption->con_dX_dp_pT(p_Pa, T_K,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * abs_con_dX_dT_pT:
+ * -----------------
+ *
+ * Calculates derivative of equilibrium concentration X with respect to
+ * temperature T in kg/kg/K depending on equilibrium pressure p in Pa and
+ * equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium concentration wrt. temperature in kg/kg/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_dX_dT_pT(double p_Pa, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_con_dX_dT_pT, workingPair, p_Pa, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_con_dX_dT_pT,
+			warning_struct("workingPair", "abs_dX_dT_pT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->absorption== NULL) {
+		return STATISTICS_RETURN(abs_con_dX_dT_pT,
+			warning_struct("absorption", "abs_con_dX_dT_pT"));
+		
+	} else if (retWorkingPair->absorption->con_dX_dT_pT==NULL) {
+		return STATISTICS_RETURN(abs_con_dX_dT_pT,
+			warning_function("con_dX_dT_pT", "abs_con_dX_dT_pT"));
+
+	} else {
+		return STATISTICS_RETURN(abs_con_dX_dT_pT,
+			retWorkingPair->absorption->con_dX_dT_pT(p_Pa, T_K,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * abs_con_dp_dX_XT:
+ * -----------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to concentration
+ * w in kgPa/kg depending on equilibrium concentration X in kg/kg and
+ * equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. concentration in Pakg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_dp_dX_XT(double X_kgkg, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_con_dp_dX_XT, workingPair, X_kgkg, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_con_dp_dX_XT,
+			warning_struct("workingPair", "abs_dp_dX_XT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->absorption== NULL) {
+		return STATISTICS_RETURN(abs_con_dp_dX_XT,
+			warning_struct("absorption", "abs_con_dp_dX_XT"));
+		
+	} else if (retWorkingPair->absorption->con_dp_dX_XT==NULL) {
+		return STATISTICS_RETURN(abs_con_dp_dX_XT,
+			warning_function("con_dp_dX_XT", "abs_con_dp_dX_XT"));
+
+	} else {
+		return STATISTICS_RETURN(abs_con_dp_dX_XT,
+			retWorkingPair->absorption->con_dp_dX_XT(X_kgkg, T_K,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * abs_con_dp_dT_XT:
+ * -----------------
+ *
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium concentration X in kg/kg and
+ * equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_dp_dT_XT(double X_kgkg, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_con_dp_dT_XT, workingPair, X_kgkg, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_con_dp_dT_XT,
+			warning_struct("workingPair", "abs_dp_dT_XT"));
+	}
+
+	// Check if isotherm function exists for chosen isotherm type
+	//
+	if (retWorkingPair->absorption== NULL) {
+		return STATISTICS_RETURN(abs_con_dp_dT_XT,
+			warning_struct("absorption", "abs_con_dp_dT_XT"));
+		
+	} else if (retWorkingPair->absorption->con_dp_dT_XT==NULL) {
+		return STATISTICS_RETURN(abs_con_dp_dT_XT,
+			warning_function("con_dp_dT_XT", "abs_con_dp_dT_XT"));
+
+	} else {
+		return STATISTICS_RETURN(abs_con_dp_dT_XT,
+			retWorkingPair->absorption->con_dp_dT_XT(X_kgkg, T_K,
+				retWorkingPair->iso_par));
+
+	}
+}
+
+
+/*
+ * abs_con_X_pT_der:
+ * -----------------
+ *
+ * Calculates total derivative of equilibrium concentration X in kg/kg/s
+ * depending on equilibrium pressure p in Pa, equilibrium temperature T in K,
+ * and their derivatives by the analytical partial derivatives of the isotherm.
+ * Thus, the derivative can be used for derivative annotations of Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium concentration in kg/kg/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_X_pT_der(double p_Pa, double T_K, double p_der_Pas,
+	double T_der_Ks, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_con_X_pT_der, workingPair, p_Pa, T_K, p_der_Pas, T_der_Ks);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_con_X_pT_der,
+			warning_struct("workingPair", "abs_con_X_pT_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->absorption == NULL) {
+		return STATISTICS_RETURN(abs_con_X_pT_der,
+			warning_struct("absorption", "abs_con_X_pT_der"));
+
+	} else if (retWorkingPair->absorption->con_dX_dp_pT == NULL) {
+		return STATISTICS_RETURN(abs_con_X_pT_der,
+			warning_function("con_dX_dp_pT", "abs_con_X_pT_der"));
+
+	} else if (retWorkingPair->absorption->con_dX_dT_pT == NULL) {
+		return STATISTICS_RETURN(abs_con_X_pT_der,
+			warning_function("con_dX_dT_pT", "abs_con_X_pT_der"));
+	}
+
+	// Calculate total derivative
+	//
+	return STATISTICS_RETURN(abs_con_X_pT_der,
+		workingPair_total_derivative(0, p_Pa, T_K, p_der_Pas, T_der_Ks,
+			retWorkingPair));
+}
+
+
+/*
+ * abs_con_p_XT_der:
+ * -----------------
+ *
+ * Calculates total derivative of equilibrium pressure p in Pa/s depending on
+ * equilibrium concentration X in kg/kg, equilibrium temperature T in K, and
+ * their derivatives by the analytical partial derivatives of the isotherm.
+ * Thus, the derivative can be used for derivative annotations of Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double X_der_kgkgs:
+ *		Derivative of equilibrium concentration in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_p_XT_der(double X_kgkg, double T_K, double X_der_kgkgs,
+	double T_der_Ks, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_con_p_XT_der, workingPair, X_kgkg, T_K, X_der_kgkgs,
+		T_der_Ks);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_con_p_XT_der,
+			warning_struct("workingPair", "abs_con_p_XT_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->absorption == NULL) {
+		return STATISTICS_RETURN(abs_con_p_XT_der,
+			warning_struct("absorption", "abs_con_p_XT_der"));
+
+	} else if (retWorkingPair->absorption->con_dp_dX_XT == NULL) {
+		return STATISTICS_RETURN(abs_con_p_XT_der,
+			warning_function("con_dp_dX_XT", "abs_con_p_XT_der"));
+
+	} else if (retWorkingPair->absorption->con_dp_dT_XT == NULL) {
+		return STATISTICS_RETURN(abs_con_p_XT_der,
+			warning_function("con_dp_dT_XT", "abs_con_p_XT_der"));
+	}
+
+	// Calculate total derivative
+	//
+	return STATISTICS_RETURN(abs_con_p_XT_der,
+		workingPair_total_derivative(1, X_kgkg, T_K, X_der_kgkgs, T_der_Ks,
+			retWorkingPair));
+}
+
+
+/*
+ * abs_con_T_pX_der:
+ * -----------------
+ *
+ * Calculates total derivative of equilibrium temperature T in K/s depending on
+ * equilibrium pressure p in Pa, equilibrium concentration X in kg/kg, and their
+ * derivatives by the analytical partial derivatives of the isotherm and the
+ * implicit function theorem. Thus, the derivative can be used for derivative
+ * annotations of Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double X_der_kgkgs:
+ *		Derivative of equilibrium concentration in kg/kg/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_T_pX_der(double p_Pa, double X_kgkg, double p_der_Pas,
+	double X_der_kgkgs, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_con_T_pX_der, workingPair, p_Pa, X_kgkg, p_der_Pas,
+		X_der_kgkgs);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_con_T_pX_der,
+			warning_struct("workingPair", "abs_con_T_pX_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->absorption == NULL) {
+		return STATISTICS_RETURN(abs_con_T_pX_der,
+			warning_struct("absorption", "abs_con_T_pX_der"));
+
+	} else if (retWorkingPair->absorption->con_T_pX == NULL) {
+		return STATISTICS_RETURN(abs_con_T_pX_der,
+			warning_function("con_T_pX", "abs_con_T_pX_der"));
+
+	} else if (retWorkingPair->absorption->con_dX_dp_pT == NULL) {
+		return STATISTICS_RETURN(abs_con_T_pX_der,
+			warning_function("con_dX_dp_pT", "abs_con_T_pX_der"));
+
+	} else if (retWorkingPair->absorption->con_dX_dT_pT == NULL) {
+		return STATISTICS_RETURN(abs_con_T_pX_der,
+			warning_function("con_dX_dT_pT", "abs_con_T_pX_der"));
+	}
+
+	// Calculate total derivative
+	//
+	return STATISTICS_RETURN(abs_con_T_pX_der,
+		workingPair_total_derivative(2, p_Pa, X_kgkg, p_der_Pas, X_der_kgkgs,
+			retWorkingPair));
+}
+
+
+/*
+ * abs_con_dX_dp_pT_der:
+ * ---------------------
+ *
+ * Calculates total derivative of derivative of equilibrium concentration X with
+ * respect to pressure p in kg/kg/Pa/s depending on equilibrium pressure p in
+ * Pa, equilibrium temperature T in K, and their derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium concentration wrt. pressure in
+ *		kg/kg/Pa/s.
+ *
+ * Remarks:
+ * --------
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_dX_dp_pT_der(double p_Pa, double T_K, double p_der_Pas,
+	double T_der_Ks, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_con_dX_dp_pT_der, workingPair, p_Pa, T_K, p_der_Pas,
+		T_der_Ks);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_con_dX_dp_pT_der,
+			warning_struct("workingPair", "abs_con_dX_dp_pT_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->absorption == NULL) {
+		return STATISTICS_RETURN(abs_con_dX_dp_pT_der,
+			warning_struct("absorption", "abs_con_dX_dp_pT_der"));
+
+	} else if (retWorkingPair->absorption->con_dX_dp_pT == NULL) {
+		return STATISTICS_RETURN(abs_con_dX_dp_pT_der,
+			warning_function("con_dX_dp_pT", "abs_con_dX_dp_pT_der"));
+	}
+
+	// Calculate total derivative numerically
+	//
+	return STATISTICS_RETURN(abs_con_dX_dp_pT_der,
+		workingPair_second_derivative(0, p_Pa, T_K, p_der_Pas, T_der_Ks,
+			retWorkingPair));
+}
+
+
+/*
+ * abs_con_dX_dT_pT_der:
+ * ---------------------
+ *
+ * Calculates total derivative of derivative of equilibrium concentration X with
+ * respect to temperature T in kg/kg/K/s depending on equilibrium pressure p in
+ * Pa, equilibrium temperature T in K, and their derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium concentration wrt. temperature
+ *		in kg/kg/K/s.
+ *
+ * Remarks:
+ * --------
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_dX_dT_pT_der(double p_Pa, double T_K, double p_der_Pas,
+	double T_der_Ks, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_con_dX_dT_pT_der, workingPair, p_Pa, T_K, p_der_Pas,
+		T_der_Ks);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_con_dX_dT_pT_der,
+			warning_struct("workingPair", "abs_con_dX_dT_pT_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->absorption == NULL) {
+		return STATISTICS_RETURN(abs_con_dX_dT_pT_der,
+			warning_struct("absorption", "abs_con_dX_dT_pT_der"));
+
+	} else if (retWorkingPair->absorption->con_dX_dT_pT == NULL) {
+		return STATISTICS_RETURN(abs_con_dX_dT_pT_der,
+			warning_function("con_dX_dT_pT", "abs_con_dX_dT_pT_der"));
+	}
+
+	// Calculate total derivative numerically
+	//
+	return STATISTICS_RETURN(abs_con_dX_dT_pT_der,
+		workingPair_second_derivative(1, p_Pa, T_K, p_der_Pas, T_der_Ks,
+			retWorkingPair));
+}
+
+
+/*
+ * abs_con_dp_dX_XT_der:
+ * ---------------------
+ *
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to concentration X in Pa/(kg/kg)/s depending on equilibrium
+ * concentration X in kg/kg, equilibrium temperature T in K, and their
+ * derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double X_der_kgkgs:
+ *		Derivative of equilibrium concentration in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium pressure wrt. concentration in
+ *		Pa/(kg/kg)/s.
+ *
+ * Remarks:
+ * --------
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_dp_dX_XT_der(double X_kgkg, double T_K,
+	double X_der_kgkgs, double T_der_Ks, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_con_dp_dX_XT_der, workingPair, X_kgkg, T_K, X_der_kgkgs,
+		T_der_Ks);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_con_dp_dX_XT_der,
+			warning_struct("workingPair", "abs_con_dp_dX_XT_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->absorption == NULL) {
+		return STATISTICS_RETURN(abs_con_dp_dX_XT_der,
+			warning_struct("absorption", "abs_con_dp_dX_XT_der"));
+
+	} else if (retWorkingPair->absorption->con_dp_dX_XT == NULL) {
+		return STATISTICS_RETURN(abs_con_dp_dX_XT_der,
+			warning_function("con_dp_dX_XT", "abs_con_dp_dX_XT_der"));
+	}
+
+	// Calculate total derivative numerically
+	//
+	return STATISTICS_RETURN(abs_con_dp_dX_XT_der,
+		workingPair_second_derivative(2, X_kgkg, T_K, X_der_kgkgs, T_der_Ks,
+			retWorkingPair));
+}
+
+
+/*
+ * abs_con_dp_dT_XT_der:
+ * ---------------------
+ *
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to temperature T in Pa/K/s depending on equilibrium concentration X
+ * in kg/kg, equilibrium temperature T in K, and their derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double X_der_kgkgs:
+ *		Derivative of equilibrium concentration in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium pressure wrt. temperature in
+ *		Pa/K/s.
+ *
+ * Remarks:
+ * --------
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_con_dp_dT_XT_der(double X_kgkg, double T_K,
+	double X_der_kgkgs, double T_der_Ks, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_con_dp_dT_XT_der, workingPair, X_kgkg, T_K, X_der_kgkgs,
+		T_der_Ks);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_con_dp_dT_XT_der,
+			warning_struct("workingPair", "abs_con_dp_dT_XT_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->absorption == NULL) {
+		return STATISTICS_RETURN(abs_con_dp_dT_XT_der,
+			warning_struct("absorption", "abs_con_dp_dT_XT_der"));
+
+	} else if (retWorkingPair->absorption->con_dp_dT_XT == NULL) {
+		return STATISTICS_RETURN(abs_con_dp_dT_XT_der,
+			warning_function("con_dp_dT_XT", "abs_con_dp_dT_XT_der"));
+	}
+
+	// Calculate total derivative numerically
+	//
+	return STATISTICS_RETURN(abs_con_dp_dT_XT_der,
+		workingPair_second_derivative(3, X_kgkg, T_K, X_der_kgkgs, T_der_Ks,
+			retWorkingPair));
+}
+
+
+/*
+ * abs_act_g_Txv1v2:
+ * -----------------
+ *
+ * Calculates activity coefficient of first component depending on temperature
+ * T_K in K, mole fraction in liquid phase x_molmol in mol/mol, molar volume of
+ * first component in m³/mol, and molar volume of second component in m³/mol.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Activity coefficient of first component.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_act_g_Txv1v2(double T_K, double x_molmol, double v1_m3mol,
+	double v2_m3mol, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_act_g_Txv1v2, workingPair, T_K, x_molmol, v1_m3mol,
+		v2_m3mol);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_act_g_Txv1v2,
+			warning_struct("workingPair", "abs_act_g_Txv1v2"));
+	}
+
+	// Check if absorption function exists for chosen working pair
+	//
+	if (retWorkingPair->absorption== NULL) {
+		return STATISTICS_RETURN(abs_act_g_Txv1v2,
+			warning_struct("absorption", "abs_act_g_Txv1v2"));
+		
+	} else if (retWorkingPair->absorption->act_g_Txv1v2==NULL) {
+		return STATISTICS_RETURN(abs_act_g_Txv1v2,
+			warning_function("act_g_Txv1v2", "abs_act_g_Txv1v2"));
+
+	} else {
+		return STATISTICS_RETURN(abs_act_g_Txv1v2,
+			retWorkingPair->absorption->act_g_Txv1v2(T_K, x_molmol, v1_m3mol,
+				v2_m3mol, retWorkingPair->iso_par, retWorkingPair->absorption));
+
+	}
+}
+
+
+/*
+ * abs_act_p_Txv1v2psat:
+ * ---------------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa of first component depending on
+ * temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
+ * molar volume of first component in m³/mol, molar volume of second component
+ * in m³/mol,and saturation pressure of first component p_sat_Pa in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_act_p_Txv1v2psat(double T_K, double x_molmol,
+	double v1_m3mol, double v2_m3mol, double p_sat_Pa, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_act_p_Txv1v2psat, workingPair, T_K, x_molmol, v1_m3mol,
+		v2_m3mol, p_sat_Pa);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_act_p_Txv1v2psat,
+			warning_struct("workingPair", "abs_act_p_Txv1v2psat"));
+	}
+
+	// Check if absorption function exists for chosen working pair
+	//
+	if (retWorkingPair->absorption== NULL) {
+		return STATISTICS_RETURN(abs_act_p_Txv1v2psat,
+			warning_struct("absorption", "abs_act_p_Txv1v2psat"));
+		
+	} else if (retWorkingPair->absorption->act_p_Txgv1v2psat==NULL) {
+		return STATISTICS_RETURN(abs_act_p_Txv1v2psat,
+			warning_function("act_p_Txgv1v2psat", "abs_act_p_Txv1v2psat"));
+
+	} else {
+		return STATISTICS_RETURN(abs_act_p_Txv1v2psat,
+			retWorkingPair->absorption->act_p_Txgv1v2psat(T_K, x_molmol,
+				v1_m3mol, v2_m3mol, p_sat_Pa, retWorkingPair->iso_par,
+				retWorkingPair->absorption));
+
+	}
+}
+
+
+/*
+ * abs_act_x_pTv1v2psat:
+ * ---------------------
+ *
+ * Calculates mole fraction of first component in liquid phase x_molmol in
+ * mol/mol depending on equilibrium pressure p_Pa in Pa of first component,
+ * temperature T_K in K, molar volume of first component in m³/mol, molar volume
+ * of second component in m³/mol and saturation pressure of first component
+ * p_sat_Pa in Pa
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure p_Pa in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
+ *
+ * History:
+ * --------
+ *	30/03/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_act_x_pTv1v2psat(double p_Pa, double T_K, double v1_m3mol,
+	double v2_m3mol, double p_sat_Pa, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_act_x_pTv1v2psat, workingPair, p_Pa, T_K, v1_m3mol,
+		v2_m3mol, p_sat_Pa);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_act_x_pTv1v2psat,
+			warning_struct("workingPair", "abs_act_x_pTv1v2psat"));
+	}
+
+	// Check if absorption function exists for chosen working pair
+	//
+	if (retWorkingPair->absorption== NULL) {
+		return STATISTICS_RETURN(abs_act_x_pTv1v2psat,
+			warning_struct("absorption", "abs_act_x_pTv1v2psat"));
+		
+	} else if (retWorkingPair->absorption->act_x_pTgv1v2psat==NULL) {
+		return STATISTICS_RETURN(abs_act_x_pTv1v2psat,
+			warning_function("act_x_pTgv1v2psat", "abs_act_x_pTv1v2psat"));
+
+	} else {
+		return STATISTICS_RETURN(abs_act_x_pTv1v2psat,
+			retWorkingPair->absorption->act_x_pTgv1v2psat(p_Pa, T_K,
+				v1_m3mol, v2_m3mol, p_sat_Pa, retWorkingPair->iso_par,
+				retWorkingPair->absorption));
+
+	}
+}
+
+
+/*
+ * abs_act_p_Txv1v2:
+ * -----------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa of first component depending on
+ * temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
+ * molar volume of first component in m³/mol, and molar volume of second
+ * component in m³/mol.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
+ *	This function uses internal model for vapor pressure of refrigerant.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_act_p_Txv1v2(double T_K, double x_molmol,
+	double v1_m3mol, double v2_m3mol, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_act_p_Txv1v2, workingPair, T_K, x_molmol, v1_m3mol,
+		v2_m3mol);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_act_p_Txv1v2,
+			warning_struct("workingPair", "abs_act_p_Txv1v2"));
+	}
+
+	// Check if absorption function exists for chosen working pair
+	//
+	if (retWorkingPair->absorption== NULL) {
+		return STATISTICS_RETURN(abs_act_p_Txv1v2,
+			warning_struct("absorption", "abs_act_p_Txv1v2"));
+		
+	} else if (retWorkingPair->absorption->act_p_Txgv1v2psat==NULL) {
+		return STATISTICS_RETURN(abs_act_p_Txv1v2,
+			warning_function("act_p_Txgv1v2psat", "abs_act_p_Txv1v2"));
+
+	} else if (retWorkingPair->refrigerant->p_sat_T==NULL) {
+		return STATISTICS_RETURN(abs_act_p_Txv1v2,
+			warning_function("p_sat_T", "abs_act_p_Txv1v2"));
+
+	} else if (retWorkingPair->psat_par==NULL) {
+		return STATISTICS_RETURN(abs_act_p_Txv1v2,
+			warning_parameter("the saturated vapor pressure",
+				"abs_act_p_Txv1v2"));
+
+	} else {
+		double p_sat_Pa = retWorkingPair->refrigerant->p_sat_T(T_K,
+			retWorkingPair->psat_par, retWorkingPair->refrigerant);
+
+		return STATISTICS_RETURN(abs_act_p_Txv1v2,
+			retWorkingPair->absorption->act_p_Txgv1v2psat(T_K, x_molmol,
+				v1_m3mol, v2_m3mol, p_sat_Pa, retWorkingPair->iso_par,
+				retWorkingPair->absorption));
+
+	}
+}
+
+
+/*
+ * abs_act_x_pTv1v2:
+ * -----------------
+ *
+ * Calculates mole fraction of first component in liquid phase x_molmol in
+ * mol/mol depending on equilibrium pressure p_Pa in Pa of first component,
+ * temperature T_K in K, molar volume of first component in m³/mol, and molar
+ * volume of second component in m³/mol.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure p_Pa in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
+ *	This function uses internal model for vapor pressure of refrigerant.
+ *
+ * History:
+ * --------
+ *	30/03/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_act_x_pTv1v2(double p_Pa, double T_K, double v1_m3mol,
+	double v2_m3mol, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_act_x_pTv1v2, workingPair, p_Pa, T_K, v1_m3mol, v2_m3mol);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_act_x_pTv1v2,
+			warning_struct("workingPair", "abs_act_x_pTv1v2"));
+	}
+
+	// Check if absorption function exists for chosen working pair
+	//
+	if (retWorkingPair->absorption== NULL) {
+		return STATISTICS_RETURN(abs_act_x_pTv1v2,
+			warning_struct("absorption", "abs_act_x_pTv1v2"));
+		
+	} else if (retWorkingPair->absorption->act_x_pTgv1v2psat==NULL) {
+		return STATISTICS_RETURN(abs_act_x_pTv1v2,
+			warning_function("act_x_pTgv1v2psat", "abs_act_x_pTv1v2"));
+
+	} else if (retWorkingPair->refrigerant->p_sat_T==NULL) {
+		return STATISTICS_RETURN(abs_act_x_pTv1v2,
+			warning_function("p_sat_T", "abs_act_x_pTv1v2"));
+
+	} else if (retWorkingPair->psat_par==NULL) {
+		return STATISTICS_RETURN(abs_act_x_pTv1v2,
+			warning_parameter("the saturated vapor pressure",
+				"abs_act_x_pTv1v2"));
+
+
+	} else {
+		double p_sat_Pa = retWorkingPair->refrigerant->p_sat_T(T_K,
+			retWorkingPair->psat_par, retWorkingPair->refrigerant);
+
+		return STATISTICS_RETURN(abs_act_x_pTv1v2,
+			retWorkingPair->absorption->act_x_pTgv1v2psat(p_Pa, T_K,
+				v1_m3mol, v2_m3mol, p_sat_Pa, retWorkingPair->iso_par,
+				retWorkingPair->absorption));
+
+	}
+}
+
+
+/*
+ * abs_mix_x_pT:
+ * -------------
+ *
+ * Calculates equilibrium liquid mole fraction of first component in mol/mol
+ * depending on pressure in Pa and temperature T_K in K.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure p_Pa in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium mole fraction in of first component liquid phase in mol/mol.
+ *	double *ret_y_1_molmol:
+ *		Equilibrium mole fraction of first component.
+ *	double *ret_y_2_molmol:
+ *		Equilibrium mole fraction of second component.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on mixing rules.
+ *
+ * History:
+ * --------
+ *	04/09/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_mix_x_pT(double *ret_y_1_molmol, double *ret_y_2_molmol,
+	double p_Pa, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_mix_x_pT, workingPair, p_Pa, T_K);
+	double x_1_molmol;
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_mix_x_pT,
+			warning_struct("workingPair", "abs_mix_x_pT"));
+	}
+
+	// Check if absorption function exists for chosen working pair
+	//
+	if (retWorkingPair->absorption== NULL) {
+		return STATISTICS_RETURN(abs_mix_x_pT,
+			warning_struct("absorption", "abs_mix_x_pT"));
+		
+	} else if (retWorkingPair->absorption->mix_x_pT==NULL) {
+		return STATISTICS_RETURN(abs_mix_x_pT,
+			warning_function("mix_x_pT", "abs_mix_x_pT"));
+
+	} else if (retWorkingPair->surrogates != NULL &&
+		surrogate2D_approximate(&x_1_molmol, log(p_Pa), T_K,
+		retWorkingPair->surrogates->w_pT) == 0 &&
+		surrogate2D_approximate(ret_y_1_molmol, log(p_Pa), T_K,
+		retWorkingPair->surrogates->y_1_pT) == 0 &&
+		surrogate2D_approximate(ret_y_2_molmol, log(p_Pa), T_K,
+		retWorkingPair->surrogates->y_2_pT) == 0) {
+		return STATISTICS_RETURN(abs_mix_x_pT, x_1_molmol);
+
+	} else {
+		return STATISTICS_RETURN(abs_mix_x_pT,
+			retWorkingPair->absorption->mix_x_pT(ret_y_1_molmol,
+				ret_y_2_molmol, p_Pa, T_K, retWorkingPair->iso_par,
+				retWorkingPair->absorption));
+
+	}
+}
+
+
+/*
+ * abs_mix_p_Tx:
+ * -------------
+ *
+ * Calculates equilibrium pressure p_Pa in Pa depending on temperature T_K in K
+ * and mole fraction in liquid phase x_molmol in mol/mol.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
+ *	double *ret_y_1_molmol:
+ *		Equilibrium mole fraction of first component.
+ *	double *ret_y_2_molmol:
+ *		Equilibrium mole fraction of second component.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on mixing rules.
+ *
+ * History:
+ * --------
+ *	04/09/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_mix_p_Tx(double *ret_y_1_molmol, double *ret_y_2_molmol,
+	double T_K, double x_1_molmol, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_mix_p_Tx, workingPair, T_K, x_1_molmol);
+	double p_Pa;
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_mix_p_Tx,
+			warning_struct("workingPair", "abs_mix_p_Tx"));
+	}
+
+	// Check if absorption function exists for chosen working pair
+	//
+	if (retWorkingPair->absorption== NULL) {
+		return STATISTICS_RETURN(abs_mix_p_Tx,
+			warning_struct("absorption", "abs_mix_p_Tx"));
+		
+	} else if (retWorkingPair->absorption->mix_p_Tx==NULL) {
+		return STATISTICS_RETURN(abs_mix_p_Tx,
+			warning_function("mix_p_Tx", "abs_mix_p_Tx"));
+
+	} else if (retWorkingPair->surrogates != NULL &&
+		surrogate2D_approximate(&p_Pa, x_1_molmol, T_K,
+		retWorkingPair->surrogates->p_wT) == 0 &&
+		surrogate2D_approximate(ret_y_1_molmol, x_1_molmol, T_K,
+		retWorkingPair->surrogates->y_1_wT) == 0 &&
+		surrogate2D_approximate(ret_y_2_molmol, x_1_molmol, T_K,
+		retWorkingPair->surrogates->y_2_wT) == 0) {
+		return STATISTICS_RETURN(abs_mix_p_Tx, p_Pa);
+
+	} else {
+		return STATISTICS_RETURN(abs_mix_p_Tx,
+			retWorkingPair->absorption->mix_p_Tx(ret_y_1_molmol,
+				ret_y_2_molmol, T_K, x_1_molmol, retWorkingPair->iso_par,
+				retWorkingPair->absorption));
+
+	}
+}
+
+
+/*
+ * abs_mix_T_px:
+ * -------------
+ *
+ * Calculates equilibrium temperature T_K in K depending on pressure p_Pa in Pa
+ * and mole fraction in liquid phase x_molmol in mol/mol.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure p_Pa in Pa.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double *ret_y_1_molmol:
+ *		Equilibrium mole fraction of first component.
+ *	double *ret_y_2_molmol:
+ *		Equilibrium mole fraction of second component.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Uses Newton-Raphson method for calculating equilibrium temperature.
+ *
+ * History:
+ * --------
+ *	04/09/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_mix_T_px(double *ret_y_1_molmol, double *ret_y_2_molmol,
+	double p_Pa, double x_1_molmol, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_mix_T_px, workingPair, p_Pa, x_1_molmol);
+	double T_K;
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_mix_T_px,
+			warning_struct("workingPair", "abs_mix_T_px"));
+	}
+
+	// Check if absorption function exists for chosen working pair
+	//
+	if (retWorkingPair->absorption== NULL) {
+		return STATISTICS_RETURN(abs_mix_T_px,
+			warning_struct("absorption", "abs_mix_T_px"));
+		
+	} else if (retWorkingPair->absorption->mix_T_px==NULL) {
+		return STATISTICS_RETURN(abs_mix_T_px,
+			warning_function("mix_T_px", "abs_mix_T_px"));
+
+	} else if (retWorkingPair->surrogates != NULL &&
+		surrogate2D_approximate(&T_K, log(p_Pa), x_1_molmol,
+		retWorkingPair->surrogates->T_pw) == 0 &&
+		surrogate2D_approximate(ret_y_1_molmol, log(p_Pa), x_1_molmol,
+		retWorkingPair->surrogates->y_1_pw) == 0 &&
+		surrogate2D_approximate(ret_y_2_molmol, log(p_Pa), x_1_molmol,
+		retWorkingPair->surrogates->y_2_pw) == 0) {
+		return STATISTICS_RETURN(abs_mix_T_px, T_K);
+
+	} else {
+		return STATISTICS_RETURN(abs_mix_T_px,
+			retWorkingPair->absorption->mix_T_px(ret_y_1_molmol,
+				ret_y_2_molmol, p_Pa, x_1_molmol, retWorkingPair->iso_par,
+				retWorkingPair->absorption));
+
+	}
+}
+
+
+/*
+ * abs_mix_dp_dx_Tx:
+ * -----------------
+ *
+ * Calculates derivative of equilibrium pressure with respect to liquid mole
+ * fraction in Pa depending on temperature T_K in K and mole fraction in liquid
+ * phase x_molmol in mol/mol.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt liquid mole fraction in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Derivative is calculated numerically by the symmetric derivative using
+ *  h = 0.00000001 mol/mol as small change.
+ *
+ * History:
+ * --------
+ *	04/09/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_mix_dp_dx_Tx(double T_K, double x_1_molmol,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_mix_dp_dx_Tx, workingPair, T_K, x_1_molmol);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_mix_dp_dx_Tx,
+			warning_struct("workingPair", "abs_mix_dp_dx_Tx"));
+	}
+
+	// Check if absorption function exists for chosen working pair
+	//
+	if (retWorkingPair->absorption== NULL) {
+		return STATISTICS_RETURN(abs_mix_dp_dx_Tx,
+			warning_struct("absorption", "abs_mix_dp_dx_Tx"));
+		
+	} else if (retWorkingPair->absorption->mix_dp_dx_Tx==NULL) {
+		return STATISTICS_RETURN(abs_mix_dp_dx_Tx,
+			warning_function("mix_dp_dx_Tx", "abs_mix_dp_dx_Tx"));
+
+	} else {
+		return STATISTICS_RETURN(abs_mix_dp_dx_Tx,
+			retWorkingPair->absorption->mix_dp_dx_Tx(T_K, x_1_molmol,
+				retWorkingPair->iso_par, retWorkingPair->absorption));
+
+	}
+}
+
+
+/*
+ * abs_mix_dp_dT_Tx:
+ * -----------------
+ *
+ * Calculates derivative of equilibrium pressure with respect to temperature in
+ * Pa/K depending on temperature T_K in K and mole fraction in liquid phase
+ * x_molmol in mol/mol.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure wrt temperature in Pa/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Derivative is calculated numerically by the symmetric derivative using
+ *  h = 0.0001 K as small change.
+ *
+ * History:
+ * --------
+ *	04/09/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_mix_dp_dT_Tx(double T_K, double x_1_molmol,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_mix_dp_dT_Tx, workingPair, T_K, x_1_molmol);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_mix_dp_dT_Tx,
+			warning_struct("workingPair", "abs_mix_dp_dT_Tx"));
+	}
+
+	// Check if absorption function exists for chosen working pair
+	//
+	if (retWorkingPair->absorption== NULL) {
+		return STATISTICS_RETURN(abs_mix_dp_dT_Tx,
+			warning_struct("absorption", "abs_mix_dp_dT_Tx"));
+		
+	} else if (retWorkingPair->absorption->mix_dp_dT_Tx==NULL) {
+		return STATISTICS_RETURN(abs_mix_dp_dT_Tx,
+			warning_function("mix_dp_dT_Tx", "abs_mix_dp_dT_Tx"));
+
+	} else {
+		return STATISTICS_RETURN(abs_mix_dp_dT_Tx,
+			retWorkingPair->absorption->mix_dp_dT_Tx(T_K, x_1_molmol,
+				retWorkingPair->iso_par, retWorkingPair->absorption));
+
+	}
+}
+
+
+/*
+ * abs_mix_dp_dx_Tx_der:
+ * ---------------------
+ *
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to liquid mole fraction x in Pa/(mol/mol)/s depending on equilibrium
+ * temperature T in K, equilibrium mole fraction in liquid phase x in mol/mol,
+ * and their derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *	double x_der_molmols:
+ *		Derivative of equilibrium mole fraction in liquid phase in mol/mol/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium pressure wrt. liquid mole
+ *		fraction in Pa/(mol/mol)/s.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-3
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP_MIX) of inputs whose derivatives are
+ *	not zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_mix_dp_dx_Tx_der(double T_K, double x_1_molmol,
+	double T_der_Ks, double x_der_molmols, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_mix_dp_dx_Tx_der, workingPair, T_K, x_1_molmol, T_der_Ks,
+		x_der_molmols);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_mix_dp_dx_Tx_der,
+			warning_struct("workingPair", "abs_mix_dp_dx_Tx_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->absorption == NULL) {
+		return STATISTICS_RETURN(abs_mix_dp_dx_Tx_der,
+			warning_struct("absorption", "abs_mix_dp_dx_Tx_der"));
+
+	} else if (retWorkingPair->absorption->mix_dp_dx_Tx == NULL) {
+		return STATISTICS_RETURN(abs_mix_dp_dx_Tx_der,
+			warning_function("mix_dp_dx_Tx", "abs_mix_dp_dx_Tx_der"));
+	}
+
+	// Calculate total derivative numerically
+	//
+	return STATISTICS_RETURN(abs_mix_dp_dx_Tx_der,
+		workingPair_second_derivative(2, x_1_molmol, T_K, x_der_molmols,
+			T_der_Ks, retWorkingPair));
+}
+
+
+/*
+ * abs_mix_dp_dT_Tx_der:
+ * ---------------------
+ *
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to temperature T in Pa/K/s depending on equilibrium temperature T in
+ * K, equilibrium mole fraction in liquid phase x in mol/mol, and their
+ * derivatives.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *	double x_der_molmols:
+ *		Derivative of equilibrium mole fraction in liquid phase in mol/mol/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of equilibrium pressure wrt. temperature in
+ *		Pa/K/s.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-3
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP_MIX) of inputs whose derivatives are
+ *	not zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double abs_mix_dp_dT_Tx_der(double T_K, double x_1_molmol,
+	double T_der_Ks, double x_der_molmols, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(abs_mix_dp_dT_Tx_der, workingPair, T_K, x_1_molmol, T_der_Ks,
+		x_der_molmols);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(abs_mix_dp_dT_Tx_der,
+			warning_struct("workingPair", "abs_mix_dp_dT_Tx_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->absorption == NULL) {
+		return STATISTICS_RETURN(abs_mix_dp_dT_Tx_der,
+			warning_struct("absorption", "abs_mix_dp_dT_Tx_der"));
+
+	} else if (retWorkingPair->absorption->mix_dp_dT_Tx == NULL) {
+		return STATISTICS_RETURN(abs_mix_dp_dT_Tx_der,
+			warning_function("mix_dp_dT_Tx", "abs_mix_dp_dT_Tx_der"));
+	}
+
+	// Calculate total derivative numerically
+	//
+	return STATISTICS_RETURN(abs_mix_dp_dT_Tx_der,
+		workingPair_second_derivative(3, x_1_molmol, T_K, x_der_molmols,
+			T_der_Ks, retWorkingPair));
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+// Definition of function prototypes regarding refrigerant working w struct//
+/////////////////////////////////////////////////////////////////////////////
+/*
+ * ref_p_sat_T:
+ * ------------
+ *
+ * Calculates saturation pressure in Pa depending on equilibrium temperature T
+ * in K.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Saturation pressure in Pa.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_p_sat_T(double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ref_p_sat_T, workingPair, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ref_p_sat_T,
+			warning_struct("workingPair", "ref_p_sat_T"));
+	}
+
+	// Check if refrigerant function exists for chosen working pair
+	//
+	if (retWorkingPair->refrigerant->p_sat_T==NULL) {
+		return STATISTICS_RETURN(ref_p_sat_T,
+			warning_function("p_sat_T", "ref_p_sat_T"));
+
+	} else if (retWorkingPair->psat_par==NULL) {
+		return STATISTICS_RETURN(ref_p_sat_T,
+			warning_parameter("the saturated vapor pressure", "ref_p_sat_T"));
+
+	} else {
+		return STATISTICS_RETURN(ref_p_sat_T,
+			retWorkingPair->refrigerant->p_sat_T(T_K,
+				retWorkingPair->psat_par, retWorkingPair->refrigerant));
+
+	}
+}
+
+
+/*
+ * ref_dp_sat_dT_T:
+ * ----------------
+ *
+ * Calculates derivative of saturation pressure in Pa/K wrt to temperature
+ * depending on equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of saturation pressure wrt temperature in Pa/K.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_dp_sat_dT_T(double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ref_dp_sat_dT_T, workingPair, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ref_dp_sat_dT_T,
+			warning_struct("workingPair", "ref_dp_sat_dT_T"));
+	}
+
+	// Check if refrigerant function exists for chosen working pair
+	//
+	if (retWorkingPair->refrigerant->dp_sat_dT==NULL) {
+		return STATISTICS_RETURN(ref_dp_sat_dT_T,
+			warning_function("dp_sat_T", "ref_dp_sat_dT_T"));
+
+	} else if (retWorkingPair->psat_par==NULL) {
+		return STATISTICS_RETURN(ref_dp_sat_dT_T,
+			warning_parameter("the derivative of the saturated vapor pressure "
+				"with respect to temperature", "ref_dp_sat_dT_T"));
+
+	} else {
+		return STATISTICS_RETURN(ref_dp_sat_dT_T,
+			retWorkingPair->refrigerant->dp_sat_dT(T_K,
+				retWorkingPair->psat_par, retWorkingPair->refrigerant));
+
+	}
+}
+
+
+/*
+ * ref_rho_l_T:
+ * ------------
+ *
+ * Calculates saturated liquid density in kg/m³ depending on equilibrium
+ * temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Saturated liquid density in kg/m³.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_rho_l_T(double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ref_rho_l_T, workingPair, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ref_rho_l_T,
+			warning_struct("workingPair", "ref_rho_l_T"));
+	}
+
+	// Check if refrigerant function exists for chosen working pair
+	//
+	if (retWorkingPair->refrigerant->rho_l_T==NULL) {
+		return STATISTICS_RETURN(ref_rho_l_T,
+			warning_function("psat_T", "ref_rho_l_T"));
+
+	} else if (retWorkingPair->rhol_par==NULL) {
+		return STATISTICS_RETURN(ref_rho_l_T,
+			warning_parameter("the saturated liquid density", "ref_rho_l_T"));
 
 	} else {
-		return retWorkingPair->adsorption->vol_dp_dw_wTpsatRho(w_kgkg, T_K,
-			p_sat_Pa, rho_kgm3, retWorkingPair->iso_par);
+		return STATISTICS_RETURN(ref_rho_l_T,
+			retWorkingPair->refrigerant->rho_l_T(T_K,
+				retWorkingPair->rhol_par));
 
 	}
 }
 
 
 /*
- * ads_vol_dp_dT_wTpsatRho:
- * ------------------------
+ * ref_drho_l_dT_T:
+ * ----------------
+ *
+ * Calculates derivative of saturated liquid density wrt temperature in kg/m³/K
+ * depending on equilibrium temperature T in K.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of saturated liquid density wrt temperature in kg/m³/K.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_drho_l_dT_T(double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ref_drho_l_dT_T, workingPair, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ref_drho_l_dT_T,
+			warning_struct("workingPair", "ref_drho_l_dT_T"));
+	}
+
+	// Check if refrigerant function exists for chosen working pair
+	//
+	if (retWorkingPair->refrigerant->drho_l_dT==NULL) {
+		return STATISTICS_RETURN(ref_drho_l_dT_T,
+			warning_function("psat_T", "ref_drho_l_dT_T"));
+
+	} else if (retWorkingPair->rhol_par==NULL) {
+		return STATISTICS_RETURN(ref_drho_l_dT_T,
+			warning_parameter("the derivative of the saturated liquid density "
+				"with respect to temperature", "ref_drho_l_dT_T"));
+
+	} else {
+		return STATISTICS_RETURN(ref_drho_l_dT_T,
+			retWorkingPair->refrigerant->drho_l_dT(T_K,
+				retWorkingPair->rhol_par));
+
+	}
+}
+
+
+/*
+ * ref_T_sat_p:
+ * ------------
+ *
+ * Calculates saturation temperature in K depending on equilibrium pressure p
+ * in Pa.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Saturation pressure in Pa.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium temperature in K.
+ *
+ * History:
+ * --------
+ *	02/14/2020, by Mirko Engelpracht:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_T_sat_p(double p_Pa, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ref_T_sat_p, workingPair, p_Pa);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ref_T_sat_p,
+			warning_struct("workingPair", "ref_T_sat_p"));
+	}
+
+	// Check if refrigerant function exists for chosen working pair
+	//
+	if (retWorkingPair->refrigerant->T_sat_p==NULL) {
+		return STATISTICS_RETURN(ref_T_sat_p,
+			warning_function("T_sat_p", "ref_T_sat_p"));
+
+	} else if (retWorkingPair->psat_par==NULL) {
+		return STATISTICS_RETURN(ref_T_sat_p,
+			warning_parameter("the saturated vapor pressure", "ref_T_sat_p"));
+
+	} else {
+		return STATISTICS_RETURN(ref_T_sat_p,
+			retWorkingPair->refrigerant->T_sat_p(p_Pa,
+				retWorkingPair->psat_par, retWorkingPair->refrigerant));
+
+	}
+}
+
+
+/*
+ * ref_p_sat_T_der:
+ * ----------------
+ *
+ * Calculates total derivative of saturation pressure in Pa/s depending on
+ * saturation temperature T in K and its derivative. Thus, the derivative can be
+ * used for derivative annotations of Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Saturation temperature in K.
+ *	double T_der_Ks:
+ *		Derivative of saturation temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of saturation pressure in Pa/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_p_sat_T_der(double T_K, double T_der_Ks, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ref_p_sat_T_der, workingPair, T_K, T_der_Ks);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ref_p_sat_T_der,
+			warning_struct("workingPair", "ref_p_sat_T_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->refrigerant->dp_sat_dT == NULL) {
+		return STATISTICS_RETURN(ref_p_sat_T_der,
+			warning_function("dp_sat_dT", "ref_p_sat_T_der"));
+
+	} else if (retWorkingPair->psat_par == NULL) {
+		return STATISTICS_RETURN(ref_p_sat_T_der,
+			warning_parameter("the saturated vapor pressure",
+				"ref_p_sat_T_der"));
+	}
+
+	// Calculate total derivative
+	//
+	return STATISTICS_RETURN(ref_p_sat_T_der,
+		retWorkingPair->refrigerant->dp_sat_dT(T_K,
+			retWorkingPair->psat_par, retWorkingPair->refrigerant) *
+		T_der_Ks);
+}
+
+
+/*
+ * ref_T_sat_p_der:
+ * ----------------
+ *
+ * Calculates total derivative of saturation temperature in K/s depending on
+ * saturation pressure p in Pa and its derivative. Thus, the derivative can be
+ * used for derivative annotations of Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double p_Pa:
+ *		Saturation pressure in Pa.
+ *	double p_der_Pas:
+ *		Derivative of saturation pressure in Pa/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of saturation temperature in K/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_T_sat_p_der(double p_Pa, double p_der_Pas,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ref_T_sat_p_der, workingPair, p_Pa, p_der_Pas);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ref_T_sat_p_der,
+			warning_struct("workingPair", "ref_T_sat_p_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->refrigerant->T_sat_p == NULL) {
+		return STATISTICS_RETURN(ref_T_sat_p_der,
+			warning_function("T_sat_p", "ref_T_sat_p_der"));
+
+	} else if (retWorkingPair->refrigerant->dp_sat_dT == NULL) {
+		return STATISTICS_RETURN(ref_T_sat_p_der,
+			warning_function("dp_sat_dT", "ref_T_sat_p_der"));
+
+	} else if (retWorkingPair->psat_par == NULL) {
+		return STATISTICS_RETURN(ref_T_sat_p_der,
+			warning_parameter("the saturated vapor pressure",
+				"ref_T_sat_p_der"));
+	}
+
+	// Calculate total derivative by derivative of inverse function
+	//
+	double T_K = retWorkingPair->refrigerant->T_sat_p(p_Pa,
+		retWorkingPair->psat_par, retWorkingPair->refrigerant);
+	double dp_dT_PaK = retWorkingPair->refrigerant->dp_sat_dT(T_K,
+		retWorkingPair->psat_par, retWorkingPair->refrigerant);
+
+	return STATISTICS_RETURN(ref_T_sat_p_der, p_der_Pas / dp_dT_PaK);
+}
+
+
+/*
+ * ref_rho_l_T_der:
+ * ----------------
+ *
+ * Calculates total derivative of saturated liquid density in kg/m³/s depending
+ * on saturation temperature T in K and its derivative. Thus, the derivative can
+ * be used for derivative annotations of Modelica.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Saturation temperature in K.
+ *	double T_der_Ks:
+ *		Derivative of saturation temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of saturated liquid density in kg/m³/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_rho_l_T_der(double T_K, double T_der_Ks, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ref_rho_l_T_der, workingPair, T_K, T_der_Ks);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ref_rho_l_T_der,
+			warning_struct("workingPair", "ref_rho_l_T_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->refrigerant->drho_l_dT == NULL) {
+		return STATISTICS_RETURN(ref_rho_l_T_der,
+			warning_function("drho_l_dT", "ref_rho_l_T_der"));
+
+	} else if (retWorkingPair->rhol_par == NULL) {
+		return STATISTICS_RETURN(ref_rho_l_T_der,
+			warning_parameter("the saturated liquid density",
+				"ref_rho_l_T_der"));
+	}
+
+	// Calculate total derivative
+	//
+	return STATISTICS_RETURN(ref_rho_l_T_der,
+		retWorkingPair->refrigerant->drho_l_dT(T_K,
+			retWorkingPair->rhol_par) * T_der_Ks);
+}
+
+
+/*
+ * ref_dp_sat_dT_T_der:
+ * --------------------
+ *
+ * Calculates total derivative of derivative of saturation pressure wrt.
+ * temperature in Pa/K/s depending on saturation temperature T in K and its
+ * derivative.
+ *
+ * Parameters:
+ * -----------
+ *	double T_K:
+ *		Saturation temperature in K.
+ *	double T_der_Ks:
+ *		Derivative of saturation temperature in K/s.
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of derivative of saturation pressure wrt. temperature in
+ *		Pa/K/s.
+ *
+ * Remarks:
+ * --------
+ *	Derivative of the analytical derivative is calculated numerically by the
+ *	symmetric derivative using a relative change of 1e-4 (i.e.,
+ *	WORKINGPAIR_DERIVATIVE_STEP) of temperature.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double ref_dp_sat_dT_T_der(double T_K, double T_der_Ks,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ref_dp_sat_dT_T_der, workingPair, T_K, T_der_Ks);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(ref_dp_sat_dT_T_der,
+			warning_struct("workingPair", "ref_dp_sat_dT_T_der"));
+	}
+
+	// Check if required functions exist for chosen working pair
+	//
+	if (retWorkingPair->refrigerant->dp_sat_dT == NULL) {
+		return STATISTICS_RETURN(ref_dp_sat_dT_T_der,
+			warning_function("dp_sat_dT", "ref_dp_sat_dT_T_der"));
+
+	} else if (retWorkingPair->psat_par == NULL) {
+		return STATISTICS_RETURN(ref_dp_sat_dT_T_der,
+			warning_parameter("the saturated vapor pressure",
+				"ref_dp_sat_dT_T_der"));
+	}
+
+	// Calculate total derivative numerically
+	//
+	double h_K = WORKINGPAIR_DERIVATIVE_STEP * T_K;
+	double dp_dT_upper_PaK = retWorkingPair->refrigerant->dp_sat_dT(T_K + h_K,
+		retWorkingPair->psat_par, retWorkingPair->refrigerant);
+	double dp_dT_lower_PaK = retWorkingPair->refrigerant->dp_sat_dT(T_K - h_K,
+		retWorkingPair->psat_par, retWorkingPair->refrigerant);
+
+	return STATISTICS_RETURN(ref_dp_sat_dT_T_der,
+		(dp_dT_upper_PaK - dp_dT_lower_PaK) / (2 * h_K) * T_der_Ks);
+}
+
+
+/*
+ * ref_drho_l_dT_T_der:
+ * --------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium loading w in kg/kg, equilibrium
- * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
- * rho in kg/m³, derivative of saturation pressure with respect to temperature
- * dp_sat_dT in Pa/K and derivative of density of adsorpt with respect to
- * temperature drho_dT in kg/m³/K.
+ * Calculates total derivative of derivative of saturated liquid density wrt.
+ * temperature in kg/m³/K/s depending on saturation temperature T in K and its
+ * derivative.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
  *	double T_K:
- *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
- * 	double dp_sat_dT_PaK:
- *		Derivative of saturation pressure wrt. temperature in Pa/K.
- *	double drho_dT_kgm3K:
- *		Derivative of density of adsorpt wrt. temperature in kg/m³/K.
+ *		Saturation temperature in K.
+ *	double T_der_Ks:
+ *		Derivative of saturation temperature in K/s.
  * 	struct *WorkingPair:
  *		Pointer of WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *		Derivative of derivative of saturated liquid density wrt. temperature
+ *		in kg/m³/K/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *	Derivative of the analytical derivative is calculated numerically by the
+ *	symmetric derivative using a relative change of 1e-4 (i.e.,
+ *	WORKINGPAIR_DERIVATIVE_STEP) of temperature.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	01/13/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_dp_dT_wTpsatRho(double w_kgkg, double T_K,
-	double p_sat_Pa, double rho_kgm3, double dp_sat_dT_PaK,
-	double drho_dT_kgm3K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double ref_drho_l_dT_T_der(double T_K, double T_der_Ks,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
 	//
 	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(ref_drho_l_dT_T_der, workingPair, T_K, T_der_Ks);
 
 	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_vol_dp_dT_wTpsatRho");
+		return STATISTICS_RETURN(ref_drho_l_dT_T_der,
+			warning_struct("workingPair", "ref_drho_l_dT_T_der"));
 	}
 
-	// Check if isotherm function exists for chosen isotherm type
+	// Check if required functions exist for chosen working pair
 	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_vol_dp_dT_wTpsatRho");
-		
-	} else if (retWorkingPair->adsorption->vol_dp_dT_wTpsatRho==NULL) {
-		return warning_function("vol_dp_dT_wTpsatRho",
-			"ads_vol_dp_dT_wTpsatRho");
-
-	} else {
-		return retWorkingPair->adsorption->vol_dp_dT_wTpsatRho(w_kgkg, T_K,
-			p_sat_Pa, rho_kgm3, dp_sat_dT_PaK, drho_dT_kgm3K,
-			retWorkingPair->iso_par);
+	if (retWorkingPair->refrigerant->drho_l_dT == NULL) {
+		return STATISTICS_RETURN(ref_drho_l_dT_T_der,
+			warning_function("drho_l_dT", "ref_drho_l_dT_T_der"));
 
+	} else if (retWorkingPair->rhol_par == NULL) {
+		return STATISTICS_RETURN(ref_drho_l_dT_T_der,
+			warning_parameter("the saturated liquid density",
+				"ref_drho_l_dT_T_der"));
 	}
+
+	// Calculate total derivative numerically
+	//
+	double h_K = WORKINGPAIR_DERIVATIVE_STEP * T_K;
+	double drho_dT_upper_kgm3K = retWorkingPair->refrigerant->drho_l_dT(
+		T_K + h_K, retWorkingPair->rhol_par);
+	double drho_dT_lower_kgm3K = retWorkingPair->refrigerant->drho_l_dT(
+		T_K - h_K, retWorkingPair->rhol_par);
+
+	return STATISTICS_RETURN(ref_drho_l_dT_T_der,
+		(drho_dT_upper_kgm3K - drho_dT_lower_kgm3K) / (2 * h_K) *
+			T_der_Ks);
 }
 
 
+/////////////////////////////////////////////////////////////////////////
+// Definition of function prototypes regarding tables working w struct //
+/////////////////////////////////////////////////////////////////////////
 /*
- * ads_vol_piStar_pyxgTpsatRhoM:
- * -----------------------------
- *
- * Calculates reduced spreading pressure in kg/mol depending on equilibrium
- * pressure p in Pa, molar fraction of refrigerant in vapor phase in mol/mol,
- * molar fraction of refrigerant in adsorbed phase in mol/mol, activity
- * coefficient of refrigerant in adsorbed phase, equilibrium temperature T in K,
- * saturation pressure p_Sat in Pa and density of adsorpt rho in kg/m³ and molar
- * mass of refrigerant M in kg/mol. The reduced spreading pressure is defined as
- * follows:
- *
- * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
- *		Integral_0^p0{w(p,T) / p * dp}
+ * tab_w_pT:
+ * ---------
  *
- *	where p0 = p_total*y / (gamma*x)
+ * Calculates equilibrium loading w in kg/kg, concentration X in kg/kg, or
+ * mole fraction in liquid phase x in mol/mol depending on equilibrium pressure
+ * p in Pa and equilibrium temperature T in K by the spline tables of the
+ * working pair. If tables are disabled or state is outside of tables, the
+ * original equation is evaluated.
  *
  * Parameters:
  * -----------
- *	double p_total_Pa:
- *		Total pressure of vapor phase in Pa.
- *	double y_molmol:
- *		Molar fraction of refrigerant in vapor phase in mol/mol.
- *	double x_molmol:
- *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
- *	double gamma:
- *		Activity coefficient of refrigerant in adsorbed phase.
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
- *	double M_kgmol:
- *		Molar mass of refrigerant M in kg/mol.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	struct *workingPair:
+ *		Pointer to WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Reduced spreading pressure in kg/mol.
+ *		Equilibrium loading, concentration, or liquid mole fraction.
  *
- * Remarks:
+ * History:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double tab_w_pT(double p_Pa, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(tab_w_pT, workingPair, p_Pa, T_K);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(tab_w_pT,
+			warning_struct("workingPair", "tab_w_pT"));
+	}
+
+	double dw_dp;
+	double dw_dT;
+
+	return STATISTICS_RETURN(tab_w_pT,
+		workingPair_table(&dw_dp, &dw_dT, 0, p_Pa, T_K, retWorkingPair));
+}
+
+
+/*
+ * tab_p_wT:
+ * ---------
+ *
+ * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
+ * in kg/kg, concentration X in kg/kg, or mole fraction in liquid phase x in
+ * mol/mol and equilibrium temperature T in K by the spline tables of the
+ * working pair. If tables are disabled or state is outside of tables, the
+ * original equation is evaluated.
+ *
+ * Parameters:
+ * -----------
+ * 	double w:
+ *		Equilibrium loading, concentration, or liquid mole fraction.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	struct *workingPair:
+ *		Pointer to WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium pressure in Pa.
  *
  * History:
  * --------
- *	01/13/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double ads_vol_piStar_pyxgTpsatRhoM(double p_total_Pa, double y_molmol,
-	double x_molmol, double gamma, double T_K, double p_sat_Pa,
-	double rho_kgm3, double M_kgmol, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double tab_p_wT(double w, double T_K, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
 	//
 	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(tab_p_wT, workingPair, w, T_K);
 
 	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ads_vol_piStar_pyxgTpsatRhoM");
+		return STATISTICS_RETURN(tab_p_wT,
+			warning_struct("workingPair", "tab_p_wT"));
 	}
 
-	// Check if isotherm function exists for chosen isotherm type
-	//
-	if (retWorkingPair->adsorption== NULL) {
-		return warning_struct("adsorption", "ads_vol_piStar_pyxgTpsatRhoM");
-		
-	} else if (retWorkingPair->adsorption->vol_piStar_pyxgTpsatRhoM==NULL) {
-		return warning_function("vol_piStar_pyxgTpsatRhoM",
-			"ads_vol_piStar_pyxgTpsatRhoM");
+	double dp_dw;
+	double dp_dT;
 
-	} else {
-		return retWorkingPair->adsorption->vol_piStar_pyxgTpsatRhoM(p_total_Pa,
-			y_molmol, x_molmol, gamma, T_K, p_sat_Pa, rho_kgm3, M_kgmol,
-			retWorkingPair->iso_par);
+	return STATISTICS_RETURN(tab_p_wT,
+		workingPair_table(&dp_dw, &dp_dT, 1, w, T_K, retWorkingPair));
+}
+
+
+/*
+ * tab_T_pw:
+ * ---------
+ *
+ * Calculates equilibrium temperature T in K depending on equilibrium pressure
+ * p in Pa and equilibrium loading w in kg/kg, concentration X in kg/kg, or
+ * mole fraction in liquid phase x in mol/mol by the spline tables of the
+ * working pair. If tables are disabled or state is outside of tables, the
+ * original equation is evaluated.
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ * 	double w:
+ *		Equilibrium loading, concentration, or liquid mole fraction.
+ *	struct *workingPair:
+ *		Pointer to WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Equilibrium temperature in K.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double tab_T_pw(double p_Pa, double w, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(tab_T_pw, workingPair, p_Pa, w);
 
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(tab_T_pw,
+			warning_struct("workingPair", "tab_T_pw"));
 	}
+
+	double dT_dp;
+	double dT_dw;
+
+	return STATISTICS_RETURN(tab_T_pw,
+		workingPair_table(&dT_dp, &dT_dw, 2, p_Pa, w, retWorkingPair));
 }
 
 
-////////////////////////////////////////////////////////////////////////////
-// Definition of function prototypes regarding absorption working w struct//
-////////////////////////////////////////////////////////////////////////////
 /*
- * abs_con_X_pT:
+ * tab_w_pT_der:
  * -------------
  *
- * Calculates equilibrium concentration X in kg/kg depending on equilibrium
- * pressure p in Pa and equilibrium temperature T in K.
+ * Calculates total derivative of equilibrium loading w in kg/kg/s,
+ * concentration X in kg/kg/s, or mole fraction in liquid phase x in mol/mol/s
+ * depending on equilibrium pressure p in Pa, equilibrium temperature T in K,
+ * and their derivatives by the partial derivatives of the spline tables of the
+ * working pair. Thus, the derivative is consistent with tab_w_pT (e.g., for
+ * derivative annotations of Modelica).
  *
  * Parameters:
  * -----------
@@ -2806,229 +9782,402 @@ DLL_API double ads_vol_piStar_pyxgTpsatRhoM(double p_total_Pa, double y_molmol,
  *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ * 	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *	struct *workingPair:
+ *		Pointer to WorkingPair-struct.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium concentration in kg/kg.
+ *		Derivative of equilibrium loading, concentration, or liquid mole
+ *		fraction.
  *
- * Remarks:
+ * History:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double tab_w_pT_der(double p_Pa, double T_K, double p_der_Pas,
+	double T_der_Ks, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
+	//
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(tab_w_pT_der, workingPair, p_Pa, T_K, p_der_Pas, T_der_Ks);
+
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(tab_w_pT_der,
+			warning_struct("workingPair", "tab_w_pT_der"));
+	}
+
+	double dw_dp;
+	double dw_dT;
+
+	if (workingPair_table(&dw_dp, &dw_dT, 0, p_Pa, T_K, retWorkingPair) ==
+		-1) {
+		return STATISTICS_RETURN(tab_w_pT_der, -1);
+	}
+
+	return STATISTICS_RETURN(tab_w_pT_der,
+		dw_dp * p_der_Pas + dw_dT * T_der_Ks);
+}
+
+
+/*
+ * tab_p_wT_der:
+ * -------------
+ *
+ * Calculates total derivative of equilibrium pressure p in Pa/s depending on
+ * equilibrium loading w in kg/kg, concentration X in kg/kg, or mole fraction
+ * in liquid phase x in mol/mol, equilibrium temperature T in K, and their
+ * derivatives by the partial derivatives of the spline tables of the working
+ * pair. Thus, the derivative is consistent with tab_p_wT (e.g., for
+ * derivative annotations of Modelica).
+ *
+ * Parameters:
+ * -----------
+ * 	double w:
+ *		Equilibrium loading, concentration, or liquid mole fraction.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double w_der:
+ *		Derivative of equilibrium loading, concentration, or liquid mole
+ *		fraction.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *	struct *workingPair:
+ *		Pointer to WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium pressure in Pa/s.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double abs_con_X_pT(double p_Pa, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double tab_p_wT_der(double w, double T_K, double w_der,
+	double T_der_Ks, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
 	//
 	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(tab_p_wT_der, workingPair, w, T_K, w_der, T_der_Ks);
 
 	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "abs_X_pT");
+		return STATISTICS_RETURN(tab_p_wT_der,
+			warning_struct("workingPair", "tab_p_wT_der"));
 	}
 
-	// Check if isotherm function exists for chosen isotherm type
+	double dp_dw;
+	double dp_dT;
+
+	if (workingPair_table(&dp_dw, &dp_dT, 1, w, T_K, retWorkingPair) == -1) {
+		return STATISTICS_RETURN(tab_p_wT_der, -1);
+	}
+
+	return STATISTICS_RETURN(tab_p_wT_der, dp_dw * w_der + dp_dT * T_der_Ks);
+}
+
+
+/*
+ * tab_T_pw_der:
+ * -------------
+ *
+ * Calculates total derivative of equilibrium temperature T in K/s depending on
+ * equilibrium pressure p in Pa, equilibrium loading w in kg/kg, concentration
+ * X in kg/kg, or mole fraction in liquid phase x in mol/mol, and their
+ * derivatives by the partial derivatives of the spline tables of the working
+ * pair. Thus, the derivative is consistent with tab_T_pw (e.g., for
+ * derivative annotations of Modelica).
+ *
+ * Parameters:
+ * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ * 	double w:
+ *		Equilibrium loading, concentration, or liquid mole fraction.
+ * 	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ * 	double w_der:
+ *		Derivative of equilibrium loading, concentration, or liquid mole
+ *		fraction.
+ *	struct *workingPair:
+ *		Pointer to WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double tab_T_pw_der(double p_Pa, double w, double p_der_Pas,
+	double w_der, void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs and count
+	// function call
 	//
-	if (retWorkingPair->absorption== NULL) {
-		return warning_struct("absorption", "abs_con_X_pT");
-		
-	} else if (retWorkingPair->absorption->con_X_pT==NULL) {
-		return warning_function("con_X_pT", "abs_con_X_pT");
+	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
+	STATISTICS_BEGIN;
+	TRACE_BEGIN(tab_T_pw_der, workingPair, p_Pa, w, p_der_Pas, w_der);
 
-	} else {
-		return retWorkingPair->absorption->con_X_pT(p_Pa, T_K,
-			retWorkingPair->iso_par);
+	if (retWorkingPair == NULL) {
+		return STATISTICS_RETURN(tab_T_pw_der,
+			warning_struct("workingPair", "tab_T_pw_der"));
+	}
 
+	double dT_dp;
+	double dT_dw;
+
+	if (workingPair_table(&dT_dp, &dT_dw, 2, p_Pa, w, retWorkingPair) == -1) {
+		return STATISTICS_RETURN(tab_T_pw_der, -1);
 	}
+
+	return STATISTICS_RETURN(tab_T_pw_der, dT_dp * p_der_Pas + dT_dw * w_der);
 }
 
 
+/////////////////////////////////////////////////////////////////////////////
+// Definition of function prototypes regarding adsorption working wo struct//
+/////////////////////////////////////////////////////////////////////////////
 /*
- * abs_con_p_XT:
- * -------------
+ * direct_ads_w_pT:
+ * ----------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium
- * concentration X in kg/kg and equilibrium temperature T in K.
+ * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
+ * p in Pa, equilibrium temperature T in K, and specified working pair.
  *
  * Parameters:
  * -----------
- *	double X_kgkg:
- *		Equilibrium concentration in kg/kg.
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium pressure in Pa.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	double:
+ *		Equilibrium loading in kg/kg.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	02/11/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double abs_con_p_XT(double X_kgkg, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_w_pT(double p_Pa, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "abs_p_XT");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if isotherm function exists for chosen isotherm type
+	// Execute requested function
 	//
-	if (retWorkingPair->absorption== NULL) {
-		return warning_struct("absorption", "abs_con_p_XT");
-		
-	} else if (retWorkingPair->absorption->con_p_XT==NULL) {
-		return warning_function("con_p_XT", "abs_con_p_XT");
+	double result = ads_w_pT(p_Pa, T_K, retWorkingPair);
 
-	} else {
-		return retWorkingPair->absorption->con_p_XT(X_kgkg, T_K,
-			retWorkingPair->iso_par);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * abs_con_T_pX:
- * -------------
+ * direct_ads_p_wT:
+ * ----------------
  *
- * Calculates equilibrium temperature in K depending on equilibrium pressure p
- * in Pa and equilibrium concentration X in kg/kg.
+ * Calculates equilibrium pressure p in Pa depending on equilibrium temperature
+ * T in K, equilibrium loading w in kg/kg, equilibrium temperature T in K, and
+ * specified working pair.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double X_kgkg:
- *		Equilibrium concentration in kg/kg.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
- *
- * Returns:
- * --------
- * 	double:
+ * 	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
  *		Equilibrium temperature in K.
  *
- * Remarks:
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *		Name of calculation approach for liquid density.
+ *
+ * Returns:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	double:
+ *		Equilibrium pressure in Pa.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	02/11/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double abs_con_T_pX(double p_Pa, double X_kgkg, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_p_wT(double w_kgkg, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "abs_T_pX");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if isotherm function exists for chosen isotherm type
+	// Execute requested function
 	//
-	if (retWorkingPair->absorption== NULL) {
-		return warning_struct("absorption", "abs_con_T_pX");
-		
-	} else if (retWorkingPair->absorption->con_T_pX==NULL) {
-		return warning_function("con_T_pX", "abs_con_T_pX");
+	double result = ads_p_wT(w_kgkg, T_K, retWorkingPair);
 
-	} else {
-		return retWorkingPair->absorption->con_T_pX(p_Pa, X_kgkg,
-			retWorkingPair->iso_par);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * abs_con_dX_dp_pT:
- * -----------------
+ * direct_ads_T_pw:
+ * ----------------
  *
- * Calculates derivative of equilibrium concentration X with respect to pressure
- * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Calculates equilibrium temperature in K depending on equilibrium pressure p
+ * in Pa, equilibrium loading w in kg/kg, and specified working pair.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
+ *	double p_Pa:
  *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
- *	double:
- *		Derivative of equilibrium concentration wrt. pressure in kg/kg/Pa.
+ * 	double:
+ *		Equilibrium temperature in K.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	Function uses equation of states implemented for calculation of vapor
+ *	pressure, saturated liquid density, derivative of vapor pressure wrt.
+ *	temperature, and derivative of saturated liquid density wrt. temperature
+ *	when isotherm of working pair is based on volumetric approach (e.g.
+ *	Dubinin theory).
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	02/11/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double abs_con_dX_dp_pT(double p_Pa, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_T_pw(double p_Pa, double w_kgkg,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "abs_dX_dp_pT");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if isotherm function exists for chosen isotherm type
+	// Execute requested function
 	//
-	if (retWorkingPair->absorption== NULL) {
-		return warning_struct("absorption", "abs_con_dX_dp_pT");
-		
-	} else if (retWorkingPair->absorption->con_dX_dp_pT==NULL) {
-		return warning_function("con_dX_dp_pT", "abs_con_dX_dp_pT");
+	double result = ads_T_pw(p_Pa, w_kgkg, retWorkingPair);
 
-	} else {
-		return retWorkingPair->absorption->con_dX_dp_pT(p_Pa, T_K,
-			retWorkingPair->iso_par);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * abs_con_dX_dT_pT:
- * -----------------
+ * direct_ads_dw_dp_pT:
+ * --------------------
  *
- * Calculates derivative of equilibrium concentration X with respect to
- * temperature T in kg/kg/K depending on equilibrium pressure p in Pa and
- * equilibrium temperature T in K.
+ * Calculates derivative of equilibrium loading w with respect to pressure
+ * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
@@ -3036,18 +10185,34 @@ DLL_API double abs_con_dX_dp_pT(double p_Pa, double T_K, void *workingPair) {
  *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium concentration wrt. temperature in kg/kg/K.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
  *
  * History:
  * --------
@@ -3055,57 +10220,69 @@ DLL_API double abs_con_dX_dp_pT(double p_Pa, double T_K, void *workingPair) {
  *		First implementation.
  *
  */
-DLL_API double abs_con_dX_dT_pT(double p_Pa, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_dw_dp_pT(double p_Pa, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "abs_dX_dT_pT");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if isotherm function exists for chosen isotherm type
+	// Execute requested function
 	//
-	if (retWorkingPair->absorption== NULL) {
-		return warning_struct("absorption", "abs_con_dX_dT_pT");
-		
-	} else if (retWorkingPair->absorption->con_dX_dT_pT==NULL) {
-		return warning_function("con_dX_dT_pT", "abs_con_dX_dT_pT");
+	double result = ads_dw_dp_pT(p_Pa, T_K, retWorkingPair);
 
-	} else {
-		return retWorkingPair->absorption->con_dX_dT_pT(p_Pa, T_K,
-			retWorkingPair->iso_par);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * abs_con_dp_dX_XT:
- * -----------------
+ * direct_ads_dw_dT_pT:
+ * --------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to concentration
- * w in kgPa/kg depending on equilibrium concentration X in kg/kg and
- * equilibrium temperature T in K.
+ * Calculates derivative of equilibrium loading w with respect to temperature
+ * T in kg/kg/K depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
- *	double X_kgkg:
- *		Equilibrium concentration in kg/kg.
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. concentration in Pakg/kg.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
  *
  * History:
  * --------
@@ -3113,57 +10290,69 @@ DLL_API double abs_con_dX_dT_pT(double p_Pa, double T_K, void *workingPair) {
  *		First implementation.
  *
  */
-DLL_API double abs_con_dp_dX_XT(double X_kgkg, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_dw_dT_pT(double p_Pa, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "abs_dp_dX_XT");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if isotherm function exists for chosen isotherm type
+	// Execute requested function
 	//
-	if (retWorkingPair->absorption== NULL) {
-		return warning_struct("absorption", "abs_con_dp_dX_XT");
-		
-	} else if (retWorkingPair->absorption->con_dp_dX_XT==NULL) {
-		return warning_function("con_dp_dX_XT", "abs_con_dp_dX_XT");
+	double result = ads_dw_dT_pT(p_Pa, T_K, retWorkingPair);
 
-	} else {
-		return retWorkingPair->absorption->con_dp_dX_XT(X_kgkg, T_K,
-			retWorkingPair->iso_par);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * abs_con_dp_dT_XT:
- * -----------------
+ * direct_ads_dp_dw_wT:
+ * --------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium concentration X in kg/kg and
- * equilibrium temperature T in K.
+ * Calculates derivative of equilibrium pressure p with respect to loading
+ * w in kgPa/kg depending on equilibrium loading w in kg/kg and equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
- *	double X_kgkg:
- *		Equilibrium concentration in kg/kg.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
  *
  * History:
  * --------
@@ -3171,65 +10360,69 @@ DLL_API double abs_con_dp_dX_XT(double X_kgkg, double T_K, void *workingPair) {
  *		First implementation.
  *
  */
-DLL_API double abs_con_dp_dT_XT(double X_kgkg, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_dp_dw_wT(double w_kgkg, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "abs_dp_dT_XT");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if isotherm function exists for chosen isotherm type
+	// Execute requested function
 	//
-	if (retWorkingPair->absorption== NULL) {
-		return warning_struct("absorption", "abs_con_dp_dT_XT");
-		
-	} else if (retWorkingPair->absorption->con_dp_dT_XT==NULL) {
-		return warning_function("con_dp_dT_XT", "abs_con_dp_dT_XT");
+	double result = ads_dp_dw_wT(w_kgkg, T_K, retWorkingPair);
 
-	} else {
-		return retWorkingPair->absorption->con_dp_dT_XT(X_kgkg, T_K,
-			retWorkingPair->iso_par);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * abs_act_g_Txv1v2:
- * -----------------
+ * direct_ads_dp_dT_wT:
+ * --------------------
  *
- * Calculates activity coefficient of first component depending on temperature
- * T_K in K, mole fraction in liquid phase x_molmol in mol/mol, molar volume of
- * first component in m³/mol, and molar volume of second component in m³/mol.
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium loading w in kg/kg and equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Activity coefficient of first component.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
  *
  * History:
  * --------
@@ -3237,912 +10430,1148 @@ DLL_API double abs_con_dp_dT_XT(double X_kgkg, double T_K, void *workingPair) {
  *		First implementation.
  *
  */
-DLL_API double abs_act_g_Txv1v2(double T_K, double x_molmol, double v1_m3mol,
-	double v2_m3mol, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_dp_dT_wT(double w_kgkg, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "abs_act_g_Txv1v2");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if absorption function exists for chosen working pair
+	// Execute requested function
 	//
-	if (retWorkingPair->absorption== NULL) {
-		return warning_struct("absorption", "abs_act_g_Txv1v2");
-		
-	} else if (retWorkingPair->absorption->act_g_Txv1v2==NULL) {
-		return warning_function("act_g_Txv1v2", "abs_act_g_Txv1v2");
+	double result = ads_dp_dT_wT(w_kgkg, T_K, retWorkingPair);
 
-	} else {
-		return retWorkingPair->absorption->act_g_Txv1v2(T_K, x_molmol, v1_m3mol,
-			v2_m3mol, retWorkingPair->iso_par, retWorkingPair->absorption);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * abs_act_p_Txv1v2psat:
- * ---------------------
+ * direct_ads_w_pT_der:
+ * --------------------
  *
- * Calculates equilibrium pressure p_Pa in Pa of first component depending on
- * temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
- * molar volume of first component in m³/mol, molar volume of second component
- * in m³/mol,and saturation pressure of first component p_sat_Pa in Pa.
+ * Calculates total derivative of equilibrium loading w in kg/kg/s depending on
+ * equilibrium pressure p in Pa, equilibrium temperature T in K, and their
+ * derivatives by the analytical partial derivatives of the isotherm. Thus, the
+ * derivative can be used for derivative annotations of DirectFunctionCalls of
+ * Modelica.
  *
  * Parameters:
  * -----------
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
- *	double p_sat_Pa:
- *		Saturation pressure of first component in Pa.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure p_Pa in Pa.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
+ *		Derivative of equilibrium loading in kg/kg/s.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double abs_act_p_Txv1v2psat(double T_K, double x_molmol,
-	double v1_m3mol, double v2_m3mol, double p_sat_Pa, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_w_pT_der(double p_Pa, double T_K, double p_der_Pas,
+	double T_der_Ks, const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "abs_act_p_Txv1v2psat");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if absorption function exists for chosen working pair
+	// Execute requested function
 	//
-	if (retWorkingPair->absorption== NULL) {
-		return warning_struct("absorption", "abs_act_p_Txv1v2psat");
-		
-	} else if (retWorkingPair->absorption->act_p_Txgv1v2psat==NULL) {
-		return warning_function("act_p_Txgv1v2psat", "abs_act_p_Txv1v2psat");
+	double result = ads_w_pT_der(p_Pa, T_K, p_der_Pas, T_der_Ks,
+		retWorkingPair);
 
-	} else {
-		return retWorkingPair->absorption->act_p_Txgv1v2psat(T_K, x_molmol,
-			v1_m3mol, v2_m3mol, p_sat_Pa, retWorkingPair->iso_par,
-			retWorkingPair->absorption);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * abs_act_x_pTv1v2psat:
- * ---------------------
+ * direct_ads_p_wT_der:
+ * --------------------
  *
- * Calculates mole fraction of first component in liquid phase x_molmol in
- * mol/mol depending on equilibrium pressure p_Pa in Pa of first component,
- * temperature T_K in K, molar volume of first component in m³/mol, molar volume
- * of second component in m³/mol and saturation pressure of first component
- * p_sat_Pa in Pa
+ * Calculates total derivative of equilibrium pressure p in Pa/s depending on
+ * equilibrium loading w in kg/kg, equilibrium temperature T in K, and their
+ * derivatives by the analytical partial derivatives of the isotherm. Thus, the
+ * derivative can be used for derivative annotations of DirectFunctionCalls of
+ * Modelica.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure p_Pa in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
- *	double p_sat_Pa:
- *		Saturation pressure of first component in Pa.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	double w_der_kgkgs:
+ *		Derivative of equilibrium loading in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
+ *		Derivative of equilibrium pressure in Pa/s.
  *
  * History:
  * --------
- *	30/03/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double abs_act_x_pTv1v2psat(double p_Pa, double T_K, double v1_m3mol,
-	double v2_m3mol, double p_sat_Pa, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_p_wT_der(double w_kgkg, double T_K,
+	double w_der_kgkgs, double T_der_Ks, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "abs_act_x_pTv1v2psat");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if absorption function exists for chosen working pair
+	// Execute requested function
 	//
-	if (retWorkingPair->absorption== NULL) {
-		return warning_struct("absorption", "abs_act_x_pTv1v2psat");
-		
-	} else if (retWorkingPair->absorption->act_x_pTgv1v2psat==NULL) {
-		return warning_function("act_x_pTgv1v2psat", "abs_act_x_pTv1v2psat");
+	double result = ads_p_wT_der(w_kgkg, T_K, w_der_kgkgs, T_der_Ks,
+		retWorkingPair);
 
-	} else {
-		return retWorkingPair->absorption->act_x_pTgv1v2psat(p_Pa, T_K,
-			v1_m3mol, v2_m3mol, p_sat_Pa, retWorkingPair->iso_par,
-			retWorkingPair->absorption);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * abs_act_p_Txv1v2:
- * -----------------
+ * direct_ads_T_pw_der:
+ * --------------------
  *
- * Calculates equilibrium pressure p_Pa in Pa of first component depending on
- * temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
- * molar volume of first component in m³/mol, and molar volume of second
- * component in m³/mol.
+ * Calculates total derivative of equilibrium temperature T in K/s depending on
+ * equilibrium pressure p in Pa, equilibrium loading w in kg/kg, and their
+ * derivatives by the analytical partial derivatives of the isotherm and the
+ * implicit function theorem. Thus, the derivative can be used for derivative
+ * annotations of DirectFunctionCalls of Modelica.
  *
  * Parameters:
  * -----------
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double x_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double w_der_kgkgs:
+ *		Derivative of equilibrium loading in kg/kg/s.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure p_Pa in Pa.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
- *	This function uses internal model for vapor pressure of refrigerant.
+ *		Derivative of equilibrium temperature in K/s.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double abs_act_p_Txv1v2(double T_K, double x_molmol,
-	double v1_m3mol, double v2_m3mol, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_T_pw_der(double p_Pa, double w_kgkg, double p_der_Pas,
+	double w_der_kgkgs, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "abs_act_p_Txv1v2");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if absorption function exists for chosen working pair
+	// Execute requested function
 	//
-	if (retWorkingPair->absorption== NULL) {
-		return warning_struct("absorption", "abs_act_p_Txv1v2");
-		
-	} else if (retWorkingPair->absorption->act_p_Txgv1v2psat==NULL) {
-		return warning_function("act_p_Txgv1v2psat", "abs_act_p_Txv1v2");
-
-	} else if (retWorkingPair->refrigerant->p_sat_T==NULL) {
-		return warning_function("p_sat_T", "abs_act_p_Txv1v2");
-
-	} else if (retWorkingPair->psat_par==NULL) {
-		return warning_parameter("the saturated vapor pressure",
-			"abs_act_p_Txv1v2");
-
-	} else {
-		double p_sat_Pa = retWorkingPair->refrigerant->p_sat_T(T_K,
-			retWorkingPair->psat_par, retWorkingPair->refrigerant);
+	double result = ads_T_pw_der(p_Pa, w_kgkg, p_der_Pas, w_der_kgkgs,
+		retWorkingPair);
 
-		return retWorkingPair->absorption->act_p_Txgv1v2psat(T_K, x_molmol,
-			v1_m3mol, v2_m3mol, p_sat_Pa, retWorkingPair->iso_par,
-			retWorkingPair->absorption);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * abs_act_x_pTv1v2:
- * -----------------
+ * direct_ads_dw_dp_pT_der:
+ * ------------------------
  *
- * Calculates mole fraction of first component in liquid phase x_molmol in
- * mol/mol depending on equilibrium pressure p_Pa in Pa of first component,
- * temperature T_K in K, molar volume of first component in m³/mol, and molar
- * volume of second component in m³/mol.
+ * Calculates total derivative of derivative of equilibrium loading w with
+ * respect to pressure p in kg/kg/Pa/s depending on equilibrium pressure p in
+ * Pa, equilibrium temperature T in K, and their derivatives.
  *
  * Parameters:
  * -----------
  *	double p_Pa:
- *		Equilibrium pressure p_Pa in Pa.
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *		Derivative of derivative of equilibrium loading wrt. pressure in
+ *		kg/kg/Pa/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
- *	This function uses internal model for vapor pressure of refrigerant.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	30/03/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double abs_act_x_pTv1v2(double p_Pa, double T_K, double v1_m3mol,
-	double v2_m3mol, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_dw_dp_pT_der(double p_Pa, double T_K,
+	double p_der_Pas, double T_der_Ks, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "abs_act_x_pTv1v2");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if absorption function exists for chosen working pair
+	// Execute requested function
 	//
-	if (retWorkingPair->absorption== NULL) {
-		return warning_struct("absorption", "abs_act_x_pTv1v2");
-		
-	} else if (retWorkingPair->absorption->act_x_pTgv1v2psat==NULL) {
-		return warning_function("act_x_pTgv1v2psat", "abs_act_x_pTv1v2");
-
-	} else if (retWorkingPair->refrigerant->p_sat_T==NULL) {
-		return warning_function("p_sat_T", "abs_act_x_pTv1v2");
-
-	} else if (retWorkingPair->psat_par==NULL) {
-		return warning_parameter("the saturated vapor pressure",
-			"abs_act_x_pTv1v2");
-
-
-	} else {
-		double p_sat_Pa = retWorkingPair->refrigerant->p_sat_T(T_K,
-			retWorkingPair->psat_par, retWorkingPair->refrigerant);
+	double result = ads_dw_dp_pT_der(p_Pa, T_K, p_der_Pas, T_der_Ks,
+		retWorkingPair);
 
-		return retWorkingPair->absorption->act_x_pTgv1v2psat(p_Pa, T_K,
-			v1_m3mol, v2_m3mol, p_sat_Pa, retWorkingPair->iso_par,
-			retWorkingPair->absorption);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * abs_mix_x_pT:
- * -------------
+ * direct_ads_dw_dT_pT_der:
+ * ------------------------
  *
- * Calculates equilibrium liquid mole fraction of first component in mol/mol
- * depending on pressure in Pa and temperature T_K in K.
+ * Calculates total derivative of derivative of equilibrium loading w with
+ * respect to temperature T in kg/kg/K/s depending on equilibrium pressure p in
+ * Pa, equilibrium temperature T in K, and their derivatives.
  *
  * Parameters:
  * -----------
  *	double p_Pa:
- *		Equilibrium pressure p_Pa in Pa.
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium mole fraction in of first component liquid phase in mol/mol.
- *	double *ret_y_1_molmol:
- *		Equilibrium mole fraction of first component.
- *	double *ret_y_2_molmol:
- *		Equilibrium mole fraction of second component.
+ *		Derivative of derivative of equilibrium loading wrt. temperature in
+ *		kg/kg/K/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on mixing rules.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double abs_mix_x_pT(double *ret_y_1_molmol, double *ret_y_2_molmol,
-	double p_Pa, double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_dw_dT_pT_der(double p_Pa, double T_K,
+	double p_der_Pas, double T_der_Ks, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "abs_mix_x_pT");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if absorption function exists for chosen working pair
+	// Execute requested function
 	//
-	if (retWorkingPair->absorption== NULL) {
-		return warning_struct("absorption", "abs_mix_x_pT");
-		
-	} else if (retWorkingPair->absorption->mix_x_pT==NULL) {
-		return warning_function("mix_x_pT", "abs_mix_x_pT");
+	double result = ads_dw_dT_pT_der(p_Pa, T_K, p_der_Pas, T_der_Ks,
+		retWorkingPair);
 
-	} else {
-		return retWorkingPair->absorption->mix_x_pT(ret_y_1_molmol,
-			ret_y_2_molmol, p_Pa, T_K, retWorkingPair->iso_par,
-			retWorkingPair->absorption);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * abs_mix_p_Tx:
- * -------------
+ * direct_ads_dp_dw_wT_der:
+ * ------------------------
  *
- * Calculates equilibrium pressure p_Pa in Pa depending on temperature T_K in K
- * and mole fraction in liquid phase x_molmol in mol/mol.
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to loading w in Pa/(kg/kg)/s depending on equilibrium loading w in
+ * kg/kg, equilibrium temperature T in K, and their derivatives.
  *
  * Parameters:
  * -----------
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_1_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	double w_der_kgkgs:
+ *		Derivative of equilibrium loading in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure p_Pa in Pa.
- *	double *ret_y_1_molmol:
- *		Equilibrium mole fraction of first component.
- *	double *ret_y_2_molmol:
- *		Equilibrium mole fraction of second component.
+ *		Derivative of derivative of equilibrium pressure wrt. loading in
+ *		Pa/(kg/kg)/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on mixing rules.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double abs_mix_p_Tx(double *ret_y_1_molmol, double *ret_y_2_molmol,
-	double T_K, double x_1_molmol, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_dp_dw_wT_der(double w_kgkg, double T_K,
+	double w_der_kgkgs, double T_der_Ks, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "abs_mix_p_Tx");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if absorption function exists for chosen working pair
+	// Execute requested function
 	//
-	if (retWorkingPair->absorption== NULL) {
-		return warning_struct("absorption", "abs_mix_p_Tx");
-		
-	} else if (retWorkingPair->absorption->mix_p_Tx==NULL) {
-		return warning_function("mix_p_Tx", "abs_mix_p_Tx");
+	double result = ads_dp_dw_wT_der(w_kgkg, T_K, w_der_kgkgs, T_der_Ks,
+		retWorkingPair);
 
-	} else {
-		return retWorkingPair->absorption->mix_p_Tx(ret_y_1_molmol,
-			ret_y_2_molmol, T_K, x_1_molmol, retWorkingPair->iso_par,
-			retWorkingPair->absorption);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * abs_mix_T_px:
- * -------------
+ * direct_ads_dp_dT_wT_der:
+ * ------------------------
  *
- * Calculates equilibrium temperature T_K in K depending on pressure p_Pa in Pa
- * and mole fraction in liquid phase x_molmol in mol/mol.
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to temperature T in Pa/K/s depending on equilibrium loading w in
+ * kg/kg, equilibrium temperature T in K, and their derivatives.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure p_Pa in Pa.
- *	double x_1_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double w_der_kgkgs:
+ *		Derivative of equilibrium loading in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
- *	double *ret_y_1_molmol:
- *		Equilibrium mole fraction of first component.
- *	double *ret_y_2_molmol:
- *		Equilibrium mole fraction of second component.
+ *		Derivative of derivative of equilibrium pressure wrt. temperature in
+ *		Pa/K/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on mixing rules.
- *	Uses Newton-Raphson method for calculating equilibrium temperature.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double abs_mix_T_px(double *ret_y_1_molmol, double *ret_y_2_molmol,
-	double p_Pa, double x_1_molmol, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_dp_dT_wT_der(double w_kgkg, double T_K,
+	double w_der_kgkgs, double T_der_Ks, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "abs_mix_T_px");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if absorption function exists for chosen working pair
+	// Execute requested function
 	//
-	if (retWorkingPair->absorption== NULL) {
-		return warning_struct("absorption", "abs_mix_T_px");
-		
-	} else if (retWorkingPair->absorption->mix_T_px==NULL) {
-		return warning_function("mix_T_px", "abs_mix_T_px");
+	double result = ads_dp_dT_wT_der(w_kgkg, T_K, w_der_kgkgs, T_der_Ks,
+		retWorkingPair);
 
-	} else {
-		return retWorkingPair->absorption->mix_T_px(ret_y_1_molmol,
-			ret_y_2_molmol, p_Pa, x_1_molmol, retWorkingPair->iso_par,
-			retWorkingPair->absorption);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * abs_mix_dp_dx_Tx:
- * -----------------
+ * direct_ads_piStar_pyxgTM:
+ * -------------------------
  *
- * Calculates derivative of equilibrium pressure with respect to liquid mole
- * fraction in Pa depending on temperature T_K in K and mole fraction in liquid
- * phase x_molmol in mol/mol.
+ * Calculates reduced spreading pressure piStar in kg/mol depending on
+ * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
+ * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
+ * activity coefficient of refrigerant in adsorbed phase, equilibrium
+ * temperature T in K and molar mass of refrigerant M in kg/mol. The reduced
+ * spreading pressure is defined as follows:
+ *
+ * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
+ *		Integral_0^p0{w(p,T) / p * dp}
+ *
+ *	where p0 = p_total*y / (gamma*x)
  *
  * Parameters:
  * -----------
+ *	double p_total_Pa:
+ *		Total pressure of vapor phase in Pa.
+ *	double y_molmol:
+ *		Molar fraction of refrigerant in vapor phase in mol/mol.
+ *	double x_molmol:
+ *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
+ *	double gamma:
+ *		Activity coefficient of refrigerant in adsorbed phase.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_1_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	double M_kgmol:
+ *		Molar mass of refrigerant M in kg/mol.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt liquid mole fraction in Pa.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on mixing rules.
- *	Derivative is calculated numerically by the symmetric derivative using
- *  h = 0.00000001 mol/mol as small change.
+ *		Reduced spreading pressure in kg/mol.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double abs_mix_dp_dx_Tx(double T_K, double x_1_molmol,
-	void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_piStar_pyxgTM(double p_total_Pa,
+	double y_molmol, double x_molmol, double gamma, double T_K, double M_kgmol,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "abs_mix_dp_dx_Tx");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if absorption function exists for chosen working pair
-	//
-	if (retWorkingPair->absorption== NULL) {
-		return warning_struct("absorption", "abs_mix_dp_dx_Tx");
-		
-	} else if (retWorkingPair->absorption->mix_dp_dx_Tx==NULL) {
-		return warning_function("mix_dp_dx_Tx", "abs_mix_dp_dx_Tx");
+	// Execute requested function
+	//
+	double result = ads_piStar_pyxgTM(p_total_Pa, y_molmol, x_molmol, gamma,
+		T_K, M_kgmol, retWorkingPair);
 
-	} else {
-		return retWorkingPair->absorption->mix_dp_dx_Tx(T_K, x_1_molmol,
-			retWorkingPair->iso_par, retWorkingPair->absorption);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * abs_mix_dp_dT_Tx:
- * -----------------
+ * direct_ads_sur_w_pT:
+ * --------------------
  *
- * Calculates derivative of equilibrium pressure with respect to temperature in
- * Pa/K depending on temperature T_K in K and mole fraction in liquid phase
- * x_molmol in mol/mol.
+ * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
+ * p in Pa, equilibrium temperature T in K, and specified working pair.
  *
  * Parameters:
  * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_1_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt temperature in Pa/K.
+ *		Equilibrium loading in kg/kg.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on mixing rules.
- *	Derivative is calculated numerically by the symmetric derivative using
- *  h = 0.0001 K as small change.
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double abs_mix_dp_dT_Tx(double T_K, double x_1_molmol,
-	void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_sur_w_pT(double p_Pa, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "abs_mix_dp_dT_Tx");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if absorption function exists for chosen working pair
+	// Execute requested function
 	//
-	if (retWorkingPair->absorption== NULL) {
-		return warning_struct("absorption", "abs_mix_dp_dT_Tx");
-		
-	} else if (retWorkingPair->absorption->mix_dp_dT_Tx==NULL) {
-		return warning_function("mix_dp_dT_Tx", "abs_mix_dp_dT_Tx");
+	double result = ads_sur_w_pT(p_Pa, T_K, retWorkingPair);
 
-	} else {
-		return retWorkingPair->absorption->mix_dp_dT_Tx(T_K, x_1_molmol,
-			retWorkingPair->iso_par, retWorkingPair->absorption);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
-/////////////////////////////////////////////////////////////////////////////
-// Definition of function prototypes regarding refrigerant working w struct//
-/////////////////////////////////////////////////////////////////////////////
 /*
- * ref_p_sat_T:
- * ------------
+ * direct_ads_sur_p_wT:
+ * --------------------
  *
- * Calculates saturation pressure in Pa depending on equilibrium temperature T
- * in K.
+ * Calculates equilibrium pressure p in Pa depending on equilibrium temperature
+ * T in K, equilibrium loading w in kg/kg, equilibrium temperature T in K, and
+ * specified working pair.
  *
  * Parameters:
  * -----------
+ * 	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
  *	double:
- *		Saturation pressure in Pa.
+ *		Equilibrium pressure in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double ref_p_sat_T(double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_sur_p_wT(double w_kgkg, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ref_p_sat_T");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if refrigerant function exists for chosen working pair
+	// Execute requested function
 	//
-	if (retWorkingPair->refrigerant->p_sat_T==NULL) {
-		return warning_function("p_sat_T", "ref_p_sat_T");
-
-	} else if (retWorkingPair->psat_par==NULL) {
-		return warning_parameter("the saturated vapor pressure", "ref_p_sat_T");
+	double result = ads_sur_p_wT(w_kgkg, T_K, retWorkingPair);
 
-	} else {
-		return retWorkingPair->refrigerant->p_sat_T(T_K,
-			retWorkingPair->psat_par, retWorkingPair->refrigerant);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * ref_dp_sat_dT_T:
- * ----------------
+ * direct_ads_sur_T_pw:
+ * --------------------
  *
- * Calculates derivative of saturation pressure in Pa/K wrt to temperature
- * depending on equilibrium temperature T in K.
+ * Calculates equilibrium temperature in K depending on equilibrium pressure p
+ * in Pa, equilibrium loading w in kg/kg, and specified working pair.
  *
  * Parameters:
  * -----------
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
+ *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
- *	double:
- *		Derivative of saturation pressure wrt temperature in Pa/K.
+ * 	double:
+ *		Equilibrium temperature in K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double ref_dp_sat_dT_T(double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_sur_T_pw(double p_Pa, double w_kgkg,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ref_dp_sat_dT_T");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if refrigerant function exists for chosen working pair
+	// Execute requested function
 	//
-	if (retWorkingPair->refrigerant->dp_sat_dT==NULL) {
-		return warning_function("dp_sat_T", "ref_dp_sat_dT_T");
-
-	} else if (retWorkingPair->psat_par==NULL) {
-		return warning_parameter("the derivative of the saturated vapor pressure with "
-			"respect to temperature", "ref_dp_sat_dT_T");
+	double result = ads_sur_T_pw(p_Pa, w_kgkg, retWorkingPair);
 
-	} else {
-		return retWorkingPair->refrigerant->dp_sat_dT(T_K,
-			retWorkingPair->psat_par, retWorkingPair->refrigerant);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * ref_rho_l_T:
- * ------------
+ * direct_ads_sur_dw_dp_pT:
+ * ------------------------
  *
- * Calculates saturated liquid density in kg/m³ depending on equilibrium
+ * Calculates derivative of equilibrium loading w with respect to pressure
+ * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
  * temperature T in K.
  *
  * Parameters:
  * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Saturated liquid density in kg/m³.
+ *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double ref_rho_l_T(double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_sur_dw_dp_pT(double p_Pa, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ref_rho_l_T");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if refrigerant function exists for chosen working pair
+	// Execute requested function
 	//
-	if (retWorkingPair->refrigerant->rho_l_T==NULL) {
-		return warning_function("psat_T", "ref_rho_l_T");
-
-	} else if (retWorkingPair->rhol_par==NULL) {
-		return warning_parameter("the saturated liquid density", "ref_rho_l_T");
+	double result = ads_sur_dw_dp_pT(p_Pa, T_K, retWorkingPair);
 
-	} else {
-		return retWorkingPair->refrigerant->rho_l_T(T_K,
-			retWorkingPair->rhol_par);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * ref_drho_l_dT_T:
- * ----------------
+ * direct_ads_sur_dw_dT_pT:
+ * ------------------------
  *
- * Calculates derivative of saturated liquid density wrt temperature in kg/m³/K
- * depending on equilibrium temperature T in K.
+ * Calculates derivative of equilibrium loading w with respect to temperature
+ * T in kg/kg/K depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of saturated liquid density wrt temperature in kg/m³/K.
+ *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double ref_drho_l_dT_T(double T_K, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_sur_dw_dT_pT(double p_Pa, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ref_drho_l_dT_T");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if refrigerant function exists for chosen working pair
+	// Execute requested function
 	//
-	if (retWorkingPair->refrigerant->drho_l_dT==NULL) {
-		return warning_function("psat_T", "ref_drho_l_dT_T");
-
-	} else if (retWorkingPair->rhol_par==NULL) {
-		return warning_parameter("the derivative of the saturated liquid density with "
-			"respect to temperature", "ref_drho_l_dT_T");
+	double result = ads_sur_dw_dT_pT(p_Pa, T_K, retWorkingPair);
 
-	} else {
-		return retWorkingPair->refrigerant->drho_l_dT(T_K,
-			retWorkingPair->rhol_par);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
 /*
- * ref_T_sat_p:
- * ------------
+ * direct_ads_sur_dp_dw_wT:
+ * ------------------------
  *
- * Calculates saturation temperature in K depending on equilibrium pressure p
- * in Pa.
+ * Calculates derivative of equilibrium pressure p with respect to loading
+ * w in kgPa/kg depending on equilibrium loading w in kg/kg and equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Saturation pressure in Pa.
- * 	struct *WorkingPair:
- *		Pointer of WorkingPair-struct.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *
+ *	const char *path_db:
+ *		Path to database.
+ * 	const char *wp_as:
+ *		Name of sorbent.
+ * 	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ * 	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm (i.e. when more than one isotherm is available)
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation (i.e. when more than one equation is
+ *		available)
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation (i.e. when more than one equation is
+ *		available)
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium temperature in K.
+ *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double ref_T_sat_p(double p_Pa, void *workingPair) {
-	// Typecast void pointers given as inputs to correct structs
+DLL_API double direct_ads_sur_dp_dw_wT(double w_kgkg, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = (WorkingPair *) workingPair;
-
-	if (retWorkingPair == NULL) {
-		return warning_struct("workingPair", "ref_T_sat_p");
-	}
+	WorkingPair *retWorkingPair = direct_workingPair(
+		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
+		rf_rhol, no_rhol);
 
-	// Check if refrigerant function exists for chosen working pair
+	// Execute requested function
 	//
-	if (retWorkingPair->refrigerant->T_sat_p==NULL) {
-		return warning_function("T_sat_p", "ref_T_sat_p");
-
-	} else if (retWorkingPair->psat_par==NULL) {
-		return warning_parameter("the saturated vapor pressure", "ref_T_sat_p");
+	double result = ads_sur_dp_dw_wT(w_kgkg, T_K, retWorkingPair);
 
-	} else {
-		return retWorkingPair->refrigerant->T_sat_p(p_Pa,
-			retWorkingPair->psat_par, retWorkingPair->refrigerant);
+	direct_release(retWorkingPair);
 
-	}
+	return result;
 }
 
 
-/////////////////////////////////////////////////////////////////////////////
-// Definition of function prototypes regarding adsorption working wo struct//
-/////////////////////////////////////////////////////////////////////////////
 /*
- * direct_ads_w_pT:
- * ----------------
+ * direct_ads_sur_dp_dT_wT:
+ * ------------------------
  *
- * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
- * p in Pa, equilibrium temperature T in K, and specified working pair.
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium loading w in kg/kg and equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
  *
@@ -4172,50 +11601,70 @@ DLL_API double ref_T_sat_p(double p_Pa, void *workingPair) {
  * Returns:
  * --------
  *	double:
- *		Equilibrium loading in kg/kg.
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
  *
  * History:
  * --------
- *	02/11/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_w_pT(double p_Pa, double T_K,
+DLL_API double direct_ads_sur_dp_dT_wT(double w_kgkg, double T_K,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_w_pT(p_Pa, T_K, retWorkingPair);
+	double result = ads_sur_dp_dT_wT(w_kgkg, T_K, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_p_wT:
- * ----------------
+ * direct_ads_sur_piStar_pyxgTM:
+ * -----------------------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium temperature
- * T in K, equilibrium loading w in kg/kg, equilibrium temperature T in K, and
- * specified working pair.
+ * Calculates reduced spreading pressure piStar in kg/mol depending on
+ * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
+ * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
+ * activity coefficient of refrigerant in adsorbed phase, equilibrium
+ * temperature T in K and molar mass of refrigerant M in kg/mol. The reduced
+ * spreading pressure is defined as follows:
+ *
+ * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
+ *		Integral_0^p0{w(p,T) / p * dp}
+ *
+ *	where p0 = p_total*y / (gamma*x)
  *
  * Parameters:
  * -----------
- * 	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double p_total_Pa:
+ *		Total pressure of vapor phase in Pa.
+ *	double y_molmol:
+ *		Molar fraction of refrigerant in vapor phase in mol/mol.
+ *	double x_molmol:
+ *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
+ *	double gamma:
+ *		Activity coefficient of refrigerant in adsorbed phase.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double M_kgmol:
+ *		Molar mass of refrigerant M in kg/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4239,54 +11688,61 @@ DLL_API double direct_ads_w_pT(double p_Pa, double T_K,
  *	int no_rhol:
  *		ID of liquid density equation (i.e. when more than one equation is
  *		available)
- *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure in Pa.
+ *		Reduced spreading pressure in kg/mol.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach.
  *
  * History:
  * --------
- *	02/11/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_p_wT(double w_kgkg, double T_K,
+DLL_API double direct_ads_sur_piStar_pyxgTM(double p_total_Pa,
+	double y_molmol, double x_molmol, double gamma, double T_K, double M_kgmol,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_p_wT(w_kgkg, T_K, retWorkingPair);
+	double result = ads_sur_piStar_pyxgTM(p_total_Pa, y_molmol, x_molmol, gamma,
+		T_K, M_kgmol, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_T_pw:
- * ----------------
+ * direct_ads_sur_w_pTpsat:
+ * ------------------------
  *
- * Calculates equilibrium temperature in K depending on equilibrium pressure p
- * in Pa, equilibrium loading w in kg/kg, and specified working pair.
+ * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
+ * p in Pa, equilibrium temperature T in K, and saturation pressure p_sat in Pa.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
+ * 	double p_Pa:
  *		Equilibrium pressure in Pa.
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4310,63 +11766,60 @@ DLL_API double direct_ads_p_wT(double w_kgkg, double T_K,
  *	int no_rhol:
  *		ID of liquid density equation (i.e. when more than one equation is
  *		available)
- *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium temperature in K.
+ *	double:
+ *		Equilibrium loading in kg/kg.
  *
  * Remarks:
  * --------
- *	Function uses equation of states implemented for calculation of vapor
- *	pressure, saturated liquid density, derivative of vapor pressure wrt.
- *	temperature, and derivative of saturated liquid density wrt. temperature
- *	when isotherm of working pair is based on volumetric approach (e.g.
- *	Dubinin theory).
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
  *
  * History:
  * --------
- *	02/11/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_T_pw(double p_Pa, double w_kgkg,
-	const char *path_db, const char *wp_as, const char *wp_st,
+DLL_API double direct_ads_sur_w_pTpsat(double p_Pa, double T_K,
+	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_T_pw(p_Pa, w_kgkg, retWorkingPair);
+	double result = ads_sur_w_pTpsat(p_Pa, T_K, p_sat_Pa, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_dw_dp_pT:
- * --------------------
+ * direct_ads_sur_p_wTpsat:
+ * ------------------------
  *
- * Calculates derivative of equilibrium loading w with respect to pressure
- * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
+ * in kg/kg, equilibrium temperature T in K, and saturation pressure p_sat in
+ * Pa.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ * 	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4390,54 +11843,60 @@ DLL_API double direct_ads_T_pw(double p_Pa, double w_kgkg,
  *	int no_rhol:
  *		ID of liquid density equation (i.e. when more than one equation is
  *		available)
+ *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *		Equilibrium pressure in Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_dw_dp_pT(double p_Pa, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
+DLL_API double direct_ads_sur_p_wTpsat(double w_kgkg, double T_K,
+	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_dw_dp_pT(p_Pa, T_K, retWorkingPair);
+	double result = ads_sur_p_wTpsat(w_kgkg, T_K, p_sat_Pa, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_dw_dT_pT:
- * --------------------
+ * direct_ads_sur_T_pwpsat:
+ * ------------------------
  *
- * Calculates derivative of equilibrium loading w with respect to temperature
- * T in kg/kg/K depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Calculates equilibrium temperature in K depending on equilibrium pressure p
+ * in Pa, equilibrium loading w in kg/kg, and saturation pressure p_sat in Pa.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
+ *	double p_Pa:
  *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4461,54 +11920,66 @@ DLL_API double direct_ads_dw_dp_pT(double p_Pa, double T_K,
  *	int no_rhol:
  *		ID of liquid density equation (i.e. when more than one equation is
  *		available)
+ *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
- *	double:
- *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ * 	double:
+ *		Equilibrium temperature in K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
+ *	Uses internal equation of states to calculate vapor pressure and derivative
+ *	of vapor pressure wrt. temperature. If equation of state is not implemented
+ *	for refrigerant, function returns -1 and throws warning. If user want to use
+ *	his own equation of state, this function cannot be used and determination of
+ *	root to calculate T must be implemented by user.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_dw_dT_pT(double p_Pa, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
+DLL_API double direct_ads_sur_T_pwpsat(double p_Pa, double w_kgkg,
+	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_dw_dT_pT(p_Pa, T_K, retWorkingPair);
+	double result = ads_sur_T_pwpsat(p_Pa, w_kgkg, p_sat_Pa, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_dp_dw_wT:
- * --------------------
+ * direct_ads_sur_dw_dp_pTpsat:
+ * ----------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to loading
- * w in kgPa/kg depending on equilibrium loading w in kg/kg and equilibrium
- * temperature T in K.
+ * Calculates derivative of equilibrium loading w with respect to pressure
+ * p in kg/kg/Pa depending on equilibrium pressure p in Pa, equilibrium
+ * temperature T in K, and saturation pressure p_sat in Pa.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4536,50 +12007,60 @@ DLL_API double direct_ads_dw_dT_pT(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_dp_dw_wT(double w_kgkg, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
+DLL_API double direct_ads_sur_dw_dp_pTpsat(double p_Pa, double T_K,
+	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_dp_dw_wT(w_kgkg, T_K, retWorkingPair);
+	double result = ads_sur_dw_dp_pTpsat(p_Pa, T_K, p_sat_Pa, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_dp_dT_wT:
- * --------------------
+ * direct_ads_sur_dw_dT_pTpsat:
+ * ----------------------------
+ *
+ * Calculates derivative of equilibrium loading w with respect to temperature
+ * T in kg/kg/K depending on equilibrium pressure p in Pa, equilibrium
+ * temperature T in K, saturation pressure p_sat in Pa, and derivative of
+ * saturation pressure wrt. temperature dp_sat_dT in Pa/K.
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium loading w in kg/kg and equilibrium
- * temperature T in K.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	double dp_sat_dT_PaK:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4607,66 +12088,58 @@ DLL_API double direct_ads_dp_dw_wT(double w_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_dp_dT_wT(double w_kgkg, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_ads_sur_dw_dT_pTpsat(double p_Pa, double T_K,
+	double p_sat_Pa, double dp_sat_dT_PaK, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_dp_dT_wT(w_kgkg, T_K, retWorkingPair);
+	double result = ads_sur_dw_dT_pTpsat(p_Pa, T_K, p_sat_Pa, dp_sat_dT_PaK,
+		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_piStar_pyxgTM:
- * -------------------------
- *
- * Calculates reduced spreading pressure piStar in kg/mol depending on
- * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
- * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
- * activity coefficient of refrigerant in adsorbed phase, equilibrium
- * temperature T in K and molar mass of refrigerant M in kg/mol. The reduced
- * spreading pressure is defined as follows:
- *
- * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
- *		Integral_0^p0{w(p,T) / p * dp}
+ * direct_ads_sur_dp_dw_wTpsat:
+ * ----------------------------
  *
- *	where p0 = p_total*y / (gamma*x)
+ * Calculates derivative of equilibrium pressure p with respect to loading
+ * w in kgPa/kg depending on equilibrium loading w in kg/kg, equilibrium
+ * temperature T in K, and saturation pressure p_sat in Pa.
  *
  * Parameters:
  * -----------
- *	double p_total_Pa:
- *		Total pressure of vapor phase in Pa.
- *	double y_molmol:
- *		Molar fraction of refrigerant in vapor phase in mol/mol.
- *	double x_molmol:
- *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
- *	double gamma:
- *		Activity coefficient of refrigerant in adsorbed phase.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double M_kgmol:
- *		Molar mass of refrigerant M in kg/mol.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4694,51 +12167,59 @@ DLL_API double direct_ads_dp_dT_wT(double w_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Reduced spreading pressure in kg/mol.
+ *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *
+ * Remarks:
+ * --------
+ *	This function is only valid for isotherm models based on the surface
+ *	approach using the saturated vapor pressure as additional argument.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	03/30/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_piStar_pyxgTM(double p_total_Pa,
-	double y_molmol, double x_molmol, double gamma, double T_K, double M_kgmol,
-	const char *path_db, const char *wp_as, const char *wp_st,
+DLL_API double direct_ads_sur_dp_dw_wTpsat(double w_kgkg, double T_K,
+	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_piStar_pyxgTM(p_total_Pa, y_molmol, x_molmol, gamma,
-		T_K, M_kgmol, retWorkingPair);
+	double result = ads_sur_dp_dw_wTpsat(w_kgkg, T_K, p_sat_Pa, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_sur_w_pT:
- * --------------------
+ * direct_ads_sur_dp_dT_wTpsat:
+ * ----------------------------
  *
- * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
- * p in Pa, equilibrium temperature T in K, and specified working pair.
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium loading w in kg/kg, equilibrium
+ * temperature T in K, saturation pressure p_sat in Pa, and derivative of
+ * saturation pressure wrt. temperature dp_sat_dT in Pa/K.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ * 	double dp_sat_dT_PaK:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4766,12 +12247,12 @@ DLL_API double direct_ads_piStar_pyxgTM(double p_total_Pa,
  * Returns:
  * --------
  *	double:
- *		Equilibrium loading in kg/kg.
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
  *
  * Remarks:
  * --------
  *	This function is only valid for isotherm models based on the surface
- *	approach.
+ *	approach using the saturated vapor pressure as additional argument.
  *
  * History:
  * --------
@@ -4779,42 +12260,62 @@ DLL_API double direct_ads_piStar_pyxgTM(double p_total_Pa,
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_w_pT(double p_Pa, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_ads_sur_dp_dT_wTpsat(double w_kgkg, double T_K,
+	double p_sat_Pa, double dp_sat_dT_PaK, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_sur_w_pT(p_Pa, T_K, retWorkingPair);
+	double result = ads_sur_dp_dT_wTpsat(w_kgkg, T_K, p_sat_Pa, dp_sat_dT_PaK,
+		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_sur_p_wT:
- * --------------------
+ * direct_ads_sur_piStar_pyxgTpsatM:
+ * ---------------------------------
+ *
+ * Calculates reduced spreading pressure piStar in kg/mol depending on
+ * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
+ * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
+ * activity coefficient of refrigerant in adsorbed phase, equilibrium
+ * temperature T in K, saturation pressure p_sat in Pa, and molar mass of
+ * refrigerant M in kg/mol. The reduced spreading pressure is defined as
+ * follows:
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium temperature
- * T in K, equilibrium loading w in kg/kg, equilibrium temperature T in K, and
- * specified working pair.
+ * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
+ *		Integral_0^p0{w(p,T) / p * dp}
+ *
+ *	where p0 = p_total*y / (gamma*x)
  *
  * Parameters:
  * -----------
- * 	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double p_total_Pa:
+ *		Total pressure of vapor phase in Pa.
+ *	double y_molmol:
+ *		Molar fraction of refrigerant in vapor phase in mol/mol.
+ *	double x_molmol:
+ *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
+ *	double gamma:
+ *		Activity coefficient of refrigerant in adsorbed phase.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double p_sat_Pa:
+ *		Saturation vapor pressure in Pa.
+ *	double M_kgmol:
+ *		Molar mass of refrigerant M in kg/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4838,17 +12339,16 @@ DLL_API double direct_ads_sur_w_pT(double p_Pa, double T_K,
  *	int no_rhol:
  *		ID of liquid density equation (i.e. when more than one equation is
  *		available)
- *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure in Pa.
+ *		Reduced spreading pressure in kg/mol.
  *
  * Remarks:
  * --------
  *	This function is only valid for isotherm models based on the surface
- *	approach.
+ *	approach using the saturated vapor pressure as additional argument.
  *
  * History:
  * --------
@@ -4856,41 +12356,43 @@ DLL_API double direct_ads_sur_w_pT(double p_Pa, double T_K,
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_p_wT(double w_kgkg, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
+DLL_API double direct_ads_sur_piStar_pyxgTpsatM(double p_total_Pa,
+	double y_molmol, double x_molmol, double gamma, double T_K, double p_sat_Pa,
+	double M_kgmol, const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_sur_p_wT(w_kgkg, T_K, retWorkingPair);
+	double result = ads_sur_piStar_pyxgTpsatM(p_total_Pa, y_molmol, x_molmol,
+		gamma, T_K, p_sat_Pa, M_kgmol, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_sur_T_pw:
- * --------------------
+ * direct_ads_vol_W_ARho:
+ * ----------------------
  *
- * Calculates equilibrium temperature in K depending on equilibrium pressure p
- * in Pa, equilibrium loading w in kg/kg, and specified working pair.
+ * Calculates equilibrium volumetric loading W in m³/kg depending on equilibrium
+ * adsorption potential A in J/mol and saturated liquid density of adsorpt rho_l
+ * in kg/m3.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ * 	double A_Jmol:
+ *		Equilibrium adsorption potential A in J/mol.
+ * 	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4914,60 +12416,62 @@ DLL_API double direct_ads_sur_p_wT(double w_kgkg, double T_K,
  *	int no_rhol:
  *		ID of liquid density equation (i.e. when more than one equation is
  *		available)
- *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium temperature in K.
+ *	double:
+ *		Equilibrium volumetric loading W in m³/kg.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
+ *	This function is only valid for isotherm models based on the volumetric
  *	approach.
+ *	Saturated liquid density of adsorpt is required to calculate volumetric
+ *	loading from characteristic curve in m3/kg when coefficients would directly
+ *	return loading w in kg/kg. Therefore, function checks unit of coefficients
+ *	by checking isotherm coefficients.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_T_pw(double p_Pa, double w_kgkg,
+DLL_API double direct_ads_vol_W_ARho(double A_Jmol, double rho_l_kgm3,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_sur_T_pw(p_Pa, w_kgkg, retWorkingPair);
+	double result = ads_vol_W_ARho(A_Jmol, rho_l_kgm3, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_sur_dw_dp_pT:
- * ------------------------
+ * direct_ads_vol_A_WRho:
+ * ----------------------
  *
- * Calculates derivative of equilibrium loading w with respect to pressure
- * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Calculates equilibrium adsorption potential A in J/mol depending on
+ * equilibrium volumetric loading W in m³/kg and saturated liquid density of
+ * adsorpt rho_l in kg/m3.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
+ * 	double W_m3kg:
+ *		Equilibrium volumetric loading W in m³/kg.
+ * 	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
  *
  *	const char *path_db:
  *		Path to database.
@@ -4995,48 +12499,50 @@ DLL_API double direct_ads_sur_T_pw(double p_Pa, double w_kgkg,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *		Equilibrium adsorption potential A in J/mol.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
+ *	This function is only valid for isotherm models based on the volumetric
  *	approach.
+ *	Saturated liquid density of adsorpt is required to calculate volumetric
+ *	loading from characteristic curve in m3/kg when coefficients would directly
+ *	return loading w in kg/kg.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_dw_dp_pT(double p_Pa, double T_K,
+DLL_API double direct_ads_vol_A_WRho(double W_m3kg, double rho_l_kgm3,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_sur_dw_dp_pT(p_Pa, T_K, retWorkingPair);
+	double result = ads_vol_A_WRho(W_m3kg, rho_l_kgm3, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_sur_dw_dT_pT:
- * ------------------------
+ * direct_ads_vol_w_pTpsatRho:
+ * ---------------------------
  *
- * Calculates derivative of equilibrium loading w with respect to temperature
- * T in kg/kg/K depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
+ * p in Pa, equilibrium temperature T in K, saturation pressure p_Sat in Pa and
+ * saturated liquid density of adsorpt rho in kg/m³.
  *
  * Parameters:
  * -----------
@@ -5044,6 +12550,10 @@ DLL_API double direct_ads_sur_dw_dp_pT(double p_Pa, double T_K,
  *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt in kg/m³.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5071,55 +12581,59 @@ DLL_API double direct_ads_sur_dw_dp_pT(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *		Equilibrium loading in kg/kg.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
+ *	This function is only valid for isotherm models based on the volumetric
  *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_dw_dT_pT(double p_Pa, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_ads_vol_w_pTpsatRho(double p_Pa, double T_K,
+	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_sur_dw_dT_pT(p_Pa, T_K, retWorkingPair);
+	double result = ads_vol_w_pTpsatRho(p_Pa, T_K, p_sat_Pa, rho_kgm3,
+		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_sur_dp_dw_wT:
- * ------------------------
+ * direct_ads_vol_p_wTpsatRho:
+ * ---------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to loading
- * w in kgPa/kg depending on equilibrium loading w in kg/kg and equilibrium
- * temperature T in K.
+ * Calculates equilibrium pressure p in Pa depending on equilibrium loading w in
+ * kg/kg, equilibrium temperature T in K, saturation pressure p_Sat in Pa and
+ * density of adsorpt rho in kg/m³.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
+ * 	double w_kgkg:
  *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5147,55 +12661,59 @@ DLL_API double direct_ads_sur_dw_dT_pT(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *		Equilibrium pressure in Pa.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
+ *	This function is only valid for isotherm models based on the volumetric
  *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_dp_dw_wT(double w_kgkg, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_ads_vol_p_wTpsatRho(double w_kgkg, double T_K,
+	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_sur_dp_dw_wT(w_kgkg, T_K, retWorkingPair);
+	double result = ads_vol_p_wTpsatRho(w_kgkg, T_K, p_sat_Pa, rho_kgm3,
+		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_sur_dp_dT_wT:
- * ------------------------
+ * direct_ads_vol_T_pwpsatRho:
+ * ---------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium loading w in kg/kg and equilibrium
- * temperature T in K.
+ * Calculates equilibrium temperature T in K depending on equilibrium pressure
+ * in Pa, equilibrium loading w in kg/kg, saturation pressure p_Sat in Pa and
+ * density of adsorpt rho in kg/m³.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ * 	double w_kgkg:
  *		Equilibrium loading in kg/kg.
- *	double T_K:
- *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5223,71 +12741,62 @@ DLL_API double direct_ads_sur_dp_dw_wT(double w_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *		Equilibrium temperature in K.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
+ *	This function is only valid for isotherm models based on the volumetric
  *	approach.
+ *	Uses internal equation of states to calculate vapor pressure, saturated
+ *	liquid density of adsorpt, derivative of vapor pressure wrt. temperature
+ *	and derivative of saturated liquid density of adsorpt wrt. temperature. If
+ *	equation of states are not implemented for refrigerant, function returns -1
+ *  and throws warning. If user want to use his own equation of states, this
+ *  function cannot be used and determination of root to calculate T must
+ *  be implemented by user.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_dp_dT_wT(double w_kgkg, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_ads_vol_T_pwpsatRho(double p_Pa, double w_kgkg,
+	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_sur_dp_dT_wT(w_kgkg, T_K, retWorkingPair);
+	double result = ads_vol_T_pwpsatRho(p_Pa, w_kgkg, p_sat_Pa, rho_kgm3,
+		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_sur_piStar_pyxgTM:
- * -----------------------------
- *
- * Calculates reduced spreading pressure piStar in kg/mol depending on
- * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
- * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
- * activity coefficient of refrigerant in adsorbed phase, equilibrium
- * temperature T in K and molar mass of refrigerant M in kg/mol. The reduced
- * spreading pressure is defined as follows:
- *
- * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
- *		Integral_0^p0{w(p,T) / p * dp}
+ * direct_ads_vol_dW_dA_ARho:
+ * --------------------------
  *
- *	where p0 = p_total*y / (gamma*x)
+ * Calculates derivative of equilibrium volumetric loading dW_dA in m³mol/kg/J
+ * depending on equilibrium adsorption potential A in J/mol and saturated liquid
+ * density of adsorpt rho_l in kg/m3.
  *
  * Parameters:
  * -----------
- *	double p_total_Pa:
- *		Total pressure of vapor phase in Pa.
- *	double y_molmol:
- *		Molar fraction of refrigerant in vapor phase in mol/mol.
- *	double x_molmol:
- *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
- *	double gamma:
- *		Activity coefficient of refrigerant in adsorbed phase.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double M_kgmol:
- *		Molar mass of refrigerant M in kg/mol.
+ * 	double A_Jmol:
+ *		Equilibrium adsorption potential A in J/mol.
+ * 	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5315,58 +12824,58 @@ DLL_API double direct_ads_sur_dp_dT_wT(double w_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Reduced spreading pressure in kg/mol.
+ *		Derivative of volumetric loading wrt. adsorption potential in
+ *		m³mol/kg/J.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
+ *	This function is only valid for isotherm models based on the volumetric
  *	approach.
+ *	Saturated liquid density of adsorpt is required to calculate volumetric
+ *	loading from characteristic curve in m3/kg when coefficients would directly
+ *	return loading w in kg/kg.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_piStar_pyxgTM(double p_total_Pa,
-	double y_molmol, double x_molmol, double gamma, double T_K, double M_kgmol,
+DLL_API double direct_ads_vol_dW_dA_ARho(double A_Jmol, double rho_l_kgm3,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_sur_piStar_pyxgTM(p_total_Pa, y_molmol, x_molmol, gamma,
-		T_K, M_kgmol, retWorkingPair);
+	double result = ads_vol_dW_dA_ARho(A_Jmol, rho_l_kgm3, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_sur_w_pTpsat:
- * ------------------------
+ * direct_ads_vol_dA_dW_WRho:
+ * --------------------------
  *
- * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
- * p in Pa, equilibrium temperature T in K, and saturation pressure p_sat in Pa.
+ * Calculates derivative of equilibrium adsorption potential dA_dW in kgJ/mol/m³
+ * depending on equilibrium volumetric loading W in m³/kg and saturated liquid
+ * density of adsorpt rho_l in kg/m3.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ * 	double W_m3kg:
+ *		Equilibrium volumetric loading W in m³/kg.
+ * 	double rho_l_kgm3:
+ *		Saturated liquid density of adsorpt rho_l in kg/m3.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5394,57 +12903,63 @@ DLL_API double direct_ads_sur_piStar_pyxgTM(double p_total_Pa,
  * Returns:
  * --------
  *	double:
- *		Equilibrium loading in kg/kg.
+ *		Derivative of adsorption potential wrt. volumetric loading in
+ *		kgJ/mol/m³.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
+ *	Saturated liquid density of adsorpt is required to calculate volumetric
+ *	loading from characteristic curve in m3/kg when coefficients would directly
+ *	return loading w in kg/kg.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_w_pTpsat(double p_Pa, double T_K,
-	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
+DLL_API double direct_ads_vol_dA_dW_WRho(double W_m3kg, double rho_l_kgm3,
+	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_sur_w_pTpsat(p_Pa, T_K, p_sat_Pa, retWorkingPair);
+	double result = ads_vol_dA_dW_WRho(W_m3kg, rho_l_kgm3, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_sur_p_wTpsat:
- * ------------------------
+ * direct_ads_vol_dw_dp_pTpsatRho:
+ * -------------------------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium loading w
- * in kg/kg, equilibrium temperature T in K, and saturation pressure p_sat in
- * Pa.
+ * Calculates derivative of equilibrium loading dw_dp with respect to pressure
+ * in kg/kg/Pa depending on equilibrium pressure p in Pa, equilibrium
+ * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
+ * rho in kg/m³.
  *
  * Parameters:
  * -----------
- * 	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5468,61 +12983,70 @@ DLL_API double direct_ads_sur_w_pTpsat(double p_Pa, double T_K,
  *	int no_rhol:
  *		ID of liquid density equation (i.e. when more than one equation is
  *		available)
- *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure in Pa.
+ *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_p_wTpsat(double w_kgkg, double T_K,
-	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_ads_vol_dw_dp_pTpsatRho(double p_Pa, double T_K,
+	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_sur_p_wTpsat(w_kgkg, T_K, p_sat_Pa, retWorkingPair);
+	double result = ads_vol_dw_dp_pTpsatRho(p_Pa, T_K, p_sat_Pa, rho_kgm3,
+		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_sur_T_pwpsat:
- * ------------------------
+ * direct_ads_vol_dw_dT_pTpsatRho:
+ * -------------------------------
  *
- * Calculates equilibrium temperature in K depending on equilibrium pressure p
- * in Pa, equilibrium loading w in kg/kg, and saturation pressure p_sat in Pa.
+ * Calculates derivative of equilibrium loading dw_dp with respect to
+ * temperature in kg/kg/K depending on equilibrium pressure p in Pa, equilibrium
+ * temperature T in K, saturation pressure p_Sat in Pa, density of adsorpt
+ * rho in kg/m³, derivative of saturation pressure with respect to temperature
+ * dp_sat_dT in Pa/K and derivative of density of adsorpt with respect to
+ * temperature drho_dT in kg/m³/K.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
+ * 	double p_Pa:
  *		Equilibrium pressure in Pa.
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ * 	double dp_sat_dT_PaK:
+ *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ *	double drho_dT_kgm3K:
+ *		Derivative of density of adsorpt wrt. temperature in kg/m³/K.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5546,67 +13070,65 @@ DLL_API double direct_ads_sur_p_wTpsat(double w_kgkg, double T_K,
  *	int no_rhol:
  *		ID of liquid density equation (i.e. when more than one equation is
  *		available)
- *		Name of calculation approach for liquid density.
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium temperature in K.
+ *	double:
+ *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
- *	Uses internal equation of states to calculate vapor pressure and derivative
- *	of vapor pressure wrt. temperature. If equation of state is not implemented
- *	for refrigerant, function returns -1 and throws warning. If user want to use
- *	his own equation of state, this function cannot be used and determination of
- *	root to calculate T must be implemented by user.
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_T_pwpsat(double p_Pa, double w_kgkg,
-	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_ads_vol_dw_dT_pTpsatRho(double p_Pa, double T_K,
+	double p_sat_Pa, double rho_kgm3, double dp_sat_dT_PaK,
+	double drho_dT_kgm3K, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_sur_T_pwpsat(p_Pa, w_kgkg, p_sat_Pa, retWorkingPair);
+	double result = ads_vol_dw_dT_pTpsatRho(p_Pa, T_K, p_sat_Pa, rho_kgm3,
+		dp_sat_dT_PaK, drho_dT_kgm3K, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_sur_dw_dp_pTpsat:
- * ----------------------------
+ * direct_ads_vol_dp_dw_wTpsatRho:
+ * -------------------------------
  *
- * Calculates derivative of equilibrium loading w with respect to pressure
- * p in kg/kg/Pa depending on equilibrium pressure p in Pa, equilibrium
- * temperature T in K, and saturation pressure p_sat in Pa.
+ * Calculates derivative of equilibrium pressure p with respect to loading
+ * w in kgPa/kg depending on equilibrium loading w in kg/kg, equilibrium
+ * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
+ * rho in kg/m³.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5634,61 +13156,66 @@ DLL_API double direct_ads_sur_T_pwpsat(double p_Pa, double w_kgkg,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
+ *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_dw_dp_pTpsat(double p_Pa, double T_K,
-	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_ads_vol_dp_dw_wTpsatRho(double w_kgkg, double T_K,
+	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_sur_dw_dp_pTpsat(p_Pa, T_K, p_sat_Pa, retWorkingPair);
+	double result = ads_vol_dp_dw_wTpsatRho(w_kgkg, T_K, p_sat_Pa, rho_kgm3,
+		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_sur_dw_dT_pTpsat:
- * ----------------------------
- *
- * Calculates derivative of equilibrium loading w with respect to temperature
- * T in kg/kg/K depending on equilibrium pressure p in Pa, equilibrium
- * temperature T in K, saturation pressure p_sat in Pa, and derivative of
- * saturation pressure wrt. temperature dp_sat_dT in Pa/K.
+ * direct_ads_vol_dp_dT_wTpsatRho:
+ * -------------------------------
  *
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium loading w in kg/kg, equilibrium
+ * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
+ * rho in kg/m³, derivative of saturation pressure with respect to temperature
+ * dp_sat_dT in Pa/K and derivative of density of adsorpt with respect to
+ * temperature drho_dT in kg/m³/K.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ *	double w_kgkg:
+ *		Equilibrium loading in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
  * 	double dp_sat_dT_PaK:
  *		Derivative of saturation pressure wrt. temperature in Pa/K.
+ *	double drho_dT_kgm3K:
+ *		Derivative of density of adsorpt wrt. temperature in kg/m³/K.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5716,59 +13243,77 @@ DLL_API double direct_ads_sur_dw_dp_pTpsat(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_dw_dT_pTpsat(double p_Pa, double T_K,
-	double p_sat_Pa, double dp_sat_dT_PaK, const char *path_db,
-	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
-	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
-	int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_ads_vol_dp_dT_wTpsatRho(double w_kgkg, double T_K,
+	double p_sat_Pa, double rho_kgm3, double dp_sat_dT_PaK,
+	double drho_dT_kgm3K, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_sur_dw_dT_pTpsat(p_Pa, T_K, p_sat_Pa, dp_sat_dT_PaK,
-		retWorkingPair);
+	double result = ads_vol_dp_dT_wTpsatRho(w_kgkg, T_K, p_sat_Pa, rho_kgm3,
+		dp_sat_dT_PaK, drho_dT_kgm3K, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_sur_dp_dw_wTpsat:
- * ----------------------------
+ * direct_ads_vol_piStar_pyxgTpsatRhoM:
+ * ------------------------------------
+ *
+ * Calculates reduced spreading pressure in kg/mol depending on equilibrium
+ * pressure p in Pa, molar fraction of refrigerant in vapor phase in mol/mol,
+ * molar fraction of refrigerant in adsorbed phase in mol/mol, activity
+ * coefficient of refrigerant in adsorbed phase, equilibrium temperature T in K,
+ * saturation pressure p_Sat in Pa and density of adsorpt rho in kg/m³ and molar
+ * mass of refrigerant M in kg/mol. The reduced spreading pressure is defined as
+ * follows:
+ *
+ * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
+ *		Integral_0^p0{w(p,T) / p * dp}
  *
- * Calculates derivative of equilibrium pressure p with respect to loading
- * w in kgPa/kg depending on equilibrium loading w in kg/kg, equilibrium
- * temperature T in K, and saturation pressure p_sat in Pa.
+ *	where p0 = p_total*y / (gamma*x)
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double p_total_Pa:
+ *		Total pressure of vapor phase in Pa.
+ *	double y_molmol:
+ *		Molar fraction of refrigerant in vapor phase in mol/mol.
+ *	double x_molmol:
+ *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
+ *	double gamma:
+ *		Activity coefficient of refrigerant in adsorbed phase.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
+ * 	double p_sat_Pa:
+ *		Saturation pressure in Pa.
+ *	double rho_kgm3:
+ *		Density of adsorpt in kg/m³.
+ *	double M_kgmol:
+ *		Molar mass of refrigerant M in kg/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5796,60 +13341,58 @@ DLL_API double direct_ads_sur_dw_dT_pTpsat(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *		Reduced spreading pressure in kg/mol.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	This function is only valid for isotherm models based on the volumetric
+ *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_dp_dw_wTpsat(double w_kgkg, double T_K,
-	double p_sat_Pa, const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_ads_vol_piStar_pyxgTpsatRhoM(double p_total_Pa,
+	double y_molmol, double x_molmol, double gamma, double T_K, double p_sat_Pa,
+	double rho_kgm3, double M_kgmol, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_sur_dp_dw_wTpsat(w_kgkg, T_K, p_sat_Pa, retWorkingPair);
+	double result = ads_vol_piStar_pyxgTpsatRhoM(p_total_Pa, y_molmol, x_molmol,
+		gamma, T_K, p_sat_Pa, rho_kgm3, M_kgmol, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
+/////////////////////////////////////////////////////////////////////////////
+// Definition of function prototypes regarding absorption working wo struct//
+/////////////////////////////////////////////////////////////////////////////
 /*
- * direct_ads_sur_dp_dT_wTpsat:
- * ----------------------------
+ * direct_abs_con_X_pT:
+ * --------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium loading w in kg/kg, equilibrium
- * temperature T in K, saturation pressure p_sat in Pa, and derivative of
- * saturation pressure wrt. temperature dp_sat_dT in Pa/K.
+ * Calculates equilibrium concentration X in kg/kg depending on equilibrium
+ * pressure p in Pa and equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
- * 	double dp_sat_dT_PaK:
- *		Derivative of saturation pressure wrt. temperature in Pa/K.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5877,76 +13420,53 @@ DLL_API double direct_ads_sur_dp_dw_wTpsat(double w_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *		Equilibrium concentration in kg/kg.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_dp_dT_wTpsat(double w_kgkg, double T_K,
-	double p_sat_Pa, double dp_sat_dT_PaK, const char *path_db,
-	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
-	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
-	int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_con_X_pT(double p_Pa, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_sur_dp_dT_wTpsat(w_kgkg, T_K, p_sat_Pa, dp_sat_dT_PaK,
-		retWorkingPair);
+	double result = abs_con_X_pT(p_Pa, T_K, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_sur_piStar_pyxgTpsatM:
- * ---------------------------------
- *
- * Calculates reduced spreading pressure piStar in kg/mol depending on
- * equilibrium pressure p in Pa, molar fraction of refrigerant in vapor phase
- * in mol/mol, molar fraction of refrigerant in adsorbed phase in mol/mol,
- * activity coefficient of refrigerant in adsorbed phase, equilibrium
- * temperature T in K, saturation pressure p_sat in Pa, and molar mass of
- * refrigerant M in kg/mol. The reduced spreading pressure is defined as
- * follows:
- *
- * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
- *		Integral_0^p0{w(p,T) / p * dp}
+ * direct_abs_con_p_XT:
+ * --------------------
  *
- *	where p0 = p_total*y / (gamma*x)
+ * Calculates equilibrium pressure p in Pa depending on equilibrium
+ * concentration X in kg/kg and equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
- *	double p_total_Pa:
- *		Total pressure of vapor phase in Pa.
- *	double y_molmol:
- *		Molar fraction of refrigerant in vapor phase in mol/mol.
- *	double x_molmol:
- *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
- *	double gamma:
- *		Activity coefficient of refrigerant in adsorbed phase.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double p_sat_Pa:
- *		Saturation vapor pressure in Pa.
- *	double M_kgmol:
- *		Molar mass of refrigerant M in kg/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -5973,58 +13493,54 @@ DLL_API double direct_ads_sur_dp_dT_wTpsat(double w_kgkg, double T_K,
  *
  * Returns:
  * --------
- *	double:
- *		Reduced spreading pressure in kg/mol.
+ * 	double:
+ *		Equilibrium pressure in Pa.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the surface
- *	approach using the saturated vapor pressure as additional argument.
+ *	This function is only valid for isotherm models based on the conventional
+ *	approach.
  *
  * History:
  * --------
- *	03/30/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_sur_piStar_pyxgTpsatM(double p_total_Pa,
-	double y_molmol, double x_molmol, double gamma, double T_K, double p_sat_Pa,
-	double M_kgmol, const char *path_db, const char *wp_as, const char *wp_st,
+DLL_API double direct_abs_con_p_XT(double X_kgkg, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_sur_piStar_pyxgTpsatM(p_total_Pa, y_molmol, x_molmol,
-		gamma, T_K, p_sat_Pa, M_kgmol, retWorkingPair);
+	double result = abs_con_p_XT(X_kgkg, T_K, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_vol_W_ARho:
- * ----------------------
+ * direct_abs_con_T_pX:
+ * --------------------
  *
- * Calculates equilibrium volumetric loading W in m³/kg depending on equilibrium
- * adsorption potential A in J/mol and saturated liquid density of adsorpt rho_l
- * in kg/m3.
+ * Calculates equilibrium temperature in K depending on equilibrium pressure p
+ * in Pa and equilibrium concentration X in kg/kg.
  *
  * Parameters:
  * -----------
- * 	double A_Jmol:
- *		Equilibrium adsorption potential A in J/mol.
- * 	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
  *
  *	const char *path_db:
  *		Path to database.
@@ -6051,17 +13567,13 @@ DLL_API double direct_ads_sur_piStar_pyxgTpsatM(double p_total_Pa,
  *
  * Returns:
  * --------
- *	double:
- *		Equilibrium volumetric loading W in m³/kg.
+ * 	double:
+ *		Equilibrium temperature in K.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
+ *	This function is only valid for isotherm models based on the conventional
  *	approach.
- *	Saturated liquid density of adsorpt is required to calculate volumetric
- *	loading from characteristic curve in m3/kg when coefficients would directly
- *	return loading w in kg/kg. Therefore, function checks unit of coefficients
- *	by checking isotherm coefficients.
  *
  * History:
  * --------
@@ -6069,42 +13581,41 @@ DLL_API double direct_ads_sur_piStar_pyxgTpsatM(double p_total_Pa,
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_W_ARho(double A_Jmol, double rho_l_kgm3,
+DLL_API double direct_abs_con_T_pX(double p_Pa, double X_kgkg,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_vol_W_ARho(A_Jmol, rho_l_kgm3, retWorkingPair);
+	double result = abs_con_T_pX(p_Pa, X_kgkg, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_vol_A_WRho:
- * ----------------------
+ * direct_abs_con_dX_dp_pT:
+ * ------------------------
  *
- * Calculates equilibrium adsorption potential A in J/mol depending on
- * equilibrium volumetric loading W in m³/kg and saturated liquid density of
- * adsorpt rho_l in kg/m3.
+ * Calculates derivative of equilibrium concentration X with respect to pressure
+ * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
- * 	double W_m3kg:
- *		Equilibrium volumetric loading W in m³/kg.
- * 	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ * 	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
  *
  *	const char *path_db:
  *		Path to database.
@@ -6132,15 +13643,12 @@ DLL_API double direct_ads_vol_W_ARho(double A_Jmol, double rho_l_kgm3,
  * Returns:
  * --------
  *	double:
- *		Equilibrium adsorption potential A in J/mol.
+ *		Derivative of equilibrium concentration wrt. pressure in kg/kg/Pa.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
+ *	This function is only valid for isotherm models based on the conventional
  *	approach.
- *	Saturated liquid density of adsorpt is required to calculate volumetric
- *	loading from characteristic curve in m3/kg when coefficients would directly
- *	return loading w in kg/kg.
  *
  * History:
  * --------
@@ -6148,35 +13656,34 @@ DLL_API double direct_ads_vol_W_ARho(double A_Jmol, double rho_l_kgm3,
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_A_WRho(double W_m3kg, double rho_l_kgm3,
+DLL_API double direct_abs_con_dX_dp_pT(double p_Pa, double T_K,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_vol_A_WRho(W_m3kg, rho_l_kgm3, retWorkingPair);
+	double result = abs_con_dX_dp_pT(p_Pa, T_K, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_vol_w_pTpsatRho:
- * ---------------------------
+ * direct_abs_con_dX_dT_pT:
+ * ------------------------
  *
- * Calculates equilibrium loading w in kg/kg depending on equilibrium pressure
- * p in Pa, equilibrium temperature T in K, saturation pressure p_Sat in Pa and
- * saturated liquid density of adsorpt rho in kg/m³.
+ * Calculates derivative of equilibrium concentration X with respect to
+ * temperature T in kg/kg/K depending on equilibrium pressure p in Pa and
+ * equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
@@ -6184,10 +13691,6 @@ DLL_API double direct_ads_vol_A_WRho(double W_m3kg, double rho_l_kgm3,
  *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt in kg/m³.
  *
  *	const char *path_db:
  *		Path to database.
@@ -6215,11 +13718,11 @@ DLL_API double direct_ads_vol_A_WRho(double W_m3kg, double rho_l_kgm3,
  * Returns:
  * --------
  *	double:
- *		Equilibrium loading in kg/kg.
+ *		Derivative of equilibrium concentration wrt. temperature in kg/kg/K.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
+ *	This function is only valid for isotherm models based on the conventional
  *	approach.
  *
  * History:
@@ -6228,47 +13731,41 @@ DLL_API double direct_ads_vol_A_WRho(double W_m3kg, double rho_l_kgm3,
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_w_pTpsatRho(double p_Pa, double T_K,
-	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
-	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
-	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_con_dX_dT_pT(double p_Pa, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_vol_w_pTpsatRho(p_Pa, T_K, p_sat_Pa, rho_kgm3,
-		retWorkingPair);
+	double result = abs_con_dX_dT_pT(p_Pa, T_K, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_vol_p_wTpsatRho:
- * ---------------------------
+ * direct_abs_con_dp_dX_XT:
+ * ------------------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium loading w in
- * kg/kg, equilibrium temperature T in K, saturation pressure p_Sat in Pa and
- * density of adsorpt rho in kg/m³.
+ * Calculates derivative of equilibrium pressure p with respect to concentration
+ * w in kgPa/kg depending on equilibrium concentration X in kg/kg and
+ * equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
- * 	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
  *
  *	const char *path_db:
  *		Path to database.
@@ -6296,60 +13793,54 @@ DLL_API double direct_ads_vol_w_pTpsatRho(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure in Pa.
+ *		Derivative of equilibrium pressure wrt. concentration in Pakg/kg.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
+ *	This function is only valid for isotherm models based on the conventional
  *	approach.
  *
  * History:
  * --------
  *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
- *
- */
-DLL_API double direct_ads_vol_p_wTpsatRho(double w_kgkg, double T_K,
-	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
-	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
-	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+ *
+ */
+DLL_API double direct_abs_con_dp_dX_XT(double X_kgkg, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_vol_p_wTpsatRho(w_kgkg, T_K, p_sat_Pa, rho_kgm3,
-		retWorkingPair);
+	double result = abs_con_dp_dX_XT(X_kgkg, T_K, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_vol_T_pwpsatRho:
- * ---------------------------
+ * direct_abs_con_dp_dT_XT:
+ * ------------------------
  *
- * Calculates equilibrium temperature T in K depending on equilibrium pressure
- * in Pa, equilibrium loading w in kg/kg, saturation pressure p_Sat in Pa and
- * density of adsorpt rho in kg/m³.
+ * Calculates derivative of equilibrium pressure p with respect to temperature
+ * T in kg/kg/K depending on equilibrium concentration X in kg/kg and
+ * equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure in Pa.
- * 	double w_kgkg:
- *		Equilibrium loading in kg/kg.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
  *
  *	const char *path_db:
  *		Path to database.
@@ -6377,19 +13868,12 @@ DLL_API double direct_ads_vol_p_wTpsatRho(double w_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Equilibrium temperature in K.
+ *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
+ *	This function is only valid for isotherm models based on the conventional
  *	approach.
- *	Uses internal equation of states to calculate vapor pressure, saturated
- *	liquid density of adsorpt, derivative of vapor pressure wrt. temperature
- *	and derivative of saturated liquid density of adsorpt wrt. temperature. If
- *	equation of states are not implemented for refrigerant, function returns -1
- *  and throws warning. If user want to use his own equation of states, this
- *  function cannot be used and determination of root to calculate T must
- *  be implemented by user.
  *
  * History:
  * --------
@@ -6397,43 +13881,47 @@ DLL_API double direct_ads_vol_p_wTpsatRho(double w_kgkg, double T_K,
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_T_pwpsatRho(double p_Pa, double w_kgkg,
-	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
-	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
-	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_con_dp_dT_XT(double X_kgkg, double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_vol_T_pwpsatRho(p_Pa, w_kgkg, p_sat_Pa, rho_kgm3,
-		retWorkingPair);
+	double result = abs_con_dp_dT_XT(X_kgkg, T_K, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_vol_dW_dA_ARho:
- * --------------------------
+ * direct_abs_con_X_pT_der:
+ * ------------------------
  *
- * Calculates derivative of equilibrium volumetric loading dW_dA in m³mol/kg/J
- * depending on equilibrium adsorption potential A in J/mol and saturated liquid
- * density of adsorpt rho_l in kg/m3.
+ * Calculates total derivative of equilibrium concentration X in kg/kg/s
+ * depending on equilibrium pressure p in Pa, equilibrium temperature T in K,
+ * and their derivatives by the analytical partial derivatives of the isotherm.
+ * Thus, the derivative can be used for derivative annotations of
+ * DirectFunctionCalls of Modelica.
  *
  * Parameters:
  * -----------
- * 	double A_Jmol:
- *		Equilibrium adsorption potential A in J/mol.
- * 	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -6461,59 +13949,56 @@ DLL_API double direct_ads_vol_T_pwpsatRho(double p_Pa, double w_kgkg,
  * Returns:
  * --------
  *	double:
- *		Derivative of volumetric loading wrt. adsorption potential in
- *		m³mol/kg/J.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
- *	Saturated liquid density of adsorpt is required to calculate volumetric
- *	loading from characteristic curve in m3/kg when coefficients would directly
- *	return loading w in kg/kg.
+ *		Derivative of equilibrium concentration in kg/kg/s.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_dW_dA_ARho(double A_Jmol, double rho_l_kgm3,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_con_X_pT_der(double p_Pa, double T_K,
+	double p_der_Pas, double T_der_Ks, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_vol_dW_dA_ARho(A_Jmol, rho_l_kgm3, retWorkingPair);
+	double result = abs_con_X_pT_der(p_Pa, T_K, p_der_Pas, T_der_Ks,
+		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_vol_dA_dW_WRho:
- * --------------------------
+ * direct_abs_con_p_XT_der:
+ * ------------------------
  *
- * Calculates derivative of equilibrium adsorption potential dA_dW in kgJ/mol/m³
- * depending on equilibrium volumetric loading W in m³/kg and saturated liquid
- * density of adsorpt rho_l in kg/m3.
+ * Calculates total derivative of equilibrium pressure p in Pa/s depending on
+ * equilibrium concentration X in kg/kg, equilibrium temperature T in K, and
+ * their derivatives by the analytical partial derivatives of the isotherm.
+ * Thus, the derivative can be used for derivative annotations of
+ * DirectFunctionCalls of Modelica.
  *
  * Parameters:
  * -----------
- * 	double W_m3kg:
- *		Equilibrium volumetric loading W in m³/kg.
- * 	double rho_l_kgm3:
- *		Saturated liquid density of adsorpt rho_l in kg/m3.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double X_der_kgkgs:
+ *		Derivative of equilibrium concentration in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -6541,64 +14026,56 @@ DLL_API double direct_ads_vol_dW_dA_ARho(double A_Jmol, double rho_l_kgm3,
  * Returns:
  * --------
  *	double:
- *		Derivative of adsorption potential wrt. volumetric loading in
- *		kgJ/mol/m³.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
- *	Saturated liquid density of adsorpt is required to calculate volumetric
- *	loading from characteristic curve in m3/kg when coefficients would directly
- *	return loading w in kg/kg.
+ *		Derivative of equilibrium pressure in Pa/s.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_dA_dW_WRho(double W_m3kg, double rho_l_kgm3,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_con_p_XT_der(double X_kgkg, double T_K,
+	double X_der_kgkgs, double T_der_Ks, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_vol_dA_dW_WRho(W_m3kg, rho_l_kgm3, retWorkingPair);
+	double result = abs_con_p_XT_der(X_kgkg, T_K, X_der_kgkgs, T_der_Ks,
+		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_vol_dw_dp_pTpsatRho:
- * -------------------------------
+ * direct_abs_con_T_pX_der:
+ * ------------------------
  *
- * Calculates derivative of equilibrium loading dw_dp with respect to pressure
- * in kg/kg/Pa depending on equilibrium pressure p in Pa, equilibrium
- * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
- * rho in kg/m³.
+ * Calculates total derivative of equilibrium temperature T in K/s depending on
+ * equilibrium pressure p in Pa, equilibrium concentration X in kg/kg, and their
+ * derivatives by the analytical partial derivatives of the isotherm and the
+ * implicit function theorem. Thus, the derivative can be used for derivative
+ * annotations of DirectFunctionCalls of Modelica.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
+ *	double p_Pa:
  *		Equilibrium pressure in Pa.
- *	double T_K:
- *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double X_der_kgkgs:
+ *		Derivative of equilibrium concentration in kg/kg/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -6626,67 +14103,55 @@ DLL_API double direct_ads_vol_dA_dW_WRho(double W_m3kg, double rho_l_kgm3,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. pressure in kg/kg/Pa.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *		Derivative of equilibrium temperature in K/s.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_dw_dp_pTpsatRho(double p_Pa, double T_K,
-	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
-	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
-	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_con_T_pX_der(double p_Pa, double X_kgkg,
+	double p_der_Pas, double X_der_kgkgs, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_vol_dw_dp_pTpsatRho(p_Pa, T_K, p_sat_Pa, rho_kgm3,
+	double result = abs_con_T_pX_der(p_Pa, X_kgkg, p_der_Pas, X_der_kgkgs,
 		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_vol_dw_dT_pTpsatRho:
- * -------------------------------
+ * direct_abs_con_dX_dp_pT_der:
+ * ----------------------------
  *
- * Calculates derivative of equilibrium loading dw_dp with respect to
- * temperature in kg/kg/K depending on equilibrium pressure p in Pa, equilibrium
- * temperature T in K, saturation pressure p_Sat in Pa, density of adsorpt
- * rho in kg/m³, derivative of saturation pressure with respect to temperature
- * dp_sat_dT in Pa/K and derivative of density of adsorpt with respect to
- * temperature drho_dT in kg/m³/K.
+ * Calculates total derivative of derivative of equilibrium concentration X with
+ * respect to pressure p in kg/kg/Pa/s depending on equilibrium pressure p in
+ * Pa, equilibrium temperature T in K, and their derivatives.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
+ *	double p_Pa:
  *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
- * 	double dp_sat_dT_PaK:
- *		Derivative of saturation pressure wrt. temperature in Pa/K.
- *	double drho_dT_kgm3K:
- *		Derivative of density of adsorpt wrt. temperature in kg/m³/K.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -6714,62 +14179,64 @@ DLL_API double direct_ads_vol_dw_dp_pTpsatRho(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium loading wrt. temperature in kg/kg/K.
+ *		Derivative of derivative of equilibrium concentration wrt. pressure in
+ *		kg/kg/Pa/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_dw_dT_pTpsatRho(double p_Pa, double T_K,
-	double p_sat_Pa, double rho_kgm3, double dp_sat_dT_PaK,
-	double drho_dT_kgm3K, const char *path_db, const char *wp_as,
+DLL_API double direct_abs_con_dX_dp_pT_der(double p_Pa, double T_K,
+	double p_der_Pas, double T_der_Ks, const char *path_db, const char *wp_as,
 	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
 	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_vol_dw_dT_pTpsatRho(p_Pa, T_K, p_sat_Pa, rho_kgm3,
-		dp_sat_dT_PaK, drho_dT_kgm3K, retWorkingPair);
+	double result = abs_con_dX_dp_pT_der(p_Pa, T_K, p_der_Pas, T_der_Ks,
+		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_vol_dp_dw_wTpsatRho:
- * -------------------------------
+ * direct_abs_con_dX_dT_pT_der:
+ * ----------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to loading
- * w in kgPa/kg depending on equilibrium loading w in kg/kg, equilibrium
- * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
- * rho in kg/m³.
+ * Calculates total derivative of derivative of equilibrium concentration X with
+ * respect to temperature T in kg/kg/K/s depending on equilibrium pressure p in
+ * Pa, equilibrium temperature T in K, and their derivatives.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double p_Pa:
+ *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
+ *	double p_der_Pas:
+ *		Derivative of equilibrium pressure in Pa/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -6797,67 +14264,65 @@ DLL_API double direct_ads_vol_dw_dT_pTpsatRho(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. loading in Pakg/kg.
+ *		Derivative of derivative of equilibrium concentration wrt. temperature
+ *		in kg/kg/K/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_dp_dw_wTpsatRho(double w_kgkg, double T_K,
-	double p_sat_Pa, double rho_kgm3, const char *path_db, const char *wp_as,
+DLL_API double direct_abs_con_dX_dT_pT_der(double p_Pa, double T_K,
+	double p_der_Pas, double T_der_Ks, const char *path_db, const char *wp_as,
 	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
 	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_vol_dp_dw_wTpsatRho(w_kgkg, T_K, p_sat_Pa, rho_kgm3,
+	double result = abs_con_dX_dT_pT_der(p_Pa, T_K, p_der_Pas, T_der_Ks,
 		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ads_vol_dp_dT_wTpsatRho:
- * -------------------------------
+ * direct_abs_con_dp_dX_XT_der:
+ * ----------------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium loading w in kg/kg, equilibrium
- * temperature T in K, saturation pressure p_Sat in Pa and density of adsorpt
- * rho in kg/m³, derivative of saturation pressure with respect to temperature
- * dp_sat_dT in Pa/K and derivative of density of adsorpt with respect to
- * temperature drho_dT in kg/m³/K.
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to concentration X in Pa/(kg/kg)/s depending on equilibrium
+ * concentration X in kg/kg, equilibrium temperature T in K, and their
+ * derivatives.
  *
  * Parameters:
  * -----------
- *	double w_kgkg:
- *		Equilibrium loading in kg/kg.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
- * 	double dp_sat_dT_PaK:
- *		Derivative of saturation pressure wrt. temperature in Pa/K.
- *	double drho_dT_kgm3K:
- *		Derivative of density of adsorpt wrt. temperature in kg/m³/K.
+ *	double X_der_kgkgs:
+ *		Derivative of equilibrium concentration in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -6885,78 +14350,64 @@ DLL_API double direct_ads_vol_dp_dw_wTpsatRho(double w_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *		Derivative of derivative of equilibrium pressure wrt. concentration in
+ *		Pa/(kg/kg)/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_dp_dT_wTpsatRho(double w_kgkg, double T_K,
-	double p_sat_Pa, double rho_kgm3, double dp_sat_dT_PaK,
-	double drho_dT_kgm3K, const char *path_db, const char *wp_as,
+DLL_API double direct_abs_con_dp_dX_XT_der(double X_kgkg, double T_K,
+	double X_der_kgkgs, double T_der_Ks, const char *path_db, const char *wp_as,
 	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
 	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_vol_dp_dT_wTpsatRho(w_kgkg, T_K, p_sat_Pa, rho_kgm3,
-		dp_sat_dT_PaK, drho_dT_kgm3K, retWorkingPair);
+	double result = abs_con_dp_dX_XT_der(X_kgkg, T_K, X_der_kgkgs, T_der_Ks,
+		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
-
-/*
- * direct_ads_vol_piStar_pyxgTpsatRhoM:
- * ------------------------------------
- *
- * Calculates reduced spreading pressure in kg/mol depending on equilibrium
- * pressure p in Pa, molar fraction of refrigerant in vapor phase in mol/mol,
- * molar fraction of refrigerant in adsorbed phase in mol/mol, activity
- * coefficient of refrigerant in adsorbed phase, equilibrium temperature T in K,
- * saturation pressure p_Sat in Pa and density of adsorpt rho in kg/m³ and molar
- * mass of refrigerant M in kg/mol. The reduced spreading pressure is defined as
- * follows:
- *
- * 	piStar = A * pi / (R * T * m_sorbent) = 1 / M *
- *		Integral_0^p0{w(p,T) / p * dp}
+
+/*
+ * direct_abs_con_dp_dT_XT_der:
+ * ----------------------------
  *
- *	where p0 = p_total*y / (gamma*x)
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to temperature T in Pa/K/s depending on equilibrium concentration X
+ * in kg/kg, equilibrium temperature T in K, and their derivatives.
  *
  * Parameters:
  * -----------
- *	double p_total_Pa:
- *		Total pressure of vapor phase in Pa.
- *	double y_molmol:
- *		Molar fraction of refrigerant in vapor phase in mol/mol.
- *	double x_molmol:
- *		Molar fraction of refrigerant in adsorbed phase in mol/mol.
- *	double gamma:
- *		Activity coefficient of refrigerant in adsorbed phase.
+ *	double X_kgkg:
+ *		Equilibrium concentration in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
- * 	double p_sat_Pa:
- *		Saturation pressure in Pa.
- *	double rho_kgm3:
- *		Density of adsorpt in kg/m³.
- *	double M_kgmol:
- *		Molar mass of refrigerant M in kg/mol.
+ *	double X_der_kgkgs:
+ *		Derivative of equilibrium concentration in kg/kg/s.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -6984,59 +14435,64 @@ DLL_API double direct_ads_vol_dp_dT_wTpsatRho(double w_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Reduced spreading pressure in kg/mol.
+ *		Derivative of derivative of equilibrium pressure wrt. temperature in
+ *		Pa/K/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the volumetric
- *	approach.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-4
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP) of inputs whose derivatives are not
+ *	zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ads_vol_piStar_pyxgTpsatRhoM(double p_total_Pa,
-	double y_molmol, double x_molmol, double gamma, double T_K, double p_sat_Pa,
-	double rho_kgm3, double M_kgmol, const char *path_db, const char *wp_as,
+DLL_API double direct_abs_con_dp_dT_XT_der(double X_kgkg, double T_K,
+	double X_der_kgkgs, double T_der_Ks, const char *path_db, const char *wp_as,
 	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
 	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ads_vol_piStar_pyxgTpsatRhoM(p_total_Pa, y_molmol, x_molmol,
-		gamma, T_K, p_sat_Pa, rho_kgm3, M_kgmol, retWorkingPair);
+	double result = abs_con_dp_dT_XT_der(X_kgkg, T_K, X_der_kgkgs, T_der_Ks,
+		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
-/////////////////////////////////////////////////////////////////////////////
-// Definition of function prototypes regarding absorption working wo struct//
-/////////////////////////////////////////////////////////////////////////////
 /*
- * direct_abs_con_X_pT:
- * --------------------
+ * direct_abs_act_g_Txv1v2:
+ * ------------------------
  *
- * Calculates equilibrium concentration X in kg/kg depending on equilibrium
- * pressure p in Pa and equilibrium temperature T in K.
+ * Calculates activity coefficient of first component depending on temperature
+ * T_K in K, mole fraction in liquid phase x_molmol in mol/mol, molar volume of
+ * first component in m³/mol, and molar volume of second component in m³/mol.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -7064,12 +14520,16 @@ DLL_API double direct_ads_vol_piStar_pyxgTpsatRhoM(double p_total_Pa,
  * Returns:
  * --------
  *	double:
- *		Equilibrium concentration in kg/kg.
+ *		Activity coefficient of first component.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
  *
  * History:
  * --------
@@ -7077,41 +14537,49 @@ DLL_API double direct_ads_vol_piStar_pyxgTpsatRhoM(double p_total_Pa,
  *		First implementation.
  *
  */
-DLL_API double direct_abs_con_X_pT(double p_Pa, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_act_g_Txv1v2(double T_K, double x_molmol,
+	double v1_m3mol, double v2_m3mol, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = abs_con_X_pT(p_Pa, T_K, retWorkingPair);
+	double result = abs_act_g_Txv1v2(T_K, x_molmol, v1_m3mol, v2_m3mol,
+		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_abs_con_p_XT:
- * --------------------
+ * direct_abs_act_p_Txv1v2psat:
+ * ----------------------------
  *
- * Calculates equilibrium pressure p in Pa depending on equilibrium
- * concentration X in kg/kg and equilibrium temperature T in K.
+ * Calculates equilibrium pressure p_Pa in Pa of first component depending on
+ * temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
+ * molar volume of first component in m³/mol, molar volume of second component
+ * in m³/mol,and saturation pressure of first component p_sat_Pa in Pa.
  *
  * Parameters:
  * -----------
- *	double X_kgkg:
- *		Equilibrium concentration in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -7138,13 +14606,17 @@ DLL_API double direct_abs_con_X_pT(double p_Pa, double T_K,
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium pressure in Pa.
+ *	double:
+ *		Equilibrium pressure p_Pa in Pa.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
  *
  * History:
  * --------
@@ -7152,41 +14624,51 @@ DLL_API double direct_abs_con_X_pT(double p_Pa, double T_K,
  *		First implementation.
  *
  */
-DLL_API double direct_abs_con_p_XT(double X_kgkg, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_act_p_Txv1v2psat(double T_K, double x_molmol,
+	double v1_m3mol, double v2_m3mol, double p_sat_Pa, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = abs_con_p_XT(X_kgkg, T_K, retWorkingPair);
+	double result = abs_act_p_Txv1v2psat(T_K, x_molmol, v1_m3mol, v2_m3mol,
+		p_sat_Pa, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_abs_con_T_pX:
- * --------------------
+ * direct_abs_act_x_pTv1v2psat:
+ * ----------------------------
  *
- * Calculates equilibrium temperature in K depending on equilibrium pressure p
- * in Pa and equilibrium concentration X in kg/kg.
+ * Calculates mole fraction of first component in liquid phase x_molmol in
+ * mol/mol depending on equilibrium pressure p_Pa in Pa of first component,
+ * temperature T_K in K, molar volume of first component in m³/mol, molar volume
+ * of second component in m³/mol and saturation pressure of first component
+ * p_sat_Pa in Pa
  *
  * Parameters:
  * -----------
  *	double p_Pa:
- *		Equilibrium pressure in Pa.
- *	double X_kgkg:
- *		Equilibrium concentration in kg/kg.
+ *		Equilibrium pressure p_Pa in Pa.
+ *	double T_K:
+ *		Equilibrium temperature in K.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
+ *	double p_sat_Pa:
+ *		Saturation pressure of first component in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -7213,56 +14695,66 @@ DLL_API double direct_abs_con_p_XT(double X_kgkg, double T_K,
  *
  * Returns:
  * --------
- * 	double:
- *		Equilibrium temperature in K.
+ *	double:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	30/03/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_con_T_pX(double p_Pa, double X_kgkg,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_act_x_pTv1v2psat(double p_Pa, double T_K,
+	double v1_m3mol, double v2_m3mol, double p_sat_Pa, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = abs_con_T_pX(p_Pa, X_kgkg, retWorkingPair);
+	double result = abs_act_x_pTv1v2psat(p_Pa, T_K, v1_m3mol, v2_m3mol,
+		p_sat_Pa, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_abs_con_dX_dp_pT:
+ * direct_abs_act_p_Txv1v2:
  * ------------------------
  *
- * Calculates derivative of equilibrium concentration X with respect to pressure
- * p in kg/kg/Pa depending on equilibrium pressure p in Pa and equilibrium
- * temperature T in K.
+ * Calculates equilibrium pressure p_Pa in Pa of first component depending on
+ * temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
+ * molar volume of first component in m³/mol and molar volume of second
+ * component in m³/mol.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double x_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -7290,12 +14782,16 @@ DLL_API double direct_abs_con_T_pX(double p_Pa, double X_kgkg,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium concentration wrt. pressure in kg/kg/Pa.
+ *		Equilibrium pressure p_Pa in Pa.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
  *
  * History:
  * --------
@@ -7303,42 +14799,47 @@ DLL_API double direct_abs_con_T_pX(double p_Pa, double X_kgkg,
  *		First implementation.
  *
  */
-DLL_API double direct_abs_con_dX_dp_pT(double p_Pa, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_act_p_Txv1v2(double T_K, double x_molmol,
+	double v1_m3mol, double v2_m3mol, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = abs_con_dX_dp_pT(p_Pa, T_K, retWorkingPair);
+	double result = abs_act_p_Txv1v2(T_K, x_molmol, v1_m3mol, v2_m3mol,
+		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_abs_con_dX_dT_pT:
+ * direct_abs_act_x_pTv1v2:
  * ------------------------
  *
- * Calculates derivative of equilibrium concentration X with respect to
- * temperature T in kg/kg/K depending on equilibrium pressure p in Pa and
- * equilibrium temperature T in K.
+ * Calculates mole fraction of first component in liquid phase x_molmol in
+ * mol/mol depending on equilibrium pressure p_Pa in Pa of first component,
+ * temperature T_K in K, molar volume of first component in m³/mol and molar
+ * volume of second component in m³/mol.
  *
  * Parameters:
  * -----------
- * 	double p_Pa:
- *		Equilibrium pressure in Pa.
+ *	double p_Pa:
+ *		Equilibrium pressure p_Pa in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double v1_m3mol:
+ *		Equilibrium molar volume of first component in m³/mol.
+ *	double v2_m3mol:
+ *		Equilibrium molar volume of second component in m³/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -7366,53 +14867,56 @@ DLL_API double direct_abs_con_dX_dp_pT(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium concentration wrt. temperature in kg/kg/K.
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	This function is only valid for isotherm models based on activity
+ *	coefficients.
+ *	Molar volumes may are not required and ignored. When molar volumes are
+ * 	required, function uses molar volumes stored in JSON file when input
+ *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
+ *	inputs.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	30/03/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_con_dX_dT_pT(double p_Pa, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_act_x_pTv1v2(double p_Pa, double T_K,
+	double v1_m3mol, double v2_m3mol, const char *path_db, const char *wp_as,
+	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = abs_con_dX_dT_pT(p_Pa, T_K, retWorkingPair);
+	double result = abs_act_x_pTv1v2(p_Pa, T_K, v1_m3mol, v2_m3mol,
+		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_abs_con_dp_dX_XT:
- * ------------------------
- *
- * Calculates derivative of equilibrium pressure p with respect to concentration
- * w in kgPa/kg depending on equilibrium concentration X in kg/kg and
- * equilibrium temperature T in K.
+ * direct_abs_mix_x_pT:
+ * --------------------
+ *
+ * Calculates equilibrium liquid mole fraction of first component in mol/mol
+ * depending on pressure in Pa and temperature T_K in K.
  *
  * Parameters:
  * -----------
- *	double X_kgkg:
- *		Equilibrium concentration in kg/kg.
+ *	double p_Pa:
+ *		Equilibrium pressure p_Pa in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
  *
@@ -7442,55 +14946,58 @@ DLL_API double direct_abs_con_dX_dT_pT(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. concentration in Pakg/kg.
+ *		Equilibrium mole fraction in of first component liquid phase in mol/mol.
+ *	double *ret_y_1_molmol:
+ *		Equilibrium mole fraction of first component.
+ *	double *ret_y_2_molmol:
+ *		Equilibrium mole fraction of second component.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	This function is only valid for isotherm models based on mixing rules.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	04/09/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_con_dp_dX_XT(double X_kgkg, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_mix_x_pT(double *ret_y_1_molmol,
+	double *ret_y_2_molmol, double p_Pa, double T_K, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = abs_con_dp_dX_XT(X_kgkg, T_K, retWorkingPair);
+	double result = abs_mix_x_pT(ret_y_1_molmol, ret_y_2_molmol, p_Pa, T_K,
+		retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_abs_con_dp_dT_XT:
- * ------------------------
+ * direct_abs_mix_p_Tx:
+ * --------------------
  *
- * Calculates derivative of equilibrium pressure p with respect to temperature
- * T in kg/kg/K depending on equilibrium concentration X in kg/kg and
- * equilibrium temperature T in K.
+ * Calculates equilibrium pressure p_Pa in Pa depending on temperature T_K in K
+ * and mole fraction in liquid phase x_molmol in mol/mol.
  *
  * Parameters:
  * -----------
- *	double X_kgkg:
- *		Equilibrium concentration in kg/kg.
  *	double T_K:
  *		Equilibrium temperature in K.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -7518,59 +15025,58 @@ DLL_API double direct_abs_con_dp_dX_XT(double X_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt. temperature in Pa/K.
+ *		Equilibrium pressure p_Pa in Pa.
+ *	double *ret_y_1_molmol:
+ *		Equilibrium mole fraction of first component.
+ *	double *ret_y_2_molmol:
+ *		Equilibrium mole fraction of second component.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on the conventional
- *	approach.
+ *	This function is only valid for isotherm models based on mixing rules.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	04/09/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_con_dp_dT_XT(double X_kgkg, double T_K,
-	const char *path_db, const char *wp_as, const char *wp_st,
-	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
-	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_mix_p_Tx(double *ret_y_1_molmol,
+	double *ret_y_2_molmol, double T_K, double x_1_molmol, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = abs_con_dp_dT_XT(X_kgkg, T_K, retWorkingPair);
+	double result = abs_mix_p_Tx(ret_y_1_molmol, ret_y_2_molmol, T_K,
+		x_1_molmol, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_abs_act_g_Txv1v2:
- * ------------------------
+ * direct_abs_mix_T_px:
+ * --------------------
  *
- * Calculates activity coefficient of first component depending on temperature
- * T_K in K, mole fraction in liquid phase x_molmol in mol/mol, molar volume of
- * first component in m³/mol, and molar volume of second component in m³/mol.
+ * Calculates equilibrium temperature T_K in K depending on pressure p_Pa in Pa
+ * and mole fraction in liquid phase x_molmol in mol/mol.
  *
  * Parameters:
  * -----------
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double x_molmol:
+ *	double p_Pa:
+ *		Equilibrium pressure p_Pa in Pa.
+ *	double x_1_molmol:
  *		Equilibrium mole fraction in liquid phase in mol/mol.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -7598,67 +15104,60 @@ DLL_API double direct_abs_con_dp_dT_XT(double X_kgkg, double T_K,
  * Returns:
  * --------
  *	double:
- *		Activity coefficient of first component.
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double *ret_y_1_molmol:
+ *		Equilibrium mole fraction of first component.
+ *	double *ret_y_2_molmol:
+ *		Equilibrium mole fraction of second component.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Uses Newton-Raphson method for calculating equilibrium temperature.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	04/09/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_act_g_Txv1v2(double T_K, double x_molmol,
-	double v1_m3mol, double v2_m3mol, const char *path_db, const char *wp_as,
-	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
-	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_mix_T_px(double *ret_y_1_molmol,
+	double *ret_y_2_molmol, double p_Pa, double x_1_molmol, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = abs_act_g_Txv1v2(T_K, x_molmol, v1_m3mol, v2_m3mol,
-		retWorkingPair);
+	double result = abs_mix_T_px(ret_y_1_molmol, ret_y_2_molmol, p_Pa,
+		x_1_molmol, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_abs_act_p_Txv1v2psat:
- * ----------------------------
+ * direct_abs_mix_dp_dx_Tx:
+ * ------------------------
  *
- * Calculates equilibrium pressure p_Pa in Pa of first component depending on
- * temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
- * molar volume of first component in m³/mol, molar volume of second component
- * in m³/mol,and saturation pressure of first component p_sat_Pa in Pa.
+ * Calculates derivative of equilibrium pressure with respect to liquid mole
+ * fraction in Pa depending on temperature T_K in K and mole fraction in liquid
+ * phase x_molmol in mol/mol.
  *
  * Parameters:
  * -----------
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_molmol:
+ *	double x_1_molmol:
  *		Equilibrium mole fraction in liquid phase in mol/mol.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
- *	double p_sat_Pa:
- *		Saturation pressure of first component in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -7686,69 +15185,55 @@ DLL_API double direct_abs_act_g_Txv1v2(double T_K, double x_molmol,
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure p_Pa in Pa.
+ *		Derivative of equilibrium pressure wrt liquid mole fraction in Pa.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Derivative is calculated numerically by the symmetric derivative using
+ *  h = 0.00000001 mol/mol as small change.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	04/09/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_act_p_Txv1v2psat(double T_K, double x_molmol,
-	double v1_m3mol, double v2_m3mol, double p_sat_Pa, const char *path_db,
-	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
-	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
-	int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_mix_dp_dx_Tx(double T_K, double x_1_molmol,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = abs_act_p_Txv1v2psat(T_K, x_molmol, v1_m3mol, v2_m3mol,
-		p_sat_Pa, retWorkingPair);
+	double result = abs_mix_dp_dx_Tx(T_K, x_1_molmol, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_abs_act_x_pTv1v2psat:
- * ----------------------------
+ * direct_abs_mix_dp_dT_Tx:
+ * ------------------------
  *
- * Calculates mole fraction of first component in liquid phase x_molmol in
- * mol/mol depending on equilibrium pressure p_Pa in Pa of first component,
- * temperature T_K in K, molar volume of first component in m³/mol, molar volume
- * of second component in m³/mol and saturation pressure of first component
- * p_sat_Pa in Pa
+ * Calculates derivative of equilibrium pressure with respect to temperature in
+ * Pa/K depending on temperature T_K in K and mole fraction in liquid phase
+ * x_molmol in mol/mol.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure p_Pa in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
- *	double p_sat_Pa:
- *		Saturation pressure of first component in Pa.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -7776,66 +15261,60 @@ DLL_API double direct_abs_act_p_Txv1v2psat(double T_K, double x_molmol,
  * Returns:
  * --------
  *	double:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *		Derivative of equilibrium pressure wrt temperature in Pa/K.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Derivative is calculated numerically by the symmetric derivative using
+ *  h = 0.0001 K as small change.
  *
  * History:
  * --------
- *	30/03/2020, by Mirko Engelpracht:
+ *	04/09/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_act_x_pTv1v2psat(double p_Pa, double T_K,
-	double v1_m3mol, double v2_m3mol, double p_sat_Pa, const char *path_db,
-	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
-	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
-	int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_mix_dp_dT_Tx(double T_K, double x_1_molmol,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = abs_act_x_pTv1v2psat(p_Pa, T_K, v1_m3mol, v2_m3mol,
-		p_sat_Pa, retWorkingPair);
+	double result = abs_mix_dp_dT_Tx(T_K, x_1_molmol, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_abs_act_p_Txv1v2:
- * ------------------------
+ * direct_abs_mix_dp_dx_Tx_der:
+ * ----------------------------
  *
- * Calculates equilibrium pressure p_Pa in Pa of first component depending on
- * temperature T_K in K, mole fraction in liquid phase x_molmol in mol/mol,
- * molar volume of first component in m³/mol and molar volume of second
- * component in m³/mol.
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to liquid mole fraction x in Pa/(mol/mol)/s depending on equilibrium
+ * temperature T in K, equilibrium mole fraction in liquid phase x in mol/mol,
+ * and their derivatives.
  *
  * Parameters:
  * -----------
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_molmol:
+ *	double x_1_molmol:
  *		Equilibrium mole fraction in liquid phase in mol/mol.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *	double x_der_molmols:
+ *		Derivative of equilibrium mole fraction in liquid phase in mol/mol/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -7863,65 +15342,67 @@ DLL_API double direct_abs_act_x_pTv1v2psat(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure p_Pa in Pa.
+ *		Derivative of derivative of equilibrium pressure wrt. liquid mole
+ *		fraction in Pa/(mol/mol)/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-3
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP_MIX) of inputs whose derivatives are
+ *	not zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_act_p_Txv1v2(double T_K, double x_molmol,
-	double v1_m3mol, double v2_m3mol, const char *path_db, const char *wp_as,
-	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
-	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_mix_dp_dx_Tx_der(double T_K, double x_1_molmol,
+	double T_der_Ks, double x_der_molmols, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = abs_act_p_Txv1v2(T_K, x_molmol, v1_m3mol, v2_m3mol,
-		retWorkingPair);
+	double result = abs_mix_dp_dx_Tx_der(T_K, x_1_molmol, T_der_Ks,
+		x_der_molmols, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_abs_act_x_pTv1v2:
- * ------------------------
+ * direct_abs_mix_dp_dT_Tx_der:
+ * ----------------------------
  *
- * Calculates mole fraction of first component in liquid phase x_molmol in
- * mol/mol depending on equilibrium pressure p_Pa in Pa of first component,
- * temperature T_K in K, molar volume of first component in m³/mol and molar
- * volume of second component in m³/mol.
+ * Calculates total derivative of derivative of equilibrium pressure p with
+ * respect to temperature T in Pa/K/s depending on equilibrium temperature T in
+ * K, equilibrium mole fraction in liquid phase x in mol/mol, and their
+ * derivatives.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure p_Pa in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double v1_m3mol:
- *		Equilibrium molar volume of first component in m³/mol.
- *	double v2_m3mol:
- *		Equilibrium molar volume of second component in m³/mol.
+ *	double x_1_molmol:
+ *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double T_der_Ks:
+ *		Derivative of equilibrium temperature in K/s.
+ *	double x_der_molmols:
+ *		Derivative of equilibrium mole fraction in liquid phase in mol/mol/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -7949,57 +15430,60 @@ DLL_API double direct_abs_act_p_Txv1v2(double T_K, double x_molmol,
  * Returns:
  * --------
  *	double:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *		Derivative of derivative of equilibrium pressure wrt. temperature in
+ *		Pa/K/s.
  *
  * Remarks:
  * --------
- *	This function is only valid for isotherm models based on activity
- *	coefficients.
- *	Molar volumes may are not required and ignored. When molar volumes are
- * 	required, function uses molar volumes stored in JSON file when input
- *	v1_m3mol or v2_m3mol is -1. Otherwise, function uses molar volumes given by
- *	inputs.
+ *	This function is only valid for isotherm models based on mixing rules.
+ *	Partial derivatives of the analytical derivative are calculated
+ *	numerically by the symmetric derivative using a relative change of 1e-3
+ *	(i.e., WORKINGPAIR_DERIVATIVE_STEP_MIX) of inputs whose derivatives are
+ *	not zero.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	30/03/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_act_x_pTv1v2(double p_Pa, double T_K,
-	double v1_m3mol, double v2_m3mol, const char *path_db, const char *wp_as,
-	const char *wp_st, const char *wp_rf, const char *wp_iso, int no_iso,
-	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_abs_mix_dp_dT_Tx_der(double T_K, double x_1_molmol,
+	double T_der_Ks, double x_der_molmols, const char *path_db,
+	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
+	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
+	int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = abs_act_x_pTv1v2(p_Pa, T_K, v1_m3mol, v2_m3mol,
-		retWorkingPair);
+	double result = abs_mix_dp_dT_Tx_der(T_K, x_1_molmol, T_der_Ks,
+		x_der_molmols, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
+/////////////////////////////////////////////////////////////////////////////
+// Definition of function prototypes regarding refrigerant working w struct//
+/////////////////////////////////////////////////////////////////////////////
 /*
- * direct_abs_mix_x_pT:
- * --------------------
+ * direct_ref_p_sat_T:
+ * -------------------
  *
- * Calculates equilibrium liquid mole fraction of first component in mol/mol
- * depending on pressure in Pa and temperature T_K in K.
+ * Calculates saturation pressure in Pa depending on equilibrium temperature T
+ * in K.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure p_Pa in Pa.
  *	double T_K:
  *		Equilibrium temperature in K.
  *
@@ -8029,59 +15513,46 @@ DLL_API double direct_abs_act_x_pTv1v2(double p_Pa, double T_K,
  * Returns:
  * --------
  *	double:
- *		Equilibrium mole fraction in of first component liquid phase in mol/mol.
- *	double *ret_y_1_molmol:
- *		Equilibrium mole fraction of first component.
- *	double *ret_y_2_molmol:
- *		Equilibrium mole fraction of second component.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on mixing rules.
+ *		Saturation pressure in Pa.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_mix_x_pT(double *ret_y_1_molmol,
-	double *ret_y_2_molmol, double p_Pa, double T_K, const char *path_db,
-	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
-	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
-	int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_ref_p_sat_T(double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = abs_mix_x_pT(ret_y_1_molmol, ret_y_2_molmol, p_Pa, T_K,
-		retWorkingPair);
+	double result = ref_p_sat_T(T_K, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_abs_mix_p_Tx:
- * --------------------
+ * direct_ref_dp_sat_dT_T:
+ * -----------------------
  *
- * Calculates equilibrium pressure p_Pa in Pa depending on temperature T_K in K
- * and mole fraction in liquid phase x_molmol in mol/mol.
+ * Calculates derivative of saturation pressure in Pa/K wrt to temperature
+ * depending on equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_1_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -8109,59 +15580,46 @@ DLL_API double direct_abs_mix_x_pT(double *ret_y_1_molmol,
  * Returns:
  * --------
  *	double:
- *		Equilibrium pressure p_Pa in Pa.
- *	double *ret_y_1_molmol:
- *		Equilibrium mole fraction of first component.
- *	double *ret_y_2_molmol:
- *		Equilibrium mole fraction of second component.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on mixing rules.
+ *		Derivative of saturation pressure wrt temperature in Pa/K.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_mix_p_Tx(double *ret_y_1_molmol,
-	double *ret_y_2_molmol, double T_K, double x_1_molmol, const char *path_db,
-	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
-	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
-	int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_ref_dp_sat_dT_T(double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = abs_mix_p_Tx(ret_y_1_molmol, ret_y_2_molmol, T_K,
-		x_1_molmol, retWorkingPair);
+	double result = ref_dp_sat_dT_T(T_K, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_abs_mix_T_px:
- * --------------------
+ * direct_ref_rho_l_T:
+ * -------------------
  *
- * Calculates equilibrium temperature T_K in K depending on pressure p_Pa in Pa
- * and mole fraction in liquid phase x_molmol in mol/mol.
+ * Calculates saturated liquid density in kg/m³ depending on equilibrium
+ * temperature T in K.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Equilibrium pressure p_Pa in Pa.
- *	double x_1_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double T_K:
+ *		Equilibrium temperature in K.
  *
  *	const char *path_db:
  *		Path to database.
@@ -8189,61 +15647,46 @@ DLL_API double direct_abs_mix_p_Tx(double *ret_y_1_molmol,
  * Returns:
  * --------
  *	double:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
- *	double *ret_y_1_molmol:
- *		Equilibrium mole fraction of first component.
- *	double *ret_y_2_molmol:
- *		Equilibrium mole fraction of second component.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on mixing rules.
- *	Uses Newton-Raphson method for calculating equilibrium temperature.
+ *		Saturated liquid density in kg/m³.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_mix_T_px(double *ret_y_1_molmol,
-	double *ret_y_2_molmol, double p_Pa, double x_1_molmol, const char *path_db,
-	const char *wp_as, const char *wp_st, const char *wp_rf, const char *wp_iso,
-	int no_iso, const char *rf_psat, int no_p_sat, const char *rf_rhol,
-	int no_rhol) {
-	// Create workingPair-struct to execute function
+DLL_API double direct_ref_rho_l_T(double T_K,
+	const char *path_db, const char *wp_as, const char *wp_st,
+	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
+	int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = abs_mix_T_px(ret_y_1_molmol, ret_y_2_molmol, p_Pa,
-		x_1_molmol, retWorkingPair);
+	double result = ref_rho_l_T(T_K, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_abs_mix_dp_dx_Tx:
- * ------------------------
+ * direct_ref_drho_l_dT_T:
+ * -----------------------
  *
- * Calculates derivative of equilibrium pressure with respect to liquid mole
- * fraction in Pa depending on temperature T_K in K and mole fraction in liquid
- * phase x_molmol in mol/mol.
+ * Calculates derivative of saturated liquid density wrt temperature in kg/m³/K
+ * depending on equilibrium temperature T in K.
  *
  * Parameters:
  * -----------
  *	double T_K:
  *		Equilibrium temperature in K.
- *	double x_1_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
  *
  *	const char *path_db:
  *		Path to database.
@@ -8271,56 +15714,46 @@ DLL_API double direct_abs_mix_T_px(double *ret_y_1_molmol,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt liquid mole fraction in Pa.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on mixing rules.
- *	Derivative is calculated numerically by the symmetric derivative using
- *  h = 0.00000001 mol/mol as small change.
+ *		Derivative of saturated liquid density wrt temperature in kg/m³/K.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	02/14/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_mix_dp_dx_Tx(double T_K, double x_1_molmol,
+DLL_API double direct_ref_drho_l_dT_T(double T_K,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = abs_mix_dp_dx_Tx(T_K, x_1_molmol, retWorkingPair);
+	double result = ref_drho_l_dT_T(T_K, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_abs_mix_dp_dT_Tx:
- * ------------------------
+ * direct_ref_T_sat_p:
+ * -------------------
  *
- * Calculates derivative of equilibrium pressure with respect to temperature in
- * Pa/K depending on temperature T_K in K and mole fraction in liquid phase
- * x_molmol in mol/mol.
+ * Calculates saturation temperature in K depending on equilibrium pressure p
+ * in Pa.
  *
  * Parameters:
  * -----------
- *	double T_K:
- *		Equilibrium temperature in K.
- *	double x_1_molmol:
- *		Equilibrium mole fraction in liquid phase in mol/mol.
+ *	double p_Pa:
+ *		Saturation pressure in Pa.
  *
  *	const char *path_db:
  *		Path to database.
@@ -8348,56 +15781,49 @@ DLL_API double direct_abs_mix_dp_dx_Tx(double T_K, double x_1_molmol,
  * Returns:
  * --------
  *	double:
- *		Derivative of equilibrium pressure wrt temperature in Pa/K.
- *
- * Remarks:
- * --------
- *	This function is only valid for isotherm models based on mixing rules.
- *	Derivative is calculated numerically by the symmetric derivative using
- *  h = 0.0001 K as small change.
+ *		Equilibrium temperature in K.
  *
  * History:
  * --------
- *	04/09/2020, by Mirko Engelpracht:
+ *	30/03/2020, by Mirko Engelpracht:
  *		First implementation.
  *
  */
-DLL_API double direct_abs_mix_dp_dT_Tx(double T_K, double x_1_molmol,
+DLL_API double direct_ref_T_sat_p(double p_Pa,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = abs_mix_dp_dT_Tx(T_K, x_1_molmol, retWorkingPair);
+	double result = ref_T_sat_p(p_Pa, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
-/////////////////////////////////////////////////////////////////////////////
-// Definition of function prototypes regarding refrigerant working w struct//
-/////////////////////////////////////////////////////////////////////////////
 /*
- * direct_ref_p_sat_T:
- * -------------------
+ * direct_ref_p_sat_T_der:
+ * -----------------------
  *
- * Calculates saturation pressure in Pa depending on equilibrium temperature T
- * in K.
+ * Calculates total derivative of saturation pressure in Pa/s depending on
+ * saturation temperature T in K and its derivative. Thus, the derivative can be
+ * used for derivative annotations of DirectFunctionCalls of Modelica.
  *
  * Parameters:
  * -----------
  *	double T_K:
- *		Equilibrium temperature in K.
+ *		Saturation temperature in K.
+ *	double T_der_Ks:
+ *		Derivative of saturation temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -8425,47 +15851,49 @@ DLL_API double direct_abs_mix_dp_dT_Tx(double T_K, double x_1_molmol,
  * Returns:
  * --------
  *	double:
- *		Saturation pressure in Pa.
+ *		Derivative of saturation pressure in Pa/s.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ref_p_sat_T(double T_K,
+DLL_API double direct_ref_p_sat_T_der(double T_K, double T_der_Ks,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ref_p_sat_T(T_K, retWorkingPair);
+	double result = ref_p_sat_T_der(T_K, T_der_Ks, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ref_dp_sat_dT_T:
+ * direct_ref_T_sat_p_der:
  * -----------------------
  *
- * Calculates derivative of saturation pressure in Pa/K wrt to temperature
- * depending on equilibrium temperature T in K.
+ * Calculates total derivative of saturation temperature in K/s depending on
+ * saturation pressure p in Pa and its derivative. Thus, the derivative can be
+ * used for derivative annotations of DirectFunctionCalls of Modelica.
  *
  * Parameters:
  * -----------
- *	double T_K:
- *		Equilibrium temperature in K.
+ *	double p_Pa:
+ *		Saturation pressure in Pa.
+ *	double p_der_Pas:
+ *		Derivative of saturation pressure in Pa/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -8493,47 +15921,49 @@ DLL_API double direct_ref_p_sat_T(double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of saturation pressure wrt temperature in Pa/K.
+ *		Derivative of saturation temperature in K/s.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ref_dp_sat_dT_T(double T_K,
+DLL_API double direct_ref_T_sat_p_der(double p_Pa, double p_der_Pas,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ref_dp_sat_dT_T(T_K, retWorkingPair);
+	double result = ref_T_sat_p_der(p_Pa, p_der_Pas, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ref_rho_l_T:
- * -------------------
+ * direct_ref_rho_l_T_der:
+ * -----------------------
  *
- * Calculates saturated liquid density in kg/m³ depending on equilibrium
- * temperature T in K.
+ * Calculates total derivative of saturated liquid density in kg/m³/s depending
+ * on saturation temperature T in K and its derivative. Thus, the derivative can
+ * be used for derivative annotations of DirectFunctionCalls of Modelica.
  *
  * Parameters:
  * -----------
  *	double T_K:
- *		Equilibrium temperature in K.
+ *		Saturation temperature in K.
+ *	double T_der_Ks:
+ *		Derivative of saturation temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -8561,47 +15991,49 @@ DLL_API double direct_ref_dp_sat_dT_T(double T_K,
  * Returns:
  * --------
  *	double:
- *		Saturated liquid density in kg/m³.
+ *		Derivative of saturated liquid density in kg/m³/s.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ref_rho_l_T(double T_K,
+DLL_API double direct_ref_rho_l_T_der(double T_K, double T_der_Ks,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ref_rho_l_T(T_K, retWorkingPair);
+	double result = ref_rho_l_T_der(T_K, T_der_Ks, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ref_drho_l_dT_T:
- * -----------------------
+ * direct_ref_dp_sat_dT_T_der:
+ * ---------------------------
  *
- * Calculates derivative of saturated liquid density wrt temperature in kg/m³/K
- * depending on equilibrium temperature T in K.
+ * Calculates total derivative of derivative of saturation pressure wrt.
+ * temperature in Pa/K/s depending on saturation temperature T in K and its
+ * derivative.
  *
  * Parameters:
  * -----------
  *	double T_K:
- *		Equilibrium temperature in K.
+ *		Saturation temperature in K.
+ *	double T_der_Ks:
+ *		Derivative of saturation temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -8629,47 +16061,58 @@ DLL_API double direct_ref_rho_l_T(double T_K,
  * Returns:
  * --------
  *	double:
- *		Derivative of saturated liquid density wrt temperature in kg/m³/K.
+ *		Derivative of derivative of saturation pressure wrt. temperature in
+ *		Pa/K/s.
+ *
+ * Remarks:
+ * --------
+ *	Derivative of the analytical derivative is calculated numerically by the
+ *	symmetric derivative using a relative change of 1e-4 (i.e.,
+ *	WORKINGPAIR_DERIVATIVE_STEP) of temperature.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	02/14/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ref_drho_l_dT_T(double T_K,
+DLL_API double direct_ref_dp_sat_dT_T_der(double T_K, double T_der_Ks,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ref_drho_l_dT_T(T_K, retWorkingPair);
+	double result = ref_dp_sat_dT_T_der(T_K, T_der_Ks, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
 
 
 /*
- * direct_ref_T_sat_p:
- * -------------------
+ * direct_ref_drho_l_dT_T_der:
+ * ---------------------------
  *
- * Calculates saturation temperature in K depending on equilibrium pressure p
- * in Pa.
+ * Calculates total derivative of derivative of saturated liquid density wrt.
+ * temperature in kg/m³/K/s depending on saturation temperature T in K and its
+ * derivative.
  *
  * Parameters:
  * -----------
- *	double p_Pa:
- *		Saturation pressure in Pa.
+ *	double T_K:
+ *		Saturation temperature in K.
+ *	double T_der_Ks:
+ *		Derivative of saturation temperature in K/s.
  *
  *	const char *path_db:
  *		Path to database.
@@ -8697,31 +16140,39 @@ DLL_API double direct_ref_drho_l_dT_T(double T_K,
  * Returns:
  * --------
  *	double:
- *		Equilibrium temperature in K.
+ *		Derivative of derivative of saturated liquid density wrt. temperature
+ *		in kg/m³/K/s.
+ *
+ * Remarks:
+ * --------
+ *	Derivative of the analytical derivative is calculated numerically by the
+ *	symmetric derivative using a relative change of 1e-4 (i.e.,
+ *	WORKINGPAIR_DERIVATIVE_STEP) of temperature.
+ *	As the result is only approximated, the function is not used for
+ *	derivative annotations of Modelica.
  *
  * History:
  * --------
- *	30/03/2020, by Mirko Engelpracht:
+ *	10/18/2026, by agent:
  *		First implementation.
  *
  */
-DLL_API double direct_ref_T_sat_p(double p_Pa,
+DLL_API double direct_ref_drho_l_dT_T_der(double T_K, double T_der_Ks,
 	const char *path_db, const char *wp_as, const char *wp_st,
 	const char *wp_rf, const char *wp_iso, int no_iso, const char *rf_psat,
 	int no_p_sat, const char *rf_rhol, int no_rhol) {
-	// Create workingPair-struct to execute function
+	// Get workingPair-struct to execute function: Working pair is cached by
+	// its arguments
 	//
-	WorkingPair *retWorkingPair = newWorkingPair(
+	WorkingPair *retWorkingPair = direct_workingPair(
 		path_db, wp_as, wp_st, wp_rf, wp_iso, no_iso, rf_psat, no_p_sat,
 		rf_rhol, no_rhol);
 
 	// Execute requested function
 	//
-	double result = ref_T_sat_p(p_Pa, retWorkingPair);
+	double result = ref_drho_l_dT_T_der(T_K, T_der_Ks, retWorkingPair);
 
-	if (retWorkingPair != NULL) {
-		delWorkingPair(retWorkingPair);
-	}
+	direct_release(retWorkingPair);
 
 	return result;
 }
@@ -0,0 +1,790 @@
+////////////////////////
+// workingPairBatch.c //
+////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "batchPool.h"
+#include "workingPair.h"
+#include "workingPairBatch.h"
+#include "status.h"
+#include "structDefinitions.c"
+
+
+///////////////////////////
+// Definition of structs //
+///////////////////////////
+/*
+ * BatchFunction:
+ * --------------
+ *
+ * Contains name and function pointer of a function of the WorkingPair-struct
+ * that can be evaluated for arrays of states.
+ *
+ * Attributes:
+ * -----------
+ *	const char *name:
+ *		Name of function (e.g., "ads_w_pT").
+ *	function function:
+ *		Pointer to function that is cast to its actual type before call.
+ *	int no_inputs:
+ *		Number of inputs of type double.
+ *	int vapor:
+ *		Flag indicating whether function returns mole fractions of both
+ *		components in vapor phase by its first two inputs (i.e., mixing
+ *		rules).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/*
+ * BatchEvaluation:
+ * ----------------
+ *
+ * Contains inputs and outputs of an evaluation of a function of the
+ * WorkingPair-struct for arrays of states.
+ *
+ * Attributes:
+ * -----------
+ *	const BatchFunction *function:
+ *		Function that is evaluated.
+ *	double *ret_values:
+ *		Array to be filled with values of function.
+ *	double *ret_y_1_molmol:
+ *		Array to be filled with mole fractions of first component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	double *ret_y_2_molmol:
+ *		Array to be filled with mole fractions of second component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	int *ret_status:
+ *		Array to be filled with status codes of states (i.e., may be NULL).
+ *	const double **inputs:
+ *		Array containing arrays of inputs in order of inputs of function.
+ *	void *workingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+
+/////////////////////////////
+// Definition of variables //
+/////////////////////////////
+/*
+ * batch_functions:
+ * ----------------
+ *
+ * Array containing all functions of the WorkingPair-struct that can be
+ * evaluated for arrays of states.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static const BatchFunction batch_functions[] = {
+	{"ads_w_pT", (genFunc) &ads_w_pT, 2, 0},
+	{"ads_p_wT", (genFunc) &ads_p_wT, 2, 0},
+	{"ads_T_pw", (genFunc) &ads_T_pw, 2, 0},
+	{"ads_dw_dp_pT", (genFunc) &ads_dw_dp_pT, 2, 0},
+	{"ads_dw_dT_pT", (genFunc) &ads_dw_dT_pT, 2, 0},
+	{"ads_dp_dw_wT", (genFunc) &ads_dp_dw_wT, 2, 0},
+	{"ads_dp_dT_wT", (genFunc) &ads_dp_dT_wT, 2, 0},
+	{"ads_w_pT_der", (genFunc) &ads_w_pT_der, 4, 0},
+	{"ads_p_wT_der", (genFunc) &ads_p_wT_der, 4, 0},
+	{"ads_T_pw_der", (genFunc) &ads_T_pw_der, 4, 0},
+	{"ads_dw_dp_pT_der", (genFunc) &ads_dw_dp_pT_der, 4, 0},
+	{"ads_dw_dT_pT_der", (genFunc) &ads_dw_dT_pT_der, 4, 0},
+	{"ads_dp_dw_wT_der", (genFunc) &ads_dp_dw_wT_der, 4, 0},
+	{"ads_dp_dT_wT_der", (genFunc) &ads_dp_dT_wT_der, 4, 0},
+	{"ads_piStar_pyxgTM", (genFunc) &ads_piStar_pyxgTM, 6, 0},
+	{"ads_sur_w_pT", (genFunc) &ads_sur_w_pT, 2, 0},
+	{"ads_sur_p_wT", (genFunc) &ads_sur_p_wT, 2, 0},
+	{"ads_sur_T_pw", (genFunc) &ads_sur_T_pw, 2, 0},
+	{"ads_sur_dw_dp_pT", (genFunc) &ads_sur_dw_dp_pT, 2, 0},
+	{"ads_sur_dw_dT_pT", (genFunc) &ads_sur_dw_dT_pT, 2, 0},
+	{"ads_sur_dp_dw_wT", (genFunc) &ads_sur_dp_dw_wT, 2, 0},
+	{"ads_sur_dp_dT_wT", (genFunc) &ads_sur_dp_dT_wT, 2, 0},
+	{"ads_sur_piStar_pyxgTM", (genFunc) &ads_sur_piStar_pyxgTM, 6, 0},
+	{"ads_sur_w_pTpsat", (genFunc) &ads_sur_w_pTpsat, 3, 0},
+	{"ads_sur_p_wTpsat", (genFunc) &ads_sur_p_wTpsat, 3, 0},
+	{"ads_sur_T_pwpsat", (genFunc) &ads_sur_T_pwpsat, 3, 0},
+	{"ads_sur_dw_dp_pTpsat", (genFunc) &ads_sur_dw_dp_pTpsat, 3, 0},
+	{"ads_sur_dw_dT_pTpsat", (genFunc) &ads_sur_dw_dT_pTpsat, 4, 0},
+	{"ads_sur_dp_dw_wTpsat", (genFunc) &ads_sur_dp_dw_wTpsat, 3, 0},
+	{"ads_sur_dp_dT_wTpsat", (genFunc) &ads_sur_dp_dT_wTpsat, 4, 0},
+	{"ads_sur_piStar_pyxgTpsatM", (genFunc) &ads_sur_piStar_pyxgTpsatM, 7, 0},
+	{"ads_vol_W_ARho", (genFunc) &ads_vol_W_ARho, 2, 0},
+	{"ads_vol_A_WRho", (genFunc) &ads_vol_A_WRho, 2, 0},
+	{"ads_vol_w_pTpsatRho", (genFunc) &ads_vol_w_pTpsatRho, 4, 0},
+	{"ads_vol_p_wTpsatRho", (genFunc) &ads_vol_p_wTpsatRho, 4, 0},
+	{"ads_vol_T_pwpsatRho", (genFunc) &ads_vol_T_pwpsatRho, 4, 0},
+	{"ads_vol_dW_dA_ARho", (genFunc) &ads_vol_dW_dA_ARho, 2, 0},
+	{"ads_vol_dA_dW_WRho", (genFunc) &ads_vol_dA_dW_WRho, 2, 0},
+	{"ads_vol_dw_dp_pTpsatRho", (genFunc) &ads_vol_dw_dp_pTpsatRho, 4, 0},
+	{"ads_vol_dw_dT_pTpsatRho", (genFunc) &ads_vol_dw_dT_pTpsatRho, 6, 0},
+	{"ads_vol_dp_dw_wTpsatRho", (genFunc) &ads_vol_dp_dw_wTpsatRho, 4, 0},
+	{"ads_vol_dp_dT_wTpsatRho", (genFunc) &ads_vol_dp_dT_wTpsatRho, 6, 0},
+	{"ads_vol_piStar_pyxgTpsatRhoM",
+		(genFunc) &ads_vol_piStar_pyxgTpsatRhoM, 8, 0},
+	{"abs_con_X_pT", (genFunc) &abs_con_X_pT, 2, 0},
+	{"abs_con_p_XT", (genFunc) &abs_con_p_XT, 2, 0},
+	{"abs_con_T_pX", (genFunc) &abs_con_T_pX, 2, 0},
+	{"abs_con_dX_dp_pT", (genFunc) &abs_con_dX_dp_pT, 2, 0},
+	{"abs_con_dX_dT_pT", (genFunc) &abs_con_dX_dT_pT, 2, 0},
+	{"abs_con_dp_dX_XT", (genFunc) &abs_con_dp_dX_XT, 2, 0},
+	{"abs_con_dp_dT_XT", (genFunc) &abs_con_dp_dT_XT, 2, 0},
+	{"abs_con_X_pT_der", (genFunc) &abs_con_X_pT_der, 4, 0},
+	{"abs_con_p_XT_der", (genFunc) &abs_con_p_XT_der, 4, 0},
+	{"abs_con_T_pX_der", (genFunc) &abs_con_T_pX_der, 4, 0},
+	{"abs_con_dX_dp_pT_der", (genFunc) &abs_con_dX_dp_pT_der, 4, 0},
+	{"abs_con_dX_dT_pT_der", (genFunc) &abs_con_dX_dT_pT_der, 4, 0},
+	{"abs_con_dp_dX_XT_der", (genFunc) &abs_con_dp_dX_XT_der, 4, 0},
+	{"abs_con_dp_dT_XT_der", (genFunc) &abs_con_dp_dT_XT_der, 4, 0},
+	{"abs_act_g_Txv1v2", (genFunc) &abs_act_g_Txv1v2, 4, 0},
+	{"abs_act_p_Txv1v2psat", (genFunc) &abs_act_p_Txv1v2psat, 5, 0},
+	{"abs_act_x_pTv1v2psat", (genFunc) &abs_act_x_pTv1v2psat, 5, 0},
+	{"abs_act_p_Txv1v2", (genFunc) &abs_act_p_Txv1v2, 4, 0},
+	{"abs_act_x_pTv1v2", (genFunc) &abs_act_x_pTv1v2, 4, 0},
+	{"abs_mix_x_pT", (genFunc) &abs_mix_x_pT, 2, 1},
+	{"abs_mix_p_Tx", (genFunc) &abs_mix_p_Tx, 2, 1},
+	{"abs_mix_T_px", (genFunc) &abs_mix_T_px, 2, 1},
+	{"abs_mix_dp_dx_Tx", (genFunc) &abs_mix_dp_dx_Tx, 2, 0},
+	{"abs_mix_dp_dT_Tx", (genFunc) &abs_mix_dp_dT_Tx, 2, 0},
+	{"abs_mix_dp_dx_Tx_der", (genFunc) &abs_mix_dp_dx_Tx_der, 4, 0},
+	{"abs_mix_dp_dT_Tx_der", (genFunc) &abs_mix_dp_dT_Tx_der, 4, 0},
+	{"ref_p_sat_T", (genFunc) &ref_p_sat_T, 1, 0},
+	{"ref_dp_sat_dT_T", (genFunc) &ref_dp_sat_dT_T, 1, 0},
+	{"ref_rho_l_T", (genFunc) &ref_rho_l_T, 1, 0},
+	{"ref_drho_l_dT_T", (genFunc) &ref_drho_l_dT_T, 1, 0},
+	{"ref_T_sat_p", (genFunc) &ref_T_sat_p, 1, 0},
+	{"ref_p_sat_T_der", (genFunc) &ref_p_sat_T_der, 2, 0},
+	{"ref_T_sat_p_der", (genFunc) &ref_T_sat_p_der, 2, 0},
+	{"ref_rho_l_T_der", (genFunc) &ref_rho_l_T_der, 2, 0},
+	{"ref_dp_sat_dT_T_der", (genFunc) &ref_dp_sat_dT_T_der, 2, 0},
+	{"ref_drho_l_dT_T_der", (genFunc) &ref_drho_l_dT_T_der, 2, 0},
+	{"tab_w_pT", (genFunc) &tab_w_pT, 2, 0},
+	{"tab_p_wT", (genFunc) &tab_p_wT, 2, 0},
+	{"tab_T_pw", (genFunc) &tab_T_pw, 2, 0},
+	{"tab_w_pT_der", (genFunc) &tab_w_pT_der, 4, 0},
+	{"tab_p_wT_der", (genFunc) &tab_p_wT_der, 4, 0},
+	{"tab_T_pw_der", (genFunc) &tab_T_pw_der, 4, 0},
+};
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * batch_function:
+ * ---------------
+ *
+ * Auxiliary function searching functions of the WorkingPair-struct that can be
+ * evaluated for arrays of states. All functions ads_*, abs_*, ref_*, and tab_*
+ * with inputs of type double and a pointer to the WorkingPair-struct are
+ * available, including their derivatives *_der.
+ *
+ * Parameters:
+ * -----------
+ *	const char *name:
+ *		Name of function (e.g., "ads_w_pT").
+ *
+ * Returns:
+ * --------
+ *	const struct *BatchFunction:
+ *		Returns pointer to function or NULL if function does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+const BatchFunction *batch_function(const char *name) {
+	if (name == NULL) {
+		return NULL;
+	}
+
+	int no_functions = sizeof(batch_functions) / sizeof(batch_functions[0]);
+
+	for (int i = 0; i < no_functions; i++) {
+		if (strcmp(batch_functions[i].name, name) == 0) {
+			return &batch_functions[i];
+		}
+	}
+	return NULL;
+}
+
+
+/*
+ * batch_kernel_values:
+ * --------------------
+ *
+ * Auxiliary function evaluating a function of the WorkingPair-struct from a
+ * first state to the state after the last state without recording status
+ * codes.
+ *
+ * Parameters:
+ * -----------
+ *	int begin:
+ *		First state.
+ *	int end:
+ *		State after last state.
+ *	void *evaluation:
+ *		Pointer of BatchEvaluation-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+void batch_kernel_values(int begin, int end, void *evaluation) {
+	// Typecast void pointer given as input to pointer of
+	// BatchEvaluation-struct
+	//
+	BatchEvaluation *retEvaluation = (BatchEvaluation *) evaluation;
+	const BatchFunction *function = retEvaluation->function;
+	const double **in = retEvaluation->inputs;
+	double *ret = retEvaluation->ret_values;
+	void *wp = retEvaluation->workingPair;
+
+	// Mixing rules return mole fractions in vapor phase
+	//
+	if (function->vapor) {
+		genFunc_2_2_1 f = (genFunc_2_2_1) function->function;
+		double y_1_molmol;
+		double y_2_molmol;
+
+		for (int i = begin; i < end; i++) {
+			ret[i] = f(&y_1_molmol, &y_2_molmol, in[0][i], in[1][i], wp);
+
+			if (retEvaluation->ret_y_1_molmol != NULL) {
+				retEvaluation->ret_y_1_molmol[i] = y_1_molmol;
+			}
+			if (retEvaluation->ret_y_2_molmol != NULL) {
+				retEvaluation->ret_y_2_molmol[i] = y_2_molmol;
+			}
+		}
+		return;
+	}
+
+	// Cast function depending on number of inputs: Loops are not merged so
+	// that function pointer is cast only once per chunk
+	//
+	switch (function->no_inputs) {
+		case 1: {
+			genFunc_1_0_1 f = (genFunc_1_0_1) function->function;
+			for (int i = begin; i < end; i++) {
+				ret[i] = f(in[0][i], wp);
+			}
+			break;
+		}
+		case 2: {
+			genFunc_2_0_1 f = (genFunc_2_0_1) function->function;
+			for (int i = begin; i < end; i++) {
+				ret[i] = f(in[0][i], in[1][i], wp);
+			}
+			break;
+		}
+		case 3: {
+			genFunc_3_0_1 f = (genFunc_3_0_1) function->function;
+			for (int i = begin; i < end; i++) {
+				ret[i] = f(in[0][i], in[1][i], in[2][i], wp);
+			}
+			break;
+		}
+		case 4: {
+			genFunc_4_0_1 f = (genFunc_4_0_1) function->function;
+			for (int i = begin; i < end; i++) {
+				ret[i] = f(in[0][i], in[1][i], in[2][i], in[3][i], wp);
+			}
+			break;
+		}
+		case 5: {
+			genFunc_5_0_1 f = (genFunc_5_0_1) function->function;
+			for (int i = begin; i < end; i++) {
+				ret[i] = f(in[0][i], in[1][i], in[2][i], in[3][i], in[4][i],
+					wp);
+			}
+			break;
+		}
+		case 6: {
+			genFunc_6_0_1 f = (genFunc_6_0_1) function->function;
+			for (int i = begin; i < end; i++) {
+				ret[i] = f(in[0][i], in[1][i], in[2][i], in[3][i], in[4][i],
+					in[5][i], wp);
+			}
+			break;
+		}
+		case 7: {
+			genFunc_7_0_1 f = (genFunc_7_0_1) function->function;
+			for (int i = begin; i < end; i++) {
+				ret[i] = f(in[0][i], in[1][i], in[2][i], in[3][i], in[4][i],
+					in[5][i], in[6][i], wp);
+			}
+			break;
+		}
+		default: {
+			genFunc_8_0_1 f = (genFunc_8_0_1) function->function;
+			for (int i = begin; i < end; i++) {
+				ret[i] = f(in[0][i], in[1][i], in[2][i], in[3][i], in[4][i],
+					in[5][i], in[6][i], in[7][i], wp);
+			}
+			break;
+		}
+	}
+}
+
+
+/*
+ * batch_kernel:
+ * -------------
+ *
+ * Auxiliary function evaluating a function of the WorkingPair-struct from a
+ * first state to the state after the last state. Function is called by
+ * threads of a BatchPool-struct. If an array of status codes is given, each
+ * state is evaluated separately in quiet mode and the status record of the
+ * calling thread is stored for each state.
+ *
+ * Parameters:
+ * -----------
+ *	int begin:
+ *		First state.
+ *	int end:
+ *		State after last state.
+ *	void *evaluation:
+ *		Pointer of BatchEvaluation-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+void batch_kernel(int begin, int end, void *evaluation) {
+	// Typecast void pointer given as input to pointer of
+	// BatchEvaluation-struct
+	//
+	BatchEvaluation *retEvaluation = (BatchEvaluation *) evaluation;
+	int *ret_status = retEvaluation->ret_status;
+
+	if (ret_status == NULL) {
+		batch_kernel_values(begin, end, evaluation);
+		return;
+	}
+
+	// Evaluate each state separately in quiet mode to get its status code:
+	// Status record is reset before first state
+	//
+	int quiet = status_quiet_thread(1);
+	status_code();
+
+	for (int i = begin; i < end; i++) {
+		batch_kernel_values(i, i + 1, evaluation);
+		ret_status[i] = status_code();
+	}
+	status_quiet_thread(quiet);
+}
+
+
+/*
+ * batch_no_inputs:
+ * ----------------
+ *
+ * Returns number of inputs of type double of a function of the
+ * WorkingPair-struct that can be evaluated by batch_evaluate.
+ *
+ * Parameters:
+ * -----------
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT").
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of inputs or -1 if function does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+DLL_API int batch_no_inputs(const char *function) {
+	const BatchFunction *retFunction = batch_function(function);
+
+	return (retFunction == NULL) ? -1 : retFunction->no_inputs;
+}
+
+
+/*
+ * batch_evaluate:
+ * ---------------
+ *
+ * Evaluates a function of the WorkingPair-struct for arrays of states in
+ * parallel. States are divided into chunks of grain_size states that are
+ * distributed among the threads of a BatchPool-struct by work stealing. Thus,
+ * states requiring many iterations (e.g., mixing rules close to the critical
+ * point) do not leave threads idle. Each state is written to its own index
+ * and, thus, results are identical for any number of threads and grain size.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_values:
+ *		Array to be filled with values of function.
+ *	double *ret_y_1_molmol:
+ *		Array to be filled with mole fractions of first component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	double *ret_y_2_molmol:
+ *		Array to be filled with mole fractions of second component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	int *ret_status:
+ *		Array to be filled with status codes of states (e.g., STATUS_OK or
+ *		STATUS_NO_CONVERGENCE). If pointer is not NULL, no warnings are
+ *		printed for single states. Pointer may be NULL.
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT" or "abs_mix_x_pT").
+ *	const double **inputs:
+ *		Array containing arrays of inputs in order of inputs of function
+ *		(e.g., pressures and temperatures for "ads_w_pT").
+ *	int no_points:
+ *		Number of states.
+ *	int grain_size:
+ *		Number of states per chunk. If grain_size is smaller than 1, grain
+ *		size is chosen automatically.
+ *	struct *BatchPool:
+ *		Pointer of BatchPool-struct. If pointer is NULL, states are evaluated
+ *		by calling thread.
+ *	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all states are calculated and -1 otherwise. In case
+ *		of an error, all states of returned array are set to -1.
+ *
+ * Remarks:
+ * --------
+ *	States whose calculation fails are set to -1 by the function itself. A
+ *	long-lived pool should be reused for several calls to avoid starting
+ *	threads for each call.
+ *
+ *	Status codes of all states are set to the code of the error if states
+ *	cannot be evaluated at all.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+DLL_API int batch_evaluate(double *ret_values, double *ret_y_1_molmol,
+	double *ret_y_2_molmol, int *ret_status, const char *function,
+	const double **inputs, int no_points, int grain_size, void *batchPool,
+	void *workingPair) {
+	// Typecast void pointers given as inputs to correct structs
+	//
+	BatchPool *retBatchPool = (BatchPool *) batchPool;
+	const BatchFunction *retFunction = batch_function(function);
+
+	if (ret_values == NULL || no_points < 0) {
+		if (status_report(STATUS_INVALID_INPUT, "batch_evaluate", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nArrays of states are invalid.");
+			printf("\nReturn -1 for function call \"batch_evaluate\".");
+		}
+		return -1;
+	}
+
+	// Check function, inputs, and working pair
+	//
+	int valid = 0;
+
+	if (workingPair == NULL) {
+		warning_struct("workingPair", "batch_evaluate");
+
+	} else if (retFunction == NULL) {
+		if (status_report(STATUS_NOT_IMPLEMENTED, "batch_evaluate", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nFunction \"%s\" cannot be evaluated for arrays of "
+				"states.",
+				(function == NULL) ? "" : function);
+			printf("\nReturn -1 for function call \"batch_evaluate\".");
+		}
+
+	} else if (inputs == NULL) {
+		if (status_report(STATUS_INVALID_INPUT, "batch_evaluate", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nInputs of function \"%s\" are missing.", function);
+			printf("\nReturn -1 for function call \"batch_evaluate\".");
+		}
+
+	} else {
+		valid = 1;
+		for (int i = 0; i < retFunction->no_inputs; i++) {
+			valid = valid && (inputs[i] != NULL);
+		}
+
+		if (!valid) {
+			if (status_report(STATUS_INVALID_INPUT, "batch_evaluate", 0, 0)) {
+				printf("\n\n###########\n# Warning #\n###########");
+				printf("\nInputs of function \"%s\" are missing.", function);
+				printf("\nReturn -1 for function call \"batch_evaluate\".");
+			}
+		}
+	}
+
+	// Evaluate states by given pool or by calling thread
+	//
+	if (valid) {
+		BatchEvaluation evaluation = {retFunction, ret_values,
+			ret_y_1_molmol, ret_y_2_molmol, ret_status, inputs, workingPair};
+
+		batchPool_run(retBatchPool, no_points, grain_size, &batch_kernel,
+			&evaluation);
+		return 0;
+	}
+
+	// Indicate error for all states
+	//
+	int code = getStatusCode();
+
+	for (int i = 0; i < no_points; i++) {
+		ret_values[i] = -1;
+
+		if (ret_status != NULL) {
+			ret_status[i] = code;
+		}
+	}
+	return -1;
+}
+
+
+/*
+ * batch_evaluate_columns:
+ * -----------------------
+ *
+ * Evaluates a function of the WorkingPair-struct for arrays of states whose
+ * inputs are given as columns of one matrix stored column by column (e.g., a
+ * two-dimensional array of VBA or Fortran, or a range of a worksheet). Thus,
+ * wrappers that cannot build arrays of pointers (e.g., Excel) evaluate a whole
+ * column of states by one call.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_values:
+ *		Array to be filled with values of function.
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT").
+ *	const double *inputs:
+ *		Matrix with no_points rows and one column per input stored column by
+ *		column, i.e. i-th state of j-th input is inputs[j * no_points + i].
+ *	int no_points:
+ *		Number of states.
+ *	struct *BatchPool:
+ *		Pointer of BatchPool-struct. If pointer is NULL, states are evaluated
+ *		by calling thread.
+ *	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if all states are calculated and -1 otherwise. In case
+ *		of an error, all states of returned array are set to -1.
+ *
+ * Remarks:
+ * --------
+ *	Mole fractions in vapor phase of mixing rules are not returned. Grain
+ *	size is chosen automatically.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int batch_evaluate_columns(double *ret_values, const char *function,
+	const double *inputs, int no_points, void *batchPool, void *workingPair) {
+	// Point to columns of matrix: Unknown functions are reported by
+	// batch_evaluate
+	//
+	const BatchFunction *retFunction = batch_function(function);
+	const double *columns[BATCH_MAX_INPUTS] = {NULL};
+
+	if (retFunction != NULL && inputs != NULL && no_points >= 0) {
+		for (int i = 0; i < retFunction->no_inputs; i++) {
+			columns[i] = inputs + (size_t) i * (size_t) no_points;
+		}
+	}
+
+	return batch_evaluate(ret_values, NULL, NULL, NULL, function,
+		(inputs == NULL) ? NULL : columns, no_points, 0, batchPool,
+		workingPair);
+}
+
+
+/*
+ * batch_evaluate_labview:
+ * -----------------------
+ *
+ * Evaluates a function of the WorkingPair-struct for arrays of states with a
+ * signature that fits the Call Library Function node of LabVIEW: Arrays are
+ * passed as array data pointers with their lengths, and the error cluster is
+ * returned by its elements (i.e., status, code, and source). Inputs are given
+ * by one two-dimensional array whose rows are the inputs (e.g., built by
+ * "Build Array" of a buffer of pressures and a buffer of temperatures). Thus,
+ * a whole buffer of states is evaluated by one call.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_values:
+ *		Array to be filled with values of function.
+ *	int *ret_status:
+ *		Array to be filled with status codes of states (e.g., STATUS_OK or
+ *		STATUS_NO_CONVERGENCE).
+ *	unsigned char *ret_error:
+ *		Status of error cluster: 1 if a state or the whole call failed and 0
+ *		otherwise.
+ *	int *ret_code:
+ *		Code of error cluster: 0 if no state failed and LABVIEW_ERROR_CODE
+ *		plus status code of first failed state otherwise.
+ *	char *ret_source:
+ *		Buffer to be filled with source of error cluster (i.e., may be NULL).
+ *	int length_source:
+ *		Length of buffer including terminating zero.
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT").
+ *	const double *inputs:
+ *		Two-dimensional array with one row per input and one column per state
+ *		stored row by row, i.e. i-th state of j-th input is
+ *		inputs[j * no_points + i].
+ *	int no_inputs:
+ *		Number of rows of inputs (i.e., must equal number of inputs of
+ *		function).
+ *	int no_points:
+ *		Number of states (i.e., number of columns of inputs and length of
+ *		arrays of values and status codes).
+ *	struct *BatchPool:
+ *		Pointer of BatchPool-struct. If pointer is NULL, states are evaluated
+ *		by calling thread.
+ *	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns number of failed states or -1 if function cannot be
+ *		evaluated at all. In the latter case, all values are set to -1.
+ *
+ * Remarks:
+ * --------
+ *	Function does neither allocate memory nor print warnings. If no pool is
+ *	given, no threads are started. Thus, latency of a call only depends on
+ *	number of states and is bounded for real-time loops.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int batch_evaluate_labview(double *ret_values, int *ret_status,
+	unsigned char *ret_error, int *ret_code, char *ret_source,
+	int length_source, const char *function, const double *inputs,
+	int no_inputs, int no_points, void *batchPool, void *workingPair) {
+	// Check arrays, function, and working pair: Error cluster is set without
+	// printing warnings
+	//
+	const BatchFunction *retFunction = batch_function(function);
+	int code = STATUS_OK;
+
+	if (ret_values == NULL || ret_status == NULL || ret_error == NULL ||
+		ret_code == NULL || no_points < 0) {
+		return -1;
+
+	} else if (workingPair == NULL) {
+		code = STATUS_INVALID_STRUCT;
+
+	} else if (retFunction == NULL) {
+		code = STATUS_NOT_IMPLEMENTED;
+
+	} else if (inputs == NULL || no_inputs != retFunction->no_inputs) {
+		code = STATUS_INVALID_INPUT;
+
+	}
+
+	if (code != STATUS_OK) {
+		for (int i = 0; i < no_points; i++) {
+			ret_values[i] = -1;
+			ret_status[i] = code;
+		}
+
+		*ret_error = 1;
+		*ret_code = LABVIEW_ERROR_CODE + code;
+		if (ret_source != NULL && length_source > 0) {
+			snprintf(ret_source, (size_t) length_source,
+				"batch_evaluate_labview: Function \"%s\" cannot be evaluated "
+				"(status %i).", (function == NULL) ? "" : function, code);
+		}
+		return -1;
+	}
+
+	// Evaluate states by given pool or by calling thread
+	//
+	const double *columns[BATCH_MAX_INPUTS] = {NULL};
+
+	for (int i = 0; i < no_inputs; i++) {
+		columns[i] = inputs + (size_t) i * (size_t) no_points;
+	}
+
+	BatchEvaluation evaluation = {retFunction, ret_values, NULL, NULL,
+		ret_status, columns, workingPair};
+	batchPool_run((BatchPool *) batchPool, no_points, 0, &batch_kernel,
+		&evaluation);
+
+	// Set error cluster by first failed state
+	//
+	int no_failed = 0;
+	int index_failed = -1;
+
+	for (int i = 0; i < no_points; i++) {
+		if (ret_status[i] != STATUS_OK) {
+			index_failed = (no_failed == 0) ? i : index_failed;
+			no_failed++;
+		}
+	}
+
+	*ret_error = (no_failed > 0);
+	*ret_code = (no_failed > 0) ?
+		LABVIEW_ERROR_CODE + ret_status[index_failed] : 0;
+	if (ret_source != NULL && length_source > 0) {
+		if (no_failed > 0) {
+			snprintf(ret_source, (size_t) length_source,
+				"batch_evaluate_labview: %i of %i states of function \"%s\" "
+				"failed (first state %i, status %i).", no_failed, no_points,
+				function, index_failed, ret_status[index_failed]);
+		} else {
+			ret_source[0] = '\0';
+		}
+	}
+	return no_failed;
+}
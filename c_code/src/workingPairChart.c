@@ -0,0 +1,318 @@
+////////////////////////
+// workingPairChart.c //
+////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "batchPool.h"
+#include "workingPair.h"
+#include "workingPairBatch.h"
+#include "workingPairChart.h"
+#include "status.h"
+#include "surrogate.h"
+#include "structDefinitions.c"
+
+
+///////////////////////////
+// Definition of structs //
+///////////////////////////
+/*
+ * ChartEvaluation:
+ * ----------------
+ *
+ * Contains inputs and outputs of the generation of a chart of a working pair.
+ * Results are stored as dense matrices with one row per curve and one column
+ * per point.
+ *
+ * Attributes:
+ * -----------
+ *	int chart:
+ *		Type of chart (e.g., CHART_ISOTHERMS).
+ *	const BatchFunction *function:
+ *		Function that is evaluated.
+ *	double *ret_values:
+ *		Matrix to be filled with values of function.
+ *	double *ret_T_sat_K:
+ *		Matrix to be filled with vapor temperatures of equilibrium pressures
+ *		(i.e., only for CHART_DUEHRING and may be NULL otherwise).
+ *	unsigned char *ret_valid:
+ *		Matrix to be filled with flags indicating valid entries.
+ *	const double *p_sat_Pa:
+ *		Array containing vapor pressures of curves (i.e., for CHART_ISOTHERMS)
+ *		or of points (i.e., otherwise).
+ *	double p_limit_Pa:
+ *		Highest finite vapor pressure that limits pressures if vapor pressure
+ *		is not defined (e.g., above critical temperature).
+ *	const double *curves:
+ *		Array containing inputs that are constant along each curve.
+ *	const double *points:
+ *		Array containing inputs that vary along each curve.
+ *	int no_points:
+ *		Number of points per curve (i.e., number of columns).
+ *	void *workingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * chart_kernel:
+ * -------------
+ *
+ * Auxiliary function evaluating curves of a chart from a first curve to the
+ * curve after the last curve. Each state is evaluated in quiet mode, and
+ * entries are flagged valid if value is finite, no failure occurred, and
+ * pressure does not exceed vapor pressure. Function is called by threads of a
+ * BatchPool-struct.
+ *
+ * Parameters:
+ * -----------
+ *	int begin:
+ *		First curve.
+ *	int end:
+ *		Curve after last curve.
+ *	void *evaluation:
+ *		Pointer of ChartEvaluation-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void chart_kernel(int begin, int end, void *evaluation) {
+	// Typecast void pointer given as input to pointer of
+	// ChartEvaluation-struct
+	//
+	ChartEvaluation *retEvaluation = (ChartEvaluation *) evaluation;
+	genFunc_2_0_1 f = (genFunc_2_0_1) retEvaluation->function->function;
+	int chart = retEvaluation->chart;
+	int no_points = retEvaluation->no_points;
+	void *wp = retEvaluation->workingPair;
+
+	// Evaluate each state separately in quiet mode to get its status code:
+	// Status record is reset before first state
+	//
+	int quiet = status_quiet_thread(1);
+	status_code();
+
+	for (int i = begin; i < end; i++) {
+		double curve = retEvaluation->curves[i];
+		long offset = (long) i * no_points;
+
+		for (int j = 0; j < no_points; j++) {
+			// Isotherms are functions of pressure and temperature of curve,
+			// and other charts are functions of curve and temperature
+			//
+			double point = retEvaluation->points[j];
+			double value = (chart == CHART_ISOTHERMS) ? f(point, curve, wp) :
+				f(curve, point, wp);
+			int valid = (status_code() == STATUS_OK) && surrogate_finite(value);
+
+			// Clip pressure at vapor pressure of temperature of entry or at
+			// highest vapor pressure if vapor pressure is not defined
+			//
+			double p_Pa = (chart == CHART_ISOTHERMS) ? point :
+				((chart == CHART_ISOBARS) ? curve : value);
+			double p_sat_Pa = (chart == CHART_ISOTHERMS) ?
+				retEvaluation->p_sat_Pa[i] : retEvaluation->p_sat_Pa[j];
+			double p_max_Pa = (surrogate_finite(p_sat_Pa) && p_sat_Pa > 0) ?
+				p_sat_Pa : retEvaluation->p_limit_Pa;
+
+			valid = valid && (p_Pa >= 0) && (p_Pa <= p_max_Pa);
+
+			// Dühring charts additionally require vapor temperature of
+			// equilibrium pressure
+			//
+			if (chart == CHART_DUEHRING) {
+				double T_sat_K = valid ? ref_T_sat_p(p_Pa, wp) : -1;
+				valid = valid && (status_code() == STATUS_OK) &&
+					surrogate_finite(T_sat_K) && (T_sat_K > 0);
+
+				retEvaluation->ret_T_sat_K[offset + j] = valid ? T_sat_K : -1;
+			}
+
+			retEvaluation->ret_values[offset + j] = value;
+			retEvaluation->ret_valid[offset + j] = (unsigned char) valid;
+		}
+	}
+	status_quiet_thread(quiet);
+}
+
+
+/*
+ * chart_evaluate:
+ * ---------------
+ *
+ * Generates all curves of a chart of a working pair (i.e., isotherms,
+ * isosteres, isobars, or Dühring chart) in parallel. Results are stored as
+ * dense matrices with one row per curve and one column per point (i.e., value
+ * of curve i at point j is stored at index i * no_points + j). Curves are
+ * distributed among the threads of a BatchPool-struct.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_values:
+ *		Matrix to be filled with values of function (e.g., loadings for
+ *		isotherms and isobars or pressures for isosteres).
+ *	double *ret_T_sat_K:
+ *		Matrix to be filled with vapor temperatures of equilibrium pressures.
+ *		Pointer is required for CHART_DUEHRING and may be NULL otherwise.
+ *	unsigned char *ret_valid:
+ *		Matrix to be filled with 1 for valid entries and 0 for entries that
+ *		are clipped or failed.
+ *	double *ret_p_sat_Pa:
+ *		Array to be filled with vapor pressures of curves (i.e., of
+ *		temperatures for CHART_ISOTHERMS) or of points (i.e., otherwise).
+ *		Pointer may be NULL.
+ *	int chart:
+ *		Type of chart (e.g., CHART_ISOTHERMS).
+ *	const char *function:
+ *		Name of function with two inputs (e.g., "ads_w_pT" or "abs_con_p_XT").
+ *	const double *curves:
+ *		Array containing inputs that are constant along each curve.
+ *	int no_curves:
+ *		Number of curves.
+ *	const double *points:
+ *		Array containing inputs that vary along each curve.
+ *	int no_points:
+ *		Number of points per curve.
+ *	struct *BatchPool:
+ *		Pointer of BatchPool-struct. If pointer is NULL, curves are evaluated
+ *		by calling thread.
+ *	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if chart is generated and -1 otherwise. In case of an
+ *		error, all values are set to -1 and all entries are invalid.
+ *
+ * Remarks:
+ * --------
+ *	Pressures are clipped at vapor pressure of the temperature of the entry.
+ *	If vapor pressure is not defined (e.g., above critical temperature),
+ *	pressures are clipped at highest finite vapor pressure of the chart.
+ *	Results are identical for any number of threads.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int chart_evaluate(double *ret_values, double *ret_T_sat_K,
+	unsigned char *ret_valid, double *ret_p_sat_Pa, int chart,
+	const char *function, const double *curves, int no_curves,
+	const double *points, int no_points, void *batchPool, void *workingPair) {
+	// Check arrays of curves and points
+	//
+	if (ret_values == NULL || ret_valid == NULL || curves == NULL ||
+		points == NULL || no_curves < 1 || no_points < 1) {
+		if (status_report(STATUS_INVALID_INPUT, "chart_evaluate", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nArrays of curves or points are invalid.");
+			printf("\nReturn -1 for function call \"chart_evaluate\".");
+		}
+		return -1;
+	}
+
+	// Check working pair, chart, and function: Only functions with two inputs
+	// that do not return mole fractions in vapor phase describe curves
+	//
+	const BatchFunction *retFunction = (function == NULL) ? NULL :
+		batch_function(function);
+	long no_entries = (long) no_curves * no_points;
+	int valid = 0;
+
+	if (workingPair == NULL) {
+		warning_struct("workingPair", "chart_evaluate");
+
+	} else if (chart < CHART_ISOTHERMS || chart > CHART_DUEHRING ||
+		(chart == CHART_DUEHRING && ret_T_sat_K == NULL)) {
+		if (status_report(STATUS_INVALID_INPUT, "chart_evaluate", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nType of chart %i is invalid or vapor temperatures of "
+				"Dühring chart cannot be returned.", chart);
+			printf("\nReturn -1 for function call \"chart_evaluate\".");
+		}
+
+	} else if (retFunction == NULL || retFunction->no_inputs != 2 ||
+		retFunction->vapor) {
+		if (status_report(STATUS_NOT_IMPLEMENTED, "chart_evaluate", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nFunction \"%s\" cannot describe curves of a chart.",
+				(function == NULL) ? "" : function);
+			printf("\nReturn -1 for function call \"chart_evaluate\".");
+		}
+
+	} else {
+		valid = 1;
+	}
+
+	// Calculate vapor pressures of temperatures of chart: Vapor pressures
+	// are calculated once and not for each state
+	//
+	int no_temperatures = (chart == CHART_ISOTHERMS) ? no_curves : no_points;
+	double *p_sat_Pa = (!valid || ret_p_sat_Pa != NULL) ? ret_p_sat_Pa :
+		(double *) malloc(no_temperatures * sizeof(double));
+
+	if (valid && p_sat_Pa != NULL) {
+		const double *inputs[1] = {(chart == CHART_ISOTHERMS) ? curves :
+			points};
+		BatchEvaluation saturation = {batch_function("ref_p_sat_T"),
+			p_sat_Pa, NULL, NULL, NULL, inputs, workingPair};
+
+		int quiet = status_quiet_thread(1);
+		batch_kernel_values(0, no_temperatures, &saturation);
+		status_code();
+		status_quiet_thread(quiet);
+
+		double p_limit_Pa = -1;
+
+		for (int i = 0; i < no_temperatures; i++) {
+			if (surrogate_finite(p_sat_Pa[i]) && p_sat_Pa[i] > p_limit_Pa) {
+				p_limit_Pa = p_sat_Pa[i];
+			}
+		}
+
+		// Evaluate curves by given pool or by calling thread
+		//
+		ChartEvaluation evaluation = {chart, retFunction, ret_values,
+			ret_T_sat_K, ret_valid, p_sat_Pa, p_limit_Pa, curves, points,
+			no_points, workingPair};
+
+		batchPool_run((BatchPool *) batchPool, no_curves, 1, &chart_kernel,
+			&evaluation);
+
+		if (ret_p_sat_Pa == NULL) {
+			free(p_sat_Pa);
+		}
+		return 0;
+	}
+
+	if (ret_p_sat_Pa == NULL) {
+		free(p_sat_Pa);
+	}
+
+	// Indicate error for all entries
+	//
+	for (long i = 0; i < no_entries; i++) {
+		ret_values[i] = -1;
+		ret_valid[i] = 0;
+
+		if (ret_T_sat_K != NULL) {
+			ret_T_sat_K[i] = -1;
+		}
+	}
+	return -1;
+}
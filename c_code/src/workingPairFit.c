@@ -0,0 +1,1717 @@
+//////////////////////
+// workingPairFit.c //
+//////////////////////
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "absorption_activity_floryhuggins.h"
+#include "absorption_activity_heil.h"
+#include "absorption_activity_nrtl.h"
+#include "absorption_activity_tsubokakatayama.h"
+#include "absorption_activity_uniquac.h"
+#include "absorption_activity_wangchao.h"
+#include "absorption_activity_wilson.h"
+#include "absorption_antoine.h"
+#include "absorption_duehring.h"
+#include "adsorption_dualSiteSips.h"
+#include "adsorption_dubininArctan1.h"
+#include "adsorption_dubininAstakhov.h"
+#include "adsorption_freundlich.h"
+#include "adsorption_langmuir.h"
+#include "adsorption_toth.h"
+#include "batchPool.h"
+#include "cJSON.h"
+#include "database.h"
+#include "refrigerantHandle.h"
+#include "workingPair.h"
+#include "workingPairFit.h"
+#include "workingPairVerification.h"
+#include "status.h"
+#include "surrogate.h"
+#include "structDefinitions.c"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+/*
+ * Tolerances of Levenberg-Marquardt algorithm: Algorithm converges if cosine
+ * between residuals and derivatives of all active coefficients, relative
+ * reduction of sum of squared residuals, or relative scaled step is smaller
+ * than tolerance. Damping factor is limited to FIT_MAX_DAMPING.
+ */
+#define FIT_TOLERANCE_GRADIENT 1e-10
+#define FIT_TOLERANCE_COST 1e-12
+#define FIT_TOLERANCE_STEP 1e-10
+#define FIT_MAX_DAMPING 1e16
+
+
+///////////////////////////
+// Definition of structs //
+///////////////////////////
+/*
+ * FitModel:
+ * ---------
+ *
+ * Describes an isotherm equation whose coefficients can be fitted: Names of
+ * coefficients in order of the database, measured value calculated by the
+ * isotherm equation, and function calculating this value and its derivatives
+ * with respect to the coefficients.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_iso:
+ *		Name of isotherm equation (e.g., "Toth").
+ *	const char *wp_tp:
+ *		Type of working pair (i.e., "ads" or "abs").
+ *	const char *measured:
+ *		Name of data set compared with values of function (i.e., "loadings"
+ *		or "pressures").
+ *	int refrigerant:
+ *		Number of refrigerant functions required by function (i.e., 0: none,
+ *		1: saturation pressure, 2: saturation pressure and saturated liquid
+ *		density).
+ *	int no_par:
+ *		Number of coefficients.
+ *	const char *names[FIT_MAX_NO_COEFFICIENTS]:
+ *		Names of coefficients in order of coefficients (i.e., keys of "_p_" in
+ *		the database).
+ *	double (*function)(double[], double, double, double, double, double,
+ *	double[]):
+ *		Function calculating measured value and its derivatives wrt.
+ *		coefficients depending on pressure in Pa, temperature in K, loading
+ *		(i.e., in kg/kg or mol/mol), saturation pressure in Pa, saturated
+ *		liquid density in kg/m3, and coefficients.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/*
+ * Fit:
+ * ----
+ *
+ * Contains points of experimental data and coefficients of an isotherm
+ * equation fitted to these points by a Levenberg-Marquardt algorithm with
+ * bounds. Points are stored in flat arrays, so residuals and derivatives of
+ * all points are evaluated by one call of a BatchPool-struct.
+ *
+ * Attributes:
+ * -----------
+ *	const FitModel *model:
+ *		Isotherm equation whose coefficients are fitted.
+ *	int no_points:
+ *		Number of points.
+ *	double *inputs[FIT_NO_INPUTS]:
+ *		Arrays containing pressure in Pa, temperature in K, loading,
+ *		saturation pressure in Pa, and saturated liquid density in kg/m3 of all
+ *		points.
+ *	double *measured:
+ *		Array containing measured values of all points (i.e., pointer of
+ *		array of inputs).
+ *	double *weights:
+ *		Array containing weights of residuals of all points.
+ *	int *valid:
+ *		Array containing flags indicating if points are valid.
+ *	double *values:
+ *		Array containing calculated values of all points.
+ *	double *jacobian:
+ *		Array containing derivatives of weighted residuals wrt. coefficients
+ *		of all points (i.e., row-major with one row per point).
+ *	double *trial_values:
+ *		Array containing calculated values of trial coefficients.
+ *	double *trial_jacobian:
+ *		Array containing derivatives of trial coefficients.
+ *	double trial_par[FIT_MAX_NO_COEFFICIENTS]:
+ *		Trial coefficients evaluated by threads.
+ *	double par[FIT_MAX_NO_COEFFICIENTS]:
+ *		Fitted coefficients.
+ *	double covariance[FIT_MAX_NO_COEFFICIENTS * FIT_MAX_NO_COEFFICIENTS]:
+ *		Covariance matrix of fitted coefficients (i.e., row-major).
+ *	int status:
+ *		Status code of fit (e.g., STATUS_NO_CONVERGENCE if maximal number of
+ *		iterations is reached).
+ *	int no_iterations:
+ *		Number of iterations (i.e., evaluations of trial coefficients).
+ *	int no_valid:
+ *		Number of valid points.
+ *	double rmse:
+ *		Root-mean-square error of valid points.
+ *	double are:
+ *		Average absolute relative deviation of valid points.
+ *	double max_error:
+ *		Maximal absolute error of valid points.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+
+///////////////////////////////////////////
+// Definition of functions of fit models //
+///////////////////////////////////////////
+/*
+ * fit_<isotherm equation>:
+ * ------------------------
+ *
+ * Auxiliary functions mapping pressure, temperature, loading, saturation
+ * pressure, and saturated liquid density of a point to the inputs of the
+ * functions calculating derivatives wrt. coefficients of each isotherm
+ * equation. Activity coefficient equations use molar volumes stored as
+ * coefficients.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static double fit_langmuir(double ret_dpar[], double p_Pa, double T_K,
+	double w, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(w) = (w);
+	(p_sat_Pa) = (p_sat_Pa);
+	(rho_l_kgm3) = (rho_l_kgm3);
+	return adsorption_langmuir_dw_dpar_pT(ret_dpar, p_Pa, T_K, isotherm_par);
+}
+
+static double fit_toth(double ret_dpar[], double p_Pa, double T_K,
+	double w, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(w) = (w);
+	(p_sat_Pa) = (p_sat_Pa);
+	(rho_l_kgm3) = (rho_l_kgm3);
+	return adsorption_toth_dw_dpar_pT(ret_dpar, p_Pa, T_K, isotherm_par);
+}
+
+static double fit_dualSiteSips(double ret_dpar[], double p_Pa, double T_K,
+	double w, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(w) = (w);
+	(p_sat_Pa) = (p_sat_Pa);
+	(rho_l_kgm3) = (rho_l_kgm3);
+	return adsorption_dualSiteSips_dw_dpar_pT(ret_dpar, p_Pa, T_K,
+		isotherm_par);
+}
+
+static double fit_freundlich(double ret_dpar[], double p_Pa, double T_K,
+	double w, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(w) = (w);
+	(rho_l_kgm3) = (rho_l_kgm3);
+	return adsorption_freundlich_dw_dpar_pTpsat(ret_dpar, p_Pa, T_K, p_sat_Pa,
+		isotherm_par);
+}
+
+static double fit_dubininAstakhov(double ret_dpar[], double p_Pa, double T_K,
+	double w, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(w) = (w);
+	return adsorption_dubininAstakhov_dw_dpar_pTpsatRho(ret_dpar, p_Pa, T_K,
+		p_sat_Pa, rho_l_kgm3, isotherm_par);
+}
+
+static double fit_dubininArctan1(double ret_dpar[], double p_Pa, double T_K,
+	double w, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(w) = (w);
+	return adsorption_dubininArctan1_dw_dpar_pTpsatRho(ret_dpar, p_Pa, T_K,
+		p_sat_Pa, rho_l_kgm3, isotherm_par);
+}
+
+static double fit_antoine(double ret_dpar[], double p_Pa, double T_K,
+	double X, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(p_Pa) = (p_Pa);
+	(p_sat_Pa) = (p_sat_Pa);
+	(rho_l_kgm3) = (rho_l_kgm3);
+	return absorption_antoine_dp_dpar_XT(ret_dpar, X, T_K, isotherm_par);
+}
+
+static double fit_duehring(double ret_dpar[], double p_Pa, double T_K,
+	double X, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(p_Pa) = (p_Pa);
+	(p_sat_Pa) = (p_sat_Pa);
+	(rho_l_kgm3) = (rho_l_kgm3);
+	return absorption_duehring_dp_dpar_XT(ret_dpar, X, T_K, isotherm_par);
+}
+
+static double fit_wilson_fdl(double ret_dpar[], double p_Pa, double T_K,
+	double x, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(p_Pa) = (p_Pa);
+	(rho_l_kgm3) = (rho_l_kgm3);
+	return absorption_activity_wilson_fdl_dp_dpar_Txv1v2psat(ret_dpar, T_K, x,
+		-1, -1, p_sat_Pa, isotherm_par);
+}
+
+static double fit_wilson_tdl(double ret_dpar[], double p_Pa, double T_K,
+	double x, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(p_Pa) = (p_Pa);
+	(rho_l_kgm3) = (rho_l_kgm3);
+	return absorption_activity_wilson_tdl_dp_dpar_Txv1v2psat(ret_dpar, T_K, x,
+		-1, -1, p_sat_Pa, isotherm_par);
+}
+
+static double fit_heil(double ret_dpar[], double p_Pa, double T_K,
+	double x, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(p_Pa) = (p_Pa);
+	(rho_l_kgm3) = (rho_l_kgm3);
+	return absorption_activity_heil_dp_dpar_Txv1v2psat(ret_dpar, T_K, x,
+		-1, -1, p_sat_Pa, isotherm_par);
+}
+
+static double fit_tsubokakatayama(double ret_dpar[], double p_Pa, double T_K,
+	double x, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(p_Pa) = (p_Pa);
+	(rho_l_kgm3) = (rho_l_kgm3);
+	return absorption_activity_tsubokakatayama_dp_dpar_Txv1v2psat(ret_dpar,
+		T_K, x, -1, -1, p_sat_Pa, isotherm_par);
+}
+
+static double fit_wangchao(double ret_dpar[], double p_Pa, double T_K,
+	double x, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(p_Pa) = (p_Pa);
+	(rho_l_kgm3) = (rho_l_kgm3);
+	return absorption_activity_wangchao_dp_dpar_Txv1v2psat(ret_dpar, T_K, x,
+		-1, -1, p_sat_Pa, isotherm_par);
+}
+
+static double fit_nrtl_fdg(double ret_dpar[], double p_Pa, double T_K,
+	double x, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(p_Pa) = (p_Pa);
+	(rho_l_kgm3) = (rho_l_kgm3);
+	return absorption_activity_nrtl_fdg_dp_dpar_Txpsat(ret_dpar, T_K, x,
+		p_sat_Pa, isotherm_par);
+}
+
+static double fit_nrtl_dgT(double ret_dpar[], double p_Pa, double T_K,
+	double x, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(p_Pa) = (p_Pa);
+	(rho_l_kgm3) = (rho_l_kgm3);
+	return absorption_activity_nrtl_dgT_dp_dpar_Txpsat(ret_dpar, T_K, x,
+		p_sat_Pa, isotherm_par);
+}
+
+static double fit_uniquac_fdu(double ret_dpar[], double p_Pa, double T_K,
+	double x, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(p_Pa) = (p_Pa);
+	(rho_l_kgm3) = (rho_l_kgm3);
+	return absorption_activity_uniquac_fdu_dp_dpar_Txpsat(ret_dpar, T_K, x,
+		p_sat_Pa, isotherm_par);
+}
+
+static double fit_uniquac_duT(double ret_dpar[], double p_Pa, double T_K,
+	double x, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(p_Pa) = (p_Pa);
+	(rho_l_kgm3) = (rho_l_kgm3);
+	return absorption_activity_uniquac_duT_dp_dpar_Txpsat(ret_dpar, T_K, x,
+		p_sat_Pa, isotherm_par);
+}
+
+static double fit_floryhuggins(double ret_dpar[], double p_Pa, double T_K,
+	double x, double p_sat_Pa, double rho_l_kgm3, double isotherm_par[]) {
+	(p_Pa) = (p_Pa);
+	(rho_l_kgm3) = (rho_l_kgm3);
+	return absorption_activity_floryhuggins_dp_dpar_Txpsat(ret_dpar, T_K, x,
+		p_sat_Pa, isotherm_par);
+}
+
+
+
+/////////////////////////////////
+// Definition of static arrays //
+/////////////////////////////////
+/*
+ * fit_models:
+ * -----------
+ *
+ * Isotherm equations whose coefficients can be fitted. Adsorption equations
+ * are fitted to loadings and absorption equations are fitted to pressures
+ * (i.e., direction of explicit equations). Mixing rules are not included, as
+ * their pressures are calculated iteratively by a cubic equation of state.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static const FitModel fit_models[] = {
+	{"Langmuir", "ads", "loadings", 0, 3,
+		{"delta_H", "K0", "w_s"}, &fit_langmuir},
+	{"Toth", "ads", "loadings", 0, 7,
+		{"bo", "c", "m", "n0", "q_star_R", "r", "w_s"}, &fit_toth},
+	{"DualSiteSips", "ads", "loadings", 0, 9,
+		{"b_A_0", "b_B_0", "Q_A_st", "Q_B_st", "eta_A", "eta_B", "w_A", "w_B",
+		"T_0"}, &fit_dualSiteSips},
+	{"Freundlich", "ads", "loadings", 1, 8,
+		{"A0", "A1", "A2", "A3", "B0", "B1", "B2", "B3"}, &fit_freundlich},
+	{"DubininAstakhov", "ads", "loadings", 2, 4,
+		{"E", "n", "W0", "flag"}, &fit_dubininAstakhov},
+	{"DubininArctan1", "ads", "loadings", 2, 4,
+		{"a", "b", "c", "d"}, &fit_dubininArctan1},
+	{"Antoine", "abs", "pressures", 0, 12,
+		{"A0", "A1", "A2", "A3", "A4", "B0", "B1", "B2", "B3", "B4", "c",
+		"d"}, &fit_antoine},
+	{"Duehring", "abs", "pressures", 0, 15,
+		{"a0", "a1", "a2", "a3", "b0", "b1", "b2", "b3", "C", "D", "E", "m",
+		"n", "q", "r"}, &fit_duehring},
+	{"WilsonFixedDl", "abs", "pressures", 1, 6,
+		{"A_12", "A_21", "d_lambda_12", "d_lambda_21", "v_1", "v_2"},
+		&fit_wilson_fdl},
+	{"WilsonTemperatureDl", "abs", "pressures", 1, 7,
+		{"d_lambda_12_c", "d_lambda_12_T", "d_lambda_21_c", "d_lambda_21_T",
+		"c", "v_1", "v_2"}, &fit_wilson_tdl},
+	{"Heil", "abs", "pressures", 1, 4,
+		{"d_lambda_12", "d_lambda_21", "v_1", "v_2"}, &fit_heil},
+	{"TsubokaKatayama", "abs", "pressures", 1, 4,
+		{"d_lambda_12", "d_lambda_21", "v_1", "v_2"}, &fit_tsubokakatayama},
+	{"WangChao", "abs", "pressures", 1, 5,
+		{"d_lambda_12", "d_lambda_21", "z", "v_1", "v_2"}, &fit_wangchao},
+	{"NrtlFixedDg", "abs", "pressures", 1, 3,
+		{"d_g_12", "d_g_21", "alpha_12"}, &fit_nrtl_fdg},
+	{"NrtlTemperatureDg", "abs", "pressures", 1, 5,
+		{"a_12", "a_21", "b_12", "b_21", "alpha_12"}, &fit_nrtl_dgT},
+	{"UniquacFixedDu", "abs", "pressures", 1, 7,
+		{"d_u_12", "d_u_21", "q_1", "q_2", "r_1", "r_2", "z"},
+		&fit_uniquac_fdu},
+	{"UniquacTemperatureDu", "abs", "pressures", 1, 9,
+		{"a_12", "a_21", "b_12", "b_21", "q_1", "q_2", "r_1", "r_2", "z"},
+		&fit_uniquac_duT},
+	{"FloryHuggins", "abs", "pressures", 1, 3,
+		{"r", "w_0 / k_Boltzmann", "w_1"}, &fit_floryhuggins}
+};
+
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * newFit:
+ * -------
+ *
+ * Initialization function to create a new Fit-struct. Therefore, function
+ * reads all points of experimental data given in the format of the database
+ * (i.e., "_ed_") and calculates saturation pressure and saturated liquid
+ * density of the refrigerant at all points if required by the isotherm
+ * equation.
+ *
+ * Parameters:
+ * -----------
+ *	struct *Database:
+ *		Pointer of Database-struct containing refrigerant (i.e., NULL if
+ *		isotherm equation does not require refrigerant functions).
+ *	const char *wp_iso:
+ *		Name of isotherm equation (e.g., "Toth").
+ *	const char *wp_rf:
+ *		Name of refrigerant.
+ * 	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure (i.e., NULL to choose
+ *		first approach existing in the database).
+ *	int no_p_sat:
+ *		ID of vapor pressure equation.
+ * 	const char *rf_rhol:
+ *		Name of calculation approach for liquid density (i.e., NULL to choose
+ *		first approach existing in the database).
+ *	int no_rhol:
+ *		ID of liquid density equation.
+ *	const char *json_ed:
+ *		JSON text containing an array of blocks of experimental data or one
+ *		block of experimental data (i.e., objects containing "_d_" with
+ *		arrays "pressures", "temperatures", and "loadings").
+ *
+ * Returns:
+ * --------
+ *	struct *Fit:
+ *		Returns malloc-ed Fit-struct or NULL if isotherm equation cannot be
+ *		fitted, data do not contain points, refrigerant cannot be found, or
+ *		memory allocation fails.
+ *
+ * Remarks:
+ * --------
+ *	Loadings are concentrations in kg/kg for conventional absorption equations
+ *	and mole fractions in mol/mol for activity coefficient equations. Molar
+ *	volumes of activity coefficient equations are taken from coefficients.
+ *	Points containing values that are not numbers are skipped.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API Fit *newFit(Database *database, const char *wp_iso, const char *wp_rf,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol,
+	const char *json_ed) {
+	// Check if coefficients of isotherm equation can be fitted and if
+	// refrigerant functions exist
+	//
+	const FitModel *model = (wp_iso == NULL) ? NULL : fit_model(wp_iso);
+
+	if (model == NULL) {
+		if (status_report(STATUS_NOT_IMPLEMENTED, "newFit", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCoefficients of isotherm equation \"%s\" cannot be "
+				"fitted.", (wp_iso == NULL) ? "" : wp_iso);
+		}
+		return NULL;
+
+	} else if (model->refrigerant > 0 && (database == NULL || wp_rf == NULL)) {
+		if (status_report(STATUS_INVALID_STRUCT, "newFit", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nIsotherm equation \"%s\" requires Database-struct and "
+				"refrigerant.", wp_iso);
+		}
+		return NULL;
+	}
+
+	// Count points of experimental data first
+	//
+	cJSON *json = (json_ed == NULL) ? NULL : cJSON_Parse(json_ed);
+	int no_points = fit_points(NULL, json);
+
+	if (no_points == 0) {
+		if (status_report(STATUS_INVALID_INPUT, "newFit", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot find points of experimental data.");
+		}
+		cJSON_Delete(json);
+		return NULL;
+	}
+
+	// Try to allocate memory for Fit-struct and points
+	//
+	Fit *retFit = (Fit *) calloc(1, sizeof(Fit));
+	int valid = (retFit != NULL);
+
+	if (valid) {
+		retFit->model = model;
+		retFit->no_points = no_points;
+
+		for (int i = 0; i < FIT_NO_INPUTS; i++) {
+			retFit->inputs[i] = (double *) malloc(no_points *
+				sizeof(double));
+			valid = valid && (retFit->inputs[i] != NULL);
+		}
+		retFit->weights = (double *) malloc(no_points * sizeof(double));
+		retFit->valid = (int *) malloc(no_points * sizeof(int));
+		retFit->values = (double *) malloc(no_points * sizeof(double));
+		retFit->trial_values = (double *) malloc(no_points * sizeof(double));
+		retFit->jacobian = (double *) malloc(no_points * model->no_par *
+			sizeof(double));
+		retFit->trial_jacobian = (double *) malloc(no_points * model->no_par *
+			sizeof(double));
+
+		valid = valid && retFit->weights != NULL && retFit->valid != NULL &&
+			retFit->values != NULL && retFit->trial_values != NULL &&
+			retFit->jacobian != NULL && retFit->trial_jacobian != NULL;
+	}
+
+	if (!valid) {
+		// Not enough memory available for Fit-struct
+		//
+		if (status_report(STATUS_NO_MEMORY, "newFit", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for Fit-struct.");
+		}
+		cJSON_Delete(json);
+		delFit(retFit);
+		return NULL;
+	}
+
+	fit_points(retFit->inputs, json);
+	cJSON_Delete(json);
+
+	retFit->measured = (strcmp(model->measured, "pressures") == 0) ?
+		retFit->inputs[0] : retFit->inputs[2];
+	retFit->status = STATUS_NO_CONVERGENCE;
+
+	for (int i = 0; i < no_points; i++) {
+		retFit->inputs[3][i] = -1;
+		retFit->inputs[4][i] = -1;
+	}
+
+	// Calculate refrigerant functions at all points: Approaches are chosen
+	// as for verification if they are not given
+	//
+	if (model->refrigerant > 0) {
+		const char *approach_psat;
+		const char *approach_rhol;
+
+		verification_refrigerant(&approach_psat, &approach_rhol, wp_rf,
+			database->json_file);
+
+		RefrigerantHandle *refrigerantHandle = newRefrigerantHandle(database,
+			wp_rf, (rf_psat == NULL) ? approach_psat : rf_psat, no_p_sat,
+			(rf_rhol == NULL) ? approach_rhol : rf_rhol, no_rhol);
+		int error = (refrigerantHandle == NULL) ||
+			(refh_p_sat_T_batch(retFit->inputs[3], retFit->inputs[1],
+			no_points, refrigerantHandle) != 0) ||
+			(model->refrigerant > 1 && refh_rho_l_T_batch(retFit->inputs[4],
+			retFit->inputs[1], no_points, refrigerantHandle) != 0);
+
+		delRefrigerantHandle(refrigerantHandle);
+
+		if (error) {
+			if (status_report(STATUS_DATABASE, "newFit", 0, 0)) {
+				printf("\n\n###########\n# Warning #\n###########");
+				printf("\nCannot calculate refrigerant functions of \"%s\" "
+					"required by isotherm equation \"%s\".", wp_rf, wp_iso);
+			}
+			delFit(retFit);
+			return NULL;
+		}
+	}
+	return retFit;
+}
+
+
+/*
+ * delFit:
+ * -------
+ *
+ * Destructor function to free allocated memory of a Fit-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void delFit(void *fit) {
+	// Typecast void pointer given as input to pointer of Fit-struct
+	//
+	Fit *retFit = (Fit *) fit;
+
+	if (retFit != NULL) {
+		for (int i = 0; i < FIT_NO_INPUTS; i++) {
+			free(retFit->inputs[i]);
+		}
+		free(retFit->weights);
+		free(retFit->valid);
+		free(retFit->values);
+		free(retFit->jacobian);
+		free(retFit->trial_values);
+		free(retFit->trial_jacobian);
+		free(retFit);
+	}
+}
+
+
+/*
+ * fit_model:
+ * ----------
+ *
+ * Auxiliary function searching isotherm equation whose coefficients can be
+ * fitted.
+ *
+ * Parameters:
+ * -----------
+ *	const char *wp_iso:
+ *		Name of isotherm equation (e.g., "Toth").
+ *
+ * Returns:
+ * --------
+ *	const FitModel *:
+ *		Returns pointer of isotherm equation or NULL if coefficients of
+ *		isotherm equation cannot be fitted.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+const FitModel *fit_model(const char *wp_iso) {
+	int no_models = (int) (sizeof(fit_models) / sizeof(fit_models[0]));
+
+	for (int i = 0; i < no_models; i++) {
+		if (strcmp(fit_models[i].wp_iso, wp_iso) == 0) {
+			return &fit_models[i];
+		}
+	}
+	return NULL;
+}
+
+
+/*
+ * fit_points:
+ * -----------
+ *
+ * Auxiliary function reading pressure, temperature, and loading of all points
+ * of experimental data.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_inputs[FIT_NO_INPUTS]:
+ *		Arrays to be filled with pressure, temperature, and loading (i.e., NULL
+ *		to count points only).
+ *	struct *cJSON:
+ *		Pointer of cJSON-struct containing an array of blocks of experimental
+ *		data or one block of experimental data.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of points.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int fit_points(double *ret_inputs[FIT_NO_INPUTS], cJSON *json) {
+	// Data sets in order of inputs
+	//
+	static const char *names[3] = {"pressures", "temperatures", "loadings"};
+
+	int no_blocks = cJSON_IsArray(json) ? cJSON_GetArraySize(json) :
+		(cJSON_IsObject(json) ? 1 : 0);
+	int no_points = 0;
+
+	for (int i = 0; i < no_blocks; i++) {
+		cJSON *json_block = cJSON_IsArray(json) ?
+			cJSON_GetArrayItem(json, i) : json;
+		cJSON *json_data = cJSON_GetObjectItemCaseSensitive(json_block,
+			"_d_");
+		cJSON *json_sets[3];
+		int no_points_block = -1;
+
+		// Number of points is length of shortest data set
+		//
+		for (int j = 0; j < 3; j++) {
+			json_sets[j] = cJSON_GetObjectItemCaseSensitive(json_data,
+				names[j]);
+
+			int no_points_set = cJSON_IsArray(json_sets[j]) ?
+				cJSON_GetArraySize(json_sets[j]) : 0;
+
+			no_points_block = (no_points_block < 0 ||
+				no_points_set < no_points_block) ? no_points_set :
+				no_points_block;
+		}
+
+		// Skip points containing values that are not numbers
+		//
+		for (int k = 0; k < no_points_block; k++) {
+			int valid = 1;
+
+			for (int j = 0; j < 3; j++) {
+				cJSON *json_point = cJSON_GetArrayItem(json_sets[j], k);
+
+				valid = valid && cJSON_IsNumber(json_point);
+
+				if (valid && ret_inputs != NULL) {
+					ret_inputs[j][no_points] = json_point->valuedouble;
+				}
+			}
+			no_points += valid;
+		}
+	}
+	return no_points;
+}
+
+
+/*
+ * fit_kernel:
+ * -----------
+ *
+ * Auxiliary function evaluating values and derivatives wrt. coefficients of
+ * trial coefficients from a first point to the point after the last point.
+ * Function is called by threads of a BatchPool-struct.
+ *
+ * Parameters:
+ * -----------
+ *	int begin:
+ *		First point.
+ *	int end:
+ *		Point after last point.
+ *	void *fit:
+ *		Pointer of Fit-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void fit_kernel(int begin, int end, void *fit) {
+	// Typecast void pointer given as input to pointer of Fit-struct
+	//
+	Fit *retFit = (Fit *) fit;
+	const FitModel *model = retFit->model;
+	int no_par = model->no_par;
+
+	// Derivatives of residuals are weighted like residuals
+	//
+	for (int i = begin; i < end; i++) {
+		double *dvalue_dpar = &retFit->trial_jacobian[i * no_par];
+
+		retFit->trial_values[i] = model->function(dvalue_dpar,
+			retFit->inputs[0][i], retFit->inputs[1][i], retFit->inputs[2][i],
+			retFit->inputs[3][i], retFit->inputs[4][i], retFit->trial_par);
+
+		for (int j = 0; j < no_par; j++) {
+			dvalue_dpar[j] *= retFit->weights[i];
+		}
+	}
+}
+
+
+/*
+ * fit_normal:
+ * -----------
+ *
+ * Auxiliary function calculating half sum of squared weighted residuals and,
+ * optionally, normal equations of values and derivatives. Points are summed
+ * in order, so results do not depend on number of threads.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_A:
+ *		Array to be filled with product of transposed Jacobian and Jacobian in
+ *		row-major order (i.e., NULL if not required).
+ *	double *ret_g:
+ *		Array to be filled with product of transposed Jacobian and weighted
+ *		residuals (i.e., NULL if not required).
+ *	const double *values:
+ *		Array containing calculated values of all points.
+ *	const double *jacobian:
+ *		Array containing weighted derivatives of all points.
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Half sum of squared weighted residuals of valid points or -1 if a
+ *		value or derivative of a valid point is not finite.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double fit_normal(double *ret_A, double *ret_g, const double *values,
+	const double *jacobian, Fit *fit) {
+	int no_par = fit->model->no_par;
+	double sum_squares = 0;
+
+	for (int j = 0; j < no_par; j++) {
+		for (int k = 0; ret_A != NULL && k < no_par; k++) {
+			ret_A[j * no_par + k] = 0;
+		}
+		if (ret_g != NULL) {
+			ret_g[j] = 0;
+		}
+	}
+
+	for (int i = 0; i < fit->no_points; i++) {
+		if (!fit->valid[i]) {
+			continue;
+		}
+
+		const double *row = &jacobian[i * no_par];
+		double residual = fit->weights[i] * (values[i] - fit->measured[i]);
+
+		if (!surrogate_finite(residual)) {
+			return -1;
+		}
+		sum_squares += residual * residual;
+
+		// Sum lower triangle of normal equations only
+		//
+		for (int j = 0; ret_A != NULL && j < no_par; j++) {
+			if (!surrogate_finite(row[j])) {
+				return -1;
+			}
+			for (int k = 0; k <= j; k++) {
+				ret_A[j * no_par + k] += row[j] * row[k];
+			}
+			ret_g[j] += row[j] * residual;
+		}
+	}
+
+	for (int j = 0; ret_A != NULL && j < no_par; j++) {
+		for (int k = 0; k < j; k++) {
+			ret_A[k * no_par + j] = ret_A[j * no_par + k];
+		}
+	}
+	return surrogate_finite(sum_squares) ? sum_squares / 2 : -1;
+}
+
+
+/*
+ * fit_cholesky:
+ * -------------
+ *
+ * Auxiliary function factorizing a symmetric positive definite matrix by
+ * Cholesky decomposition in place and, optionally, solving a linear system.
+ *
+ * Parameters:
+ * -----------
+ *	double *A:
+ *		Matrix in row-major order that is overwritten by lower triangular
+ *		factor.
+ *	double *b:
+ *		Right-hand side that is overwritten by solution (i.e., NULL if not
+ *		required).
+ *	int n:
+ *		Number of rows of matrix.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if matrix is positive definite and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int fit_cholesky(double *A, double *b, int n) {
+	// Factorize matrix: A = L * L^T
+	//
+	for (int j = 0; j < n; j++) {
+		double diagonal = A[j * n + j];
+
+		for (int k = 0; k < j; k++) {
+			diagonal -= A[j * n + k] * A[j * n + k];
+		}
+		if (!surrogate_finite(diagonal) || diagonal <= 0) {
+			return -1;
+		}
+		A[j * n + j] = sqrt(diagonal);
+
+		for (int i = j + 1; i < n; i++) {
+			double sum = A[i * n + j];
+
+			for (int k = 0; k < j; k++) {
+				sum -= A[i * n + k] * A[j * n + k];
+			}
+			A[i * n + j] = sum / A[j * n + j];
+		}
+	}
+
+	// Solve L * y = b and L^T * x = y
+	//
+	for (int i = 0; b != NULL && i < n; i++) {
+		for (int k = 0; k < i; k++) {
+			b[i] -= A[i * n + k] * b[k];
+		}
+		b[i] /= A[i * n + i];
+	}
+	for (int i = n - 1; b != NULL && i >= 0; i--) {
+		for (int k = i + 1; k < n; k++) {
+			b[i] -= A[k * n + i] * b[k];
+		}
+		b[i] /= A[i * n + i];
+	}
+	return 0;
+}
+
+
+/*
+ * fit_optimize:
+ * -------------
+ *
+ * Fits coefficients of isotherm equation to all points of a Fit-struct by a
+ * Levenberg-Marquardt algorithm with bounds: Sum of squared weighted residuals
+ * is minimized by steps solving the scaled normal equations. Steps are
+ * projected onto bounds, and coefficients at a bound are kept if gradient
+ * points out of bounds. Residuals and analytic derivatives wrt. coefficients
+ * are evaluated in parallel by the threads of a BatchPool-struct. Afterwards,
+ * covariance matrix and statistics are calculated.
+ *
+ * Parameters:
+ * -----------
+ *	const double *par_start:
+ *		Array containing start values of coefficients.
+ *	const double *par_lower:
+ *		Array containing lower bounds of coefficients (i.e., NULL for no
+ *		lower bounds).
+ *	const double *par_upper:
+ *		Array containing upper bounds of coefficients (i.e., NULL for no
+ *		upper bounds).
+ *	int relative:
+ *		Flag indicating if residuals are relative to measured values (i.e.,
+ *		1) or absolute (i.e., 0).
+ *	int max_iterations:
+ *		Maximal number of iterations. If max_iterations is smaller than 1,
+ *		100 iterations per coefficient are used.
+ *	int grain_size:
+ *		Number of points per chunk. If grain_size is smaller than 1, grain
+ *		size is chosen automatically.
+ *	struct *BatchPool:
+ *		Pointer of BatchPool-struct. If pointer is NULL, points are evaluated
+ *		by calling thread.
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if algorithm converged and -1 otherwise.
+ *
+ * Remarks:
+ * --------
+ *	Coefficients whose lower bound equals upper bound are fixed. Points that
+ *	cannot be evaluated with start values or whose squared residuals or
+ *	derivatives overflow with start values (e.g., outliers far outside range
+ *	of validity) are not valid and are excluded. Relative residuals are
+ *	calculated with a measured value of at least 1e-12. If algorithm does not
+ *	converge, coefficients with smallest sum of squared residuals are kept.
+ *	Results are identical for any number of threads and grain size.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int fit_optimize(const double *par_start, const double *par_lower,
+	const double *par_upper, int relative, int max_iterations, int grain_size,
+	void *batchPool, void *fit) {
+	// Typecast void pointer given as input to pointer of Fit-struct
+	//
+	Fit *retFit = (Fit *) fit;
+
+	if (retFit == NULL) {
+		warning_struct("fit", "fit_optimize");
+		return -1;
+
+	} else if (par_start == NULL) {
+		if (status_report(STATUS_INVALID_INPUT, "fit_optimize", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nStart values of coefficients are missing.");
+			printf("\nReturn -1 for function call \"fit_optimize\".");
+		}
+		return -1;
+	}
+
+	// Set bounds and start values: Coefficients are fixed if bounds are
+	// equal
+	//
+	int no_par = retFit->model->no_par;
+	int no_free = 0;
+	int free_par[FIT_MAX_NO_COEFFICIENTS];
+	double lower[FIT_MAX_NO_COEFFICIENTS];
+	double upper[FIT_MAX_NO_COEFFICIENTS];
+
+	for (int j = 0; j < no_par; j++) {
+		lower[j] = (par_lower == NULL) ? -DBL_MAX : par_lower[j];
+		upper[j] = (par_upper == NULL) ? DBL_MAX : par_upper[j];
+		upper[j] = (upper[j] < lower[j]) ? lower[j] : upper[j];
+
+		retFit->par[j] = (par_start[j] < lower[j]) ? lower[j] :
+			((par_start[j] > upper[j]) ? upper[j] : par_start[j]);
+		free_par[j] = (lower[j] < upper[j]);
+		no_free += free_par[j];
+	}
+
+	max_iterations = (max_iterations < 1) ? 100 * no_par : max_iterations;
+
+	// Evaluate points by given pool or by calling thread
+	//
+	BatchPool *pool = (BatchPool *) batchPool;
+
+	// Evaluate start values: Points that cannot be evaluated or whose
+	// squares overflow are excluded, so single outliers (e.g., typing errors
+	// of temperature) do not prevent fit of remaining points
+	//
+	for (int i = 0; i < retFit->no_points; i++) {
+		double measured = retFit->measured[i];
+
+		retFit->weights[i] = relative ? 1 / ((measured > 1e-12) ? measured :
+			1e-12) : 1;
+	}
+	for (int j = 0; j < no_par; j++) {
+		retFit->trial_par[j] = retFit->par[j];
+	}
+	batchPool_run(pool, retFit->no_points, grain_size, &fit_kernel, retFit);
+
+	retFit->no_valid = 0;
+
+	for (int i = 0; i < retFit->no_points; i++) {
+		double residual = retFit->weights[i] * (retFit->trial_values[i] -
+			retFit->measured[i]);
+		int valid = surrogate_finite(residual * residual);
+
+		for (int j = 0; j < no_par; j++) {
+			double derivative = retFit->trial_jacobian[i * no_par + j];
+
+			valid = valid && surrogate_finite(derivative * derivative);
+		}
+		retFit->valid[i] = valid;
+		retFit->no_valid += valid;
+	}
+
+	double *swap = retFit->values;
+	retFit->values = retFit->trial_values;
+	retFit->trial_values = swap;
+	swap = retFit->jacobian;
+	retFit->jacobian = retFit->trial_jacobian;
+	retFit->trial_jacobian = swap;
+
+	double A[FIT_MAX_NO_COEFFICIENTS * FIT_MAX_NO_COEFFICIENTS];
+	double g[FIT_MAX_NO_COEFFICIENTS];
+	double cost = fit_normal(A, g, retFit->values, retFit->jacobian, retFit);
+
+	if (retFit->no_valid < no_free || retFit->no_valid == 0 || cost < 0) {
+		if (status_report(STATUS_INVALID_INPUT, "fit_optimize", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			if (cost < 0) {
+				printf("\nSum of squared residuals of start values is not "
+					"finite.");
+			} else {
+				printf("\nNumber of valid points (%i) is smaller than number "
+					"of fitted coefficients (%i).", retFit->no_valid, no_free);
+			}
+			printf("\nReturn -1 for function call \"fit_optimize\".");
+		}
+		retFit->status = STATUS_INVALID_INPUT;
+		return -1;
+	}
+
+	// Minimize sum of squared residuals: Normal equations are scaled by
+	// diagonal, so damping is independent of units of coefficients. Damping
+	// is updated by ratio of actual and predicted reduction (i.e., Nielsen)
+	//
+	double damping = 1e-3;
+	double factor_damping = 2;
+	int converged = 0;
+	int no_iterations = 0;
+
+	while (!converged && no_iterations < max_iterations) {
+		// Choose active coefficients: Coefficients at bound are inactive if
+		// gradient points out of bounds
+		//
+		int active[FIT_MAX_NO_COEFFICIENTS];
+		double scale[FIT_MAX_NO_COEFFICIENTS];
+		int no_active = 0;
+		double max_gradient = 0;
+
+		for (int j = 0; j < no_par; j++) {
+			int bounded = (retFit->par[j] <= lower[j] && g[j] > 0) ||
+				(retFit->par[j] >= upper[j] && g[j] < 0);
+
+			if (free_par[j] && !bounded && A[j * no_par + j] > 0) {
+				active[no_active] = j;
+				scale[no_active] = sqrt(A[j * no_par + j]);
+				max_gradient = fmax(max_gradient, fabs(g[j]) /
+					scale[no_active]);
+				no_active++;
+			}
+		}
+
+		if (no_active == 0 || max_gradient <= FIT_TOLERANCE_GRADIENT *
+			sqrt(2 * cost)) {
+			converged = 1;
+			break;
+		}
+
+		// Solve damped normal equations of active coefficients
+		//
+		double M[FIT_MAX_NO_COEFFICIENTS * FIT_MAX_NO_COEFFICIENTS];
+		double step[FIT_MAX_NO_COEFFICIENTS];
+
+		for (int k = 0; k < no_active; k++) {
+			for (int l = 0; l < no_active; l++) {
+				M[k * no_active + l] = A[active[k] * no_par + active[l]] /
+					(scale[k] * scale[l]) + ((k == l) ? damping : 0);
+			}
+			step[k] = -g[active[k]] / scale[k];
+		}
+
+		no_iterations++;
+
+		if (fit_cholesky(M, step, no_active) != 0) {
+			damping *= factor_damping;
+			factor_damping *= 2;
+			converged = (damping > FIT_MAX_DAMPING);
+			continue;
+		}
+
+		// Project trial coefficients onto bounds and evaluate them
+		//
+		double norm_step = 0;
+		double norm_par = 0;
+		double reduction_predicted = 0;
+
+		for (int j = 0; j < no_par; j++) {
+			retFit->trial_par[j] = retFit->par[j];
+		}
+		for (int k = 0; k < no_active; k++) {
+			int j = active[k];
+			double par_trial = retFit->par[j] + step[k] / scale[k];
+
+			retFit->trial_par[j] = (par_trial < lower[j]) ? lower[j] :
+				((par_trial > upper[j]) ? upper[j] : par_trial);
+			norm_step += pow((retFit->trial_par[j] - retFit->par[j]) *
+				scale[k], 2);
+			norm_par += pow(retFit->par[j] * scale[k], 2);
+		}
+
+		// Predict reduction by linear model of projected step
+		//
+		for (int k = 0; k < no_active; k++) {
+			double step_k = retFit->trial_par[active[k]] -
+				retFit->par[active[k]];
+
+			reduction_predicted -= g[active[k]] * step_k;
+
+			for (int l = 0; l < no_active; l++) {
+				reduction_predicted -= 0.5 * step_k * A[active[k] * no_par +
+					active[l]] * (retFit->trial_par[active[l]] -
+					retFit->par[active[l]]);
+			}
+		}
+
+		batchPool_run(pool, retFit->no_points, grain_size, &fit_kernel,
+			retFit);
+
+		double A_trial[FIT_MAX_NO_COEFFICIENTS * FIT_MAX_NO_COEFFICIENTS];
+		double g_trial[FIT_MAX_NO_COEFFICIENTS];
+		double cost_trial = fit_normal(A_trial, g_trial, retFit->trial_values,
+			retFit->trial_jacobian, retFit);
+		int small_step = (sqrt(norm_step) <= FIT_TOLERANCE_STEP *
+			(sqrt(norm_par) + FIT_TOLERANCE_STEP));
+
+		if (cost_trial >= 0 && cost_trial < cost) {
+			// Accept trial coefficients and decrease damping if linear model
+			// predicts reduction well
+			//
+			double ratio = (reduction_predicted > 0) ? (cost - cost_trial) /
+				reduction_predicted : 0;
+
+			converged = small_step || (cost - cost_trial <=
+				FIT_TOLERANCE_COST * cost);
+			cost = cost_trial;
+			damping = fmax(damping * fmax(1.0 / 3, 1 - pow(2 * ratio - 1, 3)),
+				1e-12);
+			factor_damping = 2;
+
+			for (int j = 0; j < no_par; j++) {
+				retFit->par[j] = retFit->trial_par[j];
+				g[j] = g_trial[j];
+			}
+			for (int j = 0; j < no_par * no_par; j++) {
+				A[j] = A_trial[j];
+			}
+
+			swap = retFit->values;
+			retFit->values = retFit->trial_values;
+			retFit->trial_values = swap;
+			swap = retFit->jacobian;
+			retFit->jacobian = retFit->trial_jacobian;
+			retFit->trial_jacobian = swap;
+
+		} else {
+			// Reject trial coefficients and increase damping: Coefficients
+			// are a minimum if damping or step cannot be changed anymore
+			//
+			damping *= factor_damping;
+			factor_damping *= 2;
+			converged = small_step || (damping > FIT_MAX_DAMPING);
+
+		}
+	}
+
+	retFit->no_iterations = no_iterations;
+	retFit->status = converged ? STATUS_OK : STATUS_NO_CONVERGENCE;
+
+	// Calculate statistics in order of points: Errors are not weighted
+	//
+	double sum_relative = 0;
+	double max_error = 0;
+
+	for (int i = 0; i < retFit->no_points; i++) {
+		if (retFit->valid[i]) {
+			double measured = retFit->measured[i];
+			double error = fabs(retFit->values[i] - measured);
+
+			sum_relative += error / ((measured > 1e-12) ? measured : 1e-12);
+			max_error = (error > max_error) ? error : max_error;
+		}
+	}
+
+	double sum_squares = 0;
+
+	for (int i = 0; max_error > 0 && i < retFit->no_points; i++) {
+		if (retFit->valid[i]) {
+			double error = fabs(retFit->values[i] - retFit->measured[i]) /
+				max_error;
+
+			sum_squares += error * error;
+		}
+	}
+
+	retFit->rmse = max_error * sqrt(sum_squares / retFit->no_valid);
+	retFit->are = sum_relative / retFit->no_valid;
+	retFit->max_error = max_error;
+
+	// Calculate covariance matrix of free coefficients: Inverse of scaled
+	// normal equations is calculated column by column
+	//
+	int index_free[FIT_MAX_NO_COEFFICIENTS];
+	double scale_free[FIT_MAX_NO_COEFFICIENTS];
+	double M[FIT_MAX_NO_COEFFICIENTS * FIT_MAX_NO_COEFFICIENTS];
+	int no_dof = retFit->no_valid - no_free;
+	int singular = (no_dof <= 0);
+
+	for (int j = 0, k = 0; j < no_par; j++) {
+		if (free_par[j]) {
+			index_free[k] = j;
+			scale_free[k] = sqrt(A[j * no_par + j]);
+			singular = singular || !(scale_free[k] > 0);
+			k++;
+		}
+	}
+	for (int k = 0; !singular && k < no_free; k++) {
+		for (int l = 0; l < no_free; l++) {
+			M[k * no_free + l] = A[index_free[k] * no_par + index_free[l]] /
+				(scale_free[k] * scale_free[l]);
+		}
+	}
+	singular = singular || (fit_cholesky(M, NULL, no_free) != 0);
+
+	for (int j = 0; j < no_par * no_par; j++) {
+		retFit->covariance[j] = singular && free_par[j / no_par] &&
+			free_par[j % no_par] ? NAN : 0;
+	}
+
+	for (int l = 0; !singular && l < no_free; l++) {
+		double column[FIT_MAX_NO_COEFFICIENTS];
+
+		for (int k = 0; k < no_free; k++) {
+			column[k] = (k == l) ? 1 : 0;
+		}
+
+		// Reuse factor: Solve L * y = e_l and L^T * x = y
+		//
+		for (int i = 0; i < no_free; i++) {
+			for (int k = 0; k < i; k++) {
+				column[i] -= M[i * no_free + k] * column[k];
+			}
+			column[i] /= M[i * no_free + i];
+		}
+		for (int i = no_free - 1; i >= 0; i--) {
+			for (int k = i + 1; k < no_free; k++) {
+				column[i] -= M[k * no_free + i] * column[k];
+			}
+			column[i] /= M[i * no_free + i];
+		}
+
+		for (int k = 0; k < no_free; k++) {
+			retFit->covariance[index_free[k] * no_par + index_free[l]] =
+				2 * cost / no_dof * column[k] / (scale_free[k] *
+				scale_free[l]);
+		}
+	}
+
+	// Report missing convergence
+	//
+	if (!converged) {
+		if (status_report(STATUS_NO_CONVERGENCE, "fit_optimize",
+			no_iterations, sqrt(2 * cost))) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nLevenberg-Marquardt algorithm did not converge within "
+				"%i iterations.", no_iterations);
+			printf("\nReturn -1 for function call \"fit_optimize\".");
+		}
+		return -1;
+	}
+	return 0;
+}
+
+
+/*
+ * fit_report:
+ * -----------
+ *
+ * Writes fitted coefficients of a Fit-struct as JSON object in the format of
+ * isotherm equations of the database: Literature ("_c_"), name of equation
+ * ("_e_"), range of points ("_va_"), average relative error in percent and
+ * root-mean-square error ("_er_"), and coefficients ("_p_"). Covariance
+ * matrix is added as object of objects ("_cv_") whose keys are the names of
+ * coefficients.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path:
+ *		Path of JSON file. If path is NULL, JSON is printed to standard output.
+ *	const char *literature:
+ *		Literature of isotherm equation (i.e., NULL for empty literature).
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if JSON is written and -1 otherwise.
+ *
+ * Remarks:
+ * --------
+ *	Statistics and covariances that are not finite are written as null.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int fit_report(const char *path, const char *literature, void *fit) {
+	// Typecast void pointer given as input to pointer of Fit-struct
+	//
+	Fit *retFit = (Fit *) fit;
+
+	if (retFit == NULL) {
+		warning_struct("fit", "fit_report");
+		return -1;
+	}
+
+	// Calculate range of valid points
+	//
+	static const char *names_range[3] = {"pressure", "temperature",
+		"loading"};
+	double range[3][2] = {{DBL_MAX, -DBL_MAX}, {DBL_MAX, -DBL_MAX},
+		{DBL_MAX, -DBL_MAX}};
+
+	for (int i = 0; i < retFit->no_points; i++) {
+		for (int j = 0; retFit->valid[i] && j < 3; j++) {
+			range[j][0] = fmin(range[j][0], retFit->inputs[j][i]);
+			range[j][1] = fmax(range[j][1], retFit->inputs[j][i]);
+		}
+	}
+
+	// Create tree of JSON-structs in order of isotherm equations of database
+	//
+	const FitModel *model = retFit->model;
+	cJSON *json_report = cJSON_CreateObject();
+	cJSON *json_range = cJSON_CreateObject();
+	cJSON *json_errors = cJSON_CreateObject();
+	cJSON *json_par = cJSON_CreateObject();
+	cJSON *json_covariance = cJSON_CreateObject();
+
+	cJSON_AddStringToObject(json_report, "_c_",
+		(literature == NULL) ? "" : literature);
+	cJSON_AddStringToObject(json_report, "_n_", "");
+	cJSON_AddStringToObject(json_report, "_e_", model->wp_iso);
+
+	for (int j = 0; j < 3; j++) {
+		char name[32];
+
+		snprintf(name, sizeof(name), "%s-min", names_range[j]);
+		cJSON_AddNumberToObject(json_range, name, range[j][0]);
+		snprintf(name, sizeof(name), "%s-max", names_range[j]);
+		cJSON_AddNumberToObject(json_range, name, range[j][1]);
+	}
+	cJSON_AddItemToObject(json_report, "_va_", json_range);
+
+	// Statistics that are not finite are written as null, as JSON does not
+	// define infinite numbers
+	//
+	double statistics[2] = {100 * retFit->are, retFit->rmse};
+	const char *names_statistics[2] = {"are", "rmse"};
+
+	for (int j = 0; j < 2; j++) {
+		if (retFit->no_valid > 0 && surrogate_finite(statistics[j])) {
+			cJSON_AddNumberToObject(json_errors, names_statistics[j],
+				statistics[j]);
+		} else {
+			cJSON_AddNullToObject(json_errors, names_statistics[j]);
+		}
+	}
+	cJSON_AddItemToObject(json_report, "_er_", json_errors);
+
+	for (int j = 0; j < model->no_par; j++) {
+		cJSON *json_row = cJSON_CreateObject();
+
+		cJSON_AddNumberToObject(json_par, model->names[j], retFit->par[j]);
+
+		for (int k = 0; k < model->no_par; k++) {
+			double covariance = retFit->covariance[j * model->no_par + k];
+
+			if (surrogate_finite(covariance)) {
+				cJSON_AddNumberToObject(json_row, model->names[k],
+					covariance);
+			} else {
+				cJSON_AddNullToObject(json_row, model->names[k]);
+			}
+		}
+		cJSON_AddItemToObject(json_covariance, model->names[j], json_row);
+	}
+	cJSON_AddItemToObject(json_report, "_p_", json_par);
+	cJSON_AddItemToObject(json_report, "_cv_", json_covariance);
+
+	// Open file or use standard output and write JSON
+	//
+	char *report = cJSON_Print(json_report);
+	cJSON_Delete(json_report);
+
+	FILE *fp = NULL;
+
+	if (path == NULL) {
+		fp = stdout;
+
+	} else {
+		#ifdef __unix
+		fp = fopen(path, "wb");
+		#else
+		if (fopen_s(&fp, path, "wb") != 0) {
+			fp = NULL;
+		}
+		#endif
+	}
+
+	int error = (fp == NULL) || (report == NULL) ||
+		(fprintf(fp, "%s\n", report) < 0);
+
+	if (fp != NULL && fp != stdout) {
+		error = (fclose(fp) != 0) || error;
+	}
+	cJSON_free(report);
+
+	if (error) {
+		if (status_report(STATUS_INVALID_INPUT, "fit_report", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot write JSON to \"%s\".",
+				(path == NULL) ? "stdout" : path);
+			printf("\nReturn -1 for function call \"fit_report\".");
+		}
+		return -1;
+	}
+	return 0;
+}
+
+
+/*
+ * getFitNoCoefficients:
+ * ---------------------
+ *
+ * Returns number of coefficients of isotherm equation of a Fit-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of coefficients or -1 if Fit-struct does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getFitNoCoefficients(void *fit) {
+	// Typecast void pointer given as input to pointer of Fit-struct
+	//
+	Fit *retFit = (Fit *) fit;
+
+	if (retFit == NULL) {
+		warning_struct("fit", "getFitNoCoefficients");
+		return -1;
+	}
+	return retFit->model->no_par;
+}
+
+
+/*
+ * getFitNoPoints:
+ * ---------------
+ *
+ * Returns number of points of a Fit-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of points or -1 if Fit-struct does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getFitNoPoints(void *fit) {
+	// Typecast void pointer given as input to pointer of Fit-struct
+	//
+	Fit *retFit = (Fit *) fit;
+
+	if (retFit == NULL) {
+		warning_struct("fit", "getFitNoPoints");
+		return -1;
+	}
+	return retFit->no_points;
+}
+
+
+/*
+ * getFitCoefficientName:
+ * ----------------------
+ *
+ * Returns name of a coefficient of isotherm equation of a Fit-struct as used
+ * by the database.
+ *
+ * Parameters:
+ * -----------
+ *	int index:
+ *		Index of coefficient.
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * Returns:
+ * --------
+ *	const char *:
+ *		Name of coefficient or NULL if index or Fit-struct is invalid.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API const char *getFitCoefficientName(int index, void *fit) {
+	// Typecast void pointer given as input to pointer of Fit-struct
+	//
+	Fit *retFit = (Fit *) fit;
+
+	if (retFit == NULL) {
+		warning_struct("fit", "getFitCoefficientName");
+		return NULL;
+	}
+	return (index < 0 || index >= retFit->model->no_par) ? NULL :
+		retFit->model->names[index];
+}
+
+
+/*
+ * getFitCoefficients:
+ * -------------------
+ *
+ * Copies fitted coefficients and their covariance matrix of a Fit-struct.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_par:
+ *		Array to be filled with coefficients (i.e., NULL if not required).
+ *	double *ret_covariance:
+ *		Array to be filled with covariance matrix in row-major order (i.e.,
+ *		NULL if not required).
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if coefficients are copied and -1 otherwise.
+ *
+ * Remarks:
+ * --------
+ *	Covariances of fixed coefficients are zero. Covariances are not finite if
+ *	normal equations are singular or number of valid points does not exceed
+ *	number of fitted coefficients.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getFitCoefficients(double *ret_par, double *ret_covariance,
+	void *fit) {
+	// Typecast void pointer given as input to pointer of Fit-struct
+	//
+	Fit *retFit = (Fit *) fit;
+
+	if (retFit == NULL) {
+		warning_struct("fit", "getFitCoefficients");
+		return -1;
+	}
+
+	int no_par = retFit->model->no_par;
+
+	for (int j = 0; ret_par != NULL && j < no_par; j++) {
+		ret_par[j] = retFit->par[j];
+	}
+	for (int j = 0; ret_covariance != NULL && j < no_par * no_par; j++) {
+		ret_covariance[j] = retFit->covariance[j];
+	}
+	return 0;
+}
+
+
+/*
+ * getFitStatistics:
+ * -----------------
+ *
+ * Returns statistics of fitted coefficients of a Fit-struct.
+ *
+ * Parameters:
+ * -----------
+ *	int *ret_no_valid:
+ *		Pointer to be set to number of valid points.
+ *	int *ret_no_iterations:
+ *		Pointer to be set to number of iterations.
+ *	double *ret_rmse:
+ *		Pointer to be set to root-mean-square error.
+ *	double *ret_are:
+ *		Pointer to be set to average absolute relative deviation (i.e., not
+ *		in percent).
+ *	double *ret_max_error:
+ *		Pointer to be set to maximal absolute error.
+ * 	struct *Fit:
+ *		Pointer of Fit-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns status code of fit (i.e., STATUS_OK if algorithm converged)
+ *		or -1 if Fit-struct does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getFitStatistics(int *ret_no_valid, int *ret_no_iterations,
+	double *ret_rmse, double *ret_are, double *ret_max_error, void *fit) {
+	// Typecast void pointer given as input to pointer of Fit-struct
+	//
+	Fit *retFit = (Fit *) fit;
+
+	if (retFit == NULL) {
+		warning_struct("fit", "getFitStatistics");
+		return -1;
+	}
+
+	*ret_no_valid = retFit->no_valid;
+	*ret_no_iterations = retFit->no_iterations;
+	*ret_rmse = retFit->rmse;
+	*ret_are = retFit->are;
+	*ret_max_error = retFit->max_error;
+
+	return retFit->status;
+}
@@ -0,0 +1,795 @@
+////////////////////////////
+// workingPairScreening.c //
+////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "batchPool.h"
+#include "cJSON.h"
+#include "database.h"
+#include "workingPair.h"
+#include "workingPairBatch.h"
+#include "workingPairScreening.h"
+#include "status.h"
+#include "structDefinitions.c"
+
+
+///////////////////////////
+// Definition of structs //
+///////////////////////////
+/*
+ * ScreeningCandidate:
+ * -------------------
+ *
+ * Contains names and ID of an isotherm equation of a working pair found in the
+ * database. Candidates are sorted by isotherm type before working pairs are
+ * created.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_as:
+ *		Name of sorbent.
+ *	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ *	const char *wp_rf:
+ *		Name of refrigerant.
+ *	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm.
+ *	int index:
+ *		Position of candidate in database (i.e., keeps order of database within
+ *		one isotherm type).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/*
+ * Screening:
+ * ----------
+ *
+ * Contains all working pairs of a database that use a given refrigerant. Each
+ * isotherm equation and each ID of a working pair is a separate
+ * WorkingPair-struct. Working pairs are grouped by isotherm type, so threads
+ * evaluating neighboring working pairs call the same isotherm functions.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_rf:
+ *		Name of refrigerant used as filter (i.e., NULL or "" for all
+ *		refrigerants).
+ *	int no_workingPairs:
+ *		Number of working pairs.
+ *	WorkingPair **workingPairs:
+ *		Array containing pointers of WorkingPair-structs grouped by isotherm
+ *		type.
+ *
+ * Remarks:
+ * --------
+ *	Working pairs share interned refrigerants and names with the database.
+ *	Thus, the database must not be deleted before the Screening-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/*
+ * ScreeningEvaluation:
+ * --------------------
+ *
+ * Contains inputs and outputs of an evaluation of a function for all working
+ * pairs of a Screening-struct. Results are stored as dense matrix with one row
+ * per working pair and one column per state.
+ *
+ * Attributes:
+ * -----------
+ *	const BatchFunction *function:
+ *		Function that is evaluated.
+ *	double *ret_values:
+ *		Matrix to be filled with values of function.
+ *	double *ret_y_1_molmol:
+ *		Matrix to be filled with mole fractions of first component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	double *ret_y_2_molmol:
+ *		Matrix to be filled with mole fractions of second component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	int *ret_status:
+ *		Matrix to be filled with status codes (i.e., may be NULL).
+ *	const double **inputs:
+ *		Array containing arrays of inputs in order of inputs of function.
+ *	int no_points:
+ *		Number of states (i.e., number of columns).
+ *	const int *supported:
+ *		Array containing flags indicating whether working pairs support
+ *		function.
+ *	WorkingPair **workingPairs:
+ *		Array containing pointers of WorkingPair-structs.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * newScreening:
+ * -------------
+ *
+ * Initialization function to create a new Screening-struct. Therefore, function
+ * searches the database for all adsorption and absorption working pairs using
+ * the refrigerant wp_rf and creates one WorkingPair-struct per isotherm
+ * equation and ID. All working pairs use the same calculation approaches of the
+ * refrigerant. Working pairs that cannot be created are skipped.
+ *
+ * Parameters:
+ * -----------
+ *	struct *Database:
+ *		Pointer of Database-struct.
+ *	const char *wp_rf:
+ *		Name of refrigerant (i.e., NULL or "" to screen all refrigerants).
+ *	const char *rf_psat:
+ *		Name of calculation approach for vapor pressure.
+ *	int no_p_sat:
+ *		ID of vapor pressure equation.
+ *	const char *rf_rhol:
+ *		Name of calculation approach for liquid density.
+ *	int no_rhol:
+ *		ID of liquid density equation.
+ *
+ * Returns:
+ * --------
+ *	struct *Screening:
+ *		Returns malloc-ed Screening-struct or NULL if no working pair exists or
+ *		memory allocation fails.
+ *
+ * Remarks:
+ * --------
+ *	Names are not copied and must remain valid as long as the
+ *	Screening-struct exists.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API Screening *newScreening(Database *database, const char *wp_rf,
+	const char *rf_psat, int no_p_sat, const char *rf_rhol, int no_rhol) {
+	// Check if database exists
+	//
+	if (database == NULL) {
+		if (status_report(STATUS_INVALID_STRUCT, "newScreening", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nDatabase-struct does not exist.");
+		}
+		return NULL;
+	}
+
+	// Count isotherm equations and IDs first and save them afterwards
+	//
+	int no_candidates = screening_candidates(NULL, wp_rf, database->json_file);
+
+	if (no_candidates == 0) {
+		if (status_report(STATUS_DATABASE, "newScreening", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot find working pairs using refrigerant \"%s\".",
+				(wp_rf == NULL) ? "" : wp_rf);
+		}
+		return NULL;
+	}
+
+	// Try to allocate memory for Screening-struct
+	//
+	ScreeningCandidate *candidates = (ScreeningCandidate *) malloc(
+		no_candidates * sizeof(ScreeningCandidate));
+	Screening *retScreening = (Screening *) malloc(sizeof(Screening));
+	WorkingPair **workingPairs = (WorkingPair **) malloc(no_candidates *
+		sizeof(WorkingPair *));
+
+	if (candidates == NULL || retScreening == NULL || workingPairs == NULL) {
+		// Not enough memory available for Screening-struct
+		//
+		if (status_report(STATUS_NO_MEMORY, "newScreening", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for Screening-struct.");
+		}
+		free(candidates);
+		free(retScreening);
+		free(workingPairs);
+		return NULL;
+	}
+
+	// Group candidates by isotherm type
+	//
+	screening_candidates(candidates, wp_rf, database->json_file);
+	qsort(candidates, no_candidates, sizeof(ScreeningCandidate),
+		&screening_compare);
+
+	// Create working pairs and skip working pairs that cannot be created
+	// (e.g., isotherm types that are not implemented)
+	//
+	int no_workingPairs = 0;
+
+	for (int i = 0; i < no_candidates; i++) {
+		WorkingPair *workingPair = newWorkingPairDatabase(database,
+			candidates[i].wp_as, candidates[i].wp_st, candidates[i].wp_rf,
+			candidates[i].wp_iso, candidates[i].no_iso, rf_psat, no_p_sat,
+			rf_rhol, no_rhol);
+
+		if (workingPair != NULL) {
+			workingPairs[no_workingPairs] = workingPair;
+			no_workingPairs++;
+		}
+	}
+	free(candidates);
+
+	retScreening->wp_rf = wp_rf;
+	retScreening->no_workingPairs = no_workingPairs;
+	retScreening->workingPairs = workingPairs;
+	return retScreening;
+}
+
+
+/*
+ * delScreening:
+ * -------------
+ *
+ * Destructor function to free allocated memory of a Screening-struct and its
+ * working pairs.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Screening:
+ *		Pointer of Screening-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void delScreening(void *screening) {
+	// Typecast void pointer given as input to pointer of Screening-struct
+	//
+	Screening *retScreening = (Screening *) screening;
+
+	if (retScreening != NULL) {
+		for (int i = 0; i < retScreening->no_workingPairs; i++) {
+			delWorkingPair(retScreening->workingPairs[i]);
+		}
+		free(retScreening->workingPairs);
+		free(retScreening);
+	}
+}
+
+
+/*
+ * getScreeningNoWorkingPairs:
+ * ---------------------------
+ *
+ * Returns number of working pairs of a Screening-struct (i.e., number of rows
+ * of result matrix).
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Screening:
+ *		Pointer of Screening-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of working pairs or -1 if Screening-struct does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getScreeningNoWorkingPairs(void *screening) {
+	// Typecast void pointer given as input to pointer of Screening-struct
+	//
+	Screening *retScreening = (Screening *) screening;
+
+	return (retScreening == NULL) ? -1 : retScreening->no_workingPairs;
+}
+
+
+/*
+ * getScreeningWorkingPair:
+ * ------------------------
+ *
+ * Returns names and ID of isotherm of a working pair of a Screening-struct
+ * (i.e., of one row of result matrix).
+ *
+ * Parameters:
+ * -----------
+ *	const char **ret_wp_as:
+ *		Pointer to be set to name of sorbent.
+ *	const char **ret_wp_st:
+ *		Pointer to be set to name of sub-type of sorbent.
+ *	const char **ret_wp_rf:
+ *		Pointer to be set to name of refrigerant.
+ *	const char **ret_wp_iso:
+ *		Pointer to be set to name of isotherm.
+ *	int *ret_no_iso:
+ *		Pointer to be set to ID of isotherm.
+ *	int index:
+ *		Index of working pair.
+ * 	struct *Screening:
+ *		Pointer of Screening-struct.
+ *
+ * Returns:
+ * --------
+ *	struct *WorkingPair:
+ *		Returns pointer of WorkingPair-struct owned by Screening-struct or NULL
+ *		if working pair does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API WorkingPair *getScreeningWorkingPair(const char **ret_wp_as,
+	const char **ret_wp_st, const char **ret_wp_rf, const char **ret_wp_iso,
+	int *ret_no_iso, int index, void *screening) {
+	// Typecast void pointer given as input to pointer of Screening-struct
+	//
+	Screening *retScreening = (Screening *) screening;
+
+	if (retScreening == NULL || index < 0 ||
+		index >= retScreening->no_workingPairs) {
+		return NULL;
+	}
+
+	// Names and ID are set only if pointers are given
+	//
+	WorkingPair *workingPair = retScreening->workingPairs[index];
+
+	if (ret_wp_as != NULL) {
+		*ret_wp_as = workingPair->wp_as;
+	}
+	if (ret_wp_st != NULL) {
+		*ret_wp_st = workingPair->wp_st;
+	}
+	if (ret_wp_rf != NULL) {
+		*ret_wp_rf = workingPair->wp_rf;
+	}
+	if (ret_wp_iso != NULL) {
+		*ret_wp_iso = workingPair->wp_iso;
+	}
+	if (ret_no_iso != NULL) {
+		*ret_no_iso = workingPair->no_iso;
+	}
+	return workingPair;
+}
+
+
+/*
+ * screening_candidates:
+ * ---------------------
+ *
+ * Auxiliary function searching the database for all isotherm equations and IDs
+ * of adsorption and absorption working pairs using a refrigerant. Entries of
+ * refrigerants are skipped.
+ *
+ * Parameters:
+ * -----------
+ *	ScreeningCandidate *ret_candidates:
+ *		Array to be filled with candidates (i.e., NULL to count candidates
+ *		only).
+ *	const char *wp_rf:
+ *		Name of refrigerant (i.e., NULL or "" for all refrigerants).
+ *	struct *cJSON:
+ *		Pointer of cJSON-struct containing content of database.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of candidates.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int screening_candidates(ScreeningCandidate *ret_candidates,
+	const char *wp_rf, cJSON *json) {
+	// Search all entries (i.e. rows) of tree of JSON-structs for working pairs
+	// using refrigerant and skip refrigerants
+	//
+	int filter = (wp_rf != NULL && wp_rf[0] != '\0');
+	int no_candidates = 0;
+	cJSON *json_workingPair = NULL;
+
+	cJSON_ArrayForEach(json_workingPair, json) {
+		cJSON *json_info = cJSON_GetObjectItemCaseSensitive(json_workingPair,
+			"k");
+		cJSON *json_as = cJSON_GetObjectItemCaseSensitive(json_info, "_as_");
+		cJSON *json_st = cJSON_GetObjectItemCaseSensitive(json_info, "_st_");
+		cJSON *json_rf = cJSON_GetObjectItemCaseSensitive(json_info, "_rf_");
+		cJSON *json_tp = cJSON_GetObjectItemCaseSensitive(json_info, "_tp_");
+		cJSON *json_equations = cJSON_GetObjectItemCaseSensitive(
+			cJSON_GetObjectItemCaseSensitive(json_workingPair, "v"), "_ep_");
+
+		if (!cJSON_IsString(json_as) || !cJSON_IsString(json_st) ||
+			!cJSON_IsString(json_rf) || !cJSON_IsString(json_tp) ||
+			json_equations == NULL) {
+			continue;
+		}
+		if (strcmp(json_tp->valuestring, "ads") != 0 &&
+			strcmp(json_tp->valuestring, "abs") != 0) {
+			continue;
+		}
+		if (filter && strcmp(json_rf->valuestring, wp_rf) != 0) {
+			continue;
+		}
+
+		// Each element of array of an isotherm equation is one ID
+		//
+		cJSON *json_equation = NULL;
+
+		cJSON_ArrayForEach(json_equation, json_equations) {
+			int no_ids = cJSON_IsArray(json_equation) ?
+				cJSON_GetArraySize(json_equation) : 0;
+
+			for (int i_id = 1; i_id <= no_ids; i_id++) {
+				if (ret_candidates != NULL) {
+					ret_candidates[no_candidates].wp_as = json_as->valuestring;
+					ret_candidates[no_candidates].wp_st = json_st->valuestring;
+					ret_candidates[no_candidates].wp_rf = json_rf->valuestring;
+					ret_candidates[no_candidates].wp_iso =
+						json_equation->string;
+					ret_candidates[no_candidates].no_iso = i_id;
+					ret_candidates[no_candidates].index = no_candidates;
+				}
+				no_candidates++;
+			}
+		}
+	}
+	return no_candidates;
+}
+
+
+/*
+ * screening_compare:
+ * ------------------
+ *
+ * Auxiliary function comparing two ScreeningCandidate-structs by name of
+ * isotherm and position in database.
+ *
+ * Parameters:
+ * -----------
+ *	const void *a:
+ *		Pointer of first ScreeningCandidate-struct.
+ *	const void *b:
+ *		Pointer of second ScreeningCandidate-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Negative, zero, or positive value if first candidate is sorted before,
+ *		equal to, or after second candidate.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int screening_compare(const void *a, const void *b) {
+	const ScreeningCandidate *candidate_a = (const ScreeningCandidate *) a;
+	const ScreeningCandidate *candidate_b = (const ScreeningCandidate *) b;
+	int order = strcmp(candidate_a->wp_iso, candidate_b->wp_iso);
+
+	return (order != 0) ? order : candidate_a->index - candidate_b->index;
+}
+
+
+/*
+ * screening_supported:
+ * --------------------
+ *
+ * Auxiliary function checking whether a working pair implements the type of a
+ * function (e.g., adsorption, conventional absorption, activity coefficients,
+ * mixing rules, or tables). Thus, functions that are not implemented are not
+ * called and do not print a warning for each state.
+ *
+ * Parameters:
+ * -----------
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT").
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 1 if function can be evaluated and 0 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int screening_supported(const char *function, WorkingPair *workingPair) {
+	struct Adsorption *adsorption = workingPair->adsorption;
+	struct Absorption *absorption = workingPair->absorption;
+
+	// Check type of function by its prefix: Refrigerant functions are
+	// available for all working pairs
+	//
+	if (strncmp(function, "ads_sur_", 8) == 0) {
+		return adsorption != NULL && adsorption->sur_w_pT != NULL;
+
+	} else if (strncmp(function, "ads_vol_", 8) == 0) {
+		return adsorption != NULL && adsorption->vol_W_ARho != NULL;
+
+	} else if (strncmp(function, "ads_", 4) == 0) {
+		return adsorption != NULL;
+
+	} else if (strncmp(function, "abs_con_", 8) == 0) {
+		return absorption != NULL && absorption->con_X_pT != NULL;
+
+	} else if (strncmp(function, "abs_act_", 8) == 0) {
+		return absorption != NULL && absorption->act_g_Txv1v2 != NULL;
+
+	} else if (strncmp(function, "abs_mix_", 8) == 0) {
+		return absorption != NULL && absorption->mix_x_pT != NULL;
+
+	} else if (strncmp(function, "tab_", 4) == 0) {
+		return workingPair->tables != NULL;
+
+	}
+	return 1;
+}
+
+
+/*
+ * screening_kernel:
+ * -----------------
+ *
+ * Auxiliary function evaluating entries of the result matrix from a first
+ * entry to the entry after the last entry. Entries are numbered row by row and,
+ * thus, each chunk is split into parts of rows that are evaluated by
+ * batch_kernel. Function is called by threads of a BatchPool-struct.
+ *
+ * Parameters:
+ * -----------
+ *	int begin:
+ *		First entry.
+ *	int end:
+ *		Entry after last entry.
+ *	void *evaluation:
+ *		Pointer of ScreeningEvaluation-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void screening_kernel(int begin, int end, void *evaluation) {
+	// Typecast void pointer given as input to pointer of
+	// ScreeningEvaluation-struct
+	//
+	ScreeningEvaluation *retEvaluation = (ScreeningEvaluation *) evaluation;
+	int no_points = retEvaluation->no_points;
+
+	// Split chunk into parts of rows: Each part is evaluated by batch_kernel
+	// with arrays starting at its row
+	//
+	for (int i = begin; i < end; ) {
+		int row = i / no_points;
+		long offset = (long) row * no_points;
+		int point_begin = i - (int) offset;
+		int point_end = (end - offset < no_points) ? end - (int) offset :
+			no_points;
+
+		if (retEvaluation->supported[row]) {
+			BatchEvaluation evaluation_row = {retEvaluation->function,
+				retEvaluation->ret_values + offset,
+				(retEvaluation->ret_y_1_molmol == NULL) ? NULL :
+				retEvaluation->ret_y_1_molmol + offset,
+				(retEvaluation->ret_y_2_molmol == NULL) ? NULL :
+				retEvaluation->ret_y_2_molmol + offset,
+				(retEvaluation->ret_status == NULL) ? NULL :
+				retEvaluation->ret_status + offset,
+				retEvaluation->inputs, retEvaluation->workingPairs[row]};
+
+			batch_kernel(point_begin, point_end, &evaluation_row);
+		}
+		i += point_end - point_begin;
+	}
+}
+
+
+/*
+ * screening_evaluate:
+ * -------------------
+ *
+ * Evaluates a function for all working pairs of a Screening-struct and all
+ * states in parallel. Results are stored as dense matrix with one row per
+ * working pair and one column per state (i.e., value of working pair i at state
+ * j is stored at index i * no_points + j). All entries of the matrix are
+ * distributed among the threads of a BatchPool-struct by work stealing.
+ *
+ * Parameters:
+ * -----------
+ *	double *ret_values:
+ *		Matrix to be filled with values of function.
+ *	double *ret_y_1_molmol:
+ *		Matrix to be filled with mole fractions of first component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	double *ret_y_2_molmol:
+ *		Matrix to be filled with mole fractions of second component in vapor
+ *		phase (i.e., only for mixing rules and may be NULL).
+ *	int *ret_status:
+ *		Matrix to be filled with status codes (e.g., STATUS_OK or
+ *		STATUS_NOT_IMPLEMENTED for working pairs not implementing function).
+ *		If pointer is not NULL, no warnings are printed for single entries.
+ *		Pointer may be NULL.
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT").
+ *	const double **inputs:
+ *		Array containing arrays of inputs in order of inputs of function.
+ *	int no_points:
+ *		Number of states.
+ *	int grain_size:
+ *		Number of entries per chunk. If grain_size is smaller than 1, grain
+ *		size is chosen automatically.
+ *	struct *BatchPool:
+ *		Pointer of BatchPool-struct. If pointer is NULL, entries are evaluated
+ *		by calling thread.
+ * 	struct *Screening:
+ *		Pointer of Screening-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if function is evaluated and -1 otherwise. In case of an
+ *		error, all entries of returned matrix are set to -1.
+ *
+ * Remarks:
+ * --------
+ *	Rows of working pairs that do not implement function (e.g., absorption
+ *	working pairs for "ads_w_pT") are set to -1. Results are identical for any
+ *	number of threads and grain size.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int screening_evaluate(double *ret_values, double *ret_y_1_molmol,
+	double *ret_y_2_molmol, int *ret_status, const char *function,
+	const double **inputs, int no_points, int grain_size, void *batchPool,
+	void *screening) {
+	// Typecast void pointers given as inputs to correct structs
+	//
+	Screening *retScreening = (Screening *) screening;
+	const BatchFunction *retFunction = batch_function(function);
+
+	if (retScreening == NULL) {
+		warning_struct("screening", "screening_evaluate");
+		return -1;
+	}
+
+	long no_entries = (long) retScreening->no_workingPairs * no_points;
+
+	if (ret_values == NULL || no_points < 0 || no_entries > 2147483647L) {
+		if (status_report(STATUS_INVALID_INPUT, "screening_evaluate", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nArrays of states are invalid.");
+			printf("\nReturn -1 for function call \"screening_evaluate\".");
+		}
+		return -1;
+	}
+
+	// Check function and inputs
+	//
+	int valid = 0;
+
+	if (retFunction == NULL) {
+		if (status_report(STATUS_NOT_IMPLEMENTED, "screening_evaluate", 0,
+			0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nFunction \"%s\" cannot be evaluated for arrays of "
+				"states.",
+				(function == NULL) ? "" : function);
+			printf("\nReturn -1 for function call \"screening_evaluate\".");
+		}
+
+	} else if (inputs == NULL) {
+		if (status_report(STATUS_INVALID_INPUT, "screening_evaluate", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nInputs of function \"%s\" are missing.", function);
+			printf("\nReturn -1 for function call \"screening_evaluate\".");
+		}
+
+	} else {
+		valid = 1;
+		for (int i = 0; i < retFunction->no_inputs; i++) {
+			valid = valid && (inputs[i] != NULL);
+		}
+
+		if (!valid) {
+			if (status_report(STATUS_INVALID_INPUT, "screening_evaluate",
+				0, 0)) {
+				printf("\n\n###########\n# Warning #\n###########");
+				printf("\nInputs of function \"%s\" are missing.", function);
+				printf("\nReturn -1 for function call \"screening_evaluate\".");
+			}
+		}
+	}
+
+	// Rows of working pairs not implementing function are set to -1
+	//
+	int *supported = valid ? (int *) malloc(
+		(retScreening->no_workingPairs + 1) * sizeof(int)) : NULL;
+
+	if (supported != NULL) {
+		for (int i = 0; i < retScreening->no_workingPairs; i++) {
+			supported[i] = screening_supported(function,
+				retScreening->workingPairs[i]);
+
+			for (long j = (long) i * no_points; !supported[i] &&
+				j < (long) (i + 1) * no_points; j++) {
+				ret_values[j] = -1;
+				if (ret_y_1_molmol != NULL) {
+					ret_y_1_molmol[j] = -1;
+				}
+				if (ret_y_2_molmol != NULL) {
+					ret_y_2_molmol[j] = -1;
+				}
+				if (ret_status != NULL) {
+					ret_status[j] = STATUS_NOT_IMPLEMENTED;
+				}
+			}
+		}
+
+		// Evaluate entries by given pool or by calling thread
+		//
+		ScreeningEvaluation evaluation = {retFunction, ret_values,
+			ret_y_1_molmol, ret_y_2_molmol, ret_status, inputs, no_points,
+			supported, retScreening->workingPairs};
+
+		batchPool_run((BatchPool *) batchPool, (int) no_entries, grain_size,
+			&screening_kernel, &evaluation);
+
+		free(supported);
+		return 0;
+	}
+
+	// Indicate error for all entries
+	//
+	int code = getStatusCode();
+
+	for (long i = 0; i < no_entries; i++) {
+		ret_values[i] = -1;
+
+		if (ret_status != NULL) {
+			ret_status[i] = code;
+		}
+	}
+	return -1;
+}
@@ -0,0 +1,1105 @@
+///////////////////////////////
+// workingPairVerification.c //
+///////////////////////////////
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "batchPool.h"
+#include "cJSON.h"
+#include "database.h"
+#include "workingPair.h"
+#include "workingPairBatch.h"
+#include "workingPairScreening.h"
+#include "workingPairVerification.h"
+#include "status.h"
+#include "surrogate.h"
+#include "structDefinitions.c"
+
+
+///////////////////////////
+// Definition of structs //
+///////////////////////////
+/*
+ * VerificationRule:
+ * -----------------
+ *
+ * Describes how one type of experimental data is compared with a working pair:
+ * Function is evaluated with inputs taken from data sets or constant inputs,
+ * and result is compared with measured data set.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_tp:
+ *		Type of working pair (i.e., "ads" or "abs").
+ *	const char *type:
+ *		Type of experimental data (e.g., "isotherms").
+ *	const char *function:
+ *		Name of function (e.g., "ads_w_pT").
+ *	const char *measured:
+ *		Name of data set compared with values of function (e.g., "loadings").
+ *	const char *inputs[VERIFICATION_NO_INPUTS]:
+ *		Names of data sets used as inputs in order of inputs of function. If
+ *		name is NULL, constant input is used.
+ *	double constants[VERIFICATION_NO_INPUTS]:
+ *		Constant inputs (e.g., -1 to use molar volumes of database).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/*
+ * VerificationEntry:
+ * ------------------
+ *
+ * Contains one block of experimental data of the database, the isotherm
+ * equation and ID it is compared with, and the statistics of the comparison.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_as:
+ *		Name of sorbent.
+ *	const char *wp_st:
+ *		Name of sub-type of sorbent.
+ *	const char *wp_rf:
+ *		Name of refrigerant.
+ *	const char *wp_tp:
+ *		Type of working pair (i.e., "ads" or "abs").
+ *	const char *wp_iso:
+ *		Name of isotherm.
+ *	int no_iso:
+ *		ID of isotherm.
+ *	const char *literature:
+ *		Literature of isotherm equation and experimental data.
+ *	const char *type:
+ *		Type of experimental data (e.g., "isotherms").
+ *	cJSON *data:
+ *		Pointer of cJSON-struct containing data sets.
+ *	const VerificationRule *rule:
+ *		Rule used for comparison (i.e., NULL if data cannot be compared).
+ *	WorkingPair *workingPair:
+ *		Pointer of WorkingPair-struct (i.e., NULL if working pair cannot be
+ *		created).
+ *	int first_point:
+ *		Index of first point of entry.
+ *	int no_points:
+ *		Number of points of entry.
+ *	int status:
+ *		Status code of entry (e.g., STATUS_NOT_IMPLEMENTED if data cannot be
+ *		compared).
+ *	int no_valid:
+ *		Number of points that are evaluated without failure.
+ *	double rmse:
+ *		Root-mean-square error of valid points.
+ *	double aard:
+ *		Average absolute relative deviation of valid points.
+ *	double max_error:
+ *		Maximal absolute error of valid points.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+/*
+ * Verification:
+ * -------------
+ *
+ * Contains all blocks of experimental data of a database that can be assigned
+ * to an isotherm equation and the points of all blocks. Points are stored in
+ * flat arrays, so all points of all entries are evaluated by one call of a
+ * BatchPool-struct.
+ *
+ * Attributes:
+ * -----------
+ *	const char *wp_rf:
+ *		Name of refrigerant used as filter (i.e., NULL or "" for all
+ *		refrigerants).
+ *	int no_entries:
+ *		Number of entries.
+ *	VerificationEntry *entries:
+ *		Array containing entries.
+ *	int no_points:
+ *		Number of points of all entries.
+ *	double *inputs[VERIFICATION_NO_INPUTS]:
+ *		Arrays containing inputs of all points.
+ *	double *measured:
+ *		Array containing measured values of all points.
+ *	double *values:
+ *		Array containing calculated values of all points.
+ *	int *status:
+ *		Array containing status codes of all points.
+ *	int *point_entries:
+ *		Array containing index of entry of each point.
+ *
+ * Remarks:
+ * --------
+ *	Entries share names and data with the database. Thus, the database must
+ *	not be deleted before the Verification-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+
+
+
+/////////////////////////////////
+// Definition of static arrays //
+/////////////////////////////////
+/*
+ * verification_rules:
+ * -------------------
+ *
+ * Rules comparing experimental data with working pairs. Rules of same type of
+ * data are ordered by priority: Conventional absorption is used before mixing
+ * rules and mixing rules are used before activity coefficients, whose molar
+ * volumes are taken from the database.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+static const VerificationRule verification_rules[] = {
+	{"ads", "isotherms", "ads_w_pT", "loadings",
+		{"pressures", "temperatures", NULL, NULL}, {0, 0, 0, 0}},
+	{"ads", "isobars", "ads_w_pT", "loadings",
+		{"pressures", "temperatures", NULL, NULL}, {0, 0, 0, 0}},
+	{"ads", "isosteres", "ads_p_wT", "pressures",
+		{"loadings", "temperatures", NULL, NULL}, {0, 0, 0, 0}},
+	{"ads", "adsorption potentials", "ads_vol_W_ARho", "volumetricLoadings",
+		{"adsorptionPotentials", NULL, NULL, NULL}, {0, 1, 0, 0}},
+	{"abs", "isotherms", "abs_con_X_pT", "loadings",
+		{"pressures", "temperatures", NULL, NULL}, {0, 0, 0, 0}},
+	{"abs", "isotherms", "abs_mix_x_pT", "loadings",
+		{"pressures", "temperatures", NULL, NULL}, {0, 0, 0, 0}},
+	{"abs", "isotherms", "abs_act_x_pTv1v2", "loadings",
+		{"pressures", "temperatures", NULL, NULL}, {0, 0, -1, -1}},
+	{"abs", "isotherms_p", "abs_con_p_XT", "pressures",
+		{"loadings", "temperatures", NULL, NULL}, {0, 0, 0, 0}},
+	{"abs", "isotherms_p", "abs_mix_p_Tx", "pressures",
+		{"temperatures", "loadings", NULL, NULL}, {0, 0, 0, 0}},
+	{"abs", "isotherms_p", "abs_act_p_Txv1v2", "pressures",
+		{"temperatures", "loadings", NULL, NULL}, {0, 0, -1, -1}},
+	{"abs", "isosteres", "abs_con_p_XT", "pressures",
+		{"loadings", "temperatures", NULL, NULL}, {0, 0, 0, 0}},
+	{"abs", "isosteres", "abs_mix_p_Tx", "pressures",
+		{"temperatures", "loadings", NULL, NULL}, {0, 0, 0, 0}},
+	{"abs", "isosteres", "abs_act_p_Txv1v2", "pressures",
+		{"temperatures", "loadings", NULL, NULL}, {0, 0, -1, -1}}
+};
+
+
+
+/////////////////////////////
+// Definition of functions //
+/////////////////////////////
+/*
+ * newVerification:
+ * ----------------
+ *
+ * Initialization function to create a new Verification-struct. Therefore,
+ * function searches the database for all blocks of experimental data of
+ * adsorption and absorption working pairs using the refrigerant wp_rf. Each
+ * block is assigned to each isotherm equation and ID with the same literature.
+ * Calculation approaches of the refrigerant are chosen as first approach
+ * existing in the database (i.e., "VaporPressure_EoS1", "VaporPressure_EoS2",
+ * "VaporPressure_EoS3", "VaporPressure_EoSCubic", or "VaporPressure_Antoine"
+ * and "SaturatedLiquidDensity_EoS1").
+ *
+ * Parameters:
+ * -----------
+ *	struct *Database:
+ *		Pointer of Database-struct.
+ *	const char *wp_rf:
+ *		Name of refrigerant (i.e., NULL or "" to verify all refrigerants).
+ *
+ * Returns:
+ * --------
+ *	struct *Verification:
+ *		Returns malloc-ed Verification-struct or NULL if no experimental data
+ *		exists or memory allocation fails.
+ *
+ * Remarks:
+ * --------
+ *	Entries whose working pair cannot be created or whose type of data cannot
+ *	be compared are kept with a status code that is not STATUS_OK. Names are
+ *	not copied and must remain valid as long as the Verification-struct
+ *	exists.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API Verification *newVerification(Database *database, const char *wp_rf) {
+	// Check if database exists
+	//
+	if (database == NULL) {
+		if (status_report(STATUS_INVALID_STRUCT, "newVerification", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nDatabase-struct does not exist.");
+		}
+		return NULL;
+	}
+
+	// Count blocks of experimental data first and save them afterwards
+	//
+	int no_entries = verification_entries(NULL, wp_rf, database->json_file);
+
+	if (no_entries == 0) {
+		if (status_report(STATUS_DATABASE, "newVerification", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot find experimental data of working pairs using "
+				"refrigerant \"%s\".", (wp_rf == NULL) ? "" : wp_rf);
+		}
+		return NULL;
+	}
+
+	// Try to allocate memory for Verification-struct
+	//
+	Verification *retVerification = (Verification *) calloc(1,
+		sizeof(Verification));
+	VerificationEntry *entries = (VerificationEntry *) calloc(no_entries,
+		sizeof(VerificationEntry));
+
+	if (retVerification == NULL || entries == NULL) {
+		// Not enough memory available for Verification-struct
+		//
+		if (status_report(STATUS_NO_MEMORY, "newVerification", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for Verification-struct.");
+		}
+		free(retVerification);
+		free(entries);
+		return NULL;
+	}
+
+	verification_entries(entries, wp_rf, database->json_file);
+
+	retVerification->wp_rf = wp_rf;
+	retVerification->no_entries = no_entries;
+	retVerification->entries = entries;
+
+	// Create working pairs and choose rules in quiet mode: Entries that
+	// cannot be compared are kept, so report lists all experimental data
+	//
+	int quiet = status_quiet_thread(1);
+	int no_points = 0;
+
+	for (int i = 0; i < no_entries; i++) {
+		VerificationEntry *entry = &entries[i];
+		const char *rf_psat;
+		const char *rf_rhol;
+
+		verification_refrigerant(&rf_psat, &rf_rhol, entry->wp_rf,
+			database->json_file);
+		entry->workingPair = newWorkingPairDatabase(database, entry->wp_as,
+			entry->wp_st, entry->wp_rf, entry->wp_iso, entry->no_iso,
+			rf_psat, 1, rf_rhol, 1);
+		entry->rule = (entry->workingPair == NULL) ? NULL :
+			verification_rule(entry->wp_tp, entry->type, entry->workingPair);
+		entry->status = (entry->workingPair == NULL) ? STATUS_DATABASE :
+			((entry->rule == NULL) ? STATUS_NOT_IMPLEMENTED : STATUS_OK);
+		entry->rmse = -1;
+		entry->aard = -1;
+		entry->max_error = -1;
+
+		// Number of points is length of shortest data set used
+		//
+		if (entry->rule != NULL) {
+			cJSON *json_measured = cJSON_GetObjectItemCaseSensitive(
+				entry->data, entry->rule->measured);
+			int no_points_entry = cJSON_IsArray(json_measured) ?
+				cJSON_GetArraySize(json_measured) : 0;
+
+			for (int j = 0; j < VERIFICATION_NO_INPUTS; j++) {
+				if (entry->rule->inputs[j] != NULL) {
+					cJSON *json_input = cJSON_GetObjectItemCaseSensitive(
+						entry->data, entry->rule->inputs[j]);
+					int no_points_input = cJSON_IsArray(json_input) ?
+						cJSON_GetArraySize(json_input) : 0;
+
+					no_points_entry = (no_points_input < no_points_entry) ?
+						no_points_input : no_points_entry;
+				}
+			}
+
+			entry->first_point = no_points;
+			entry->no_points = no_points_entry;
+			entry->status = (no_points_entry > 0) ? STATUS_OK :
+				STATUS_DATABASE;
+			no_points += no_points_entry;
+		}
+	}
+	status_code();
+	status_quiet_thread(quiet);
+
+	// Try to allocate memory for points of all entries
+	//
+	int valid = 1;
+
+	for (int i = 0; i < VERIFICATION_NO_INPUTS; i++) {
+		retVerification->inputs[i] = (double *) malloc((no_points + 1) *
+			sizeof(double));
+		valid = valid && (retVerification->inputs[i] != NULL);
+	}
+	retVerification->no_points = no_points;
+	retVerification->measured = (double *) malloc((no_points + 1) *
+		sizeof(double));
+	retVerification->values = (double *) malloc((no_points + 1) *
+		sizeof(double));
+	retVerification->status = (int *) malloc((no_points + 1) * sizeof(int));
+	retVerification->point_entries = (int *) malloc((no_points + 1) *
+		sizeof(int));
+
+	if (!valid || retVerification->measured == NULL ||
+		retVerification->values == NULL || retVerification->status == NULL ||
+		retVerification->point_entries == NULL) {
+		// Not enough memory available for points
+		//
+		if (status_report(STATUS_NO_MEMORY, "newVerification", 0, 0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot allocate memory for points of "
+				"Verification-struct.");
+		}
+		delVerification(retVerification);
+		return NULL;
+	}
+
+	// Copy points: Data sets are arrays of numbers and missing or invalid
+	// numbers are copied as -1
+	//
+	for (int i = 0; i < no_entries; i++) {
+		VerificationEntry *entry = &entries[i];
+
+		if (entry->status != STATUS_OK) {
+			continue;
+		}
+
+		for (int j = 0; j <= VERIFICATION_NO_INPUTS; j++) {
+			const char *name = (j == VERIFICATION_NO_INPUTS) ?
+				entry->rule->measured : entry->rule->inputs[j];
+			double *points = (j == VERIFICATION_NO_INPUTS) ?
+				retVerification->measured : retVerification->inputs[j];
+			cJSON *json_points = (name == NULL) ? NULL :
+				cJSON_GetObjectItemCaseSensitive(entry->data, name);
+
+			for (int k = 0; k < entry->no_points; k++) {
+				cJSON *json_point = (json_points == NULL) ? NULL :
+					cJSON_GetArrayItem(json_points, k);
+
+				points[entry->first_point + k] = (name == NULL) ?
+					entry->rule->constants[j] : (cJSON_IsNumber(json_point) ?
+					json_point->valuedouble : -1);
+			}
+		}
+
+		for (int k = 0; k < entry->no_points; k++) {
+			retVerification->point_entries[entry->first_point + k] = i;
+		}
+	}
+	return retVerification;
+}
+
+
+/*
+ * delVerification:
+ * ----------------
+ *
+ * Destructor function to free allocated memory of a Verification-struct and
+ * its working pairs.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Verification:
+ *		Pointer of Verification-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void delVerification(void *verification) {
+	// Typecast void pointer given as input to pointer of Verification-struct
+	//
+	Verification *retVerification = (Verification *) verification;
+
+	if (retVerification != NULL) {
+		for (int i = 0; i < retVerification->no_entries; i++) {
+			delWorkingPair(retVerification->entries[i].workingPair);
+		}
+		for (int i = 0; i < VERIFICATION_NO_INPUTS; i++) {
+			free(retVerification->inputs[i]);
+		}
+		free(retVerification->entries);
+		free(retVerification->measured);
+		free(retVerification->values);
+		free(retVerification->status);
+		free(retVerification->point_entries);
+		free(retVerification);
+	}
+}
+
+
+/*
+ * verification_entries:
+ * ---------------------
+ *
+ * Auxiliary function searching the database for all blocks of experimental
+ * data that have the same literature as an isotherm equation of an adsorption
+ * or absorption working pair using a refrigerant.
+ *
+ * Parameters:
+ * -----------
+ *	VerificationEntry *ret_entries:
+ *		Array to be filled with entries (i.e., NULL to count entries only).
+ *	const char *wp_rf:
+ *		Name of refrigerant (i.e., NULL or "" for all refrigerants).
+ *	struct *cJSON:
+ *		Pointer of cJSON-struct containing content of database.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of entries.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int verification_entries(VerificationEntry *ret_entries, const char *wp_rf,
+	cJSON *json) {
+	// Search all entries (i.e. rows) of tree of JSON-structs for working pairs
+	// using refrigerant and skip refrigerants
+	//
+	int filter = (wp_rf != NULL && wp_rf[0] != '\0');
+	int no_entries = 0;
+	cJSON *json_workingPair = NULL;
+
+	cJSON_ArrayForEach(json_workingPair, json) {
+		cJSON *json_info = cJSON_GetObjectItemCaseSensitive(json_workingPair,
+			"k");
+		cJSON *json_values = cJSON_GetObjectItemCaseSensitive(
+			json_workingPair, "v");
+		cJSON *json_as = cJSON_GetObjectItemCaseSensitive(json_info, "_as_");
+		cJSON *json_st = cJSON_GetObjectItemCaseSensitive(json_info, "_st_");
+		cJSON *json_rf = cJSON_GetObjectItemCaseSensitive(json_info, "_rf_");
+		cJSON *json_tp = cJSON_GetObjectItemCaseSensitive(json_info, "_tp_");
+		cJSON *json_equations = cJSON_GetObjectItemCaseSensitive(json_values,
+			"_ep_");
+		cJSON *json_experiments = cJSON_GetObjectItemCaseSensitive(
+			json_values, "_ed_");
+
+		if (!cJSON_IsString(json_as) || !cJSON_IsString(json_st) ||
+			!cJSON_IsString(json_rf) || !cJSON_IsString(json_tp) ||
+			json_equations == NULL || !cJSON_IsArray(json_experiments)) {
+			continue;
+		}
+		if (strcmp(json_tp->valuestring, "ads") != 0 &&
+			strcmp(json_tp->valuestring, "abs") != 0) {
+			continue;
+		}
+		if (filter && strcmp(json_rf->valuestring, wp_rf) != 0) {
+			continue;
+		}
+
+		// Each element of array of an isotherm equation is one ID: Its
+		// literature is the criterion to assign experimental data
+		//
+		cJSON *json_equation = NULL;
+
+		cJSON_ArrayForEach(json_equation, json_equations) {
+			int no_ids = cJSON_IsArray(json_equation) ?
+				cJSON_GetArraySize(json_equation) : 0;
+
+			for (int i_id = 1; i_id <= no_ids; i_id++) {
+				cJSON *json_literature = cJSON_GetObjectItemCaseSensitive(
+					cJSON_GetArrayItem(json_equation, i_id - 1), "_c_");
+				cJSON *json_experiment = NULL;
+
+				if (!cJSON_IsString(json_literature)) {
+					continue;
+				}
+
+				cJSON_ArrayForEach(json_experiment, json_experiments) {
+					cJSON *json_source = cJSON_GetObjectItemCaseSensitive(
+						json_experiment, "_c_");
+					cJSON *json_type = cJSON_GetObjectItemCaseSensitive(
+						cJSON_GetObjectItemCaseSensitive(json_experiment,
+						"_m_"), "type");
+
+					if (!cJSON_IsString(json_source) ||
+						!cJSON_IsString(json_type) ||
+						strcmp(json_source->valuestring,
+						json_literature->valuestring) != 0) {
+						continue;
+					}
+
+					if (ret_entries != NULL) {
+						VerificationEntry *entry = &ret_entries[no_entries];
+
+						entry->wp_as = json_as->valuestring;
+						entry->wp_st = json_st->valuestring;
+						entry->wp_rf = json_rf->valuestring;
+						entry->wp_tp = json_tp->valuestring;
+						entry->wp_iso = json_equation->string;
+						entry->no_iso = i_id;
+						entry->literature = json_source->valuestring;
+						entry->type = json_type->valuestring;
+						entry->data = cJSON_GetObjectItemCaseSensitive(
+							json_experiment, "_d_");
+					}
+					no_entries++;
+				}
+			}
+		}
+	}
+	return no_entries;
+}
+
+
+/*
+ * verification_refrigerant:
+ * -------------------------
+ *
+ * Auxiliary function choosing calculation approaches of vapor pressure and
+ * liquid density of a refrigerant as first approaches existing in the
+ * database.
+ *
+ * Parameters:
+ * -----------
+ *	const char **ret_rf_psat:
+ *		Pointer to be set to name of calculation approach for vapor pressure.
+ *	const char **ret_rf_rhol:
+ *		Pointer to be set to name of calculation approach for liquid density.
+ *	const char *wp_rf:
+ *		Name of refrigerant.
+ *	struct *cJSON:
+ *		Pointer of cJSON-struct containing content of database.
+ *
+ * Remarks:
+ * --------
+ *	Names are set to "NoVaporPressure" or "NoSaturatedLiquidDensity" if no
+ *	approach exists.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void verification_refrigerant(const char **ret_rf_psat,
+	const char **ret_rf_rhol, const char *wp_rf, cJSON *json) {
+	// Approaches ordered by priority
+	//
+	static const char *approaches_psat[] = {"VaporPressure_EoS1",
+		"VaporPressure_EoS2", "VaporPressure_EoS3", "VaporPressure_EoSCubic",
+		"VaporPressure_Antoine"};
+
+	*ret_rf_psat = "NoVaporPressure";
+	*ret_rf_rhol = "NoSaturatedLiquidDensity";
+
+	// Search first entry of refrigerant
+	//
+	cJSON *json_refrigerant = NULL;
+
+	cJSON_ArrayForEach(json_refrigerant, json) {
+		cJSON *json_info = cJSON_GetObjectItemCaseSensitive(json_refrigerant,
+			"k");
+		cJSON *json_rf = cJSON_GetObjectItemCaseSensitive(json_info, "_rf_");
+		cJSON *json_tp = cJSON_GetObjectItemCaseSensitive(json_info, "_tp_");
+
+		if (!cJSON_IsString(json_rf) || !cJSON_IsString(json_tp) ||
+			strcmp(json_rf->valuestring, wp_rf) != 0 ||
+			strcmp(json_tp->valuestring, "refrig") != 0) {
+			continue;
+		}
+
+		cJSON *json_equations = cJSON_GetObjectItemCaseSensitive(
+			cJSON_GetObjectItemCaseSensitive(json_refrigerant, "v"), "_ep_");
+
+		for (int i = 0; i < 5; i++) {
+			if (cJSON_HasObjectItem(json_equations, approaches_psat[i])) {
+				*ret_rf_psat = approaches_psat[i];
+				break;
+			}
+		}
+		if (cJSON_HasObjectItem(json_equations,
+			"SaturatedLiquidDensity_EoS1")) {
+			*ret_rf_rhol = "SaturatedLiquidDensity_EoS1";
+		}
+		return;
+	}
+}
+
+
+/*
+ * verification_rule:
+ * ------------------
+ *
+ * Auxiliary function choosing rule used to compare a type of experimental data
+ * with a working pair: First rule matching type of data and being implemented
+ * by working pair is chosen (e.g., conventional absorption before mixing rules
+ * before activity coefficients).
+ *
+ * Parameters:
+ * -----------
+ *	const char *wp_tp:
+ *		Type of working pair (i.e., "ads" or "abs").
+ *	const char *type:
+ *		Type of experimental data (e.g., "isotherms").
+ * 	struct *WorkingPair:
+ *		Pointer of WorkingPair-struct.
+ *
+ * Returns:
+ * --------
+ *	const VerificationRule *:
+ *		Returns pointer of rule or NULL if no rule exists.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+const VerificationRule *verification_rule(const char *wp_tp, const char *type,
+	WorkingPair *workingPair) {
+	// Some blocks of database misspell type "isotherms_p"
+	//
+	const char *type_data = (strcmp(type, "isothersms_p") == 0) ?
+		"isotherms_p" : type;
+	int no_rules = (int) (sizeof(verification_rules) /
+		sizeof(verification_rules[0]));
+
+	for (int i = 0; i < no_rules; i++) {
+		if (strcmp(verification_rules[i].wp_tp, wp_tp) == 0 &&
+			strcmp(verification_rules[i].type, type_data) == 0 &&
+			screening_supported(verification_rules[i].function, workingPair)) {
+			return &verification_rules[i];
+		}
+	}
+	return NULL;
+}
+
+
+/*
+ * verification_kernel:
+ * --------------------
+ *
+ * Auxiliary function evaluating points from a first point to the point after
+ * the last point. Each chunk is split into parts of entries that are evaluated
+ * by batch_kernel. Function is called by threads of a BatchPool-struct.
+ *
+ * Parameters:
+ * -----------
+ *	int begin:
+ *		First point.
+ *	int end:
+ *		Point after last point.
+ *	void *verification:
+ *		Pointer of Verification-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void verification_kernel(int begin, int end, void *verification) {
+	// Typecast void pointer given as input to pointer of Verification-struct
+	//
+	Verification *retVerification = (Verification *) verification;
+	const double *inputs[VERIFICATION_NO_INPUTS];
+
+	for (int i = 0; i < VERIFICATION_NO_INPUTS; i++) {
+		inputs[i] = retVerification->inputs[i];
+	}
+
+	// Split chunk into parts of entries: Points of each entry are stored
+	// consecutively
+	//
+	for (int i = begin; i < end; ) {
+		VerificationEntry *entry = &retVerification->entries[
+			retVerification->point_entries[i]];
+		int point_end = entry->first_point + entry->no_points;
+
+		point_end = (point_end < end) ? point_end : end;
+
+		BatchEvaluation evaluation_entry = {
+			batch_function(entry->rule->function), retVerification->values,
+			NULL, NULL, retVerification->status, inputs, entry->workingPair};
+
+		batch_kernel(i, point_end, &evaluation_entry);
+		i = point_end;
+	}
+}
+
+
+/*
+ * verification_evaluate:
+ * ----------------------
+ *
+ * Evaluates all points of all entries of a Verification-struct in parallel and
+ * calculates statistics of each entry: Root-mean-square error, average
+ * absolute relative deviation, and maximal absolute error. Points are
+ * distributed among the threads of a BatchPool-struct by work stealing.
+ *
+ * Parameters:
+ * -----------
+ *	int grain_size:
+ *		Number of points per chunk. If grain_size is smaller than 1, grain
+ *		size is chosen automatically.
+ *	struct *BatchPool:
+ *		Pointer of BatchPool-struct. If pointer is NULL, points are evaluated
+ *		by calling thread.
+ * 	struct *Verification:
+ *		Pointer of Verification-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if points are evaluated and -1 otherwise.
+ *
+ * Remarks:
+ * --------
+ *	Points whose evaluation fails or whose value is not finite are not valid
+ *	and are excluded from statistics. Relative deviations are calculated with
+ *	a measured value of at least 1e-12. Results are identical for any number
+ *	of threads and grain size.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int verification_evaluate(int grain_size, void *batchPool,
+	void *verification) {
+	// Typecast void pointer given as input to pointer of Verification-struct
+	//
+	Verification *retVerification = (Verification *) verification;
+
+	if (retVerification == NULL) {
+		warning_struct("verification", "verification_evaluate");
+		return -1;
+	}
+
+	// Evaluate points by given pool or by calling thread
+	//
+	batchPool_run((BatchPool *) batchPool, retVerification->no_points,
+		grain_size, &verification_kernel, retVerification);
+
+	// Calculate statistics of each entry in order of points, so statistics
+	// do not depend on number of threads: Squared errors are scaled by
+	// maximal error, so root-mean-square error does not overflow for
+	// diverging equations
+	//
+	for (int i = 0; i < retVerification->no_entries; i++) {
+		VerificationEntry *entry = &retVerification->entries[i];
+		int first_point = entry->first_point;
+		int last_point = (entry->status == STATUS_OK) ?
+			first_point + entry->no_points : first_point;
+		double sum_relative = 0;
+		double max_error = 0;
+		int no_valid = 0;
+
+		for (int j = first_point; j < last_point; j++) {
+			double value = retVerification->values[j];
+			double measured = retVerification->measured[j];
+
+			if (retVerification->status[j] == STATUS_OK &&
+				surrogate_finite(value)) {
+				double error = fabs(value - measured);
+
+				sum_relative += error / ((measured > 1e-12) ? measured :
+					1e-12);
+				max_error = (error > max_error) ? error : max_error;
+				no_valid++;
+			}
+		}
+
+		double sum_squares = 0;
+
+		for (int j = first_point; max_error > 0 && j < last_point; j++) {
+			double value = retVerification->values[j];
+
+			if (retVerification->status[j] == STATUS_OK &&
+				surrogate_finite(value)) {
+				double error = fabs(value - retVerification->measured[j]) /
+					max_error;
+
+				sum_squares += error * error;
+			}
+		}
+
+		entry->no_valid = no_valid;
+		entry->rmse = (no_valid > 0) ? max_error * sqrt(sum_squares /
+			no_valid) : -1;
+		entry->aard = (no_valid > 0) ? sum_relative / no_valid : -1;
+		entry->max_error = (no_valid > 0) ? max_error : -1;
+	}
+	return 0;
+}
+
+
+/*
+ * verification_report:
+ * --------------------
+ *
+ * Writes statistics of all entries of a Verification-struct as JSON file.
+ * Statistics of entries without valid points and statistics that are not
+ * finite are written as null.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path:
+ *		Path of JSON file. If path is NULL, JSON is printed to standard output.
+ * 	struct *Verification:
+ *		Pointer of Verification-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if report is written and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int verification_report(const char *path, void *verification) {
+	// Typecast void pointer given as input to pointer of Verification-struct
+	//
+	Verification *retVerification = (Verification *) verification;
+
+	if (retVerification == NULL) {
+		warning_struct("verification", "verification_report");
+		return -1;
+	}
+
+	// Create tree of JSON-structs: Names and literature may contain
+	// characters that must be escaped
+	//
+	cJSON *json_report = cJSON_CreateObject();
+	cJSON *json_entries = cJSON_AddArrayToObject(json_report, "entries");
+	int no_evaluated = 0;
+	int no_valid = 0;
+
+	for (int i = 0; json_entries != NULL &&
+		i < retVerification->no_entries; i++) {
+		VerificationEntry *entry = &retVerification->entries[i];
+		cJSON *json_entry = cJSON_CreateObject();
+
+		cJSON_AddStringToObject(json_entry, "sorbent", entry->wp_as);
+		cJSON_AddStringToObject(json_entry, "subtype", entry->wp_st);
+		cJSON_AddStringToObject(json_entry, "refrigerant", entry->wp_rf);
+		cJSON_AddStringToObject(json_entry, "isotherm", entry->wp_iso);
+		cJSON_AddNumberToObject(json_entry, "id", entry->no_iso);
+		cJSON_AddStringToObject(json_entry, "type", entry->type);
+		cJSON_AddStringToObject(json_entry, "literature", entry->literature);
+		cJSON_AddStringToObject(json_entry, "status",
+			getStatusMessage(entry->status));
+
+		if (entry->rule == NULL) {
+			cJSON_AddNullToObject(json_entry, "function");
+			cJSON_AddNullToObject(json_entry, "measured");
+		} else {
+			cJSON_AddStringToObject(json_entry, "function",
+				entry->rule->function);
+			cJSON_AddStringToObject(json_entry, "measured",
+				entry->rule->measured);
+		}
+
+		cJSON_AddNumberToObject(json_entry, "points", entry->no_points);
+		cJSON_AddNumberToObject(json_entry, "valid-points", entry->no_valid);
+
+		// Statistics that are not finite (e.g., of diverging equations) are
+		// written as null, as JSON does not define infinite numbers
+		//
+		double statistics[3] = {entry->rmse, 100 * entry->aard,
+			entry->max_error};
+		const char *names_statistics[3] = {"rmse", "aard-percent",
+			"max-error"};
+
+		for (int j = 0; j < 3; j++) {
+			if (entry->no_valid > 0 && surrogate_finite(statistics[j])) {
+				cJSON_AddNumberToObject(json_entry, names_statistics[j],
+					statistics[j]);
+			} else {
+				cJSON_AddNullToObject(json_entry, names_statistics[j]);
+			}
+		}
+
+		cJSON_AddItemToArray(json_entries, json_entry);
+		no_evaluated += (entry->status == STATUS_OK);
+		no_valid += entry->no_valid;
+	}
+
+	cJSON_AddNumberToObject(json_report, "entries-total",
+		retVerification->no_entries);
+	cJSON_AddNumberToObject(json_report, "entries-evaluated", no_evaluated);
+	cJSON_AddNumberToObject(json_report, "points", retVerification->no_points);
+	cJSON_AddNumberToObject(json_report, "valid-points", no_valid);
+
+	// Open file or use standard output and write JSON
+	//
+	char *report = cJSON_Print(json_report);
+	cJSON_Delete(json_report);
+
+	FILE *fp = NULL;
+
+	if (path == NULL) {
+		fp = stdout;
+
+	} else {
+		#ifdef __unix
+		fp = fopen(path, "wb");
+		#else
+		if (fopen_s(&fp, path, "wb") != 0) {
+			fp = NULL;
+		}
+		#endif
+	}
+
+	int error = (fp == NULL) || (report == NULL) ||
+		(fprintf(fp, "%s\n", report) < 0);
+
+	if (fp != NULL && fp != stdout) {
+		error = (fclose(fp) != 0) || error;
+	}
+	cJSON_free(report);
+
+	if (error) {
+		if (status_report(STATUS_INVALID_INPUT, "verification_report", 0,
+			0)) {
+			printf("\n\n###########\n# Warning #\n###########");
+			printf("\nCannot write report to file \"%s\".",
+				(path == NULL) ? "stdout" : path);
+			printf("\nReturn -1 for function call \"verification_report\".");
+		}
+		return -1;
+	}
+	return 0;
+}
+
+
+/*
+ * getVerificationNoEntries:
+ * -------------------------
+ *
+ * Returns number of entries of a Verification-struct.
+ *
+ * Parameters:
+ * -----------
+ * 	struct *Verification:
+ *		Pointer of Verification-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Number of entries or -1 if Verification-struct does not exist.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getVerificationNoEntries(void *verification) {
+	// Typecast void pointer given as input to pointer of Verification-struct
+	//
+	Verification *retVerification = (Verification *) verification;
+
+	return (retVerification == NULL) ? -1 : retVerification->no_entries;
+}
+
+
+/*
+ * getVerificationStatistics:
+ * --------------------------
+ *
+ * Returns statistics of an entry of a Verification-struct.
+ *
+ * Parameters:
+ * -----------
+ *	int *ret_no_points:
+ *		Pointer to be set to number of points.
+ *	int *ret_no_valid:
+ *		Pointer to be set to number of valid points.
+ *	double *ret_rmse:
+ *		Pointer to be set to root-mean-square error.
+ *	double *ret_aard:
+ *		Pointer to be set to average absolute relative deviation.
+ *	double *ret_max_error:
+ *		Pointer to be set to maximal absolute error.
+ *	int index:
+ *		Index of entry.
+ * 	struct *Verification:
+ *		Pointer of Verification-struct.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns status code of entry or -1 if entry does not exist.
+ *
+ * Remarks:
+ * --------
+ *	Statistics are -1 if entry has no valid points or if points are not
+ *	evaluated yet.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int getVerificationStatistics(int *ret_no_points, int *ret_no_valid,
+	double *ret_rmse, double *ret_aard, double *ret_max_error, int index,
+	void *verification) {
+	// Typecast void pointer given as input to pointer of Verification-struct
+	//
+	Verification *retVerification = (Verification *) verification;
+
+	if (retVerification == NULL || index < 0 ||
+		index >= retVerification->no_entries) {
+		return -1;
+	}
+
+	// Statistics are set only if pointers are given
+	//
+	VerificationEntry *entry = &retVerification->entries[index];
+
+	if (ret_no_points != NULL) {
+		*ret_no_points = entry->no_points;
+	}
+	if (ret_no_valid != NULL) {
+		*ret_no_valid = entry->no_valid;
+	}
+	if (ret_rmse != NULL) {
+		*ret_rmse = entry->rmse;
+	}
+	if (ret_aard != NULL) {
+		*ret_aard = entry->aard;
+	}
+	if (ret_max_error != NULL) {
+		*ret_max_error = entry->max_error;
+	}
+	return entry->status;
+}
@@ -0,0 +1,460 @@
+Attribute VB_Name = "WorkingPairHandles"
+Option Explicit
+
+'''''''''''''''''''''''''''''''''''''''''''''''''''''''''''''''''''''
+' Create function wrappers to access functions from SorpPropLib-DLL '
+'''''''''''''''''''''''''''''''''''''''''''''''''''''''''''''''''''''
+' newWorkingPair:
+' ---------------
+'
+' Initiates WorkingPair-struct: Reads and parses database once and returns
+' handle of working pair.
+'
+' Parameters:
+' -----------
+'	const char *path_db:
+'		Path to database.
+' 	const char *wp_as:
+'		Name of sorbent.
+' 	const char *wp_st:
+'		Name of sub-type of sorbent.
+' 	const char *wp_rf:
+'		Name of refrigerant.
+' 	const char *wp_iso:
+'		Name of isotherm.
+'	int no_iso:
+'		ID of isotherm (i.e. when more than one isotherm is available)
+' 	const char *rf_psat:
+'		Name of calculation approach for vapor pressure.
+'	int no_p_sat:
+'		ID of vapor pressure equation (i.e. when more than one equation is
+'		available)
+' 	const char *rf_rhol:
+'		Name of calculation approach for liquid density.
+'	int no_rhol:
+'		ID of liquid density equation (i.e. when more than one equation is
+'		available)
+'
+' Returns:
+' --------
+'	struct *WorkingPair:
+'		Returns handle of working pair or 0 if working pair cannot be created.
+'
+' History:
+' --------
+'	10/18/2026, by agent:
+'		First implementation.
+'
+Private Declare PtrSafe Function newWorkingPair Lib "D:\Engelpracht\04-C\sorproplib\sorpproplib_JSON\excel_wrapper\data\win64bit\libsorpPropLib.dll" _
+(ByVal path_db As String, ByVal wp_as As String, ByVal wp_st As String, ByVal wp_rf As String, _
+ ByVal wp_iso As String, ByVal no_iso As Long, _
+ ByVal rf_psat As String, ByVal no_p_sat As Long, _
+ ByVal rf_rhol As String, ByVal no_rhol As Long) As LongPtr
+
+
+' delWorkingPair:
+' ---------------
+'
+' Frees memory of WorkingPair-struct.
+'
+' Parameters:
+' -----------
+'	struct *WorkingPair:
+'		Handle of working pair.
+'
+' History:
+' --------
+'	10/18/2026, by agent:
+'		First implementation.
+'
+Private Declare PtrSafe Sub delWorkingPair Lib "D:\Engelpracht\04-C\sorproplib\sorpproplib_JSON\excel_wrapper\data\win64bit\libsorpPropLib.dll" _
+(ByVal workingPair As LongPtr)
+
+
+' newBatchPool:
+' -------------
+'
+' Initiates pool of threads evaluating arrays of states.
+'
+' Parameters:
+' -----------
+'	int no_threads:
+'		Number of threads. If no_threads is smaller than 1, one thread per
+'		processor is started.
+'
+' Returns:
+' --------
+'	struct *BatchPool:
+'		Returns handle of pool or 0 if pool cannot be created.
+'
+' History:
+' --------
+'	10/18/2026, by agent:
+'		First implementation.
+'
+Private Declare PtrSafe Function newBatchPool Lib "D:\Engelpracht\04-C\sorproplib\sorpproplib_JSON\excel_wrapper\data\win64bit\libsorpPropLib.dll" _
+(ByVal no_threads As Long) As LongPtr
+
+
+' delBatchPool:
+' -------------
+'
+' Stops threads of pool and frees its memory.
+'
+' Parameters:
+' -----------
+'	struct *BatchPool:
+'		Handle of pool.
+'
+' History:
+' --------
+'	10/18/2026, by agent:
+'		First implementation.
+'
+Private Declare PtrSafe Sub delBatchPool Lib "D:\Engelpracht\04-C\sorproplib\sorpproplib_JSON\excel_wrapper\data\win64bit\libsorpPropLib.dll" _
+(ByVal batchPool As LongPtr)
+
+
+' batch_no_inputs:
+' ----------------
+'
+' Returns number of inputs of a function of the working pair that can be
+' evaluated for arrays of states.
+'
+' Parameters:
+' -----------
+'	const char *function:
+'		Name of function (e.g., "ads_w_pT").
+'
+' Returns:
+' --------
+'	int:
+'		Number of inputs or -1 if function does not exist.
+'
+' History:
+' --------
+'	10/18/2026, by agent:
+'		First implementation.
+'
+Private Declare PtrSafe Function batch_no_inputs Lib "D:\Engelpracht\04-C\sorproplib\sorpproplib_JSON\excel_wrapper\data\win64bit\libsorpPropLib.dll" _
+(ByVal func As String) As Long
+
+
+' batch_evaluate_columns:
+' -----------------------
+'
+' Evaluates a function of the working pair for arrays of states whose inputs
+' are given as columns of one matrix.
+'
+' Parameters:
+' -----------
+'	double *ret_values:
+'		First element of array to be filled with values of function.
+'	const char *function:
+'		Name of function (e.g., "ads_w_pT").
+'	const double *inputs:
+'		First element of matrix with one row per state and one column per
+'		input (i.e., VBA stores two-dimensional arrays column by column).
+'	int no_points:
+'		Number of states.
+'	struct *BatchPool:
+'		Handle of pool or 0 to start temporary pool.
+'	struct *WorkingPair:
+'		Handle of working pair.
+'
+' Returns:
+' --------
+'	int:
+'		Returns 0 if all states are calculated and -1 otherwise. States whose
+'		calculation fails are set to -1.
+'
+' History:
+' --------
+'	10/18/2026, by agent:
+'		First implementation.
+'
+Private Declare PtrSafe Function batch_evaluate_columns Lib "D:\Engelpracht\04-C\sorproplib\sorpproplib_JSON\excel_wrapper\data\win64bit\libsorpPropLib.dll" _
+(ByRef ret_values As Double, ByVal func As String, ByRef inputs As Double, _
+ ByVal no_points As Long, ByVal batchPool As LongPtr, ByVal workingPair As LongPtr) As Long
+
+
+
+''''''''''''''''''''''''''''''''''''''''''''''''''''
+' Define handles of working pairs of this workbook '
+''''''''''''''''''''''''''''''''''''''''''''''''''''
+' Handles of working pairs and pool: Handles live as long as workbook is open
+' (i.e., until ReleaseWorkingPairs is called or VBA project is reset)
+'
+Private wpair_keys As Collection
+Private wpair_handles() As LongPtr
+Private wpair_no As Long
+Private batch_pool As LongPtr
+
+
+
+''''''''''''''''''''''''''''''''''''''''''''''''''''''''''''
+' Define functions that can be accessed from the worksheet '
+''''''''''''''''''''''''''''''''''''''''''''''''''''''''''''
+' ws_wpair:
+' ---------
+'
+' Returns ID of working pair. Working pair is created once per workbook and
+' reused by all cells calling this function with the same arguments. Thus,
+' database is read and parsed once instead of once per cell.
+'
+' Returns:
+' --------
+'	Variant:
+'		ID of working pair or #VALUE! if working pair cannot be created.
+'
+' Remarks:
+' --------
+'	Working pair does not access its names after its creation. Thus, strings
+'	converted by VBA for the DLL call may be freed after the call.
+'
+' History:
+' --------
+'	10/18/2026, by agent:
+'		First implementation.
+'
+Function ws_wpair _
+(ByVal wp_as As String, ByVal wp_st As String, ByVal wp_rf As String, _
+ ByVal wp_iso As String, ByVal no_iso As Long, _
+ ByVal rf_psat As String, ByVal no_p_sat As Long, _
+ ByVal rf_rhol As String, ByVal no_rhol As Long) As Variant
+    ' Search working pair by its arguments
+    '
+    Dim path_JSON As String
+    Dim key As String
+    path_JSON = ThisWorkbook.Path & "\data\JSON\sorpproplib.json"
+    key = Join(Array(path_JSON, wp_as, wp_st, wp_rf, wp_iso, no_iso, _
+        rf_psat, no_p_sat, rf_rhol, no_rhol), vbTab)
+
+    If wpair_keys Is Nothing Then
+        Set wpair_keys = New Collection
+    End If
+
+    On Error Resume Next
+    ws_wpair = wpair_keys.Item(key)
+    If Err.Number = 0 Then
+        Exit Function
+    End If
+    On Error GoTo 0
+
+    ' Create working pair: Working pairs that cannot be created are not stored
+    '
+    Dim handle As LongPtr
+    handle = newWorkingPair(path_JSON, wp_as, wp_st, wp_rf, wp_iso, no_iso, _
+        rf_psat, no_p_sat, rf_rhol, no_rhol)
+
+    If handle = 0 Then
+        ws_wpair = CVErr(xlErrValue)
+        Exit Function
+    End If
+
+    wpair_no = wpair_no + 1
+    ReDim Preserve wpair_handles(1 To wpair_no)
+    wpair_handles(wpair_no) = handle
+    wpair_keys.Add wpair_no, key
+
+    ws_wpair = wpair_no
+
+End Function
+
+
+' ws_wpair_evaluate:
+' ------------------
+'
+' Evaluates a function of a working pair for a whole range of states by one
+' call of the DLL. Inputs are ranges, arrays, or numbers in the order of the
+' inputs of the function (e.g., pressures and temperatures for "ads_w_pT").
+' Numbers and single cells are used for all states.
+'
+' Returns:
+' --------
+'	Variant:
+'		Column of values that spills into the cells below (i.e., dynamic
+'		arrays) or fills the range of an array formula. Returns #VALUE! if
+'		inputs are invalid and #N/A if working pair does not exist.
+'
+' Remarks:
+' --------
+'	Mole fractions in vapor phase of mixing rules are not returned. For
+'	example, pressures of an isostere with a loading of 0.1 kg/kg at the
+'	temperatures of cells A2:A101 are returned by:
+'
+'	=ws_wpair_evaluate(ws_wpair("zeolite", "5a", "water", "Toth", 1,
+'		"VaporPressure_EoS1", 1, "SaturatedLiquidDensity_EoS1", 1),
+'		"ads_p_wT", 0.1, A2:A101)
+'
+' History:
+' --------
+'	10/18/2026, by agent:
+'		First implementation.
+'
+Function ws_wpair_evaluate _
+(ByVal id_wpair As Long, ByVal func As String, _
+ ParamArray inputs() As Variant) As Variant
+    ' Check working pair and number of inputs
+    '
+    If id_wpair < 1 Or id_wpair > wpair_no Then
+        ws_wpair_evaluate = CVErr(xlErrNA)
+        Exit Function
+    End If
+
+    Dim no_inputs As Long
+    no_inputs = UBound(inputs) - LBound(inputs) + 1
+
+    If no_inputs < 1 Or batch_no_inputs(func) <> no_inputs Then
+        ws_wpair_evaluate = CVErr(xlErrValue)
+        Exit Function
+    End If
+
+    ' Flatten inputs and determine number of states
+    '
+    Dim columns() As Variant
+    Dim no_points As Long
+    Dim j As Long
+    ReDim columns(1 To no_inputs)
+    no_points = 1
+
+    For j = 1 To no_inputs
+        columns(j) = ws_wpair_flatten(inputs(LBound(inputs) + j - 1))
+
+        If UBound(columns(j)) > 1 Then
+            If no_points > 1 And UBound(columns(j)) <> no_points Then
+                ws_wpair_evaluate = CVErr(xlErrValue)
+                Exit Function
+            End If
+            no_points = UBound(columns(j))
+        End If
+    Next j
+
+    ' Fill matrix column by column: Single values are used for all states
+    '
+    Dim matrix() As Double
+    Dim values() As Double
+    Dim i As Long
+    ReDim matrix(1 To no_points, 1 To no_inputs)
+    ReDim values(1 To no_points, 1 To 1)
+
+    For j = 1 To no_inputs
+        For i = 1 To no_points
+            If UBound(columns(j)) = 1 Then
+                matrix(i, j) = columns(j)(1)
+            Else
+                matrix(i, j) = columns(j)(i)
+            End If
+        Next i
+    Next j
+
+    ' Call DLL once for all states using pool of this workbook
+    '
+    If batch_pool = 0 Then
+        batch_pool = newBatchPool(0)
+    End If
+
+    Call batch_evaluate_columns(values(1, 1), func, matrix(1, 1), no_points, _
+        batch_pool, wpair_handles(id_wpair))
+
+    ws_wpair_evaluate = values
+
+End Function
+
+
+' ws_wpair_flatten:
+' -----------------
+'
+' Auxiliary function converting a range, an array, or a number into an array
+' of type double starting at index 1. Ranges are read row by row.
+'
+' History:
+' --------
+'	10/18/2026, by agent:
+'		First implementation.
+'
+Private Function ws_wpair_flatten(ByVal input_value As Variant) As Double()
+    Dim values() As Double
+    Dim element As Variant
+    Dim n As Long
+
+    If TypeName(input_value) = "Range" Then
+        input_value = input_value.Value
+    End If
+
+    If Not IsArray(input_value) Then
+        ReDim values(1 To 1)
+        values(1) = CDbl(input_value)
+        ws_wpair_flatten = values
+        Exit Function
+    End If
+
+    ' Read one-dimensional arrays element by element and two-dimensional
+    ' arrays (i.e., values of ranges) row by row
+    '
+    Dim r As Long
+    Dim c As Long
+
+    On Error Resume Next
+    c = UBound(input_value, 2)
+    If Err.Number <> 0 Then
+        On Error GoTo 0
+        ReDim values(1 To UBound(input_value) - LBound(input_value) + 1)
+        For Each element In input_value
+            n = n + 1
+            values(n) = CDbl(element)
+        Next element
+        ws_wpair_flatten = values
+        Exit Function
+    End If
+    On Error GoTo 0
+
+    ReDim values(1 To (UBound(input_value, 1) - LBound(input_value, 1) + 1) * _
+        (UBound(input_value, 2) - LBound(input_value, 2) + 1))
+    For r = LBound(input_value, 1) To UBound(input_value, 1)
+        For c = LBound(input_value, 2) To UBound(input_value, 2)
+            n = n + 1
+            values(n) = CDbl(input_value(r, c))
+        Next c
+    Next r
+    ws_wpair_flatten = values
+
+End Function
+
+
+
+''''''''''''''''''''''''''''''''''''''''''''''''''''''''
+' Define subs that free working pairs of this workbook '
+''''''''''''''''''''''''''''''''''''''''''''''''''''''''
+' ReleaseWorkingPairs:
+' --------------------
+'
+' Frees all working pairs and the pool of this workbook. Call this sub from
+' Workbook_BeforeClose of ThisWorkbook, e.g.:
+'
+'	Private Sub Workbook_BeforeClose(Cancel As Boolean)
+'		ReleaseWorkingPairs
+'	End Sub
+'
+' History:
+' --------
+'	10/18/2026, by agent:
+'		First implementation.
+'
+Sub ReleaseWorkingPairs()
+    Dim i As Long
+
+    For i = 1 To wpair_no
+        Call delWorkingPair(wpair_handles(i))
+    Next i
+
+    If batch_pool <> 0 Then
+        Call delBatchPool(batch_pool)
+    End If
+
+    Set wpair_keys = Nothing
+    Erase wpair_handles
+    wpair_no = 0
+    batch_pool = 0
+
+End Sub
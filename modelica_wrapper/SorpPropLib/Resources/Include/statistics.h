@@ -0,0 +1,628 @@
+//////////////////
+// statistics.h //
+//////////////////
+#ifndef statistics_h
+#define statistics_h
+#include "trace.h"
+
+
+//////////////////////////
+// Definition of macros //
+//////////////////////////
+#ifdef __unix
+	#ifdef DLL_EXPORTS
+	#define DLL_API __attribute__((visibility("default")))
+	#else
+	#define DLL_API
+	#endif
+#else
+	#ifdef DLL_EXPORTS
+	#define DLL_API __declspec(dllexport)
+	#else
+	#define DLL_API
+	#endif
+#endif
+
+
+/*
+ * STATISTICS_FUNCTIONS:
+ * ---------------------
+ *
+ * List of functions of the WorkingPair-struct whose calls are recorded. Each
+ * entry X(name) defines the index STATISTICS_FUNCTION_name.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#define STATISTICS_FUNCTIONS(X) \
+	X(ads_w_pT) X(ads_p_wT) X(ads_T_pw) X(ads_dw_dp_pT) X(ads_dw_dT_pT) \
+	X(ads_dp_dw_wT) X(ads_dp_dT_wT) X(ads_w_pT_der) X(ads_p_wT_der) \
+	X(ads_T_pw_der) X(ads_dw_dp_pT_der) X(ads_dw_dT_pT_der) \
+	X(ads_dp_dw_wT_der) X(ads_dp_dT_wT_der) X(ads_piStar_pyxgTM) \
+	X(ads_sur_w_pT) X(ads_sur_p_wT) X(ads_sur_T_pw) X(ads_sur_dw_dp_pT) \
+	X(ads_sur_dw_dT_pT) X(ads_sur_dp_dw_wT) X(ads_sur_dp_dT_wT) \
+	X(ads_sur_piStar_pyxgTM) X(ads_sur_w_pTpsat) X(ads_sur_p_wTpsat) \
+	X(ads_sur_T_pwpsat) X(ads_sur_dw_dp_pTpsat) X(ads_sur_dw_dT_pTpsat) \
+	X(ads_sur_dp_dw_wTpsat) X(ads_sur_dp_dT_wTpsat) \
+	X(ads_sur_piStar_pyxgTpsatM) X(ads_vol_W_ARho) X(ads_vol_A_WRho) \
+	X(ads_vol_w_pTpsatRho) X(ads_vol_p_wTpsatRho) X(ads_vol_T_pwpsatRho) \
+	X(ads_vol_dW_dA_ARho) X(ads_vol_dA_dW_WRho) X(ads_vol_dw_dp_pTpsatRho) \
+	X(ads_vol_dw_dT_pTpsatRho) X(ads_vol_dp_dw_wTpsatRho) \
+	X(ads_vol_dp_dT_wTpsatRho) X(ads_vol_piStar_pyxgTpsatRhoM) \
+	X(abs_con_X_pT) X(abs_con_p_XT) X(abs_con_T_pX) X(abs_con_dX_dp_pT) \
+	X(abs_con_dX_dT_pT) X(abs_con_dp_dX_XT) X(abs_con_dp_dT_XT) \
+	X(abs_con_X_pT_der) X(abs_con_p_XT_der) X(abs_con_T_pX_der) \
+	X(abs_con_dX_dp_pT_der) X(abs_con_dX_dT_pT_der) X(abs_con_dp_dX_XT_der) \
+	X(abs_con_dp_dT_XT_der) X(abs_act_g_Txv1v2) X(abs_act_p_Txv1v2psat) \
+	X(abs_act_x_pTv1v2psat) X(abs_act_p_Txv1v2) X(abs_act_x_pTv1v2) \
+	X(abs_mix_x_pT) X(abs_mix_p_Tx) X(abs_mix_T_px) X(abs_mix_dp_dx_Tx) \
+	X(abs_mix_dp_dT_Tx) X(abs_mix_dp_dx_Tx_der) X(abs_mix_dp_dT_Tx_der) \
+	X(ref_p_sat_T) X(ref_dp_sat_dT_T) X(ref_rho_l_T) X(ref_drho_l_dT_T) \
+	X(ref_T_sat_p) X(ref_p_sat_T_der) X(ref_T_sat_p_der) X(ref_rho_l_T_der) \
+	X(ref_dp_sat_dT_T_der) X(ref_drho_l_dT_T_der) X(tab_w_pT) X(tab_p_wT) \
+	X(tab_T_pw) X(tab_w_pT_der) X(tab_p_wT_der) X(tab_T_pw_der)
+
+
+/*
+ * STATISTICS_SOLVERS:
+ * -------------------
+ *
+ * List of iterative solvers whose numbers of iterations are recorded. Each
+ * entry X(name) defines the index STATISTICS_SOLVER_name.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#define STATISTICS_SOLVERS(X) \
+	X(adsorption_dualSiteSips_p_wT) \
+	X(adsorption_dualSiteSips_T_pw) \
+	X(adsorption_dubininArctan1_T_pwpsatRho) \
+	X(adsorption_dubininAstakhov_T_pwpsatRho) \
+	X(adsorption_freundlich_T_pwpsat) \
+	X(adsorption_toth_T_pw) \
+	X(absorption_antoine_X_pT) \
+	X(absorption_antoine_T_pX) \
+	X(absorption_duehring_X_pT) \
+	X(absorption_activity_floryhuggins_x_pTgpsat) \
+	X(absorption_activity_heil_x_pTv1v2psat) \
+	X(absorption_activity_nrtl_x_pTgpsat) \
+	X(absorption_activity_tsubokakatayama_x_pTv1v2psat) \
+	X(absorption_activity_uniquac_x_pTgpsat) \
+	X(absorption_activity_wangchao_x_pTv1v2psat) \
+	X(absorption_activity_wilson_x_pTv1v2psat) \
+	X(absorption_mixing_p_Tx_internal) \
+	X(absorption_mixing_T_px) \
+	X(absorption_mixing_x_pT) \
+	X(refrigerant_T_sat_eos1) \
+	X(refrigerant_T_sat_eos2) \
+	X(refrigerant_T_sat_eos3) \
+	X(refrigerant_p_sat_cubic_internal) \
+	X(refrigerant_T_sat_cubic)
+
+
+/*
+ * STATISTICS_BEGIN / STATISTICS_RETURN / STATISTICS_SOLVER:
+ * ---------------------------------------------------------
+ *
+ * Macros instrumenting functions. STATISTICS_BEGIN starts the time measurement
+ * at the beginning of a function, STATISTICS_RETURN(name, value) records the
+ * call and its time and evaluates to value, and STATISTICS_SOLVER(name,
+ * iterations, converged) records the iterations of a solver.
+ *
+ * Remarks:
+ * --------
+ *	Instrumentation is only compiled if SORP_STATS is defined (e.g., by
+ *	"make STATISTICS=YES"). Otherwise, macros expand to their value or to
+ *	nothing and do not cost any time. Macros also record calls if SORP_TRACE
+ *	is defined (see trace.h).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#ifdef SORP_STATS
+	#define STATISTICS_BEGIN \
+		unsigned long long statistics_start_ns = statistics_now_ns()
+	#define STATISTICS_RETURN(name, value) \
+		TRACE_RETURN(statistics_function(STATISTICS_FUNCTION_##name, \
+			statistics_start_ns, (value)))
+	#define STATISTICS_SOLVER(name, iterations, converged) \
+		(statistics_solver(STATISTICS_SOLVER_##name, (iterations), \
+			(converged)), TRACE_SOLVER(iterations))
+#else
+	#define STATISTICS_BEGIN \
+		((void) 0)
+	#define STATISTICS_RETURN(name, value) \
+		TRACE_RETURN(value)
+	#define STATISTICS_SOLVER(name, iterations, converged) \
+		TRACE_SOLVER(iterations)
+#endif
+
+
+/////////////////////////////
+// Definition of constants //
+/////////////////////////////
+/*
+ * STATISTICS_FUNCTION_* / STATISTICS_SOLVER_*:
+ * --------------------------------------------
+ *
+ * Indices of functions and solvers generated from STATISTICS_FUNCTIONS and
+ * STATISTICS_SOLVERS. STATISTICS_NO_FUNCTIONS and STATISTICS_NO_SOLVERS are
+ * the numbers of functions and solvers.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#define STATISTICS_INDEX_FUNCTION(name) STATISTICS_FUNCTION_##name,
+#define STATISTICS_INDEX_SOLVER(name) STATISTICS_SOLVER_##name,
+
+enum {
+	STATISTICS_FUNCTIONS(STATISTICS_INDEX_FUNCTION)
+	STATISTICS_NO_FUNCTIONS
+};
+
+enum {
+	STATISTICS_SOLVERS(STATISTICS_INDEX_SOLVER)
+	STATISTICS_NO_SOLVERS
+};
+
+
+/*
+ * STATISTICS_NO_BINS_TIME:
+ * ------------------------
+ *
+ * Number of bins of latency histograms. Bin 0 counts calls shorter than 1 ns
+ * and bin i counts calls lasting from 2^(i-1) ns to less than 2^i ns (i.e., the
+ * last bin counts all longer calls).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#ifndef STATISTICS_NO_BINS_TIME
+#define STATISTICS_NO_BINS_TIME 32
+#endif
+
+
+/*
+ * STATISTICS_NO_BINS_ITERATIONS:
+ * ------------------------------
+ *
+ * Number of bins of iteration histograms. Bin 0 counts calls without
+ * iterations and bin i counts calls requiring from 2^(i-1) to 2^i - 1
+ * iterations (i.e., the last bin counts all calls requiring more iterations).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+#ifndef STATISTICS_NO_BINS_ITERATIONS
+#define STATISTICS_NO_BINS_ITERATIONS 12
+#endif
+
+
+////////////////////////////
+// Definition of typedefs //
+////////////////////////////
+/*
+ * StatisticsFunction:
+ * -------------------
+ *
+ * Contains statistics of calls of a function.
+ *
+ * Attributes:
+ * -----------
+ *	const char *name:
+ *		Name of function.
+ *	unsigned long long no_calls:
+ *		Number of calls.
+ *	unsigned long long time_ns:
+ *		Cumulative time of all calls in ns.
+ *	unsigned long long bins[]:
+ *		Latency histogram with logarithmic bins (see STATISTICS_NO_BINS_TIME).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct StatisticsFunction StatisticsFunction;
+
+
+/*
+ * StatisticsSolver:
+ * -----------------
+ *
+ * Contains statistics of calls of an iterative solver.
+ *
+ * Attributes:
+ * -----------
+ *	const char *name:
+ *		Name of solver.
+ *	unsigned long long no_calls:
+ *		Number of calls.
+ *	unsigned long long no_failures:
+ *		Number of calls that did not converge.
+ *	unsigned long long iterations:
+ *		Cumulative number of iterations of all calls.
+ *	unsigned long long bins[]:
+ *		Iteration histogram with logarithmic bins (see
+ *		STATISTICS_NO_BINS_ITERATIONS).
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct StatisticsSolver StatisticsSolver;
+
+
+/*
+ * Statistics:
+ * -----------
+ *
+ * Contains snapshot of statistics of all instrumented functions and solvers.
+ *
+ * Attributes:
+ * -----------
+ *	int enabled:
+ *		Flag indicating whether instrumentation is compiled (i.e., whether
+ *		SORP_STATS was defined).
+ *	StatisticsFunction functions[]:
+ *		Statistics of functions of the WorkingPair-struct.
+ *	StatisticsSolver solvers[]:
+ *		Statistics of iterative solvers.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+typedef struct Statistics Statistics;
+
+
+///////////////////////////////////////
+// Definition of function prototypes //
+///////////////////////////////////////
+/*
+ * statistics_now_ns:
+ * ------------------
+ *
+ * Auxiliary function returning current time of a monotonic clock in ns.
+ *
+ * Returns:
+ * --------
+ *	unsigned long long:
+ *		Current time in ns.
+ *
+ * Remarks:
+ * --------
+ *	Only differences of returned values are meaningful.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+unsigned long long statistics_now_ns(void);
+
+
+/*
+ * statistics_bin:
+ * ---------------
+ *
+ * Auxiliary function returning logarithmic bin of a value (i.e., number of
+ * binary digits of value limited to last bin).
+ *
+ * Parameters:
+ * -----------
+ *	unsigned long long value:
+ *		Value to be sorted into bins.
+ *	int no_bins:
+ *		Number of bins.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Bin of value.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+int statistics_bin(unsigned long long value, int no_bins);
+
+
+/*
+ * statistics_function:
+ * --------------------
+ *
+ * Auxiliary function recording a call of a function of the WorkingPair-struct
+ * and its time. Function is called by macro STATISTICS_RETURN.
+ *
+ * Parameters:
+ * -----------
+ *	int index:
+ *		Index of function (i.e., STATISTICS_FUNCTION_*).
+ *	unsigned long long start_ns:
+ *		Time at beginning of call in ns.
+ *	double value:
+ *		Value returned by function.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Returns value given as input.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+double statistics_function(int index, unsigned long long start_ns,
+	double value);
+
+
+/*
+ * statistics_solver:
+ * ------------------
+ *
+ * Auxiliary function recording a call of an iterative solver. Function is
+ * called by macro STATISTICS_SOLVER.
+ *
+ * Parameters:
+ * -----------
+ *	int index:
+ *		Index of solver (i.e., STATISTICS_SOLVER_*).
+ *	int iterations:
+ *		Number of iterations.
+ *	int converged:
+ *		Flag indicating whether solver converged.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+void statistics_solver(int index, int iterations, int converged);
+
+
+/*
+ * sorp_stats_enabled:
+ * -------------------
+ *
+ * Returns flag indicating whether instrumentation is compiled.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 1 if library is compiled with SORP_STATS and 0 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int sorp_stats_enabled(void);
+
+
+/*
+ * sorp_stats_snapshot:
+ * --------------------
+ *
+ * Creates snapshot of statistics of all threads. Statistics keep being
+ * recorded while and after snapshot is created.
+ *
+ * Returns:
+ * --------
+ *	struct *Statistics:
+ *		Returns pointer of Statistics-struct or NULL if memory cannot be
+ *		allocated.
+ *
+ * Remarks:
+ * --------
+ *	Snapshot must be deleted by delStatistics. Counters are read one by one
+ *	and, thus, calls of other threads during snapshot may only be partially
+ *	contained.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API Statistics *sorp_stats_snapshot(void);
+
+
+/*
+ * sorp_stats_reset:
+ * -----------------
+ *
+ * Resets statistics of all threads.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void sorp_stats_reset(void);
+
+
+/*
+ * sorp_stats_dump:
+ * ----------------
+ *
+ * Writes statistics as JSON file. Only functions and solvers that have been
+ * called are written.
+ *
+ * Parameters:
+ * -----------
+ *	const char *path:
+ *		Path of JSON file. If path is NULL, JSON is printed to standard output.
+ *	void *statistics:
+ *		Pointer of Statistics-struct. If pointer is NULL, a new snapshot is
+ *		taken.
+ *
+ * Returns:
+ * --------
+ *	int:
+ *		Returns 0 if statistics are written and -1 otherwise.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API int sorp_stats_dump(const char *path, void *statistics);
+
+
+/*
+ * delStatistics:
+ * --------------
+ *
+ * Frees memory of Statistics-struct.
+ *
+ * Parameters:
+ * -----------
+ *	void *statistics:
+ *		Pointer of Statistics-struct.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API void delStatistics(void *statistics);
+
+
+/*
+ * getStatisticsNoCalls:
+ * ---------------------
+ *
+ * Returns number of calls of a function or solver of a snapshot.
+ *
+ * Parameters:
+ * -----------
+ *	const char *name:
+ *		Name of function or solver (e.g., "ads_w_pT").
+ *	void *statistics:
+ *		Pointer of Statistics-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Number of calls or -1 if function or solver is not instrumented.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double getStatisticsNoCalls(const char *name, void *statistics);
+
+
+/*
+ * sorp_stats_no_calls:
+ * --------------------
+ *
+ * Returns number of calls of all instrumented functions of all threads since
+ * last reset (e.g., to count external function calls of a Modelica simulation
+ * with and without derivative annotations).
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Number of calls or -1 if library is not compiled with SORP_STATS or
+ *		memory of snapshot cannot be allocated.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double sorp_stats_no_calls(void);
+
+
+/*
+ * getStatisticsTime:
+ * ------------------
+ *
+ * Returns cumulative time of all calls of a function of a snapshot.
+ *
+ * Parameters:
+ * -----------
+ *	const char *name:
+ *		Name of function (e.g., "ads_w_pT").
+ *	void *statistics:
+ *		Pointer of Statistics-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Cumulative time in s or -1 if function is not instrumented.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double getStatisticsTime(const char *name, void *statistics);
+
+
+/*
+ * getStatisticsNoFailures:
+ * ------------------------
+ *
+ * Returns number of calls of a solver of a snapshot that did not converge.
+ *
+ * Parameters:
+ * -----------
+ *	const char *name:
+ *		Name of solver (e.g., "absorption_mixing_p_Tx_internal").
+ *	void *statistics:
+ *		Pointer of Statistics-struct.
+ *
+ * Returns:
+ * --------
+ *	double:
+ *		Number of failures or -1 if solver is not instrumented.
+ *
+ * History:
+ * --------
+ *	10/18/2026, by agent:
+ *		First implementation.
+ *
+ */
+DLL_API double getStatisticsNoFailures(const char *name, void *statistics);
+
+#endif
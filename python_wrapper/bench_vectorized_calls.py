@@ -0,0 +1,159 @@
+"""Script 'bench_vectorized_calls'.
+
+This script compares the cost per state of the scalar functions of the module 'wpair' with the
+cost per state of their array counterparts (i.e., functions with the suffix '_array'). First,
+different working pairs are defined. Second, each function is evaluated for growing numbers of
+states by a list comprehension over the scalar function and by one call of the array function.
+Third, the time per state and the maximal relative deviation between both results are printed.
+
+The paths of the SorpPropLib.DLL and the JSON database can be passed as first and second argument.
+
+Revisions:
+----------
+    Version     Date        Author              Changes
+    1.0.0       2026-10-18  agent               First implementation
+"""
+
+# %% Import relevant modules.
+#
+import os
+import struct
+import sys
+import time
+
+from numpy import abs as np_abs, asarray, full, linspace, maximum, nanmax
+
+from sorpproplib.wpair.wpair_struct import WPairStruct
+
+
+# %% Definition of functions to benchmark working pairs.
+#
+def bench_function(name, func_scalar, func_array, inputs, no_repetitions=3):
+    r"""Print time per state of scalar and array function for given inputs."""
+    # Time scalar function: Only evaluate first states to limit run time
+    #
+    no_states = inputs[0].size
+    no_scalar = min(no_states, 10000)
+
+    time_scalar = float('inf')
+    for _ in range(no_repetitions):
+        start = time.perf_counter()
+        res_scalar = [func_scalar(*[float(val[ind]) for val in inputs])
+                      for ind in range(no_scalar)]
+        time_scalar = min(time_scalar, time.perf_counter() - start)
+
+    # Time array function
+    #
+    time_array = float('inf')
+    for _ in range(no_repetitions):
+        start = time.perf_counter()
+        res_array = func_array(*inputs)
+        time_array = min(time_array, time.perf_counter() - start)
+
+    # Compare results of scalar and array function
+    #
+    res_scalar = asarray([val[0] if isinstance(val, tuple) else val for val in res_scalar])
+    res_array = res_array[0] if isinstance(res_array, tuple) else res_array
+    dev = nanmax(np_abs(res_array[:no_scalar] - res_scalar) /
+                 maximum(np_abs(res_scalar), 1e-12))
+
+    print("{:<30s} {:>9d} {:>14.1f} {:>14.1f} {:>9.1f} {:>12.2e}".format(
+        name, no_states, time_scalar / no_scalar * 1e9, time_array / no_states * 1e9,
+        (time_scalar / no_scalar) / (time_array / no_states), dev))
+
+
+# %% Setup.
+#
+# Set up paths depending on plattform and architecture
+#
+PATH_WRAPPER = os.path.join(os.getcwd().split("python_wrapper")[0], 'python_wrapper')
+PATH_DB = os.path.join(PATH_WRAPPER, 'sorpproplib',
+                       'data', 'JSON', 'sorpproplib_minimalExample.json').encode()
+
+if sys.platform == "win32":
+    # Windows platform
+    #
+    if struct.calcsize("P") * 8 == 64:
+        REQUIRED_DLL = "win64bit"
+    else:
+        REQUIRED_DLL = "win32bit"
+
+elif (sys.platform == "linux") or (sys.platform == "linux2"):
+    # Linux platform
+    #
+    if struct.calcsize("P") * 8 == 64:
+        REQUIRED_DLL = "linux64bit"
+
+else:
+    # Ohter platform: Not supported
+    #
+    sys.exit()
+
+PATH_SORPPROPLIB = os.path.join(PATH_WRAPPER,  'sorpproplib',
+                                'data', REQUIRED_DLL, 'libsorpPropLib.dll')
+
+if len(sys.argv) > 1:
+    PATH_SORPPROPLIB = sys.argv[1]
+
+if len(sys.argv) > 2:
+    PATH_DB = sys.argv[2].encode()
+
+# Define some working pairs
+#
+wpair = {"sorbent": "carbon", "subtype": "norit-rb1", "refrigerant": "carbonDioxide"}
+wpair_approach = {"isotherm": "Langmuir", "id_isotherm": 1,
+                  "vapor_pressure": "VaporPressure_EoS1", "id_vapor_pressure": 1,
+                  "sat_liq_density": "SaturatedLiquidDensity_EoS1", "id_sat_liq_density": 1}
+WPAIR_LAGNMUIR = WPairStruct(wpair, wpair_approach, PATH_SORPPROPLIB, PATH_DB)
+
+wpair = {"sorbent": "zeolite", "subtype": "5a", "refrigerant": "water"}
+wpair_approach = {"isotherm": "Toth", "id_isotherm": 1,
+                  "vapor_pressure": "VaporPressure_EoS1", "id_vapor_pressure": 1,
+                  "sat_liq_density": "SaturatedLiquidDensity_EoS1", "id_sat_liq_density": 1}
+WPAIR_TOTH = WPairStruct(wpair, wpair_approach, PATH_SORPPROPLIB, PATH_DB)
+
+wpair = {"sorbent": "naoh-koh-csoh", "subtype": "", "refrigerant": "water"}
+wpair_approach = {"isotherm": "Duehring", "id_isotherm": 1,
+                  "vapor_pressure": "VaporPressure_EoS1", "id_vapor_pressure": 1,
+                  "sat_liq_density": "SaturatedLiquidDensity_EoS1", "id_sat_liq_density": 1}
+WPAIR_DUEHRING = WPairStruct(wpair, wpair_approach, PATH_SORPPROPLIB, PATH_DB)
+
+wpair = {"sorbent": "il", "subtype": "[bmim][(cf3so2)2n]", "refrigerant": "water"}
+wpair_approach = {"isotherm": "WilsonFixedDl", "id_isotherm": 1,
+                  "vapor_pressure": "VaporPressure_EoS1", "id_vapor_pressure": 1,
+                  "sat_liq_density": "SaturatedLiquidDensity_EoS1", "id_sat_liq_density": 1}
+WPAIR_WILSON = WPairStruct(wpair, wpair_approach, PATH_SORPPROPLIB, PATH_DB)
+
+wpair = {"sorbent": "oil", "subtype": "", "refrigerant": "R-600a"}
+wpair_approach = {"isotherm": "MixingRule", "id_isotherm": 1,
+                  "vapor_pressure": "NoVaporPressure", "id_vapor_pressure": 1,
+                  "sat_liq_density": "NoSaturatedLiquidDensity", "id_sat_liq_density": 1}
+WPAIR_MIX = WPairStruct(wpair, wpair_approach, PATH_SORPPROPLIB, PATH_DB)
+
+
+# %% Benchmark working pairs
+# Inputs are broadcast by the array functions, but scalar functions require arrays of equal
+# shape. Thus, all inputs are created with the full number of states.
+#
+print("{:<30s} {:>9s} {:>14s} {:>14s} {:>9s} {:>12s}".format(
+    "function", "states", "scalar ns/pt", "array ns/pt", "speed-up", "max rel dev"))
+
+for no_states in [10, 1000, 100000]:
+    bench_function("Langmuir: Ads.w_pT", WPAIR_LAGNMUIR.Ads.w_pT, WPAIR_LAGNMUIR.Ads.w_pT_array,
+                   [linspace(100, 5e5, no_states), full(no_states, 293.15)])
+    bench_function("Toth: Ads.w_pT", WPAIR_TOTH.Ads.w_pT, WPAIR_TOTH.Ads.w_pT_array,
+                   [linspace(25, 5000, no_states), full(no_states, 293.15)])
+    bench_function("Toth: Ads.T_pw", WPAIR_TOTH.Ads.T_pw, WPAIR_TOTH.Ads.T_pw_array,
+                   [linspace(25, 5000, no_states), full(no_states, 0.2)])
+    bench_function("Duehring: Abs.Con.X_pT", WPAIR_DUEHRING.Abs.Con.X_pT,
+                   WPAIR_DUEHRING.Abs.Con.X_pT_array,
+                   [linspace(25, 8000, no_states), full(no_states, 343.15)])
+    bench_function("Wilson: Abs.Act.p_Txv1v2", WPAIR_WILSON.Abs.Act.p_Txv1v2,
+                   WPAIR_WILSON.Abs.Act.p_Txv1v2_array,
+                   [full(no_states, 353.15), linspace(0.05, 0.95, no_states),
+                    full(no_states, 0.5), full(no_states, 0.5)])
+    bench_function("MixingRule: Abs.Mix.x_pT", WPAIR_MIX.Abs.Mix.x_pT,
+                   WPAIR_MIX.Abs.Mix.x_pT_array,
+                   [linspace(33000, 33400, no_states), full(no_states, 293.15)])
+    bench_function("Toth: Ref.p_sat_T", WPAIR_TOTH.Ref.p_sat_T, WPAIR_TOTH.Ref.p_sat_T_array,
+                   [linspace(273.15, 373.15, no_states)])
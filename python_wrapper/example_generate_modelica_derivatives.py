@@ -0,0 +1,112 @@
+# -*- coding: utf-8 -*-
+"""Script 'example_generate_modelica_derivatives'.
+
+This script is an example showing how to generate the derivative functions (i.e., '*_der.mo') of
+the package 'DirectFunctionCalls' of the Modelica wrapper from the derivative functions of the
+package 'WorkingPair.WPairFunctions'. Thus, only the functions of 'WPairFunctions' must be
+maintained. Functions of the package 'Table' are skipped because they have no direct function
+calls. If the script is called with the argument 'check', files are not written but compared with
+the existing files, and the script fails if any file differs.
+
+Revisions:
+----------
+    Version     Date        Author              Changes
+    1.0.0       2026-10-18  agent               First implementation
+"""
+
+
+# %% Import relevant modules.
+#
+import os
+import re
+import sys
+
+
+# %% Setup.
+#
+# Set up paths of both packages and arguments of direct function calls
+#
+PATH_SORPPROPLIB = os.path.join(os.getcwd().split("sorpproplib_JSON")[0], 'sorpproplib_JSON')
+PATH_MODELICA = os.path.join(PATH_SORPPROPLIB, 'modelica_wrapper', 'SorpPropLib')
+PATH_WPAIR = os.path.join(PATH_MODELICA, 'WorkingPair', 'WPairFunctions')
+PATH_DIRECT = os.path.join(PATH_MODELICA, 'DirectFunctionCalls')
+
+PACKAGES_SKIPPED = ['Table']
+
+ARGUMENTS_DIRECT = ('    path_db, name_sorbent, name_sorbent_sub_type, name_refrigerant,\n'
+                    '    func_isotherm, func_isotherm_ID,\n'
+                    '    func_vapor_pressure, func_vapor_pressure_ID,\n'
+                    '    func_saturated_liquid_density, func_saturated_liquid_density_ID)')
+
+
+# %% Definition of functions.
+#
+def convert_function(text, units_si):
+    r"""Convert derivative function of 'WPairFunctions' into direct function call.
+
+    Parameters
+    ----------
+    text : str
+        Content of derivative function of 'WPairFunctions'.
+    units_si : bool
+        Flag indicating if units of 'Modelica.Units.SI' are used instead of 'Modelica.SIunits'
+        (i.e., like the function being differentiated).
+
+    Returns
+    -------
+    str
+        Content of derivative function of 'DirectFunctionCalls'.
+
+    """
+    text = text.replace('SorpPropLib.WorkingPair.WPairFunctions', 'SorpPropLib.DirectFunctionCalls')
+    text = text.replace('extends Modelica.Icons.Function;',
+                        'extends DirectFunctionCalls.Internal.partialDirectFunctionCall;')
+    text = re.sub(r'  input WPair extObj .*\n.*\n', '', text)
+    text = re.sub(r'(external"C" \w+ = )(\w+)\((.*), extObj\)',
+                  lambda match: (match.group(1) + 'direct_' + match.group(2) + '(' +
+                                 match.group(3) + ',\n' + ARGUMENTS_DIRECT), text)
+
+    if units_si:
+        text = text.replace('Modelica.SIunits.', 'Modelica.Units.SI.')
+
+    return text
+
+
+# %% Generate derivative functions of direct function calls.
+#
+check = (len(sys.argv) > 1) and (sys.argv[1] == 'check')
+no_differences = 0
+
+for path, _, files in os.walk(PATH_WPAIR):
+    package = os.path.relpath(path, PATH_WPAIR)
+
+    if package.split(os.sep)[0] in PACKAGES_SKIPPED:
+        continue
+
+    for file in sorted(files):
+        if not file.endswith('_der.mo'):
+            continue
+
+        # Units follow the function being differentiated of 'DirectFunctionCalls'
+        #
+        path_function = os.path.join(PATH_DIRECT, package, file.replace('_der.mo', '.mo'))
+
+        with open(path_function, 'r', encoding='utf-8') as function:
+            units_si = 'Modelica.Units.SI.' in function.read()
+
+        with open(os.path.join(path, file), 'r', encoding='utf-8', newline='') as source:
+            text = convert_function(source.read(), units_si)
+
+        path_target = os.path.join(PATH_DIRECT, package, file)
+
+        if check:
+            with open(path_target, 'r', encoding='utf-8', newline='') as target:
+                if target.read() != text:
+                    no_differences += 1
+                    print('File differs from generated function: ' + path_target)
+
+        else:
+            with open(path_target, 'w', encoding='utf-8', newline='') as target:
+                target.write(text)
+
+sys.exit(1 if no_differences > 0 else 0)
@@ -386,6 +386,13 @@ def write_ads_viszualization(ADS: dict, EQU_NAME: str, EQU_ID: int,
             # Sort row data
             #
             w_unique = sorted(list(set(w_raw)))
+            T_unique = sorted(list(set(T_raw)))
+            id_T_unique = {tmp_val: tmp_ind for tmp_ind, tmp_val in enumerate(T_unique)}
+
+            # Calculate all isosteres of figure by one call: Isosteres are evaluated at all
+            # measured temperatures
+            #
+            p_chart = WPAIR_CLASS.Ads.chart('isosteres', w_unique, T_unique)['values']
             
             # Create figure: Iterate over unique temperatures to calculate and plot data
             #
@@ -399,7 +406,7 @@ def write_ads_viszualization(ADS: dict, EQU_NAME: str, EQU_ID: int,
             
             fig, ax = plt.subplots(1, 1, figsize=(14.9/2.54, 10/2.54))                   
             
-            for _, w_unique_i in enumerate(w_unique):
+            for id_w, w_unique_i in enumerate(w_unique):
                 # Get and sort data
                 #
                 p_plot = []
@@ -414,7 +421,7 @@ def write_ads_viszualization(ADS: dict, EQU_NAME: str, EQU_ID: int,
                         T_plot.append(T_raw[tmp_ind])
                         w_plot.append(tmp_val)
                         
-                        p_calc = WPAIR_CLASS.Ads.p_wT(tmp_val, T_raw[tmp_ind])
+                        p_calc = p_chart[id_w][id_T_unique[T_raw[tmp_ind]]]
 
                         min_x = min_x if -1/T_raw[tmp_ind]*1.1 > min_x else -1/T_raw[tmp_ind]*1.1
                         min_y = min_y if p_raw[tmp_ind]/1000 > min_y else p_raw[tmp_ind]/1000
@@ -427,7 +434,7 @@ def write_ads_viszualization(ADS: dict, EQU_NAME: str, EQU_ID: int,
                             mape += np.abs(p_raw[tmp_ind] - p_calc) / max(p_raw[tmp_ind], 1e-12)
                             no_mape += 1
 
-                p_calc = [WPAIR_CLASS.Ads.p_wT(w_unique_i, tmp_val)/1000 for tmp_val in sorted(T_plot)]
+                p_calc = [p_chart[id_w][id_T_unique[tmp_val]]/1000 for tmp_val in sorted(T_plot)]
 
                 # Plot data
                 #
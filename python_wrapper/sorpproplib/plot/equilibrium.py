@@ -42,7 +42,8 @@ def plot_isosteres(func_p_sat_T: Callable[[float], float],
                    func_p_wxXT: Callable[[float, float], float],
                    func_wxX_pT: Callable[[float, float], float],
                    T_calc: list, wxX_calc: list,
-                   T_axis: list, p_axis: list) -> dict:
+                   T_axis: list, p_axis: list,
+                   func_chart: Callable[[list, list], dict] = None) -> dict:
     r"""Plot isosters.
 
     This functions calculates vapor pressures and equilibrium pressures for the temperatures
@@ -68,6 +69,12 @@ def plot_isosteres(func_p_sat_T: Callable[[float], float],
         List containing temperatures (i.e., floats) defining the ticks of the x axis.
     p_axis : list
         List containing pressures (i.e., floats) defining the ticks of the y axis.
+    func_chart : Callable[[list, list], dict], optional
+        Method generating all curves of the chart by one call (e.g., 'Ads.chart' of class
+        'WPairStruct' with fixed type of chart). The method gets 'wxX_calc' as curves and
+        'T_calc' as points, and returns a dict containing keys 'values', 'valid', 'p_sat',
+        and 'T_sat'. If given, curves are clipped by the SorpPropLib instead of the scalar
+        methods above. The default is None.
 
     Returns
     -------
@@ -78,7 +85,13 @@ def plot_isosteres(func_p_sat_T: Callable[[float], float],
     """
     # Calculate saturation properties and get reasonable results (i.e., p_sat <= p_crit)
     #
-    p_sat = [func_p_sat_T(val) for val in T_calc]
+    if func_chart is None:
+        p_sat = [func_p_sat_T(val) for val in T_calc]
+
+    else:
+        chart = func_chart(wxX_calc, T_calc)
+        p_sat = chart['p_sat']
+
     id_limit = np.logical_and(np.greater_equal(p_sat, 0), np.isfinite(p_sat))
 
     saturationPropeties = {'p_sat':   np.extract(id_limit, p_sat),
@@ -89,7 +102,8 @@ def plot_isosteres(func_p_sat_T: Callable[[float], float],
     wxX_max = func_wxX_pT(min(saturationPropeties['p_sat']),
                           min(saturationPropeties['T_sat']))
 
-    wxX_calc = np.extract(np.less_equal(wxX_calc, wxX_max), wxX_calc)
+    id_wxX_calc = np.less_equal(wxX_calc, wxX_max)
+    wxX_calc = np.extract(id_wxX_calc, wxX_calc)
 
     # Get critical pressure and temperature or maximum pressure and temperature if both are
     # lower than critical pressure and temperature
@@ -102,6 +116,16 @@ def plot_isosteres(func_p_sat_T: Callable[[float], float],
     sorptionEquilibrium = [None] * len(wxX_calc)
 
     for id_wxX, val_wxX in enumerate(wxX_calc):
+        if func_chart is not None:
+            # Curves of chart are already clipped at p_sat or p_crit
+            #
+            values = chart['values'][id_wxX_calc][id_wxX]
+            valid = chart['valid'][id_wxX_calc][id_wxX]
+
+            sorptionEquilibrium[id_wxX] = {'p_wxXT':    np.extract(valid, values),
+                                           'T_equ':     np.extract(valid, T_calc)}
+            continue
+
         p_wxXT = [func_p_wxXT(val_wxX, val) for val in T_calc]
 
         if not np.less_equal(p_wxXT[:len(saturationPropeties['p_sat'])],
@@ -181,7 +205,8 @@ def plot_isotherms(func_p_sat_T: Callable[[float], float],
                    func_wxX_pT: Callable[[float, float], float],
                    p_calc: list, T_calc: list,
                    p_axis: list, wxX_axis: list,
-                   flag_p_rel: bool = False) -> dict:
+                   flag_p_rel: bool = False,
+                   func_chart: Callable[[list, list], dict] = None) -> dict:
     r"""Plot isotherms.
 
     This functions calculates vapor pressures and loadings / molar fractions / concentrations for
@@ -209,6 +234,12 @@ def plot_isotherms(func_p_sat_T: Callable[[float], float],
     flag_p_rel : bool, optional
         Flag defining if x axis shall be pressure or relative pressure (i.e., p/p_sat). The
         default is False.
+    func_chart : Callable[[list, list], dict], optional
+        Method generating all curves of the chart by one call (e.g., 'Ads.chart' of class
+        'WPairStruct' with fixed type of chart). The method gets 'T_calc' as curves and
+        'p_calc' as points, and returns a dict containing keys 'values', 'valid', 'p_sat',
+        and 'T_sat'. If given, curves are clipped by the SorpPropLib instead of the scalar
+        methods above. The default is None.
 
     Returns
     -------
@@ -219,7 +250,13 @@ def plot_isotherms(func_p_sat_T: Callable[[float], float],
     """
     # Calculate saturation properties and get finite results
     #
-    p_sat = [func_p_sat_T(val) for val in T_calc]
+    if func_chart is None:
+        p_sat = [func_p_sat_T(val) for val in T_calc]
+
+    else:
+        chart = func_chart(T_calc, p_calc)
+        p_sat = chart['p_sat']
+
     id_limit = np.logical_and(np.greater_equal(p_sat, 0), np.isfinite(p_sat))
 
     saturationPropeties = {'p_sat': np.extract(id_limit, p_sat),
@@ -242,6 +279,14 @@ def plot_isotherms(func_p_sat_T: Callable[[float], float],
     sorptionEquilibrium = [None] * len(T_calc)
 
     for id_T, val_T in enumerate(T_calc):
+        if func_chart is not None:
+            # Curves of chart are already clipped at p_sat or p_crit
+            #
+            sorptionEquilibrium[id_T] = {'wxXT_pT': np.extract(chart['valid'][id_T],
+                                                               chart['values'][id_T]),
+                                         'p_equ':   np.extract(chart['valid'][id_T], p_calc)}
+            continue
+
         wxXT_pT = [func_wxX_pT(val, val_T) for val in p_calc]
 
         if val_T <= T_crit:
@@ -349,7 +394,8 @@ def plot_isobars(func_p_sat_T: Callable[[float], float],
                  func_T_sat_p: Callable[[float], float],
                  func_wxX_pT: Callable[[float, float], float],
                  p_calc: list, T_calc: list,
-                 T_axis: list, wxX_axis: list) -> dict:
+                 T_axis: list, wxX_axis: list,
+                 func_chart: Callable[[list, list], dict] = None) -> dict:
     r"""Plot isobars.
 
     This functions calculates vapor pressures and loadings / molar fractions / concentrations for
@@ -376,6 +422,12 @@ def plot_isobars(func_p_sat_T: Callable[[float], float],
     wxX_axis : list
         List containing loadings / molar fractions / concentrations (i.e., floats) defining the
         ticks of the y axis.
+    func_chart : Callable[[list, list], dict], optional
+        Method generating all curves of the chart by one call (e.g., 'Ads.chart' of class
+        'WPairStruct' with fixed type of chart). The method gets 'p_calc' as curves and
+        'T_calc' as points, and returns a dict containing keys 'values', 'valid', 'p_sat',
+        and 'T_sat'. If given, curves are clipped by the SorpPropLib instead of the scalar
+        methods above. The default is None.
 
     Returns
     -------
@@ -386,7 +438,13 @@ def plot_isobars(func_p_sat_T: Callable[[float], float],
     """
     # Calculate saturation properties and get finite results
     #
-    p_sat = [func_p_sat_T(val) for val in T_calc]
+    if func_chart is None:
+        p_sat = [func_p_sat_T(val) for val in T_calc]
+
+    else:
+        chart = func_chart(p_calc, T_calc)
+        p_sat = chart['p_sat']
+
     id_limit = np.logical_and(np.greater_equal(p_sat, 0), np.isfinite(p_sat))
 
     saturationPropeties = {'p_sat': np.extract(id_limit, p_sat),
@@ -398,7 +456,8 @@ def plot_isobars(func_p_sat_T: Callable[[float], float],
     p_crit = max(saturationPropeties['p_sat'])
     T_crit = max(saturationPropeties['T_sat'])
 
-    p_calc = np.extract(np.less_equal(p_calc, p_crit), p_calc)
+    id_p_calc = np.less_equal(p_calc, p_crit)
+    p_calc = np.extract(id_p_calc, p_calc)
 
     # Calculate saturation capacity
     #
@@ -411,6 +470,16 @@ def plot_isobars(func_p_sat_T: Callable[[float], float],
     sorptionEquilibrium = [None] * len(p_calc)
 
     for id_p, val_p in enumerate(p_calc):
+        if func_chart is not None:
+            # Curves of chart are already clipped at p_sat (i.e., at saturation capacity)
+            #
+            values = chart['values'][id_p_calc][id_p]
+            valid = chart['valid'][id_p_calc][id_p]
+
+            sorptionEquilibrium[id_p] = {'wxXT_pT': np.extract(valid, values),
+                                         'T_equ':   np.extract(valid, T_calc)}
+            continue
+
         wxXT_pT = [func_wxX_pT(val_p, val) for val in T_calc]
         id_limit = np.less_equal(wxXT_pT, func_wxX_pT(val_p, func_T_sat_p(val_p)))
 
@@ -547,7 +616,8 @@ def plot_duehring(func_p_sat_T: Callable[[float], float],
                   func_p_wxXT: Callable[[float, float], float],
                   func_wxX_pT: Callable[[float, float], float],
                   T_calc: list, wxX_calc: list,
-                  T_axis_x: list, T_axis_y: list) -> dict:
+                  T_axis_x: list, T_axis_y: list,
+                  func_chart: Callable[[list, list], dict] = None) -> dict:
     r"""Plot Dühring diagram.
 
     This functions calculates vapor temperatures and equilibrium pressures for the temperatures
@@ -575,6 +645,12 @@ def plot_duehring(func_p_sat_T: Callable[[float], float],
         List containing temperatures (i.e., floats) defining the ticks of the x axis.
     T_axis_y : list
         List containing vapor temperatures (i.e., floats) defining the ticks of the y axis.
+    func_chart : Callable[[list, list], dict], optional
+        Method generating all curves of the chart by one call (e.g., 'Ads.chart' of class
+        'WPairStruct' with fixed type of chart). The method gets 'wxX_calc' as curves and
+        'T_calc' as points, and returns a dict containing keys 'values', 'valid', 'p_sat',
+        and 'T_sat'. If given, curves are clipped by the SorpPropLib instead of the scalar
+        methods above. The default is None.
 
     Returns
     -------
@@ -585,7 +661,13 @@ def plot_duehring(func_p_sat_T: Callable[[float], float],
     """
     # Calculate saturation properties and get reasonable results (i.e., p_sat <= p_crit)
     #
-    p_sat = [func_p_sat_T(val) for val in T_calc]
+    if func_chart is None:
+        p_sat = [func_p_sat_T(val) for val in T_calc]
+
+    else:
+        chart = func_chart(wxX_calc, T_calc)
+        p_sat = chart['p_sat']
+
     id_limit = np.logical_and(np.greater_equal(p_sat, 0), np.isfinite(p_sat))
 
     saturationPropeties = {'p_sat':   np.extract(id_limit, p_sat),
@@ -596,7 +678,8 @@ def plot_duehring(func_p_sat_T: Callable[[float], float],
     wxX_max = func_wxX_pT(min(saturationPropeties['p_sat']),
                           min(saturationPropeties['T_sat']))
 
-    wxX_calc = np.extract(np.less_equal(wxX_calc, wxX_max), wxX_calc)
+    id_wxX_calc = np.less_equal(wxX_calc, wxX_max)
+    wxX_calc = np.extract(id_wxX_calc, wxX_calc)
 
     # Get critical pressure and temperature or maximum pressure and temperature if both are
     # lower than critical pressure and temperature
@@ -609,6 +692,19 @@ def plot_duehring(func_p_sat_T: Callable[[float], float],
     sorptionEquilibrium = [None] * len(wxX_calc)
 
     for id_wxX, val_wxX in enumerate(wxX_calc):
+        if func_chart is not None:
+            # Curves of chart are already clipped at p_sat or p_crit and contain vapor
+            # temperatures
+            #
+            values = chart['values'][id_wxX_calc][id_wxX]
+            valid = chart['valid'][id_wxX_calc][id_wxX]
+
+            sorptionEquilibrium[id_wxX] = {'p_wxXT':    np.extract(valid, values),
+                                           'T_equ':     np.extract(valid, T_calc),
+                                           'T_sat':     np.extract(valid, chart['T_sat'][
+                                               id_wxX_calc][id_wxX])}
+            continue
+
         p_wxXT = [func_p_wxXT(val_wxX, val) for val in T_calc]
 
         if not np.less_equal(p_wxXT[:len(saturationPropeties['p_sat'])],
@@ -29,7 +29,8 @@ import os
 import struct
 import sys
 
-from ctypes import byref, c_int, c_double, c_char_p, cdll, Structure, POINTER, CFUNCTYPE
+from ctypes import byref, c_int, c_double, c_char_p, c_ubyte, c_void_p, cdll, Structure, POINTER, \
+    CFUNCTYPE
 from typing import Union
 
 from numpy import log
@@ -703,6 +704,30 @@ def load_dll(path: str) -> cdll:
                           c_double, [c_double, c_char_p, c_char_p, c_char_p, c_char_p, c_char_p,
                                      c_int, c_char_p, c_int, c_char_p, c_int])
 
+        # Set up functions evaluating arrays of states: These functions are optional so that
+        # libraries without batch evaluation can still be loaded
+        #
+        try:
+            wrap_dll_function(library, ['batch_no_inputs'], c_int, [c_char_p])
+            wrap_dll_function(library, ['batch_evaluate'], c_int,
+                              [POINTER(c_double), POINTER(c_double), POINTER(c_double),
+                               POINTER(c_int), c_char_p, POINTER(POINTER(c_double)), c_int,
+                               c_int, c_void_p, POINTER(WorkingPair)])
+            wrap_dll_function(library, ['newBatchPool'], c_void_p, [c_int])
+            wrap_dll_function(library, ['delBatchPool'], None, [c_void_p])
+
+        except AttributeError:
+            pass
+
+        try:
+            wrap_dll_function(library, ['chart_evaluate'], c_int,
+                              [POINTER(c_double), POINTER(c_double), POINTER(c_ubyte),
+                               POINTER(c_double), c_int, c_char_p, POINTER(c_double), c_int,
+                               POINTER(c_double), c_int, c_void_p, POINTER(WorkingPair)])
+
+        except AttributeError:
+            pass
+
         # Return DLL
         #
         return library
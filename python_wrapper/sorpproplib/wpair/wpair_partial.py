@@ -18,12 +18,27 @@ Revisions
 
 # %% Import libraries.
 #
+import atexit
 import os
 
-from ctypes import c_int, cdll
+from ctypes import byref, c_double, c_int, c_ubyte, cdll, POINTER
+from numpy import ascontiguousarray, broadcast_arrays, empty, float64, full, isfinite, ndarray, \
+    uint8, where
+from numpy.typing import ArrayLike
+
 from .interface_cdll import load_dll, WorkingPair
 
 
+# %% Pools of threads evaluating arrays of states (i.e., one pool per library).
+#
+_BATCH_POOLS = {}
+
+
+# %% Types of charts generated by 'chart_evaluate' (i.e., macros CHART_* of SorpPropLib.DLL).
+#
+_CHART_TYPES = {'isotherms': 1, 'isosteres': 2, 'isobars': 3, 'duehring': 4}
+
+
 # %% Definition of class 'WPair'.
 #
 class WPair:
@@ -251,3 +266,220 @@ class WPairCStruct:
         #
         self._sorp_prop_lib = library
         self._wpair_c_struct = c_struct
+
+    def _batch_pool(self) -> int:
+        r"""Return pool of threads evaluating arrays of states.
+
+        This function returns the pool of threads that is shared by all working pairs using the
+        same library. The pool is created at first call and freed when the interpreter exits.
+
+        Returns
+        -------
+        pool: int
+            Pointer of 'BatchPool'-struct.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        pool = _BATCH_POOLS.get(self._sorp_prop_lib._handle)
+
+        if pool is None:
+            pool = self._sorp_prop_lib.newBatchPool(0)
+            _BATCH_POOLS[self._sorp_prop_lib._handle] = pool
+            atexit.register(self._sorp_prop_lib.delBatchPool, pool)
+
+        return pool
+
+    def _evaluate_array(self, function: str, *inputs: ArrayLike, vapor: bool = False) -> ndarray:
+        r"""Evaluate function of the SorpPropLib.DLL for arrays of states.
+
+        This function broadcasts all inputs to a common shape, copies them to contiguous float64
+        buffers, and evaluates the function of the 'working pair'-struct for all states by one
+        call of 'batch_evaluate'. States are distributed among the threads of a pool that is
+        shared by all working pairs using the same library.
+
+        Parameters
+        ----------
+        function: str
+            Name of function of the SorpPropLib.DLL (e.g., 'ads_w_pT').
+        inputs: array_like
+            Inputs of function in order of inputs of function.
+        vapor: bool
+            Flag indicating whether function also returns mole fractions in vapor phase (i.e.,
+            mixing rules).
+
+        Returns
+        -------
+        values: ndarray
+            Values of function with broadcast shape of inputs. If 'vapor' is True, a tuple
+            containing values and mole fractions of first and second component in vapor phase is
+            returned.
+
+        Notes
+        -----
+        The GIL is released during the call of the SorpPropLib.DLL. If the library does not
+        contain 'batch_evaluate', states are evaluated by the scalar function instead. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        # Broadcast inputs and allocate outputs
+        #
+        arrays = [ascontiguousarray(val, dtype=float64) for val in broadcast_arrays(*inputs)]
+        values = empty(arrays[0].shape)
+        y1 = empty(arrays[0].shape) if vapor else None
+        y2 = empty(arrays[0].shape) if vapor else None
+
+        if values.size > 2**31 - 1:
+            raise ValueError("Number of states exceeds range of C-type 'int'!")
+
+        # Evaluate states by batch function or by scalar function
+        #
+        if hasattr(self._sorp_prop_lib, 'batch_evaluate'):
+            pool = self._batch_pool()
+            ptr_inputs = (POINTER(c_double) * len(arrays))(
+                *[val.ctypes.data_as(POINTER(c_double)) for val in arrays])
+            self._sorp_prop_lib.batch_evaluate(
+                values.ctypes.data_as(POINTER(c_double)),
+                y1.ctypes.data_as(POINTER(c_double)) if vapor else None,
+                y2.ctypes.data_as(POINTER(c_double)) if vapor else None,
+                None, function.encode(), ptr_inputs, c_int(values.size), c_int(0), pool,
+                self._wpair_c_struct)
+
+        else:
+            func = getattr(self._sorp_prop_lib, function)
+            flat = [val.ravel() for val in arrays]
+
+            for ind in range(values.size):
+                args = [c_double(val[ind]) for val in flat]
+
+                if vapor:
+                    y1_ind = c_double()
+                    y2_ind = c_double()
+                    values.flat[ind] = func(byref(y1_ind), byref(y2_ind), *args,
+                                            self._wpair_c_struct)
+                    y1.flat[ind] = y1_ind.value
+                    y2.flat[ind] = y2_ind.value
+
+                else:
+                    values.flat[ind] = func(*args, self._wpair_c_struct)
+
+        # Return results
+        #
+        return (values, y1, y2) if vapor else values
+
+    def _evaluate_chart(self, chart: str, function: str, curves: ArrayLike,
+                        points: ArrayLike) -> dict:
+        r"""Generate chart of working pair using the SorpPropLib.DLL.
+
+        This function evaluates the function of the 'working pair'-struct for all curves and
+        points of a chart by one call of 'chart_evaluate'. Pressures exceeding the vapor pressure
+        of the temperature of an entry are clipped; if the vapor pressure is not defined, pressures
+        are clipped at the highest vapor pressure of the chart. Curves are distributed among the
+        threads of the pool shared by all working pairs using the same library.
+
+        Parameters
+        ----------
+        chart: str
+            Type of chart: 'isotherms' (i.e., curves are temperatures and points are pressures),
+            'isosteres' or 'duehring' (i.e., curves are loadings / molar fractions /
+            concentrations and points are temperatures), or 'isobars' (i.e., curves are pressures
+            and points are temperatures).
+        function: str
+            Name of function of the SorpPropLib.DLL with two inputs (e.g., 'ads_w_pT').
+        curves: array_like
+            Inputs that are constant along each curve.
+        points: array_like
+            Inputs that vary along each curve.
+
+        Returns
+        -------
+        dict
+            Dict containing keys 'values' (i.e., values of function), 'valid' (i.e., boolean
+            mask of entries that are neither clipped nor failed), and 'T_sat' (i.e., vapor
+            temperatures of equilibrium pressures for Dühring charts and None otherwise), each
+            of shape (number of curves, number of points); and key 'p_sat' containing vapor
+            pressures of curves for isotherms and of points otherwise.
+
+        Raises
+        ------
+        ValueError:
+            If type of chart is unknown or chart cannot be generated.
+
+        Notes
+        -----
+        The GIL is released during the call of the SorpPropLib.DLL. If the library does not
+        contain 'chart_evaluate', the chart is generated by arrays of states instead.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        # Copy inputs and allocate outputs
+        #
+        if chart not in _CHART_TYPES:
+            raise ValueError("Type of chart '{}' is unknown!".format(chart))
+
+        curves = ascontiguousarray(curves, dtype=float64).ravel()
+        points = ascontiguousarray(points, dtype=float64).ravel()
+        temperatures = curves if chart == 'isotherms' else points
+
+        values = empty((curves.size, points.size))
+        T_sat = empty(values.shape) if chart == 'duehring' else None
+        valid = empty(values.shape, dtype=uint8)
+        p_sat = empty(temperatures.shape)
+
+        if values.size > 2**31 - 1:
+            raise ValueError("Number of entries exceeds range of C-type 'int'!")
+
+        # Generate chart by one call or by arrays of states
+        #
+        if hasattr(self._sorp_prop_lib, 'chart_evaluate'):
+            result = self._sorp_prop_lib.chart_evaluate(
+                values.ctypes.data_as(POINTER(c_double)),
+                T_sat.ctypes.data_as(POINTER(c_double)) if T_sat is not None else None,
+                valid.ctypes.data_as(POINTER(c_ubyte)),
+                p_sat.ctypes.data_as(POINTER(c_double)),
+                c_int(_CHART_TYPES[chart]), function.encode(),
+                curves.ctypes.data_as(POINTER(c_double)), c_int(curves.size),
+                points.ctypes.data_as(POINTER(c_double)), c_int(points.size),
+                self._batch_pool(), self._wpair_c_struct)
+
+            if result != 0:
+                raise ValueError("Chart of function '{}' cannot be generated!".format(function))
+
+        else:
+            p_sat = self._evaluate_array('ref_p_sat_T', temperatures)
+            p_sat_valid = isfinite(p_sat) & (p_sat > 0)
+            p_limit = p_sat[p_sat_valid].max() if p_sat_valid.any() else -1
+
+            if chart == 'isotherms':
+                values = self._evaluate_array(function, points[None, :], curves[:, None])
+                p = points[None, :]
+                p_max = where(p_sat_valid, p_sat, p_limit)[:, None]
+
+            else:
+                values = self._evaluate_array(function, curves[:, None], points[None, :])
+                p = curves[:, None] if chart == 'isobars' else values
+                p_max = where(p_sat_valid, p_sat, p_limit)[None, :]
+
+            valid = isfinite(values) & (values != -1) & (p >= 0) & (p <= p_max)
+
+            if T_sat is not None:
+                T_sat = full(values.shape, -1.0)
+                T_sat[valid] = self._evaluate_array('ref_T_sat_p', values[valid])
+                valid &= isfinite(T_sat) & (T_sat > 0)
+                T_sat[~valid] = -1
+
+        # Return results
+        #
+        return {'values':   values,
+                'valid':    valid.astype(bool),
+                'p_sat':    p_sat,
+                'T_sat':    T_sat}
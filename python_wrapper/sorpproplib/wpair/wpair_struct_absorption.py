@@ -16,6 +16,9 @@ Revisions
 #
 from ctypes import byref, c_double, cdll
 
+from numpy import ndarray
+from numpy.typing import ArrayLike
+
 from .interface_cdll import WorkingPair
 from .wpair_partial import  WPairCStruct
 
@@ -40,21 +43,37 @@ class WPairStructAbsorptionConventional(WPairCStruct):
     -------
     X_pT:
         Calculates concentration depending on pressure and temperature.
+    X_pT_array:
+        Same as 'X_pT' but for arrays of states.
     p_XT:
         Calculates pressure depending on concentration and temperature.
+    p_XT_array:
+        Same as 'p_XT' but for arrays of states.
     T_pX:
         Calculates temperature depending on pressure and concentration.
+    T_pX_array:
+        Same as 'T_pX' but for arrays of states.
     dX_dp_pT:
         Calculates derivative of concentration wrt. pressure depending on pressure and temperature.
+    dX_dp_pT_array:
+        Same as 'dX_dp_pT' but for arrays of states.
     dX_dT_pT:
         Calculates derivative of concentration wrt. temperature depending on pressure and
         temperature.
+    dX_dT_pT_array:
+        Same as 'dX_dT_pT' but for arrays of states.
     dp_dX_XT:
         Calculates derivative of pressure wrt. concentration depending on concentration and
         temperature.
+    dp_dX_XT_array:
+        Same as 'dp_dX_XT' but for arrays of states.
     dp_dT_XT:
         Calculates derivative of pressure wrt. temperature depending on concentration and
         temperature.
+    dp_dT_XT_array:
+        Same as 'dp_dT_XT' but for arrays of states.
+    chart:
+        Generates isotherms, isosteres, isobars, or Dühring chart.
 
     History
     -------
@@ -115,6 +134,37 @@ class WPairStructAbsorptionConventional(WPairCStruct):
         return self._sorp_prop_lib.abs_con_X_pT(c_double(p), c_double(T),
                                                 self._wpair_c_struct)
 
+    def X_pT_array(self, p: ArrayLike, T: ArrayLike) -> ndarray:
+        r"""Calculate concentration for arrays of states.
+
+        This function evaluates 'X_pT' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        p: array_like
+            Pressure in Pa.
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        X: ndarray
+            Concentration in kg/kg.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('abs_con_X_pT', p, T)
+
     def p_XT(self, X: float, T: float) -> float:
         r"""Cacluate pressure.
 
@@ -147,6 +197,37 @@ class WPairStructAbsorptionConventional(WPairCStruct):
         return self._sorp_prop_lib.abs_con_p_XT(c_double(X), c_double(T),
                                                 self._wpair_c_struct)
 
+    def p_XT_array(self, X: ArrayLike, T: ArrayLike) -> ndarray:
+        r"""Calculate pressure for arrays of states.
+
+        This function evaluates 'p_XT' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        X: array_like
+            Concentration in kg/kg.
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        p: ndarray
+            Pressure in Pa.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('abs_con_p_XT', X, T)
+
     def T_pX(self, p: float, X: float) -> float:
         r"""Cacluate temperature.
 
@@ -179,6 +260,37 @@ class WPairStructAbsorptionConventional(WPairCStruct):
         return self._sorp_prop_lib.abs_con_T_pX(c_double(p), c_double(X),
                                                 self._wpair_c_struct)
 
+    def T_pX_array(self, p: ArrayLike, X: ArrayLike) -> ndarray:
+        r"""Calculate temperature for arrays of states.
+
+        This function evaluates 'T_pX' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        p: array_like
+            Pressure in Pa.
+        X: array_like
+            Concentration in kg/kg.
+
+        Returns
+        -------
+        T: ndarray
+            Temperature in K.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('abs_con_T_pX', p, X)
+
     def dX_dp_pT(self, p: float, T: float) -> float:
         r"""Cacluate derivative of loading wrt. pressure.
 
@@ -212,6 +324,37 @@ class WPairStructAbsorptionConventional(WPairCStruct):
         return self._sorp_prop_lib.abs_con_dX_dp_pT(c_double(p), c_double(T),
                                                     self._wpair_c_struct)
 
+    def dX_dp_pT_array(self, p: ArrayLike, T: ArrayLike) -> ndarray:
+        r"""Calculate derivative of loading wrt. pressure for arrays of states.
+
+        This function evaluates 'dX_dp_pT' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        p: array_like
+            Pressure in Pa.
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        dw_dp: ndarray
+            Derivative of loading wrt. pressure in kg/kg/Pa.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('abs_con_dX_dp_pT', p, T)
+
     def dX_dT_pT(self, p: float, T: float) -> float:
         r"""Cacluate derivative of loading wrt. temperature.
 
@@ -245,6 +388,37 @@ class WPairStructAbsorptionConventional(WPairCStruct):
         return self._sorp_prop_lib.abs_con_dX_dT_pT(c_double(p), c_double(T),
                                                     self._wpair_c_struct)
 
+    def dX_dT_pT_array(self, p: ArrayLike, T: ArrayLike) -> ndarray:
+        r"""Calculate derivative of loading wrt. temperature for arrays of states.
+
+        This function evaluates 'dX_dT_pT' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        p: array_like
+            Pressure in Pa.
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        dw_dT: ndarray
+            Derivative of loading wrt. temperature in kg/kg/K.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('abs_con_dX_dT_pT', p, T)
+
     def dp_dX_XT(self, X: float, T: float) -> float:
         r"""Cacluate derivative of pressure wrt. loading.
 
@@ -278,6 +452,37 @@ class WPairStructAbsorptionConventional(WPairCStruct):
         return self._sorp_prop_lib.abs_con_dp_dX_XT(c_double(X), c_double(T),
                                                     self._wpair_c_struct)
 
+    def dp_dX_XT_array(self, X: ArrayLike, T: ArrayLike) -> ndarray:
+        r"""Calculate derivative of pressure wrt. loading for arrays of states.
+
+        This function evaluates 'dp_dX_XT' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        X: array_like
+            Concentration in kg/kg.
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        dp_dw: ndarray
+            Derivative of pressure wrt. loading in Pa.kg/kg.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('abs_con_dp_dX_XT', X, T)
+
     def dp_dT_XT(self, X: float, T: float) -> float:
         r"""Cacluate derivative of pressure wrt. temperature.
 
@@ -311,6 +516,73 @@ class WPairStructAbsorptionConventional(WPairCStruct):
         return self._sorp_prop_lib.abs_con_dp_dT_XT(c_double(X), c_double(T),
                                                     self._wpair_c_struct)
 
+    def dp_dT_XT_array(self, X: ArrayLike, T: ArrayLike) -> ndarray:
+        r"""Calculate derivative of pressure wrt. temperature for arrays of states.
+
+        This function evaluates 'dp_dT_XT' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        X: array_like
+            Concentration in kg/kg.
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        dp_dw: ndarray
+            Derivative of pressure wrt. temperature in Pa/K.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('abs_con_dp_dT_XT', X, T)
+
+    def chart(self, chart: str, curves: ArrayLike, points: ArrayLike) -> dict:
+        r"""Generate chart.
+
+        This function generates all curves of a chart (i.e., isotherms, isosteres, isobars, or
+        Dühring chart) using a single call of the SorpPropLib.DLL. Pressures exceeding the vapor
+        pressure are clipped and failed entries are masked.
+
+        Parameters
+        ----------
+        chart: str
+            Type of chart: 'isotherms', 'isosteres', 'isobars', or 'duehring'.
+        curves: array_like
+            Temperatures in K for isotherms, concentrations in kg/kg for isosteres and Dühring
+            charts, or pressures in Pa for isobars.
+        points: array_like
+            Pressures in Pa for isotherms or temperatures in K otherwise.
+
+        Returns
+        -------
+        dict
+            Dict containing keys 'values' (i.e., concentrations in kg/kg for isotherms and isobars
+            or pressures in Pa otherwise), 'valid', 'p_sat', and 'T_sat'.
+
+        See Also
+        --------
+        WPairCStruct._evaluate_chart:
+            Detailed description of returned dict.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        function = 'abs_con_X_pT' if chart in ('isotherms', 'isobars') else 'abs_con_p_XT'
+        return self._evaluate_chart(chart, function, curves, points)
+
 
 # %% Definition of class WPairStructAbsorptionActivity
 #
@@ -403,6 +675,41 @@ class WPairStructAbsorptionActivity(WPairCStruct):
                                                     c_double(v1), c_double(v2),
                                                     self._wpair_c_struct)
 
+    def g_Txv1v2_array(self, T: ArrayLike, x: ArrayLike, v1: ArrayLike, v2: ArrayLike) -> ndarray:
+        r"""Calculate activity coefficient for arrays of states.
+
+        This function evaluates 'g_Txv1v2' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        T: array_like
+            Temperature in K.
+        x: array_like
+            Mole fraction of first component in liquid phase in mol/mol.
+        v1: array_like
+            Molar volume of first component in m³/mol.
+        v2: array_like
+            Molar volume of second component in m³/mol.
+
+        Returns
+        -------
+        g: ndarray
+            Activity coefficient of first component.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('abs_act_g_Txv1v2', T, x, v1, v2)
+
     def p_Txv1v2(self, T: float, x: float, v1: float, v2: float) -> float:
         r"""Cacluate pressure.
 
@@ -440,6 +747,41 @@ class WPairStructAbsorptionActivity(WPairCStruct):
                                                     c_double(v1), c_double(v2),
                                                     self._wpair_c_struct)
 
+    def p_Txv1v2_array(self, T: ArrayLike, x: ArrayLike, v1: ArrayLike, v2: ArrayLike) -> ndarray:
+        r"""Calculate pressure for arrays of states.
+
+        This function evaluates 'p_Txv1v2' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        T: array_like
+            Temperature in K.
+        x: array_like
+            Mole fraction of first component in liquid phase in mol/mol.
+        v1: array_like
+            Molar volume of first component in m³/mol.
+        v2: array_like
+            Molar volume of second component in m³/mol.
+
+        Returns
+        -------
+        p: ndarray
+            Pressure in Pa.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('abs_act_p_Txv1v2', T, x, v1, v2)
+
     def x_pTv1v2(self, p: float, T: float, v1: float, v2: float) -> float:
         r"""Cacluate mole fraction in liquid phase.
 
@@ -476,6 +818,41 @@ class WPairStructAbsorptionActivity(WPairCStruct):
                                                     c_double(v1), c_double(v2),
                                                     self._wpair_c_struct)
 
+    def x_pTv1v2_array(self, p: ArrayLike, T: ArrayLike, v1: ArrayLike, v2: ArrayLike) -> ndarray:
+        r"""Calculate mole fraction in liquid phase for arrays of states.
+
+        This function evaluates 'x_pTv1v2' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        p: array_like
+            Pressure in Pa.
+        T: array_like
+            Temperature in K.
+        v1: array_like
+            Molar volume of first component in m³/mol.
+        v2: array_like
+            Molar volume of second component in m³/mol.
+
+        Returns
+        -------
+        x: ndarray
+            Mole fraction of first component in liquid phase in mol/mol.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('abs_act_x_pTv1v2', p, T, v1, v2)
+
     def p_Txv1v2psat(self, T: float, x: float, v1: float, v2: float, p_sat: float) -> float:
         r"""Cacluate pressure.
 
@@ -515,6 +892,44 @@ class WPairStructAbsorptionActivity(WPairCStruct):
                                                         c_double(v1), c_double(v2),
                                                         c_double(p_sat), self._wpair_c_struct)
 
+    def p_Txv1v2psat_array(self, T: ArrayLike, x: ArrayLike, v1: ArrayLike, v2: ArrayLike,
+                                 p_sat: ArrayLike) -> ndarray:
+        r"""Calculate pressure for arrays of states.
+
+        This function evaluates 'p_Txv1v2psat' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        T: array_like
+            Temperature in K.
+        x: array_like
+            Mole fraction of first component in liquid phase in mol/mol.
+        v1: array_like
+            Molar volume of first component in m³/mol.
+        v2: array_like
+            Molar volume of second component in m³/mol.
+        p_sat: array_like
+            Vapor pressure in Pa.
+
+        Returns
+        -------
+        p: ndarray
+            Pressure in Pa.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('abs_act_p_Txv1v2psat', T, x, v1, v2, p_sat)
+
     def x_pTv1v2psat(self, p: float, T: float, v1: float, v2: float, p_sat: float) -> float:
         r"""Cacluate mole fraction in liquid phase.
 
@@ -554,6 +969,44 @@ class WPairStructAbsorptionActivity(WPairCStruct):
                                                         c_double(v1), c_double(v2),
                                                         c_double(p_sat), self._wpair_c_struct)
 
+    def x_pTv1v2psat_array(self, p: ArrayLike, T: ArrayLike, v1: ArrayLike, v2: ArrayLike,
+                                 p_sat: ArrayLike) -> ndarray:
+        r"""Calculate mole fraction in liquid phase for arrays of states.
+
+        This function evaluates 'x_pTv1v2psat' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        p: array_like
+            Pressure in Pa.
+        T: array_like
+            Temperature in K.
+        v1: array_like
+            Molar volume of first component in m³/mol.
+        v2: array_like
+            Molar volume of second component in m³/mol.
+        p_sat: array_like
+            Vapor pressure in Pa.
+
+        Returns
+        -------
+        x: ndarray
+            Mole fraction of first component in liquid phase in mol/mol.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('abs_act_x_pTv1v2psat', p, T, v1, v2, p_sat)
+
 
 # %% Definition of class WPairStructAbsorptionMixing
 #
@@ -568,16 +1021,26 @@ class WPairStructAbsorptionMixing(WPairCStruct):
     -------
     x_pT:
         Calculates mole fraction in liquid phase depending on pressure and temperature.
+    x_pT_array:
+        Same as 'x_pT' but for arrays of states.
     p_Tx:
         Calculates pressure depending on temperature and mole fraction in liquid phase.
+    p_Tx_array:
+        Same as 'p_Tx' but for arrays of states.
     T_px:
         Calculates temperature depending on pressure and mole fraction in liquid phase.
+    T_px_array:
+        Same as 'T_px' but for arrays of states.
     dp_dx_Tx:
         Calculates derivative of pressure wrt. mole fraction in liquid phase depending on
         temperature and mole fraction in liquid phase.
+    dp_dx_Tx_array:
+        Same as 'dp_dx_Tx' but for arrays of states.
     dp_dT_Tx:
         Calculates derivative of pressure wrt. temperature depending on temperature and mole
         fraction in liquid phase.
+    dp_dT_Tx_array:
+        Same as 'dp_dT_Tx' but for arrays of states.
 
     History
     -------
@@ -650,6 +1113,41 @@ class WPairStructAbsorptionMixing(WPairCStruct):
         #
         return (x, y1, y2)
 
+    def x_pT_array(self, p: ArrayLike, T: ArrayLike) -> tuple:
+        r"""Calculate mole fraction in liquid phase for arrays of states.
+
+        This function evaluates 'x_pT' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        p: array_like
+            Pressure in Pa.
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        x: ndarray
+            Mole fraction of first component in liquid phase in mol/mol.
+        y1: ndarray
+            Mole fraction of first component in vapor phase in mol/mol.
+        y2: ndarray
+            Mole fraction of second component in vapor phase in mol/mol.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('abs_mix_x_pT', p, T, vapor=True)
+
     def p_Tx(self, T: float, x: float) -> float:
         r"""Cacluate pressure.
 
@@ -694,6 +1192,41 @@ class WPairStructAbsorptionMixing(WPairCStruct):
         #
         return (p, y1, y2)
 
+    def p_Tx_array(self, T: ArrayLike, x: ArrayLike) -> tuple:
+        r"""Calculate pressure for arrays of states.
+
+        This function evaluates 'p_Tx' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        T: array_like
+            Temperature in K.
+        x: array_like
+            Mole fraction of first component in liquid phase in mol/mol.
+
+        Returns
+        -------
+        p: ndarray
+            Pressure in Pa.
+        y1: ndarray
+            Mole fraction of first component in vapor phase in mol/mol.
+        y2: ndarray
+            Mole fraction of second component in vapor phase in mol/mol.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('abs_mix_p_Tx', T, x, vapor=True)
+
     def T_px(self, p: float, x: float) -> float:
         r"""Cacluate temperature.
 
@@ -738,6 +1271,41 @@ class WPairStructAbsorptionMixing(WPairCStruct):
         #
         return (T, y1, y2)
 
+    def T_px_array(self, p: ArrayLike, x: ArrayLike) -> tuple:
+        r"""Calculate temperature for arrays of states.
+
+        This function evaluates 'T_px' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        p: array_like
+            Pressure in Pa.
+        x: array_like
+            Mole fraction of first component in liquid phase in mol/mol.
+
+        Returns
+        -------
+        T: ndarray
+            Temperature in K.
+        y1: ndarray
+            Mole fraction of first component in vapor phase in mol/mol.
+        y2: ndarray
+            Mole fraction of second component in vapor phase in mol/mol.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('abs_mix_T_px', p, x, vapor=True)
+
     def dp_dx_Tx(self, T: float, x: float) -> float:
         r"""Cacluate derivative of pressure wrt. mole fraction in liquid phase.
 
@@ -769,6 +1337,37 @@ class WPairStructAbsorptionMixing(WPairCStruct):
         """
         return self._sorp_prop_lib.abs_mix_dp_dx_Tx(c_double(T), c_double(x), self._wpair_c_struct)
 
+    def dp_dx_Tx_array(self, T: ArrayLike, x: ArrayLike) -> ndarray:
+        r"""Calculate derivative of pressure wrt. mole fraction for arrays of states.
+
+        This function evaluates 'dp_dx_Tx' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        T: array_like
+            Temperature in K.
+        x: array_like
+            Mole fraction of first component in liquid phase in mol/mol.
+
+        Returns
+        -------
+        dp_dx: ndarray
+            Pressure in Pa.mol/mol.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('abs_mix_dp_dx_Tx', T, x)
+
     def dp_dT_Tx(self, T: float, x: float) -> float:
         r"""Cacluate derivative of pressure wrt. temperature.
 
@@ -800,6 +1399,37 @@ class WPairStructAbsorptionMixing(WPairCStruct):
         """
         return self._sorp_prop_lib.abs_mix_dp_dT_Tx(c_double(T), c_double(x), self._wpair_c_struct)
 
+    def dp_dT_Tx_array(self, T: ArrayLike, x: ArrayLike) -> ndarray:
+        r"""Calculate derivative of pressure wrt. temperature for arrays of states.
+
+        This function evaluates 'dp_dT_Tx' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        T: array_like
+            Temperature in K.
+        x: array_like
+            Mole fraction of first component in liquid phase in mol/mol.
+
+        Returns
+        -------
+        dp_dT: ndarray
+            Pressure in Pa/K.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('abs_mix_dp_dT_Tx', T, x)
+
 
 # %% Definition of class WPairStructAbsorption
 #
@@ -17,6 +17,9 @@ Revisions
 from ctypes import c_double, cdll
 from typing import Callable
 
+from numpy import ndarray
+from numpy.typing import ArrayLike
+
 from .interface_cdll import WorkingPair
 from .wpair_partial import  WPairCStruct
 
@@ -1398,22 +1401,40 @@ class WPairStructAdsorption(WPairCStruct):
     -------
     w_pT:
         Calculates loading depending on pressure and temperature.
+    w_pT_array:
+        Same as 'w_pT' but for arrays of states.
     p_wT:
         Calculates pressure depending on loading and temperature.
+    p_wT_array:
+        Same as 'p_wT' but for arrays of states.
     T_pw:
         Calculates temperature depending on pressure and loading.
+    T_pw_array:
+        Same as 'T_pw' but for arrays of states.
     dw_dp_pT:
         Calculates derivative of loading wrt. pressure depending on pressure and temperature.
+    dw_dp_pT_array:
+        Same as 'dw_dp_pT' but for arrays of states.
     dw_dT_pT:
         Calculates derivative of loading wrt. temperature depending on pressure and temperature.
+    dw_dT_pT_array:
+        Same as 'dw_dT_pT' but for arrays of states.
     dp_dw_wT:
         Calculates derivative of pressure wrt. loading depending on loading and temperature.
+    dp_dw_wT_array:
+        Same as 'dp_dw_wT' but for arrays of states.
     dp_dT_wT:
         Calculates derivative of pressure wrt. temperature depending on loading and temperature.
+    dp_dT_wT_array:
+        Same as 'dp_dT_wT' but for arrays of states.
     piStar_pyxgTM:
         Calculates reduced spreading pressure in depending on pressure, molar fraction of
         refrigerant in vapor phase, molar fraction of refrigerant in adsorbed phase, activity
         coefficient of refrigerant in adsorbed phase,  temperature, and molar mass of refrigerant.
+    piStar_pyxgTM_array:
+        Same as 'piStar_pyxgTM' but for arrays of states.
+    chart:
+        Generates isotherms, isosteres, isobars, or Dühring chart.
 
     History
     -------
@@ -1495,6 +1516,37 @@ class WPairStructAdsorption(WPairCStruct):
         """
         return self._sorp_prop_lib.ads_w_pT(c_double(p), c_double(T), self._wpair_c_struct)
 
+    def w_pT_array(self, p: ArrayLike, T: ArrayLike) -> ndarray:
+        r"""Calculate loading for arrays of states.
+
+        This function evaluates 'w_pT' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        p: array_like
+            Pressure in Pa.
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        w: ndarray
+            Loading in kg/kg.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('ads_w_pT', p, T)
+
     def p_wT(self, w: float, T: float) -> float:
         r"""Cacluate pressure.
 
@@ -1539,6 +1591,37 @@ class WPairStructAdsorption(WPairCStruct):
         """
         return self._sorp_prop_lib.ads_p_wT(c_double(w), c_double(T), self._wpair_c_struct)
 
+    def p_wT_array(self, w: ArrayLike, T: ArrayLike) -> ndarray:
+        r"""Calculate pressure for arrays of states.
+
+        This function evaluates 'p_wT' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        w: array_like
+            Loading in kg/kg.
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        p: ndarray
+            Pressure in Pa.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('ads_p_wT', w, T)
+
     def T_pw(self, p: float, w: float) -> float:
         r"""Cacluate temperature.
 
@@ -1583,6 +1666,37 @@ class WPairStructAdsorption(WPairCStruct):
         """
         return self._sorp_prop_lib.ads_T_pw(c_double(p), c_double(w), self._wpair_c_struct)
 
+    def T_pw_array(self, p: ArrayLike, w: ArrayLike) -> ndarray:
+        r"""Calculate temperature for arrays of states.
+
+        This function evaluates 'T_pw' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        p: array_like
+            Pressure in Pa.
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        T: ndarray
+            Temperature in K.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('ads_T_pw', p, w)
+
     def dw_dp_pT(self, p: float, T: float) -> float:
         r"""Cacluate derivative of loading wrt. pressure.
 
@@ -1628,6 +1742,37 @@ class WPairStructAdsorption(WPairCStruct):
         """
         return self._sorp_prop_lib.ads_dw_dp_pT(c_double(p), c_double(T), self._wpair_c_struct)
 
+    def dw_dp_pT_array(self, p: ArrayLike, T: ArrayLike) -> ndarray:
+        r"""Calculate derivative of loading wrt. pressure for arrays of states.
+
+        This function evaluates 'dw_dp_pT' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        p: array_like
+            Pressure in Pa.
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        dw_dp: ndarray
+            Derivative of loading wrt. pressure in kg/kg/Pa.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('ads_dw_dp_pT', p, T)
+
     def dw_dT_pT(self, p: float, T: float) -> float:
         r"""Cacluate derivative of loading wrt. temperature.
 
@@ -1673,6 +1818,37 @@ class WPairStructAdsorption(WPairCStruct):
         """
         return self._sorp_prop_lib.ads_dw_dT_pT(c_double(p), c_double(T), self._wpair_c_struct)
 
+    def dw_dT_pT_array(self, p: ArrayLike, T: ArrayLike) -> ndarray:
+        r"""Calculate derivative of loading wrt. temperature for arrays of states.
+
+        This function evaluates 'dw_dT_pT' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        p: array_like
+            Pressure in Pa.
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        dw_dT: ndarray
+            Derivative of loading wrt. temperature in kg/kg/K.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('ads_dw_dT_pT', p, T)
+
     def dp_dw_wT(self, w: float, T: float) -> float:
         r"""Cacluate derivative of pressure wrt. loading.
 
@@ -1718,6 +1894,37 @@ class WPairStructAdsorption(WPairCStruct):
         """
         return self._sorp_prop_lib.ads_dp_dw_wT(c_double(w), c_double(T), self._wpair_c_struct)
 
+    def dp_dw_wT_array(self, w: ArrayLike, T: ArrayLike) -> ndarray:
+        r"""Calculate derivative of pressure wrt. loading for arrays of states.
+
+        This function evaluates 'dp_dw_wT' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        w: array_like
+            Loading in kg/kg.
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        dp_dw: ndarray
+            Derivative of pressure wrt. loading in Pa.kg/kg.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('ads_dp_dw_wT', w, T)
+
     def dp_dT_wT(self, w: float, T: float) -> float:
         r"""Cacluate derivative of pressure wrt. temperature.
 
@@ -1763,6 +1970,37 @@ class WPairStructAdsorption(WPairCStruct):
         """
         return self._sorp_prop_lib.ads_dp_dT_wT(c_double(w), c_double(T), self._wpair_c_struct)
 
+    def dp_dT_wT_array(self, w: ArrayLike, T: ArrayLike) -> ndarray:
+        r"""Calculate derivative of pressure wrt. temperature for arrays of states.
+
+        This function evaluates 'dp_dT_wT' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        w: array_like
+            Loading in kg/kg.
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        dp_dw: ndarray
+            Derivative of pressure wrt. temperature in Pa/K.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('ads_dp_dT_wT', w, T)
+
     def piStar_pyxgTM(self, p: float, y: float, x: float,
                       gamma: float, T: float, M: float) -> float:
         r"""Cacluate reduced spreading pressure.
@@ -1829,3 +2067,79 @@ class WPairStructAdsorption(WPairCStruct):
         return self._sorp_prop_lib.ads_piStar_pyxgTM(c_double(p), c_double(y), c_double(x),
                                                      c_double(gamma), c_double(T),
                                                      c_double(M), self._wpair_c_struct)
+
+    def piStar_pyxgTM_array(self, p: ArrayLike, y: ArrayLike, x: ArrayLike, gamma: ArrayLike,
+                                  T: ArrayLike, M: ArrayLike) -> ndarray:
+        r"""Calculate reduced spreading pressure for arrays of states.
+
+        This function evaluates 'piStar_pyxgTM' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        p: array_like
+            Total pressure in Pa.
+        y: array_like
+            Molar fraction of refrigerant in vapor phase in mol/mol.
+        x: array_like
+            Molar fraction of refrigerant in adsorbed phase in mol/mol.
+        gamma: array_like
+            Activity coefficient of refrigerant in adsorbed phase.
+        T: array_like
+            Temperature in K.
+        M: array_like
+            Molar mass of refrigerant in kg/mol.
+
+        Returns
+        -------
+        piStart: ndarray
+            Reduced spreading pressure in kg/mol.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('ads_piStar_pyxgTM', p, y, x, gamma, T, M)
+
+    def chart(self, chart: str, curves: ArrayLike, points: ArrayLike) -> dict:
+        r"""Generate chart.
+
+        This function generates all curves of a chart (i.e., isotherms, isosteres, isobars, or
+        Dühring chart) using a single call of the SorpPropLib.DLL. Pressures exceeding the vapor
+        pressure are clipped and failed entries are masked.
+
+        Parameters
+        ----------
+        chart: str
+            Type of chart: 'isotherms', 'isosteres', 'isobars', or 'duehring'.
+        curves: array_like
+            Temperatures in K for isotherms, loadings in kg/kg for isosteres and Dühring
+            charts, or pressures in Pa for isobars.
+        points: array_like
+            Pressures in Pa for isotherms or temperatures in K otherwise.
+
+        Returns
+        -------
+        dict
+            Dict containing keys 'values' (i.e., loadings in kg/kg for isotherms and isobars
+            or pressures in Pa otherwise), 'valid', 'p_sat', and 'T_sat'.
+
+        See Also
+        --------
+        WPairCStruct._evaluate_chart:
+            Detailed description of returned dict.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        function = 'ads_w_pT' if chart in ('isotherms', 'isobars') else 'ads_p_wT'
+        return self._evaluate_chart(chart, function, curves, points)
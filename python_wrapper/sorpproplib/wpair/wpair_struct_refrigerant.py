@@ -14,6 +14,9 @@ Revisions
 # %% Import libraries.
 #
 from ctypes import c_double, cdll
+from numpy import ndarray
+from numpy.typing import ArrayLike
+
 from .interface_cdll import WorkingPair
 from .wpair_partial import  WPairCStruct
 
@@ -39,14 +42,24 @@ class WPairStructRefrigerant(WPairCStruct):
     -------
     p_sat_T:
         Calculates vapor pressure depending on temperature.
+    p_sat_T_array:
+        Same as 'p_sat_T' but for arrays of states.
     T_sat_p:
         Calculates vapor temperature depending on pressure.
+    T_sat_p_array:
+        Same as 'T_sat_p' but for arrays of states.
     rho_sat_l_T:
         Calculates saturated liquid density depending on temperature.
+    rho_sat_l_T_array:
+        Same as 'rho_sat_l_T' but for arrays of states.
     dp_sat_dT_T:
         Calculates derivative of vapor pressure wrt. temperature depending on temperature.
+    dp_sat_dT_T_array:
+        Same as 'dp_sat_dT_T' but for arrays of states.
     drho_sat_l_dT_T:
         Calculates derivative of aturated liquid density wrt. temperature depending on temperature.
+    drho_sat_l_dT_T_array:
+        Same as 'drho_sat_l_dT_T' but for arrays of states.
 
     History
     -------
@@ -104,6 +117,35 @@ class WPairStructRefrigerant(WPairCStruct):
         """
         return self._sorp_prop_lib.ref_p_sat_T(c_double(T), self._wpair_c_struct)
 
+    def p_sat_T_array(self, T: ArrayLike) -> ndarray:
+        r"""Calculate vapor pressure for arrays of states.
+
+        This function evaluates 'p_sat_T' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        p_sat: ndarray
+            Vapor pressure in Pa.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('ref_p_sat_T', T)
+
     def T_sat_p(self, p: float) -> float:
         r"""Calculate temperature.
 
@@ -133,6 +175,35 @@ class WPairStructRefrigerant(WPairCStruct):
         """
         return self._sorp_prop_lib.ref_T_sat_p(c_double(p), self._wpair_c_struct)
 
+    def T_sat_p_array(self, p: ArrayLike) -> ndarray:
+        r"""Calculate temperature for arrays of states.
+
+        This function evaluates 'T_sat_p' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        p: array_like
+            Vapor pressure in Pa.
+
+        Returns
+        -------
+        T_sat: ndarray
+            Vapor temperature in K.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('ref_T_sat_p', p)
+
     def rho_sat_l_T(self, T: float) -> float:
         r"""Calculate saturated liquid density.
 
@@ -162,6 +233,35 @@ class WPairStructRefrigerant(WPairCStruct):
         """
         return self._sorp_prop_lib.ref_rho_l_T(c_double(T), self._wpair_c_struct)
 
+    def rho_sat_l_T_array(self, T: ArrayLike) -> ndarray:
+        r"""Calculate saturated liquid density for arrays of states.
+
+        This function evaluates 'rho_sat_l_T' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        rho_sat_l: ndarray
+            Saturated liquid density in kg/m³.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('ref_rho_l_T', T)
+
     def dp_sat_dT_T(self, T: float) -> float:
         r"""Calculate derivative of vapor pressure wrt. temperature.
 
@@ -192,6 +292,35 @@ class WPairStructRefrigerant(WPairCStruct):
         """
         return self._sorp_prop_lib.ref_dp_sat_dT_T(c_double(T), self._wpair_c_struct)
 
+    def dp_sat_dT_T_array(self, T: ArrayLike) -> ndarray:
+        r"""Calculate derivative of vapor pressure wrt. temperature for arrays of states.
+
+        This function evaluates 'dp_sat_dT_T' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        dp_sat_dT: ndarray
+            Derivative of vapor pressure wrt. temperature in Pa/K.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('ref_dp_sat_dT_T', T)
+
     def drho_sat_l_dT_T(self, T: float) -> float:
         r"""Calculate derivative of saturated liquid density wrt. temperature.
 
@@ -221,3 +350,32 @@ class WPairStructRefrigerant(WPairCStruct):
             First implementation.
         """
         return self._sorp_prop_lib.ref_drho_l_dT_T(c_double(T), self._wpair_c_struct)
+
+    def drho_sat_l_dT_T_array(self, T: ArrayLike) -> ndarray:
+        r"""Calculate derivative of saturated liquid density wrt. temperature for arrays of states.
+
+        This function evaluates 'drho_sat_l_dT_T' for arrays of states using a single call of the
+        SorpPropLib.DLL. Inputs are broadcast against each other, and results have the broadcast
+        shape of the inputs.
+
+        Parameters
+        ----------
+        T: array_like
+            Temperature in K.
+
+        Returns
+        -------
+        drho_sat_l_dT: ndarray
+            Darivative of saturated liquid density wrt. temperature in kg/m³/K.
+
+        Notes
+        -----
+        States are evaluated in parallel and the GIL is released during the calculation. States
+        whose calculation fails are set to -1.
+
+        History
+        -------
+        10/18/2026, by agent:
+            First implementation.
+        """
+        return self._evaluate_array('ref_drho_l_dT_T', T)